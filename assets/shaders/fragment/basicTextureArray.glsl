@@ -0,0 +1,12 @@
+#version 430
+
+in vec2 vt_out;
+
+uniform sampler2DArray textureArrayId;
+uniform int textureLayer;
+
+out vec4 frag_colour;
+
+void main() {
+    frag_colour = texture(textureArrayId, vec3(vt_out, textureLayer));
+}
@@ -3,6 +3,8 @@ out vec4 frag_colour;
 
 in vec4 out_world_pos;
 in vec3 out_world_normal;
+// Index into materials, see MaterialRegistry.h
+flat in int out_material_index;
 
 // Bit masks
 // LSB -> MSB
@@ -27,24 +29,28 @@ struct Light {
     // 4 bytes padding - aligned to 16 bytes
 };
 
-// Keep in sync with ShaderLights.h -> Material
+// Keep in sync with MaterialGLSL.h
 struct Material {
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 specular;
-    float shininess;
+    vec4 ambient; // 16 bytes
+    vec4 diffuse; // 16 bytes
+    vec4 specular; // 16 bytes
+    float shininess; // 4 bytes
+    // 12 bytes padding - aligned to 16 bytes
 };
 
 uniform vec3 cameraPosition;
 
-uniform Material material;
-
 layout(std430, binding = 0) buffer Lights {
     Light lights[];
 };
 
+layout(std430, binding = 1) buffer Materials {
+    Material materials[];
+};
+
 void main() {
     vec3 local_pos = out_world_pos.xyz / out_world_pos.w;
+    Material material = materials[out_material_index];
 
     bool has_ambient = (flags & (1 << 0)) != 0;
     bool has_diffuse = (flags & (1 << 1)) != 0;
@@ -19,26 +19,33 @@ struct Light {
     // 4 bytes padding - aligned to 16 bytes
 };
 
-// Keep in sync with ShaderLights.h -> Material
+// Keep in sync with MaterialGLSL.h
 struct Material {
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 specular;
-    float shininess;
+    vec4 ambient; // 16 bytes
+    vec4 diffuse; // 16 bytes
+    vec4 specular; // 16 bytes
+    float shininess; // 4 bytes
+    // 12 bytes padding - aligned to 16 bytes
 };
 
 uniform vec3 cameraPosition;
 
-uniform Material material;
+// Index into materials, see MaterialRegistry.h
+uniform int materialIndex;
 
 layout(std430, binding = 0) buffer Lights {
     Light lights[];
 };
 
+layout(std430, binding = 1) buffer Materials {
+    Material materials[];
+};
+
 uniform sampler2D textureUnitId;
 
 void main() {
     vec3 local_pos = out_world_pos.xyz / out_world_pos.w;
+    Material material = materials[materialIndex];
 
     frag_colour = texture(textureUnitId, vt_out);
 
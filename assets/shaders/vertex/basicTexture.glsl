@@ -7,6 +7,10 @@ layout(location = 2) in vec2 vt;
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
+// transpose(inverse(mat3(modelMatrix))), computed on the CPU
+uniform mat3 normalMatrix;
+// Region of an atlas page (see TextureAtlas.h): uv * xy + zw
+uniform vec4 uvTransform = vec4(1, 1, 0, 0);
 
 out vec2 vt_out;
 out vec4 out_world_pos;
@@ -14,8 +18,7 @@ out vec3 out_world_normal;
 
 void main() {
     gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vp, 1.0);
-    vt_out = vt;
+    vt_out = vt * uvTransform.xy + uvTransform.zw;
     out_world_pos = modelMatrix * vec4(vp, 1.0f);
-    mat3 normal = transpose(inverse(mat3(modelMatrix)));
-    out_world_normal = normalize(normal * vn);
+    out_world_normal = normalize(normalMatrix * vn);
 }
@@ -5,13 +5,18 @@ layout (location = 1) in vec3 in_normal;
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
+// transpose(inverse(mat3(modelMatrix))), computed on the CPU
+uniform mat3 normalMatrix;
+// Index into materials, see MaterialRegistry.h
+uniform int materialIndex;
 
 out vec4 out_world_pos;
 out vec3 out_world_normal;
+flat out int out_material_index;
 
 void main() {
     out_world_pos = modelMatrix * vec4(in_position, 1.0f);
-    mat3 normal = transpose(inverse(mat3(modelMatrix)));
-    out_world_normal = normalize(normal * in_normal);
+    out_world_normal = normalize(normalMatrix * in_normal);
+    out_material_index = materialIndex;
     gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(in_position, 1.0);
 };
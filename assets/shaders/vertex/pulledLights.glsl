@@ -0,0 +1,81 @@
+#version 430 core
+#extension GL_ARB_shader_draw_parameters : enable
+
+// Programmable vertex pulling, see MeshPool.h
+// There are no vertex attributes, everything is fetched from the SSBOs below
+
+// Keep in sync with MeshPool.h -> MeshGLSL
+struct Mesh {
+    int baseVertex; // offset of the first vertex in vertices, in floats
+    int stride; // floats
+    int normalOffset; // floats
+    int uvOffset; // floats, -1 if there are no texture coordinates
+    int baseIndex; // offset of the first index in indices
+    int indexed; // 0 - vertices are drawn in order
+    // 8 bytes padding
+    int _padding_0;
+    int _padding_1;
+};
+
+// Keep in sync with MeshPool.h -> DrawGLSL
+struct Draw {
+    mat4 modelMatrix; // 64 bytes
+    mat3 normalMatrix; // 3 columns treated as vec4 - 48 bytes
+    uint meshIndex; // 4 bytes
+    uint materialIndex; // 4 bytes
+    // 8 bytes padding - aligned to 16 bytes
+};
+
+layout(std430, binding = 2) readonly buffer Vertices {
+    float vertices[];
+};
+
+layout(std430, binding = 3) readonly buffer Indices {
+    uint indices[];
+};
+
+layout(std430, binding = 4) readonly buffer Meshes {
+    Mesh meshes[];
+};
+
+layout(std430, binding = 5) readonly buffer Draws {
+    Draw draws[];
+};
+
+#ifdef GL_ARB_shader_draw_parameters
+#define DRAW_INDEX gl_DrawIDARB
+#else
+// Set for every draw when the extension is missing
+uniform int drawIndex;
+#define DRAW_INDEX drawIndex
+#endif
+
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+
+out vec4 out_world_pos;
+out vec3 out_world_normal;
+flat out int out_material_index;
+
+vec3 fetchVec3(int at) {
+    return vec3(vertices[at], vertices[at + 1], vertices[at + 2]);
+}
+
+void main() {
+    Draw draw = draws[DRAW_INDEX];
+    Mesh mesh = meshes[draw.meshIndex];
+
+    int vertex = gl_VertexID;
+    if (mesh.indexed != 0) {
+        vertex = int(indices[mesh.baseIndex + gl_VertexID]);
+    }
+    int base = mesh.baseVertex + vertex * mesh.stride;
+
+    vec3 position = fetchVec3(base);
+    vec3 normal = fetchVec3(base + mesh.normalOffset);
+
+    out_world_pos = draw.modelMatrix * vec4(position, 1.0f);
+    out_world_normal = normalize(draw.normalMatrix * normal);
+    out_material_index = int(draw.materialIndex);
+    gl_Position = projectionMatrix * viewMatrix * out_world_pos;
+}
@@ -2,16 +2,31 @@
 #include "drawable/DynamicModel.h"
 #include "shaders/Shader.h"
 
+#include "AssetManifest.h"
+#include "AssetPack.h"
+#include "CookedMesh.h"
+#include "CookedTexture.h"
+#include "ObjImporter.h"
 #include "Texture.h"
+#include "TextureArray.h"
+#include "TextureAtlas.h"
+#include "TextureStreamer.h"
+#include "ThreadPool.h"
+#include "UploadQueue.h"
 #include "assertions.h"
 #include "gl_utils.h"
 #include <GL/gl.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <optional>
-#include <sstream>
 #include <unordered_map>
+#include <vector>
 
 enum AssetType : uint8_t {
     ASSET_VERTEX_SHADER,
@@ -20,18 +35,98 @@ enum AssetType : uint8_t {
     ASSET_MODEL,
 };
 
+/*
+ * Memory taken by a loaded asset. CPU memory is what it keeps mapped (cooked
+ * levels of streamed textures), GPU memory the size of its GL storage.
+ */
+struct AssetMemory {
+    size_t cpuBytes = 0;
+    size_t gpuBytes = 0;
+};
+
+/*
+ * Limits for the cached assets of one AssetType, see AssetManager::setBudget.
+ * Cubemaps count as textures.
+ */
+struct AssetBudget {
+    size_t cpuBytes = SIZE_MAX;
+    size_t gpuBytes = SIZE_MAX;
+};
+
+/*
+ * One entry of AssetManager::getResidency
+ */
+struct AssetResidency {
+    std::filesystem::path path;
+    AssetType type;
+    AssetMemory memory;
+    // Owners besides the cache, the asset can be evicted when it's 0
+    long users;
+    // Frames since the last frame it had any users
+    uint64_t idleFrames;
+};
+
+/*
+ * Loaded asset kept by AssetManager
+ */
+template <typename Asset> struct CachedAsset {
+    std::shared_ptr<Asset> asset;
+    // Last frame anyone else held the asset
+    uint64_t lastUse = 0;
+};
+
+template <typename Asset>
+using AssetCache =
+    std::unordered_map<std::filesystem::path, CachedAsset<Asset>>;
+
 class AssetManager {
+  public:
+    // Layers of every pooled texture array, see loadTextureLayer
+    static constexpr GLsizei TEXTURE_ARRAY_CAPACITY = 16;
+    // Default VRAM budget of streamed textures
+    static constexpr size_t TEXTURE_BUDGET = 256 * 1024 * 1024;
+    // Default budgets of the caches, see setBudget
+    static constexpr AssetBudget TEXTURE_CACHE_BUDGET = {
+        .cpuBytes = 512 * 1024 * 1024, .gpuBytes = 1024 * 1024 * 1024};
+    static constexpr AssetBudget MODEL_CACHE_BUDGET = {
+        .cpuBytes = SIZE_MAX, .gpuBytes = 512 * 1024 * 1024};
+
   private:
     std::filesystem::path basePath;
-    size_t maxTextures = 0;
-    size_t currentTexture = 0;
-    std::unordered_map<std::filesystem::path, std::shared_ptr<Texture>>
-        loadedTextures;
-    std::unordered_map<std::filesystem::path, std::shared_ptr<Cubemap>>
-        loadedCubemaps;
+    // Frames seen by processUploads(), the clock of the caches
+    uint64_t frame = 0;
+    std::array<AssetBudget, 4> budgets;
 
-    std::unordered_map<std::filesystem::path, std::shared_ptr<DynamicModel>>
-        loadedModels;
+    // Clamped textures, small ones are regions of an atlas page
+    AssetCache<Texture> loadedTextures;
+    // Textures loaded with TextureWrap::REPEAT, never atlased. Their own
+    // cache, so the same file can also be loaded clamped.
+    AssetCache<Texture> repeatingTextures;
+    std::unordered_map<std::filesystem::path, TextureLayer> loadedLayers;
+    // Arrays textures of the same size and format are pooled into
+    std::vector<std::shared_ptr<TextureArray>> textureArrays;
+    // Pages small textures are packed into, see loadTexture
+    std::vector<TextureAtlas> atlases;
+    AssetCache<Cubemap> loadedCubemaps;
+
+    AssetCache<DynamicModel> loadedModels;
+
+    // Cooked assets written by zpg-cook, empty when it was never run
+    AssetManifest manifest;
+    // All cooked assets in one mapping, used before the loose cooked files
+    std::filesystem::path packPath;
+    std::optional<AssetPack> pack;
+    // Source OBJ files are parsed by ObjImporter instead of Assimp
+    bool nativeObjParser = true;
+
+    // Asynchronous loading, loaders read and decode, uploads are finished
+    // on the GL thread in processUploads()
+    UploadQueue uploads;
+    size_t pendingLoads = 0;
+    // Mip levels of textures from loadTextureStreamed
+    TextureStreamer streamer{TEXTURE_BUDGET};
+    // Last, so the threads are joined before anything they use is destroyed
+    ThreadPool loaders;
 
     constexpr std::filesystem::path getAssetPrefix(AssetType type) const {
         switch (type) {
@@ -52,143 +147,856 @@ class AssetManager {
         return basePath / relPath;
     }
 
-    std::optional<std::string>
-    readFileString(std::filesystem::path fullPath) const {
-        std::optional<std::vector<uint8_t>> buffer = readFileBinary(fullPath);
-        if (!buffer.has_value()) {
+    /*
+     * Runtime ready version of an asset, for example
+     * assets/cooked/models/house.obj.zmesh for assets/models/house.obj
+     */
+    std::filesystem::path getCookedPath(AssetType type, const char *fileName,
+                                        const char *extension) const {
+        auto path = basePath / "cooked" / getAssetPrefix(type) / fileName;
+        path += extension;
+        return path;
+    }
+
+    /*
+     * Cooked file is stale when its source is newer. When there is no source
+     * (only cooked assets are shipped), the cooked file is used.
+     */
+    static bool isCookedFresh(const std::filesystem::path &cooked,
+                              const std::filesystem::path &source) {
+        std::error_code ec;
+        auto sourceTime = std::filesystem::last_write_time(source, ec);
+        if (ec) {
+            return true;
+        }
+        auto cookedTime = std::filesystem::last_write_time(cooked, ec);
+        return !ec && cookedTime >= sourceTime;
+    }
+
+    /*
+     * Name of the asset in the manifest and the pack, e.g. "models/house.obj"
+     */
+    std::string getLogicalName(AssetType type,
+                               const std::string &fileName) const {
+        return (getAssetPrefix(type) / fileName).generic_string();
+    }
+
+    /*
+     * Looks the asset up in the pack. Returns its content only when the pack
+     * is not older than the source.
+     */
+    std::optional<std::span<const std::byte>>
+    findPacked(AssetType type, const std::string &fileName) const {
+        if (!pack.has_value()) {
+            return {};
+        }
+        auto name = getLogicalName(type, fileName);
+        if (!isCookedFresh(packPath, basePath / name)) {
+            return {};
+        }
+        return pack->find(name);
+    }
+
+    /*
+     * Looks the asset up in the zpg-cook manifest. Returns the cooked file
+     * only when it exists and is not older than its source.
+     */
+    std::optional<std::filesystem::path>
+    findCooked(AssetType type, const std::string &fileName) const {
+        auto name = getLogicalName(type, fileName);
+        auto entry = manifest.find(name);
+        if (!entry.has_value()) {
+            return {};
+        }
+        auto cooked = basePath / entry->cooked;
+        auto source = basePath / name;
+        if (!std::filesystem::exists(cooked) ||
+            !isCookedFresh(cooked, source)) {
+            return {};
+        }
+        return cooked;
+    }
+
+    /*
+     * CookedMesh or CookedTexture from the pack, or from its own file
+     */
+    template <typename Cooked>
+    std::optional<Cooked> openCooked(AssetType type,
+                                     const std::string &fileName) const {
+        if (auto bytes = findPacked(type, fileName)) {
+            if (auto cooked = Cooked::view(bytes.value())) {
+                return cooked;
+            }
+        }
+        if (auto path = findCooked(type, fileName)) {
+            return Cooked::open(path.value());
+        }
+        return {};
+    }
+
+    /*
+     * Compiles the shader straight from the pack or the mapped file, cooked
+     * one if there is any
+     */
+    template <typename Shader>
+    std::optional<Shader> compileShader(AssetType type,
+                                        const char *fileName) const {
+        if (auto bytes = findPacked(type, fileName)) {
+            return Shader::compile(std::string_view(
+                reinterpret_cast<const char *>(bytes->data()), bytes->size()));
+        }
+        auto path =
+            findCooked(type, fileName).value_or(getAssetPath(type, fileName));
+        // Callers report a shader that doesn't load, no need to abort here
+        auto file = MappedFile::open(path, MapHint::POPULATE);
+        if (!file.has_value()) {
+            std::cerr << "No shader at " << path << std::endl;
+            return {};
+        }
+        return Shader::compile(file->text());
+    }
+
+    // region Cache
+
+    /*
+     * The cached asset, marked as used in this frame. nullptr when it's not
+     * loaded.
+     */
+    template <typename Asset>
+    std::shared_ptr<Asset> findLoaded(AssetCache<Asset> &cache,
+                                      const std::filesystem::path &path) {
+        auto it = cache.find(path);
+        if (it == cache.end()) {
+            return nullptr;
+        }
+        it->second.lastUse = frame;
+        return it->second.asset;
+    }
+
+    /*
+     * Atlas regions have no memory of their own, their pages are counted
+     * once, see evictOverBudget
+     */
+    AssetMemory memoryOf(const Texture &texture) const {
+        if (texture.isAtlasRegion()) {
+            return {};
+        }
+        return {streamer.getMappedBytes(texture), texture.getGpuBytes()};
+    }
+
+    /*
+     * A page can't reuse the space of a region, evicting one frees nothing
+     * and loading it again would take new space
+     */
+    static bool isEvictable(const Texture &texture) {
+        return !texture.isAtlasRegion();
+    }
+
+    static bool isEvictable(const Cubemap &) { return true; }
+
+    static bool isEvictable(const DynamicModel &) { return true; }
+
+    static AssetMemory memoryOf(const Cubemap &cubemap) {
+        return {0, cubemap.getGpuBytes()};
+    }
+
+    static AssetMemory memoryOf(const DynamicModel &model) {
+        return {0, model.getGpuBytes()};
+    }
+
+    /*
+     * Calls visit(type, cache) for every cache that can be evicted from.
+     * Texture layers and atlas pages are shared by many textures, they stay.
+     */
+    template <typename Visit> void forEachCache(Visit visit) {
+        visit(ASSET_TEXTURE, loadedTextures);
+        visit(ASSET_TEXTURE, repeatingTextures);
+        visit(ASSET_TEXTURE, loadedCubemaps);
+        visit(ASSET_MODEL, loadedModels);
+    }
+
+    /*
+     * Once per frame. Assets only the cache holds are evicted, least
+     * recently used first, until every type fits into its budget. Assets
+     * that are still used are never evicted, so a type can stay over.
+     */
+    void evictOverBudget() {
+        struct Candidate {
+            uint64_t lastUse;
+            AssetMemory memory;
+            std::function<void()> evict;
+        };
+        std::array<AssetMemory, 4> used;
+        std::array<std::vector<Candidate>, 4> candidates;
+        forEachCache([&](AssetType type, auto &cache) {
+            for (auto &[path, cached] : cache) {
+                if (cached.asset.use_count() > 1) {
+                    cached.lastUse = frame;
+                }
+                auto memory = memoryOf(*cached.asset);
+                used[type].cpuBytes += memory.cpuBytes;
+                used[type].gpuBytes += memory.gpuBytes;
+                if (1 == cached.asset.use_count() &&
+                    isEvictable(*cached.asset)) {
+                    candidates[type].push_back(
+                        {cached.lastUse, memory,
+                         [&cache, path]() {
+                             std::cout << "Evicting " << path << std::endl;
+                             cache.erase(path);
+                         }});
+                }
+            }
+        });
+        // Pages count against the budget once, whatever is packed into them
+        for (const auto &atlas : atlases) {
+            used[ASSET_TEXTURE].gpuBytes += atlas.getGpuBytes();
+        }
+
+        for (size_t type = 0; type < budgets.size(); type++) {
+            auto isOver = [&]() {
+                return used[type].cpuBytes > budgets[type].cpuBytes ||
+                       used[type].gpuBytes > budgets[type].gpuBytes;
+            };
+            if (!isOver()) {
+                continue;
+            }
+            std::sort(candidates[type].begin(), candidates[type].end(),
+                      [](const Candidate &a, const Candidate &b) {
+                          return a.lastUse < b.lastUse;
+                      });
+            for (auto &candidate : candidates[type]) {
+                if (!isOver()) {
+                    break;
+                }
+                used[type].cpuBytes -= candidate.memory.cpuBytes;
+                used[type].gpuBytes -= candidate.memory.gpuBytes;
+                candidate.evict();
+            }
+        }
+    }
+    // endregion
+
+    // region Loading
+    // read* run anywhere (also on the loader threads), they only read files
+    // and decode. upload* create the GL objects, so they run on the GL thread.
+
+    /*
+     * CPU side of a texture, either cooked or decoded from the source
+     */
+    struct TextureSource {
+        std::optional<CookedTexture> cooked;
+        std::optional<DecodedImage> decoded;
+    };
+
+    struct CubemapSource {
+        std::array<std::optional<CookedTexture>, 6> cooked;
+        std::array<std::optional<DecodedImage>, 6> decoded;
+    };
+
+    struct ModelSource {
+        std::optional<CookedMesh> cooked;
+        std::optional<MeshData> mesh;
+    };
+
+    TextureSource readTexture(const std::string &name) const {
+        TextureSource source;
+        // Block compressed textures are skipped when the driver can't read
+        // them, the source is always there as well
+        auto cooked = openCooked<CookedTexture>(AssetType::ASSET_TEXTURE, name);
+        if (cooked.has_value() &&
+            texture_format::isSupported(cooked->getFormat())) {
+            source.cooked.emplace(std::move(cooked.value()));
+            return source;
+        }
+        auto file =
+            mapFile(getAssetPath(AssetType::ASSET_TEXTURE, name.c_str()),
+                    MapHint::POPULATE);
+        source.decoded.emplace(DecodedImage::decode(file.bytes(), true));
+        return source;
+    }
+
+    /*
+     * Region of an atlas page for small RGBA8 textures, empty for the rest
+     */
+    std::optional<std::shared_ptr<Texture>>
+    packIntoAtlas(const TextureSource &source) {
+        const void *pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        std::vector<std::byte> scratch;
+        if (source.cooked.has_value()) {
+            const auto &cooked = source.cooked.value();
+            // Block compressed pages would need the whole page recompressed
+            if (texture_format::isCompressed(cooked.getFormat())) {
+                return {};
+            }
+            width = cooked.getWidth();
+            height = cooked.getHeight();
+            if (TextureAtlas::isEligible(width, height)) {
+                pixels = cooked.levelPixels(0, true, scratch);
+            }
+        } else {
+            const auto &decoded = source.decoded.value();
+            width = decoded.getWidth();
+            height = decoded.getHeight();
+            pixels = decoded.data();
+        }
+        if (!TextureAtlas::isEligible(width, height)) {
             return {};
         }
-        std::string result(
-            reinterpret_cast<const char *>(buffer.value().data()),
-            buffer.value().size());
-        return result;
+        for (auto &atlas : atlases) {
+            if (auto region = atlas.add(pixels, width, height)) {
+                return region;
+            }
+        }
+        std::cout << "Starting texture atlas page " << atlases.size()
+                  << std::endl;
+        auto region = atlases.emplace_back().add(pixels, width, height);
+        DEBUG_ASSERTF(region.has_value(), "Texture doesn't fit empty page");
+        return region;
+    }
+
+    /*
+     * Small clamped textures end up in an atlas page, shaders take the
+     * region from Texture::getUvTransform
+     */
+    std::shared_ptr<Texture> uploadTexture(const TextureSource &source,
+                                           TextureWrap wrap) {
+        if (TextureWrap::CLAMP == wrap) {
+            if (auto region = packIntoAtlas(source)) {
+                return region.value();
+            }
+        }
+        auto texture = source.cooked.has_value()
+                           ? Texture::load(source.cooked.value())
+                           : Texture::load(source.decoded.value());
+        texture->setWrap(wrap);
+        return texture;
+    }
+
+    AssetCache<Texture> &texturesFor(TextureWrap wrap) {
+        return TextureWrap::REPEAT == wrap ? repeatingTextures
+                                           : loadedTextures;
+    }
+
+    /*
+     * Texture files of the faces, +X, -X, +Y, -Y, +Z, -Z, the order
+     * Cubemap::load expects
+     */
+    static std::array<std::string, 6> cubemapFaces(const std::string &name,
+                                                   const std::string &fileExt) {
+        constexpr std::array<const char *, 6> faceNames = {
+            "posx", "negx", "posy", "negy", "posz", "negz"};
+        std::array<std::string, 6> files;
+        for (size_t i = 0; i < faceNames.size(); i++) {
+            files[i] = name + "/" + faceNames[i] + "." + fileExt;
+        }
+        return files;
+    }
+
+    /*
+     * Source faces are decoded in parallel on the loader threads (and the
+     * calling one)
+     */
+    CubemapSource readCubemap(const std::string &name,
+                              const std::string &fileExt) {
+        auto start = std::chrono::steady_clock::now();
+        auto files = cubemapFaces(name, fileExt);
+
+        // Faces are read while the first ones are being processed
+        prefetchCubemap(name, fileExt);
+
+        // Cooked faces are used only when all six of them are there
+        CubemapSource source;
+        bool allCooked = true;
+        for (size_t i = 0; i < files.size() && allCooked; i++) {
+            auto face =
+                openCooked<CookedTexture>(AssetType::ASSET_TEXTURE, files[i]);
+            if (face.has_value() &&
+                texture_format::isSupported(face->getFormat())) {
+                source.cooked[i].emplace(std::move(face.value()));
+            }
+            allCooked = source.cooked[i].has_value();
+        }
+        if (!allCooked) {
+            for (auto &face : source.cooked) {
+                face.reset();
+            }
+            loaders.parallelFor(files.size(), [&](size_t i) {
+                auto file = mapFile(
+                    getAssetPath(AssetType::ASSET_TEXTURE, files[i].c_str()),
+                    MapHint::POPULATE);
+                source.decoded[i].emplace(
+                    DecodedImage::decode(file.bytes(), false));
+            });
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+        std::cout << "Cubemap " << name << " read in " << elapsed.count()
+                  << " ms" << (allCooked ? " (cooked)" : "") << std::endl;
+        return source;
+    }
+
+    /*
+     * Faces are moved out of `source`
+     */
+    static std::shared_ptr<Cubemap> uploadCubemap(CubemapSource source) {
+        auto &c = source.cooked;
+        if (c[0].has_value()) {
+            return Cubemap::load({std::move(c[0].value()),
+                                  std::move(c[1].value()),
+                                  std::move(c[2].value()),
+                                  std::move(c[3].value()),
+                                  std::move(c[4].value()),
+                                  std::move(c[5].value())});
+        }
+        auto &d = source.decoded;
+        return Cubemap::load({std::move(d[0].value()), std::move(d[1].value()),
+                              std::move(d[2].value()), std::move(d[3].value()),
+                              std::move(d[4].value()),
+                              std::move(d[5].value())});
+    }
+
+    /*
+     * Parses a source model. Plain OBJ files go through ObjImporter unless
+     * it's turned off (see setNativeObjParser), Assimp does the rest and
+     * what ObjImporter doesn't understand.
+     */
+    MeshData importModel(const std::string &path,
+                         std::span<const std::byte> bytes) {
+        auto start = std::chrono::steady_clock::now();
+        std::optional<MeshData> mesh;
+        const char *parser = "Assimp";
+        if (nativeObjParser &&
+            std::filesystem::path(path).extension() == ".obj") {
+            mesh = ObjImporter::import(bytes, &loaders);
+            parser = "native OBJ parser";
+        }
+        if (!mesh.has_value()) {
+            mesh = ModelImporter::import(bytes);
+            parser = "Assimp";
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        std::cout << "Imported " << path << " with " << parser << " in "
+                  << elapsed.count() << "us" << std::endl;
+        return std::move(mesh.value());
+    }
+
+    ModelSource readModel(const std::string &path) {
+        ModelSource source;
+        // zpg-cook output first, then what the slow path cooked last time
+        if (auto cooked =
+                openCooked<CookedMesh>(AssetType::ASSET_MODEL, path)) {
+            source.cooked.emplace(std::move(cooked.value()));
+            return source;
+        }
+        auto fullPath = getAssetPath(AssetType::ASSET_MODEL, path.c_str());
+        auto cookedPath =
+            getCookedPath(AssetType::ASSET_MODEL, path.c_str(), ".zmesh");
+        if (isCookedFresh(cookedPath, fullPath)) {
+            if (auto cooked = CookedMesh::open(cookedPath)) {
+                source.cooked.emplace(std::move(cooked.value()));
+                return source;
+            }
+        }
+
+        // Slow path, parse the source and cook it for the next time
+        auto file = mapFile(fullPath, MapHint::POPULATE);
+        source.mesh = importModel(path, file.bytes());
+        if (!CookedMesh::write(cookedPath, source.mesh.value())) {
+            std::cerr << "Failed to write cooked model to " << cookedPath
+                      << std::endl;
+        }
+        return source;
+    }
+
+    static std::shared_ptr<DynamicModel>
+    uploadModel(const ModelSource &source) {
+        if (source.cooked.has_value()) {
+            return DynamicModel::load(source.cooked.value());
+        }
+        return DynamicModel::load(source.mesh.value());
     }
 
-    std::optional<std::vector<uint8_t>>
-    readFileBinary(std::filesystem::path fullPath) const {
-        auto file = std::ifstream(fullPath.string());
+    /*
+     * Runs `read` on a loader thread. It returns the GL part of the load,
+     * which is queued for processUploads().
+     */
+    template <typename Read> void loadAsync(Read read) {
+        pendingLoads++;
+        loaders.submit([this, read = std::move(read)]() {
+            uploads.push(read());
+        });
+    }
+    // endregion
 
-        DEBUG_ASSERTF(file.is_open(), "No asset at '%s'", fullPath.c_str());
-        file.seekg(0, std::ios::end);
-        std::streamsize fileSize = file.tellg();
-        file.seekg(0, std::ios::beg);
-        DEBUG_ASSERTF(fileSize != 0, "Failed to determine file size for %s",
-                      fullPath.c_str());
-        std::vector<uint8_t> buffer(fileSize);
-        if (!file.read(reinterpret_cast<char *>(buffer.data()), fileSize)) {
-            UNREACHABLE("Failed to read file at %s", fullPath.c_str());
+    /*
+     * Maps the whole file, nothing is copied. Source assets are decoded
+     * right after they are opened, so they are usually mapped with
+     * MapHint::POPULATE. A missing asset aborts in every build, nothing
+     * can go on without it.
+     */
+    MappedFile mapFile(const std::filesystem::path &fullPath,
+                       MapHint hint) const {
+        auto file = MappedFile::open(fullPath, hint);
+        if (!file.has_value()) {
+            // Not an assertion, those are compiled out of release builds
+            std::cerr << "No asset at " << fullPath << std::endl;
+            std::abort();
         }
-        file.close();
-        return std::move(buffer);
+        return std::move(file.value());
     }
 
   public:
     AssetManager(const std::string &basePath)
-        : basePath(basePath), maxTextures(gl::getMaxTextureUnits()) {
-        DEBUG_ASSERTF(maxTextures != 0, "Max texture units is 0");
+        : basePath(basePath),
+          manifest(AssetManifest::load(this->basePath / "cooked" /
+                                       "manifest.txt")),
+          packPath(this->basePath / "cooked" / "assets.zpak"),
+          pack(AssetPack::open(packPath)) {
+        budgets[ASSET_TEXTURE] = TEXTURE_CACHE_BUDGET;
+        budgets[ASSET_MODEL] = MODEL_CACHE_BUDGET;
+        std::cout << "Asset manifest has " << manifest.size() << " entries"
+                  << std::endl;
+        if (pack.has_value()) {
+            std::cout << "Asset pack " << packPath << " has " << pack->size()
+                      << " assets" << std::endl;
+        }
     }
 
     AssetManager(const AssetManager &) = delete;
 
     std::optional<FragmentShader> loadFragment(const char *path) {
-        auto fullPath = getAssetPath(AssetType::ASSET_FRAGMENT_SHADER, path);
-        auto content = readFileString(fullPath);
-        if (!content.has_value()) {
-            return {};
-        }
-
-        return FragmentShader::compile(content.value());
+        return compileShader<FragmentShader>(AssetType::ASSET_FRAGMENT_SHADER,
+                                             path);
     }
 
     std::optional<VertexShader> loadVertex(const char *path) const {
-        auto fullPath = getAssetPath(AssetType::ASSET_VERTEX_SHADER, path);
-        auto content = readFileString(fullPath);
-        if (!content.has_value()) {
-            return {};
+        return compileShader<VertexShader>(AssetType::ASSET_VERTEX_SHADER,
+                                           path);
+    }
+
+    /*
+     * Starts reading the asset in the background. Call it ahead of the load,
+     * for example for the assets of the next scene. Assets that aren't in the
+     * pack are read ahead from their cooked file, or the source.
+     */
+    void prefetch(AssetType type, const std::string &fileName) const {
+        if (findPacked(type, fileName).has_value()) {
+            pack->prefetch(getLogicalName(type, fileName));
+            return;
         }
+        auto path = findCooked(type, fileName)
+                        .value_or(getAssetPath(type, fileName.c_str()));
+        // The pages stay in the page cache after the mapping is gone
+        MappedFile::open(path, MapHint::WILLNEED);
+    }
 
-        return VertexShader::compile(content.value());
+    void prefetchCubemap(const std::string &name,
+                         const std::string &fileExt) const {
+        for (const auto &face : cubemapFaces(name, fileExt)) {
+            prefetch(AssetType::ASSET_TEXTURE, face);
+        }
     }
 
-    std::shared_ptr<Texture> loadTexture(const char *name) {
+    /*
+     * Textures of at most TextureAtlas::MAX_REGION_SIZE are returned as a
+     * region of a shared atlas page, so draws using them don't rebind.
+     * Tiled textures have to be loaded with TextureWrap::REPEAT, they get
+     * a texture of their own, a region would repeat its neighbours.
+     */
+    std::shared_ptr<Texture>
+    loadTexture(const char *name, TextureWrap wrap = TextureWrap::CLAMP) {
+        auto &textures = texturesFor(wrap);
         auto fullPath = getAssetPath(AssetType::ASSET_TEXTURE, name);
-        if (loadedTextures.find(fullPath) != loadedTextures.end()) {
+        if (auto cached = findLoaded(textures, fullPath)) {
             std::cout << "Texture at " << fullPath << " is already loaded"
                       << std::endl;
-            return loadedTextures[fullPath];
+            return cached;
         }
         std::cout << "Texture at " << fullPath << " is not loaded, loading"
                   << std::endl;
 
-        auto maybeBuf = readFileBinary(fullPath);
-        DEBUG_ASSERTF(maybeBuf.has_value(), "Failed to read texture %s", name);
+        auto it = uploadTexture(readTexture(name), wrap);
+        textures[fullPath] = {it, frame};
+        return it;
+    }
+
+    /*
+     * Returns a placeholder right away, the texture is read and decoded on
+     * the loader threads and replaces the placeholder in processUploads().
+     * `wrap` as for loadTexture.
+     */
+    std::shared_ptr<Texture>
+    loadTextureAsync(const char *name, TextureWrap wrap = TextureWrap::CLAMP) {
+        auto &textures = texturesFor(wrap);
+        auto fullPath = getAssetPath(AssetType::ASSET_TEXTURE, name);
+        if (auto cached = findLoaded(textures, fullPath)) {
+            return cached;
+        }
+        std::cout << "Texture at " << fullPath << " is not loaded, loading "
+                  << "asynchronously" << std::endl;
+
+        auto it = Texture::placeholder();
+        textures[fullPath] = {it, frame};
+        loadAsync([this, it, wrap, name = std::string(name)]() {
+            auto source = std::make_shared<TextureSource>(readTexture(name));
+            return [this, it, wrap, source]() {
+                auto loaded = uploadTexture(*source, wrap);
+                it->adopt(*loaded);
+            };
+        });
+        return it;
+    }
+
+    /*
+     * Loads only the coarse levels of a cooked texture, the finer ones are
+     * streamed in as the texture gets bigger on the screen and dropped again
+     * when it's over the budget. Draws report its size with
+     * getTextureStreamer().request(). Textures that aren't cooked are loaded
+     * with loadTextureAsync.
+     */
+    std::shared_ptr<Texture> loadTextureStreamed(const char *name) {
+        auto fullPath = getAssetPath(AssetType::ASSET_TEXTURE, name);
+        if (auto cached = findLoaded(loadedTextures, fullPath)) {
+            return cached;
+        }
+        auto cooked = openCooked<CookedTexture>(AssetType::ASSET_TEXTURE, name);
+        if (!cooked.has_value() ||
+            !texture_format::isSupported(cooked->getFormat())) {
+            return loadTextureAsync(name);
+        }
+        auto shared =
+            std::make_shared<const CookedTexture>(std::move(cooked.value()));
+        uint32_t level = TextureStreamer::initialLevel(*shared);
+        std::cout << "Texture at " << fullPath << " is streamed, starting at "
+                  << shared->levelWidth(level) << "x"
+                  << shared->levelHeight(level) << std::endl;
 
-        DEBUG_ASSERTF(currentTexture <= maxTextures,
-                      "Exceeded max textures: %zu", maxTextures);
+        auto it = Texture::load(*shared, level);
+        streamer.add(it, std::move(shared));
+        loadedTextures[fullPath] = {it, frame};
+        return it;
+    }
 
-        auto buf = maybeBuf.value();
-        auto it = Texture::load(buf, currentTexture);
-        currentTexture = currentTexture + 1;
-        loadedTextures[fullPath] = it;
+    /*
+     * Loads the texture into a layer of a pooled GL_TEXTURE_2D_ARRAY.
+     * Textures of the same size and format share an array, so a batch using
+     * them binds one texture and selects its layer by index. A new array of
+     * TEXTURE_ARRAY_CAPACITY layers is made when the others are full.
+     */
+    TextureLayer loadTextureLayer(const char *name) {
+        auto fullPath = getAssetPath(AssetType::ASSET_TEXTURE, name);
+        if (auto it = loadedLayers.find(fullPath); it != loadedLayers.end()) {
+            return it->second;
+        }
+        auto source = readTexture(name);
+        int width = 0;
+        int height = 0;
+        GLenum internalFormat = GL_RGBA8;
+        if (source.cooked.has_value()) {
+            width = source.cooked->getWidth();
+            height = source.cooked->getHeight();
+            internalFormat =
+                texture_format::internalFormat(source.cooked->getFormat());
+        } else {
+            width = source.decoded->getWidth();
+            height = source.decoded->getHeight();
+        }
+
+        std::shared_ptr<TextureArray> array;
+        for (const auto &candidate : textureArrays) {
+            if (!candidate->isFull() &&
+                candidate->fits(width, height, internalFormat)) {
+                array = candidate;
+                break;
+            }
+        }
+        if (nullptr == array) {
+            array = TextureArray::create(width, height, internalFormat,
+                                         TEXTURE_ARRAY_CAPACITY);
+            textureArrays.push_back(array);
+        }
+        GLint layer = source.cooked.has_value()
+                          ? array->add(source.cooked.value())
+                          : array->add(source.decoded.value());
+        std::cout << "Texture " << name << " pooled into layer " << layer
+                  << " of a " << width << "x" << height << " array"
+                  << std::endl;
+        auto it = TextureLayer{array, layer};
+        loadedLayers[fullPath] = it;
         return it;
     }
 
     std::shared_ptr<Cubemap> loadCubemap(const std::string &name,
                                          const std::string &fileExt) {
         auto cubemapBase = getAssetPath(AssetType::ASSET_TEXTURE, name.c_str());
-        if (loadedCubemaps.find(cubemapBase) != loadedCubemaps.end()) {
+        if (auto cached = findLoaded(loadedCubemaps, cubemapBase)) {
             std::cout << "Cubemap/skybox at " << name << " is already loaded"
                       << std::endl;
-            return loadedCubemaps[cubemapBase];
+            return cached;
         }
         std::cout << "Loading cubemap at " << name << std::endl;
 
-        auto ss = std::basic_stringstream<char>();
-        ss << "posx." << fileExt;
-        auto xpos = readFileBinary(cubemapBase / ss.str()).value();
-        ss.str("");
-        ss << "negx." << fileExt;
-        auto xneg = readFileBinary(cubemapBase / ss.str()).value();
-        ss.str("");
-        ss << "posy." << fileExt;
-        auto ypos = readFileBinary(cubemapBase / ss.str()).value();
-        ss.str("");
-        ss << "negy." << fileExt;
-        auto yneg = readFileBinary(cubemapBase / ss.str()).value();
-        ss.str("");
-        ss << "posz." << fileExt;
-        auto zpos = readFileBinary(cubemapBase / ss.str()).value();
-        ss.str("");
-        ss << "negz." << fileExt;
-        auto zneg = readFileBinary(cubemapBase / ss.str()).value();
-
-        DEBUG_ASSERTF(currentTexture <= maxTextures,
-                      "Exceeded max textures: %zu", maxTextures);
-
-        auto it =
-            Cubemap::load(xpos, xneg, ypos, yneg, zpos, zneg, currentTexture);
-
-        loadedCubemaps[cubemapBase] = it;
+        auto it = uploadCubemap(readCubemap(name, fileExt));
+        loadedCubemaps[cubemapBase] = {it, frame};
+        return it;
+    }
+
+    /*
+     * Asynchronous version of loadCubemap, see loadTextureAsync
+     */
+    std::shared_ptr<Cubemap> loadCubemapAsync(const std::string &name,
+                                              const std::string &fileExt) {
+        auto cubemapBase = getAssetPath(AssetType::ASSET_TEXTURE, name.c_str());
+        if (auto cached = findLoaded(loadedCubemaps, cubemapBase)) {
+            return cached;
+        }
+        std::cout << "Loading cubemap at " << name << " asynchronously"
+                  << std::endl;
+
+        auto it = Cubemap::placeholder();
+        loadedCubemaps[cubemapBase] = {it, frame};
+        loadAsync([this, it, name, fileExt]() {
+            auto source =
+                std::make_shared<CubemapSource>(readCubemap(name, fileExt));
+            return [it, source]() {
+                auto loaded = uploadCubemap(std::move(*source));
+                it->adopt(*loaded);
+            };
+        });
         return it;
     }
 
     std::shared_ptr<DynamicModel> loadModel(const std::string &path) {
         auto fullPath = getAssetPath(AssetType::ASSET_MODEL, path.c_str());
-        if (loadedModels.find(fullPath) != loadedModels.end()) {
+        if (auto cached = findLoaded(loadedModels, fullPath)) {
             std::cout << "Model at " << fullPath << " is already loaded"
                       << std::endl;
-            return loadedModels[fullPath];
+            return cached;
         }
         std::cout << "Model at " << fullPath << " is not loaded, loading"
                   << std::endl;
 
-        auto maybeBuf = readFileBinary(fullPath);
-        DEBUG_ASSERTF(maybeBuf.has_value(), "Failed to read model %s",
-                      path.c_str());
+        auto it = uploadModel(readModel(path));
+        loadedModels[fullPath] = {it, frame};
+        return it;
+    }
+
+    /*
+     * Asynchronous version of loadModel, the placeholder draws nothing until
+     * the model is uploaded. Parsing and cooking run on the loader threads.
+     */
+    std::shared_ptr<DynamicModel> loadModelAsync(const std::string &path) {
+        auto fullPath = getAssetPath(AssetType::ASSET_MODEL, path.c_str());
+        if (auto cached = findLoaded(loadedModels, fullPath)) {
+            return cached;
+        }
+        std::cout << "Model at " << fullPath << " is not loaded, loading "
+                  << "asynchronously" << std::endl;
 
-        auto buf = maybeBuf.value();
-        auto it = DynamicModel::load(buf);
-        loadedModels[fullPath] = it;
+        auto it = DynamicModel::placeholder();
+        loadedModels[fullPath] = {it, frame};
+        loadAsync([this, it, path]() {
+            auto source = std::make_shared<ModelSource>(readModel(path));
+            return [it, source]() {
+                auto loaded = uploadModel(*source);
+                it->adopt(*loaded);
+            };
+        });
         return it;
     }
+
+    /*
+     * Finishes asynchronous loads whose data is ready. Has to be called on
+     * the GL thread, once per frame. Stops after `budget`, the rest is left
+     * for the next frames. Returns the number of finished loads.
+     */
+    size_t processUploads(std::chrono::microseconds budget) {
+        frame++;
+        evictOverBudget();
+        for (auto &streamIn : streamer.update()) {
+            loadAsync([this, streamIn]() {
+                // Page the new levels in here, not on the GL thread
+                for (uint32_t level = streamIn.level;
+                     level < streamIn.cooked->getLevels(); level++) {
+                    MappedFile::touch(streamIn.cooked->level(level));
+                }
+                return [this, streamIn]() {
+                    streamer.finish(*streamIn.texture, streamIn.level);
+                };
+            });
+        }
+        size_t done = uploads.drain(budget);
+        pendingLoads -= done;
+        return done;
+    }
+
+    TextureStreamer &getTextureStreamer() { return streamer; }
+
+    /*
+     * Limits the memory of cached assets of `type` (ASSET_TEXTURE or
+     * ASSET_MODEL). Loaded assets nobody else holds are evicted when it's
+     * exceeded, the next load of them reads them again.
+     */
+    void setBudget(AssetType type, AssetBudget budget) {
+        DEBUG_ASSERT(ASSET_TEXTURE == type || ASSET_MODEL == type);
+        budgets[type] = budget;
+    }
+
+    /*
+     * Every cached asset with its memory, for debugging memory use. Atlas
+     * regions are listed without memory, their pages once each.
+     */
+    std::vector<AssetResidency> getResidency() {
+        std::vector<AssetResidency> residency;
+        forEachCache([&](AssetType type, auto &cache) {
+            for (const auto &[path, cached] : cache) {
+                residency.push_back({path, type, memoryOf(*cached.asset),
+                                     cached.asset.use_count() - 1,
+                                     frame - cached.lastUse});
+            }
+        });
+        for (size_t i = 0; i < atlases.size(); i++) {
+            residency.push_back({"atlas page " + std::to_string(i),
+                                 ASSET_TEXTURE,
+                                 {0, atlases[i].getGpuBytes()},
+                                 atlases[i].getRegionCount(), 0});
+        }
+        return residency;
+    }
+
+    /*
+     * Sum of getResidency() for one type
+     */
+    AssetMemory getResidentMemory(AssetType type) {
+        AssetMemory memory;
+        for (const auto &asset : getResidency()) {
+            if (asset.type == type) {
+                memory.cpuBytes += asset.memory.cpuBytes;
+                memory.gpuBytes += asset.memory.gpuBytes;
+            }
+        }
+        return memory;
+    }
+
+    void setTextureBudget(size_t bytes) { streamer.setBudget(bytes); }
+
+    /*
+     * Turns ObjImporter off, for comparing it with Assimp. Only models that
+     * aren't cooked yet are parsed at all.
+     */
+    void setNativeObjParser(bool enabled) { nativeObjParser = enabled; }
+
+    /*
+     * Asynchronous loads that didn't finish yet
+     */
+    [[nodiscard]] size_t getPendingLoads() const { return pendingLoads; }
+
+    ~AssetManager() {
+        // Loader threads might wait for space in the queue, nobody is going
+        // to drain it anymore
+        uploads.close();
+    }
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+
+/*
+ * Maps logical asset names (path relative to the asset directory, for
+ * example "models/house.obj") to their cooked files. Written by zpg-cook to
+ * assets/cooked/manifest.txt, read by AssetManager.
+ *
+ * One line per asset: <name> <cooked path> <source hash> <cooker version>
+ * Cooked path is relative to the asset directory, hash is hash::fnv1a of the
+ * source file in hex. Names must not contain whitespace.
+ */
+class AssetManifest {
+  public:
+    struct Entry {
+        std::string cooked;
+        uint64_t sourceHash = 0;
+        uint32_t cookerVersion = 0;
+    };
+
+  private:
+    // std::map, so the written file is sorted and diffs nicely
+    std::map<std::string, Entry> entries;
+
+  public:
+    static AssetManifest load(const std::filesystem::path &path) {
+        AssetManifest manifest;
+        auto in = std::ifstream(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            auto ss = std::istringstream(line);
+            std::string name;
+            Entry entry;
+            std::string hash;
+            if (ss >> name >> entry.cooked >> hash >> entry.cookerVersion) {
+                entry.sourceHash = std::stoull(hash, nullptr, 16);
+                manifest.entries[name] = std::move(entry);
+            }
+        }
+        return manifest;
+    }
+
+    bool save(const std::filesystem::path &path) const {
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            auto out = std::ofstream(tmpPath);
+            if (!out.is_open()) {
+                return false;
+            }
+            for (const auto &[name, entry] : entries) {
+                out << name << ' ' << entry.cooked << ' ' << std::hex
+                    << entry.sourceHash << std::dec << ' '
+                    << entry.cookerVersion << '\n';
+            }
+            if (!out.good()) {
+                return false;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, path, ec);
+        return !ec;
+    }
+
+    [[nodiscard]] std::optional<Entry> find(const std::string &name) const {
+        auto it = entries.find(name);
+        if (it == entries.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    void set(const std::string &name, Entry entry) {
+        entries[name] = std::move(entry);
+    }
+
+    [[nodiscard]] const std::map<std::string, Entry> &getEntries() const {
+        return entries;
+    }
+
+    [[nodiscard]] size_t size() const { return entries.size(); }
+};
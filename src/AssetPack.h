@@ -0,0 +1,254 @@
+#pragma once
+
+#include "Hash.h"
+#include "MappedFile.h"
+#include "assertions.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Header of an asset pack (.zpak), many cooked assets in one file.
+ *
+ * File layout:
+ * [header][entries][names][padding][blob][padding][blob]...
+ * Entries are sorted by (nameHash, name), so lookup is a binary search. Names
+ * are stored without terminating zeros, entry points to its name by offset
+ * from the start of the file. Every blob starts on a 4 KB boundary, so blobs
+ * never share a page and madvise() on one asset doesn't touch its neighbours.
+ *
+ * Bump VERSION whenever anything in the layout changes.
+ */
+struct AssetPackHeader {
+    static constexpr std::array<char, 4> MAGIC = {'Z', 'P', 'G', 'P'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint64_t BLOB_ALIGNMENT = 4096;
+
+    std::array<char, 4> magic = MAGIC;
+    uint32_t version = VERSION;
+    uint64_t entryCount = 0;
+};
+static_assert(std::is_trivially_copyable_v<AssetPackHeader>);
+
+struct AssetPackEntry {
+    uint64_t nameHash = 0; // hash::fnv1a of the name
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    uint32_t nameOffset = 0;
+    uint32_t nameLength = 0;
+};
+static_assert(sizeof(AssetPackEntry) == 32);
+
+/*
+ * Asset pack mapped into memory. Assets are looked up by their logical name
+ * ("models/house.obj") and served as views into the mapping, so loading an
+ * asset is a binary search and the kernel pages the data in on first access.
+ */
+class AssetPack {
+  private:
+    MappedFile file;
+    std::span<const AssetPackEntry> entries;
+
+    AssetPack(MappedFile file, std::span<const AssetPackEntry> entries)
+        : file(std::move(file)), entries(entries) {}
+
+    static constexpr uint64_t align(uint64_t val) {
+        auto a = AssetPackHeader::BLOB_ALIGNMENT;
+        return (val + a - 1) / a * a;
+    }
+
+    [[nodiscard]] std::string_view nameOf(const AssetPackEntry &entry) const {
+        return {reinterpret_cast<const char *>(file.data()) + entry.nameOffset,
+                entry.nameLength};
+    }
+
+    [[nodiscard]] const AssetPackEntry *findEntry(std::string_view name) const {
+        uint64_t nameHash = hash::fnv1a(name);
+        auto it = std::lower_bound(
+            entries.begin(), entries.end(), nameHash,
+            [](const AssetPackEntry &entry, uint64_t value) {
+                return entry.nameHash < value;
+            });
+        // Colliding hashes are next to each other
+        for (; it != entries.end() && it->nameHash == nameHash; ++it) {
+            if (nameOf(*it) == name) {
+                return &*it;
+            }
+        }
+        return nullptr;
+    }
+
+  public:
+    AssetPack(const AssetPack &) = delete;
+    AssetPack(AssetPack &&other) noexcept = default;
+
+    /*
+     * Maps the pack and checks the table of contents. Returns empty optional
+     * if the file doesn't exist, is from another version or is damaged.
+     */
+    static std::optional<AssetPack> open(const std::filesystem::path &path) {
+        auto maybeFile = MappedFile::open(path);
+        if (!maybeFile.has_value()) {
+            return {};
+        }
+        auto &mapped = maybeFile.value();
+        if (mapped.size() < sizeof(AssetPackHeader)) {
+            return {};
+        }
+        const auto *header =
+            reinterpret_cast<const AssetPackHeader *>(mapped.data());
+        if (header->magic != AssetPackHeader::MAGIC ||
+            header->version != AssetPackHeader::VERSION ||
+            header->entryCount > (mapped.size() - sizeof(AssetPackHeader)) /
+                                     sizeof(AssetPackEntry)) {
+            return {};
+        }
+        std::span<const AssetPackEntry> entries = {
+            reinterpret_cast<const AssetPackEntry *>(mapped.data() +
+                                                     sizeof(AssetPackHeader)),
+            header->entryCount};
+        for (const auto &entry : entries) {
+            if (entry.offset > mapped.size() ||
+                entry.size > mapped.size() - entry.offset ||
+                uint64_t(entry.nameOffset) + entry.nameLength >
+                    mapped.size() ||
+                0 != entry.offset % AssetPackHeader::BLOB_ALIGNMENT) {
+                return {};
+            }
+        }
+        // The table is read right away, blobs only when they are needed
+        mapped.advise(std::as_bytes(entries), MADV_WILLNEED);
+        return AssetPack(std::move(mapped), entries);
+    }
+
+    /*
+     * Packs `files` (logical name, file on disk) into `path`, through a temp
+     * file like the other cooked formats. Empty files become empty entries
+     * (MappedFile can't map them), files that can't be read are left out
+     * with a warning and load from disk as if they weren't cooked.
+     */
+    static bool
+    write(const std::filesystem::path &path,
+          const std::vector<std::pair<std::string, std::filesystem::path>>
+              &files) {
+        std::vector<std::string_view> names;
+        // Empty optional for empty files
+        std::vector<std::optional<MappedFile>> blobs;
+        for (const auto &[name, file] : files) {
+            auto blob = MappedFile::open(file);
+            std::error_code ec;
+            if (!blob.has_value() &&
+                0 != std::filesystem::file_size(file, ec)) {
+                std::cout << "Not packing " << file << ", it can't be read"
+                          << std::endl;
+                continue;
+            }
+            names.emplace_back(name);
+            blobs.emplace_back(std::move(blob));
+        }
+
+        std::vector<AssetPackEntry> toc(names.size());
+        uint64_t namesOffset =
+            sizeof(AssetPackHeader) + names.size() * sizeof(AssetPackEntry);
+        uint64_t namesSize = 0;
+        for (size_t i = 0; i < names.size(); i++) {
+            toc[i].nameHash = hash::fnv1a(names[i]);
+            toc[i].size = blobs[i].has_value() ? blobs[i]->size() : 0;
+            toc[i].nameOffset = namesOffset + namesSize;
+            toc[i].nameLength = names[i].size();
+            namesSize += names[i].size();
+        }
+        uint64_t offset = align(namesOffset + namesSize);
+        for (auto &entry : toc) {
+            entry.offset = offset;
+            offset = align(offset + entry.size);
+        }
+
+        // Sort only now, so that blobs stay in the order they were given
+        std::vector<size_t> order(names.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (toc[a].nameHash != toc[b].nameHash) {
+                return toc[a].nameHash < toc[b].nameHash;
+            }
+            return names[a] < names[b];
+        });
+
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            auto out = std::ofstream(tmpPath, std::ios::binary);
+            if (!out.is_open()) {
+                return false;
+            }
+            const std::array<char, AssetPackHeader::BLOB_ALIGNMENT> zeros{};
+            auto pad = [&](uint64_t to) {
+                auto at = static_cast<uint64_t>(out.tellp());
+                DEBUG_ASSERT(at <= to);
+                out.write(zeros.data(), static_cast<std::streamsize>(to - at));
+            };
+            AssetPackHeader header;
+            header.entryCount = names.size();
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            for (size_t i : order) {
+                out.write(reinterpret_cast<const char *>(&toc[i]),
+                          sizeof(AssetPackEntry));
+            }
+            for (auto name : names) {
+                out.write(name.data(),
+                          static_cast<std::streamsize>(name.size()));
+            }
+            for (size_t i = 0; i < names.size(); i++) {
+                pad(toc[i].offset);
+                if (blobs[i].has_value()) {
+                    out.write(
+                        reinterpret_cast<const char *>(blobs[i]->data()),
+                        static_cast<std::streamsize>(blobs[i]->size()));
+                }
+            }
+            if (!out.good()) {
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        return !ec;
+    }
+
+    /*
+     * Content of the asset, valid as long as the pack lives. Empty optional
+     * when the pack doesn't contain it.
+     */
+    [[nodiscard]] std::optional<std::span<const std::byte>>
+    find(std::string_view name) const {
+        const auto *entry = findEntry(name);
+        if (nullptr == entry) {
+            return {};
+        }
+        return file.bytes().subspan(entry->offset, entry->size);
+    }
+
+    /*
+     * Asks the kernel to start reading the asset in the background, so the
+     * load that follows doesn't wait for the disk page by page
+     */
+    void prefetch(std::string_view name) const {
+        if (auto bytes = find(name)) {
+            file.advise(bytes.value(), MADV_WILLNEED);
+        }
+    }
+
+    [[nodiscard]] size_t size() const { return entries.size(); }
+};
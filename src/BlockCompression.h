@@ -0,0 +1,198 @@
+#pragma once
+
+#include "MipChain.h"
+#include "TextureFormat.h"
+#include "assertions.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+/*
+ * BC1 and BC3 (DXT1, DXT5) encoder used by zpg-cook.
+ *
+ * Every 4x4 block gets the corners of its RGB bounding box as endpoints and
+ * each pixel the nearest of the four palette colours. That is far from the
+ * quality of a real encoder (no PCA, no refinement), but it's fast, needs no
+ * dependency and is good enough for diffuse textures. BC3 alpha uses the min
+ * and max alpha of the block and the 8 value palette.
+ *
+ * Blocks are written row by row, like pixels. Levels smaller than a block
+ * repeat their last row/column.
+ */
+namespace bc {
+
+// region Internals
+
+using Block = std::array<std::array<uint8_t, 4>, 16>;
+
+static inline Block readBlock(const ImageLevel &level, int bx, int by) {
+    Block block;
+    for (int y = 0; y < 4; y++) {
+        int sy = std::min(by * 4 + y, level.height - 1);
+        for (int x = 0; x < 4; x++) {
+            int sx = std::min(bx * 4 + x, level.width - 1);
+            std::memcpy(block[y * 4 + x].data(),
+                        &level.pixels[(static_cast<size_t>(sy) * level.width +
+                                       sx) *
+                                      4],
+                        4);
+        }
+    }
+    return block;
+}
+
+static inline uint16_t toRGB565(const std::array<int, 3> &c) {
+    return static_cast<uint16_t>(((c[0] * 31 + 127) / 255) << 11 |
+                                 ((c[1] * 63 + 127) / 255) << 5 |
+                                 ((c[2] * 31 + 127) / 255));
+}
+
+static inline std::array<int, 3> fromRGB565(uint16_t c) {
+    int r = (c >> 11) & 31;
+    int g = (c >> 5) & 63;
+    int b = c & 31;
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+/*
+ * 8 bytes: two RGB565 endpoints and 2 bit indices. color0 > color1 selects
+ * the four colour mode (no transparency), which is also what BC3 uses.
+ */
+static inline void encodeColor(const Block &block, uint8_t *out) {
+    std::array<int, 3> min = {255, 255, 255};
+    std::array<int, 3> max = {0, 0, 0};
+    for (const auto &pixel : block) {
+        for (int c = 0; c < 3; c++) {
+            min[c] = std::min<int>(min[c], pixel[c]);
+            max[c] = std::max<int>(max[c], pixel[c]);
+        }
+    }
+    // Pull the endpoints in a bit, the extremes are rarely worth a palette
+    // entry of their own
+    for (int c = 0; c < 3; c++) {
+        int inset = (max[c] - min[c]) / 16;
+        min[c] += inset;
+        max[c] -= inset;
+    }
+    // Every channel of max is >= the one of min, so the packed values are
+    // ordered too
+    uint16_t color0 = toRGB565(max);
+    uint16_t color1 = toRGB565(min);
+    uint32_t indices = 0;
+    if (color0 != color1) {
+        auto c0 = fromRGB565(color0);
+        auto c1 = fromRGB565(color1);
+        std::array<std::array<int, 3>, 4> palette;
+        for (int c = 0; c < 3; c++) {
+            palette[0][c] = c0[c];
+            palette[1][c] = c1[c];
+            palette[2][c] = (2 * c0[c] + c1[c]) / 3;
+            palette[3][c] = (c0[c] + 2 * c1[c]) / 3;
+        }
+        for (int i = 0; i < 16; i++) {
+            uint32_t best = 0;
+            int bestDistance = INT32_MAX;
+            for (uint32_t p = 0; p < 4; p++) {
+                int distance = 0;
+                for (int c = 0; c < 3; c++) {
+                    int d = block[i][c] - palette[p][c];
+                    distance += d * d;
+                }
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= best << (i * 2);
+        }
+    }
+    // Block compressed data is little endian, like the machines we run on
+    std::memcpy(out, &color0, 2);
+    std::memcpy(out + 2, &color1, 2);
+    std::memcpy(out + 4, &indices, 4);
+}
+
+/*
+ * 8 bytes: two alpha endpoints and 3 bit indices. alpha0 > alpha1 selects
+ * the 8 value palette.
+ */
+static inline void encodeAlpha(const Block &block, uint8_t *out) {
+    int alpha0 = 0;
+    int alpha1 = 255;
+    for (const auto &pixel : block) {
+        alpha0 = std::max<int>(alpha0, pixel[3]);
+        alpha1 = std::min<int>(alpha1, pixel[3]);
+    }
+    uint64_t indices = 0;
+    if (alpha0 != alpha1) {
+        std::array<int, 8> palette = {alpha0, alpha1};
+        for (int i = 1; i < 7; i++) {
+            palette[i + 1] = ((7 - i) * alpha0 + i * alpha1) / 7;
+        }
+        for (int i = 0; i < 16; i++) {
+            uint64_t best = 0;
+            int bestDistance = INT32_MAX;
+            for (uint64_t p = 0; p < 8; p++) {
+                int distance = std::abs(block[i][3] - palette[p]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= best << (i * 3);
+        }
+    }
+    out[0] = static_cast<uint8_t>(alpha0);
+    out[1] = static_cast<uint8_t>(alpha1);
+    // 48 bits of indices
+    std::memcpy(out + 2, &indices, 6);
+}
+// endregion
+
+/*
+ * True if any pixel of the RGBA8 level is not fully opaque
+ */
+static inline bool hasAlpha(const ImageLevel &level) {
+    for (size_t i = 3; i < level.pixels.size(); i += 4) {
+        if (255 != level.pixels[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Compresses an RGBA8 level into `format`, the result has the same size and
+ * its pixels are the blocks
+ */
+static inline ImageLevel compress(const ImageLevel &level,
+                                  TextureFormat format) {
+    DEBUG_ASSERT(TextureFormat::BC1 == format ||
+                 TextureFormat::BC3 == format);
+    DEBUG_ASSERT(level.pixels.size() ==
+                 static_cast<size_t>(level.width) * level.height * 4);
+    size_t blockSize = TextureFormat::BC1 == format ? 8 : 16;
+    int blocksX = (level.width + 3) / 4;
+    int blocksY = (level.height + 3) / 4;
+    ImageLevel result;
+    result.width = level.width;
+    result.height = level.height;
+    result.pixels.resize(static_cast<size_t>(blocksX) * blocksY * blockSize);
+    uint8_t *out = result.pixels.data();
+    for (int by = 0; by < blocksY; by++) {
+        for (int bx = 0; bx < blocksX; bx++) {
+            auto block = readBlock(level, bx, by);
+            if (TextureFormat::BC3 == format) {
+                encodeAlpha(block, out);
+                out += 8;
+            }
+            encodeColor(block, out);
+            out += 8;
+        }
+    }
+    return result;
+}
+
+} // namespace bc
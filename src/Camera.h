@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "MeshData.h"
 #include "Observer.h"
 #include "Projection.h"
 #include "glm/ext/matrix_transform.hpp"
@@ -115,6 +116,23 @@ class Camera : public Observable<CameraProperties> {
 
     glm::vec3 getPosition() { return m_eye; }
 
+    /*
+     * Approximate height in pixels of `sphere` on the screen. Used to pick
+     * how detailed the things drawn inside it need to be.
+     */
+    [[nodiscard]] float projectedSize(const BoundingSphere &sphere) {
+        auto projection = perspectiveProjection->getProjectionMatrix();
+        float distance = glm::length(sphere.center - m_eye);
+        float screenHeight =
+            static_cast<float>(perspectiveProjection->getScreenHeight());
+        // Inside the sphere it can cover the whole screen
+        if (distance <= sphere.radius) {
+            return screenHeight;
+        }
+        // projection[1][1] is 1 / tan(fov / 2)
+        return sphere.radius * projection[1][1] * screenHeight / distance;
+    }
+
     void setYaw(float val) {
         yaw = val;
         handleChange();
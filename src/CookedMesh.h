@@ -0,0 +1,337 @@
+#pragma once
+
+#include "Material.h"
+#include "MappedFile.h"
+#include "MeshData.h"
+#include "assertions.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Header of a cooked mesh file (.zmesh).
+ *
+ * File layout, all offsets are from the start of the file:
+ * [header][padding][vertices at vertexOffset][padding][indices at indexOffset]
+ * [padding][submeshes at submeshOffset][padding][materials at materialOffset]
+ * Blocks are aligned to 16 bytes and stored in the native (little endian)
+ * byte order, so they can be used directly from a memory mapping.
+ *
+ * Bump VERSION whenever anything in the layout changes, old files are then
+ * ignored. Bump COOKER_VERSION of tools/cook with it, so they are cooked
+ * again.
+ */
+struct CookedMeshHeader {
+    static constexpr std::array<char, 4> MAGIC = {'Z', 'P', 'G', 'M'};
+    static constexpr uint32_t VERSION = 4;
+    static constexpr uint64_t BLOCK_ALIGNMENT = 16;
+
+    std::array<char, 4> magic = MAGIC;
+    uint32_t version = VERSION;
+    VertexFormat format;
+    uint64_t vertexCount = 0;
+    uint64_t indexCount = 0;
+    // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    uint32_t indexType = GL_UNSIGNED_INT;
+    uint32_t _padding_0 = 0;
+    uint64_t vertexOffset = 0;
+    uint64_t indexOffset = 0;
+    uint64_t submeshCount = 0;
+    uint64_t submeshOffset = 0;
+    uint64_t materialCount = 0;
+    uint64_t materialOffset = 0;
+    float boundsMin[3] = {};
+    float boundsMax[3] = {};
+};
+static_assert(std::is_trivially_copyable_v<CookedMeshHeader>);
+static_assert(std::is_trivially_copyable_v<SubMesh>);
+
+/*
+ * Material as it's stored in the file
+ */
+struct CookedMaterial {
+    float ambient[4] = {};
+    float diffuse[4] = {};
+    float specular[4] = {};
+    float shininess = 0;
+    uint32_t _padding_0 = 0;
+    uint32_t _padding_1 = 0;
+    uint32_t _padding_2 = 0;
+
+    CookedMaterial() = default;
+
+    explicit CookedMaterial(const Material &material)
+        : shininess(material.getShininess()) {
+        std::memcpy(ambient, &material.getAmbient(), sizeof(float) * 4);
+        std::memcpy(diffuse, &material.getDiffuse(), sizeof(float) * 4);
+        std::memcpy(specular, &material.getSpecular(), sizeof(float) * 4);
+    }
+
+    [[nodiscard]] Material toMaterial() const {
+        auto vec4 = [](const float *val) {
+            return glm::vec4(val[0], val[1], val[2], val[3]);
+        };
+        return {vec4(ambient), vec4(diffuse), vec4(specular), shininess};
+    }
+};
+static_assert(sizeof(CookedMaterial) == 64);
+
+/*
+ * Cooked mesh mapped into memory. Vertices and indices point into the
+ * mapping, so they are valid as long as this object lives.
+ */
+class CookedMesh {
+  private:
+    // Empty for views into memory owned by someone else (AssetPack)
+    std::optional<MappedFile> file;
+    std::span<const std::byte> bytes;
+    const CookedMeshHeader *header;
+
+    CookedMesh(std::span<const std::byte> bytes, const CookedMeshHeader *header)
+        : bytes(bytes), header(header) {}
+
+    static constexpr uint64_t align(uint64_t val) {
+        auto a = CookedMeshHeader::BLOCK_ALIGNMENT;
+        return (val + a - 1) / a * a;
+    }
+
+    static bool fits(uint64_t offset, uint64_t size, uint64_t fileSize) {
+        return offset <= fileSize && size <= fileSize - offset &&
+               0 == offset % CookedMeshHeader::BLOCK_ALIGNMENT;
+    }
+
+    /*
+     * Largest of `count` indices from `first`, 0 when there are none
+     */
+    [[nodiscard]] uint32_t maxIndex(uint64_t first, uint64_t count) const {
+        const std::byte *data = bytes.data() + header->indexOffset;
+        uint32_t max = 0;
+        if (GL_UNSIGNED_SHORT == header->indexType) {
+            const auto *indices = reinterpret_cast<const uint16_t *>(data);
+            for (uint64_t i = first; i < first + count; i++) {
+                max = std::max<uint32_t>(max, indices[i]);
+            }
+        } else {
+            const auto *indices = reinterpret_cast<const uint32_t *>(data);
+            for (uint64_t i = first; i < first + count; i++) {
+                max = std::max(max, indices[i]);
+            }
+        }
+        return max;
+    }
+
+  public:
+    CookedMesh(const CookedMesh &) = delete;
+    CookedMesh(CookedMesh &&other) noexcept = default;
+
+    /*
+     * Maps the file and checks the header. Returns empty optional if the file
+     * doesn't exist, is from another version or is damaged.
+     */
+    static std::optional<CookedMesh> open(const std::filesystem::path &path) {
+        // Everything is uploaded right away
+        auto maybeFile = MappedFile::open(path, MapHint::WILLNEED);
+        if (!maybeFile.has_value()) {
+            return {};
+        }
+        auto self = view(maybeFile->bytes());
+        if (self.has_value()) {
+            self->file.emplace(std::move(maybeFile.value()));
+        }
+        return self;
+    }
+
+    /*
+     * Same as open() for data that is already in memory. Nothing is copied,
+     * `mapped` has to outlive the returned object.
+     */
+    static std::optional<CookedMesh> view(std::span<const std::byte> mapped) {
+        if (0 != reinterpret_cast<uintptr_t>(mapped.data()) %
+                     CookedMeshHeader::BLOCK_ALIGNMENT) {
+            return {};
+        }
+        if (mapped.size() < sizeof(CookedMeshHeader)) {
+            return {};
+        }
+        const auto *header =
+            reinterpret_cast<const CookedMeshHeader *>(mapped.data());
+        if (header->magic != CookedMeshHeader::MAGIC ||
+            header->version != CookedMeshHeader::VERSION) {
+            return {};
+        }
+        const auto &format = header->format;
+        if (GL_UNSIGNED_SHORT != header->indexType &&
+            GL_UNSIGNED_INT != header->indexType) {
+            return {};
+        }
+        if (0 == format.stride ||
+            format.attributeCount > VertexFormat::MAX_ATTRIBUTES) {
+            return {};
+        }
+        // GL would read past the vertex, or past the buffer for the last one
+        for (const auto &attrib : format.used()) {
+            uint32_t size = attrib.size();
+            if (0 == size || attrib.offset > format.stride ||
+                size > format.stride - attrib.offset) {
+                return {};
+            }
+        }
+        // Overflow of these multiplications would need a file of exabytes
+        if (!fits(header->vertexOffset, header->vertexCount * format.stride,
+                  mapped.size()) ||
+            !fits(header->indexOffset,
+                  header->indexCount * IndexData::sizeOf(header->indexType),
+                  mapped.size()) ||
+            !fits(header->submeshOffset, header->submeshCount * sizeof(SubMesh),
+                  mapped.size()) ||
+            !fits(header->materialOffset,
+                  header->materialCount * sizeof(CookedMaterial),
+                  mapped.size())) {
+            return {};
+        }
+        auto self = CookedMesh(mapped, header);
+        // Every index has to point at a vertex, GL and the MeshPool shaders
+        // would fetch past the buffer. One pass over the indices, far less
+        // than uploading them.
+        auto isInBounds = [&](uint64_t baseVertex, uint64_t first,
+                              uint64_t count) {
+            return 0 == count ||
+                   (baseVertex < header->vertexCount &&
+                    self.maxIndex(first, count) <
+                        header->vertexCount - baseVertex);
+        };
+        for (const auto &submesh : self.submeshes()) {
+            if (submesh.firstIndex > header->indexCount ||
+                submesh.indexCount > header->indexCount - submesh.firstIndex ||
+                submesh.material >= header->materialCount ||
+                !isInBounds(submesh.baseVertex, submesh.firstIndex,
+                            submesh.indexCount)) {
+                return {};
+            }
+        }
+        // Without submeshes all indices are drawn from vertex 0
+        if (0 == header->submeshCount &&
+            !isInBounds(0, 0, header->indexCount)) {
+            return {};
+        }
+        return self;
+    }
+
+    /*
+     * Writes `mesh` to `path`. File is written next to the target and renamed
+     * over it, so a reader never sees a half written file.
+     */
+    static bool write(const std::filesystem::path &path, const MeshData &mesh) {
+        CookedMeshHeader header;
+        header.format = mesh.format;
+        auto indices = IndexData::pack(mesh.indices);
+        header.vertexCount = mesh.vertices.size();
+        header.indexCount = indices.count();
+        header.indexType = indices.type;
+        header.vertexOffset = align(sizeof(CookedMeshHeader));
+        auto vertexBytes = mesh.vertexBytes();
+        header.indexOffset = align(header.vertexOffset + vertexBytes.size());
+        header.submeshCount = mesh.submeshes.size();
+        header.submeshOffset =
+            align(header.indexOffset + indices.bytes.size());
+        std::vector<CookedMaterial> materials(mesh.materials.begin(),
+                                              mesh.materials.end());
+        header.materialCount = materials.size();
+        header.materialOffset = align(header.submeshOffset +
+                                      mesh.submeshes.size() * sizeof(SubMesh));
+        std::memcpy(header.boundsMin, &mesh.bounds.min, sizeof(float) * 3);
+        std::memcpy(header.boundsMax, &mesh.bounds.max, sizeof(float) * 3);
+
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            auto out = std::ofstream(tmpPath, std::ios::binary);
+            if (!out.is_open()) {
+                return false;
+            }
+            const std::array<char, CookedMeshHeader::BLOCK_ALIGNMENT> zeros{};
+            auto pad = [&](uint64_t to) {
+                auto at = static_cast<uint64_t>(out.tellp());
+                DEBUG_ASSERT(at <= to);
+                out.write(zeros.data(), static_cast<std::streamsize>(to - at));
+            };
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            pad(header.vertexOffset);
+            out.write(reinterpret_cast<const char *>(vertexBytes.data()),
+                      static_cast<std::streamsize>(vertexBytes.size()));
+            pad(header.indexOffset);
+            out.write(reinterpret_cast<const char *>(indices.bytes.data()),
+                      static_cast<std::streamsize>(indices.bytes.size()));
+            pad(header.submeshOffset);
+            out.write(reinterpret_cast<const char *>(mesh.submeshes.data()),
+                      static_cast<std::streamsize>(mesh.submeshes.size() *
+                                                   sizeof(SubMesh)));
+            pad(header.materialOffset);
+            out.write(reinterpret_cast<const char *>(materials.data()),
+                      static_cast<std::streamsize>(materials.size() *
+                                                   sizeof(CookedMaterial)));
+            if (!out.good()) {
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        return !ec;
+    }
+
+    [[nodiscard]] const VertexFormat &getFormat() const {
+        return header->format;
+    }
+
+    [[nodiscard]] size_t getVertexCount() const { return header->vertexCount; }
+
+    [[nodiscard]] std::span<const std::byte> vertexBytes() const {
+        return bytes.subspan(header->vertexOffset,
+                             header->vertexCount * header->format.stride);
+    }
+
+    /*
+     * Indices of getIndexType(), 16 bits when all of them fit
+     */
+    [[nodiscard]] std::span<const std::byte> indexBytes() const {
+        return bytes.subspan(header->indexOffset,
+                             header->indexCount *
+                                 IndexData::sizeOf(header->indexType));
+    }
+
+    [[nodiscard]] GLenum getIndexType() const { return header->indexType; }
+
+    [[nodiscard]] MeshBounds getBounds() const {
+        MeshBounds bounds;
+        std::memcpy(&bounds.min, header->boundsMin, sizeof(float) * 3);
+        std::memcpy(&bounds.max, header->boundsMax, sizeof(float) * 3);
+        return bounds;
+    }
+
+    [[nodiscard]] std::span<const SubMesh> submeshes() const {
+        return {reinterpret_cast<const SubMesh *>(bytes.data() +
+                                                   header->submeshOffset),
+                header->submeshCount};
+    }
+
+    [[nodiscard]] std::vector<Material> getMaterials() const {
+        std::span<const CookedMaterial> cooked = {
+            reinterpret_cast<const CookedMaterial *>(bytes.data() +
+                                                     header->materialOffset),
+            header->materialCount};
+        std::vector<Material> materials;
+        materials.reserve(cooked.size());
+        for (const auto &material : cooked) {
+            materials.push_back(material.toMaterial());
+        }
+        return materials;
+    }
+};
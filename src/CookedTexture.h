@@ -0,0 +1,232 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "MipChain.h"
+#include "TextureFormat.h"
+#include "assertions.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Header of a cooked texture file (.ztex), a mip chain in one of the
+ * TextureFormats. Like KTX2 it is a fixed header with a level index, so every
+ * level can be uploaded straight from the mapping.
+ *
+ * File layout: [header][level 0][level 1]..., every level starts at
+ * levelOffsets[i] (aligned to 16 bytes) and is
+ * texture_format::levelSize(format, level width, level height) bytes.
+ * Rows go from the top of the image unless flippedY is set, then they go
+ * from the bottom like GL expects.
+ *
+ * Bump VERSION whenever anything in the layout changes.
+ */
+struct CookedTextureHeader {
+    static constexpr std::array<char, 4> MAGIC = {'Z', 'P', 'G', 'T'};
+    static constexpr uint32_t VERSION = 2;
+    static constexpr uint64_t BLOCK_ALIGNMENT = 16;
+    // 2^16 pixels is enough for anything
+    static constexpr uint32_t MAX_LEVELS = 17;
+
+    std::array<char, 4> magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t levels = 0;
+    uint32_t flippedY = 0;
+    TextureFormat format = TextureFormat::RGBA8;
+    uint32_t _padding_0 = 0;
+    std::array<uint64_t, MAX_LEVELS> levelOffsets{};
+};
+static_assert(std::is_trivially_copyable_v<CookedTextureHeader>);
+
+/*
+ * Cooked texture mapped into memory, levels point into the mapping
+ */
+class CookedTexture {
+  private:
+    // Empty for views into memory owned by someone else (AssetPack)
+    std::optional<MappedFile> file;
+    std::span<const std::byte> bytes;
+    const CookedTextureHeader *header;
+
+    CookedTexture(std::span<const std::byte> bytes,
+                  const CookedTextureHeader *header)
+        : bytes(bytes), header(header) {}
+
+    static constexpr uint64_t align(uint64_t val) {
+        auto a = CookedTextureHeader::BLOCK_ALIGNMENT;
+        return (val + a - 1) / a * a;
+    }
+
+    static uint64_t levelSize(const CookedTextureHeader &header,
+                              uint32_t level) {
+        return texture_format::levelSize(header.format,
+                                         std::max(1u, header.width >> level),
+                                         std::max(1u, header.height >> level));
+    }
+
+  public:
+    CookedTexture(const CookedTexture &) = delete;
+    CookedTexture(CookedTexture &&other) noexcept = default;
+
+    /*
+     * Maps the file and checks the header. Returns empty optional if the file
+     * doesn't exist, is from another version or is damaged.
+     */
+    static std::optional<CookedTexture>
+    open(const std::filesystem::path &path) {
+        // Everything is uploaded right away
+        auto maybeFile = MappedFile::open(path, MapHint::WILLNEED);
+        if (!maybeFile.has_value()) {
+            return {};
+        }
+        auto self = view(maybeFile->bytes());
+        if (self.has_value()) {
+            self->file.emplace(std::move(maybeFile.value()));
+        }
+        return self;
+    }
+
+    /*
+     * Same as open() for data that is already in memory. Nothing is copied,
+     * `mapped` has to outlive the returned object.
+     */
+    static std::optional<CookedTexture>
+    view(std::span<const std::byte> mapped) {
+        if (0 != reinterpret_cast<uintptr_t>(mapped.data()) %
+                     CookedTextureHeader::BLOCK_ALIGNMENT) {
+            return {};
+        }
+        if (mapped.size() < sizeof(CookedTextureHeader)) {
+            return {};
+        }
+        const auto *header =
+            reinterpret_cast<const CookedTextureHeader *>(mapped.data());
+        if (header->magic != CookedTextureHeader::MAGIC ||
+            header->version != CookedTextureHeader::VERSION ||
+            0 == header->width || 0 == header->height || 0 == header->levels ||
+            header->levels > CookedTextureHeader::MAX_LEVELS ||
+            header->format > TextureFormat::BC3) {
+            return {};
+        }
+        for (uint32_t i = 0; i < header->levels; i++) {
+            uint64_t offset = header->levelOffsets[i];
+            uint64_t size = levelSize(*header, i);
+            if (offset > mapped.size() || size > mapped.size() - offset ||
+                0 != offset % CookedTextureHeader::BLOCK_ALIGNMENT) {
+                return {};
+            }
+        }
+        return CookedTexture(mapped, header);
+    }
+
+    /*
+     * Writes `levels` (level 0 first) to `path` through a temp file. Pixels of
+     * the levels are already in `format`.
+     */
+    static bool write(const std::filesystem::path &path,
+                      const std::vector<ImageLevel> &levels, bool flippedY,
+                      TextureFormat format = TextureFormat::RGBA8) {
+        DEBUG_ASSERT(!levels.empty());
+        DEBUG_ASSERT(levels.size() <= CookedTextureHeader::MAX_LEVELS);
+        CookedTextureHeader header;
+        header.width = levels[0].width;
+        header.height = levels[0].height;
+        header.levels = levels.size();
+        header.flippedY = flippedY;
+        header.format = format;
+        uint64_t offset = align(sizeof(CookedTextureHeader));
+        for (size_t i = 0; i < levels.size(); i++) {
+            DEBUG_ASSERT(levels[i].pixels.size() == levelSize(header, i));
+            header.levelOffsets[i] = offset;
+            offset = align(offset + levels[i].pixels.size());
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            auto out = std::ofstream(tmpPath, std::ios::binary);
+            if (!out.is_open()) {
+                return false;
+            }
+            const std::array<char, CookedTextureHeader::BLOCK_ALIGNMENT>
+                zeros{};
+            auto pad = [&](uint64_t to) {
+                auto at = static_cast<uint64_t>(out.tellp());
+                DEBUG_ASSERT(at <= to);
+                out.write(zeros.data(), static_cast<std::streamsize>(to - at));
+            };
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            for (size_t i = 0; i < levels.size(); i++) {
+                pad(header.levelOffsets[i]);
+                out.write(
+                    reinterpret_cast<const char *>(levels[i].pixels.data()),
+                    static_cast<std::streamsize>(levels[i].pixels.size()));
+            }
+            if (!out.good()) {
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        return !ec;
+    }
+
+    [[nodiscard]] int getWidth() const { return header->width; }
+
+    [[nodiscard]] int getHeight() const { return header->height; }
+
+    [[nodiscard]] uint32_t getLevels() const { return header->levels; }
+
+    [[nodiscard]] bool isFlippedY() const { return 0 != header->flippedY; }
+
+    [[nodiscard]] TextureFormat getFormat() const { return header->format; }
+
+    [[nodiscard]] int levelWidth(uint32_t level) const {
+        return std::max(1u, header->width >> level);
+    }
+
+    [[nodiscard]] int levelHeight(uint32_t level) const {
+        return std::max(1u, header->height >> level);
+    }
+
+    [[nodiscard]] std::span<const std::byte> level(uint32_t level) const {
+        DEBUG_ASSERT(level < header->levels);
+        return bytes.subspan(header->levelOffsets[level],
+                             levelSize(*header, level));
+    }
+
+    /*
+     * Pixels of `level` with rows in the requested order. Points into the
+     * mapping when the order matches, otherwise the level is flipped into
+     * `scratch`. Block compressed levels can't be flipped row by row, they are
+     * cooked in the order they are used.
+     */
+    [[nodiscard]] const void *
+    levelPixels(uint32_t level, bool flippedY,
+                std::vector<std::byte> &scratch) const {
+        auto pixels = this->level(level);
+        if (flippedY == isFlippedY()) {
+            return pixels.data();
+        }
+        DEBUG_ASSERTF(TextureFormat::RGBA8 == getFormat(),
+                      "Compressed texture cooked with the other row order");
+        size_t rowSize = static_cast<size_t>(levelWidth(level)) * 4;
+        int rows = levelHeight(level);
+        scratch.resize(pixels.size());
+        for (int y = 0; y < rows; y++) {
+            std::memcpy(scratch.data() + rowSize * y,
+                        pixels.data() + rowSize * (rows - 1 - y), rowSize);
+        }
+        return scratch.data();
+    }
+};
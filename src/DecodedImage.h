@@ -0,0 +1,75 @@
+#pragma once
+
+#include "assertions.h"
+#include <SOIL.h>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+/*
+ * RGBA8 pixels decoded by SOIL, freed with SOIL_free_image_data
+ */
+class DecodedImage {
+  private:
+    unsigned char *pixels = nullptr;
+    int width = 0;
+    int height = 0;
+
+    DecodedImage(unsigned char *pixels, int width, int height)
+        : pixels(pixels), width(width), height(height) {}
+
+  public:
+    DecodedImage(DecodedImage &) = delete;
+    DecodedImage(DecodedImage &&other) noexcept
+        : pixels(other.pixels), width(other.width), height(other.height) {
+        other.pixels = nullptr;
+    }
+
+    /*
+     * `buf` is the encoded file (PNG, JPG, ...), usually a mapped file
+     */
+    static DecodedImage decode(std::span<const std::byte> buf, bool flipY) {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        unsigned char *pixels = SOIL_load_image_from_memory(
+            reinterpret_cast<const unsigned char *>(buf.data()),
+            static_cast<int>(buf.size()), &width, &height,
+            &channels, SOIL_LOAD_RGBA);
+        if (nullptr == pixels) {
+            auto err = SOIL_last_result();
+            UNREACHABLE("Failed to decode image: %s", err);
+        }
+        auto self = DecodedImage(pixels, width, height);
+        if (flipY) {
+            self.flipY();
+        }
+        return self;
+    }
+
+    // Same as SOIL_FLAG_INVERT_Y
+    void flipY() {
+        size_t rowSize = static_cast<size_t>(width) * 4;
+        std::vector<unsigned char> tmp(rowSize);
+        for (int y = 0; y < height / 2; y++) {
+            unsigned char *top = pixels + rowSize * y;
+            unsigned char *bottom = pixels + rowSize * (height - 1 - y);
+            std::memcpy(tmp.data(), top, rowSize);
+            std::memcpy(top, bottom, rowSize);
+            std::memcpy(bottom, tmp.data(), rowSize);
+        }
+    }
+
+    [[nodiscard]] const unsigned char *data() const { return pixels; }
+
+    [[nodiscard]] int getWidth() const { return width; }
+
+    [[nodiscard]] int getHeight() const { return height; }
+
+    ~DecodedImage() {
+        if (nullptr != pixels) {
+            SOIL_free_image_data(pixels);
+        }
+    }
+};
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "assertions.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Number of GL calls that went through GLStateCache during one frame.
+ * issued - calls that actually reached the driver
+ * elided - calls that were dropped because the state was already set
+ */
+struct GLStateStats {
+    uint64_t issued = 0;
+    uint64_t elided = 0;
+};
+
+/*
+ * Shadow copy of the GL binding state of the (only) context.
+ *
+ * Every bind/enable done by the engine goes through this class, so requests
+ * that would not change anything are dropped before they reach the driver.
+ * The shadowed state is: current program, VAO, non-indexed and indexed buffer
+ * bindings, active texture unit, per-unit texture and sampler bindings and
+ * enable bits.
+ *
+ * Everything starts as "unknown", so the first bind of every slot is always
+ * issued. Code that changes GL state behind our back (SOIL, ...) has to call
+ * the matching invalidate* function afterwards. ImGui's OpenGL3 backend backs
+ * up and restores everything it touches, so it is safe to mix with the cache.
+ */
+class GLStateCache {
+  public:
+    static constexpr GLuint UNKNOWN = UINT32_MAX;
+
+  private:
+    // Texture targets we shadow per texture unit
+    static constexpr std::array<GLenum, 3> TEXTURE_TARGETS = {
+        GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_2D_ARRAY};
+
+    struct TextureUnit {
+        std::array<GLuint, TEXTURE_TARGETS.size()> textures = {
+            UNKNOWN, UNKNOWN, UNKNOWN};
+        GLuint sampler = UNKNOWN;
+    };
+
+    GLuint program = UNKNOWN;
+    GLuint vertexArray = UNKNOWN;
+    GLuint activeUnit = UNKNOWN;
+    std::unordered_map<GLenum, GLuint> buffers;
+    // key is (target << 32) | index
+    std::unordered_map<uint64_t, GLuint> indexedBuffers;
+    std::vector<TextureUnit> textureUnits;
+    std::unordered_map<GLenum, bool> enabled;
+
+    GLStateStats currentFrame;
+    GLStateStats lastFrame;
+
+    GLStateCache() = default;
+
+    static size_t textureTargetIndex(GLenum target) {
+        for (size_t i = 0; i < TEXTURE_TARGETS.size(); i++) {
+            if (TEXTURE_TARGETS[i] == target) {
+                return i;
+            }
+        }
+        UNREACHABLE("Texture target 0x%x is not tracked by GLStateCache",
+                    target);
+    }
+
+    static constexpr GLenum bufferBindingQuery(GLenum target) {
+        switch (target) {
+        case GL_ARRAY_BUFFER:
+            return GL_ARRAY_BUFFER_BINDING;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+        case GL_SHADER_STORAGE_BUFFER:
+            return GL_SHADER_STORAGE_BUFFER_BINDING;
+        case GL_UNIFORM_BUFFER:
+            return GL_UNIFORM_BUFFER_BINDING;
+        case GL_DRAW_INDIRECT_BUFFER:
+            return GL_DRAW_INDIRECT_BUFFER_BINDING;
+        case GL_PIXEL_UNPACK_BUFFER:
+            return GL_PIXEL_UNPACK_BUFFER_BINDING;
+        default:
+            return 0;
+        }
+    }
+
+    static constexpr uint64_t indexedKey(GLenum target, GLuint index) {
+        return (static_cast<uint64_t>(target) << 32) | index;
+    }
+
+    TextureUnit &unitAt(GLuint unit) {
+        if (unit >= textureUnits.size()) {
+            textureUnits.resize(unit + 1);
+        }
+        return textureUnits[unit];
+    }
+
+    /*
+     * Returns true (and counts the call as issued) when `slot` differs from
+     * `value`. Updates the slot.
+     */
+    template <typename T> inline bool change(T &slot, T value) {
+        if (slot == value) {
+            currentFrame.elided++;
+            return false;
+        }
+        slot = value;
+        currentFrame.issued++;
+        return true;
+    }
+
+  public:
+    GLStateCache(const GLStateCache &) = delete;
+    GLStateCache &operator=(const GLStateCache &) = delete;
+
+    static GLStateCache &get() {
+        static GLStateCache instance;
+        return instance;
+    }
+
+    void useProgram(GLuint id) {
+        if (change(program, id)) {
+            glUseProgram(id);
+        }
+    }
+
+    void bindVertexArray(GLuint id) {
+        if (change(vertexArray, id)) {
+            glBindVertexArray(id);
+            // element array binding is part of the VAO state
+            buffers[GL_ELEMENT_ARRAY_BUFFER] = UNKNOWN;
+        }
+    }
+
+    void bindBuffer(GLenum target, GLuint id) {
+        auto it = buffers.try_emplace(target, UNKNOWN).first;
+        if (change(it->second, id)) {
+            glBindBuffer(target, id);
+        }
+    }
+
+    /*
+     * glBindBufferBase also changes the generic binding point of the target
+     */
+    void bindBufferBase(GLenum target, GLuint index, GLuint id) {
+        auto it =
+            indexedBuffers.try_emplace(indexedKey(target, index), UNKNOWN)
+                .first;
+        if (change(it->second, id)) {
+            glBindBufferBase(target, index, id);
+            buffers[target] = id;
+        }
+    }
+
+    void activeTexture(GLuint unit) {
+        if (change(activeUnit, unit)) {
+            glActiveTexture(GL_TEXTURE0 + unit);
+        }
+    }
+
+    void bindTexture(GLuint unit, GLenum target, GLuint id) {
+        GLuint &slot = unitAt(unit).textures[textureTargetIndex(target)];
+        if (slot == id) {
+            currentFrame.elided++;
+            return;
+        }
+        activeTexture(unit);
+        slot = id;
+        currentFrame.issued++;
+        glBindTexture(target, id);
+    }
+
+    void bindSampler(GLuint unit, GLuint id) {
+        if (change(unitAt(unit).sampler, id)) {
+            glBindSampler(unit, id);
+        }
+    }
+
+    void setEnabled(GLenum cap, bool value) {
+        auto it = enabled.find(cap);
+        if (it != enabled.end() && it->second == value) {
+            currentFrame.elided++;
+            return;
+        }
+        enabled[cap] = value;
+        currentFrame.issued++;
+        if (value) {
+            glEnable(cap);
+        } else {
+            glDisable(cap);
+        }
+    }
+
+    void enable(GLenum cap) { setEnabled(cap, true); }
+
+    void disable(GLenum cap) { setEnabled(cap, false); }
+
+    // region Object deletion
+    // GL silently unbinds deleted objects, so we have to forget them too
+
+    void deleteBuffer(GLuint id) {
+        for (auto &[target, bound] : buffers) {
+            if (bound == id) {
+                bound = 0;
+            }
+        }
+        for (auto &[key, bound] : indexedBuffers) {
+            if (bound == id) {
+                bound = 0;
+            }
+        }
+        glDeleteBuffers(1, &id);
+    }
+
+    void deleteVertexArray(GLuint id) {
+        if (vertexArray == id) {
+            vertexArray = 0;
+            buffers[GL_ELEMENT_ARRAY_BUFFER] = UNKNOWN;
+        }
+        glDeleteVertexArrays(1, &id);
+    }
+
+    void deleteTexture(GLuint id) {
+        for (auto &unit : textureUnits) {
+            for (auto &bound : unit.textures) {
+                if (bound == id) {
+                    bound = 0;
+                }
+            }
+        }
+        glDeleteTextures(1, &id);
+    }
+
+    void deleteSampler(GLuint id) {
+        for (auto &unit : textureUnits) {
+            if (unit.sampler == id) {
+                unit.sampler = 0;
+            }
+        }
+        glDeleteSamplers(1, &id);
+    }
+
+    void deleteProgram(GLuint id) {
+        if (program == id) {
+            program = 0;
+        }
+        glDeleteProgram(id);
+    }
+    // endregion
+
+    // region Invalidation
+
+    /*
+     * Forget what is bound to the given unit/target, for example after a
+     * library call which binds textures on its own
+     */
+    void invalidateTexture(GLuint unit, GLenum target) {
+        unitAt(unit).textures[textureTargetIndex(target)] = UNKNOWN;
+    }
+
+    void invalidateActiveTexture() { activeUnit = UNKNOWN; }
+
+    void invalidateBuffer(GLenum target) { buffers[target] = UNKNOWN; }
+
+    void invalidate() {
+        program = UNKNOWN;
+        vertexArray = UNKNOWN;
+        activeUnit = UNKNOWN;
+        buffers.clear();
+        indexedBuffers.clear();
+        textureUnits.clear();
+        enabled.clear();
+    }
+    // endregion
+
+    // region Queries
+    // These only ask GL (once) when the slot is still unknown
+
+    [[nodiscard]] GLuint currentProgram() {
+        if (UNKNOWN == program) {
+            GLint val = 0;
+            glGetIntegerv(GL_CURRENT_PROGRAM, &val);
+            program = val;
+        }
+        return program;
+    }
+
+    [[nodiscard]] GLuint currentVertexArray() {
+        if (UNKNOWN == vertexArray) {
+            GLint val = 0;
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &val);
+            vertexArray = val;
+        }
+        return vertexArray;
+    }
+
+    [[nodiscard]] GLuint boundBuffer(GLenum target) {
+        GLuint &slot = buffers.try_emplace(target, UNKNOWN).first->second;
+        if (UNKNOWN == slot) {
+            GLenum binding = bufferBindingQuery(target);
+            if (0 != binding) {
+                GLint val = 0;
+                glGetIntegerv(binding, &val);
+                slot = val;
+            }
+        }
+        return slot;
+    }
+
+    [[nodiscard]] GLuint boundTexture(GLuint unit, GLenum target) const {
+        if (unit >= textureUnits.size()) {
+            return UNKNOWN;
+        }
+        return textureUnits[unit].textures[textureTargetIndex(target)];
+    }
+    // endregion
+
+    // region Statistics
+
+    /*
+     * Should be called once at the start of every frame
+     */
+    void beginFrame() {
+        lastFrame = currentFrame;
+        currentFrame = GLStateStats();
+    }
+
+    [[nodiscard]] const GLStateStats &frameStats() const {
+        return currentFrame;
+    }
+
+    [[nodiscard]] const GLStateStats &lastFrameStats() const {
+        return lastFrame;
+    }
+    // endregion
+};
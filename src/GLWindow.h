@@ -15,6 +15,8 @@
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
 #include "Observer.h"
+#include "GLStateCache.h"
+#include "TextureBinder.h"
 
 struct WindowSize {
     int width;
@@ -364,7 +366,7 @@ public:
         glfwMakeContextCurrent(window);
 
         glfwSwapInterval(1);
-        glEnable(GL_DEPTH_TEST);
+        GLStateCache::get().enable(GL_DEPTH_TEST);
 
         func();
         glfwMakeContextCurrent(nullptr);
@@ -414,6 +416,8 @@ public:
     }
 
     void startFrame() noexcept {
+        GLStateCache::get().beginFrame();
+        TextureBinder::get().beginFrame();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
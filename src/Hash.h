@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+/*
+ * 64-bit FNV-1a. Not cryptographic, only used to detect changed asset content
+ * and to index asset names.
+ */
+namespace hash {
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    constexpr uint64_t fnv1a(std::string_view data,
+                             uint64_t hash = FNV_OFFSET) {
+        for (char c : data) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    inline uint64_t fnv1a(std::span<const std::byte> data,
+                          uint64_t hash = FNV_OFFSET) {
+        for (std::byte b : data) {
+            hash ^= static_cast<uint8_t>(b);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    inline std::string toHex(uint64_t hash) {
+        constexpr char digits[] = "0123456789abcdef";
+        std::string out(16, '0');
+        for (int i = 15; i >= 0; i--) {
+            out[i] = digits[hash & 0xf];
+            hash >>= 4;
+        }
+        return out;
+    }
+}
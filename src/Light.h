@@ -32,7 +32,8 @@ class Light {
     float cutoff = 0.8;
 
   private:
-    Cube cube;
+    // Shares the buffers with the gizmos of all the other lights
+    Cube cube{Primitive::box()};
     std::shared_ptr<ShaderLightCube> shaderLightCube;
     std::shared_ptr<LightsCollection> lightsCollection;
     size_t lightIndex = SIZE_MAX;
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "assertions.h"
+#include <cstddef>
+#include <cstdint>
+#include <fcntl.h>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * How the mapping is going to be used, so the kernel can read ahead
+ * NORMAL - pages are read on first access
+ * WILLNEED - whole file is read in the background, open() returns right away
+ * POPULATE - whole file is read before open() returns (MAP_POPULATE), for
+ *            files that are processed right after opening, like images
+ *            which are decoded
+ */
+enum class MapHint : uint8_t { NORMAL, WILLNEED, POPULATE };
+
+/*
+ * Read-only memory mapping of a whole file.
+ *
+ * Pages are loaded by the kernel on first access straight from the page
+ * cache, so there is no read() into a temporary buffer and data can be handed
+ * to GL (glBufferData, ...) or a decoder directly from the mapping.
+ */
+class MappedFile {
+  private:
+    const std::byte *mapping = nullptr;
+    size_t length = 0;
+
+    MappedFile(const std::byte *mapping, size_t length)
+        : mapping(mapping), length(length) {}
+
+  public:
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept
+        : mapping(other.mapping), length(other.length) {
+        other.mapping = nullptr;
+        other.length = 0;
+    }
+
+    /*
+     * Returns empty optional when the file doesn't exist or can't be mapped
+     */
+    static std::optional<MappedFile> open(const std::filesystem::path &path,
+                                          MapHint hint = MapHint::NORMAL) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return {};
+        }
+        struct stat st {};
+        if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return {};
+        }
+        auto size = static_cast<size_t>(st.st_size);
+        int flags = MAP_PRIVATE;
+        if (MapHint::POPULATE == hint) {
+            flags |= MAP_POPULATE;
+        }
+        void *ptr = mmap(nullptr, size, PROT_READ, flags, fd, 0);
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+        if (MAP_FAILED == ptr) {
+            return {};
+        }
+        auto self = MappedFile(static_cast<const std::byte *>(ptr), size);
+        if (MapHint::WILLNEED == hint) {
+            self.advise(self.bytes(), MADV_WILLNEED);
+        }
+        return self;
+    }
+
+    [[nodiscard]] const std::byte *data() const { return mapping; }
+
+    [[nodiscard]] size_t size() const { return length; }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const {
+        return {mapping, length};
+    }
+
+    /*
+     * Content as text, for shaders
+     */
+    [[nodiscard]] std::string_view text() const {
+        return {reinterpret_cast<const char *>(mapping), length};
+    }
+
+    /*
+     * madvise() for a part of the mapping, for example MADV_WILLNEED to start
+     * reading pages in the background before they are touched. The range is
+     * widened to whole pages. It's only a hint, failures are ignored.
+     */
+    void advise(std::span<const std::byte> range, int advice) const {
+        if (range.empty()) {
+            return;
+        }
+        DEBUG_ASSERT(range.data() >= mapping &&
+                     range.data() + range.size() <= mapping + length);
+        static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t begin = static_cast<size_t>(range.data() - mapping);
+        size_t end = begin + range.size();
+        begin -= begin % pageSize;
+        madvise(const_cast<std::byte *>(mapping) + begin, end - begin, advice);
+    }
+
+    /*
+     * Reads one byte of every page of `range`, so the kernel loads them
+     * right now. Called on a loader thread before the GL thread reads the
+     * range, so it doesn't stall on the disk.
+     */
+    static void touch(std::span<const std::byte> range) {
+        static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        uint8_t sum = 0;
+        for (size_t i = 0; i < range.size(); i += pageSize) {
+            sum += static_cast<uint8_t>(range[i]);
+        }
+        if (!range.empty()) {
+            sum += static_cast<uint8_t>(range.back());
+        }
+        // Keeps the reads from being optimized out
+        [[maybe_unused]] volatile uint8_t sink = sum;
+    }
+
+    ~MappedFile() {
+        if (nullptr != mapping) {
+            munmap(const_cast<std::byte *>(mapping), length);
+        }
+    }
+};
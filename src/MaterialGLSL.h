@@ -0,0 +1,37 @@
+#pragma once
+#include "Material.h"
+#include "glm/ext/vector_float4.hpp"
+#include <cstdint>
+
+/*
+ * Matching declaration for struct Material in fragment/lights.glsl and
+ * fragment/textureLight.glsl
+ */
+class alignas(16) MaterialGLSL final {
+  private:
+    /*
+     * More info about memory layout here:
+     * https://www.khronos.org/opengl/wiki/Interface_Block_(GLSL)#Memory_layout
+     */
+    glm::vec4 ambient;
+    glm::vec4 diffuse;
+    glm::vec4 specular;
+    float shininess;
+    // struct in std430 array is padded to the alignment of vec4
+    uint32_t _padding_0 = 0;
+    uint32_t _padding_1 = 0;
+    uint32_t _padding_2 = 0;
+
+  public:
+    explicit MaterialGLSL(const Material &material)
+        : ambient(material.getAmbient()), diffuse(material.getDiffuse()),
+          specular(material.getSpecular()),
+          shininess(material.getShininess()) {}
+
+    bool operator==(const MaterialGLSL &other) const {
+        return ambient == other.ambient && diffuse == other.diffuse &&
+               specular == other.specular && shininess == other.shininess;
+    }
+};
+// So that I don't accidentally add more fields
+static_assert(sizeof(MaterialGLSL) == 64);
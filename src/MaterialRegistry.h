@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Material.h"
+#include "MaterialGLSL.h"
+#include "assertions.h"
+#include "shaders/SSBO.h"
+#include <algorithm>
+#include <cstdint>
+#include <span>
+
+/*
+ * Index into the `materials` array in shaders
+ */
+using MaterialIndex = uint32_t;
+
+/*
+ * All materials used by a scene, stored in one SSBO, so shaders only need an
+ * index to look the material up (materials[materialIndex]) instead of four
+ * uniforms that have to be pushed every time the material changes.
+ */
+class MaterialRegistry {
+  private:
+    SSBO<MaterialGLSL> materials;
+
+  public:
+    explicit MaterialRegistry() = default;
+
+    /*
+     * Returns index of an equal material, adds the material if there is none.
+     * Materials are few, so linear search is fine here.
+     */
+    MaterialIndex intern(const Material &material) {
+        auto value = MaterialGLSL(material);
+        auto &obj = materials.objects();
+        auto it = std::ranges::find(obj, value);
+        if (it != obj.end()) {
+            return static_cast<MaterialIndex>(it - obj.begin());
+        }
+        return push(value);
+    }
+
+    /*
+     * Always adds a new entry. Use this for materials that will be changed
+     * with set(), so the change doesn't leak into other users of an interned
+     * material.
+     */
+    MaterialIndex add(const Material &material) {
+        return push(MaterialGLSL(material));
+    }
+
+    /*
+     * Adds every material as a new entry, they get consecutive indices.
+     * Returns the index of the first one, material i of a model is then
+     * first + i.
+     */
+    MaterialIndex addAll(std::span<const Material> all) {
+        DEBUG_ASSERT(!all.empty());
+        MaterialIndex first = add(all[0]);
+        for (size_t i = 1; i < all.size(); i++) {
+            add(all[i]);
+        }
+        return first;
+    }
+
+    void set(MaterialIndex idx, const Material &material) {
+        auto &obj = materials.objects();
+        DEBUG_ASSERTF(idx < obj.size(), "Material %u does not exist", idx);
+        obj[idx] = MaterialGLSL(material);
+        materials.updateAt(idx);
+    }
+
+    [[nodiscard]] size_t size() { return materials.objects().size(); }
+
+    void bind(uint32_t bindingId) { materials.bind(bindingId); }
+
+  private:
+    MaterialIndex push(MaterialGLSL value) {
+        auto &obj = materials.objects();
+        auto idx = static_cast<MaterialIndex>(obj.size());
+        obj.emplace_back(value);
+        materials.realloc();
+        return idx;
+    }
+};
@@ -4,9 +4,35 @@
 
 #pragma once
 
+#include <cmath>
+#include <glm/glm.hpp>
+
 namespace math {
     template<typename T>
     T interpolate(T a, T in_min, T in_max, T out_min, T out_max) {
         return (a - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
     }
+
+    /*
+     * Matrix that transforms normals, transpose(inverse(mat3(model))).
+     * When the model matrix only rotates and scales uniformly, that is the
+     * upper 3x3 itself (up to a scale, normals get normalized in shaders
+     * anyway), so the inverse is skipped.
+     */
+    inline glm::mat3 normalMatrix(const glm::mat4 &model) {
+        auto m = glm::mat3(model);
+        const float eps = 1e-4f;
+        float xx = glm::dot(m[0], m[0]);
+        float yy = glm::dot(m[1], m[1]);
+        float zz = glm::dot(m[2], m[2]);
+        bool uniformScale = std::abs(xx - yy) <= eps * xx &&
+                            std::abs(xx - zz) <= eps * xx &&
+                            std::abs(glm::dot(m[0], m[1])) <= eps * xx &&
+                            std::abs(glm::dot(m[0], m[2])) <= eps * xx &&
+                            std::abs(glm::dot(m[1], m[2])) <= eps * xx;
+        if (uniformScale && xx > 0) {
+            return m;
+        }
+        return glm::transpose(glm::inverse(m));
+    }
 }
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "Material.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <vector>
+
+struct Vertex {
+    float Position[3];
+    float Normal[3];
+    float Texture[2];
+    float Tangent[3];
+};
+
+/*
+ * One vertex attribute, everything needed for glVertexArrayAttribFormat
+ */
+struct VertexAttribute {
+    uint32_t location;
+    uint32_t components;
+    uint32_t type; // GLenum, GL_FLOAT, ...
+    uint32_t normalized;
+    uint32_t offset; // bytes from the start of the vertex
+
+    /*
+     * Bytes of the attribute in a vertex, 0 for a type or component count
+     * GL doesn't take
+     */
+    [[nodiscard]] uint32_t size() const {
+        if (0 == components || components > 4) {
+            return 0;
+        }
+        switch (type) {
+        case GL_FLOAT:
+            return components * 4;
+        case GL_HALF_FLOAT:
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+            return components * 2;
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+            return components;
+        case GL_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+            // All components in one 32-bit word
+            return 4 == components ? 4 : 0;
+        default:
+            return 0;
+        }
+    }
+};
+
+/*
+ * Layout of one interleaved vertex. Plain data, it's stored as is in cooked
+ * mesh files.
+ *
+ * Quantised positions (see VertexQuantizer) are stored relative to the mesh,
+ * the real one is position * positionScale + positionOffset. Shaders don't
+ * know about it, it's a part of the model matrix, see positionTransform().
+ */
+struct VertexFormat {
+    static constexpr size_t MAX_ATTRIBUTES = 8;
+
+    uint32_t stride = 0; // bytes
+    uint32_t attributeCount = 0;
+    std::array<VertexAttribute, MAX_ATTRIBUTES> attributes{};
+    float positionScale = 1;
+    float positionOffset[3] = {};
+
+    [[nodiscard]] std::span<const VertexAttribute> used() const {
+        return {attributes.data(), attributeCount};
+    }
+
+    /*
+     * Matrix from the stored positions to the model space, multiply the model
+     * matrix by it. The scale is uniform, so normals stay as they are.
+     */
+    [[nodiscard]] glm::mat4 positionTransform() const {
+        glm::mat4 transform(positionScale);
+        transform[3] = glm::vec4(positionOffset[0], positionOffset[1],
+                                 positionOffset[2], 1);
+        return transform;
+    }
+
+    /*
+     * Tightly packed float attributes at locations 0, 1, ..., for the vertex
+     * arrays of the simple drawables. {3, 3, 2} is position, normal, uv.
+     */
+    static constexpr VertexFormat floats(
+        std::initializer_list<uint32_t> components) {
+        VertexFormat format;
+        for (uint32_t count : components) {
+            format.attributes[format.attributeCount] = {
+                format.attributeCount, count, GL_FLOAT, GL_FALSE,
+                format.stride};
+            format.attributeCount++;
+            format.stride += count * sizeof(float);
+        }
+        return format;
+    }
+
+    // Format of Vertex
+    static constexpr VertexFormat model() {
+        VertexFormat format;
+        format.stride = sizeof(Vertex);
+        format.attributeCount = 4;
+        format.attributes[0] = {0, 3, GL_FLOAT, GL_FALSE,
+                                offsetof(Vertex, Position)};
+        format.attributes[1] = {1, 3, GL_FLOAT, GL_FALSE,
+                                offsetof(Vertex, Normal)};
+        format.attributes[2] = {2, 2, GL_FLOAT, GL_FALSE,
+                                offsetof(Vertex, Texture)};
+        // Tangent for Normal Map
+        format.attributes[3] = {3, 3, GL_FLOAT, GL_FALSE,
+                                offsetof(Vertex, Tangent)};
+        return format;
+    }
+};
+
+struct BoundingSphere {
+    glm::vec3 center = glm::vec3(0);
+    float radius = 0;
+};
+
+/*
+ * Axis aligned bounding box in model space
+ */
+struct MeshBounds {
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+    void extend(const glm::vec3 &point) {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    [[nodiscard]] bool isEmpty() const { return min.x > max.x; }
+
+    /*
+     * Sphere around the box placed in the world by `modelMatrix`. The radius
+     * is scaled by the largest scale of the matrix, so it stays conservative
+     * for non-uniform scales.
+     */
+    [[nodiscard]] BoundingSphere sphere(const glm::mat4 &modelMatrix) const {
+        if (isEmpty()) {
+            return {glm::vec3(modelMatrix[3]), 0};
+        }
+        float scale = std::max({glm::length(glm::vec3(modelMatrix[0])),
+                                glm::length(glm::vec3(modelMatrix[1])),
+                                glm::length(glm::vec3(modelMatrix[2]))});
+        return {glm::vec3(modelMatrix * glm::vec4((min + max) * 0.5f, 1)),
+                glm::length(max - min) * 0.5f * scale};
+    }
+};
+
+/*
+ * Range of a mesh drawn with one material. Indices are relative to
+ * baseVertex, every submesh is one glDrawElementsBaseVertex. Plain data,
+ * it's stored as is in cooked mesh files.
+ */
+struct SubMesh {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    uint32_t baseVertex = 0;
+    // Index into the materials of the mesh
+    uint32_t material = 0;
+};
+
+/*
+ * Index buffer contents in the smallest type that holds all of the indices.
+ * Indices of parts are relative to their base vertex, so big meshes split
+ * into parts of at most MAX_SHORT_VERTICES vertices (see
+ * MeshOptimizer::splitForShortIndices) are stored in 16 bits too.
+ */
+struct IndexData {
+    static constexpr size_t MAX_SHORT_VERTICES = 65536;
+
+    GLenum type = GL_UNSIGNED_INT;
+    std::vector<std::byte> bytes;
+
+    static size_t sizeOf(GLenum type) {
+        return GL_UNSIGNED_SHORT == type ? sizeof(uint16_t) : sizeof(uint32_t);
+    }
+
+    static IndexData pack(std::span<const uint32_t> indices) {
+        IndexData data;
+        bool fits = std::ranges::all_of(indices, [](uint32_t idx) {
+            return idx < MAX_SHORT_VERTICES;
+        });
+        if (!fits) {
+            auto bytes = std::as_bytes(indices);
+            data.bytes.assign(bytes.begin(), bytes.end());
+            return data;
+        }
+        std::vector<uint16_t> shorts(indices.begin(), indices.end());
+        auto bytes = std::as_bytes(std::span(shorts));
+        data.type = GL_UNSIGNED_SHORT;
+        data.bytes.assign(bytes.begin(), bytes.end());
+        return data;
+    }
+
+    [[nodiscard]] size_t count() const { return bytes.size() / sizeOf(type); }
+};
+
+/*
+ * Mesh loaded into CPU memory, before it gets uploaded to the GPU.
+ *
+ * All parts of a model share the vertex and index arrays, `submeshes` says
+ * which ranges belong to which material. They are sorted by material, so
+ * the parts with the same material are drawn together. A mesh without
+ * submeshes is one part with the first material.
+ */
+struct MeshData {
+    VertexFormat format = VertexFormat::model();
+    std::vector<Vertex> vertices;
+    // `vertices` encoded in `format` when it isn't VertexFormat::model()
+    std::vector<std::byte> packedVertices;
+    std::vector<uint32_t> indices;
+    std::vector<SubMesh> submeshes;
+    std::vector<Material> materials;
+    MeshBounds bounds;
+
+    // Material of meshes that don't have any
+    static Material defaultMaterial() {
+        return {glm::vec4(0), glm::vec4(0), glm::vec4(0), 32};
+    }
+
+    [[nodiscard]] std::span<const std::byte> vertexBytes() const {
+        if (!packedVertices.empty()) {
+            return packedVertices;
+        }
+        return std::as_bytes(std::span(vertices));
+    }
+};
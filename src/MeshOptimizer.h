@@ -0,0 +1,559 @@
+#pragma once
+
+#include "Hash.h"
+#include "MeshData.h"
+#include "assertions.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+
+/*
+ * Triangle list optimisations, run on every mesh when it's imported (and so
+ * also when it's cooked):
+ *  - vertex cache: triangles are reordered with Tom Forsyth's "Linear-Speed
+ *    Vertex Cache Optimisation", which keeps reusing the vertices that were
+ *    just transformed
+ *  - overdraw: the reordered list is cut into clusters where the cache
+ *    starts over anyway, clusters facing away from the middle of the mesh
+ *    (usually the outside, which hides the rest) are drawn first. Given up
+ *    when it costs more than OVERDRAW_THRESHOLD of the cache gain.
+ *  - vertex fetch: vertices are stored in the order they are first used,
+ *    unused ones are dropped
+ *
+ * The result is measured as ACMR (average cache miss ratio, transformed
+ * vertices per triangle) with a FIFO cache of CACHE_SIZE entries, 3 is the
+ * worst, 0.5 the best for a big regular grid.
+ *
+ * Positions are read as the first 3 floats of every vertex.
+ */
+class MeshOptimizer {
+  public:
+    // Post-transform cache the ACMR is measured with
+    static constexpr size_t CACHE_SIZE = 16;
+    // Overdraw order may make the ACMR this much worse
+    static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+    static constexpr uint32_t UNUSED = UINT32_MAX;
+
+  private:
+    // region Forsyth
+    // Scoring cache, bigger than the one measured so the order doesn't
+    // depend on the exact size of the hardware one
+    static constexpr size_t SCORING_CACHE_SIZE = 32;
+    static constexpr float CACHE_DECAY_POWER = 1.5f;
+    static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+    static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+    static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+    /*
+     * Score of a vertex at `cachePosition` (-1 when it's not cached) that is
+     * still used by `remaining` triangles
+     */
+    static float vertexScore(int32_t cachePosition, uint32_t remaining) {
+        if (0 == remaining) {
+            return -1;
+        }
+        float score = 0;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                // Used by the last triangle, fixed score so the next one
+                // doesn't prefer one of its edges
+                score = LAST_TRIANGLE_SCORE;
+            } else {
+                float scale = 1.0f / (SCORING_CACHE_SIZE - 3);
+                score = std::pow(1.0f - (cachePosition - 3) * scale,
+                                 CACHE_DECAY_POWER);
+            }
+        }
+        // Vertices with few triangles left are finished first, so they
+        // don't stay behind as lone triangles
+        return score + VALENCE_BOOST_SCALE *
+                           std::pow(static_cast<float>(remaining),
+                                    -VALENCE_BOOST_POWER);
+    }
+    // endregion
+
+    static glm::vec3 position(const float *vertices, size_t stride,
+                              uint32_t vertex) {
+        const float *pos = vertices + vertex * stride;
+        return glm::vec3(pos[0], pos[1], pos[2]);
+    }
+
+    static size_t vertexCountOf(std::span<const uint32_t> indices) {
+        uint32_t max = 0;
+        for (uint32_t idx : indices) {
+            max = std::max(max, idx);
+        }
+        return indices.empty() ? 0 : max + 1;
+    }
+
+    /*
+     * Parts of `mesh`, one part with everything when it has none
+     */
+    static std::vector<SubMesh> partsOf(const MeshData &mesh) {
+        if (mesh.submeshes.empty()) {
+            return {{0, static_cast<uint32_t>(mesh.indices.size()), 0, 0}};
+        }
+        return mesh.submeshes;
+    }
+
+    static std::span<uint32_t> indicesOf(MeshData &mesh, const SubMesh &part) {
+        return std::span(mesh.indices).subspan(part.firstIndex,
+                                               part.indexCount);
+    }
+
+    /*
+     * FIFO post-transform cache, counts the vertices it had to transform
+     */
+    class CacheSimulator {
+      private:
+        std::vector<size_t> insertedAt;
+        size_t misses = CACHE_SIZE;
+
+      public:
+        explicit CacheSimulator(size_t vertexCount)
+            : insertedAt(vertexCount, 0) {}
+
+        /*
+         * Transforms the vertex, returns true on a miss
+         */
+        bool use(uint32_t vertex) {
+            if (misses - insertedAt[vertex] < CACHE_SIZE) {
+                return false;
+            }
+            insertedAt[vertex] = ++misses;
+            return true;
+        }
+
+        [[nodiscard]] size_t getMisses() const { return misses - CACHE_SIZE; }
+    };
+
+  public:
+    /*
+     * Vertices transformed for `indices` by a FIFO cache of CACHE_SIZE
+     */
+    static size_t cacheMisses(std::span<const uint32_t> indices,
+                              size_t vertexCount) {
+        CacheSimulator cache(vertexCount);
+        for (uint32_t idx : indices) {
+            DEBUG_ASSERT(idx < vertexCount);
+            cache.use(idx);
+        }
+        return cache.getMisses();
+    }
+
+    static float acmr(std::span<const uint32_t> indices, size_t vertexCount) {
+        if (indices.size() < 3) {
+            return 0;
+        }
+        return static_cast<float>(cacheMisses(indices, vertexCount)) /
+               static_cast<float>(indices.size() / 3);
+    }
+
+    /*
+     * ACMR of all parts of `mesh` together
+     */
+    static float acmr(const MeshData &mesh) {
+        size_t misses = 0;
+        size_t triangles = 0;
+        for (const auto &part : partsOf(mesh)) {
+            auto indices = std::span(mesh.indices)
+                               .subspan(part.firstIndex, part.indexCount);
+            misses += cacheMisses(indices, vertexCountOf(indices));
+            triangles += indices.size() / 3;
+        }
+        return 0 == triangles ? 0
+                              : static_cast<float>(misses) /
+                                    static_cast<float>(triangles);
+    }
+
+    /*
+     * Reorders the triangles of `indices` (a triangle list) for the
+     * post-transform vertex cache
+     */
+    static void optimizeVertexCache(std::span<uint32_t> indices,
+                                    size_t vertexCount) {
+        DEBUG_ASSERT(0 == indices.size() % 3);
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2) {
+            return;
+        }
+
+        // Triangles of every vertex, the ones not emitted yet are kept in
+        // front, there are remaining[v] of them
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (uint32_t idx : indices) {
+            DEBUG_ASSERT(idx < vertexCount);
+            remaining[idx]++;
+        }
+        std::vector<uint32_t> firstTriangle(vertexCount + 1, 0);
+        for (size_t v = 0; v < vertexCount; v++) {
+            firstTriangle[v + 1] = firstTriangle[v] + remaining[v];
+        }
+        std::vector<uint32_t> triangles(indices.size());
+        {
+            std::vector<uint32_t> filled(vertexCount, 0);
+            for (size_t i = 0; i < indices.size(); i++) {
+                uint32_t v = indices[i];
+                triangles[firstTriangle[v] + filled[v]++] =
+                    static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        std::vector<float> scores(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++) {
+            scores[v] = vertexScore(-1, remaining[v]);
+        }
+        std::vector<float> triangleScores(triangleCount, 0);
+        for (size_t i = 0; i < indices.size(); i++) {
+            triangleScores[i / 3] += scores[indices[i]];
+        }
+        std::vector<bool> emitted(triangleCount, false);
+
+        std::vector<uint32_t> ordered;
+        ordered.reserve(indices.size());
+        std::vector<uint32_t> cache;
+        std::vector<uint32_t> nextCache;
+        size_t best = std::max_element(triangleScores.begin(),
+                                       triangleScores.end()) -
+                      triangleScores.begin();
+        // Triangles before this one were all emitted
+        size_t scan = 0;
+
+        while (ordered.size() < indices.size()) {
+            if (triangleCount == best) {
+                // Nothing in the cache has triangles left, starts anywhere
+                while (emitted[scan]) {
+                    scan++;
+                }
+                best = scan;
+            }
+            emitted[best] = true;
+            nextCache.clear();
+            for (size_t c = 0; c < 3; c++) {
+                uint32_t v = indices[best * 3 + c];
+                ordered.push_back(v);
+                nextCache.push_back(v);
+                // Takes the triangle out of the live ones of the vertex
+                uint32_t *live = &triangles[firstTriangle[v]];
+                auto *it = std::find(live, live + remaining[v], best);
+                DEBUG_ASSERT(it != live + remaining[v]);
+                std::swap(*it, live[--remaining[v]]);
+            }
+            for (uint32_t v : cache) {
+                if (std::find(nextCache.begin(), nextCache.begin() + 3, v) ==
+                    nextCache.begin() + 3) {
+                    nextCache.push_back(v);
+                }
+            }
+
+            // Scores of everything that moved in or out of the cache, and of
+            // their triangles
+            float bestScore = -1;
+            best = triangleCount;
+            for (size_t i = 0; i < nextCache.size(); i++) {
+                uint32_t v = nextCache[i];
+                int32_t position = i < SCORING_CACHE_SIZE
+                                       ? static_cast<int32_t>(i)
+                                       : -1;
+                float score = vertexScore(position, remaining[v]);
+                float delta = score - scores[v];
+                scores[v] = score;
+                for (uint32_t k = 0; k < remaining[v]; k++) {
+                    uint32_t t = triangles[firstTriangle[v] + k];
+                    triangleScores[t] += delta;
+                    if (i < SCORING_CACHE_SIZE &&
+                        triangleScores[t] > bestScore) {
+                        bestScore = triangleScores[t];
+                        best = t;
+                    }
+                }
+            }
+            if (nextCache.size() > SCORING_CACHE_SIZE) {
+                nextCache.resize(SCORING_CACHE_SIZE);
+            }
+            std::swap(cache, nextCache);
+        }
+        std::copy(ordered.begin(), ordered.end(), indices.begin());
+    }
+
+    /*
+     * Reorders clusters of the (cache optimised) triangles of `indices` so
+     * that the outside of the mesh is drawn first. `vertices` have `stride`
+     * floats each.
+     */
+    static void optimizeOverdraw(std::span<uint32_t> indices,
+                                 const float *vertices, size_t stride,
+                                 size_t vertexCount) {
+        DEBUG_ASSERT_NOT_NULL(vertices);
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2) {
+            return;
+        }
+        size_t missesBefore = cacheMisses(indices, vertexCount);
+
+        // A cluster starts where the cache starts over, a triangle with 3
+        // misses, so moving clusters around costs almost nothing
+        struct Cluster {
+            size_t first = 0; // triangle
+            size_t count = 0;
+            glm::vec3 centroid = glm::vec3(0);
+            glm::vec3 normal = glm::vec3(0);
+            float sortKey = 0;
+        };
+        std::vector<Cluster> clusters;
+        CacheSimulator cache(vertexCount);
+        glm::vec3 meshCentroid(0);
+        float meshArea = 0;
+        for (size_t t = 0; t < triangleCount; t++) {
+            int misses = 0;
+            for (size_t c = 0; c < 3; c++) {
+                misses += cache.use(indices[t * 3 + c]) ? 1 : 0;
+            }
+            if (clusters.empty() || 3 == misses) {
+                clusters.push_back({t});
+            }
+            auto &cluster = clusters.back();
+            cluster.count++;
+            auto a = position(vertices, stride, indices[t * 3]);
+            auto b = position(vertices, stride, indices[t * 3 + 1]);
+            auto c = position(vertices, stride, indices[t * 3 + 2]);
+            // Length of the cross product is twice the area, both sums are
+            // weighted by the area
+            auto normal = glm::cross(b - a, c - a);
+            float area = glm::length(normal);
+            auto centroid = (a + b + c) * (area / 3.0f);
+            cluster.normal += normal;
+            cluster.centroid += centroid;
+            meshCentroid += centroid;
+            meshArea += area;
+        }
+        if (clusters.size() < 2 || meshArea <= 0) {
+            return;
+        }
+        meshCentroid = meshCentroid / meshArea;
+        for (auto &cluster : clusters) {
+            float area = glm::length(cluster.normal);
+            if (area <= 0) {
+                continue;
+            }
+            // Sum of area weighted centroids over the summed normal is not
+            // the exact centroid for curved clusters, close enough to sort
+            auto centroid = cluster.centroid / area;
+            cluster.sortKey = glm::dot(centroid - meshCentroid,
+                                       cluster.normal / area);
+        }
+        std::stable_sort(clusters.begin(), clusters.end(),
+                         [](const Cluster &a, const Cluster &b) {
+                             return a.sortKey > b.sortKey;
+                         });
+
+        std::vector<uint32_t> ordered;
+        ordered.reserve(indices.size());
+        for (const auto &cluster : clusters) {
+            auto first = indices.begin() + cluster.first * 3;
+            ordered.insert(ordered.end(), first, first + cluster.count * 3);
+        }
+        size_t missesAfter = cacheMisses(ordered, vertexCount);
+        if (missesAfter > missesBefore * OVERDRAW_THRESHOLD) {
+            return;
+        }
+        std::copy(ordered.begin(), ordered.end(), indices.begin());
+    }
+
+    /*
+     * New position of every vertex in the order they are first used by
+     * `indices`, which are rewritten to them. Unused vertices map to UNUSED.
+     */
+    static std::vector<uint32_t>
+    optimizeVertexFetch(std::span<uint32_t> indices, size_t vertexCount,
+                        size_t &usedCount) {
+        std::vector<uint32_t> remap(vertexCount, UNUSED);
+        uint32_t next = 0;
+        for (auto &idx : indices) {
+            DEBUG_ASSERT(idx < vertexCount);
+            if (UNUSED == remap[idx]) {
+                remap[idx] = next++;
+            }
+            idx = remap[idx];
+        }
+        usedCount = next;
+        return remap;
+    }
+
+    /*
+     * Runs all optimisations on every part of `mesh`, the parts keep their
+     * place in the index array. Vertices shared by parts stay shared.
+     */
+    static void optimize(MeshData &mesh) {
+        if (mesh.indices.empty()) {
+            return;
+        }
+        auto parts = partsOf(mesh);
+        float before = acmr(mesh);
+        const auto *floats = reinterpret_cast<const float *>(
+            mesh.vertices.data());
+        constexpr size_t stride = sizeof(Vertex) / sizeof(float);
+        static_assert(offsetof(Vertex, Position) == 0);
+        for (const auto &part : parts) {
+            auto indices = indicesOf(mesh, part);
+            size_t count = vertexCountOf(indices);
+            DEBUG_ASSERT(part.baseVertex + count <= mesh.vertices.size());
+            optimizeVertexCache(indices, count);
+            optimizeOverdraw(indices, floats + part.baseVertex * stride,
+                             stride, count);
+        }
+
+        // Vertex fetch over the whole buffer, indices are made absolute for
+        // it. Parts never share indices, only vertices.
+        for (const auto &part : parts) {
+            for (auto &idx : indicesOf(mesh, part)) {
+                idx += part.baseVertex;
+            }
+        }
+        size_t used = 0;
+        auto remap = optimizeVertexFetch(mesh.indices, mesh.vertices.size(),
+                                         used);
+        std::vector<Vertex> vertices(used);
+        for (size_t v = 0; v < remap.size(); v++) {
+            if (UNUSED != remap[v]) {
+                vertices[remap[v]] = mesh.vertices[v];
+            }
+        }
+        mesh.vertices = std::move(vertices);
+        // Back to relative, from the first vertex of every part
+        for (auto &part : mesh.submeshes) {
+            auto indices = indicesOf(mesh, part);
+            if (indices.empty()) {
+                continue;
+            }
+            part.baseVertex = *std::min_element(indices.begin(),
+                                                indices.end());
+            for (auto &idx : indices) {
+                idx -= part.baseVertex;
+            }
+        }
+        std::cout << "Mesh optimised, ACMR " << before << " -> " << acmr(mesh)
+                  << ", " << mesh.vertices.size() << " vertices" << std::endl;
+    }
+
+    /*
+     * Splits parts that use more than IndexData::MAX_SHORT_VERTICES vertices
+     * into pieces that don't, with their own base vertex, so the indices fit
+     * into 16 bits. Pieces keep the order of the triangles, which run after
+     * optimize() mostly use nearby vertices. Returns false and changes
+     * nothing when a single triangle spans too many vertices.
+     */
+    static bool splitForShortIndices(MeshData &mesh) {
+        constexpr uint32_t maxSpan = IndexData::MAX_SHORT_VERTICES - 1;
+        std::vector<SubMesh> pieces;
+        for (const auto &part : partsOf(mesh)) {
+            auto indices = std::span<const uint32_t>(mesh.indices)
+                               .subspan(part.firstIndex, part.indexCount);
+            SubMesh piece{part.firstIndex, 0, UINT32_MAX, part.material};
+            uint32_t max = 0;
+            for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+                auto [low, high] = std::minmax(
+                    {indices[i], indices[i + 1], indices[i + 2]});
+                low += part.baseVertex;
+                high += part.baseVertex;
+                if (high - low > maxSpan) {
+                    return false;
+                }
+                if (std::max(max, high) - std::min(piece.baseVertex, low) >
+                    maxSpan) {
+                    pieces.push_back(piece);
+                    piece = {static_cast<uint32_t>(part.firstIndex + i), 0,
+                             UINT32_MAX, part.material};
+                    max = 0;
+                }
+                piece.indexCount += 3;
+                piece.baseVertex = std::min(piece.baseVertex, low);
+                max = std::max(max, high);
+            }
+            if (0 == piece.indexCount) {
+                piece.baseVertex = part.baseVertex;
+            }
+            pieces.push_back(piece);
+        }
+        // Indices relative to the base vertex of their piece, which is also
+        // the lowest vertex of parts that weren't split
+        auto parts = partsOf(mesh);
+        for (const auto &part : parts) {
+            for (auto &idx : indicesOf(mesh, part)) {
+                idx += part.baseVertex;
+            }
+        }
+        for (const auto &piece : pieces) {
+            for (auto &idx : indicesOf(mesh, piece)) {
+                idx -= piece.baseVertex;
+            }
+        }
+        if (pieces.size() != parts.size()) {
+            std::cout << "Mesh split from " << parts.size() << " into "
+                      << pieces.size() << " parts for 16-bit indices"
+                      << std::endl;
+        }
+        mesh.submeshes = std::move(pieces);
+        return true;
+    }
+
+    /*
+     * Indexed mesh with the default material from a non-indexed triangle
+     * list (glDrawArrays(GL_TRIANGLES) data) of `stride` floats per vertex:
+     * position, normal and, when `stride` is 8, uv. Vertices with bitwise
+     * equal floats are merged. Nothing else is done, run optimize() and the
+     * rest of the import steps on it.
+     */
+    static MeshData index(std::span<const float> soup, size_t stride) {
+        DEBUG_ASSERT(6 == stride || 8 == stride);
+        DEBUG_ASSERT(0 == soup.size() % (stride * 3));
+        size_t soupCount = soup.size() / stride;
+        MeshData mesh;
+        mesh.materials.push_back(MeshData::defaultMaterial());
+        mesh.indices.reserve(soupCount);
+
+        // Open addressing, a slot holds the vertex index + 1
+        std::vector<uint32_t> slots(
+            std::bit_ceil(std::max<size_t>(soupCount * 2, 16)), 0);
+        size_t mask = slots.size() - 1;
+        // Soup position of every vertex, to compare against
+        std::vector<size_t> firstUse;
+        for (size_t i = 0; i < soupCount; i++) {
+            auto vertex = soup.subspan(i * stride, stride);
+            auto bytes = std::as_bytes(vertex);
+            size_t slot = hash::fnv1a(bytes) & mask;
+            for (;; slot = (slot + 1) & mask) {
+                if (0 == slots[slot]) {
+                    slots[slot] = static_cast<uint32_t>(firstUse.size() + 1);
+                    firstUse.push_back(i);
+                    auto &out = mesh.vertices.emplace_back();
+                    std::memset(&out, 0, sizeof(Vertex));
+                    std::memcpy(out.Position, &vertex[0], sizeof(float) * 3);
+                    std::memcpy(out.Normal, &vertex[3], sizeof(float) * 3);
+                    if (8 == stride) {
+                        std::memcpy(out.Texture, &vertex[6],
+                                    sizeof(float) * 2);
+                    }
+                    mesh.bounds.extend(
+                        glm::vec3(vertex[0], vertex[1], vertex[2]));
+                    break;
+                }
+                const float *existing =
+                    &soup[firstUse[slots[slot] - 1] * stride];
+                if (0 == std::memcmp(existing, vertex.data(), bytes.size())) {
+                    break;
+                }
+            }
+            mesh.indices.push_back(slots[slot] - 1);
+        }
+        std::cout << "Mesh indexed, " << soupCount << " -> "
+                  << mesh.vertices.size() << " vertices" << std::endl;
+        return mesh;
+    }
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "assertions.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*
+ * One mip level of an RGBA8 image, or its blocks after bc::compress
+ */
+struct ImageLevel {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+/*
+ * Builds the full mip chain (down to 1x1) of an RGBA8 image with a 2x2 box
+ * filter. Level 0 is a copy of `pixels`. Odd sizes are handled by clamping
+ * the last row/column.
+ */
+inline std::vector<ImageLevel> buildMipChain(const uint8_t *pixels, int width,
+                                             int height) {
+    DEBUG_ASSERT_NOT_NULL(pixels);
+    DEBUG_ASSERT(width > 0 && height > 0);
+    std::vector<ImageLevel> levels;
+    ImageLevel base{width, height, {}};
+    base.pixels.resize(static_cast<size_t>(width) * height * 4);
+    std::memcpy(base.pixels.data(), pixels, base.pixels.size());
+    levels.emplace_back(std::move(base));
+
+    while (levels.back().width > 1 || levels.back().height > 1) {
+        const ImageLevel &src = levels.back();
+        ImageLevel dst{std::max(1, src.width / 2), std::max(1, src.height / 2),
+                       {}};
+        dst.pixels.resize(static_cast<size_t>(dst.width) * dst.height * 4);
+        for (int y = 0; y < dst.height; y++) {
+            int y0 = std::min(y * 2, src.height - 1);
+            int y1 = std::min(y * 2 + 1, src.height - 1);
+            for (int x = 0; x < dst.width; x++) {
+                int x0 = std::min(x * 2, src.width - 1);
+                int x1 = std::min(x * 2 + 1, src.width - 1);
+                for (int c = 0; c < 4; c++) {
+                    auto at = [&](int sx, int sy) -> unsigned {
+                        return src.pixels[(static_cast<size_t>(sy) * src.width +
+                                           sx) * 4 + c];
+                    };
+                    unsigned sum = at(x0, y0) + at(x1, y0) + at(x0, y1) +
+                                   at(x1, y1);
+                    dst.pixels[(static_cast<size_t>(y) * dst.width + x) * 4 +
+                               c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+        levels.emplace_back(std::move(dst));
+    }
+    return levels;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "MeshData.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantizer.h"
+#include "assertions.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "assimp/Importer.hpp"
+#include "assimp/color4.h"
+#include "assimp/material.h"
+#include "assimp/postprocess.h"
+#include "assimp/scene.h"
+#include "assimp/types.h"
+
+#include "glm/ext/vector_float4.hpp"
+#include "glm/gtc/type_ptr.hpp"
+
+/*
+ * Model file to MeshData conversion, no GL involved, so it's used by both
+ * the engine and zpg-cook
+ */
+class ModelImporter {
+  private:
+    const static inline uint32_t importOptions =
+        aiProcess_Triangulate | aiProcess_OptimizeMeshes |
+        aiProcess_JoinIdenticalVertices | aiProcess_CalcTangentSpace;
+
+    static inline glm::vec4 aiColToGlm(const aiColor4D &col) {
+        return {col.r, col.g, col.b, col.a};
+    }
+
+    static Material readMaterial(const aiMaterial *mat) {
+        DEBUG_ASSERT_NOT_NULL(mat);
+        Material material = MeshData::defaultMaterial();
+        aiString name;
+        mat->Get(AI_MATKEY_NAME, name);
+        std::cout << "Material name: " << name.C_Str() << std::endl;
+        aiColor4D col;
+        if (AI_SUCCESS ==
+            aiGetMaterialColor(mat, AI_MATKEY_COLOR_AMBIENT, &col)) {
+            material.setAmbient(aiColToGlm(col));
+        } else {
+            UNREACHABLE("Failed to read ambinet material color")
+        }
+        if (AI_SUCCESS ==
+            aiGetMaterialColor(mat, AI_MATKEY_COLOR_DIFFUSE, &col)) {
+            material.setDiffuse(aiColToGlm(col));
+        } else {
+            UNREACHABLE("Failed to read diffuse material color")
+        }
+        if (AI_SUCCESS ==
+            aiGetMaterialColor(mat, AI_MATKEY_COLOR_SPECULAR, &col)) {
+            material.setSpecular(aiColToGlm(col));
+        } else {
+            UNREACHABLE("Failed to read specular material color")
+        }
+        return material;
+    }
+
+    static inline glm::mat4 aiMatToGlm(const aiMatrix4x4 &m) {
+        // Assimp matrices are row major
+        return glm::transpose(glm::make_mat4(&m.a1));
+    }
+
+    /*
+     * Appends `mesh` placed by `transform` as a new submesh. Vertices are
+     * transformed here, so the model is drawn with one model matrix.
+     */
+    static void appendMesh(MeshData &data, const aiMesh *mesh,
+                           const glm::mat4 &transform) {
+        auto normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+        SubMesh submesh;
+        submesh.firstIndex = static_cast<uint32_t>(data.indices.size());
+        submesh.baseVertex = static_cast<uint32_t>(data.vertices.size());
+        submesh.material = mesh->mMaterialIndex;
+
+        data.vertices.resize(data.vertices.size() + mesh->mNumVertices);
+        auto *vertices = &data.vertices[submesh.baseVertex];
+        std::memset(vertices, 0, sizeof(Vertex) * mesh->mNumVertices);
+
+        for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
+            Vertex &vertex = vertices[i];
+            if (mesh->HasPositions()) {
+                auto position =
+                    glm::vec3(transform * glm::vec4(mesh->mVertices[i].x,
+                                                    mesh->mVertices[i].y,
+                                                    mesh->mVertices[i].z, 1));
+                std::memcpy(vertex.Position, &position, sizeof(float) * 3);
+                data.bounds.extend(position);
+            }
+
+            if (mesh->HasNormals()) {
+                auto normal = glm::normalize(
+                    normalMatrix * glm::vec3(mesh->mNormals[i].x,
+                                             mesh->mNormals[i].y,
+                                             mesh->mNormals[i].z));
+                std::memcpy(vertex.Normal, &normal, sizeof(float) * 3);
+            }
+
+            if (mesh->HasTextureCoords(0)) {
+                vertex.Texture[0] = mesh->mTextureCoords[0][i].x;
+                vertex.Texture[1] = mesh->mTextureCoords[0][i].y;
+            }
+
+            if (mesh->HasTangentsAndBitangents()) {
+                auto tangent = glm::normalize(
+                    glm::mat3(transform) * glm::vec3(mesh->mTangents[i].x,
+                                                     mesh->mTangents[i].y,
+                                                     mesh->mTangents[i].z));
+                std::memcpy(vertex.Tangent, &tangent, sizeof(float) * 3);
+            }
+        }
+
+        for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
+            // Points and lines are left as they are by aiProcess_Triangulate
+            if (3 != mesh->mFaces[i].mNumIndices) {
+                continue;
+            }
+            for (unsigned int j = 0; j < 3; j++) {
+                data.indices.push_back(mesh->mFaces[i].mIndices[j]);
+            }
+        }
+        submesh.indexCount =
+            static_cast<uint32_t>(data.indices.size()) - submesh.firstIndex;
+        if (0 != submesh.indexCount) {
+            data.submeshes.push_back(submesh);
+        }
+    }
+
+    /*
+     * Flattens the node hierarchy, every mesh reference of every node
+     * becomes a submesh with the accumulated transform baked in
+     */
+    static void appendNode(MeshData &data, const aiScene *scene,
+                           const aiNode *node, const glm::mat4 &parent) {
+        auto transform = parent * aiMatToGlm(node->mTransformation);
+        for (unsigned int i = 0; i < node->mNumMeshes; i++) {
+            appendMesh(data, scene->mMeshes[node->mMeshes[i]], transform);
+        }
+        for (unsigned int i = 0; i < node->mNumChildren; i++) {
+            appendNode(data, scene, node->mChildren[i], transform);
+        }
+    }
+
+  public:
+    /*
+     * Parses a model file (anything Assimp can read) into CPU memory. Every
+     * mesh of the scene ends up in one vertex and index array, see MeshData.
+     * `extraOptions` are additional aiProcess_* flags (the cooker uses the
+     * slower optimizing ones).
+     */
+    static MeshData import(std::span<const std::byte> buf,
+                           uint32_t extraOptions = 0) {
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFileFromMemory(
+            buf.data(), buf.size(), importOptions | extraOptions);
+        DEBUG_ASSERTF(nullptr != scene, "Failed to load model");
+        DEBUG_ASSERTF(scene->mNumMeshes > 0, "Model has no meshes");
+        std::cout << "Number of meshes: " << scene->mNumMeshes
+                  << "; number of materials: " << scene->mNumMaterials
+                  << std::endl;
+        MeshData data;
+        for (unsigned int i = 0; i < scene->mNumMaterials; i++) {
+            data.materials.push_back(readMaterial(scene->mMaterials[i]));
+        }
+        if (data.materials.empty()) {
+            data.materials.push_back(MeshData::defaultMaterial());
+        }
+
+        appendNode(data, scene, scene->mRootNode, glm::mat4(1));
+        // Parts with the same material next to each other, they are drawn
+        // with one call
+        std::stable_sort(data.submeshes.begin(), data.submeshes.end(),
+                         [](const SubMesh &a, const SubMesh &b) {
+                             return a.material < b.material;
+                         });
+        MeshOptimizer::optimize(data);
+        MeshOptimizer::splitForShortIndices(data);
+        VertexQuantizer::quantize(data);
+        std::cout << "Imported " << data.submeshes.size() << " parts, "
+                  << data.vertices.size() << " vertices" << std::endl;
+        return data;
+    }
+};
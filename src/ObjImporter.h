@@ -0,0 +1,483 @@
+#pragma once
+
+#include "MeshData.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantizer.h"
+#include "ThreadPool.h"
+#include "assertions.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Wavefront OBJ reader for plain files (v, vt, vn, f, usemtl), without
+ * Assimp. Gives the same MeshData as ModelImporter does for them.
+ *
+ * The file is split into chunks at line ends, which are parsed in parallel
+ * with std::from_chars. The chunks are then joined, corners with the same
+ * position, uv and normal become one vertex (hash table) and tangents are
+ * accumulated per vertex from the uv derivatives of its triangles and made
+ * orthogonal to the normal, like Assimp's aiProcess_CalcTangentSpace.
+ * Missing normals stay zero, as they do with Assimp.
+ *
+ * Materials are in .mtl files, which an import from memory can't open (nor
+ * can Assimp's), so every usemtl gets the material Assimp makes up for a
+ * missing one. Returns empty optional for files it doesn't understand, the
+ * caller falls back to ModelImporter.
+ */
+class ObjImporter {
+  private:
+    // Smaller files are parsed on one thread
+    static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
+    static constexpr int32_t MISSING = INT32_MIN;
+
+    /*
+     * One corner of a triangle, 0 based indices. A negative index in the
+     * file counts from the end of what was read before it, the parser knows
+     * only its own chunk, so such indices are relative to the start of the
+     * chunk until the chunks are joined. Bit i of `relative` marks them.
+     */
+    struct Corner {
+        int32_t position = MISSING;
+        int32_t uv = MISSING;
+        int32_t normal = MISSING;
+        uint32_t relative = 0;
+    };
+
+    struct MaterialSwitch {
+        // First triangle of the chunk with the material
+        size_t triangle;
+        std::string name;
+    };
+
+    struct Chunk {
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec2> uvs;
+        std::vector<glm::vec3> normals;
+        // Three per triangle, polygons are split into fans
+        std::vector<Corner> corners;
+        std::vector<MaterialSwitch> materials;
+        bool failed = false;
+    };
+
+    // region Parsing
+
+    static bool isSpace(char c) { return ' ' == c || '\t' == c || '\r' == c; }
+
+    static const char *skipSpaces(const char *at, const char *end) {
+        while (at < end && isSpace(*at)) {
+            at++;
+        }
+        return at;
+    }
+
+    /*
+     * Reads `count` floats into `out`, nullptr when there aren't as many
+     */
+    static const char *parseFloats(const char *at, const char *end,
+                                   float *out, int count) {
+        for (int i = 0; i < count; i++) {
+            at = skipSpaces(at, end);
+            // from_chars doesn't take the sign
+            if (at < end && '+' == *at) {
+                at++;
+            }
+            auto [ptr, ec] = std::from_chars(at, end, out[i]);
+            if (std::errc() != ec) {
+                return nullptr;
+            }
+            at = ptr;
+        }
+        return at;
+    }
+
+    /*
+     * One of "v", "v/vt", "v//vn" or "v/vt/vn"
+     */
+    static const char *parseCorner(const char *at, const char *end,
+                                   const Chunk &chunk, Corner &corner) {
+        std::array<int32_t *, 3> values = {&corner.position, &corner.uv,
+                                           &corner.normal};
+        std::array<size_t, 3> counts = {
+            chunk.positions.size(), chunk.uvs.size(), chunk.normals.size()};
+        for (size_t i = 0; i < 3; i++) {
+            if (at < end && '/' != *at) {
+                int32_t raw = 0;
+                auto [ptr, ec] = std::from_chars(at, end, raw);
+                if (std::errc() != ec || 0 == raw) {
+                    return nullptr;
+                }
+                at = ptr;
+                if (raw > 0) {
+                    *values[i] = raw - 1;
+                } else {
+                    *values[i] = static_cast<int32_t>(counts[i]) + raw;
+                    corner.relative |= 1u << i;
+                }
+            }
+            if (2 == i || at == end || '/' != *at) {
+                break;
+            }
+            at++;
+        }
+        return MISSING == corner.position ? nullptr : at;
+    }
+
+    static void parseFace(const char *at, const char *end, Chunk &chunk,
+                          std::vector<Corner> &polygon) {
+        polygon.clear();
+        while (true) {
+            at = skipSpaces(at, end);
+            if (at == end) {
+                break;
+            }
+            Corner corner;
+            at = parseCorner(at, end, chunk, corner);
+            if (nullptr == at) {
+                chunk.failed = true;
+                return;
+            }
+            polygon.push_back(corner);
+        }
+        for (size_t i = 2; i < polygon.size(); i++) {
+            chunk.corners.push_back(polygon[0]);
+            chunk.corners.push_back(polygon[i - 1]);
+            chunk.corners.push_back(polygon[i]);
+        }
+    }
+
+    static Chunk parseChunk(std::string_view text) {
+        Chunk chunk;
+        std::vector<Corner> polygon;
+        const char *at = text.data();
+        const char *end = text.data() + text.size();
+        while (at < end && !chunk.failed) {
+            const char *lineEnd =
+                static_cast<const char *>(std::memchr(at, '\n', end - at));
+            if (nullptr == lineEnd) {
+                lineEnd = end;
+            }
+            const char *line = skipSpaces(at, lineEnd);
+            at = lineEnd + 1;
+
+            auto keywordEnd = line;
+            while (keywordEnd < lineEnd && !isSpace(*keywordEnd)) {
+                keywordEnd++;
+            }
+            auto keyword = std::string_view(line, keywordEnd - line);
+            if ("v" == keyword) {
+                glm::vec3 &position = chunk.positions.emplace_back();
+                chunk.failed = nullptr == parseFloats(keywordEnd, lineEnd,
+                                                      &position.x, 3);
+            } else if ("vt" == keyword) {
+                glm::vec2 &uv = chunk.uvs.emplace_back();
+                chunk.failed =
+                    nullptr == parseFloats(keywordEnd, lineEnd, &uv.x, 2);
+            } else if ("vn" == keyword) {
+                glm::vec3 &normal = chunk.normals.emplace_back();
+                chunk.failed =
+                    nullptr == parseFloats(keywordEnd, lineEnd, &normal.x, 3);
+            } else if ("f" == keyword) {
+                parseFace(keywordEnd, lineEnd, chunk, polygon);
+            } else if ("usemtl" == keyword) {
+                auto name = skipSpaces(keywordEnd, lineEnd);
+                auto nameEnd = lineEnd;
+                while (nameEnd > name && isSpace(nameEnd[-1])) {
+                    nameEnd--;
+                }
+                chunk.materials.push_back(
+                    {chunk.corners.size() / 3, std::string(name, nameEnd)});
+            }
+            // Everything else (comments, o, g, s, mtllib, points and lines)
+            // doesn't change the triangles
+        }
+        return chunk;
+    }
+
+    /*
+     * Splits at line ends into about `count` parts
+     */
+    static std::vector<std::string_view> split(std::string_view text,
+                                               size_t count) {
+        std::vector<std::string_view> parts;
+        size_t size = text.size() / count + 1;
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t cut = std::min(start + size, text.size());
+            cut = text.find('\n', cut);
+            cut = std::string_view::npos == cut ? text.size() : cut + 1;
+            parts.push_back(text.substr(start, cut - start));
+            start = cut;
+        }
+        return parts;
+    }
+    // endregion
+
+    // region Joining
+
+    /*
+     * Corners with equal indices share a vertex. Open addressing with
+     * linear probing, it's filled once and never shrinks.
+     */
+    class VertexTable {
+      private:
+        struct Slot {
+            Corner key;
+            uint32_t vertex = 0;
+        };
+        std::vector<Slot> slots;
+
+        static size_t hash(const Corner &key) {
+            uint64_t h = static_cast<uint32_t>(key.position);
+            h = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.uv);
+            h = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.normal);
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+
+      public:
+        explicit VertexTable(size_t maxKeys)
+            : slots(std::bit_ceil(std::max<size_t>(maxKeys * 2, 16))) {}
+
+        /*
+         * Vertex of `key`, `next` (which is then incremented) when it's new
+         */
+        uint32_t find(const Corner &key, uint32_t &next, bool &isNew) {
+            size_t mask = slots.size() - 1;
+            for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+                auto &slot = slots[i];
+                if (MISSING == slot.key.position) {
+                    slot.key = key;
+                    slot.vertex = next++;
+                    isNew = true;
+                    return slot.vertex;
+                }
+                if (slot.key.position == key.position &&
+                    slot.key.uv == key.uv && slot.key.normal == key.normal) {
+                    isNew = false;
+                    return slot.vertex;
+                }
+            }
+        }
+    };
+
+    /*
+     * What Assimp gives a usemtl whose .mtl isn't available
+     */
+    static Material missingMaterial() {
+        auto material = MeshData::defaultMaterial();
+        material.setAmbient(glm::vec4(0, 0, 0, 1));
+        material.setDiffuse(glm::vec4(0.6, 0.6, 0.6, 1));
+        material.setSpecular(glm::vec4(0, 0, 0, 1));
+        return material;
+    }
+
+    /*
+     * Tangents from the uv derivatives, summed over the triangles of every
+     * vertex and made orthogonal to its normal
+     */
+    static void computeTangents(MeshData &data) {
+        std::vector<glm::vec3> sums(data.vertices.size(), glm::vec3(0));
+        auto vec3 = [](const float *val) {
+            return glm::vec3(val[0], val[1], val[2]);
+        };
+        for (size_t i = 0; i + 2 < data.indices.size(); i += 3) {
+            const auto &v0 = data.vertices[data.indices[i]];
+            const auto &v1 = data.vertices[data.indices[i + 1]];
+            const auto &v2 = data.vertices[data.indices[i + 2]];
+            auto e1 = vec3(v1.Position) - vec3(v0.Position);
+            auto e2 = vec3(v2.Position) - vec3(v0.Position);
+            float du1 = v1.Texture[0] - v0.Texture[0];
+            float dv1 = v1.Texture[1] - v0.Texture[1];
+            float du2 = v2.Texture[0] - v0.Texture[0];
+            float dv2 = v2.Texture[1] - v0.Texture[1];
+            float det = du1 * dv2 - du2 * dv1;
+            if (std::abs(det) < 1e-12f) {
+                continue;
+            }
+            // Not normalized, bigger triangles weigh more
+            auto tangent = (e1 * dv2 - e2 * dv1) / det;
+            for (size_t j = 0; j < 3; j++) {
+                sums[data.indices[i + j]] += tangent;
+            }
+        }
+        for (size_t i = 0; i < data.vertices.size(); i++) {
+            auto &vertex = data.vertices[i];
+            auto normal = vec3(vertex.Normal);
+            auto tangent = sums[i] - normal * glm::dot(normal, sums[i]);
+            if (glm::dot(tangent, tangent) < 1e-12f) {
+                // Degenerate uvs, any direction along the surface
+                auto axis = std::abs(normal.x) < 0.9f ? glm::vec3(1, 0, 0)
+                                                      : glm::vec3(0, 1, 0);
+                tangent = glm::cross(normal, axis);
+                if (glm::dot(tangent, tangent) < 1e-12f) {
+                    continue;
+                }
+            }
+            tangent = glm::normalize(tangent);
+            std::memcpy(vertex.Tangent, &tangent, sizeof(float) * 3);
+        }
+    }
+    // endregion
+
+  public:
+    /*
+     * Parses the file, on `pool` and the calling thread when it's given
+     */
+    static std::optional<MeshData> import(std::span<const std::byte> buf,
+                                          ThreadPool *pool = nullptr) {
+        auto text = std::string_view(reinterpret_cast<const char *>(buf.data()),
+                                     buf.size());
+        size_t chunkCount = 1;
+        if (nullptr != pool) {
+            chunkCount = std::clamp<size_t>(text.size() / MIN_CHUNK_SIZE, 1,
+                                            (pool->threadCount() + 1) * 4);
+        }
+        auto parts = split(text, chunkCount);
+        std::vector<Chunk> chunks(parts.size());
+        auto parse = [&](size_t i) { chunks[i] = parseChunk(parts[i]); };
+        if (nullptr != pool && chunks.size() > 1) {
+            pool->parallelFor(chunks.size(), parse);
+        } else {
+            for (size_t i = 0; i < chunks.size(); i++) {
+                parse(i);
+            }
+        }
+
+        // Attributes of all chunks one after another, relative indices get
+        // the offset of their chunk
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec2> uvs;
+        std::vector<glm::vec3> normals;
+        std::vector<Corner> corners;
+        // Index into `materialNames` per triangle
+        std::vector<uint32_t> triangleMaterials;
+        std::vector<std::string> materialNames;
+        // Faces before the first usemtl
+        uint32_t material = UINT32_MAX;
+        for (auto &chunk : chunks) {
+            if (chunk.failed) {
+                return {};
+            }
+            std::array<int32_t, 3> offsets = {
+                static_cast<int32_t>(positions.size()),
+                static_cast<int32_t>(uvs.size()),
+                static_cast<int32_t>(normals.size())};
+            positions.insert(positions.end(), chunk.positions.begin(),
+                             chunk.positions.end());
+            uvs.insert(uvs.end(), chunk.uvs.begin(), chunk.uvs.end());
+            normals.insert(normals.end(), chunk.normals.begin(),
+                           chunk.normals.end());
+            for (auto corner : chunk.corners) {
+                if (0 != corner.relative) {
+                    std::array<int32_t *, 3> values = {
+                        &corner.position, &corner.uv, &corner.normal};
+                    for (size_t i = 0; i < 3; i++) {
+                        if (0 != (corner.relative & (1u << i))) {
+                            *values[i] += offsets[i];
+                        }
+                    }
+                    corner.relative = 0;
+                }
+                corners.push_back(corner);
+            }
+
+            auto select = [&](const std::string &name) {
+                auto it = std::ranges::find(materialNames, name);
+                material = static_cast<uint32_t>(it - materialNames.begin());
+                if (it == materialNames.end()) {
+                    materialNames.push_back(name);
+                }
+            };
+            size_t next = 0;
+            for (size_t t = 0; t < chunk.corners.size() / 3; t++) {
+                for (; next < chunk.materials.size() &&
+                       chunk.materials[next].triangle == t;
+                     next++) {
+                    select(chunk.materials[next].name);
+                }
+                if (UINT32_MAX == material) {
+                    material = 0;
+                    materialNames.emplace_back();
+                }
+                triangleMaterials.push_back(material);
+            }
+            // A usemtl after the last face of the chunk (or in a chunk
+            // without faces) is for the faces of the next one
+            for (; next < chunk.materials.size(); next++) {
+                select(chunk.materials[next].name);
+            }
+        }
+        if (corners.empty()) {
+            return {};
+        }
+        for (const auto &corner : corners) {
+            auto isValid = [](int32_t index, size_t size) {
+                return index >= 0 && static_cast<size_t>(index) < size;
+            };
+            if (!isValid(corner.position, positions.size()) ||
+                (MISSING != corner.uv && !isValid(corner.uv, uvs.size())) ||
+                (MISSING != corner.normal &&
+                 !isValid(corner.normal, normals.size()))) {
+                return {};
+            }
+        }
+
+        // Vertices in the order they are first used, indices grouped by
+        // material
+        MeshData data;
+        VertexTable table(corners.size());
+        uint32_t vertexCount = 0;
+        std::vector<std::vector<uint32_t>> indices(materialNames.size());
+        for (size_t i = 0; i < corners.size(); i++) {
+            const auto &corner = corners[i];
+            bool isNew = false;
+            uint32_t vertex = table.find(corner, vertexCount, isNew);
+            indices[triangleMaterials[i / 3]].push_back(vertex);
+            if (!isNew) {
+                continue;
+            }
+            auto &out = data.vertices.emplace_back();
+            std::memset(&out, 0, sizeof(Vertex));
+            const auto &position = positions[corner.position];
+            std::memcpy(out.Position, &position, sizeof(float) * 3);
+            data.bounds.extend(position);
+            if (MISSING != corner.uv) {
+                std::memcpy(out.Texture, &uvs[corner.uv], sizeof(float) * 2);
+            }
+            if (MISSING != corner.normal) {
+                std::memcpy(out.Normal, &normals[corner.normal],
+                            sizeof(float) * 3);
+            }
+        }
+        for (uint32_t m = 0; m < indices.size(); m++) {
+            data.materials.push_back(missingMaterial());
+            // usemtl right before another one
+            if (indices[m].empty()) {
+                continue;
+            }
+            data.submeshes.push_back(
+                {static_cast<uint32_t>(data.indices.size()),
+                 static_cast<uint32_t>(indices[m].size()), 0, m});
+            data.indices.insert(data.indices.end(), indices[m].begin(),
+                                indices[m].end());
+        }
+        // Without uvs Assimp leaves them zero too
+        if (!uvs.empty()) {
+            computeTangents(data);
+        }
+        MeshOptimizer::optimize(data);
+        MeshOptimizer::splitForShortIndices(data);
+        VertexQuantizer::quantize(data);
+        return data;
+    }
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "GLStateCache.h"
+#include "assertions.h"
+#include "gl_dsa.h"
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+/*
+ * Texture uploads staged through a pixel buffer object.
+ *
+ * glTexSubImage from client memory has to copy (or convert) all pixels
+ * before it returns. Here the pixels are copied into a freshly orphaned
+ * GL_PIXEL_UNPACK_BUFFER and the texture is filled from it, so the transfer
+ * to the texture runs asynchronously on the GPU side and the GL thread only
+ * pays for one memcpy. Orphaning (glBufferData with null) gives every upload
+ * new storage, so it never waits for the previous upload to finish.
+ *
+ * The PBO is bound only for the duration of one upload, any other pixel
+ * transfer would otherwise read from it.
+ */
+class PixelUploader {
+  private:
+    GLuint buffer = 0;
+
+    PixelUploader() = default;
+
+    /*
+     * Copies `size` bytes into fresh storage of the PBO and binds it, the
+     * following upload reads from offset 0 of it
+     */
+    void stage(const void *data, size_t size) {
+        DEBUG_ASSERT_NOT_NULL(data);
+        if (0 == buffer) {
+            buffer = gl::createBuffer();
+        }
+        gl::bufferData(buffer, size, nullptr, GL_STREAM_DRAW);
+        void *staging = gl::mapBufferRange(
+            buffer, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        std::memcpy(staging, data, size);
+        gl::unmapBuffer(buffer);
+        GLStateCache::get().bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    }
+
+  public:
+    PixelUploader(const PixelUploader &) = delete;
+    PixelUploader &operator=(const PixelUploader &) = delete;
+
+    static PixelUploader &get() {
+        static PixelUploader instance;
+        return instance;
+    }
+
+    /*
+     * Same arguments as gl::textureSubImage2D, for RGBA8 pixels
+     */
+    void upload(GLuint texture, GLenum target, GLint level, GLint face,
+                GLsizei width, GLsizei height, const void *pixels) {
+        stage(pixels, static_cast<size_t>(width) * height * 4);
+        // With a bound unpack buffer the pointer is an offset into it
+        gl::textureSubImage2D(texture, target, level, face, width, height,
+                              GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        GLStateCache::get().bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    /*
+     * Same arguments as gl::compressedTextureSubImage2D
+     */
+    void uploadCompressed(GLuint texture, GLenum target, GLint level,
+                          GLint face, GLsizei width, GLsizei height,
+                          GLenum internalFormat,
+                          std::span<const std::byte> blocks) {
+        stage(blocks.data(), blocks.size());
+        gl::compressedTextureSubImage2D(texture, target, level, face, width,
+                                        height, internalFormat,
+                                        static_cast<GLsizei>(blocks.size()),
+                                        nullptr);
+        GLStateCache::get().bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    // The buffer is not deleted, this lives until the end of the program and
+    // the GL context is gone by then
+};
@@ -0,0 +1,487 @@
+#pragma once
+
+#include "MeshData.h"
+#include "MeshOptimizer.h"
+#include "assertions.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numbers>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class PrimitiveShape : uint8_t {
+    UV_SPHERE,
+    ICOSPHERE,
+    // 24 vertices, flat faces with their own uvs
+    CUBE,
+    // 8 corners with smoothed normals and no uvs, for gizmos
+    BOX,
+    PLANE,
+    CYLINDER,
+    TORUS,
+};
+
+/*
+ * Parameters of a procedural mesh, see PrimitiveMesh. Meshes generated from
+ * equal parameters are equal, so they can be shared (GeometryRegistry).
+ */
+struct Primitive {
+    PrimitiveShape shape = PrimitiveShape::CUBE;
+    // Around the Y axis, subdivisions of the plane and the icosphere
+    uint32_t segments = 1;
+    // Along the Y axis, around the tube of the torus
+    uint32_t rings = 1;
+    // Radius of the torus tube, the ring has radius 1
+    float thickness = 0;
+
+    static Primitive uvSphere(uint32_t segments = 32, uint32_t rings = 16) {
+        return {PrimitiveShape::UV_SPHERE, segments, rings};
+    }
+
+    // 20 * 4^subdivisions triangles
+    static Primitive icosphere(uint32_t subdivisions = 2) {
+        return {PrimitiveShape::ICOSPHERE, subdivisions, 0};
+    }
+
+    static Primitive cube() { return {PrimitiveShape::CUBE, 1, 1}; }
+
+    static Primitive box() { return {PrimitiveShape::BOX, 1, 1}; }
+
+    static Primitive plane(uint32_t segments = 1) {
+        return {PrimitiveShape::PLANE, segments, segments};
+    }
+
+    static Primitive cylinder(uint32_t segments = 32) {
+        return {PrimitiveShape::CYLINDER, segments, 1};
+    }
+
+    static Primitive torus(float thickness = 0.25f, uint32_t segments = 48,
+                           uint32_t rings = 24) {
+        return {PrimitiveShape::TORUS, segments, rings, thickness};
+    }
+
+    bool operator==(const Primitive &) const = default;
+
+    /*
+     * Unique for every set of parameters, "uv-sphere 32x16"
+     */
+    [[nodiscard]] std::string name() const {
+        static constexpr const char *NAMES[] = {
+            "uv-sphere", "icosphere", "cube",  "box",
+            "plane",     "cylinder",  "torus",
+        };
+        auto name = std::string(NAMES[static_cast<size_t>(shape)]) + " " +
+                    std::to_string(segments) + "x" + std::to_string(rings);
+        if (PrimitiveShape::TORUS == shape) {
+            name += " " + std::to_string(thickness);
+        }
+        return name;
+    }
+};
+
+/*
+ * Indexed meshes of the basic shapes with normals, tangents and uvs, at any
+ * tessellation. Everything fits into the -1 to 1 cube: spheres have radius
+ * 1, the plane lies in XZ facing up, the cylinder stands on the Y axis.
+ * The tangent points along +u, the bitangent is cross(normal, tangent).
+ *
+ * The meshes go through MeshOptimizer like imported ones, but they stay in
+ * VertexFormat::model(), they are small and their positions need no
+ * transform.
+ */
+class PrimitiveMesh {
+  private:
+    static constexpr float PI = std::numbers::pi_v<float>;
+
+    static void addVertex(MeshData &mesh, const glm::vec3 &position,
+                          const glm::vec3 &normal, const glm::vec2 &uv,
+                          const glm::vec3 &tangent) {
+        Vertex vertex{};
+        for (int c = 0; c < 3; c++) {
+            vertex.Position[c] = position[c];
+            vertex.Normal[c] = normal[c];
+            vertex.Tangent[c] = tangent[c];
+        }
+        vertex.Texture[0] = uv.x;
+        vertex.Texture[1] = uv.y;
+        mesh.vertices.push_back(vertex);
+        mesh.bounds.extend(position);
+    }
+
+    static bool samePosition(const Vertex &a, const Vertex &b) {
+        return 0 == std::memcmp(a.Position, b.Position, sizeof(a.Position));
+    }
+
+    /*
+     * Triangle a, b, c unless it has no area, like the ones at the poles of
+     * a uv sphere
+     */
+    static void addTriangle(MeshData &mesh, uint32_t a, uint32_t b,
+                            uint32_t c) {
+        const auto &vertices = mesh.vertices;
+        if (samePosition(vertices[a], vertices[b]) ||
+            samePosition(vertices[b], vertices[c]) ||
+            samePosition(vertices[c], vertices[a])) {
+            return;
+        }
+        mesh.indices.insert(mesh.indices.end(), {a, b, c});
+    }
+
+    /*
+     * (columns + 1) x (rows + 1) vertices from vertexAt(mesh, u, v), u and v
+     * going from 0 to 1. The first and the last column are separate vertices
+     * so the uvs don't wrap at seams. Faces point to cross(d/du, d/dv).
+     */
+    template <typename VertexAt>
+    static void addGrid(MeshData &mesh, uint32_t columns, uint32_t rows,
+                        VertexAt vertexAt) {
+        auto first = static_cast<uint32_t>(mesh.vertices.size());
+        for (uint32_t row = 0; row <= rows; row++) {
+            for (uint32_t column = 0; column <= columns; column++) {
+                vertexAt(mesh, static_cast<float>(column) / columns,
+                         static_cast<float>(row) / rows);
+            }
+        }
+        for (uint32_t row = 0; row < rows; row++) {
+            for (uint32_t column = 0; column < columns; column++) {
+                uint32_t bottomLeft = first + row * (columns + 1) + column;
+                uint32_t topLeft = bottomLeft + columns + 1;
+                addTriangle(mesh, bottomLeft, bottomLeft + 1, topLeft + 1);
+                addTriangle(mesh, bottomLeft, topLeft + 1, topLeft);
+            }
+        }
+    }
+
+    /*
+     * Direction of +u on a sphere or a cylinder at `angle` around Y, u
+     * increases counterclockwise seen from above
+     */
+    static glm::vec3 aroundY(float angle) {
+        return {std::cos(angle), 0, -std::sin(angle)};
+    }
+
+    static glm::vec3 tangentAroundY(float angle) {
+        return {-std::sin(angle), 0, -std::cos(angle)};
+    }
+
+    static void finish(MeshData &mesh) {
+        mesh.materials.push_back(MeshData::defaultMaterial());
+        MeshOptimizer::optimize(mesh);
+    }
+
+    // region Icosphere
+
+    static uint32_t midpoint(std::vector<glm::vec3> &positions,
+                             std::unordered_map<uint64_t, uint32_t> &cache,
+                             uint32_t a, uint32_t b) {
+        uint64_t key = (static_cast<uint64_t>(std::min(a, b)) << 32) |
+                       std::max(a, b);
+        auto [it, inserted] = cache.try_emplace(
+            key, static_cast<uint32_t>(positions.size()));
+        if (inserted) {
+            positions.push_back(
+                glm::normalize((positions[a] + positions[b]) * 0.5f));
+        }
+        return it->second;
+    }
+
+    /*
+     * Triangles of the subdivided icosahedron, positions on the unit sphere
+     */
+    static std::vector<uint32_t>
+    subdividedIcosahedron(uint32_t subdivisions,
+                          std::vector<glm::vec3> &positions) {
+        const float t = (1 + std::sqrt(5.0f)) / 2;
+        for (auto corner : {glm::vec3(-1, t, 0), glm::vec3(1, t, 0),
+                            glm::vec3(-1, -t, 0), glm::vec3(1, -t, 0),
+                            glm::vec3(0, -1, t), glm::vec3(0, 1, t),
+                            glm::vec3(0, -1, -t), glm::vec3(0, 1, -t),
+                            glm::vec3(t, 0, -1), glm::vec3(t, 0, 1),
+                            glm::vec3(-t, 0, -1), glm::vec3(-t, 0, 1)}) {
+            positions.push_back(glm::normalize(corner));
+        }
+        std::vector<uint32_t> triangles = {
+            0, 11, 5,  0, 5,  1, 0, 1, 7, 0, 7,  10, 0, 10, 11,
+            1, 5,  9,  5, 11, 4, 11, 10, 2, 10, 7, 6, 7, 1,  8,
+            3, 9,  4,  3, 4,  2, 3, 2, 6, 3, 6,  8,  3, 8,  9,
+            4, 9,  5,  2, 4,  11, 6, 2, 10, 8, 6, 7, 9, 8,  1,
+        };
+        for (uint32_t level = 0; level < subdivisions; level++) {
+            std::unordered_map<uint64_t, uint32_t> cache;
+            std::vector<uint32_t> finer;
+            finer.reserve(triangles.size() * 4);
+            for (size_t i = 0; i < triangles.size(); i += 3) {
+                uint32_t a = triangles[i];
+                uint32_t b = triangles[i + 1];
+                uint32_t c = triangles[i + 2];
+                uint32_t ab = midpoint(positions, cache, a, b);
+                uint32_t bc = midpoint(positions, cache, b, c);
+                uint32_t ca = midpoint(positions, cache, c, a);
+                finer.insert(finer.end(),
+                             {a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca});
+            }
+            triangles = std::move(finer);
+        }
+        return triangles;
+    }
+
+    static float longitudeOf(const glm::vec3 &position) {
+        float u = std::atan2(-position.z, position.x) / (2 * PI);
+        return u < 0 ? u + 1 : u;
+    }
+
+    // endregion
+
+  public:
+    static MeshData uvSphere(uint32_t segments, uint32_t rings) {
+        DEBUG_ASSERT(segments >= 3 && rings >= 2);
+        MeshData mesh;
+        addGrid(mesh, segments, rings,
+                [](MeshData &mesh, float u, float v) {
+                    float angle = u * 2 * PI;
+                    float polar = (1 - v) * PI;
+                    auto normal = aroundY(angle) * std::sin(polar);
+                    normal.y = std::cos(polar);
+                    // Exactly the same pole, so its triangles are dropped
+                    if (0 == v || 1 == v) {
+                        normal = glm::vec3(0, 0 == v ? -1 : 1, 0);
+                    }
+                    addVertex(mesh, normal, normal, {u, v},
+                              tangentAroundY(angle));
+                });
+        finish(mesh);
+        return mesh;
+    }
+
+    /*
+     * Evenly tessellated sphere. The uvs are the same as the uv sphere's,
+     * triangles crossing the seam or touching a pole get their own copies
+     * of the vertices there.
+     */
+    static MeshData icosphere(uint32_t subdivisions) {
+        std::vector<glm::vec3> positions;
+        auto triangles = subdividedIcosahedron(subdivisions, positions);
+
+        MeshData mesh;
+        std::vector<uint32_t> shared(positions.size(), MeshOptimizer::UNUSED);
+        for (size_t i = 0; i < triangles.size(); i += 3) {
+            glm::vec3 corners[3];
+            float u[3];
+            bool pole[3];
+            bool shifted[3] = {};
+            for (int c = 0; c < 3; c++) {
+                corners[c] = positions[triangles[i + c]];
+                u[c] = longitudeOf(corners[c]);
+                pole[c] = std::abs(corners[c].y) > 0.99999f;
+            }
+            // Across the seam, the side near 0 continues past 1
+            float minU = 1;
+            float maxU = 0;
+            for (int c = 0; c < 3; c++) {
+                if (!pole[c]) {
+                    minU = std::min(minU, u[c]);
+                    maxU = std::max(maxU, u[c]);
+                }
+            }
+            bool seam = maxU - minU > 0.5f;
+            float poleU = 0;
+            for (int c = 0; c < 3; c++) {
+                if (seam && !pole[c] && u[c] < 0.5f) {
+                    u[c] += 1;
+                    shifted[c] = true;
+                }
+                poleU += pole[c] ? 0 : u[c] / 2;
+            }
+
+            uint32_t corner[3];
+            for (int c = 0; c < 3; c++) {
+                uint32_t &index = shared[triangles[i + c]];
+                bool own = pole[c] || shifted[c];
+                if (!own && MeshOptimizer::UNUSED != index) {
+                    corner[c] = index;
+                    continue;
+                }
+                // A pole has no longitude, it's the middle of the others
+                float cornerU = pole[c] ? poleU : u[c];
+                float v = std::acos(glm::clamp(corners[c].y, -1.0f, 1.0f));
+                corner[c] = static_cast<uint32_t>(mesh.vertices.size());
+                addVertex(mesh, corners[c], corners[c],
+                          {cornerU, 1 - v / PI},
+                          tangentAroundY(cornerU * 2 * PI));
+                if (!own) {
+                    index = corner[c];
+                }
+            }
+            mesh.indices.insert(mesh.indices.end(),
+                                {corner[0], corner[1], corner[2]});
+        }
+        finish(mesh);
+        return mesh;
+    }
+
+    /*
+     * Every face has the whole texture, the +Y face has +u along +X and +v
+     * along -Z
+     */
+    static MeshData cube() {
+        MeshData mesh;
+        for (const auto &[normal, tangent] : faces()) {
+            auto bitangent = glm::cross(normal, tangent);
+            addGrid(mesh, 1, 1, [&](MeshData &mesh, float u, float v) {
+                auto position = normal + tangent * (u * 2 - 1) +
+                                bitangent * (v * 2 - 1);
+                addVertex(mesh, position, normal, {u, v}, tangent);
+            });
+        }
+        finish(mesh);
+        return mesh;
+    }
+
+    /*
+     * The cube with shared corners, the normals point away from the middle.
+     * Only for things lit by nothing, like light gizmos.
+     */
+    static MeshData box() {
+        MeshData mesh;
+        for (uint32_t corner = 0; corner < 8; corner++) {
+            auto position = glm::vec3(corner & 1 ? 1 : -1, corner & 2 ? 1 : -1,
+                                      corner & 4 ? 1 : -1);
+            addVertex(mesh, position, glm::normalize(position), {0, 0},
+                      glm::vec3(0));
+        }
+        auto cornerOf = [](const glm::vec3 &position) {
+            return static_cast<uint32_t>((position.x > 0 ? 1 : 0) |
+                                         (position.y > 0 ? 2 : 0) |
+                                         (position.z > 0 ? 4 : 0));
+        };
+        for (const auto &[normal, tangent] : faces()) {
+            auto bitangent = glm::cross(normal, tangent);
+            uint32_t quad[4];
+            for (int i = 0; i < 4; i++) {
+                float u = i == 1 || i == 2 ? 1 : -1;
+                float v = i >= 2 ? 1 : -1;
+                quad[i] = cornerOf(normal + tangent * u + bitangent * v);
+            }
+            addTriangle(mesh, quad[0], quad[1], quad[2]);
+            addTriangle(mesh, quad[0], quad[2], quad[3]);
+        }
+        finish(mesh);
+        return mesh;
+    }
+
+    /*
+     * segments x segments quads in XZ, +u along +X and +v along -Z
+     */
+    static MeshData plane(uint32_t segments) {
+        DEBUG_ASSERT(segments >= 1);
+        MeshData mesh;
+        addGrid(mesh, segments, segments,
+                [](MeshData &mesh, float u, float v) {
+                    addVertex(mesh, glm::vec3(u * 2 - 1, 0, 1 - v * 2),
+                              glm::vec3(0, 1, 0), {u, v}, glm::vec3(1, 0, 0));
+                });
+        finish(mesh);
+        return mesh;
+    }
+
+    /*
+     * Side wraps u around once, the caps are mapped like plane() from
+     * above and below
+     */
+    static MeshData cylinder(uint32_t segments) {
+        DEBUG_ASSERT(segments >= 3);
+        MeshData mesh;
+        addGrid(mesh, segments, 1, [](MeshData &mesh, float u, float v) {
+            float angle = u * 2 * PI;
+            auto normal = aroundY(angle);
+            addVertex(mesh, normal + glm::vec3(0, v * 2 - 1, 0), normal,
+                      {u, v}, tangentAroundY(angle));
+        });
+        for (float y : {1.0f, -1.0f}) {
+            auto normal = glm::vec3(0, y, 0);
+            auto center = static_cast<uint32_t>(mesh.vertices.size());
+            addVertex(mesh, normal, normal, {0.5f, 0.5f}, glm::vec3(1, 0, 0));
+            for (uint32_t i = 0; i <= segments; i++) {
+                auto rim = aroundY(static_cast<float>(i) / segments * 2 * PI);
+                addVertex(mesh, rim + normal, normal,
+                          {(rim.x + 1) / 2, (1 - rim.z * y) / 2},
+                          glm::vec3(1, 0, 0));
+            }
+            for (uint32_t i = 0; i < segments; i++) {
+                // The rim goes counterclockwise seen from above
+                if (y > 0) {
+                    addTriangle(mesh, center, center + i + 1, center + i + 2);
+                } else {
+                    addTriangle(mesh, center, center + i + 2, center + i + 1);
+                }
+            }
+        }
+        finish(mesh);
+        return mesh;
+    }
+
+    /*
+     * Ring of radius 1 around Y, u goes around the ring and v around the
+     * tube
+     */
+    static MeshData torus(float thickness, uint32_t segments,
+                          uint32_t rings) {
+        DEBUG_ASSERT(thickness > 0 && thickness < 1);
+        DEBUG_ASSERT(segments >= 3 && rings >= 3);
+        MeshData mesh;
+        addGrid(mesh, segments, rings,
+                [thickness](MeshData &mesh, float u, float v) {
+                    float angle = u * 2 * PI;
+                    float tube = v * 2 * PI;
+                    auto outward = aroundY(angle);
+                    auto normal = outward * std::cos(tube);
+                    normal.y = std::sin(tube);
+                    addVertex(mesh, outward + normal * thickness, normal,
+                              {u, v}, tangentAroundY(angle));
+                });
+        finish(mesh);
+        return mesh;
+    }
+
+    static MeshData generate(const Primitive &primitive) {
+        switch (primitive.shape) {
+        case PrimitiveShape::UV_SPHERE:
+            return uvSphere(primitive.segments, primitive.rings);
+        case PrimitiveShape::ICOSPHERE:
+            return icosphere(primitive.segments);
+        case PrimitiveShape::CUBE:
+            return cube();
+        case PrimitiveShape::BOX:
+            return box();
+        case PrimitiveShape::PLANE:
+            return plane(primitive.segments);
+        case PrimitiveShape::CYLINDER:
+            return cylinder(primitive.segments);
+        case PrimitiveShape::TORUS:
+            return torus(primitive.thickness, primitive.segments,
+                         primitive.rings);
+        }
+        UNREACHABLE("Invalid PrimitiveShape: %u",
+                    static_cast<uint32_t>(primitive.shape));
+    }
+
+  private:
+    struct Face {
+        glm::vec3 normal;
+        glm::vec3 tangent;
+    };
+
+    static std::array<Face, 6> faces() {
+        return {{{{1, 0, 0}, {0, 0, -1}},
+                 {{-1, 0, 0}, {0, 0, 1}},
+                 {{0, 1, 0}, {1, 0, 0}},
+                 {{0, -1, 0}, {1, 0, 0}},
+                 {{0, 0, 1}, {1, 0, 0}},
+                 {{0, 0, -1}, {-1, 0, 0}}}};
+    }
+};
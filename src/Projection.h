@@ -63,6 +63,11 @@ class PerspectiveProjection : public Observer<WindowSize>,
         recalculate();
     }
 
+    [[nodiscard]] int getScreenHeight() const {
+        assertSetSize();
+        return screenHeight;
+    }
+
     [[nodiscard]] glm::mat4 getProjectionMatrix() const {
         assertSetSize();
         return projectionMatrix.projectionMatrix;
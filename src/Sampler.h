@@ -0,0 +1,82 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "assertions.h"
+#include "gl_utils.h"
+#include <algorithm>
+
+/*
+ * How texture coordinates outside 0..1 are sampled
+ */
+enum class TextureWrap {
+    CLAMP,
+    // Tiled, such textures can't share an atlas page
+    REPEAT,
+};
+
+/*
+ * Shared sampler objects.
+ *
+ * Filtering and wrapping live in a sampler bound to the texture unit instead
+ * of in every texture, so all textures get the same filtering and changing it
+ * is one object instead of a parameter per texture. Samplers are created on
+ * first use and live until the end of the program.
+ */
+class Sampler {
+  private:
+    static GLuint create(float anisotropy, TextureWrap wrap) {
+        GLint mode =
+            TextureWrap::REPEAT == wrap ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+        GLuint id = 0;
+        glGenSamplers(1, &id);
+        DEBUG_ASSERT(0 != id);
+        glSamplerParameteri(id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glSamplerParameteri(id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glSamplerParameteri(id, GL_TEXTURE_WRAP_S, mode);
+        glSamplerParameteri(id, GL_TEXTURE_WRAP_T, mode);
+        glSamplerParameteri(id, GL_TEXTURE_WRAP_R, mode);
+        if (anisotropy > 1.0f) {
+            glSamplerParameterf(id, GL_TEXTURE_MAX_ANISOTROPY, anisotropy);
+        }
+        gl::assertNoError();
+        return id;
+    }
+
+    /*
+     * Highest anisotropy the driver allows, capped at 16. 1 (off) without
+     * GL 4.6 or one of the anisotropic filtering extensions.
+     */
+    static float maxAnisotropy() {
+        if (!GLEW_VERSION_4_6 && !GLEW_ARB_texture_filter_anisotropic &&
+            !GLEW_EXT_texture_filter_anisotropic) {
+            return 1.0f;
+        }
+        float max = 1.0f;
+        glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &max);
+        return std::min(16.0f, max);
+    }
+
+  public:
+    /*
+     * Trilinear filtering, for textures seen from the front (cubemaps)
+     */
+    static GLuint trilinear() {
+        static const GLuint id = create(1.0f, TextureWrap::CLAMP);
+        return id;
+    }
+
+    /*
+     * Trilinear with anisotropic filtering, keeps surfaces seen at a steep
+     * angle (ground, walls) sharp without sampling finer mip levels
+     */
+    static GLuint anisotropic(TextureWrap wrap = TextureWrap::CLAMP) {
+        if (TextureWrap::REPEAT == wrap) {
+            static const GLuint repeating =
+                create(maxAnisotropy(), TextureWrap::REPEAT);
+            return repeating;
+        }
+        static const GLuint id = create(maxAnisotropy(), TextureWrap::CLAMP);
+        return id;
+    }
+};
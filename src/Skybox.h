@@ -24,7 +24,7 @@ class Skybox : public Observer<CameraProperties> {
     explicit Skybox(Camera &camera, const std::shared_ptr<AssetManager> am,
                     const std::string &name, const std::string &fileExt)
         : shaderSkybox(ShaderSkybox::load(am).value()),
-          cubemap(am->loadCubemap(name, fileExt)),
+          cubemap(am->loadCubemapAsync(name, fileExt)),
           translate(TransformationTranslate(glm::vec3(0))) {
         camera.attach(shaderSkybox);
         camera.projection()->attach(shaderSkybox);
@@ -52,8 +52,8 @@ class Skybox : public Observer<CameraProperties> {
 
     void render() {
         shaderSkybox->bind();
+        shaderSkybox->setCubemapId(cubemap->bind());
         shaderSkybox->modelMatrix(translate.apply(glm::mat4(1)));
-        shaderSkybox->setCubemapId(cubemap->getTextureUnit());
         cube.draw();
         shaderSkybox->unbind();
         glClear(GL_DEPTH_BUFFER_BIT);
@@ -1,57 +1,264 @@
 #pragma once
 
+#include "CookedTexture.h"
+#include "DecodedImage.h"
+#include "GLStateCache.h"
+#include "PixelUploader.h"
+#include "Sampler.h"
+#include "TextureBinder.h"
+#include "TextureFormat.h"
 #include "assertions.h"
+#include "gl_dsa.h"
 #include "gl_utils.h"
 #include <GL/gl.h>
 #include <SOIL.h>
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstring>
+#include <glm/vec4.hpp>
 #include <memory>
+#include <span>
 #include <vector>
 
+/*
+ * Number of levels of a full mip chain down to 1x1
+ */
+static inline GLsizei mipLevels(int width, int height) {
+    GLsizei levels = 1;
+    int size = std::max(width, height);
+    while (size > 1) {
+        size /= 2;
+        levels++;
+    }
+    return levels;
+}
+
+/*
+ * Uploads level `level` + `skipped` of a cooked texture into `level` of
+ * `face` of `texture`. Compressed levels go to the GPU as they are.
+ */
+static inline void uploadCookedLevel(GLuint texture, GLenum target, GLint face,
+                                     GLint level, uint32_t skipped,
+                                     const CookedTexture &cooked,
+                                     bool flippedY,
+                                     std::vector<std::byte> &scratch) {
+    auto &uploader = PixelUploader::get();
+    uint32_t cookedLevel = level + skipped;
+    int width = cooked.levelWidth(cookedLevel);
+    int height = cooked.levelHeight(cookedLevel);
+    if (texture_format::isCompressed(cooked.getFormat())) {
+        DEBUG_ASSERTF(flippedY == cooked.isFlippedY(),
+                      "Compressed texture cooked with the other row order");
+        uploader.uploadCompressed(
+            texture, target, level, face, width, height,
+            texture_format::internalFormat(cooked.getFormat()),
+            cooked.level(cookedLevel));
+        return;
+    }
+    uploader.upload(texture, target, level, face, width, height,
+                    cooked.levelPixels(cookedLevel, flippedY, scratch));
+}
+
 class Texture {
     static_assert(sizeof(GLuint) == sizeof(int));
 
   private:
     int textureId = 0;
-    uint32_t boundTextureUnit = UINT32_MAX;
+    // false while this is a placeholder for a texture that is still loading
+    bool ready = true;
+    // Region of a TextureAtlas page: uv * xy + zw, identity otherwise
+    glm::vec4 uvTransform = glm::vec4(1, 1, 0, 0);
+    // Keeps the page of an atlas region alive, the region has its id
+    std::shared_ptr<Texture> atlasPage;
+    // Size of the storage, a region has its share of the page
+    size_t gpuBytes = 0;
+    // Sampler wrapping, regions only clamp
+    TextureWrap wrap = TextureWrap::CLAMP;
 
-    Texture(int textureId, int boundTextureUnit)
-        : textureId(textureId), boundTextureUnit(boundTextureUnit) {
+    explicit Texture(int textureId) : textureId(textureId) {
         DEBUG_ASSERTF(textureId != 0, "Texture id is 0");
-        DEBUG_ASSERTF(boundTextureUnit != UINT32_MAX,
-                      "Bound texture unit is UINT32_MAX");
+    }
+
+    /*
+     * Creates the texture with storage for `levels` mip levels in
+     * `internalFormat` and calls upload(textureId, level) for the first
+     * `uploadedLevels` of them. The rest is generated.
+     */
+    template <typename UploadLevel>
+    static std::shared_ptr<Texture>
+    create(int width, int height, GLsizei levels, GLsizei uploadedLevels,
+           GLenum internalFormat, const UploadLevel &upload) {
+        // Created and filled by name, it's bound by TextureBinder at draw time
+        GLuint textureId = gl::createTexture(GL_TEXTURE_2D);
+        gl::textureStorage2D(textureId, GL_TEXTURE_2D, levels, internalFormat,
+                             width, height);
+        for (GLsizei level = 0; level < uploadedLevels; level++) {
+            upload(textureId, level);
+        }
+        if (uploadedLevels < levels) {
+            gl::generateMipmap(textureId, GL_TEXTURE_2D);
+        }
+        gl::assertNoError();
+        auto self = std::shared_ptr<Texture>(new Texture(textureId));
+        self->gpuBytes = texture_format::storageSize(internalFormat, width,
+                                                     height, levels);
+        return self;
     }
 
   public:
     Texture(Texture &) = delete;
     Texture(Texture &&other) noexcept
-        : textureId(other.textureId), boundTextureUnit(other.boundTextureUnit) {
+        : textureId(other.textureId), ready(other.ready),
+          uvTransform(other.uvTransform),
+          atlasPage(std::move(other.atlasPage)), gpuBytes(other.gpuBytes) {
         other.textureId = 0;
-        other.boundTextureUnit = UINT32_MAX;
     }
 
-    static std::shared_ptr<Texture> load(std::vector<uint8_t> buf,
-                                         size_t textureUnit) {
-        glActiveTexture(GL_TEXTURE0 + textureUnit);
-        gl::assertNoError();
-        GLuint textureId = SOIL_load_OGL_texture_from_memory(
-            buf.data(), buf.size(), SOIL_LOAD_RGBA, SOIL_CREATE_NEW_ID,
-            SOIL_FLAG_INVERT_Y);
-        if (0 == textureId) {
-            auto err = SOIL_last_result();
-            UNREACHABLE("Failed to load image: %s", err);
-        }
-        glBindTexture(GL_TEXTURE_2D, textureId);
-        auto self =
-            std::shared_ptr<Texture>(new Texture(textureId, textureUnit));
+    static std::shared_ptr<Texture> load(std::span<const std::byte> buf) {
+        return load(DecodedImage::decode(buf, true));
+    }
+
+    /*
+     * `image` has to be decoded with flipped rows. Mip levels are generated
+     * on the GPU.
+     */
+    static std::shared_ptr<Texture> load(const DecodedImage &image) {
+        return create(image.getWidth(), image.getHeight(),
+                      mipLevels(image.getWidth(), image.getHeight()), 1,
+                      GL_RGBA8, [&](GLuint textureId, GLint level) {
+                          PixelUploader::get().upload(
+                              textureId, GL_TEXTURE_2D, level, 0,
+                              image.getWidth(), image.getHeight(),
+                              image.data());
+                      });
+    }
+
+    /*
+     * Uploads pre-decoded (or block compressed) levels made by zpg-cook, no
+     * decoding at all. Compressed textures keep exactly the cooked levels,
+     * they can't be generated.
+     *
+     * Levels finer than `firstLevel` are left out, cooked level `firstLevel`
+     * becomes level 0 (see TextureStreamer).
+     */
+    static std::shared_ptr<Texture> load(const CookedTexture &cooked,
+                                         uint32_t firstLevel = 0) {
+        auto format = cooked.getFormat();
+        DEBUG_ASSERTF(texture_format::isSupported(format),
+                      "Texture format %u is not supported",
+                      static_cast<uint32_t>(format));
+        DEBUG_ASSERT(firstLevel < cooked.getLevels());
+        int width = cooked.levelWidth(firstLevel);
+        int height = cooked.levelHeight(firstLevel);
+        GLsizei uploaded = cooked.getLevels() - firstLevel;
+        GLsizei levels = texture_format::isCompressed(format)
+                             ? uploaded
+                             : mipLevels(width, height);
+        std::vector<std::byte> scratch;
+        return create(width, height, levels, uploaded,
+                      texture_format::internalFormat(format),
+                      [&](GLuint textureId, GLint level) {
+                          uploadCookedLevel(textureId, GL_TEXTURE_2D, 0, level,
+                                            firstLevel, cooked, true, scratch);
+                      });
+    }
+
+    /*
+     * Texture with uninitialized storage, filled later (TextureAtlas pages)
+     */
+    static std::shared_ptr<Texture> allocate(int width, int height,
+                                             GLsizei levels) {
+        return create(width, height, levels, levels, GL_RGBA8,
+                      [](GLuint, GLint) {});
+    }
+
+    /*
+     * Part of an atlas `page`, sampled at uv * uvTransform.xy +
+     * uvTransform.zw
+     */
+    static std::shared_ptr<Texture>
+    region(const std::shared_ptr<Texture> &page, glm::vec4 uvTransform) {
+        DEBUG_ASSERT_NOT_NULL(page);
+        auto self = std::shared_ptr<Texture>(new Texture(page->textureId));
+        self->uvTransform = uvTransform;
+        self->atlasPage = page;
+        double share = static_cast<double>(uvTransform.x) * uvTransform.y;
+        self->gpuBytes = static_cast<size_t>(page->gpuBytes * share);
         return self;
     }
 
-    [[nodiscard]] uint32_t getTextureUnit() const noexcept {
-        return boundTextureUnit;
+    /*
+     * 1x1 white texture standing in for one that is still being loaded.
+     * Shaders can sample it right away, adopt() swaps in the real texture.
+     */
+    static std::shared_ptr<Texture> placeholder() {
+        constexpr std::array<uint8_t, 4> white = {255, 255, 255, 255};
+        auto self = create(1, 1, 1, 1, GL_RGBA8,
+                           [&](GLuint textureId, GLint level) {
+                               gl::textureSubImage2D(
+                                   textureId, GL_TEXTURE_2D, level, 0, 1, 1,
+                                   GL_RGBA, GL_UNSIGNED_BYTE, white.data());
+                           });
+        self->ready = false;
+        return self;
+    }
+
+    /*
+     * Replaces the placeholder with `loaded`, `loaded` is left empty
+     */
+    void adopt(Texture &loaded) {
+        DEBUG_ASSERTF(nullptr == atlasPage, "Only placeholders adopt");
+        TextureBinder::get().forget(textureId);
+        GLStateCache::get().deleteTexture(textureId);
+        textureId = loaded.textureId;
+        uvTransform = loaded.uvTransform;
+        atlasPage = std::move(loaded.atlasPage);
+        gpuBytes = loaded.gpuBytes;
+        wrap = loaded.wrap;
+        ready = true;
+        loaded.textureId = 0;
+    }
+
+    /*
+     * Binds the texture for the next draw and returns the texture unit for
+     * the sampler uniform, see TextureBinder
+     */
+    GLuint bind() const {
+        return TextureBinder::get().bind(GL_TEXTURE_2D, textureId,
+                                         Sampler::anisotropic(wrap));
+    }
+
+    [[nodiscard]] bool isReady() const noexcept { return ready; }
+
+    /*
+     * Region of a TextureAtlas page, shares the page with other textures
+     */
+    [[nodiscard]] bool isAtlasRegion() const noexcept {
+        return nullptr != atlasPage;
+    }
+
+    void setWrap(TextureWrap mode) {
+        DEBUG_ASSERTF(!isAtlasRegion() || TextureWrap::CLAMP == mode,
+                      "Atlas regions can't repeat");
+        wrap = mode;
     }
 
     [[nodiscard]] int getTextureId() const noexcept { return textureId; }
+
+    [[nodiscard]] glm::vec4 getUvTransform() const noexcept {
+        return uvTransform;
+    }
+
+    [[nodiscard]] size_t getGpuBytes() const noexcept { return gpuBytes; }
+
+    ~Texture() {
+        // Atlas regions share the id of their page
+        if (0 != textureId && nullptr == atlasPage) {
+            TextureBinder::get().forget(textureId);
+            GLStateCache::get().deleteTexture(textureId);
+        }
+    }
 };
 
 class Cubemap {
@@ -59,53 +266,167 @@ class Cubemap {
 
   private:
     int cubemapId = 0;
-    uint32_t boundTextureUnit = UINT32_MAX;
+    // false while this is a placeholder for a cubemap that is still loading
+    bool ready = true;
+    // Size of the storage of all six faces
+    size_t gpuBytes = 0;
 
-    Cubemap(int cubemapId, int boundTextureUnit)
-        : cubemapId(cubemapId), boundTextureUnit(boundTextureUnit) {
+    explicit Cubemap(int cubemapId) : cubemapId(cubemapId) {
         DEBUG_ASSERTF(cubemapId != 0, "Cubemap id is 0");
-        DEBUG_ASSERTF(boundTextureUnit != UINT32_MAX,
-                      "Bound texture unit is UINT32_MAX");
+    }
+
+    /*
+     * Creates the cubemap with storage for `levels` mip levels in
+     * `internalFormat` and calls upload(cubemapId, face, level) for the first
+     * `uploadedLevels` levels of every face. The rest is generated.
+     */
+    template <typename UploadFace>
+    static std::shared_ptr<Cubemap>
+    create(int width, int height, GLsizei levels, GLsizei uploadedLevels,
+           GLenum internalFormat, const UploadFace &upload) {
+        GLuint cubemapId = gl::createTexture(GL_TEXTURE_CUBE_MAP);
+        gl::textureStorage2D(cubemapId, GL_TEXTURE_CUBE_MAP, levels,
+                             internalFormat, width, height);
+        for (GLint face = 0; face < 6; face++) {
+            for (GLint level = 0; level < uploadedLevels; level++) {
+                upload(cubemapId, face, level);
+            }
+        }
+        if (uploadedLevels < levels) {
+            gl::generateMipmap(cubemapId, GL_TEXTURE_CUBE_MAP);
+        }
+        GLStateCache::get().enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+        gl::assertNoError();
+        auto self = std::shared_ptr<Cubemap>(new Cubemap(cubemapId));
+        self->gpuBytes = 6 * texture_format::storageSize(internalFormat, width,
+                                                         height, levels);
+        return self;
     }
 
   public:
     Cubemap(Cubemap &) = delete;
     Cubemap(Cubemap &&other) noexcept
-        : cubemapId(other.cubemapId), boundTextureUnit(other.boundTextureUnit) {
+        : cubemapId(other.cubemapId), ready(other.ready),
+          gpuBytes(other.gpuBytes) {
         other.cubemapId = 0;
-        other.boundTextureUnit = UINT32_MAX;
     }
 
     static std::shared_ptr<Cubemap>
-    load(std::vector<uint8_t> xPosBuf, std::vector<uint8_t> xNegBuf,
-         std::vector<uint8_t> yPosBuf, std::vector<uint8_t> yNegBuf,
-         std::vector<uint8_t> zPosBuf, std::vector<uint8_t> zNegBuf,
-         size_t textureUnit) {
-        std::cout << "Loading skybox into texture unit " << textureUnit
-                  << std::endl;
-        glActiveTexture(GL_TEXTURE0 + textureUnit);
-        gl::assertNoError();
-        GLuint cubemapId = SOIL_load_OGL_cubemap_from_memory(
-            xPosBuf.data(), xPosBuf.size(), xNegBuf.data(), xNegBuf.size(),
-            yPosBuf.data(), yPosBuf.size(), yNegBuf.data(), yNegBuf.size(),
-            zPosBuf.data(), zPosBuf.size(), zNegBuf.data(), zNegBuf.size(),
-            SOIL_LOAD_RGBA, SOIL_CREATE_NEW_ID, SOIL_FLAG_MIPMAPS);
-        if (0 == cubemapId) {
-            auto err = SOIL_last_result();
-            UNREACHABLE("Failed to load cubemap: %s", err);
+    load(std::span<const std::byte> xPosBuf, std::span<const std::byte> xNegBuf,
+         std::span<const std::byte> yPosBuf, std::span<const std::byte> yNegBuf,
+         std::span<const std::byte> zPosBuf,
+         std::span<const std::byte> zNegBuf) {
+        // +X, -X, +Y, -Y, +Z, -Z, the order of GL cubemap faces
+        return load({DecodedImage::decode(xPosBuf, false),
+                     DecodedImage::decode(xNegBuf, false),
+                     DecodedImage::decode(yPosBuf, false),
+                     DecodedImage::decode(yNegBuf, false),
+                     DecodedImage::decode(zPosBuf, false),
+                     DecodedImage::decode(zNegBuf, false)});
+    }
+
+    /*
+     * Faces in +X, -X, +Y, -Y, +Z, -Z order, decoded without flipping
+     */
+    static std::shared_ptr<Cubemap>
+    load(const std::array<DecodedImage, 6> &faces) {
+        int width = faces[0].getWidth();
+        int height = faces[0].getHeight();
+        for (const auto &face : faces) {
+            DEBUG_ASSERTF(face.getWidth() == width &&
+                              face.getHeight() == height,
+                          "All cubemap faces must have the same size");
         }
-        glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
-        gl::assertNoError();
-        glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
-        gl::assertNoError();
-        auto self =
-            std::shared_ptr<Cubemap>(new Cubemap(cubemapId, textureUnit));
+
+        return create(width, height, mipLevels(width, height), 1, GL_RGBA8,
+                      [&](GLuint cubemapId, GLint face, GLint) {
+                          PixelUploader::get().upload(
+                              cubemapId, GL_TEXTURE_CUBE_MAP, 0, face, width,
+                              height, faces[face].data());
+                      });
+    }
+
+    /*
+     * Faces cooked by zpg-cook, in +X, -X, +Y, -Y, +Z, -Z order. Their mip
+     * chains are uploaded as they are.
+     */
+    static std::shared_ptr<Cubemap>
+    load(const std::array<CookedTexture, 6> &faces) {
+        int width = faces[0].getWidth();
+        int height = faces[0].getHeight();
+        uint32_t levels = faces[0].getLevels();
+        auto format = faces[0].getFormat();
+        for (const auto &face : faces) {
+            DEBUG_ASSERTF(face.getWidth() == width &&
+                              face.getHeight() == height &&
+                              face.getLevels() == levels,
+                          "All cubemap faces must have the same size");
+            DEBUG_ASSERTF(face.getFormat() == format,
+                          "All cubemap faces must have the same format");
+        }
+        DEBUG_ASSERTF(texture_format::isSupported(format),
+                      "Texture format %u is not supported",
+                      static_cast<uint32_t>(format));
+        GLsizei storageLevels = texture_format::isCompressed(format)
+                                    ? levels
+                                    : mipLevels(width, height);
+        std::vector<std::byte> scratch;
+        return create(width, height, storageLevels, levels,
+                      texture_format::internalFormat(format),
+                      [&](GLuint cubemapId, GLint face, GLint level) {
+                          uploadCookedLevel(cubemapId, GL_TEXTURE_CUBE_MAP,
+                                            face, level, 0, faces[face], false,
+                                            scratch);
+                      });
+    }
+
+    /*
+     * 1x1 grey cubemap standing in for one that is still being loaded, see
+     * Texture::placeholder
+     */
+    static std::shared_ptr<Cubemap> placeholder() {
+        constexpr std::array<uint8_t, 4> grey = {128, 128, 128, 255};
+        auto self = create(1, 1, 1, 1, GL_RGBA8,
+                           [&](GLuint cubemapId, GLint face, GLint level) {
+                               gl::textureSubImage2D(
+                                   cubemapId, GL_TEXTURE_CUBE_MAP, level, face,
+                                   1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                                   grey.data());
+                           });
+        self->ready = false;
         return self;
     }
 
-    [[nodiscard]] uint32_t getTextureUnit() const noexcept {
-        return boundTextureUnit;
+    /*
+     * Replaces the placeholder with `loaded`, `loaded` is left empty
+     */
+    void adopt(Cubemap &loaded) {
+        TextureBinder::get().forget(cubemapId);
+        GLStateCache::get().deleteTexture(cubemapId);
+        cubemapId = loaded.cubemapId;
+        gpuBytes = loaded.gpuBytes;
+        ready = true;
+        loaded.cubemapId = 0;
     }
 
+    /*
+     * See Texture::bind
+     */
+    GLuint bind() const {
+        return TextureBinder::get().bind(GL_TEXTURE_CUBE_MAP, cubemapId,
+                                         Sampler::trilinear());
+    }
+
+    [[nodiscard]] bool isReady() const noexcept { return ready; }
+
     [[nodiscard]] int getCubemapId() const noexcept { return cubemapId; }
+
+    [[nodiscard]] size_t getGpuBytes() const noexcept { return gpuBytes; }
+
+    ~Cubemap() {
+        if (0 != cubemapId) {
+            TextureBinder::get().forget(cubemapId);
+            GLStateCache::get().deleteTexture(cubemapId);
+        }
+    }
 };
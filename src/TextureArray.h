@@ -0,0 +1,148 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "CookedTexture.h"
+#include "DecodedImage.h"
+#include "GLStateCache.h"
+#include "Sampler.h"
+#include "Texture.h"
+#include "TextureBinder.h"
+#include "TextureFormat.h"
+#include "assertions.h"
+#include "gl_dsa.h"
+#include "gl_utils.h"
+#include <memory>
+#include <vector>
+
+/*
+ * GL_TEXTURE_2D_ARRAY of same-sized textures, one texture per layer.
+ *
+ * All textures of the array take one texture unit, so a batch of objects
+ * with different textures is drawn with one bind and picks its texture by
+ * layer index (a uniform or per-instance data). AssetManager pools textures
+ * of the same size and format into arrays, see loadTextureLayer.
+ *
+ * Storage is allocated up front for `capacity` layers and always has the
+ * full mip chain.
+ */
+class TextureArray {
+  private:
+    GLuint arrayId = 0;
+    int width = 0;
+    int height = 0;
+    GLenum internalFormat = GL_RGBA8;
+    GLsizei levels = 0;
+    GLsizei capacity = 0;
+    GLsizei used = 0;
+
+    TextureArray(GLuint arrayId, int width, int height, GLenum internalFormat,
+                 GLsizei levels, GLsizei capacity)
+        : arrayId(arrayId), width(width), height(height),
+          internalFormat(internalFormat), levels(levels), capacity(capacity) {
+    }
+
+    /*
+     * Takes the next free layer and calls upload(arrayId, layer, level) for
+     * the first `uploadedLevels` levels. The rest is generated.
+     */
+    template <typename UploadLevel>
+    GLint add(GLsizei uploadedLevels, const UploadLevel &upload) {
+        DEBUG_ASSERTF(!isFull(), "Texture array is full");
+        GLint layer = used++;
+        for (GLint level = 0; level < uploadedLevels; level++) {
+            upload(arrayId, layer, level);
+        }
+        // Regenerates every layer, arrays are filled at load time so it's
+        // not worth doing per layer by hand
+        if (uploadedLevels < levels) {
+            gl::generateMipmap(arrayId, GL_TEXTURE_2D_ARRAY);
+        }
+        gl::assertNoError();
+        return layer;
+    }
+
+  public:
+    TextureArray(const TextureArray &) = delete;
+    TextureArray &operator=(const TextureArray &) = delete;
+
+    static std::shared_ptr<TextureArray>
+    create(int width, int height, GLenum internalFormat, GLsizei capacity) {
+        GLint maxLayers = 0;
+        glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+        DEBUG_ASSERTF(capacity > 0 && capacity <= maxLayers,
+                      "Texture array capacity %d is not in [1, %d]", capacity,
+                      maxLayers);
+        GLsizei levels = mipLevels(width, height);
+        GLuint arrayId = gl::createTexture(GL_TEXTURE_2D_ARRAY);
+        gl::textureStorage3D(arrayId, GL_TEXTURE_2D_ARRAY, levels,
+                             internalFormat, width, height, capacity);
+        return std::shared_ptr<TextureArray>(new TextureArray(
+            arrayId, width, height, internalFormat, levels, capacity));
+    }
+
+    /*
+     * `image` has to be decoded with flipped rows and be of the array's size
+     */
+    GLint add(const DecodedImage &image) {
+        DEBUG_ASSERT(fits(image.getWidth(), image.getHeight(), GL_RGBA8));
+        return add(1, [&](GLuint arrayId, GLint layer, GLint level) {
+            PixelUploader::get().upload(arrayId, GL_TEXTURE_2D_ARRAY, level,
+                                        layer, width, height, image.data());
+        });
+    }
+
+    /*
+     * Texture cooked by zpg-cook, block compressed ones have to bring the
+     * whole chain since it can't be generated
+     */
+    GLint add(const CookedTexture &cooked) {
+        auto format = cooked.getFormat();
+        DEBUG_ASSERT(fits(cooked.getWidth(), cooked.getHeight(),
+                          texture_format::internalFormat(format)));
+        DEBUG_ASSERT(!texture_format::isCompressed(format) ||
+                     cooked.getLevels() == static_cast<uint32_t>(levels));
+        std::vector<std::byte> scratch;
+        return add(cooked.getLevels(),
+                   [&](GLuint arrayId, GLint layer, GLint level) {
+                       uploadCookedLevel(arrayId, GL_TEXTURE_2D_ARRAY, layer,
+                                         level, 0, cooked, true, scratch);
+                   });
+    }
+
+    [[nodiscard]] bool fits(int w, int h, GLenum format) const {
+        return w == width && h == height && format == internalFormat;
+    }
+
+    [[nodiscard]] bool isFull() const { return used == capacity; }
+
+    /*
+     * See Texture::bind
+     */
+    GLuint bind() const {
+        return TextureBinder::get().bind(GL_TEXTURE_2D_ARRAY, arrayId,
+                                         Sampler::anisotropic());
+    }
+
+    [[nodiscard]] GLuint getArrayId() const noexcept { return arrayId; }
+
+    ~TextureArray() {
+        if (0 != arrayId) {
+            TextureBinder::get().forget(arrayId);
+            GLStateCache::get().deleteTexture(arrayId);
+        }
+    }
+};
+
+/*
+ * One texture pooled in a TextureArray
+ */
+struct TextureLayer {
+    std::shared_ptr<TextureArray> array;
+    GLint layer = 0;
+
+    /*
+     * Binds the whole array, returns its texture unit
+     */
+    GLuint bind() const { return array->bind(); }
+};
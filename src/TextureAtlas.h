@@ -0,0 +1,218 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "MipChain.h"
+#include "Texture.h"
+#include "assertions.h"
+#include "gl_dsa.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <glm/vec4.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
+
+/*
+ * Skyline bottom-left rectangle packer.
+ *
+ * The packed area is described by its top outline (the skyline), a list of
+ * horizontal segments. A rectangle goes where its top ends lowest, ties are
+ * broken by the narrower segment, which keeps the outline flat.
+ */
+class SkylinePacker {
+  private:
+    struct Segment {
+        int x;
+        int y;
+        int width;
+    };
+
+    int width;
+    int height;
+    std::vector<Segment> skyline;
+
+    /*
+     * Lowest y a rect of `w` x `h` can sit on when its left edge is at the
+     * start of segment `i`, empty if it doesn't fit there
+     */
+    [[nodiscard]] std::optional<int> fit(size_t i, int w, int h) const {
+        int x = skyline[i].x;
+        if (x + w > width) {
+            return {};
+        }
+        int y = 0;
+        int left = w;
+        for (size_t j = i; left > 0; j++) {
+            DEBUG_ASSERT(j < skyline.size());
+            y = std::max(y, skyline[j].y);
+            left -= skyline[j].width;
+        }
+        if (y + h > height) {
+            return {};
+        }
+        return y;
+    }
+
+  public:
+    SkylinePacker(int width, int height)
+        : width(width), height(height), skyline({{0, 0, width}}) {}
+
+    /*
+     * Position of the bottom left corner of the placed rect, empty when it
+     * doesn't fit anymore
+     */
+    std::optional<std::pair<int, int>> insert(int w, int h) {
+        DEBUG_ASSERT(w > 0 && h > 0);
+        size_t best = skyline.size();
+        int bestTop = INT32_MAX;
+        int bestWidth = INT32_MAX;
+        int bestY = 0;
+        for (size_t i = 0; i < skyline.size(); i++) {
+            auto y = fit(i, w, h);
+            if (!y.has_value()) {
+                continue;
+            }
+            int top = y.value() + h;
+            if (top < bestTop ||
+                (top == bestTop && skyline[i].width < bestWidth)) {
+                best = i;
+                bestTop = top;
+                bestWidth = skyline[i].width;
+                bestY = y.value();
+            }
+        }
+        if (best == skyline.size()) {
+            return {};
+        }
+
+        int x = skyline[best].x;
+        skyline.insert(skyline.begin() + best, {x, bestTop, w});
+        // Segments under the new one are cut or removed
+        for (size_t i = best + 1; i < skyline.size();) {
+            auto &segment = skyline[i];
+            int covered = x + w - segment.x;
+            if (covered <= 0) {
+                break;
+            }
+            if (covered < segment.width) {
+                segment.x += covered;
+                segment.width -= covered;
+                break;
+            }
+            skyline.erase(skyline.begin() + i);
+        }
+        // Neighbours at the same height are merged
+        for (size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            } else {
+                i++;
+            }
+        }
+        return std::make_pair(x, bestY);
+    }
+};
+
+/*
+ * Small RGBA8 textures packed into one big texture (a page).
+ *
+ * Textures in the same page are drawn without rebinding, and with the UV
+ * transform of their region also in one instanced draw. Shaders map the
+ * texture coordinates of the model with uv * transform.xy + transform.zw.
+ *
+ * Every region has a border of PADDING texels which repeats its edge, so
+ * bilinear filtering at the edge doesn't pull in the neighbour. Regions are
+ * aligned to PADDING and the page has only the mip levels where one texel
+ * still covers at most the region with its border, so mipmaps don't bleed
+ * either.
+ */
+class TextureAtlas {
+  public:
+    static constexpr int SIZE = 2048;
+    static constexpr int PADDING = 8;
+    // Levels 0..3, a texel of level 3 is 8x8 texels of level 0
+    static constexpr GLsizei LEVELS = 4;
+    // Bigger textures don't gain anything from sharing a page
+    static constexpr int MAX_REGION_SIZE = 512;
+
+  private:
+    SkylinePacker packer;
+    std::shared_ptr<Texture> page;
+
+    static constexpr int alignUp(int val) {
+        return (val + PADDING - 1) / PADDING * PADDING;
+    }
+
+  public:
+    TextureAtlas()
+        : packer(SIZE, SIZE), page(Texture::allocate(SIZE, SIZE, LEVELS)) {
+        static_assert((1 << (LEVELS - 1)) <= PADDING);
+    }
+
+    TextureAtlas(const TextureAtlas &) = delete;
+    TextureAtlas(TextureAtlas &&) = default;
+
+    [[nodiscard]] size_t getGpuBytes() const { return page->getGpuBytes(); }
+
+    /*
+     * Regions of the page that are still alive
+     */
+    [[nodiscard]] long getRegionCount() const { return page.use_count() - 1; }
+
+    static bool isEligible(int width, int height) {
+        return width <= MAX_REGION_SIZE && height <= MAX_REGION_SIZE;
+    }
+
+    /*
+     * Copies the image (RGBA8, rows in GL order) into the page and returns a
+     * texture for its region. Empty when the page is full.
+     */
+    std::optional<std::shared_ptr<Texture>> add(const void *pixels, int width,
+                                                 int height) {
+        DEBUG_ASSERT_NOT_NULL(pixels);
+        DEBUG_ASSERT(isEligible(width, height));
+        int paddedWidth = alignUp(width + 2 * PADDING);
+        int paddedHeight = alignUp(height + 2 * PADDING);
+        auto position = packer.insert(paddedWidth, paddedHeight);
+        if (!position.has_value()) {
+            return {};
+        }
+        auto [x, y] = position.value();
+
+        // Border repeats the edge texels, the rest of the alignment too
+        const auto *src = static_cast<const uint8_t *>(pixels);
+        std::vector<uint8_t> padded(static_cast<size_t>(paddedWidth) *
+                                    paddedHeight * 4);
+        for (int py = 0; py < paddedHeight; py++) {
+            int sy = std::clamp(py - PADDING, 0, height - 1);
+            for (int px = 0; px < paddedWidth; px++) {
+                int sx = std::clamp(px - PADDING, 0, width - 1);
+                std::memcpy(
+                    &padded[(static_cast<size_t>(py) * paddedWidth + px) * 4],
+                    &src[(static_cast<size_t>(sy) * width + sx) * 4], 4);
+            }
+        }
+        // Mip levels of the region only, the rest of the page is unchanged.
+        // Regions are aligned to PADDING, so every level of the page has
+        // whole texels of them.
+        DEBUG_ASSERT(0 == x % PADDING && 0 == y % PADDING);
+        auto levels = buildMipChain(padded.data(), paddedWidth, paddedHeight);
+        GLuint pageId = page->getTextureId();
+        for (GLsizei level = 0; level < LEVELS; level++) {
+            const auto &mip = levels[level];
+            gl::textureSubRect2D(pageId, level, x >> level, y >> level,
+                                 mip.width, mip.height, GL_RGBA,
+                                 GL_UNSIGNED_BYTE, mip.pixels.data());
+        }
+
+        auto transform = glm::vec4(
+            static_cast<float>(width) / SIZE,
+            static_cast<float>(height) / SIZE,
+            static_cast<float>(x + PADDING) / SIZE,
+            static_cast<float>(y + PADDING) / SIZE);
+        return Texture::region(page, transform);
+    }
+};
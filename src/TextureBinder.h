@@ -0,0 +1,133 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "GLStateCache.h"
+#include "assertions.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Number of texture binds that went through TextureBinder during one frame.
+ * hits - the texture was already in a unit
+ * misses - it had to be bound, evicting the least recently used texture
+ */
+struct TextureBinderStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+/*
+ * Texture units used as an LRU cache.
+ *
+ * Textures don't own a texture unit. They are bound right before the draw
+ * that samples them and the binder returns the unit, which goes to the
+ * sampler uniform. A texture that is still resident is not bound again, when
+ * all units are taken the least recently used one is reused. So any number of
+ * textures can be loaded, only the textures of one draw have to fit into the
+ * units at once.
+ *
+ * Rebinds are cheapest when draws sharing textures are next to each other, so
+ * sort draws by texture id where the order doesn't matter otherwise.
+ *
+ * The last unit is left for gl::editTextureUnit.
+ */
+class TextureBinder {
+  private:
+    struct Unit {
+        GLuint texture = 0;
+        // Value of `clock` at the last bind, 0 for never
+        uint64_t lastUse = 0;
+    };
+
+    std::vector<Unit> units;
+    // texture id -> unit it's in
+    std::unordered_map<GLuint, GLuint> resident;
+    uint64_t clock = 0;
+
+    TextureBinderStats currentFrame;
+    TextureBinderStats lastFrame;
+
+    TextureBinder() {
+        GLint val = 0;
+        glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &val);
+        DEBUG_ASSERTF(val > 1, "Max texture units is %d", val);
+        units.resize(val - 1);
+    }
+
+    GLuint leastRecentlyUsed() const {
+        GLuint lru = 0;
+        for (GLuint i = 1; i < units.size(); i++) {
+            if (units[i].lastUse < units[lru].lastUse) {
+                lru = i;
+            }
+        }
+        return lru;
+    }
+
+  public:
+    TextureBinder(const TextureBinder &) = delete;
+    TextureBinder &operator=(const TextureBinder &) = delete;
+
+    static TextureBinder &get() {
+        static TextureBinder instance;
+        return instance;
+    }
+
+    /*
+     * Makes `texture` resident with `sampler` and returns its unit. The
+     * texture is passed to GLStateCache even when it's resident, in case GL
+     * unbound it (deleted id reused by a new texture), which costs nothing
+     * when it's still bound.
+     */
+    GLuint bind(GLenum target, GLuint texture, GLuint sampler) {
+        DEBUG_ASSERT(0 != texture);
+        clock++;
+        GLuint unit = 0;
+        if (auto it = resident.find(texture); it != resident.end()) {
+            unit = it->second;
+            currentFrame.hits++;
+        } else {
+            unit = leastRecentlyUsed();
+            resident.erase(units[unit].texture);
+            resident[texture] = unit;
+            units[unit].texture = texture;
+            currentFrame.misses++;
+        }
+        units[unit].lastUse = clock;
+        auto &state = GLStateCache::get();
+        state.bindTexture(unit, target, texture);
+        state.bindSampler(unit, sampler);
+        return unit;
+    }
+
+    /*
+     * Called before the texture is deleted, its unit is reused first
+     */
+    void forget(GLuint texture) {
+        auto it = resident.find(texture);
+        if (it == resident.end()) {
+            return;
+        }
+        units[it->second] = Unit();
+        resident.erase(it);
+    }
+
+    [[nodiscard]] size_t unitCount() const { return units.size(); }
+
+    // region Statistics
+
+    /*
+     * Should be called once at the start of every frame
+     */
+    void beginFrame() {
+        lastFrame = currentFrame;
+        currentFrame = TextureBinderStats();
+    }
+
+    [[nodiscard]] const TextureBinderStats &lastFrameStats() const {
+        return lastFrame;
+    }
+    // endregion
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "assertions.h"
+#include <algorithm>
+#include <cstdint>
+
+/*
+ * Pixel formats of cooked textures
+ * RGBA8 - 4 bytes per pixel
+ * BC1 - 4x4 blocks of 8 bytes, RGB with 1 bit alpha (DXT1)
+ * BC3 - 4x4 blocks of 16 bytes, RGB + smooth alpha (DXT5)
+ */
+enum class TextureFormat : uint32_t { RGBA8 = 0, BC1 = 1, BC3 = 2 };
+
+namespace texture_format {
+
+static inline bool isCompressed(TextureFormat format) {
+    return TextureFormat::RGBA8 != format;
+}
+
+/*
+ * Size of one level in bytes. Block compressed levels are padded to whole
+ * blocks, so 2x2 and 1x1 levels still take one block.
+ */
+static inline uint64_t levelSize(TextureFormat format, uint32_t width,
+                                 uint32_t height) {
+    uint64_t blocks = uint64_t((width + 3) / 4) * ((height + 3) / 4);
+    switch (format) {
+    case TextureFormat::RGBA8:
+        return uint64_t(width) * height * 4;
+    case TextureFormat::BC1:
+        return blocks * 8;
+    case TextureFormat::BC3:
+        return blocks * 16;
+    }
+    UNREACHABLE("Invalid TextureFormat: %u", static_cast<uint32_t>(format));
+}
+
+/*
+ * Internal format for glTexStorage2D
+ */
+static inline GLenum internalFormat(TextureFormat format) {
+    switch (format) {
+    case TextureFormat::RGBA8:
+        return GL_RGBA8;
+    case TextureFormat::BC1:
+        return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    case TextureFormat::BC3:
+        return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    }
+    UNREACHABLE("Invalid TextureFormat: %u", static_cast<uint32_t>(format));
+}
+
+static inline TextureFormat fromInternalFormat(GLenum internalFormat) {
+    switch (internalFormat) {
+    case GL_RGBA8:
+        return TextureFormat::RGBA8;
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+        return TextureFormat::BC1;
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+        return TextureFormat::BC3;
+    }
+    UNREACHABLE("Internal format %u has no TextureFormat", internalFormat);
+}
+
+/*
+ * Size of the storage of a texture with `levels` mip levels, for memory
+ * accounting
+ */
+static inline uint64_t storageSize(GLenum internalFormat, int width,
+                                   int height, int levels) {
+    auto format = fromInternalFormat(internalFormat);
+    uint64_t size = 0;
+    for (int level = 0; level < levels; level++) {
+        size += levelSize(format, std::max(1, width >> level),
+                          std::max(1, height >> level));
+    }
+    return size;
+}
+
+/*
+ * Block compressed formats need EXT_texture_compression_s3tc, which every
+ * desktop driver has. It only reads what GLEW found at startup, so it can
+ * be called from any thread.
+ */
+static inline bool isSupported(TextureFormat format) {
+    return !isCompressed(format) || GLEW_EXT_texture_compression_s3tc;
+}
+
+} // namespace texture_format
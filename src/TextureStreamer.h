@@ -0,0 +1,298 @@
+#pragma once
+
+#include "CookedTexture.h"
+#include "Texture.h"
+#include "assertions.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Texture mip streaming under a VRAM budget.
+ *
+ * A streamed texture starts with only its coarse levels (up to
+ * INITIAL_SIZE), which are tiny and uploaded right away. Every frame draws
+ * report how big the texture is on the screen (request()), update() turns
+ * that into the finest level worth having and decides what to stream in and
+ * what to drop:
+ *  - while over the budget, levels nobody asked for lately are dropped
+ *    first, then the finest level of the least recently used textures,
+ *    never below the initial levels
+ *  - the textures that need more detail the most are streamed in, as long
+ *    as they fit into the budget
+ *
+ * Changing the resident levels replaces the GL texture of the Texture (like
+ * adopting a placeholder) with one holding only the wanted levels, read
+ * from the cooked file. Reading happens on a loader thread, AssetManager
+ * does that part, see AssetManager::loadTextureStreamed.
+ */
+class TextureStreamer {
+  public:
+    // Largest side of the finest level a streamed texture starts with
+    static constexpr int INITIAL_SIZE = 64;
+    // Textures not requested for this many frames count as unused
+    static constexpr uint64_t UNUSED_FRAMES = 120;
+    // Stream-ins running at once, each is a loader job
+    static constexpr size_t MAX_PENDING = 4;
+
+    /*
+     * A stream-in for AssetManager to run, `level` is the new finest level
+     */
+    struct StreamIn {
+        std::shared_ptr<Texture> texture;
+        std::shared_ptr<const CookedTexture> cooked;
+        uint32_t level;
+    };
+
+  private:
+    struct Entry {
+        // The streamer doesn't keep textures alive, entries of released ones
+        // are dropped in update()
+        std::weak_ptr<Texture> texture;
+        std::shared_ptr<const CookedTexture> cooked;
+        uint32_t initialLevel = 0;
+        uint32_t residentLevel = 0;
+        // Finest level being streamed in, residentLevel when nothing is
+        uint32_t pendingLevel = 0;
+        float screenSize = 0;
+        uint64_t lastRequest = 0;
+    };
+
+    std::unordered_map<const Texture *, Entry> entries;
+    size_t budget;
+    size_t residentBytes = 0;
+    size_t pendingBytes = 0;
+    size_t pending = 0;
+    uint64_t frame = 0;
+
+    /*
+     * Bytes of the cooked levels from `level` to the coarsest
+     */
+    static size_t bytesFrom(const CookedTexture &cooked, uint32_t level) {
+        size_t bytes = 0;
+        for (uint32_t i = level; i < cooked.getLevels(); i++) {
+            bytes += cooked.level(i).size();
+        }
+        return bytes;
+    }
+
+    /*
+     * Finest level worth having when the texture covers `screenSize` pixels
+     */
+    static uint32_t levelFor(const Entry &entry, float screenSize) {
+        float size = std::max(entry.cooked->getWidth(),
+                              entry.cooked->getHeight());
+        if (screenSize <= 0) {
+            return entry.initialLevel;
+        }
+        float level = std::floor(std::log2(size / screenSize));
+        return std::clamp(static_cast<uint32_t>(std::max(0.0f, level)), 0u,
+                          entry.initialLevel);
+    }
+
+    [[nodiscard]] bool isUnused(const Entry &entry) const {
+        return frame - entry.lastRequest > UNUSED_FRAMES;
+    }
+
+    /*
+     * Replaces the GL texture with one starting at `level`, on this thread
+     */
+    void makeResident(Entry &entry, uint32_t level) {
+        auto texture = entry.texture.lock();
+        DEBUG_ASSERT_NOT_NULL(texture);
+        auto loaded = Texture::load(*entry.cooked, level);
+        texture->adopt(*loaded);
+        residentBytes -= bytesFrom(*entry.cooked, entry.residentLevel);
+        residentBytes += bytesFrom(*entry.cooked, level);
+        entry.residentLevel = level;
+        entry.pendingLevel = level;
+    }
+
+    /*
+     * Forgets textures that were released, their memory is gone with them
+     */
+    void removeReleased() {
+        std::erase_if(entries, [this](const auto &it) {
+            const auto &entry = it.second;
+            if (!entry.texture.expired()) {
+                return false;
+            }
+            residentBytes -= bytesFrom(*entry.cooked, entry.residentLevel);
+            return true;
+        });
+    }
+
+    /*
+     * Drops fine levels until the resident textures fit into the budget
+     */
+    void evict() {
+        if (residentBytes + pendingBytes <= budget) {
+            return;
+        }
+        std::vector<Entry *> candidates;
+        for (auto &[_, entry] : entries) {
+            // Pending ones are replaced when their stream-in finishes
+            if (entry.pendingLevel == entry.residentLevel &&
+                entry.residentLevel < entry.initialLevel) {
+                candidates.push_back(&entry);
+            }
+        }
+        // Unused first, then least recently used
+        std::sort(candidates.begin(), candidates.end(),
+                  [this](const Entry *a, const Entry *b) {
+                      if (isUnused(*a) != isUnused(*b)) {
+                          return isUnused(*a);
+                      }
+                      return a->lastRequest < b->lastRequest;
+                  });
+        for (auto *entry : candidates) {
+            if (residentBytes + pendingBytes <= budget) {
+                return;
+            }
+            uint32_t wanted = isUnused(*entry)
+                                  ? entry->initialLevel
+                                  : levelFor(*entry, entry->screenSize);
+            // Levels finer than needed go away, otherwise the finest one
+            uint32_t level = std::max(wanted, entry->residentLevel + 1);
+            makeResident(*entry, level);
+        }
+    }
+
+  public:
+    explicit TextureStreamer(size_t budget) : budget(budget) {}
+
+    TextureStreamer(const TextureStreamer &) = delete;
+    TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+    /*
+     * Level a texture starts with, the finest one with both sides at most
+     * INITIAL_SIZE
+     */
+    static uint32_t initialLevel(const CookedTexture &cooked) {
+        uint32_t level = 0;
+        while (level + 1 < cooked.getLevels() &&
+               std::max(cooked.levelWidth(level), cooked.levelHeight(level)) >
+                   INITIAL_SIZE) {
+            level++;
+        }
+        return level;
+    }
+
+    /*
+     * Starts streaming `texture`, which holds the levels of `cooked` from
+     * initialLevel(cooked)
+     */
+    void add(const std::shared_ptr<Texture> &texture,
+             std::shared_ptr<const CookedTexture> cooked) {
+        // A released texture might have had the same address
+        removeReleased();
+        Entry entry;
+        entry.texture = texture;
+        entry.initialLevel = initialLevel(*cooked);
+        entry.residentLevel = entry.initialLevel;
+        entry.pendingLevel = entry.initialLevel;
+        residentBytes += bytesFrom(*cooked, entry.initialLevel);
+        entry.cooked = std::move(cooked);
+        entries.emplace(texture.get(), std::move(entry));
+    }
+
+    /*
+     * Called by draws, `screenSize` is how many pixels the texture covers on
+     * the screen (see Camera::projectedSize). Textures that aren't streamed
+     * are ignored.
+     */
+    void request(const Texture &texture, float screenSize) {
+        auto it = entries.find(&texture);
+        if (it == entries.end()) {
+            return;
+        }
+        auto &entry = it->second;
+        // Several draws can use the texture, the biggest one decides
+        if (entry.lastRequest != frame) {
+            entry.screenSize = 0;
+        }
+        entry.screenSize = std::max(entry.screenSize, screenSize);
+        entry.lastRequest = frame;
+    }
+
+    /*
+     * Once per frame on the GL thread, with the requests of the previous
+     * frame. Evicts right away and returns the stream-ins to start.
+     */
+    std::vector<StreamIn> update() {
+        removeReleased();
+        evict();
+
+        std::vector<Entry *> wanting;
+        for (auto &[_, entry] : entries) {
+            if (entry.pendingLevel == entry.residentLevel && !isUnused(entry) &&
+                levelFor(entry, entry.screenSize) < entry.residentLevel) {
+                wanting.push_back(&entry);
+            }
+        }
+        // Biggest on the screen first
+        std::sort(wanting.begin(), wanting.end(),
+                  [](const Entry *a, const Entry *b) {
+                      return a->screenSize > b->screenSize;
+                  });
+        std::vector<StreamIn> started;
+        for (auto *entry : wanting) {
+            if (pending >= MAX_PENDING) {
+                break;
+            }
+            // As fine as the budget allows, one level at least
+            size_t current = bytesFrom(*entry->cooked, entry->residentLevel);
+            uint32_t level = levelFor(*entry, entry->screenSize);
+            size_t cost = bytesFrom(*entry->cooked, level) - current;
+            while (level < entry->residentLevel &&
+                   residentBytes + pendingBytes + cost > budget) {
+                level++;
+                cost = bytesFrom(*entry->cooked, level) - current;
+            }
+            if (level == entry->residentLevel) {
+                continue;
+            }
+            entry->pendingLevel = level;
+            pendingBytes += cost;
+            pending++;
+            started.push_back({entry->texture.lock(), entry->cooked, level});
+        }
+        frame++;
+        return started;
+    }
+
+    /*
+     * Called by AssetManager on the GL thread when the levels of a
+     * stream-in are read
+     */
+    void finish(const Texture &texture, uint32_t level) {
+        auto it = entries.find(&texture);
+        DEBUG_ASSERT(it != entries.end());
+        auto &entry = it->second;
+        DEBUG_ASSERT(entry.pendingLevel == level);
+        pendingBytes -= bytesFrom(*entry.cooked, level) -
+                        bytesFrom(*entry.cooked, entry.residentLevel);
+        pending--;
+        makeResident(entry, level);
+    }
+
+    void setBudget(size_t bytes) { budget = bytes; }
+
+    [[nodiscard]] size_t getBudget() const { return budget; }
+
+    [[nodiscard]] size_t getResidentBytes() const { return residentBytes; }
+
+    /*
+     * Bytes of the cooked levels kept mapped for `texture`, 0 when it isn't
+     * streamed
+     */
+    [[nodiscard]] size_t getMappedBytes(const Texture &texture) const {
+        auto it = entries.find(&texture);
+        return it == entries.end() ? 0 : bytesFrom(*it->second.cooked, 0);
+    }
+
+    [[nodiscard]] size_t size() const { return entries.size(); }
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "assertions.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Fixed number of worker threads running submitted tasks in FIFO order.
+ * Tasks must not touch GL, the context is current only on the main thread.
+ */
+class ThreadPool {
+  private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping = false;
+
+    void run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                available.wait(lock,
+                               [this]() { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+  public:
+    /*
+     * One thread is left for the main (GL) thread
+     */
+    static size_t defaultThreadCount() {
+        unsigned int cores = std::thread::hardware_concurrency();
+        return cores > 1 ? cores - 1 : 1;
+    }
+
+    explicit ThreadPool(size_t threadCount = defaultThreadCount()) {
+        DEBUG_ASSERT(0 != threadCount);
+        workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; i++) {
+            workers.emplace_back([this]() { run(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    template <typename Func>
+    std::future<std::invoke_result_t<Func>> submit(Func &&func) {
+        using Result = std::invoke_result_t<Func>;
+        // std::function has to be copyable, packaged_task is not
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            std::forward<Func>(func));
+        auto future = task->get_future();
+        {
+            std::lock_guard lock(mutex);
+            DEBUG_ASSERTF(!stopping, "Task submitted to a stopped pool");
+            tasks.emplace_back([task]() { (*task)(); });
+        }
+        available.notify_one();
+        return future;
+    }
+
+    /*
+     * Runs func(i) for i in [0, count) spread over the pool and the calling
+     * thread, returns when all of them are done. The caller works on the
+     * items too instead of only waiting, so this can be called from a task
+     * of the same pool without deadlocking.
+     */
+    template <typename Func> void parallelFor(size_t count, const Func &func) {
+        struct State {
+            size_t count;
+            const Func *func;
+            std::atomic<size_t> next = 0;
+            size_t done = 0;
+            std::mutex mutex;
+            std::condition_variable finished;
+        };
+        auto state = std::make_shared<State>(count, &func);
+        // Helpers may start after everything is done, they hold the state
+        // but touch `func` only for items they claimed
+        auto work = [state]() {
+            for (size_t i = state->next++; i < state->count;
+                 i = state->next++) {
+                (*state->func)(i);
+                std::lock_guard lock(state->mutex);
+                if (++state->done == state->count) {
+                    state->finished.notify_all();
+                }
+            }
+        };
+        size_t helpers = std::min(count, workers.size() + 1) - 1;
+        if (0 != count) {
+            {
+                std::lock_guard lock(mutex);
+                for (size_t i = 0; i < helpers; i++) {
+                    tasks.emplace_back(work);
+                }
+            }
+            available.notify_all();
+        }
+        work();
+        std::unique_lock lock(state->mutex);
+        state->finished.wait(lock,
+                             [&]() { return state->done == state->count; });
+    }
+
+    [[nodiscard]] size_t threadCount() const { return workers.size(); }
+
+    /*
+     * Finishes the queued tasks and joins the threads
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        available.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "assertions.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/*
+ * Hands work from loader threads to the GL thread.
+ *
+ * Loader threads push jobs which create the GL objects from data they have
+ * already read and decoded, the GL thread runs them in drain() once per
+ * frame for at most the given time. The queue is bounded, so the loaders
+ * stop (instead of keeping decoded images in memory) when the GL thread
+ * can't keep up.
+ */
+class UploadQueue {
+  private:
+    std::deque<std::function<void()>> jobs;
+    size_t capacity;
+    bool closed = false;
+    std::mutex mutex;
+    std::condition_variable notFull;
+
+  public:
+    explicit UploadQueue(size_t capacity = 16) : capacity(capacity) {
+        DEBUG_ASSERT(0 != capacity);
+    }
+
+    UploadQueue(const UploadQueue &) = delete;
+    UploadQueue &operator=(const UploadQueue &) = delete;
+
+    /*
+     * Called by loader threads, waits while the queue is full. Jobs pushed
+     * after close() are dropped.
+     */
+    void push(std::function<void()> job) {
+        std::unique_lock lock(mutex);
+        notFull.wait(lock,
+                     [this]() { return closed || jobs.size() < capacity; });
+        if (closed) {
+            return;
+        }
+        jobs.emplace_back(std::move(job));
+    }
+
+    /*
+     * Called by the GL thread. Runs queued jobs until the queue is empty or
+     * `budget` is spent, but always at least one, so a single big upload
+     * can't stall loading forever. Returns the number of jobs run.
+     */
+    size_t drain(std::chrono::microseconds budget) {
+        auto start = std::chrono::steady_clock::now();
+        size_t done = 0;
+        while (true) {
+            std::function<void()> job;
+            {
+                std::lock_guard lock(mutex);
+                if (jobs.empty()) {
+                    break;
+                }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            notFull.notify_one();
+            job();
+            done++;
+            if (std::chrono::steady_clock::now() - start >= budget) {
+                break;
+            }
+        }
+        return done;
+    }
+
+    /*
+     * Wakes up and releases loaders waiting in push(), the queue doesn't
+     * accept anything after this. Called before the loader threads are
+     * joined, nobody would drain the queue anymore.
+     */
+    void close() {
+        {
+            std::lock_guard lock(mutex);
+            closed = true;
+            jobs.clear();
+        }
+        notFull.notify_all();
+    }
+
+    [[nodiscard]] size_t size() {
+        std::lock_guard lock(mutex);
+        return jobs.size();
+    }
+};
@@ -0,0 +1,358 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "MeshData.h"
+#include "assertions.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <vector>
+
+/*
+ * Vertex of VertexQuantizer::modelFormat(), 20 bytes instead of 44
+ */
+struct PackedVertex {
+    // Same as PackedPositionNormal up to here
+    int16_t position[4]; // snorm16, the last one is padding
+    uint32_t normal;     // snorm 10:10:10:2
+    uint32_t tangent;    // snorm 10:10:10:2
+    uint16_t texture[2]; // half float
+};
+static_assert(sizeof(PackedVertex) == 20);
+
+/*
+ * Vertex of VertexQuantizer::positionNormalFormat(), 12 bytes instead of 24
+ */
+struct PackedPositionNormal {
+    int16_t position[4]; // snorm16, the last one is padding
+    uint32_t normal;     // snorm 10:10:10:2
+};
+static_assert(sizeof(PackedPositionNormal) == 12);
+
+/*
+ * Quantised vertex encodings, chosen per mesh at import time:
+ *  - positions are 16-bit snorm relative to the bounds of the mesh. One
+ *    scale for all axes, so the dequantisation is a uniform scale with a
+ *    translation that goes into the model matrix (see
+ *    VertexFormat::positionTransform) and the normal matrix stays right.
+ *  - normals and tangents are GL_INT_2_10_10_10_REV snorm, which the
+ *    shaders read as vec3 as they are, no decoding needed
+ *  - texture coordinates are half floats
+ *
+ * Meshes whose smallest edge would get within a few quantisation steps, or
+ * which have texture coordinates a half float can't hold precisely enough,
+ * stay in floats.
+ */
+class VertexQuantizer {
+  public:
+    // Edges have to be at least this many position steps long
+    static constexpr float MIN_EDGE_STEPS = 16;
+    // Largest texture coordinate stored as half float, the step is then
+    // 1/1024, a texel of a 1024 texture
+    static constexpr float MAX_HALF_UV = 2;
+
+  private:
+    static constexpr float SNORM16_MAX = 32767;
+    static constexpr float SNORM10_MAX = 511;
+
+    static int16_t toSnorm16(float val) {
+        return static_cast<int16_t>(
+            std::lround(std::clamp(val, -1.0f, 1.0f) * SNORM16_MAX));
+    }
+
+    static uint32_t toSnorm10(float val) {
+        auto bits = static_cast<int32_t>(
+            std::lround(std::clamp(val, -1.0f, 1.0f) * SNORM10_MAX));
+        return static_cast<uint32_t>(bits) & 0x3ff;
+    }
+
+    static float fromSnorm10(uint32_t bits) {
+        // Sign extension of the 10 bits
+        auto val = static_cast<int32_t>(bits << 22) >> 22;
+        return std::max(static_cast<float>(val) / SNORM10_MAX, -1.0f);
+    }
+
+    /*
+     * Same center and scale for positions as VertexFormat stores them
+     */
+    struct PositionRange {
+        glm::vec3 center = glm::vec3(0);
+        float scale = 1;
+    };
+
+    static PositionRange rangeOf(const MeshBounds &bounds) {
+        if (bounds.isEmpty()) {
+            return {};
+        }
+        auto half = (bounds.max - bounds.min) * 0.5f;
+        float scale = std::max({half.x, half.y, half.z});
+        return {bounds.min + half, scale > 0 ? scale : 1.0f};
+    }
+
+    /*
+     * True when no edge of the triangles is shorter than MIN_EDGE_STEPS
+     * quantisation steps. `position(i)` is the position of vertex i.
+     */
+    template <typename Position>
+    static bool keepsEdges(std::span<const uint32_t> indices,
+                           const PositionRange &range,
+                           const Position &position) {
+        float step = range.scale / SNORM16_MAX;
+        float minEdge = std::numeric_limits<float>::max();
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            for (size_t c = 0; c < 3; c++) {
+                auto a = position(indices[i + c]);
+                auto b = position(indices[i + (c + 1) % 3]);
+                float edge = glm::length(b - a);
+                // Degenerate edges are there already
+                if (edge > 0) {
+                    minEdge = std::min(minEdge, edge);
+                }
+            }
+        }
+        return minEdge >= step * MIN_EDGE_STEPS;
+    }
+
+    static void packPosition(const glm::vec3 &position,
+                             const PositionRange &range, int16_t *out) {
+        auto local = (position - range.center) / range.scale;
+        out[0] = toSnorm16(local.x);
+        out[1] = toSnorm16(local.y);
+        out[2] = toSnorm16(local.z);
+        out[3] = 0;
+    }
+
+    template <typename Packed>
+    static void setPacked(MeshData &mesh, const VertexFormat &format,
+                          const PositionRange &range,
+                          const std::vector<Packed> &packed) {
+        mesh.format = format;
+        mesh.format.positionScale = range.scale;
+        mesh.format.positionOffset[0] = range.center.x;
+        mesh.format.positionOffset[1] = range.center.y;
+        mesh.format.positionOffset[2] = range.center.z;
+        auto bytes = std::as_bytes(std::span(packed));
+        mesh.packedVertices.assign(bytes.begin(), bytes.end());
+        std::cout << "Vertices quantised, " << sizeof(Vertex) << " -> "
+                  << sizeof(Packed) << " bytes" << std::endl;
+    }
+
+    static glm::vec3 vec3(const float *val) {
+        return glm::vec3(val[0], val[1], val[2]);
+    }
+
+  public:
+    // region Encodings
+    static uint32_t packSnorm1010102(const glm::vec3 &val) {
+        return toSnorm10(val.x) | toSnorm10(val.y) << 10 |
+               toSnorm10(val.z) << 20;
+    }
+
+    static glm::vec3 unpackSnorm1010102(uint32_t bits) {
+        return glm::vec3(fromSnorm10(bits & 0x3ff),
+                         fromSnorm10(bits >> 10 & 0x3ff),
+                         fromSnorm10(bits >> 20 & 0x3ff));
+    }
+
+    /*
+     * IEEE 754 binary16, rounded to nearest, too big values become infinity
+     */
+    static uint16_t toHalf(float val) {
+        auto bits = std::bit_cast<uint32_t>(val);
+        auto sign = static_cast<uint16_t>(bits >> 16 & 0x8000);
+        int32_t exponent = static_cast<int32_t>(bits >> 23 & 0xff) - 127 + 15;
+        uint32_t mantissa = bits & 0x7fffff;
+        if (std::isnan(val)) {
+            return sign | 0x7e00;
+        }
+        if (exponent >= 31) {
+            return sign | 0x7c00;
+        }
+        if (exponent <= 0) {
+            // Subnormal or zero
+            if (exponent < -10) {
+                return sign;
+            }
+            mantissa |= 0x800000;
+            uint32_t shift = 14 - exponent;
+            uint32_t half = mantissa >> shift;
+            uint32_t rest = mantissa & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+            if (rest > halfway || (rest == halfway && (half & 1))) {
+                half++;
+            }
+            return sign | static_cast<uint16_t>(half);
+        }
+        uint32_t half = static_cast<uint32_t>(exponent) << 10 | mantissa >> 13;
+        uint32_t rest = mantissa & 0x1fff;
+        // Carry into the exponent is right, up to infinity
+        if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+            half++;
+        }
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    static float fromHalf(uint16_t half) {
+        uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+        uint32_t exponent = half >> 10 & 0x1f;
+        uint32_t mantissa = half & 0x3ff;
+        if (0 == exponent) {
+            float val = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign ? -val : val;
+        }
+        if (31 == exponent) {
+            return std::bit_cast<float>(sign | 0x7f800000 | mantissa << 13);
+        }
+        return std::bit_cast<float>(sign | (exponent + 127 - 15) << 23 |
+                                    mantissa << 13);
+    }
+    // endregion
+
+    /*
+     * Format of PackedVertex, position dequantisation is set by pack()
+     */
+    static VertexFormat modelFormat() {
+        VertexFormat format;
+        format.stride = sizeof(PackedVertex);
+        format.attributeCount = 4;
+        format.attributes[0] = {0, 3, GL_SHORT, GL_TRUE,
+                                offsetof(PackedVertex, position)};
+        format.attributes[1] = {1, 4, GL_INT_2_10_10_10_REV, GL_TRUE,
+                                offsetof(PackedVertex, normal)};
+        format.attributes[2] = {2, 2, GL_HALF_FLOAT, GL_FALSE,
+                                offsetof(PackedVertex, texture)};
+        format.attributes[3] = {3, 4, GL_INT_2_10_10_10_REV, GL_TRUE,
+                                offsetof(PackedVertex, tangent)};
+        return format;
+    }
+
+    /*
+     * Format of PackedPositionNormal
+     */
+    static VertexFormat positionNormalFormat() {
+        VertexFormat format;
+        format.stride = sizeof(PackedPositionNormal);
+        format.attributeCount = 2;
+        format.attributes[0] = {0, 3, GL_SHORT, GL_TRUE,
+                                offsetof(PackedPositionNormal, position)};
+        format.attributes[1] = {1, 4, GL_INT_2_10_10_10_REV, GL_TRUE,
+                                offsetof(PackedPositionNormal, normal)};
+        return format;
+    }
+
+    /*
+     * Encodes the vertices of `mesh` into PackedVertex when they fit, or
+     * PackedPositionNormal when they have neither texture coordinates nor
+     * tangents. Otherwise leaves the mesh as it is. Returns true when it's
+     * packed.
+     */
+    static bool quantize(MeshData &mesh) {
+        if (mesh.vertices.empty()) {
+            return false;
+        }
+        for (const auto &vertex : mesh.vertices) {
+            if (std::abs(vertex.Texture[0]) > MAX_HALF_UV ||
+                std::abs(vertex.Texture[1]) > MAX_HALF_UV) {
+                return false;
+            }
+        }
+        auto range = rangeOf(mesh.bounds);
+        // Every part separately, their indices are relative
+        auto parts = mesh.submeshes;
+        if (parts.empty()) {
+            parts.push_back(
+                {0, static_cast<uint32_t>(mesh.indices.size()), 0, 0});
+        }
+        for (const auto &part : parts) {
+            auto indices = std::span(mesh.indices)
+                               .subspan(part.firstIndex, part.indexCount);
+            const auto *base = &mesh.vertices[part.baseVertex];
+            if (!keepsEdges(indices, range, [&](uint32_t i) {
+                    return vec3(base[i].Position);
+                })) {
+                return false;
+            }
+        }
+
+        bool textured = std::ranges::any_of(mesh.vertices, [](const Vertex &v) {
+            return 0 != v.Texture[0] || 0 != v.Texture[1] ||
+                   0 != v.Tangent[0] || 0 != v.Tangent[1] ||
+                   0 != v.Tangent[2];
+        });
+        if (!textured) {
+            std::vector<PackedPositionNormal> packed(mesh.vertices.size());
+            for (size_t i = 0; i < packed.size(); i++) {
+                const auto &vertex = mesh.vertices[i];
+                packPosition(vec3(vertex.Position), range, packed[i].position);
+                packed[i].normal = packSnorm1010102(vec3(vertex.Normal));
+            }
+            setPacked(mesh, positionNormalFormat(), range, packed);
+            return true;
+        }
+
+        std::vector<PackedVertex> packed(mesh.vertices.size());
+        for (size_t i = 0; i < packed.size(); i++) {
+            const auto &vertex = mesh.vertices[i];
+            auto &out = packed[i];
+            packPosition(vec3(vertex.Position), range, out.position);
+            out.normal = packSnorm1010102(vec3(vertex.Normal));
+            out.tangent = packSnorm1010102(vec3(vertex.Tangent));
+            out.texture[0] = toHalf(vertex.Texture[0]);
+            out.texture[1] = toHalf(vertex.Texture[1]);
+        }
+        setPacked(mesh, modelFormat(), range, packed);
+        return true;
+    }
+
+    /*
+     * Back to Vertex with model space positions, for code that needs floats
+     * (MeshPool). `bytes` are vertices in modelFormat(),
+     * positionNormalFormat() or VertexFormat::model().
+     */
+    static std::vector<Vertex> unpack(const VertexFormat &format,
+                                      std::span<const std::byte> bytes) {
+        std::vector<Vertex> vertices(bytes.size() / format.stride);
+        if (format.stride == sizeof(Vertex)) {
+            std::memcpy(vertices.data(), bytes.data(),
+                        vertices.size() * sizeof(Vertex));
+            return vertices;
+        }
+        bool textured = format.stride == sizeof(PackedVertex);
+        DEBUG_ASSERTF(textured || format.stride == sizeof(PackedPositionNormal),
+                      "Unknown vertex format, stride %u", format.stride);
+        auto offset = vec3(format.positionOffset);
+        for (size_t i = 0; i < vertices.size(); i++) {
+            const auto *in = &bytes[i * format.stride];
+            auto &out = vertices[i];
+            // PackedVertex starts with a PackedPositionNormal
+            PackedPositionNormal head;
+            std::memcpy(&head, in, sizeof(head));
+            auto normal = unpackSnorm1010102(head.normal);
+            for (int c = 0; c < 3; c++) {
+                float local = std::max(head.position[c] / SNORM16_MAX, -1.0f);
+                out.Position[c] = local * format.positionScale + offset[c];
+                out.Normal[c] = normal[c];
+            }
+            if (!textured) {
+                continue;
+            }
+            PackedVertex full;
+            std::memcpy(&full, in, sizeof(full));
+            auto tangent = unpackSnorm1010102(full.tangent);
+            for (int c = 0; c < 3; c++) {
+                out.Tangent[c] = tangent[c];
+            }
+            out.Texture[0] = fromHalf(full.texture[0]);
+            out.Texture[1] = fromHalf(full.texture[1]);
+        }
+        return vertices;
+    }
+};
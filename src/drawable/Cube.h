@@ -5,73 +5,26 @@
 #pragma once
 
 #include "Drawable.h"
+#include "DynamicModel.h"
+#include "GeometryRegistry.h"
 #include "../assertions.h"
+#include <memory>
 
+/*
+ * Cube from -1 to 1, generated by PrimitiveMesh and shared by all cubes of
+ * the same kind through GeometryRegistry. Primitive::box() is the 8 vertex
+ * one for light gizmos.
+ */
 class Cube: public Drawable {
 private:
-    static inline const GLfloat data[] = {
-            -1.0f,-1.0f,-1.0f, 1, 1, 1,
-            -1.0f,-1.0f, 1.0f, 1, 1, 1,
-            -1.0f, 1.0f, 1.0f, 1, 1, 1,
-            1.0f, 1.0f,-1.0f, 1, 1, 1,
-            -1.0f,-1.0f,-1.0f, 1, 1, 1,
-            -1.0f, 1.0f,-1.0f, 1, 1, 1,
-            1.0f,-1.0f, 1.0f, 1, 1, 1,
-            -1.0f,-1.0f,-1.0f, 1, 1, 1,
-            1.0f,-1.0f,-1.0f, 1, 1, 1,
-            1.0f, 1.0f,-1.0f, 1, 1, 1,
-            1.0f,-1.0f,-1.0f, 1, 1, 1,
-            -1.0f,-1.0f,-1.0f, 1, 1, 1,
-            -1.0f,-1.0f,-1.0f, 1, 1, 1,
-            -1.0f, 1.0f, 1.0f, 1, 1, 1,
-            -1.0f, 1.0f,-1.0f, 1, 1, 1,
-            1.0f,-1.0f, 1.0f, 1, 1, 1,
-            -1.0f,-1.0f, 1.0f, 1, 1, 1,
-            -1.0f,-1.0f,-1.0f, 1, 1, 1,
-            -1.0f, 1.0f, 1.0f, 1, 1, 1,
-            -1.0f,-1.0f, 1.0f, 1, 1, 1,
-            1.0f,-1.0f, 1.0f, 1, 1, 1,
-            1.0f, 1.0f, 1.0f, 1, 1, 1,
-            1.0f,-1.0f,-1.0f, 1, 1, 1,
-            1.0f, 1.0f,-1.0f, 1, 1, 1,
-            1.0f,-1.0f,-1.0f, 1, 1, 1,
-            1.0f, 1.0f, 1.0f, 1, 1, 1,
-            1.0f,-1.0f, 1.0f, 1, 1, 1,
-            1.0f, 1.0f, 1.0f, 1, 1, 1,
-            1.0f, 1.0f,-1.0f, 1, 1, 1,
-            -1.0f, 1.0f,-1.0f, 1, 1, 1,
-            1.0f, 1.0f, 1.0f, 1, 1, 1,
-            -1.0f, 1.0f,-1.0f, 1, 1, 1,
-            -1.0f, 1.0f, 1.0f, 1, 1, 1,
-            1.0f, 1.0f, 1.0f, 1, 1, 1,
-            -1.0f, 1.0f, 1.0f, 1, 1, 1,
-            1.0f,-1.0f, 1.0f,  1, 1, 1
-    };
-
-    GLuint vbo = 0;
-    GLuint vao = 0;
+    std::shared_ptr<DynamicModel> model;
 public:
-    Cube() {
-        //vertex buffer object (VBO)
-        glGenBuffers(1, &vbo); // generate the VBO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(data), data, GL_STATIC_DRAW);
-
-        //Vertex Array Object (VAO)
-        glGenVertexArrays(1, &vao); //generate the VAO
-        glBindVertexArray(vao); //bind the VAO
-        glEnableVertexAttribArray(0); //enable vertex attributes
-        glEnableVertexAttribArray(1); //enable normal attributes
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (GLvoid*) 0);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float),
-                              (GLvoid*) (3 * sizeof(float)));
-
-        DEBUG_ASSERT(0 != vbo);
-        DEBUG_ASSERT(0 != vao);
+    explicit Cube(const Primitive &primitive = Primitive::cube())
+        : model(GeometryRegistry::get().primitive(primitive)) {
+        DEBUG_ASSERT(PrimitiveShape::CUBE == primitive.shape ||
+                     PrimitiveShape::BOX == primitive.shape);
     }
     void draw() override {
-        glBindVertexArray(this->vao);
-        glDrawArrays(GL_TRIANGLES, 0, 12*3);
+        model->draw();
     }
 };
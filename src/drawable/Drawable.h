@@ -6,6 +6,8 @@
 #define ZPG_DRAWABLE_H
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include "../GLStateCache.h"
+#include "../gl_dsa.h"
 
 class Drawable {
 public:
@@ -3,214 +3,329 @@
 
 #include <GL/gl.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "../assertions.h"
 
-#include "assimp/Importer.hpp"
-#include "assimp/color4.h"
-#include "assimp/material.h"
-#include "assimp/postprocess.h"
-#include "assimp/scene.h"
-#include "assimp/types.h"
-
-#include "glm/ext/vector_float4.hpp"
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/gtx/string_cast.hpp>
-
+#include "../CookedMesh.h"
 #include "../Material.h"
+#include "../MeshData.h"
+#include "../ModelImporter.h"
+#include "../gl_dsa.h"
 #include "../gl_utils.h"
 #include "Drawable.h"
 
-struct Vertex {
-    float Position[3];
-    float Normal[3];
-    float Texture[2];
-    float Tangent[3];
-};
-
+/*
+ * Model in one vertex and one index buffer. Its parts (submeshes, see
+ * MeshData) are drawn with glMultiDrawElementsBaseVertex, one call for all
+ * parts with the same material. Models without indices have no index buffer
+ * and are drawn with glMultiDrawArrays.
+ */
 class DynamicModel : public Drawable {
     static_assert(sizeof(GLuint) == sizeof(uint32_t));
 
   private:
     uint32_t VAO = 0;
     uint32_t VBO = 0;
+    // 0 for models without indices
     uint32_t IBO = 0;
     size_t indiciesCount = 0;
-    Material material;
-
-    const static inline uint32_t importOptions =
-        aiProcess_Triangulate | aiProcess_OptimizeMeshes |
-        aiProcess_JoinIdenticalVertices | aiProcess_CalcTangentSpace;
-
-    static inline glm::vec4 aiColToGlm(const aiColor4D &col) {
-        return {col.r, col.g, col.b, col.a};
-    }
+    size_t vertexCount = 0;
+    VertexFormat format;
+    // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, see IndexData
+    GLenum indexType = GL_UNSIGNED_INT;
+    std::vector<SubMesh> submeshes;
+    std::vector<Material> materials;
+    // Arguments of glMultiDrawElementsBaseVertex, one entry per submesh.
+    // Without indices, counts and baseVertices are the vertex ranges for
+    // glMultiDrawArrays.
+    std::vector<GLsizei> counts;
+    std::vector<const void *> offsets;
+    std::vector<GLint> baseVertices;
+    MeshBounds bounds;
+    // false while this is a placeholder for a model that is still loading
+    bool ready = true;
 
     DynamicModel(uint32_t vao, uint32_t vbo, uint32_t ibo, size_t indiciesCount,
-                 Material material)
+                 size_t vertexCount, const VertexFormat &format,
+                 GLenum indexType, std::vector<SubMesh> submeshes,
+                 std::vector<Material> materials, const MeshBounds &bounds)
         : VAO(vao), VBO(vbo), IBO(ibo), indiciesCount(indiciesCount),
-          material(material) {}
+          vertexCount(vertexCount), format(format), indexType(indexType),
+          submeshes(std::move(submeshes)), materials(std::move(materials)),
+          bounds(bounds) {
+        for (const auto &submesh : this->submeshes) {
+            counts.push_back(static_cast<GLsizei>(submesh.indexCount));
+            if (0 == ibo) {
+                baseVertices.push_back(
+                    static_cast<GLint>(submesh.firstIndex));
+                continue;
+            }
+            offsets.push_back(reinterpret_cast<const void *>(
+                submesh.firstIndex * IndexData::sizeOf(indexType)));
+            baseVertices.push_back(static_cast<GLint>(submesh.baseVertex));
+        }
+    }
+
+    void drawSubmeshes(size_t first, size_t count) const {
+        if (0 == IBO) {
+            GL_CALL(glMultiDrawArrays, GL_TRIANGLES, &baseVertices[first],
+                    &counts[first], static_cast<GLsizei>(count));
+            return;
+        }
+        GL_CALL(glMultiDrawElementsBaseVertex, GL_TRIANGLES, &counts[first],
+                indexType, &offsets[first], static_cast<GLsizei>(count),
+                &baseVertices[first]);
+    }
 
   public:
     DynamicModel(DynamicModel &) = delete;
     DynamicModel &operator=(const DynamicModel &) = delete;
     DynamicModel(DynamicModel &&other) noexcept
         : VAO(other.VAO), VBO(other.VBO), IBO(other.IBO),
-          indiciesCount(other.indiciesCount), material(other.material) {
+          indiciesCount(other.indiciesCount), vertexCount(other.vertexCount),
+          format(other.format), indexType(other.indexType),
+          submeshes(std::move(other.submeshes)),
+          materials(std::move(other.materials)),
+          counts(std::move(other.counts)), offsets(std::move(other.offsets)),
+          baseVertices(std::move(other.baseVertices)), bounds(other.bounds),
+          ready(other.ready) {
         other.VAO = 0;
         other.VBO = 0;
         other.IBO = 0;
     }
 
-    static std::shared_ptr<DynamicModel> load(const std::vector<uint8_t> &buf) {
-        Assimp::Importer importer;
-        const aiScene *scene =
-            importer.ReadFileFromMemory(buf.data(), buf.size(), importOptions);
-        DEBUG_ASSERTF(nullptr != scene, "Failed to load model");
-        std::cout << "Number of meshes: " << scene->mNumMeshes
-                  << "; number of materials: " << scene->mNumMaterials
-                  << std::endl;
-        Material material(glm::vec4(0), glm::vec4(0), glm::vec4(0), 32);
-        for (unsigned int i = 0; i < scene->mNumMaterials; i++) {
-            const aiMaterial *mat = scene->mMaterials[i];
-            DEBUG_ASSERT_NOT_NULL(mat);
-            aiString name;
-            mat->Get(AI_MATKEY_NAME, name);
-            std::cout << "Material " << i << " name: " << name.C_Str()
-                      << std::endl;
-            aiColor4D col;
-            if (AI_SUCCESS ==
-                aiGetMaterialColor(mat, AI_MATKEY_COLOR_AMBIENT, &col)) {
-                material.setAmbient(aiColToGlm(col));
-            } else {
-                UNREACHABLE("Failed to read ambinet material color")
-            }
-            if (AI_SUCCESS ==
-                aiGetMaterialColor(mat, AI_MATKEY_COLOR_DIFFUSE, &col)) {
-                auto val = aiColToGlm(col);
-                std::cout << "Diffuse color in material: "
-                          << glm::to_string(val) << std::endl;
-                material.setDiffuse(val);
-            } else {
-                UNREACHABLE("Failed to read diffuse material color")
-            }
-            if (AI_SUCCESS ==
-                aiGetMaterialColor(mat, AI_MATKEY_COLOR_SPECULAR, &col)) {
-                material.setSpecular(aiColToGlm(col));
-            } else {
-                UNREACHABLE("Failed to read specular material color")
-            }
+    /*
+     * Creates the GPU buffers. `vertices` are interleaved in `format` and
+     * `indices` are of `indexType`, both are uploaded as they are, so they
+     * may point into a mapped file. No `submeshes` means one part with the
+     * first material.
+     *
+     * Without `indices`, every 3 vertices are a triangle and submeshes are
+     * ranges of vertices, firstIndex and indexCount count vertices.
+     */
+    static std::shared_ptr<DynamicModel>
+    upload(const VertexFormat &format, std::span<const std::byte> vertices,
+           std::span<const std::byte> indices, GLenum indexType,
+           std::span<const SubMesh> submeshes,
+           std::vector<Material> materials, const MeshBounds &bounds) {
+        DEBUG_ASSERT(0 != format.stride);
+        DEBUG_ASSERT(0 == vertices.size() % format.stride);
+        size_t vertexCount = vertices.size() / format.stride;
+        size_t indexCount = indices.size() / IndexData::sizeOf(indexType);
+        bool indexed = !indices.empty();
+        // Elements the parts are ranges of
+        size_t elementCount = indexed ? indexCount : vertexCount;
+
+        std::vector<SubMesh> parts(submeshes.begin(), submeshes.end());
+        if (parts.empty()) {
+            parts.push_back({0, static_cast<uint32_t>(elementCount), 0, 0});
+        }
+        if (materials.empty()) {
+            materials.push_back(MeshData::defaultMaterial());
+        }
+        for (const auto &part : parts) {
+            DEBUG_ASSERT(part.firstIndex + part.indexCount <= elementCount);
+            DEBUG_ASSERT(indexed || 0 == part.baseVertex);
+            DEBUG_ASSERTF(part.material < materials.size(),
+                          "Submesh has material %u of %zu", part.material,
+                          materials.size());
+        }
+        // Drawn by material, see draw(setMaterial)
+        std::stable_sort(parts.begin(), parts.end(),
+                         [](const SubMesh &a, const SubMesh &b) {
+                             return a.material < b.material;
+                         });
+
+        // Everything is created and filled by name, so loading a model
+        // doesn't touch whatever is currently bound
+        GLuint vao = gl::createVertexArray();
+        GLuint vbo = gl::createBuffer();
+
+        gl::bufferData(vbo, vertices.size(), vertices.data(), GL_STATIC_DRAW);
+        gl::vertexArrayVertexBuffer(vao, 0, vbo, 0, format.stride);
+        for (const auto &attrib : format.used()) {
+            gl::vertexArrayAttrib(vao, attrib.location, attrib.components,
+                                  attrib.type, attrib.normalized,
+                                  attrib.offset, 0);
         }
 
-        for (unsigned int i = 0; i < scene->mNumMeshes; i++) {
-            aiMesh *mesh = scene->mMeshes[i];
-
-            auto *pVertices = new Vertex[mesh->mNumVertices];
-            DEBUG_ASSERT_NOT_NULL(pVertices);
-            std::memset(pVertices, 0, sizeof(Vertex) * mesh->mNumVertices);
-
-            for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
-                if (mesh->HasPositions()) {
-                    pVertices[i].Position[0] = mesh->mVertices[i].x;
-                    pVertices[i].Position[1] = mesh->mVertices[i].y;
-                    pVertices[i].Position[2] = mesh->mVertices[i].z;
-                }
-
-                if (mesh->HasNormals()) {
-                    pVertices[i].Normal[0] = mesh->mNormals[i].x;
-                    pVertices[i].Normal[1] = mesh->mNormals[i].y;
-                    pVertices[i].Normal[2] = mesh->mNormals[i].z;
-                }
-
-                if (mesh->HasTextureCoords(0)) {
-                    pVertices[i].Texture[0] = mesh->mTextureCoords[0][i].x;
-                    pVertices[i].Texture[1] = mesh->mTextureCoords[0][i].y;
-                }
-
-                if (mesh->HasTangentsAndBitangents()) {
-                    pVertices[i].Tangent[0] = mesh->mTangents[i].x;
-                    pVertices[i].Tangent[1] = mesh->mTangents[i].y;
-                    pVertices[i].Tangent[2] = mesh->mTangents[i].z;
-                }
-            }
+        // Index Buffer
+        GLuint ibo = 0;
+        if (indexed) {
+            ibo = gl::createBuffer();
+            gl::bufferData(ibo, indices.size(), indices.data(),
+                           GL_STATIC_DRAW);
+            gl::vertexArrayElementBuffer(vao, ibo);
+        }
 
-            unsigned int *pIndices = nullptr;
-            if (mesh->HasFaces()) {
-                pIndices = new unsigned int[mesh->mNumFaces * 3];
-                for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
-                    pIndices[i * 3] = mesh->mFaces[i].mIndices[0];
-                    pIndices[i * 3 + 1] = mesh->mFaces[i].mIndices[1];
-                    pIndices[i * 3 + 2] = mesh->mFaces[i].mIndices[2];
-                }
-            }
+        return std::shared_ptr<DynamicModel>(new DynamicModel(
+            vao, vbo, ibo, indexCount, vertexCount, format, indexType,
+            std::move(parts), std::move(materials), bounds));
+    }
 
-            GLuint vao;
-            GLuint vbo;
-            GLuint ibo;
-            size_t indiciesCount;
-            GL_CALL(glGenVertexArrays, 1, &vao);
-
-            DEBUG_ASSERT(0 != vao);
-
-            GL_CALL(glGenBuffers, 1, &vbo);
-            DEBUG_ASSERT(0 != vbo);
-
-            GL_CALL(glGenBuffers, 1, &ibo);
-            DEBUG_ASSERT(0 != ibo);
-
-            GL_CALL(glBindVertexArray, vao);
-            GL_CALL(glBindBuffer, GL_ARRAY_BUFFER, vbo);
-            GL_CALL(glBufferData, GL_ARRAY_BUFFER,
-                    sizeof(Vertex) * mesh->mNumVertices, pVertices,
-                    GL_STATIC_DRAW);
-            GL_CALL(glEnableVertexAttribArray, 0);
-            GL_CALL(glVertexAttribPointer, 0, 3, GL_FLOAT, GL_FALSE,
-                    sizeof(Vertex), (GLvoid *)nullptr);
-            GL_CALL(glEnableVertexAttribArray, 1);
-            GL_CALL(glVertexAttribPointer, 1, 3, GL_FLOAT, GL_FALSE,
-                    sizeof(Vertex), (GLvoid *)(3 * sizeof(GLfloat)));
-            GL_CALL(glEnableVertexAttribArray, 2);
-            GL_CALL(glVertexAttribPointer, 2, 2, GL_FLOAT, GL_FALSE,
-                    sizeof(Vertex), (GLvoid *)(6 * sizeof(GLfloat)));
-
-            // Tangent for Normal Map
-            GL_CALL(glEnableVertexAttribArray, 3);
-            GL_CALL(glVertexAttribPointer, 3, 3, GL_FLOAT, GL_FALSE,
-                    sizeof(Vertex), (GLvoid *)(8 * sizeof(GLfloat)));
-
-            // Index Buffer
-            GL_CALL(glBindBuffer, GL_ELEMENT_ARRAY_BUFFER, ibo);
-            GL_CALL(glBufferData, GL_ELEMENT_ARRAY_BUFFER,
-                    sizeof(GLuint) * mesh->mNumFaces * 3, pIndices,
-                    GL_STATIC_DRAW);
-            GL_CALL(glBindBuffer, GL_ARRAY_BUFFER, 0);
-            GL_CALL(glBindVertexArray, vao);
-
-            indiciesCount = mesh->mNumFaces * 3;
-            delete[] pVertices;
-            delete[] pIndices;
-
-            GL_CALL(glBindVertexArray, 0);
-
-            return std::shared_ptr<DynamicModel>(
-                new DynamicModel(vao, vbo, ibo, indiciesCount, material));
-        }
-        UNREACHABLE("At least one ")
+    static std::shared_ptr<DynamicModel> load(const MeshData &data) {
+        auto indices = IndexData::pack(data.indices);
+        return upload(data.format, data.vertexBytes(), indices.bytes,
+                      indices.type, data.submeshes, data.materials,
+                      data.bounds);
+    }
+
+    static std::shared_ptr<DynamicModel> load(const CookedMesh &cooked) {
+        return upload(cooked.getFormat(), cooked.vertexBytes(),
+                      cooked.indexBytes(), cooked.getIndexType(),
+                      cooked.submeshes(), cooked.getMaterials(),
+                      cooked.getBounds());
+    }
+
+    static std::shared_ptr<DynamicModel> load(std::span<const std::byte> buf) {
+        return load(ModelImporter::import(buf));
+    }
+
+    /*
+     * Model without any geometry, drawing it does nothing. Stands in for a
+     * model that is still being loaded until adopt() is called.
+     */
+    static std::shared_ptr<DynamicModel> placeholder() {
+        auto self = std::shared_ptr<DynamicModel>(new DynamicModel(
+            0, 0, 0, 0, 0, VertexFormat::model(), GL_UNSIGNED_INT, {},
+            {MeshData::defaultMaterial()}, MeshBounds()));
+        self->ready = false;
+        return self;
     }
 
-    [[nodiscard]] const Material &getMaterial() const { return material; }
+    /*
+     * Takes over buffers of `loaded` (the real model), `loaded` is left empty
+     */
+    void adopt(DynamicModel &loaded) {
+        DEBUG_ASSERTF(0 == VAO, "Only placeholders can adopt a model");
+        VAO = loaded.VAO;
+        VBO = loaded.VBO;
+        IBO = loaded.IBO;
+        indiciesCount = loaded.indiciesCount;
+        vertexCount = loaded.vertexCount;
+        format = loaded.format;
+        indexType = loaded.indexType;
+        submeshes = std::move(loaded.submeshes);
+        materials = std::move(loaded.materials);
+        counts = std::move(loaded.counts);
+        offsets = std::move(loaded.offsets);
+        baseVertices = std::move(loaded.baseVertices);
+        bounds = loaded.bounds;
+        ready = true;
+        loaded.VAO = 0;
+        loaded.VBO = 0;
+        loaded.IBO = 0;
+    }
+
+    [[nodiscard]] bool isReady() const { return ready; }
+
+    /*
+     * Material of the first part, for models that have only one
+     */
+    [[nodiscard]] const Material &getMaterial() const {
+        return materials.front();
+    }
+
+    /*
+     * Materials the submeshes index, the placeholder has the default one
+     */
+    [[nodiscard]] std::span<const Material> getMaterials() const {
+        return materials;
+    }
+
+    [[nodiscard]] std::span<const SubMesh> getSubmeshes() const {
+        return submeshes;
+    }
+
+    /*
+     * Model space bounds, empty for a placeholder
+     */
+    [[nodiscard]] const MeshBounds &getBounds() const { return bounds; }
+
+    [[nodiscard]] uint32_t getVertexBuffer() const { return VBO; }
+
+    /*
+     * 0 when the model has no indices
+     */
+    [[nodiscard]] uint32_t getIndexBuffer() const { return IBO; }
+
+    [[nodiscard]] size_t getVertexCount() const { return vertexCount; }
+
+    [[nodiscard]] const VertexFormat &getVertexFormat() const {
+        return format;
+    }
+
+    /*
+     * Multiply the model matrix by this, positions may be quantised
+     */
+    [[nodiscard]] glm::mat4 getPositionTransform() const {
+        return format.positionTransform();
+    }
+
+    [[nodiscard]] size_t getIndexCount() const { return indiciesCount; }
+
+    [[nodiscard]] GLenum getIndexType() const { return indexType; }
+
+    /*
+     * Size of the vertex and index buffers
+     */
+    [[nodiscard]] size_t getGpuBytes() const {
+        return vertexCount * format.stride +
+               indiciesCount * IndexData::sizeOf(indexType);
+    }
 
+    /*
+     * All parts in one call, with whatever material the shader has set
+     */
     void draw() override {
-        GL_CALL(glBindVertexArray, VAO);
-        GL_CALL(glDrawElements, GL_TRIANGLES, indiciesCount, GL_UNSIGNED_INT,
-                nullptr);
+        if (0 == VAO) {
+            return;
+        }
+        GLStateCache::get().bindVertexArray(VAO);
+        drawSubmeshes(0, submeshes.size());
+    }
 
-#ifdef DEBUG_ASSERTIONS
-        GL_CALL(glBindVertexArray, 0);
-#endif // DEBUG_ASSERTIONS
+    /*
+     * One call per material, setMaterial(index into getMaterials()) is
+     * called before the parts with that material are drawn
+     */
+    template <typename SetMaterial>
+    void draw(const SetMaterial &setMaterial) {
+        if (0 == VAO) {
+            return;
+        }
+        GLStateCache::get().bindVertexArray(VAO);
+        for (size_t first = 0; first < submeshes.size();) {
+            uint32_t material = submeshes[first].material;
+            size_t count = 1;
+            while (first + count < submeshes.size() &&
+                   submeshes[first + count].material == material) {
+                count++;
+            }
+            setMaterial(material);
+            drawSubmeshes(first, count);
+            first += count;
+        }
+    }
+
+    ~DynamicModel() {
+        auto &state = GLStateCache::get();
+        if (0 != VAO) {
+            state.deleteVertexArray(VAO);
+        }
+        if (0 != VBO) {
+            state.deleteBuffer(VBO);
+        }
+        if (0 != IBO) {
+            state.deleteBuffer(IBO);
+        }
     }
 };
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../MeshData.h"
+#include "../PrimitiveMesh.h"
+#include "../assertions.h"
+#include "DynamicModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+/*
+ * Geometry currently on the GPU through GeometryRegistry
+ * uploads - meshes created since the start
+ * reuses - requests for a mesh that was already resident
+ */
+struct GeometryStats {
+    size_t meshes = 0;
+    size_t gpuBytes = 0;
+    uint64_t uploads = 0;
+    uint64_t reuses = 0;
+};
+
+/*
+ * Meshes shared by every drawable that draws the same geometry, so lights,
+ * skyboxes and scenes built more than once don't upload it again.
+ *
+ * Meshes are keyed by their identity, the name of a Primitive or the address
+ * of a static vertex array. The registry holds them weakly, a mesh is
+ * deleted with its last drawable and uploaded again when it's requested
+ * next. Model files are shared the same way by the AssetManager cache.
+ */
+class GeometryRegistry {
+  private:
+    std::unordered_map<std::string, std::weak_ptr<DynamicModel>> meshes;
+    uint64_t uploads = 0;
+    uint64_t reuses = 0;
+
+    GeometryRegistry() = default;
+
+  public:
+    GeometryRegistry(const GeometryRegistry &) = delete;
+    GeometryRegistry &operator=(const GeometryRegistry &) = delete;
+
+    static GeometryRegistry &get() {
+        static GeometryRegistry instance;
+        return instance;
+    }
+
+    /*
+     * The resident mesh with `key`, or the one upload() returns
+     */
+    std::shared_ptr<DynamicModel>
+    acquire(const std::string &key,
+            const std::function<std::shared_ptr<DynamicModel>()> &upload) {
+        auto &cached = meshes[key];
+        if (auto model = cached.lock()) {
+            reuses++;
+            return model;
+        }
+        auto model = upload();
+        DEBUG_ASSERT_NOT_NULL(model);
+        std::cout << "Geometry " << key << " uploaded" << std::endl;
+        uploads++;
+        cached = model;
+        return model;
+    }
+
+    /*
+     * Procedural mesh, see PrimitiveMesh
+     */
+    std::shared_ptr<DynamicModel> primitive(const Primitive &primitive) {
+        return acquire(primitive.name(), [&]() {
+            return DynamicModel::load(PrimitiveMesh::generate(primitive));
+        });
+    }
+
+    /*
+     * The first `count` vertices of a static array in `format`, drawn
+     * without indices. The array is identified by its address.
+     */
+    std::shared_ptr<DynamicModel> array(std::span<const float> data,
+                                        const VertexFormat &format,
+                                        size_t count) {
+        DEBUG_ASSERT(count * format.stride <= data.size_bytes());
+        auto address = reinterpret_cast<uintptr_t>(data.data());
+        auto key = "array " + std::to_string(address) + " " +
+                   std::to_string(count);
+        return acquire(key, [&]() {
+            return DynamicModel::upload(
+                format, std::as_bytes(data).first(count * format.stride), {},
+                GL_UNSIGNED_INT, {}, {}, MeshBounds());
+        });
+    }
+
+    /*
+     * Forgets meshes nobody holds anymore and sums the rest
+     */
+    GeometryStats stats() {
+        GeometryStats stats{0, 0, uploads, reuses};
+        std::erase_if(meshes, [](const auto &entry) {
+            return entry.second.expired();
+        });
+        for (const auto &[key, mesh] : meshes) {
+            stats.meshes++;
+            stats.gpuBytes += mesh.lock()->getGpuBytes();
+        }
+        return stats;
+    }
+};
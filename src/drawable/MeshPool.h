@@ -0,0 +1,309 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "../GLStateCache.h"
+#include "../MaterialRegistry.h"
+#include "../MathHelpers.h"
+#include "../VertexQuantizer.h"
+#include "../assertions.h"
+#include "../gl_dsa.h"
+#include "../gl_utils.h"
+#include "../shaders/SSBO.h"
+#include "DynamicModel.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*
+ * Index into the `meshes` array in shaders
+ */
+using MeshIndex = uint32_t;
+
+/*
+ * Where the attributes are inside one vertex, in floats. Vertices are tightly
+ * packed arrays of floats, position is always at offset 0.
+ */
+struct VertexLayout {
+    int32_t stride;
+    int32_t normalOffset;
+    int32_t uvOffset = -1; // -1 - mesh has no texture coordinates
+
+    // position + normal
+    static constexpr VertexLayout positionNormal() { return {6, 3, -1}; }
+
+    // position + normal + uv, PlaneWithTexture
+    static constexpr VertexLayout positionNormalUv() { return {8, 3, 6}; }
+
+    // DynamicModel's Vertex
+    static constexpr VertexLayout model() {
+        static_assert(sizeof(Vertex) == 11 * sizeof(float));
+        constexpr auto normal = offsetof(Vertex, Normal) / sizeof(float);
+        constexpr auto uv = offsetof(Vertex, Texture) / sizeof(float);
+        return {11, static_cast<int32_t>(normal), static_cast<int32_t>(uv)};
+    }
+};
+
+/*
+ * Matching declaration for struct Mesh in vertex/pulledLights.glsl
+ */
+struct alignas(16) MeshGLSL {
+    int32_t baseVertex;   // offset of the first vertex in `vertices`, floats
+    int32_t stride;       // floats
+    int32_t normalOffset; // floats
+    int32_t uvOffset;     // floats, -1 if there are no texture coordinates
+    int32_t baseIndex;    // offset of the first index in `indices`
+    int32_t indexed;      // 0 - vertices are drawn in order
+    int32_t _padding_0 = 0;
+    int32_t _padding_1 = 0;
+};
+static_assert(sizeof(MeshGLSL) == 32);
+
+/*
+ * Matching declaration for struct Draw in vertex/pulledLights.glsl
+ */
+struct alignas(16) DrawGLSL {
+    glm::mat4 modelMatrix;
+    // mat3 in std430 is stored as 3 columns aligned as vec4
+    glm::vec4 normalMatrix[3];
+    uint32_t meshIndex;
+    uint32_t materialIndex;
+    uint32_t _padding_0 = 0;
+    uint32_t _padding_1 = 0;
+
+    DrawGLSL(const glm::mat4 &model, MeshIndex mesh, MaterialIndex material)
+        : modelMatrix(model), meshIndex(mesh), materialIndex(material) {
+        auto normal = math::normalMatrix(model);
+        for (int i = 0; i < 3; i++) {
+            normalMatrix[i] = glm::vec4(normal[i], 0);
+        }
+    }
+};
+static_assert(sizeof(DrawGLSL) == 128);
+
+/*
+ * Layout of one record in GL_DRAW_INDIRECT_BUFFER for glMultiDrawArraysIndirect
+ */
+struct DrawArraysIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+};
+
+/*
+ * Vertex data of many meshes in SSBOs for programmable vertex pulling.
+ *
+ * Every mesh is appended to one float array (with a MeshGLSL describing its
+ * format) and vertex shader fetches the attributes itself by gl_VertexID, so
+ * meshes with different vertex layouts are drawn with a single empty VAO.
+ * Draws pushed during a frame are submitted with one glMultiDrawArraysIndirect
+ * and the shader finds its DrawGLSL by gl_DrawIDARB. Without
+ * ARB_shader_draw_parameters the draws are issued one by one with a
+ * `drawIndex` uniform, still without any VAO switching.
+ *
+ * Indexed meshes are drawn non-indexed (index is looked up in the shader), so
+ * post transform cache is not used for them.
+ *
+ * SSBO bindings: 2 - vertices, 3 - indices, 4 - meshes, 5 - draws
+ */
+class MeshPool {
+  private:
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    SSBO<MeshGLSL> meshes;
+    SSBO<DrawGLSL> draws;
+    // Vertex count for non-indexed meshes, index count for indexed ones
+    std::vector<GLuint> meshCounts;
+    std::vector<DrawArraysIndirectCommand> commands;
+
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    GLuint indirectBuffer = 0;
+    size_t indirectSize = 0;
+    GLuint emptyVao = 0;
+    bool dirty = false;
+
+    void upload() {
+        // Buffers can't be empty when bound to a binding point
+        if (vertices.empty()) {
+            vertices.emplace_back(0);
+        }
+        if (indices.empty()) {
+            indices.emplace_back(0);
+        }
+        gl::bufferData(vertexBuffer, vertices.size() * sizeof(float),
+                       vertices.data(), GL_STATIC_DRAW);
+        gl::bufferData(indexBuffer, indices.size() * sizeof(uint32_t),
+                       indices.data(), GL_STATIC_DRAW);
+        meshes.realloc();
+        dirty = false;
+    }
+
+    void uploadDraws() {
+        draws.sync();
+        size_t size = commands.size() * sizeof(DrawArraysIndirectCommand);
+        if (size != indirectSize) {
+            gl::bufferData(indirectBuffer, size, commands.data(),
+                           GL_DYNAMIC_DRAW);
+            indirectSize = size;
+        } else {
+            gl::bufferSubData(indirectBuffer, 0, size, commands.data());
+        }
+    }
+
+  public:
+    explicit MeshPool()
+        : vertexBuffer(gl::createBuffer()), indexBuffer(gl::createBuffer()),
+          indirectBuffer(gl::createBuffer()),
+          emptyVao(gl::createVertexArray()) {}
+
+    MeshPool(const MeshPool &) = delete;
+
+    static bool hasDrawParameters() {
+        static const bool supported = GLEW_ARB_shader_draw_parameters;
+        return supported;
+    }
+
+    /*
+     * Adds a mesh. `data` has `vertexCount` vertices in `layout`. When
+     * `indexData` is set, the mesh is drawn with `indexCount` indices.
+     */
+    MeshIndex add(const float *data, size_t vertexCount, VertexLayout layout,
+                  const uint32_t *indexData = nullptr, size_t indexCount = 0) {
+        DEBUG_ASSERT_NOT_NULL(data);
+        DEBUG_ASSERT(0 != vertexCount);
+        auto idx = static_cast<MeshIndex>(meshes.objects().size());
+        MeshGLSL mesh{
+            .baseVertex = static_cast<int32_t>(vertices.size()),
+            .stride = layout.stride,
+            .normalOffset = layout.normalOffset,
+            .uvOffset = layout.uvOffset,
+            .baseIndex = static_cast<int32_t>(indices.size()),
+            .indexed = nullptr != indexData,
+        };
+        vertices.insert(vertices.end(), data,
+                        data + vertexCount * layout.stride);
+        if (nullptr != indexData) {
+            indices.insert(indices.end(), indexData, indexData + indexCount);
+            meshCounts.emplace_back(indexCount);
+        } else {
+            meshCounts.emplace_back(vertexCount);
+        }
+        meshes.objects().emplace_back(mesh);
+        dirty = true;
+        return idx;
+    }
+
+    /*
+     * Copies the model out of its own buffers, so it has to be loaded already
+     */
+    MeshIndex add(const DynamicModel &model) {
+        const auto &format = model.getVertexFormat();
+        auto layout = VertexLayout::model();
+        std::vector<std::byte> bytes(model.getVertexCount() * format.stride);
+        std::vector<uint32_t> idx(model.getIndexCount());
+        std::vector<std::byte> indexBytes(
+            idx.size() * IndexData::sizeOf(model.getIndexType()));
+        gl::getBufferSubData(model.getVertexBuffer(), 0, bytes.size(),
+                             bytes.data());
+        // Shaders pull floats, quantised vertices are decoded
+        auto vertices = VertexQuantizer::unpack(format, bytes);
+        const auto *data = reinterpret_cast<const float *>(vertices.data());
+        if (0 == model.getIndexBuffer()) {
+            return add(data, model.getVertexCount(), layout);
+        }
+        gl::getBufferSubData(model.getIndexBuffer(), 0, indexBytes.size(),
+                             indexBytes.data());
+        // Shaders pull uints, 16-bit indices are widened
+        if (GL_UNSIGNED_SHORT == model.getIndexType()) {
+            const auto *shorts =
+                reinterpret_cast<const uint16_t *>(indexBytes.data());
+            std::copy_n(shorts, idx.size(), idx.begin());
+        } else {
+            std::memcpy(idx.data(), indexBytes.data(), indexBytes.size());
+        }
+        // Indices of a part are relative to its base vertex, the pool draws
+        // the whole model as one mesh
+        for (const auto &submesh : model.getSubmeshes()) {
+            for (uint32_t i = 0; i < submesh.indexCount; i++) {
+                idx[submesh.firstIndex + i] += submesh.baseVertex;
+            }
+        }
+        return add(data, model.getVertexCount(), layout, idx.data(),
+                   idx.size());
+    }
+
+    /*
+     * Queues mesh for drawing in this frame
+     */
+    void push(MeshIndex mesh, const glm::mat4 &modelMatrix,
+              MaterialIndex material) {
+        DEBUG_ASSERTF(mesh < meshCounts.size(), "Mesh %u does not exist", mesh);
+        draws.objects().emplace_back(modelMatrix, mesh, material);
+        commands.push_back(DrawArraysIndirectCommand{
+            .count = meshCounts[mesh],
+            .instanceCount = 1,
+            .first = 0,
+            .baseInstance = 0,
+        });
+    }
+
+    /*
+     * Draws everything pushed since the last call with the bound shader.
+     * `shader` has to be a pulling shader with setDrawIndex(), that is used
+     * only when ARB_shader_draw_parameters is missing.
+     */
+    template <typename PullingShader> void draw(PullingShader &shader) {
+        DEBUG_ASSERT(shader.isBound());
+        if (dirty) {
+            upload();
+        }
+        if (commands.empty()) {
+            return;
+        }
+        uploadDraws();
+
+        auto &state = GLStateCache::get();
+        state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, vertexBuffer);
+        state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, indexBuffer);
+        meshes.bind(4);
+        draws.bind(5);
+        state.bindVertexArray(emptyVao);
+
+        if (hasDrawParameters()) {
+            state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+            GL_CALL(glMultiDrawArraysIndirect, GL_TRIANGLES, nullptr,
+                    static_cast<GLsizei>(commands.size()), 0);
+        } else {
+            for (size_t i = 0; i < commands.size(); i++) {
+                shader.setDrawIndex(static_cast<int32_t>(i));
+                GL_CALL(glDrawArrays, GL_TRIANGLES, 0, commands[i].count);
+            }
+        }
+
+        draws.objects().clear();
+        commands.clear();
+    }
+
+    [[nodiscard]] size_t meshCount() const { return meshCounts.size(); }
+
+    ~MeshPool() {
+        auto &state = GLStateCache::get();
+        if (0 != vertexBuffer) {
+            state.deleteBuffer(vertexBuffer);
+        }
+        if (0 != indexBuffer) {
+            state.deleteBuffer(indexBuffer);
+        }
+        if (0 != indirectBuffer) {
+            state.deleteBuffer(indirectBuffer);
+        }
+        if (0 != emptyVao) {
+            state.deleteVertexArray(emptyVao);
+        }
+    }
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include "../assertions.h"
 #include "Drawable.h"
+#include "GeometryRegistry.h"
+#include <memory>
 
 class PlaneWithTexture : public Drawable {
   private:
@@ -21,39 +23,15 @@ class PlaneWithTexture : public Drawable {
         0.788901f,  0.477421f,  0.000000f,  0.500000f,  0.000000f,  0.000000f,
         0.447200f,  -0.894400f, 0.788901f,  0.999821f,  0.500000f,  -0.500000f,
         -0.500000f, 0.000000f,  0.447200f,  -0.894400f, 0.399527f,  0.651554f};
-    GLuint vbo = 0;
-    GLuint vao = 0;
+    std::shared_ptr<DynamicModel> model;
 
   public:
-    PlaneWithTexture() {
-
-        glGenBuffers(1, &vbo); // generate the VBO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(points), points, GL_STATIC_DRAW);
-
-        // Vertex Array Object (VAO)
-        glGenVertexArrays(1, &vao); // generate the VAO
-        glBindVertexArray(vao);     // bind the VAO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        // enable vertex attributes
-        glEnableVertexAttribArray(0);
-        glEnableVertexAttribArray(1);
-        glEnableVertexAttribArray(2);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float),
-                              (GLvoid *)0);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float),
-                              (GLvoid *)(sizeof(float) * 3));
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float),
-                              (GLvoid *)(sizeof(float) * 6));
-
-        DEBUG_ASSERT(0 != vbo);
-        DEBUG_ASSERT(0 != vao);
-    }
+    PlaneWithTexture()
+        : model(GeometryRegistry::get().array(
+              points, VertexFormat::floats({3, 3, 2}), 6)) {}
 
     void draw() override {
-        glBindVertexArray(this->vao);
-        glDrawArrays(GL_TRIANGLES, 0, 2 * 3);
+        model->draw();
     }
 };
 
@@ -68,37 +46,14 @@ class TestModel : public Drawable {
         0.5f,  0.5f,  0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,
         -0.5f, 0.5f,  0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f};
 
-    GLuint vbo = 0;
-    GLuint vao = 0;
+    std::shared_ptr<DynamicModel> model;
 
   public:
-    TestModel() {
-        glGenBuffers(1, &vbo); // generate the VBO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), &triangle[0],
-                     GL_STATIC_DRAW);
-
-        glGenVertexArrays(1, &vao); // generate the VAO
-        glBindVertexArray(vao);     // bind the VAO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-
-        // enable vertex attributes
-        glEnableVertexAttribArray(0);
-        glEnableVertexAttribArray(1);
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float),
-                              (GLvoid *)0);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float),
-                              (GLvoid *)(sizeof(float) * 3));
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float),
-                              (GLvoid *)(sizeof(float) * 6));
-
-        DEBUG_ASSERT(0 != vbo);
-        DEBUG_ASSERT(0 != vao);
-    }
+    TestModel()
+        : model(GeometryRegistry::get().array(
+              triangle, VertexFormat::floats({3, 3, 2}), 3)) {}
 
     void draw() override {
-        glBindVertexArray(this->vao);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        model->draw();
     }
 };
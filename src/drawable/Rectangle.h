@@ -7,6 +7,8 @@
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include "Drawable.h"
+#include "GeometryRegistry.h"
+#include <memory>
 #include "../assertions.h"
 
 class Rectangle: public Drawable {
@@ -20,30 +22,15 @@ private:
             0.3, 0.6, -1.0,
             0.3, 0.8, -1.0,
     };
-    GLuint vbo = 0;
-    GLuint vao = 0;
+    std::shared_ptr<DynamicModel> model;
 
 public:
-    Rectangle() {
-        //vertex buffer object (VBO)
-        glGenBuffers(1, &vbo); // generate the VBO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(points), points, GL_STATIC_DRAW);
-
-        //Vertex Array Object (VAO)
-        glGenVertexArrays(1, &vao); //generate the VAO
-        glBindVertexArray(vao); //bind the VAO
-        glEnableVertexAttribArray(0); //enable vertex attributes
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-
-        DEBUG_ASSERT(0 != vbo);
-        DEBUG_ASSERT(0 != vao);
-    }
+    Rectangle()
+        : model(GeometryRegistry::get().array(
+              points, VertexFormat::floats({3}), 6)) {}
 
     void draw() override {
-        glBindVertexArray(this->vao);
-        glDrawArrays(GL_TRIANGLES, 0, 6); //mode,first,count
+        model->draw();
     }
 
 //    void draw(ShaderProgram &shader) override {
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../AssetManager.h"
+#include "DynamicModel.h"
+#include "Drawable.h"
+#include "glm/glm.hpp"
+#include <memory>
+#include <string>
+
+/*
+ * Plain mesh from a model asset, drawn with whatever material the shader
+ * has. For the simple meshes (bushes, Suzanne) that used to be
+ * compiled in as float arrays, their vertices are now only on the GPU, the
+ * file is unmapped after the upload.
+ */
+class StaticMesh : public Drawable {
+  private:
+    std::shared_ptr<DynamicModel> model;
+
+  public:
+    StaticMesh(const std::shared_ptr<AssetManager> &assets,
+               const std::string &path)
+        : model(assets->loadModel(path)) {}
+
+    void draw() override { model->draw(); }
+
+    /*
+     * Multiply the model matrix by this, positions may be quantised
+     */
+    [[nodiscard]] glm::mat4 getPositionTransform() const {
+        return model->getPositionTransform();
+    }
+
+    [[nodiscard]] const DynamicModel &getModel() const { return *model; }
+};
@@ -5,43 +5,48 @@
 #ifndef ZPG_TREE_H
 #define ZPG_TREE_H
 
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
 #include "Drawable.h"
+#include "DynamicModel.h"
+#include "GeometryRegistry.h"
+#include "../MeshOptimizer.h"
+#include "../VertexQuantizer.h"
 #include "../models/tree.h"
-#include "../assertions.h"
-
+#include "glm/glm.hpp"
+#include <memory>
+#include <span>
+
+/*
+ * The compiled-in tree. Its triangle soup (position + normal) is indexed
+ * and goes through the same steps as an imported model, once per process,
+ * until it's converted to a model asset like the bushes.
+ */
 class Tree : public Drawable {
 private:
-    GLuint vbo = 0;
-    GLuint vao = 0;
+    static constexpr size_t VERTEX_COUNT = 92814;
+    std::shared_ptr<DynamicModel> model;
+
+    static std::shared_ptr<DynamicModel> upload() {
+        auto mesh = MeshOptimizer::index(
+            std::span<const float>(::tree, VERTEX_COUNT * 6), 6);
+        MeshOptimizer::optimize(mesh);
+        MeshOptimizer::splitForShortIndices(mesh);
+        VertexQuantizer::quantize(mesh);
+        return DynamicModel::load(mesh);
+    }
 
 public:
-    Tree() {
-        //vertex buffer object (VBO)
-        glGenBuffers(1, &vbo); // generate the VBO
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(tree), tree, GL_STATIC_DRAW);
-
-        //Vertex Array Object (VAO)
-        glGenVertexArrays(1, &vao); //generate the VAO
-        glBindVertexArray(vao); //bind the VAO
-        glEnableVertexAttribArray(0); //enable vertex attributes
-        glEnableVertexAttribArray(1); //enable vertex attributes
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (GLvoid*) nullptr);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float),
-                              (GLvoid*) (3 * sizeof(float)));
-
-        DEBUG_ASSERT(0 != vbo);
-        DEBUG_ASSERT(0 != vao);
-    }
+    Tree() : model(GeometryRegistry::get().acquire("tree", upload)) {}
 
     void draw() override {
-        glBindVertexArray(this->vao);
-        glDrawArrays(GL_TRIANGLES, 0, 92814);
+        model->draw();
+    }
+
+    // Multiply the model matrix by this, positions may be quantised
+    [[nodiscard]] glm::mat4 getPositionTransform() const {
+        return model->getPositionTransform();
     }
 
+    [[nodiscard]] const DynamicModel &getModel() const { return *model; }
 };
 
 #endif //ZPG_TREE_H
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "GLStateCache.h"
+#include "assertions.h"
+#include "gl_utils.h"
+#include <cstddef>
+
+/*
+ * Resource layer for buffers, vertex arrays and textures.
+ *
+ * With GL 4.5 (or ARB_direct_state_access) objects are created and edited by
+ * name (glCreateBuffers, glNamedBufferSubData, glVertexArrayAttribFormat,
+ * glTextureStorage2D, ...), so nothing gets bound and the rendering state is
+ * left alone. Without it the same functions fall back to bind-to-edit, but
+ * only through binding points that rendering doesn't use
+ * (GL_COPY_WRITE_BUFFER, a reserved texture unit) and the previously bound
+ * VAO is restored.
+ */
+namespace gl {
+
+static inline bool hasDirectStateAccess() {
+    static const bool supported =
+        GLEW_VERSION_4_5 || GLEW_ARB_direct_state_access;
+    return supported;
+}
+
+/*
+ * Texture unit used by the fallback path to edit textures. It's the last
+ * one, so it doesn't collide with the units handed out by AssetManager.
+ */
+static inline GLuint editTextureUnit() {
+    static const GLuint unit = [] {
+        GLint val = 0;
+        glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &val);
+        DEBUG_ASSERT(val > 0);
+        return static_cast<GLuint>(val - 1);
+    }();
+    return unit;
+}
+
+// region Buffers
+
+static inline GLuint createBuffer() {
+    GLuint id = 0;
+    if (hasDirectStateAccess()) {
+        glCreateBuffers(1, &id);
+    } else {
+        glGenBuffers(1, &id);
+        // glGenBuffers only reserves the name, the object is created on
+        // first bind
+        GLStateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, id);
+    }
+    assertNoError();
+    DEBUG_ASSERT(0 != id);
+    return id;
+}
+
+static inline void bufferData(GLuint buffer, size_t size, const void *data,
+                              GLenum usage) {
+    DEBUG_ASSERT(0 != buffer);
+    if (hasDirectStateAccess()) {
+        glNamedBufferData(buffer, static_cast<GLsizeiptr>(size), data, usage);
+    } else {
+        GLStateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), data,
+                     usage);
+    }
+    assertNoError();
+}
+
+static inline void bufferSubData(GLuint buffer, size_t offset, size_t size,
+                                 const void *data) {
+    DEBUG_ASSERT(0 != buffer);
+    if (hasDirectStateAccess()) {
+        glNamedBufferSubData(buffer, static_cast<GLintptr>(offset),
+                             static_cast<GLsizeiptr>(size), data);
+    } else {
+        GLStateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset),
+                        static_cast<GLsizeiptr>(size), data);
+    }
+    assertNoError();
+}
+
+/*
+ * Maps `size` bytes of the buffer from `offset` for the CPU, `access` is a
+ * combination of GL_MAP_*_BIT
+ */
+static inline void *mapBufferRange(GLuint buffer, size_t offset, size_t size,
+                                   GLbitfield access) {
+    DEBUG_ASSERT(0 != buffer);
+    void *ptr = nullptr;
+    if (hasDirectStateAccess()) {
+        ptr = glMapNamedBufferRange(buffer, static_cast<GLintptr>(offset),
+                                    static_cast<GLsizeiptr>(size), access);
+    } else {
+        GLStateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        ptr = glMapBufferRange(GL_COPY_WRITE_BUFFER,
+                               static_cast<GLintptr>(offset),
+                               static_cast<GLsizeiptr>(size), access);
+    }
+    assertNoError();
+    DEBUG_ASSERT_NOT_NULL(ptr);
+    return ptr;
+}
+
+static inline void unmapBuffer(GLuint buffer) {
+    DEBUG_ASSERT(0 != buffer);
+    GLboolean ok = GL_FALSE;
+    if (hasDirectStateAccess()) {
+        ok = glUnmapNamedBuffer(buffer);
+    } else {
+        GLStateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        ok = glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    }
+    assertNoError();
+    // GL_FALSE means the content got lost (video mode switch, ...)
+    DEBUG_ASSERT(GL_TRUE == ok);
+}
+
+/*
+ * Reads buffer content back to the CPU. Stalls until the GPU is done with the
+ * buffer, so use it only while loading.
+ */
+static inline void getBufferSubData(GLuint buffer, size_t offset, size_t size,
+                                    void *data) {
+    DEBUG_ASSERT(0 != buffer);
+    if (hasDirectStateAccess()) {
+        glGetNamedBufferSubData(buffer, static_cast<GLintptr>(offset),
+                                static_cast<GLsizeiptr>(size), data);
+    } else {
+        GLStateCache::get().bindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glGetBufferSubData(GL_COPY_READ_BUFFER, static_cast<GLintptr>(offset),
+                           static_cast<GLsizeiptr>(size), data);
+    }
+    assertNoError();
+}
+// endregion
+
+// region Vertex arrays
+
+static inline GLuint createVertexArray() {
+    GLuint id = 0;
+    if (hasDirectStateAccess()) {
+        glCreateVertexArrays(1, &id);
+    } else {
+        auto &state = GLStateCache::get();
+        GLuint prev = state.currentVertexArray();
+        glGenVertexArrays(1, &id);
+        state.bindVertexArray(id);
+        state.bindVertexArray(prev);
+    }
+    assertNoError();
+    DEBUG_ASSERT(0 != id);
+    return id;
+}
+
+/*
+ * Runs `edit` with `vao` bound and binds back whatever was bound before.
+ * Only used by the fallback path.
+ */
+template <typename Func>
+static inline void editVertexArray(GLuint vao, const Func &edit) {
+    auto &state = GLStateCache::get();
+    GLuint prev = state.currentVertexArray();
+    state.bindVertexArray(vao);
+    edit();
+    state.bindVertexArray(prev);
+}
+
+static inline void vertexArrayVertexBuffer(GLuint vao, GLuint bindingIndex,
+                                           GLuint buffer, size_t offset,
+                                           size_t stride) {
+    DEBUG_ASSERT(0 != vao);
+    if (hasDirectStateAccess()) {
+        glVertexArrayVertexBuffer(vao, bindingIndex, buffer,
+                                  static_cast<GLintptr>(offset),
+                                  static_cast<GLsizei>(stride));
+    } else {
+        editVertexArray(vao, [&]() {
+            glBindVertexBuffer(bindingIndex, buffer,
+                               static_cast<GLintptr>(offset),
+                               static_cast<GLsizei>(stride));
+        });
+    }
+    assertNoError();
+}
+
+static inline void vertexArrayElementBuffer(GLuint vao, GLuint buffer) {
+    DEBUG_ASSERT(0 != vao);
+    if (hasDirectStateAccess()) {
+        glVertexArrayElementBuffer(vao, buffer);
+    } else {
+        editVertexArray(vao, [&]() {
+            GLStateCache::get().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+        });
+    }
+    assertNoError();
+}
+
+/*
+ * Enables attribute `attrib`, sets its format and connects it to the
+ * vertex buffer binding `bindingIndex`
+ */
+static inline void vertexArrayAttrib(GLuint vao, GLuint attrib, GLint size,
+                                     GLenum type, GLboolean normalized,
+                                     size_t relativeOffset,
+                                     GLuint bindingIndex) {
+    DEBUG_ASSERT(0 != vao);
+    if (hasDirectStateAccess()) {
+        glEnableVertexArrayAttrib(vao, attrib);
+        glVertexArrayAttribFormat(vao, attrib, size, type, normalized,
+                                  static_cast<GLuint>(relativeOffset));
+        glVertexArrayAttribBinding(vao, attrib, bindingIndex);
+    } else {
+        editVertexArray(vao, [&]() {
+            glEnableVertexAttribArray(attrib);
+            glVertexAttribFormat(attrib, size, type, normalized,
+                                 static_cast<GLuint>(relativeOffset));
+            glVertexAttribBinding(attrib, bindingIndex);
+        });
+    }
+    assertNoError();
+}
+// endregion
+
+// region Textures
+
+static inline GLuint createTexture(GLenum target) {
+    GLuint id = 0;
+    if (hasDirectStateAccess()) {
+        glCreateTextures(target, 1, &id);
+    } else {
+        glGenTextures(1, &id);
+        GLStateCache::get().bindTexture(editTextureUnit(), target, id);
+    }
+    assertNoError();
+    DEBUG_ASSERT(0 != id);
+    return id;
+}
+
+/*
+ * Immutable storage for `levels` mip levels. Works for GL_TEXTURE_2D and
+ * GL_TEXTURE_CUBE_MAP (all six faces get allocated).
+ */
+static inline void textureStorage2D(GLuint texture, GLenum target,
+                                    GLsizei levels, GLenum internalFormat,
+                                    GLsizei width, GLsizei height) {
+    DEBUG_ASSERT(0 != texture);
+    if (hasDirectStateAccess()) {
+        glTextureStorage2D(texture, levels, internalFormat, width, height);
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), target, texture);
+        glTexStorage2D(target, levels, internalFormat, width, height);
+    }
+    assertNoError();
+}
+
+/*
+ * Immutable storage for `levels` mip levels of `layers` layers of a
+ * GL_TEXTURE_2D_ARRAY
+ */
+static inline void textureStorage3D(GLuint texture, GLenum target,
+                                    GLsizei levels, GLenum internalFormat,
+                                    GLsizei width, GLsizei height,
+                                    GLsizei layers) {
+    DEBUG_ASSERT(0 != texture);
+    if (hasDirectStateAccess()) {
+        glTextureStorage3D(texture, levels, internalFormat, width, height,
+                           layers);
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), target, texture);
+        glTexStorage3D(target, levels, internalFormat, width, height, layers);
+    }
+    assertNoError();
+}
+
+/*
+ * Uploads pixels into `level`. For cubemaps `face` selects the face in the
+ * usual +X, -X, +Y, -Y, +Z, -Z order, for 2D texture arrays the layer, for
+ * 2D textures it must be 0.
+ */
+static inline void textureSubImage2D(GLuint texture, GLenum target,
+                                     GLint level, GLint face, GLsizei width,
+                                     GLsizei height, GLenum format,
+                                     GLenum type, const void *pixels) {
+    DEBUG_ASSERT(0 != texture);
+    DEBUG_ASSERT(GL_TEXTURE_2D != target || 0 == face);
+    if (hasDirectStateAccess()) {
+        if (GL_TEXTURE_2D != target) {
+            glTextureSubImage3D(texture, level, 0, 0, face, width, height, 1,
+                                format, type, pixels);
+        } else {
+            glTextureSubImage2D(texture, level, 0, 0, width, height, format,
+                                type, pixels);
+        }
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), target, texture);
+        if (GL_TEXTURE_2D_ARRAY == target) {
+            glTexSubImage3D(target, level, 0, 0, face, width, height, 1,
+                            format, type, pixels);
+        } else {
+            GLenum imageTarget = GL_TEXTURE_CUBE_MAP == target
+                                     ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face
+                                     : target;
+            glTexSubImage2D(imageTarget, level, 0, 0, width, height, format,
+                            type, pixels);
+        }
+    }
+    assertNoError();
+}
+
+/*
+ * Uploads pixels into the rectangle at (x, y) of `level` of a GL_TEXTURE_2D
+ */
+static inline void textureSubRect2D(GLuint texture, GLint level, GLint x,
+                                    GLint y, GLsizei width, GLsizei height,
+                                    GLenum format, GLenum type,
+                                    const void *pixels) {
+    DEBUG_ASSERT(0 != texture);
+    if (hasDirectStateAccess()) {
+        glTextureSubImage2D(texture, level, x, y, width, height, format, type,
+                            pixels);
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), GL_TEXTURE_2D,
+                                        texture);
+        glTexSubImage2D(GL_TEXTURE_2D, level, x, y, width, height, format,
+                        type, pixels);
+    }
+    assertNoError();
+}
+
+/*
+ * Same as textureSubImage2D for block compressed levels. `size` is the size
+ * of the whole level in bytes and `internalFormat` the one of the storage.
+ */
+static inline void compressedTextureSubImage2D(GLuint texture, GLenum target,
+                                               GLint level, GLint face,
+                                               GLsizei width, GLsizei height,
+                                               GLenum internalFormat,
+                                               GLsizei size, const void *data) {
+    DEBUG_ASSERT(0 != texture);
+    DEBUG_ASSERT(GL_TEXTURE_2D != target || 0 == face);
+    if (hasDirectStateAccess()) {
+        if (GL_TEXTURE_2D != target) {
+            glCompressedTextureSubImage3D(texture, level, 0, 0, face, width,
+                                          height, 1, internalFormat, size,
+                                          data);
+        } else {
+            glCompressedTextureSubImage2D(texture, level, 0, 0, width, height,
+                                          internalFormat, size, data);
+        }
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), target, texture);
+        if (GL_TEXTURE_2D_ARRAY == target) {
+            glCompressedTexSubImage3D(target, level, 0, 0, face, width,
+                                      height, 1, internalFormat, size, data);
+        } else {
+            GLenum imageTarget = GL_TEXTURE_CUBE_MAP == target
+                                     ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face
+                                     : target;
+            glCompressedTexSubImage2D(imageTarget, level, 0, 0, width, height,
+                                      internalFormat, size, data);
+        }
+    }
+    assertNoError();
+}
+
+static inline void textureParameter(GLuint texture, GLenum target,
+                                    GLenum name, GLint value) {
+    DEBUG_ASSERT(0 != texture);
+    if (hasDirectStateAccess()) {
+        glTextureParameteri(texture, name, value);
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), target, texture);
+        glTexParameteri(target, name, value);
+    }
+    assertNoError();
+}
+
+static inline void generateMipmap(GLuint texture, GLenum target) {
+    DEBUG_ASSERT(0 != texture);
+    if (hasDirectStateAccess()) {
+        glGenerateTextureMipmap(texture);
+    } else {
+        GLStateCache::get().bindTexture(editTextureUnit(), target, texture);
+        glGenerateMipmap(target);
+    }
+    assertNoError();
+}
+// endregion
+
+} // namespace gl
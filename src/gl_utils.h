@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include "GLStateCache.h"
 #include "assertions.h"
 #include <GL/gl.h>
 #include <GL/glu.h>
@@ -50,16 +51,17 @@ static inline void assertNoError() {
 #endif
 }
 
+/*
+ * The getters below read the shadowed state from GLStateCache, so they don't
+ * stall the pipeline with glGet*
+ */
 static inline int getCurrentSSBO() {
-    GLint prog = 0;
-    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_BINDING, &prog);
-    return prog;
+    return static_cast<int>(
+        GLStateCache::get().boundBuffer(GL_SHADER_STORAGE_BUFFER));
 }
 
 static inline int getCurrentProgram() { // NOLINT(*-reserved-identifier)
-    GLint prog = 0;
-    glGetIntegerv(GL_CURRENT_PROGRAM, &prog);
-    return prog;
+    return static_cast<int>(GLStateCache::get().currentProgram());
 }
 
 static inline int getMaxTextureUnits() {
@@ -69,11 +71,8 @@ static inline int getMaxTextureUnits() {
 }
 
 static inline int getCurrentTexture(int textureUnit) {
-    int val;
-    glActiveTexture(GL_TEXTURE0 + textureUnit);
-    glGetIntegerv(GL_TEXTURE_BINDING_2D, &val);
-    glActiveTexture(0);
-    return val;
+    return static_cast<int>(
+        GLStateCache::get().boundTexture(textureUnit, GL_TEXTURE_2D));
 }
 
 } // namespace gl
@@ -21,41 +21,80 @@
 #include "scenes/SceneTriangle.h"
 
 int main() {
-    GLFWcontext::inContext([]() {
+    auto start = std::chrono::steady_clock::now();
+    GLFWcontext::inContext([start]() {
         auto window = GLWindow::create("ZPG").value();
 
-        window->inContext([&window]() -> void {
+        window->inContext([&window, start]() -> void {
             auto assetManager = std::make_shared<AssetManager>("./assets");
             print_gl_info();
-            auto forest = std::make_shared<SceneForest>(window, assetManager);
-            auto forest2 = std::make_shared<SceneForest>(window, assetManager);
-            auto fps = std::make_shared<SceneFpsDisplay>(std::move(forest));
-            auto suziScene = std::make_shared<SceneSuzi>(window, assetManager);
-            auto ballsScene =
-                std::make_shared<SceneLightningBalls>(window, assetManager);
-            auto basicTextureScene =
-                std::make_shared<SceneHeloTexture>(window, assetManager);
-            auto modelScene = std::make_shared<SceneModels>(window, assetManager);
 
-            auto mainScene = SceneSwitcher();
-            mainScene.addScene(forest2);
-            mainScene.addScene(basicTextureScene);
-            mainScene.addScene(modelScene);
-            mainScene.addScene(fps);
-            mainScene.addScene(suziScene);
-            mainScene.addScene(ballsScene);
+            // Scenes are constructed when they are first opened
+            auto mainScene = SceneSwitcher(assetManager);
             mainScene.addScene(
-                std::make_shared<SceneTriangle>(window, assetManager));
+                "forest",
+                [=]() {
+                    return std::make_shared<SceneForest>(window, assetManager);
+                },
+                SceneForest::prefetch);
             mainScene.addScene(
-                std::make_shared<SceneTreeLights>(window, assetManager));
+                "basic-texture-plane",
+                [=]() {
+                    return std::make_shared<SceneHeloTexture>(window,
+                                                              assetManager);
+                },
+                SceneHeloTexture::prefetch);
+            mainScene.addScene(
+                "models",
+                [=]() {
+                    return std::make_shared<SceneModels>(window, assetManager);
+                },
+                SceneModels::prefetch);
+            mainScene.addScene(
+                "fps-display",
+                [=]() {
+                    return std::make_shared<SceneFpsDisplay>(
+                        std::make_shared<SceneForest>(window, assetManager));
+                },
+                SceneForest::prefetch);
+            mainScene.addScene(
+                "suzi",
+                [=]() {
+                    return std::make_shared<SceneSuzi>(window, assetManager);
+                },
+                SceneSuzi::prefetch);
+            mainScene.addScene("lightning-balls", [=]() {
+                return std::make_shared<SceneLightningBalls>(window,
+                                                             assetManager);
+            });
+            mainScene.addScene("basic-triangle", [=]() {
+                return std::make_shared<SceneTriangle>(window, assetManager);
+            });
+            mainScene.addScene(
+                "forest-lights",
+                [=]() {
+                    return std::make_shared<SceneTreeLights>(window,
+                                                             assetManager);
+                });
 
+            bool firstFrame = true;
             while (!window->shouldClose()) {
                 if (mainScene.shouldExit()) {
                     window->close();
                 }
                 window->startFrame();
+                // Textures and models loaded asynchronously, a few ms a frame
+                assetManager->processUploads(std::chrono::milliseconds(4));
                 mainScene.render();
                 window->endFrame();
+                if (firstFrame) {
+                    auto elapsed =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - start);
+                    std::cout << "First frame after " << elapsed.count()
+                              << " ms" << std::endl;
+                    firstFrame = false;
+                }
             }
         });
     });
@@ -1,2896 +0,0 @@
-/**
- * @file sphere.h
- *
- * @brief Sphere model (Smooth) 
- * 
- * @details  Command for rendering 
- *           glDrawArrays(GL_TRIANGLES, 0, 2880);
- *
- * @author Martin Nemec
- * 
- * @year 2023
- **/
-
-
-const float sphere[17280] = {
--0.831470f , -0.555570f , 0.000000f , -0.833338f , -0.552751f , 0.000000f , 
--0.923880f , -0.382683f , 0.000000f , -0.924741f , -0.380535f , 0.000000f , 
--0.815493f , -0.555570f , -0.162212f , -0.817316f , -0.552751f , -0.162572f , 
--0.923880f , 0.382683f , 0.000000f , -0.924741f , 0.380535f , 0.000000f , 
--0.831470f , 0.555570f , 0.000000f , -0.833338f , 0.552751f , 0.000000f , 
--0.906127f , 0.382683f , -0.180240f , -0.906980f , 0.380535f , -0.180395f , 
--0.707107f , -0.707107f , 0.000000f , -0.710135f , -0.704031f , 0.000000f , 
--0.831470f , -0.555570f , 0.000000f , -0.833338f , -0.552751f , 0.000000f , 
--0.693520f , -0.707107f , -0.137950f , -0.696493f , -0.704031f , -0.138524f , 
--0.980785f , 0.195090f , 0.000000f , -0.980987f , 0.193915f , 0.000000f , 
--0.923880f , 0.382683f , 0.000000f , -0.924741f , 0.380535f , 0.000000f , 
--0.961940f , 0.195090f , -0.191342f , -0.962157f , 0.193915f , -0.191382f , 
--0.382683f , 0.923880f , 0.000000f , -0.387860f , 0.921690f , 0.000000f , 
--0.195090f , 0.980785f , 0.000000f , -0.200964f , 0.979583f , 0.000000f , 
--0.375330f , 0.923880f , -0.074658f , -0.380413f , 0.921690f , -0.075655f , 
--0.555570f , -0.831470f , 0.000000f , -0.559771f , -0.828639f , 0.000000f , 
--0.707107f , -0.707107f , 0.000000f , -0.710135f , -0.704031f , 0.000000f , 
--0.544895f , -0.831470f , -0.108386f , -0.548997f , -0.828639f , -0.109195f , 
--1.000000f , 0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , 
--0.980785f , 0.195090f , 0.000000f , -0.980987f , 0.193915f , 0.000000f , 
--0.980785f , 0.000000f , -0.195090f , -0.980773f , 0.000000f , -0.195074f , 
--0.555570f , 0.831470f , 0.000000f , -0.559771f , 0.828639f , 0.000000f , 
--0.382683f , 0.923880f , 0.000000f , -0.387860f , 0.921690f , 0.000000f , 
--0.544895f , 0.831470f , -0.108386f , -0.548997f , 0.828639f , -0.109195f , 
--0.382683f , -0.923880f , 0.000000f , -0.387860f , -0.921690f , 0.000000f , 
--0.555570f , -0.831470f , 0.000000f , -0.559771f , -0.828639f , 0.000000f , 
--0.375330f , -0.923880f , -0.074658f , -0.380413f , -0.921690f , -0.075655f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--1.000000f , 0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , 
--0.961940f , -0.195090f , -0.191342f , -0.962157f , -0.193915f , -0.191382f , 
--0.707107f , 0.707107f , 0.000000f , -0.710135f , 0.704031f , 0.000000f , 
--0.555570f , 0.831470f , 0.000000f , -0.559771f , 0.828639f , 0.000000f , 
--0.693520f , 0.707107f , -0.137950f , -0.696493f , 0.704031f , -0.138524f , 
--0.195090f , -0.980785f , 0.000000f , -0.200964f , -0.979583f , 0.000000f , 
--0.382683f , -0.923880f , 0.000000f , -0.387860f , -0.921690f , 0.000000f , 
--0.191341f , -0.980785f , -0.038060f , -0.197089f , -0.979583f , -0.039186f , 
--0.923880f , -0.382683f , 0.000000f , -0.924741f , -0.380535f , 0.000000f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--0.906127f , -0.382683f , -0.180240f , -0.906980f , -0.380535f , -0.180395f , 
--0.831470f , 0.555570f , 0.000000f , -0.833338f , 0.552751f , 0.000000f , 
--0.707107f , 0.707107f , 0.000000f , -0.710135f , 0.704031f , 0.000000f , 
--0.815493f , 0.555570f , -0.162212f , -0.817316f , 0.552751f , -0.162572f , 
--0.815493f , -0.555570f , -0.162212f , -0.817316f , -0.552751f , -0.162572f , 
--0.906127f , -0.382683f , -0.180240f , -0.906980f , -0.380535f , -0.180395f , 
--0.768178f , -0.555570f , -0.318190f , -0.769890f , -0.552751f , -0.318888f , 
--0.906127f , 0.382683f , -0.180240f , -0.906980f , 0.380535f , -0.180395f , 
--0.815493f , 0.555570f , -0.162212f , -0.817316f , 0.552751f , -0.162572f , 
--0.853553f , 0.382683f , -0.353553f , -0.854366f , 0.380535f , -0.353862f , 
--0.693520f , -0.707107f , -0.137950f , -0.696493f , -0.704031f , -0.138524f , 
--0.815493f , -0.555570f , -0.162212f , -0.817316f , -0.552751f , -0.162572f , 
--0.653281f , -0.707107f , -0.270598f , -0.656056f , -0.704031f , -0.271737f , 
--0.961940f , 0.195090f , -0.191342f , -0.962157f , 0.193915f , -0.191382f , 
--0.906127f , 0.382683f , -0.180240f , -0.906980f , 0.380535f , -0.180395f , 
--0.906127f , 0.195090f , -0.375330f , -0.906339f , 0.193915f , -0.375408f , 
--0.375330f , 0.923880f , -0.074658f , -0.380413f , 0.921690f , -0.075655f , 
--0.191342f , 0.980785f , -0.038060f , -0.197089f , 0.979583f , -0.039186f , 
--0.353553f , 0.923880f , -0.146447f , -0.358348f , 0.921690f , -0.148412f , 
--0.544895f , -0.831470f , -0.108386f , -0.548997f , -0.828639f , -0.109195f , 
--0.693520f , -0.707107f , -0.137950f , -0.696493f , -0.704031f , -0.138524f , 
--0.513280f , -0.831470f , -0.212608f , -0.517136f , -0.828639f , -0.214209f , 
--0.980785f , 0.000000f , -0.195090f , -0.980773f , 0.000000f , -0.195074f , 
--0.961940f , 0.195090f , -0.191342f , -0.962157f , 0.193915f , -0.191382f , 
--0.923880f , 0.000000f , -0.382684f , -0.923856f , 0.000000f , -0.382672f , 
--0.544895f , 0.831470f , -0.108386f , -0.548997f , 0.828639f , -0.109195f , 
--0.375330f , 0.923880f , -0.074658f , -0.380413f , 0.921690f , -0.075655f , 
--0.513280f , 0.831470f , -0.212608f , -0.517136f , 0.828639f , -0.214209f , 
--0.375330f , -0.923880f , -0.074658f , -0.380413f , -0.921690f , -0.075655f , 
--0.544895f , -0.831470f , -0.108386f , -0.548997f , -0.828639f , -0.109195f , 
--0.353553f , -0.923880f , -0.146447f , -0.358348f , -0.921690f , -0.148412f , 
--0.961940f , -0.195090f , -0.191342f , -0.962157f , -0.193915f , -0.191382f , 
--0.980785f , 0.000000f , -0.195090f , -0.980773f , 0.000000f , -0.195074f , 
--0.906127f , -0.195090f , -0.375330f , -0.906339f , -0.193915f , -0.375408f , 
--0.693520f , 0.707107f , -0.137950f , -0.696493f , 0.704031f , -0.138524f , 
--0.544895f , 0.831470f , -0.108386f , -0.548997f , 0.828639f , -0.109195f , 
--0.653281f , 0.707107f , -0.270598f , -0.656056f , 0.704031f , -0.271737f , 
--0.191341f , -0.980785f , -0.038060f , -0.197089f , -0.979583f , -0.039186f , 
--0.375330f , -0.923880f , -0.074658f , -0.380413f , -0.921690f , -0.075655f , 
--0.180240f , -0.980785f , -0.074658f , -0.185644f , -0.979583f , -0.076907f , 
--0.906127f , -0.382683f , -0.180240f , -0.906980f , -0.380535f , -0.180395f , 
--0.961940f , -0.195090f , -0.191342f , -0.962157f , -0.193915f , -0.191382f , 
--0.853553f , -0.382683f , -0.353554f , -0.854366f , -0.380535f , -0.353862f , 
--0.815493f , 0.555570f , -0.162212f , -0.817316f , 0.552751f , -0.162572f , 
--0.693520f , 0.707107f , -0.137950f , -0.696493f , 0.704031f , -0.138524f , 
--0.768178f , 0.555570f , -0.318190f , -0.769890f , 0.552751f , -0.318888f , 
--0.653281f , 0.707107f , -0.270598f , -0.656056f , 0.704031f , -0.271737f , 
--0.513280f , 0.831470f , -0.212608f , -0.517136f , 0.828639f , -0.214209f , 
--0.587938f , 0.707107f , -0.392848f , -0.590442f , 0.704031f , -0.394513f , 
--0.180240f , -0.980785f , -0.074658f , -0.185644f , -0.979583f , -0.076907f , 
--0.353553f , -0.923880f , -0.146447f , -0.358348f , -0.921690f , -0.148412f , 
--0.162211f , -0.980785f , -0.108386f , -0.167089f , -0.979583f , -0.111637f , 
--0.853553f , -0.382683f , -0.353554f , -0.854366f , -0.380535f , -0.353862f , 
--0.906127f , -0.195090f , -0.375330f , -0.906339f , -0.193915f , -0.375408f , 
--0.768178f , -0.382683f , -0.513280f , -0.768914f , -0.380535f , -0.513749f , 
--0.768178f , 0.555570f , -0.318190f , -0.769890f , 0.552751f , -0.318888f , 
--0.653281f , 0.707107f , -0.270598f , -0.656056f , 0.704031f , -0.271737f , 
--0.691342f , 0.555570f , -0.461940f , -0.692892f , 0.552751f , -0.462966f , 
--0.768178f , -0.555570f , -0.318190f , -0.769890f , -0.552751f , -0.318888f , 
--0.853553f , -0.382683f , -0.353554f , -0.854366f , -0.380535f , -0.353862f , 
--0.691342f , -0.555570f , -0.461940f , -0.692892f , -0.552751f , -0.462966f , 
--0.853553f , 0.382683f , -0.353553f , -0.854366f , 0.380535f , -0.353862f , 
--0.768178f , 0.555570f , -0.318190f , -0.769890f , 0.552751f , -0.318888f , 
--0.768178f , 0.382683f , -0.513280f , -0.768914f , 0.380535f , -0.513749f , 
--0.653281f , -0.707107f , -0.270598f , -0.656056f , -0.704031f , -0.271737f , 
--0.768178f , -0.555570f , -0.318190f , -0.769890f , -0.552751f , -0.318888f , 
--0.587938f , -0.707107f , -0.392848f , -0.590442f , -0.704031f , -0.394513f , 
--0.906127f , 0.195090f , -0.375330f , -0.906339f , 0.193915f , -0.375408f , 
--0.853553f , 0.382683f , -0.353553f , -0.854366f , 0.380535f , -0.353862f , 
--0.815493f , 0.195090f , -0.544895f , -0.815668f , 0.193915f , -0.545000f , 
--0.353553f , 0.923880f , -0.146447f , -0.358348f , 0.921690f , -0.148412f , 
--0.180240f , 0.980785f , -0.074658f , -0.185644f , 0.979583f , -0.076876f , 
--0.318190f , 0.923880f , -0.212608f , -0.322489f , 0.921690f , -0.215491f , 
--0.513280f , -0.831470f , -0.212608f , -0.517136f , -0.828639f , -0.214209f , 
--0.653281f , -0.707107f , -0.270598f , -0.656056f , -0.704031f , -0.271737f , 
--0.461940f , -0.831470f , -0.308658f , -0.465407f , -0.828639f , -0.310984f , 
--0.923880f , 0.000000f , -0.382684f , -0.923856f , 0.000000f , -0.382672f , 
--0.906127f , 0.195090f , -0.375330f , -0.906339f , 0.193915f , -0.375408f , 
--0.831470f , 0.000000f , -0.555570f , -0.831446f , 0.000000f , -0.555559f , 
--0.513280f , 0.831470f , -0.212608f , -0.517136f , 0.828639f , -0.214209f , 
--0.353553f , 0.923880f , -0.146447f , -0.358348f , 0.921690f , -0.148412f , 
--0.461940f , 0.831470f , -0.308658f , -0.465407f , 0.828639f , -0.310984f , 
--0.353553f , -0.923880f , -0.146447f , -0.358348f , -0.921690f , -0.148412f , 
--0.513280f , -0.831470f , -0.212608f , -0.517136f , -0.828639f , -0.214209f , 
--0.318189f , -0.923880f , -0.212608f , -0.322489f , -0.921690f , -0.215491f , 
--0.906127f , -0.195090f , -0.375330f , -0.906339f , -0.193915f , -0.375408f , 
--0.923880f , 0.000000f , -0.382684f , -0.923856f , 0.000000f , -0.382672f , 
--0.815493f , -0.195090f , -0.544895f , -0.815668f , -0.193915f , -0.545000f , 
--0.831470f , 0.000000f , -0.555570f , -0.831446f , 0.000000f , -0.555559f , 
--0.815493f , 0.195090f , -0.544895f , -0.815668f , 0.193915f , -0.545000f , 
--0.707107f , 0.000000f , -0.707107f , -0.707083f , 0.000000f , -0.707083f , 
--0.461940f , 0.831470f , -0.308658f , -0.465407f , 0.828639f , -0.310984f , 
--0.318190f , 0.923880f , -0.212608f , -0.322489f , 0.921690f , -0.215491f , 
--0.392847f , 0.831470f , -0.392848f , -0.395795f , 0.828639f , -0.395795f , 
--0.318189f , -0.923880f , -0.212608f , -0.322489f , -0.921690f , -0.215491f , 
--0.461940f , -0.831470f , -0.308658f , -0.465407f , -0.828639f , -0.310984f , 
--0.270598f , -0.923880f , -0.270598f , -0.274270f , -0.921690f , -0.274270f , 
--0.815493f , -0.195090f , -0.544895f , -0.815668f , -0.193915f , -0.545000f , 
--0.831470f , 0.000000f , -0.555570f , -0.831446f , 0.000000f , -0.555559f , 
--0.693520f , -0.195090f , -0.693520f , -0.693655f , -0.193915f , -0.693655f , 
--0.587938f , 0.707107f , -0.392848f , -0.590442f , 0.704031f , -0.394513f , 
--0.461940f , 0.831470f , -0.308658f , -0.465407f , 0.828639f , -0.310984f , 
--0.500000f , 0.707107f , -0.500000f , -0.502121f , 0.704031f , -0.502121f , 
--0.162211f , -0.980785f , -0.108386f , -0.167089f , -0.979583f , -0.111637f , 
--0.318189f , -0.923880f , -0.212608f , -0.322489f , -0.921690f , -0.215491f , 
--0.137949f , -0.980785f , -0.137950f , -0.142094f , -0.979583f , -0.142094f , 
--0.768178f , -0.382683f , -0.513280f , -0.768914f , -0.380535f , -0.513749f , 
--0.815493f , -0.195090f , -0.544895f , -0.815668f , -0.193915f , -0.545000f , 
--0.653281f , -0.382683f , -0.653282f , -0.653890f , -0.380535f , -0.653890f , 
--0.691342f , 0.555570f , -0.461940f , -0.692892f , 0.552751f , -0.462966f , 
--0.587938f , 0.707107f , -0.392848f , -0.590442f , 0.704031f , -0.394513f , 
--0.587938f , 0.555570f , -0.587938f , -0.589251f , 0.552751f , -0.589251f , 
--0.691342f , -0.555570f , -0.461940f , -0.692892f , -0.552751f , -0.462966f , 
--0.768178f , -0.382683f , -0.513280f , -0.768914f , -0.380535f , -0.513749f , 
--0.587938f , -0.555570f , -0.587938f , -0.589251f , -0.552751f , -0.589251f , 
--0.768178f , 0.382683f , -0.513280f , -0.768914f , 0.380535f , -0.513749f , 
--0.691342f , 0.555570f , -0.461940f , -0.692892f , 0.552751f , -0.462966f , 
--0.653281f , 0.382683f , -0.653282f , -0.653890f , 0.380535f , -0.653890f , 
--0.587938f , -0.707107f , -0.392848f , -0.590442f , -0.704031f , -0.394513f , 
--0.691342f , -0.555570f , -0.461940f , -0.692892f , -0.552751f , -0.462966f , 
--0.500000f , -0.707107f , -0.500000f , -0.502121f , -0.704031f , -0.502121f , 
--0.815493f , 0.195090f , -0.544895f , -0.815668f , 0.193915f , -0.545000f , 
--0.768178f , 0.382683f , -0.513280f , -0.768914f , 0.380535f , -0.513749f , 
--0.693520f , 0.195090f , -0.693520f , -0.693655f , 0.193915f , -0.693655f , 
--0.318190f , 0.923880f , -0.212608f , -0.322489f , 0.921690f , -0.215491f , 
--0.162212f , 0.980785f , -0.108387f , -0.167089f , 0.979583f , -0.111637f , 
--0.270598f , 0.923880f , -0.270598f , -0.274270f , 0.921690f , -0.274270f , 
--0.461940f , -0.831470f , -0.308658f , -0.465407f , -0.828639f , -0.310984f , 
--0.587938f , -0.707107f , -0.392848f , -0.590442f , -0.704031f , -0.394513f , 
--0.392847f , -0.831470f , -0.392848f , -0.395795f , -0.828639f , -0.395795f , 
--0.500000f , -0.707107f , -0.500000f , -0.502121f , -0.704031f , -0.502121f , 
--0.587938f , -0.555570f , -0.587938f , -0.589251f , -0.552751f , -0.589251f , 
--0.392847f , -0.707107f , -0.587938f , -0.394513f , -0.704031f , -0.590442f , 
--0.693520f , 0.195090f , -0.693520f , -0.693655f , 0.193915f , -0.693655f , 
--0.653281f , 0.382683f , -0.653282f , -0.653890f , 0.380535f , -0.653890f , 
--0.544895f , 0.195090f , -0.815493f , -0.545000f , 0.193915f , -0.815668f , 
--0.270598f , 0.923880f , -0.270598f , -0.274270f , 0.921690f , -0.274270f , 
--0.137950f , 0.980785f , -0.137950f , -0.142094f , 0.979583f , -0.142094f , 
--0.212607f , 0.923880f , -0.318190f , -0.215491f , 0.921690f , -0.322489f , 
--0.392847f , -0.831470f , -0.392848f , -0.395795f , -0.828639f , -0.395795f , 
--0.500000f , -0.707107f , -0.500000f , -0.502121f , -0.704031f , -0.502121f , 
--0.308658f , -0.831470f , -0.461940f , -0.310984f , -0.828639f , -0.465407f , 
--0.707107f , 0.000000f , -0.707107f , -0.707083f , 0.000000f , -0.707083f , 
--0.693520f , 0.195090f , -0.693520f , -0.693655f , 0.193915f , -0.693655f , 
--0.555570f , 0.000000f , -0.831470f , -0.555559f , 0.000000f , -0.831446f , 
--0.392847f , 0.831470f , -0.392848f , -0.395795f , 0.828639f , -0.395795f , 
--0.270598f , 0.923880f , -0.270598f , -0.274270f , 0.921690f , -0.274270f , 
--0.308658f , 0.831470f , -0.461940f , -0.310984f , 0.828639f , -0.465407f , 
--0.270598f , -0.923880f , -0.270598f , -0.274270f , -0.921690f , -0.274270f , 
--0.392847f , -0.831470f , -0.392848f , -0.395795f , -0.828639f , -0.395795f , 
--0.212607f , -0.923880f , -0.318190f , -0.215491f , -0.921690f , -0.322489f , 
--0.693520f , -0.195090f , -0.693520f , -0.693655f , -0.193915f , -0.693655f , 
--0.707107f , 0.000000f , -0.707107f , -0.707083f , 0.000000f , -0.707083f , 
--0.544895f , -0.195090f , -0.815493f , -0.545000f , -0.193915f , -0.815668f , 
--0.500000f , 0.707107f , -0.500000f , -0.502121f , 0.704031f , -0.502121f , 
--0.392847f , 0.831470f , -0.392848f , -0.395795f , 0.828639f , -0.395795f , 
--0.392847f , 0.707107f , -0.587938f , -0.394513f , 0.704031f , -0.590442f , 
--0.137949f , -0.980785f , -0.137950f , -0.142094f , -0.979583f , -0.142094f , 
--0.270598f , -0.923880f , -0.270598f , -0.274270f , -0.921690f , -0.274270f , 
--0.108386f , -0.980785f , -0.162212f , -0.111637f , -0.979583f , -0.167089f , 
--0.653281f , -0.382683f , -0.653282f , -0.653890f , -0.380535f , -0.653890f , 
--0.693520f , -0.195090f , -0.693520f , -0.693655f , -0.193915f , -0.693655f , 
--0.513280f , -0.382683f , -0.768178f , -0.513749f , -0.380535f , -0.768914f , 
--0.587938f , 0.555570f , -0.587938f , -0.589251f , 0.552751f , -0.589251f , 
--0.500000f , 0.707107f , -0.500000f , -0.502121f , 0.704031f , -0.502121f , 
--0.461940f , 0.555570f , -0.691342f , -0.462966f , 0.552751f , -0.692892f , 
--0.587938f , -0.555570f , -0.587938f , -0.589251f , -0.552751f , -0.589251f , 
--0.653281f , -0.382683f , -0.653282f , -0.653890f , -0.380535f , -0.653890f , 
--0.461940f , -0.555570f , -0.691342f , -0.462966f , -0.552751f , -0.692892f , 
--0.653281f , 0.382683f , -0.653282f , -0.653890f , 0.380535f , -0.653890f , 
--0.587938f , 0.555570f , -0.587938f , -0.589251f , 0.552751f , -0.589251f , 
--0.513280f , 0.382683f , -0.768178f , -0.513749f , 0.380535f , -0.768914f , 
--0.461940f , -0.555570f , -0.691342f , -0.462966f , -0.552751f , -0.692892f , 
--0.513280f , -0.382683f , -0.768178f , -0.513749f , -0.380535f , -0.768914f , 
--0.318189f , -0.555570f , -0.768178f , -0.318888f , -0.552751f , -0.769890f , 
--0.513280f , 0.382683f , -0.768178f , -0.513749f , 0.380535f , -0.768914f , 
--0.461940f , 0.555570f , -0.691342f , -0.462966f , 0.552751f , -0.692892f , 
--0.353553f , 0.382683f , -0.853554f , -0.353862f , 0.380535f , -0.854366f , 
--0.392847f , -0.707107f , -0.587938f , -0.394513f , -0.704031f , -0.590442f , 
--0.461940f , -0.555570f , -0.691342f , -0.462966f , -0.552751f , -0.692892f , 
--0.270598f , -0.707107f , -0.653282f , -0.271737f , -0.704031f , -0.656056f , 
--0.544895f , 0.195090f , -0.815493f , -0.545000f , 0.193915f , -0.815668f , 
--0.513280f , 0.382683f , -0.768178f , -0.513749f , 0.380535f , -0.768914f , 
--0.375330f , 0.195090f , -0.906128f , -0.375408f , 0.193915f , -0.906339f , 
--0.212607f , 0.923880f , -0.318190f , -0.215491f , 0.921690f , -0.322489f , 
--0.108386f , 0.980785f , -0.162212f , -0.111637f , 0.979583f , -0.167089f , 
--0.146446f , 0.923880f , -0.353554f , -0.148412f , 0.921690f , -0.358348f , 
--0.308658f , -0.831470f , -0.461940f , -0.310984f , -0.828639f , -0.465407f , 
--0.392847f , -0.707107f , -0.587938f , -0.394513f , -0.704031f , -0.590442f , 
--0.212607f , -0.831470f , -0.513280f , -0.214209f , -0.828639f , -0.517136f , 
--0.555570f , 0.000000f , -0.831470f , -0.555559f , 0.000000f , -0.831446f , 
--0.544895f , 0.195090f , -0.815493f , -0.545000f , 0.193915f , -0.815668f , 
--0.382683f , 0.000000f , -0.923880f , -0.382672f , 0.000000f , -0.923856f , 
--0.308658f , 0.831470f , -0.461940f , -0.310984f , 0.828639f , -0.465407f , 
--0.212607f , 0.923880f , -0.318190f , -0.215491f , 0.921690f , -0.322489f , 
--0.212607f , 0.831470f , -0.513280f , -0.214209f , 0.828639f , -0.517136f , 
--0.212607f , -0.923880f , -0.318190f , -0.215491f , -0.921690f , -0.322489f , 
--0.308658f , -0.831470f , -0.461940f , -0.310984f , -0.828639f , -0.465407f , 
--0.146446f , -0.923880f , -0.353553f , -0.148412f , -0.921690f , -0.358348f , 
--0.544895f , -0.195090f , -0.815493f , -0.545000f , -0.193915f , -0.815668f , 
--0.555570f , 0.000000f , -0.831470f , -0.555559f , 0.000000f , -0.831446f , 
--0.375330f , -0.195090f , -0.906128f , -0.375408f , -0.193915f , -0.906339f , 
--0.392847f , 0.707107f , -0.587938f , -0.394513f , 0.704031f , -0.590442f , 
--0.308658f , 0.831470f , -0.461940f , -0.310984f , 0.828639f , -0.465407f , 
--0.270598f , 0.707107f , -0.653282f , -0.271737f , 0.704031f , -0.656056f , 
--0.108386f , -0.980785f , -0.162212f , -0.111637f , -0.979583f , -0.167089f , 
--0.212607f , -0.923880f , -0.318190f , -0.215491f , -0.921690f , -0.322489f , 
--0.074658f , -0.980785f , -0.180240f , -0.076907f , -0.979583f , -0.185644f , 
--0.513280f , -0.382683f , -0.768178f , -0.513749f , -0.380535f , -0.768914f , 
--0.544895f , -0.195090f , -0.815493f , -0.545000f , -0.193915f , -0.815668f , 
--0.353553f , -0.382683f , -0.853554f , -0.353862f , -0.380535f , -0.854366f , 
--0.461940f , 0.555570f , -0.691342f , -0.462966f , 0.552751f , -0.692892f , 
--0.392847f , 0.707107f , -0.587938f , -0.394513f , 0.704031f , -0.590442f , 
--0.318189f , 0.555570f , -0.768178f , -0.318888f , 0.552751f , -0.769890f , 
--0.270598f , 0.707107f , -0.653282f , -0.271737f , 0.704031f , -0.656056f , 
--0.212607f , 0.831470f , -0.513280f , -0.214209f , 0.828639f , -0.517136f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
--0.074658f , -0.980785f , -0.180240f , -0.076907f , -0.979583f , -0.185644f , 
--0.146446f , -0.923880f , -0.353553f , -0.148412f , -0.921690f , -0.358348f , 
--0.038060f , -0.980785f , -0.191342f , -0.039186f , -0.979583f , -0.197089f , 
--0.353553f , -0.382683f , -0.853554f , -0.353862f , -0.380535f , -0.854366f , 
--0.375330f , -0.195090f , -0.906128f , -0.375408f , -0.193915f , -0.906339f , 
--0.180240f , -0.382683f , -0.906128f , -0.180395f , -0.380535f , -0.906980f , 
--0.318189f , 0.555570f , -0.768178f , -0.318888f , 0.552751f , -0.769890f , 
--0.270598f , 0.707107f , -0.653282f , -0.271737f , 0.704031f , -0.656056f , 
--0.162211f , 0.555570f , -0.815493f , -0.162572f , 0.552751f , -0.817316f , 
--0.318189f , -0.555570f , -0.768178f , -0.318888f , -0.552751f , -0.769890f , 
--0.353553f , -0.382683f , -0.853554f , -0.353862f , -0.380535f , -0.854366f , 
--0.162211f , -0.555570f , -0.815493f , -0.162572f , -0.552751f , -0.817316f , 
--0.353553f , 0.382683f , -0.853554f , -0.353862f , 0.380535f , -0.854366f , 
--0.318189f , 0.555570f , -0.768178f , -0.318888f , 0.552751f , -0.769890f , 
--0.180240f , 0.382683f , -0.906128f , -0.180395f , 0.380535f , -0.906980f , 
--0.270598f , -0.707107f , -0.653282f , -0.271737f , -0.704031f , -0.656056f , 
--0.318189f , -0.555570f , -0.768178f , -0.318888f , -0.552751f , -0.769890f , 
--0.137949f , -0.707107f , -0.693520f , -0.138524f , -0.704031f , -0.696493f , 
--0.375330f , 0.195090f , -0.906128f , -0.375408f , 0.193915f , -0.906339f , 
--0.353553f , 0.382683f , -0.853554f , -0.353862f , 0.380535f , -0.854366f , 
--0.191341f , 0.195090f , -0.961940f , -0.191382f , 0.193915f , -0.962157f , 
--0.146446f , 0.923880f , -0.353554f , -0.148412f , 0.921690f , -0.358348f , 
--0.074658f , 0.980785f , -0.180240f , -0.076907f , 0.979583f , -0.185644f , 
--0.074658f , 0.923880f , -0.375331f , -0.075655f , 0.921690f , -0.380413f , 
--0.212607f , -0.831470f , -0.513280f , -0.214209f , -0.828639f , -0.517136f , 
--0.270598f , -0.707107f , -0.653282f , -0.271737f , -0.704031f , -0.656056f , 
--0.108386f , -0.831470f , -0.544895f , -0.109195f , -0.828639f , -0.548997f , 
--0.382683f , 0.000000f , -0.923880f , -0.382672f , 0.000000f , -0.923856f , 
--0.375330f , 0.195090f , -0.906128f , -0.375408f , 0.193915f , -0.906339f , 
--0.195090f , 0.000000f , -0.980785f , -0.195074f , 0.000000f , -0.980773f , 
--0.212607f , 0.831470f , -0.513280f , -0.214209f , 0.828639f , -0.517136f , 
--0.146446f , 0.923880f , -0.353554f , -0.148412f , 0.921690f , -0.358348f , 
--0.108386f , 0.831470f , -0.544895f , -0.109195f , 0.828639f , -0.548997f , 
--0.146446f , -0.923880f , -0.353553f , -0.148412f , -0.921690f , -0.358348f , 
--0.212607f , -0.831470f , -0.513280f , -0.214209f , -0.828639f , -0.517136f , 
--0.074658f , -0.923880f , -0.375330f , -0.075655f , -0.921690f , -0.380413f , 
--0.375330f , -0.195090f , -0.906128f , -0.375408f , -0.193915f , -0.906339f , 
--0.382683f , 0.000000f , -0.923880f , -0.382672f , 0.000000f , -0.923856f , 
--0.191341f , -0.195090f , -0.961940f , -0.191382f , -0.193915f , -0.962157f , 
--0.195090f , 0.000000f , -0.980785f , -0.195074f , 0.000000f , -0.980773f , 
--0.191341f , 0.195090f , -0.961940f , -0.191382f , 0.193915f , -0.962157f , 
-0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 
--0.108386f , 0.831470f , -0.544895f , -0.109195f , 0.828639f , -0.548997f , 
--0.074658f , 0.923880f , -0.375331f , -0.075655f , 0.921690f , -0.380413f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
--0.074658f , -0.923880f , -0.375330f , -0.075655f , -0.921690f , -0.380413f , 
--0.108386f , -0.831470f , -0.544895f , -0.109195f , -0.828639f , -0.548997f , 
-0.000000f , -0.923880f , -0.382684f , 0.000000f , -0.921690f , -0.387860f , 
--0.191341f , -0.195090f , -0.961940f , -0.191382f , -0.193915f , -0.962157f , 
--0.195090f , 0.000000f , -0.980785f , -0.195074f , 0.000000f , -0.980773f , 
-0.000000f , -0.195090f , -0.980785f , 0.000000f , -0.193915f , -0.980987f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
--0.108386f , 0.831470f , -0.544895f , -0.109195f , 0.828639f , -0.548997f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
--0.038060f , -0.980785f , -0.191342f , -0.039186f , -0.979583f , -0.197089f , 
--0.074658f , -0.923880f , -0.375330f , -0.075655f , -0.921690f , -0.380413f , 
-0.000000f , -0.980785f , -0.195090f , 0.000000f , -0.979583f , -0.200964f , 
--0.180240f , -0.382683f , -0.906128f , -0.180395f , -0.380535f , -0.906980f , 
--0.191341f , -0.195090f , -0.961940f , -0.191382f , -0.193915f , -0.962157f , 
-0.000000f , -0.382683f , -0.923880f , 0.000000f , -0.380535f , -0.924741f , 
--0.162211f , 0.555570f , -0.815493f , -0.162572f , 0.552751f , -0.817316f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
-0.000000f , 0.555570f , -0.831470f , 0.000000f , 0.552751f , -0.833338f , 
--0.162211f , -0.555570f , -0.815493f , -0.162572f , -0.552751f , -0.817316f , 
--0.180240f , -0.382683f , -0.906128f , -0.180395f , -0.380535f , -0.906980f , 
-0.000000f , -0.555570f , -0.831470f , 0.000000f , -0.552751f , -0.833338f , 
--0.180240f , 0.382683f , -0.906128f , -0.180395f , 0.380535f , -0.906980f , 
--0.162211f , 0.555570f , -0.815493f , -0.162572f , 0.552751f , -0.817316f , 
-0.000000f , 0.382683f , -0.923880f , 0.000000f , 0.380535f , -0.924741f , 
--0.137949f , -0.707107f , -0.693520f , -0.138524f , -0.704031f , -0.696493f , 
--0.162211f , -0.555570f , -0.815493f , -0.162572f , -0.552751f , -0.817316f , 
-0.000000f , -0.707107f , -0.707107f , 0.000000f , -0.704031f , -0.710135f , 
--0.191341f , 0.195090f , -0.961940f , -0.191382f , 0.193915f , -0.962157f , 
--0.180240f , 0.382683f , -0.906128f , -0.180395f , 0.380535f , -0.906980f , 
-0.000000f , 0.195090f , -0.980785f , 0.000000f , 0.193915f , -0.980987f , 
--0.074658f , 0.923880f , -0.375331f , -0.075655f , 0.921690f , -0.380413f , 
--0.038060f , 0.980785f , -0.191342f , -0.039186f , 0.979583f , -0.197089f , 
-0.000000f , 0.923880f , -0.382684f , 0.000000f , 0.921690f , -0.387860f , 
--0.108386f , -0.831470f , -0.544895f , -0.109195f , -0.828639f , -0.548997f , 
--0.137949f , -0.707107f , -0.693520f , -0.138524f , -0.704031f , -0.696493f , 
-0.000000f , -0.831470f , -0.555570f , 0.000000f , -0.828639f , -0.559771f , 
-0.000000f , -0.707107f , -0.707107f , 0.000000f , -0.704031f , -0.710135f , 
-0.000000f , -0.555570f , -0.831470f , 0.000000f , -0.552751f , -0.833338f , 
-0.137950f , -0.707107f , -0.693520f , 0.138524f , -0.704031f , -0.696493f , 
-0.000000f , 0.195090f , -0.980785f , 0.000000f , 0.193915f , -0.980987f , 
-0.000000f , 0.382683f , -0.923880f , 0.000000f , 0.380535f , -0.924741f , 
-0.191342f , 0.195090f , -0.961940f , 0.191382f , 0.193915f , -0.962157f , 
-0.000000f , 0.923880f , -0.382684f , 0.000000f , 0.921690f , -0.387860f , 
-0.000000f , 0.980785f , -0.195091f , 0.000000f , 0.979583f , -0.200964f , 
-0.074658f , 0.923880f , -0.375330f , 0.075655f , 0.921690f , -0.380413f , 
-0.000000f , -0.831470f , -0.555570f , 0.000000f , -0.828639f , -0.559771f , 
-0.000000f , -0.707107f , -0.707107f , 0.000000f , -0.704031f , -0.710135f , 
-0.108387f , -0.831470f , -0.544895f , 0.109195f , -0.828639f , -0.548997f , 
-0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 
-0.000000f , 0.195090f , -0.980785f , 0.000000f , 0.193915f , -0.980987f , 
-0.195091f , 0.000000f , -0.980785f , 0.195074f , 0.000000f , -0.980773f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
-0.000000f , 0.923880f , -0.382684f , 0.000000f , 0.921690f , -0.387860f , 
-0.108387f , 0.831470f , -0.544895f , 0.109195f , 0.828639f , -0.548997f , 
-0.000000f , -0.923880f , -0.382684f , 0.000000f , -0.921690f , -0.387860f , 
-0.000000f , -0.831470f , -0.555570f , 0.000000f , -0.828639f , -0.559771f , 
-0.074658f , -0.923880f , -0.375330f , 0.075655f , -0.921690f , -0.380413f , 
-0.000000f , -0.195090f , -0.980785f , 0.000000f , -0.193915f , -0.980987f , 
-0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 
-0.191342f , -0.195090f , -0.961940f , 0.191382f , -0.193915f , -0.962157f , 
-0.000000f , 0.707107f , -0.707107f , 0.000000f , 0.704031f , -0.710135f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.000000f , -0.980785f , -0.195090f , 0.000000f , -0.979583f , -0.200964f , 
-0.000000f , -0.923880f , -0.382684f , 0.000000f , -0.921690f , -0.387860f , 
-0.038061f , -0.980785f , -0.191342f , 0.039186f , -0.979583f , -0.197089f , 
-0.000000f , -0.382683f , -0.923880f , 0.000000f , -0.380535f , -0.924741f , 
-0.000000f , -0.195090f , -0.980785f , 0.000000f , -0.193915f , -0.980987f , 
-0.180240f , -0.382683f , -0.906128f , 0.180395f , -0.380535f , -0.906980f , 
-0.000000f , 0.555570f , -0.831470f , 0.000000f , 0.552751f , -0.833338f , 
-0.000000f , 0.707107f , -0.707107f , 0.000000f , 0.704031f , -0.710135f , 
-0.162212f , 0.555570f , -0.815493f , 0.162572f , 0.552751f , -0.817316f , 
-0.000000f , -0.555570f , -0.831470f , 0.000000f , -0.552751f , -0.833338f , 
-0.000000f , -0.382683f , -0.923880f , 0.000000f , -0.380535f , -0.924741f , 
-0.162212f , -0.555570f , -0.815493f , 0.162572f , -0.552751f , -0.817316f , 
-0.000000f , 0.382683f , -0.923880f , 0.000000f , 0.380535f , -0.924741f , 
-0.000000f , 0.555570f , -0.831470f , 0.000000f , 0.552751f , -0.833338f , 
-0.180240f , 0.382683f , -0.906128f , 0.180395f , 0.380535f , -0.906980f , 
-0.162212f , -0.555570f , -0.815493f , 0.162572f , -0.552751f , -0.817316f , 
-0.180240f , -0.382683f , -0.906128f , 0.180395f , -0.380535f , -0.906980f , 
-0.318190f , -0.555570f , -0.768178f , 0.318888f , -0.552751f , -0.769890f , 
-0.180240f , 0.382683f , -0.906128f , 0.180395f , 0.380535f , -0.906980f , 
-0.162212f , 0.555570f , -0.815493f , 0.162572f , 0.552751f , -0.817316f , 
-0.353554f , 0.382683f , -0.853553f , 0.353893f , 0.380535f , -0.854366f , 
-0.137950f , -0.707107f , -0.693520f , 0.138524f , -0.704031f , -0.696493f , 
-0.162212f , -0.555570f , -0.815493f , 0.162572f , -0.552751f , -0.817316f , 
-0.270598f , -0.707107f , -0.653282f , 0.271737f , -0.704031f , -0.656056f , 
-0.191342f , 0.195090f , -0.961940f , 0.191382f , 0.193915f , -0.962157f , 
-0.180240f , 0.382683f , -0.906128f , 0.180395f , 0.380535f , -0.906980f , 
-0.375331f , 0.195090f , -0.906127f , 0.375408f , 0.193915f , -0.906339f , 
-0.074658f , 0.923880f , -0.375330f , 0.075655f , 0.921690f , -0.380413f , 
-0.038061f , 0.980785f , -0.191342f , 0.039186f , 0.979583f , -0.197089f , 
-0.146447f , 0.923880f , -0.353554f , 0.148412f , 0.921690f , -0.358348f , 
-0.108387f , -0.831470f , -0.544895f , 0.109195f , -0.828639f , -0.548997f , 
-0.137950f , -0.707107f , -0.693520f , 0.138524f , -0.704031f , -0.696493f , 
-0.212608f , -0.831470f , -0.513280f , 0.214209f , -0.828639f , -0.517136f , 
-0.195091f , 0.000000f , -0.980785f , 0.195074f , 0.000000f , -0.980773f , 
-0.191342f , 0.195090f , -0.961940f , 0.191382f , 0.193915f , -0.962157f , 
-0.382684f , 0.000000f , -0.923880f , 0.382672f , 0.000000f , -0.923856f , 
-0.108387f , 0.831470f , -0.544895f , 0.109195f , 0.828639f , -0.548997f , 
-0.074658f , 0.923880f , -0.375330f , 0.075655f , 0.921690f , -0.380413f , 
-0.212608f , 0.831470f , -0.513280f , 0.214209f , 0.828639f , -0.517136f , 
-0.074658f , -0.923880f , -0.375330f , 0.075655f , -0.921690f , -0.380413f , 
-0.108387f , -0.831470f , -0.544895f , 0.109195f , -0.828639f , -0.548997f , 
-0.146447f , -0.923880f , -0.353553f , 0.148412f , -0.921690f , -0.358348f , 
-0.191342f , -0.195090f , -0.961940f , 0.191382f , -0.193915f , -0.962157f , 
-0.195091f , 0.000000f , -0.980785f , 0.195074f , 0.000000f , -0.980773f , 
-0.375331f , -0.195090f , -0.906127f , 0.375408f , -0.193915f , -0.906339f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.108387f , 0.831470f , -0.544895f , 0.109195f , 0.828639f , -0.548997f , 
-0.212608f , 0.831470f , -0.513280f , 0.214209f , 0.828639f , -0.517136f , 
-0.038061f , -0.980785f , -0.191342f , 0.039186f , -0.979583f , -0.197089f , 
-0.074658f , -0.923880f , -0.375330f , 0.075655f , -0.921690f , -0.380413f , 
-0.074658f , -0.980785f , -0.180240f , 0.076907f , -0.979583f , -0.185644f , 
-0.180240f , -0.382683f , -0.906128f , 0.180395f , -0.380535f , -0.906980f , 
-0.191342f , -0.195090f , -0.961940f , 0.191382f , -0.193915f , -0.962157f , 
-0.353554f , -0.382683f , -0.853553f , 0.353862f , -0.380535f , -0.854366f , 
-0.162212f , 0.555570f , -0.815493f , 0.162572f , 0.552751f , -0.817316f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.318190f , 0.555570f , -0.768178f , 0.318888f , 0.552751f , -0.769890f , 
-0.074658f , -0.980785f , -0.180240f , 0.076907f , -0.979583f , -0.185644f , 
-0.146447f , -0.923880f , -0.353553f , 0.148412f , -0.921690f , -0.358348f , 
-0.108387f , -0.980785f , -0.162212f , 0.111637f , -0.979583f , -0.167089f , 
-0.353554f , -0.382683f , -0.853553f , 0.353862f , -0.380535f , -0.854366f , 
-0.375331f , -0.195090f , -0.906127f , 0.375408f , -0.193915f , -0.906339f , 
-0.513280f , -0.382683f , -0.768178f , 0.513749f , -0.380535f , -0.768914f , 
-0.318190f , 0.555570f , -0.768178f , 0.318888f , 0.552751f , -0.769890f , 
-0.270598f , 0.707107f , -0.653282f , 0.271737f , 0.704031f , -0.656056f , 
-0.461940f , 0.555570f , -0.691342f , 0.462966f , 0.552751f , -0.692892f , 
-0.318190f , -0.555570f , -0.768178f , 0.318888f , -0.552751f , -0.769890f , 
-0.353554f , -0.382683f , -0.853553f , 0.353862f , -0.380535f , -0.854366f , 
-0.461940f , -0.555570f , -0.691342f , 0.462966f , -0.552751f , -0.692892f , 
-0.353554f , 0.382683f , -0.853553f , 0.353893f , 0.380535f , -0.854366f , 
-0.318190f , 0.555570f , -0.768178f , 0.318888f , 0.552751f , -0.769890f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.270598f , -0.707107f , -0.653282f , 0.271737f , -0.704031f , -0.656056f , 
-0.318190f , -0.555570f , -0.768178f , 0.318888f , -0.552751f , -0.769890f , 
-0.392848f , -0.707107f , -0.587938f , 0.394513f , -0.704031f , -0.590442f , 
-0.375331f , 0.195090f , -0.906127f , 0.375408f , 0.193915f , -0.906339f , 
-0.353554f , 0.382683f , -0.853553f , 0.353893f , 0.380535f , -0.854366f , 
-0.544895f , 0.195090f , -0.815493f , 0.545000f , 0.193915f , -0.815668f , 
-0.146447f , 0.923880f , -0.353554f , 0.148412f , 0.921690f , -0.358348f , 
-0.074658f , 0.980785f , -0.180240f , 0.076907f , 0.979583f , -0.185644f , 
-0.212608f , 0.923880f , -0.318190f , 0.215491f , 0.921690f , -0.322489f , 
-0.212608f , -0.831470f , -0.513280f , 0.214209f , -0.828639f , -0.517136f , 
-0.270598f , -0.707107f , -0.653282f , 0.271737f , -0.704031f , -0.656056f , 
-0.308659f , -0.831470f , -0.461940f , 0.310984f , -0.828639f , -0.465407f , 
-0.382684f , 0.000000f , -0.923880f , 0.382672f , 0.000000f , -0.923856f , 
-0.375331f , 0.195090f , -0.906127f , 0.375408f , 0.193915f , -0.906339f , 
-0.555571f , 0.000000f , -0.831470f , 0.555559f , 0.000000f , -0.831446f , 
-0.212608f , 0.831470f , -0.513280f , 0.214209f , 0.828639f , -0.517136f , 
-0.146447f , 0.923880f , -0.353554f , 0.148412f , 0.921690f , -0.358348f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.146447f , -0.923880f , -0.353553f , 0.148412f , -0.921690f , -0.358348f , 
-0.212608f , -0.831470f , -0.513280f , 0.214209f , -0.828639f , -0.517136f , 
-0.212608f , -0.923880f , -0.318190f , 0.215491f , -0.921690f , -0.322489f , 
-0.375331f , -0.195090f , -0.906127f , 0.375408f , -0.193915f , -0.906339f , 
-0.382684f , 0.000000f , -0.923880f , 0.382672f , 0.000000f , -0.923856f , 
-0.544895f , -0.195090f , -0.815493f , 0.545000f , -0.193915f , -0.815668f , 
-0.270598f , 0.707107f , -0.653282f , 0.271737f , 0.704031f , -0.656056f , 
-0.212608f , 0.831470f , -0.513280f , 0.214209f , 0.828639f , -0.517136f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.212608f , 0.923880f , -0.318190f , 0.215491f , 0.921690f , -0.322489f , 
-0.392848f , 0.831470f , -0.392847f , 0.395795f , 0.828639f , -0.395795f , 
-0.212608f , -0.923880f , -0.318190f , 0.215491f , -0.921690f , -0.322489f , 
-0.308659f , -0.831470f , -0.461940f , 0.310984f , -0.828639f , -0.465407f , 
-0.270598f , -0.923880f , -0.270598f , 0.274270f , -0.921690f , -0.274270f , 
-0.544895f , -0.195090f , -0.815493f , 0.545000f , -0.193915f , -0.815668f , 
-0.555571f , 0.000000f , -0.831470f , 0.555559f , 0.000000f , -0.831446f , 
-0.693520f , -0.195090f , -0.693520f , 0.693655f , -0.193915f , -0.693655f , 
-0.392848f , 0.707107f , -0.587938f , 0.394513f , 0.704031f , -0.590442f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.500000f , 0.707107f , -0.500000f , 0.502121f , 0.704031f , -0.502121f , 
-0.108387f , -0.980785f , -0.162212f , 0.111637f , -0.979583f , -0.167089f , 
-0.212608f , -0.923880f , -0.318190f , 0.215491f , -0.921690f , -0.322489f , 
-0.137950f , -0.980785f , -0.137950f , 0.142094f , -0.979583f , -0.142094f , 
-0.513280f , -0.382683f , -0.768178f , 0.513749f , -0.380535f , -0.768914f , 
-0.544895f , -0.195090f , -0.815493f , 0.545000f , -0.193915f , -0.815668f , 
-0.653282f , -0.382683f , -0.653281f , 0.653890f , -0.380535f , -0.653890f , 
-0.461940f , 0.555570f , -0.691342f , 0.462966f , 0.552751f , -0.692892f , 
-0.392848f , 0.707107f , -0.587938f , 0.394513f , 0.704031f , -0.590442f , 
-0.587938f , 0.555570f , -0.587938f , 0.589251f , 0.552751f , -0.589251f , 
-0.461940f , -0.555570f , -0.691342f , 0.462966f , -0.552751f , -0.692892f , 
-0.513280f , -0.382683f , -0.768178f , 0.513749f , -0.380535f , -0.768914f , 
-0.587938f , -0.555570f , -0.587938f , 0.589251f , -0.552751f , -0.589251f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.461940f , 0.555570f , -0.691342f , 0.462966f , 0.552751f , -0.692892f , 
-0.587938f , 0.555570f , -0.587938f , 0.589251f , 0.552751f , -0.589251f , 
-0.392848f , -0.707107f , -0.587938f , 0.394513f , -0.704031f , -0.590442f , 
-0.461940f , -0.555570f , -0.691342f , 0.462966f , -0.552751f , -0.692892f , 
-0.500000f , -0.707107f , -0.500000f , 0.502121f , -0.704031f , -0.502121f , 
-0.544895f , 0.195090f , -0.815493f , 0.545000f , 0.193915f , -0.815668f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.693520f , 0.195090f , -0.693520f , 0.693655f , 0.193915f , -0.693655f , 
-0.212608f , 0.923880f , -0.318190f , 0.215491f , 0.921690f , -0.322489f , 
-0.108387f , 0.980785f , -0.162212f , 0.111637f , 0.979583f , -0.167089f , 
-0.270599f , 0.923880f , -0.270598f , 0.274270f , 0.921690f , -0.274270f , 
-0.308659f , -0.831470f , -0.461940f , 0.310984f , -0.828639f , -0.465407f , 
-0.392848f , -0.707107f , -0.587938f , 0.394513f , -0.704031f , -0.590442f , 
-0.392848f , -0.831470f , -0.392847f , 0.395795f , -0.828639f , -0.395795f , 
-0.555571f , 0.000000f , -0.831470f , 0.555559f , 0.000000f , -0.831446f , 
-0.544895f , 0.195090f , -0.815493f , 0.545000f , 0.193915f , -0.815668f , 
-0.707107f , 0.000000f , -0.707107f , 0.707083f , 0.000000f , -0.707083f , 
-0.693520f , 0.195090f , -0.693520f , 0.693655f , 0.193915f , -0.693655f , 
-0.653282f , 0.382683f , -0.653281f , 0.653890f , 0.380535f , -0.653890f , 
-0.815493f , 0.195090f , -0.544895f , 0.815668f , 0.193915f , -0.545000f , 
-0.270599f , 0.923880f , -0.270598f , 0.274270f , 0.921690f , -0.274270f , 
-0.137950f , 0.980785f , -0.137950f , 0.142094f , 0.979583f , -0.142094f , 
-0.318190f , 0.923880f , -0.212608f , 0.322489f , 0.921690f , -0.215491f , 
-0.392848f , -0.831470f , -0.392847f , 0.395795f , -0.828639f , -0.395795f , 
-0.500000f , -0.707107f , -0.500000f , 0.502121f , -0.704031f , -0.502121f , 
-0.461940f , -0.831470f , -0.308658f , 0.465407f , -0.828639f , -0.310984f , 
-0.707107f , 0.000000f , -0.707107f , 0.707083f , 0.000000f , -0.707083f , 
-0.693520f , 0.195090f , -0.693520f , 0.693655f , 0.193915f , -0.693655f , 
-0.831470f , 0.000000f , -0.555570f , 0.831446f , 0.000000f , -0.555559f , 
-0.392848f , 0.831470f , -0.392847f , 0.395795f , 0.828639f , -0.395795f , 
-0.270599f , 0.923880f , -0.270598f , 0.274270f , 0.921690f , -0.274270f , 
-0.461940f , 0.831470f , -0.308658f , 0.465407f , 0.828639f , -0.310984f , 
-0.270598f , -0.923880f , -0.270598f , 0.274270f , -0.921690f , -0.274270f , 
-0.392848f , -0.831470f , -0.392847f , 0.395795f , -0.828639f , -0.395795f , 
-0.318190f , -0.923880f , -0.212608f , 0.322489f , -0.921690f , -0.215491f , 
-0.693520f , -0.195090f , -0.693520f , 0.693655f , -0.193915f , -0.693655f , 
-0.707107f , 0.000000f , -0.707107f , 0.707083f , 0.000000f , -0.707083f , 
-0.815493f , -0.195090f , -0.544895f , 0.815668f , -0.193915f , -0.545000f , 
-0.500000f , 0.707107f , -0.500000f , 0.502121f , 0.704031f , -0.502121f , 
-0.392848f , 0.831470f , -0.392847f , 0.395795f , 0.828639f , -0.395795f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.137950f , -0.980785f , -0.137950f , 0.142094f , -0.979583f , -0.142094f , 
-0.270598f , -0.923880f , -0.270598f , 0.274270f , -0.921690f , -0.274270f , 
-0.162212f , -0.980785f , -0.108386f , 0.167089f , -0.979583f , -0.111637f , 
-0.653282f , -0.382683f , -0.653281f , 0.653890f , -0.380535f , -0.653890f , 
-0.693520f , -0.195090f , -0.693520f , 0.693655f , -0.193915f , -0.693655f , 
-0.768178f , -0.382683f , -0.513280f , 0.768914f , -0.380535f , -0.513749f , 
-0.587938f , 0.555570f , -0.587938f , 0.589251f , 0.552751f , -0.589251f , 
-0.500000f , 0.707107f , -0.500000f , 0.502121f , 0.704031f , -0.502121f , 
-0.691342f , 0.555570f , -0.461940f , 0.692892f , 0.552751f , -0.462966f , 
-0.587938f , -0.555570f , -0.587938f , 0.589251f , -0.552751f , -0.589251f , 
-0.653282f , -0.382683f , -0.653281f , 0.653890f , -0.380535f , -0.653890f , 
-0.691342f , -0.555570f , -0.461940f , 0.692892f , -0.552751f , -0.462966f , 
-0.653282f , 0.382683f , -0.653281f , 0.653890f , 0.380535f , -0.653890f , 
-0.587938f , 0.555570f , -0.587938f , 0.589251f , 0.552751f , -0.589251f , 
-0.691342f , 0.555570f , -0.461940f , 0.692892f , 0.552751f , -0.462966f , 
-0.500000f , -0.707107f , -0.500000f , 0.502121f , -0.704031f , -0.502121f , 
-0.587938f , -0.555570f , -0.587938f , 0.589251f , -0.552751f , -0.589251f , 
-0.587938f , -0.707107f , -0.392847f , 0.590442f , -0.704031f , -0.394513f , 
-0.691342f , -0.555570f , -0.461940f , 0.692892f , -0.552751f , -0.462966f , 
-0.768178f , -0.382683f , -0.513280f , 0.768914f , -0.380535f , -0.513749f , 
-0.768178f , -0.555570f , -0.318190f , 0.769890f , -0.552751f , -0.318888f , 
-0.768178f , 0.382683f , -0.513280f , 0.768914f , 0.380535f , -0.513749f , 
-0.691342f , 0.555570f , -0.461940f , 0.692892f , 0.552751f , -0.462966f , 
-0.768178f , 0.555570f , -0.318190f , 0.769890f , 0.552751f , -0.318888f , 
-0.587938f , -0.707107f , -0.392847f , 0.590442f , -0.704031f , -0.394513f , 
-0.691342f , -0.555570f , -0.461940f , 0.692892f , -0.552751f , -0.462966f , 
-0.653282f , -0.707107f , -0.270598f , 0.656056f , -0.704031f , -0.271737f , 
-0.815493f , 0.195090f , -0.544895f , 0.815668f , 0.193915f , -0.545000f , 
-0.768178f , 0.382683f , -0.513280f , 0.768914f , 0.380535f , -0.513749f , 
-0.906128f , 0.195090f , -0.375330f , 0.906339f , 0.193915f , -0.375408f , 
-0.318190f , 0.923880f , -0.212608f , 0.322489f , 0.921690f , -0.215491f , 
-0.162212f , 0.980785f , -0.108387f , 0.167089f , 0.979583f , -0.111637f , 
-0.353554f , 0.923880f , -0.146447f , 0.358348f , 0.921690f , -0.148412f , 
-0.461940f , -0.831470f , -0.308658f , 0.465407f , -0.828639f , -0.310984f , 
-0.587938f , -0.707107f , -0.392847f , 0.590442f , -0.704031f , -0.394513f , 
-0.513280f , -0.831470f , -0.212607f , 0.517136f , -0.828639f , -0.214209f , 
-0.831470f , 0.000000f , -0.555570f , 0.831446f , 0.000000f , -0.555559f , 
-0.815493f , 0.195090f , -0.544895f , 0.815668f , 0.193915f , -0.545000f , 
-0.923880f , 0.000000f , -0.382683f , 0.923856f , 0.000000f , -0.382672f , 
-0.461940f , 0.831470f , -0.308658f , 0.465407f , 0.828639f , -0.310984f , 
-0.318190f , 0.923880f , -0.212608f , 0.322489f , 0.921690f , -0.215491f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.318190f , -0.923880f , -0.212608f , 0.322489f , -0.921690f , -0.215491f , 
-0.461940f , -0.831470f , -0.308658f , 0.465407f , -0.828639f , -0.310984f , 
-0.353554f , -0.923880f , -0.146447f , 0.358348f , -0.921690f , -0.148412f , 
-0.815493f , -0.195090f , -0.544895f , 0.815668f , -0.193915f , -0.545000f , 
-0.831470f , 0.000000f , -0.555570f , 0.831446f , 0.000000f , -0.555559f , 
-0.906128f , -0.195090f , -0.375330f , 0.906339f , -0.193915f , -0.375408f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.461940f , 0.831470f , -0.308658f , 0.465407f , 0.828639f , -0.310984f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.162212f , -0.980785f , -0.108386f , 0.167089f , -0.979583f , -0.111637f , 
-0.318190f , -0.923880f , -0.212608f , 0.322489f , -0.921690f , -0.215491f , 
-0.180240f , -0.980785f , -0.074658f , 0.185644f , -0.979583f , -0.076907f , 
-0.768178f , -0.382683f , -0.513280f , 0.768914f , -0.380535f , -0.513749f , 
-0.815493f , -0.195090f , -0.544895f , 0.815668f , -0.193915f , -0.545000f , 
-0.853554f , -0.382683f , -0.353553f , 0.854366f , -0.380535f , -0.353862f , 
-0.691342f , 0.555570f , -0.461940f , 0.692892f , 0.552751f , -0.462966f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.768178f , 0.555570f , -0.318190f , 0.769890f , 0.552751f , -0.318888f , 
-0.180240f , -0.980785f , -0.074658f , 0.185644f , -0.979583f , -0.076907f , 
-0.353554f , -0.923880f , -0.146447f , 0.358348f , -0.921690f , -0.148412f , 
-0.191342f , -0.980785f , -0.038060f , 0.197089f , -0.979583f , -0.039186f , 
-0.853554f , -0.382683f , -0.353553f , 0.854366f , -0.380535f , -0.353862f , 
-0.906128f , -0.195090f , -0.375330f , 0.906339f , -0.193915f , -0.375408f , 
-0.906128f , -0.382683f , -0.180240f , 0.906980f , -0.380535f , -0.180395f , 
-0.768178f , 0.555570f , -0.318190f , 0.769890f , 0.552751f , -0.318888f , 
-0.653282f , 0.707107f , -0.270598f , 0.656056f , 0.704031f , -0.271737f , 
-0.815493f , 0.555570f , -0.162212f , 0.817316f , 0.552751f , -0.162572f , 
-0.768178f , -0.555570f , -0.318190f , 0.769890f , -0.552751f , -0.318888f , 
-0.853554f , -0.382683f , -0.353553f , 0.854366f , -0.380535f , -0.353862f , 
-0.815493f , -0.555570f , -0.162212f , 0.817316f , -0.552751f , -0.162572f , 
-0.853554f , 0.382683f , -0.353553f , 0.854366f , 0.380535f , -0.353862f , 
-0.768178f , 0.555570f , -0.318190f , 0.769890f , 0.552751f , -0.318888f , 
-0.815493f , 0.555570f , -0.162212f , 0.817316f , 0.552751f , -0.162572f , 
-0.653282f , -0.707107f , -0.270598f , 0.656056f , -0.704031f , -0.271737f , 
-0.768178f , -0.555570f , -0.318190f , 0.769890f , -0.552751f , -0.318888f , 
-0.693520f , -0.707107f , -0.137950f , 0.696493f , -0.704031f , -0.138524f , 
-0.906128f , 0.195090f , -0.375330f , 0.906339f , 0.193915f , -0.375408f , 
-0.853554f , 0.382683f , -0.353553f , 0.854366f , 0.380535f , -0.353862f , 
-0.961940f , 0.195090f , -0.191342f , 0.962157f , 0.193915f , -0.191382f , 
-0.353554f , 0.923880f , -0.146447f , 0.358348f , 0.921690f , -0.148412f , 
-0.180241f , 0.980785f , -0.074658f , 0.185644f , 0.979583f , -0.076876f , 
-0.375331f , 0.923880f , -0.074658f , 0.380413f , 0.921690f , -0.075655f , 
-0.513280f , -0.831470f , -0.212607f , 0.517136f , -0.828639f , -0.214209f , 
-0.653282f , -0.707107f , -0.270598f , 0.656056f , -0.704031f , -0.271737f , 
-0.544895f , -0.831470f , -0.108386f , 0.548997f , -0.828639f , -0.109195f , 
-0.923880f , 0.000000f , -0.382683f , 0.923856f , 0.000000f , -0.382672f , 
-0.906128f , 0.195090f , -0.375330f , 0.906339f , 0.193915f , -0.375408f , 
-0.980785f , 0.000000f , -0.195090f , 0.980773f , 0.000000f , -0.195074f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.353554f , 0.923880f , -0.146447f , 0.358348f , 0.921690f , -0.148412f , 
-0.544895f , 0.831470f , -0.108386f , 0.548997f , 0.828639f , -0.109195f , 
-0.353554f , -0.923880f , -0.146447f , 0.358348f , -0.921690f , -0.148412f , 
-0.513280f , -0.831470f , -0.212607f , 0.517136f , -0.828639f , -0.214209f , 
-0.375331f , -0.923880f , -0.074658f , 0.380413f , -0.921690f , -0.075655f , 
-0.906128f , -0.195090f , -0.375330f , 0.906339f , -0.193915f , -0.375408f , 
-0.923880f , 0.000000f , -0.382683f , 0.923856f , 0.000000f , -0.382672f , 
-0.961940f , -0.195090f , -0.191342f , 0.962157f , -0.193915f , -0.191382f , 
-0.653282f , 0.707107f , -0.270598f , 0.656056f , 0.704031f , -0.271737f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.693520f , 0.707107f , -0.137950f , 0.696493f , 0.704031f , -0.138524f , 
-0.544895f , 0.831470f , -0.108386f , 0.548997f , 0.828639f , -0.109195f , 
-0.375331f , 0.923880f , -0.074658f , 0.380413f , 0.921690f , -0.075655f , 
-0.555570f , 0.831470f , 0.000000f , 0.559771f , 0.828639f , 0.000000f , 
-0.375331f , -0.923880f , -0.074658f , 0.380413f , -0.921690f , -0.075655f , 
-0.544895f , -0.831470f , -0.108386f , 0.548997f , -0.828639f , -0.109195f , 
-0.382684f , -0.923880f , 0.000000f , 0.387860f , -0.921690f , 0.000000f , 
-0.961940f , -0.195090f , -0.191342f , 0.962157f , -0.193915f , -0.191382f , 
-0.980785f , 0.000000f , -0.195090f , 0.980773f , 0.000000f , -0.195074f , 
-0.980785f , -0.195090f , 0.000000f , 0.980987f , -0.193915f , 0.000000f , 
-0.693520f , 0.707107f , -0.137950f , 0.696493f , 0.704031f , -0.138524f , 
-0.544895f , 0.831470f , -0.108386f , 0.548997f , 0.828639f , -0.109195f , 
-0.707107f , 0.707107f , 0.000000f , 0.710135f , 0.704031f , 0.000000f , 
-0.191342f , -0.980785f , -0.038060f , 0.197089f , -0.979583f , -0.039186f , 
-0.375331f , -0.923880f , -0.074658f , 0.380413f , -0.921690f , -0.075655f , 
-0.195091f , -0.980785f , 0.000000f , 0.200964f , -0.979583f , 0.000000f , 
-0.906128f , -0.382683f , -0.180240f , 0.906980f , -0.380535f , -0.180395f , 
-0.961940f , -0.195090f , -0.191342f , 0.962157f , -0.193915f , -0.191382f , 
-0.923880f , -0.382683f , 0.000000f , 0.924741f , -0.380535f , 0.000000f , 
-0.815493f , 0.555570f , -0.162212f , 0.817316f , 0.552751f , -0.162572f , 
-0.693520f , 0.707107f , -0.137950f , 0.696493f , 0.704031f , -0.138524f , 
-0.831470f , 0.555570f , 0.000000f , 0.833338f , 0.552751f , 0.000000f , 
-0.815493f , -0.555570f , -0.162212f , 0.817316f , -0.552751f , -0.162572f , 
-0.906128f , -0.382683f , -0.180240f , 0.906980f , -0.380535f , -0.180395f , 
-0.831470f , -0.555570f , 0.000000f , 0.833338f , -0.552751f , 0.000000f , 
-0.906128f , 0.382683f , -0.180240f , 0.906980f , 0.380535f , -0.180395f , 
-0.815493f , 0.555570f , -0.162212f , 0.817316f , 0.552751f , -0.162572f , 
-0.831470f , 0.555570f , 0.000000f , 0.833338f , 0.552751f , 0.000000f , 
-0.693520f , -0.707107f , -0.137950f , 0.696493f , -0.704031f , -0.138524f , 
-0.815493f , -0.555570f , -0.162212f , 0.817316f , -0.552751f , -0.162572f , 
-0.707107f , -0.707107f , 0.000000f , 0.710135f , -0.704031f , 0.000000f , 
-0.961940f , 0.195090f , -0.191342f , 0.962157f , 0.193915f , -0.191382f , 
-0.906128f , 0.382683f , -0.180240f , 0.906980f , 0.380535f , -0.180395f , 
-0.980785f , 0.195090f , 0.000000f , 0.980987f , 0.193915f , 0.000000f , 
-0.375331f , 0.923880f , -0.074658f , 0.380413f , 0.921690f , -0.075655f , 
-0.191342f , 0.980785f , -0.038060f , 0.197089f , 0.979583f , -0.039186f , 
-0.382684f , 0.923880f , 0.000000f , 0.387860f , 0.921690f , 0.000000f , 
-0.544895f , -0.831470f , -0.108386f , 0.548997f , -0.828639f , -0.109195f , 
-0.693520f , -0.707107f , -0.137950f , 0.696493f , -0.704031f , -0.138524f , 
-0.555570f , -0.831470f , 0.000000f , 0.559771f , -0.828639f , 0.000000f , 
-0.980785f , 0.000000f , -0.195090f , 0.980773f , 0.000000f , -0.195074f , 
-0.961940f , 0.195090f , -0.191342f , 0.962157f , 0.193915f , -0.191382f , 
-1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 
-0.980785f , 0.195090f , 0.000000f , 0.980987f , 0.193915f , 0.000000f , 
-0.923880f , 0.382683f , 0.000000f , 0.924741f , 0.380535f , 0.000000f , 
-0.961940f , 0.195090f , 0.191342f , 0.962157f , 0.193915f , 0.191382f , 
-0.382684f , 0.923880f , 0.000000f , 0.387860f , 0.921690f , 0.000000f , 
-0.195091f , 0.980785f , 0.000000f , 0.200964f , 0.979583f , 0.000000f , 
-0.375331f , 0.923880f , 0.074658f , 0.380413f , 0.921690f , 0.075655f , 
-0.555570f , -0.831470f , 0.000000f , 0.559771f , -0.828639f , 0.000000f , 
-0.707107f , -0.707107f , 0.000000f , 0.710135f , -0.704031f , 0.000000f , 
-0.544895f , -0.831470f , 0.108386f , 0.548997f , -0.828639f , 0.109195f , 
-1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 
-0.980785f , 0.195090f , 0.000000f , 0.980987f , 0.193915f , 0.000000f , 
-0.980785f , 0.000000f , 0.195090f , 0.980773f , 0.000000f , 0.195074f , 
-0.555570f , 0.831470f , 0.000000f , 0.559771f , 0.828639f , 0.000000f , 
-0.382684f , 0.923880f , 0.000000f , 0.387860f , 0.921690f , 0.000000f , 
-0.544895f , 0.831470f , 0.108386f , 0.548997f , 0.828639f , 0.109195f , 
-0.382684f , -0.923880f , 0.000000f , 0.387860f , -0.921690f , 0.000000f , 
-0.555570f , -0.831470f , 0.000000f , 0.559771f , -0.828639f , 0.000000f , 
-0.375331f , -0.923880f , 0.074658f , 0.380413f , -0.921690f , 0.075655f , 
-0.980785f , -0.195090f , 0.000000f , 0.980987f , -0.193915f , 0.000000f , 
-1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 
-0.961940f , -0.195090f , 0.191342f , 0.962157f , -0.193915f , 0.191382f , 
-0.707107f , 0.707107f , 0.000000f , 0.710135f , 0.704031f , 0.000000f , 
-0.555570f , 0.831470f , 0.000000f , 0.559771f , 0.828639f , 0.000000f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.195091f , -0.980785f , 0.000000f , 0.200964f , -0.979583f , 0.000000f , 
-0.382684f , -0.923880f , 0.000000f , 0.387860f , -0.921690f , 0.000000f , 
-0.191342f , -0.980785f , 0.038060f , 0.197089f , -0.979583f , 0.039186f , 
-0.923880f , -0.382683f , 0.000000f , 0.924741f , -0.380535f , 0.000000f , 
-0.980785f , -0.195090f , 0.000000f , 0.980987f , -0.193915f , 0.000000f , 
-0.906128f , -0.382683f , 0.180240f , 0.906980f , -0.380535f , 0.180395f , 
-0.831470f , 0.555570f , 0.000000f , 0.833338f , 0.552751f , 0.000000f , 
-0.707107f , 0.707107f , 0.000000f , 0.710135f , 0.704031f , 0.000000f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.831470f , -0.555570f , 0.000000f , 0.833338f , -0.552751f , 0.000000f , 
-0.923880f , -0.382683f , 0.000000f , 0.924741f , -0.380535f , 0.000000f , 
-0.815493f , -0.555570f , 0.162212f , 0.817316f , -0.552751f , 0.162572f , 
-0.923880f , 0.382683f , 0.000000f , 0.924741f , 0.380535f , 0.000000f , 
-0.831470f , 0.555570f , 0.000000f , 0.833338f , 0.552751f , 0.000000f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.707107f , -0.707107f , 0.000000f , 0.710135f , -0.704031f , 0.000000f , 
-0.831470f , -0.555570f , 0.000000f , 0.833338f , -0.552751f , 0.000000f , 
-0.693520f , -0.707107f , 0.137950f , 0.696493f , -0.704031f , 0.138524f , 
-0.815493f , -0.555570f , 0.162212f , 0.817316f , -0.552751f , 0.162572f , 
-0.906128f , -0.382683f , 0.180240f , 0.906980f , -0.380535f , 0.180395f , 
-0.768178f , -0.555570f , 0.318190f , 0.769890f , -0.552751f , 0.318888f , 
-0.906128f , 0.382683f , 0.180240f , 0.906980f , 0.380535f , 0.180395f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.853554f , 0.382683f , 0.353553f , 0.854366f , 0.380535f , 0.353893f , 
-0.693520f , -0.707107f , 0.137950f , 0.696493f , -0.704031f , 0.138524f , 
-0.815493f , -0.555570f , 0.162212f , 0.817316f , -0.552751f , 0.162572f , 
-0.653282f , -0.707107f , 0.270598f , 0.656056f , -0.704031f , 0.271737f , 
-0.961940f , 0.195090f , 0.191342f , 0.962157f , 0.193915f , 0.191382f , 
-0.906128f , 0.382683f , 0.180240f , 0.906980f , 0.380535f , 0.180395f , 
-0.906127f , 0.195090f , 0.375330f , 0.906339f , 0.193915f , 0.375408f , 
-0.375331f , 0.923880f , 0.074658f , 0.380413f , 0.921690f , 0.075655f , 
-0.191342f , 0.980785f , 0.038060f , 0.197089f , 0.979583f , 0.039186f , 
-0.353554f , 0.923880f , 0.146447f , 0.358348f , 0.921690f , 0.148412f , 
-0.544895f , -0.831470f , 0.108386f , 0.548997f , -0.828639f , 0.109195f , 
-0.693520f , -0.707107f , 0.137950f , 0.696493f , -0.704031f , 0.138524f , 
-0.513280f , -0.831470f , 0.212608f , 0.517136f , -0.828639f , 0.214209f , 
-0.980785f , 0.000000f , 0.195090f , 0.980773f , 0.000000f , 0.195074f , 
-0.961940f , 0.195090f , 0.191342f , 0.962157f , 0.193915f , 0.191382f , 
-0.923880f , 0.000000f , 0.382684f , 0.923856f , 0.000000f , 0.382672f , 
-0.544895f , 0.831470f , 0.108386f , 0.548997f , 0.828639f , 0.109195f , 
-0.375331f , 0.923880f , 0.074658f , 0.380413f , 0.921690f , 0.075655f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.375331f , -0.923880f , 0.074658f , 0.380413f , -0.921690f , 0.075655f , 
-0.544895f , -0.831470f , 0.108386f , 0.548997f , -0.828639f , 0.109195f , 
-0.353554f , -0.923880f , 0.146447f , 0.358348f , -0.921690f , 0.148412f , 
-0.961940f , -0.195090f , 0.191342f , 0.962157f , -0.193915f , 0.191382f , 
-0.980785f , 0.000000f , 0.195090f , 0.980773f , 0.000000f , 0.195074f , 
-0.906128f , -0.195090f , 0.375330f , 0.906339f , -0.193915f , 0.375408f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.544895f , 0.831470f , 0.108386f , 0.548997f , 0.828639f , 0.109195f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.191342f , -0.980785f , 0.038060f , 0.197089f , -0.979583f , 0.039186f , 
-0.375331f , -0.923880f , 0.074658f , 0.380413f , -0.921690f , 0.075655f , 
-0.180240f , -0.980785f , 0.074658f , 0.185644f , -0.979583f , 0.076876f , 
-0.906128f , -0.382683f , 0.180240f , 0.906980f , -0.380535f , 0.180395f , 
-0.961940f , -0.195090f , 0.191342f , 0.962157f , -0.193915f , 0.191382f , 
-0.853553f , -0.382683f , 0.353553f , 0.854366f , -0.380535f , 0.353893f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.768178f , 0.555570f , 0.318190f , 0.769890f , 0.552751f , 0.318888f , 
-0.180240f , -0.980785f , 0.074658f , 0.185644f , -0.979583f , 0.076876f , 
-0.353554f , -0.923880f , 0.146447f , 0.358348f , -0.921690f , 0.148412f , 
-0.162212f , -0.980785f , 0.108386f , 0.167089f , -0.979583f , 0.111637f , 
-0.853553f , -0.382683f , 0.353553f , 0.854366f , -0.380535f , 0.353893f , 
-0.906128f , -0.195090f , 0.375330f , 0.906339f , -0.193915f , 0.375408f , 
-0.768178f , -0.382683f , 0.513280f , 0.768914f , -0.380535f , 0.513749f , 
-0.768178f , 0.555570f , 0.318190f , 0.769890f , 0.552751f , 0.318888f , 
-0.653282f , 0.707107f , 0.270598f , 0.656056f , 0.704031f , 0.271737f , 
-0.691342f , 0.555570f , 0.461940f , 0.692892f , 0.552751f , 0.462966f , 
-0.768178f , -0.555570f , 0.318190f , 0.769890f , -0.552751f , 0.318888f , 
-0.853553f , -0.382683f , 0.353553f , 0.854366f , -0.380535f , 0.353893f , 
-0.691342f , -0.555570f , 0.461940f , 0.692892f , -0.552751f , 0.462966f , 
-0.853554f , 0.382683f , 0.353553f , 0.854366f , 0.380535f , 0.353893f , 
-0.768178f , 0.555570f , 0.318190f , 0.769890f , 0.552751f , 0.318888f , 
-0.768178f , 0.382683f , 0.513280f , 0.768914f , 0.380535f , 0.513749f , 
-0.653282f , -0.707107f , 0.270598f , 0.656056f , -0.704031f , 0.271737f , 
-0.768178f , -0.555570f , 0.318190f , 0.769890f , -0.552751f , 0.318888f , 
-0.587938f , -0.707107f , 0.392847f , 0.590442f , -0.704031f , 0.394513f , 
-0.906127f , 0.195090f , 0.375330f , 0.906339f , 0.193915f , 0.375408f , 
-0.853554f , 0.382683f , 0.353553f , 0.854366f , 0.380535f , 0.353893f , 
-0.815493f , 0.195090f , 0.544895f , 0.815668f , 0.193915f , 0.545000f , 
-0.353554f , 0.923880f , 0.146447f , 0.358348f , 0.921690f , 0.148412f , 
-0.180240f , 0.980785f , 0.074658f , 0.185644f , 0.979583f , 0.076907f , 
-0.318190f , 0.923880f , 0.212608f , 0.322489f , 0.921690f , 0.215491f , 
-0.513280f , -0.831470f , 0.212608f , 0.517136f , -0.828639f , 0.214209f , 
-0.653282f , -0.707107f , 0.270598f , 0.656056f , -0.704031f , 0.271737f , 
-0.461940f , -0.831470f , 0.308658f , 0.465407f , -0.828639f , 0.310984f , 
-0.923880f , 0.000000f , 0.382684f , 0.923856f , 0.000000f , 0.382672f , 
-0.906127f , 0.195090f , 0.375330f , 0.906339f , 0.193915f , 0.375408f , 
-0.831470f , 0.000000f , 0.555570f , 0.831446f , 0.000000f , 0.555559f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.353554f , 0.923880f , 0.146447f , 0.358348f , 0.921690f , 0.148412f , 
-0.461940f , 0.831470f , 0.308658f , 0.465407f , 0.828639f , 0.310984f , 
-0.353554f , -0.923880f , 0.146447f , 0.358348f , -0.921690f , 0.148412f , 
-0.513280f , -0.831470f , 0.212608f , 0.517136f , -0.828639f , 0.214209f , 
-0.318190f , -0.923880f , 0.212608f , 0.322489f , -0.921690f , 0.215491f , 
-0.906128f , -0.195090f , 0.375330f , 0.906339f , -0.193915f , 0.375408f , 
-0.923880f , 0.000000f , 0.382684f , 0.923856f , 0.000000f , 0.382672f , 
-0.815493f , -0.195090f , 0.544895f , 0.815668f , -0.193915f , 0.545000f , 
-0.653282f , 0.707107f , 0.270598f , 0.656056f , 0.704031f , 0.271737f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.587938f , 0.707107f , 0.392847f , 0.590442f , 0.704031f , 0.394513f , 
-0.318190f , -0.923880f , 0.212608f , 0.322489f , -0.921690f , 0.215491f , 
-0.461940f , -0.831470f , 0.308658f , 0.465407f , -0.828639f , 0.310984f , 
-0.270598f , -0.923880f , 0.270598f , 0.274270f , -0.921690f , 0.274270f , 
-0.815493f , -0.195090f , 0.544895f , 0.815668f , -0.193915f , 0.545000f , 
-0.831470f , 0.000000f , 0.555570f , 0.831446f , 0.000000f , 0.555559f , 
-0.693520f , -0.195090f , 0.693520f , 0.693655f , -0.193915f , 0.693655f , 
-0.587938f , 0.707107f , 0.392847f , 0.590442f , 0.704031f , 0.394513f , 
-0.461940f , 0.831470f , 0.308658f , 0.465407f , 0.828639f , 0.310984f , 
-0.500000f , 0.707107f , 0.500000f , 0.502121f , 0.704031f , 0.502121f , 
-0.162212f , -0.980785f , 0.108386f , 0.167089f , -0.979583f , 0.111637f , 
-0.318190f , -0.923880f , 0.212608f , 0.322489f , -0.921690f , 0.215491f , 
-0.137950f , -0.980785f , 0.137950f , 0.142094f , -0.979583f , 0.142094f , 
-0.768178f , -0.382683f , 0.513280f , 0.768914f , -0.380535f , 0.513749f , 
-0.815493f , -0.195090f , 0.544895f , 0.815668f , -0.193915f , 0.545000f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.691342f , 0.555570f , 0.461940f , 0.692892f , 0.552751f , 0.462966f , 
-0.587938f , 0.707107f , 0.392847f , 0.590442f , 0.704031f , 0.394513f , 
-0.587938f , 0.555570f , 0.587938f , 0.589251f , 0.552751f , 0.589251f , 
-0.691342f , -0.555570f , 0.461940f , 0.692892f , -0.552751f , 0.462966f , 
-0.768178f , -0.382683f , 0.513280f , 0.768914f , -0.380535f , 0.513749f , 
-0.587938f , -0.555570f , 0.587938f , 0.589251f , -0.552751f , 0.589251f , 
-0.768178f , 0.382683f , 0.513280f , 0.768914f , 0.380535f , 0.513749f , 
-0.691342f , 0.555570f , 0.461940f , 0.692892f , 0.552751f , 0.462966f , 
-0.653282f , 0.382683f , 0.653281f , 0.653890f , 0.380535f , 0.653890f , 
-0.587938f , -0.707107f , 0.392847f , 0.590442f , -0.704031f , 0.394513f , 
-0.691342f , -0.555570f , 0.461940f , 0.692892f , -0.552751f , 0.462966f , 
-0.500000f , -0.707107f , 0.500000f , 0.502121f , -0.704031f , 0.502121f , 
-0.815493f , 0.195090f , 0.544895f , 0.815668f , 0.193915f , 0.545000f , 
-0.768178f , 0.382683f , 0.513280f , 0.768914f , 0.380535f , 0.513749f , 
-0.693520f , 0.195090f , 0.693520f , 0.693655f , 0.193915f , 0.693655f , 
-0.318190f , 0.923880f , 0.212608f , 0.322489f , 0.921690f , 0.215491f , 
-0.162212f , 0.980785f , 0.108387f , 0.167089f , 0.979583f , 0.111637f , 
-0.270598f , 0.923880f , 0.270598f , 0.274270f , 0.921690f , 0.274270f , 
-0.461940f , -0.831470f , 0.308658f , 0.465407f , -0.828639f , 0.310984f , 
-0.587938f , -0.707107f , 0.392847f , 0.590442f , -0.704031f , 0.394513f , 
-0.392848f , -0.831470f , 0.392847f , 0.395795f , -0.828639f , 0.395795f , 
-0.831470f , 0.000000f , 0.555570f , 0.831446f , 0.000000f , 0.555559f , 
-0.815493f , 0.195090f , 0.544895f , 0.815668f , 0.193915f , 0.545000f , 
-0.707107f , 0.000000f , 0.707107f , 0.707083f , 0.000000f , 0.707083f , 
-0.461940f , 0.831470f , 0.308658f , 0.465407f , 0.828639f , 0.310984f , 
-0.318190f , 0.923880f , 0.212608f , 0.322489f , 0.921690f , 0.215491f , 
-0.392848f , 0.831470f , 0.392847f , 0.395795f , 0.828639f , 0.395795f , 
-0.270598f , 0.923880f , 0.270598f , 0.274270f , 0.921690f , 0.274270f , 
-0.137950f , 0.980785f , 0.137950f , 0.142094f , 0.979583f , 0.142094f , 
-0.212608f , 0.923880f , 0.318190f , 0.215491f , 0.921690f , 0.322489f , 
-0.392848f , -0.831470f , 0.392847f , 0.395795f , -0.828639f , 0.395795f , 
-0.500000f , -0.707107f , 0.500000f , 0.502121f , -0.704031f , 0.502121f , 
-0.308658f , -0.831470f , 0.461940f , 0.310984f , -0.828639f , 0.465407f , 
-0.707107f , 0.000000f , 0.707107f , 0.707083f , 0.000000f , 0.707083f , 
-0.693520f , 0.195090f , 0.693520f , 0.693655f , 0.193915f , 0.693655f , 
-0.555570f , 0.000000f , 0.831470f , 0.555559f , 0.000000f , 0.831446f , 
-0.392848f , 0.831470f , 0.392847f , 0.395795f , 0.828639f , 0.395795f , 
-0.270598f , 0.923880f , 0.270598f , 0.274270f , 0.921690f , 0.274270f , 
-0.308658f , 0.831470f , 0.461940f , 0.310984f , 0.828639f , 0.465407f , 
-0.270598f , -0.923880f , 0.270598f , 0.274270f , -0.921690f , 0.274270f , 
-0.392848f , -0.831470f , 0.392847f , 0.395795f , -0.828639f , 0.395795f , 
-0.212608f , -0.923880f , 0.318190f , 0.215491f , -0.921690f , 0.322489f , 
-0.693520f , -0.195090f , 0.693520f , 0.693655f , -0.193915f , 0.693655f , 
-0.707107f , 0.000000f , 0.707107f , 0.707083f , 0.000000f , 0.707083f , 
-0.544895f , -0.195090f , 0.815493f , 0.545000f , -0.193915f , 0.815668f , 
-0.500000f , 0.707107f , 0.500000f , 0.502121f , 0.704031f , 0.502121f , 
-0.392848f , 0.831470f , 0.392847f , 0.395795f , 0.828639f , 0.395795f , 
-0.392848f , 0.707107f , 0.587938f , 0.394513f , 0.704031f , 0.590442f , 
-0.137950f , -0.980785f , 0.137950f , 0.142094f , -0.979583f , 0.142094f , 
-0.270598f , -0.923880f , 0.270598f , 0.274270f , -0.921690f , 0.274270f , 
-0.108387f , -0.980785f , 0.162212f , 0.111637f , -0.979583f , 0.167089f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.693520f , -0.195090f , 0.693520f , 0.693655f , -0.193915f , 0.693655f , 
-0.544895f , -0.195090f , 0.815493f , 0.545000f , -0.193915f , 0.815668f , 
-0.587938f , 0.555570f , 0.587938f , 0.589251f , 0.552751f , 0.589251f , 
-0.500000f , 0.707107f , 0.500000f , 0.502121f , 0.704031f , 0.502121f , 
-0.461940f , 0.555570f , 0.691342f , 0.462966f , 0.552751f , 0.692892f , 
-0.587938f , -0.555570f , 0.587938f , 0.589251f , -0.552751f , 0.589251f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.461940f , -0.555570f , 0.691342f , 0.462966f , -0.552751f , 0.692892f , 
-0.653282f , 0.382683f , 0.653281f , 0.653890f , 0.380535f , 0.653890f , 
-0.587938f , 0.555570f , 0.587938f , 0.589251f , 0.552751f , 0.589251f , 
-0.513280f , 0.382683f , 0.768178f , 0.513749f , 0.380535f , 0.768914f , 
-0.500000f , -0.707107f , 0.500000f , 0.502121f , -0.704031f , 0.502121f , 
-0.587938f , -0.555570f , 0.587938f , 0.589251f , -0.552751f , 0.589251f , 
-0.392848f , -0.707107f , 0.587938f , 0.394513f , -0.704031f , 0.590442f , 
-0.693520f , 0.195090f , 0.693520f , 0.693655f , 0.193915f , 0.693655f , 
-0.653282f , 0.382683f , 0.653281f , 0.653890f , 0.380535f , 0.653890f , 
-0.544895f , 0.195090f , 0.815493f , 0.545000f , 0.193915f , 0.815668f , 
-0.513280f , 0.382683f , 0.768178f , 0.513749f , 0.380535f , 0.768914f , 
-0.461940f , 0.555570f , 0.691342f , 0.462966f , 0.552751f , 0.692892f , 
-0.353553f , 0.382683f , 0.853553f , 0.353862f , 0.380535f , 0.854366f , 
-0.392848f , -0.707107f , 0.587938f , 0.394513f , -0.704031f , 0.590442f , 
-0.461940f , -0.555570f , 0.691342f , 0.462966f , -0.552751f , 0.692892f , 
-0.270598f , -0.707107f , 0.653281f , 0.271737f , -0.704031f , 0.656056f , 
-0.544895f , 0.195090f , 0.815493f , 0.545000f , 0.193915f , 0.815668f , 
-0.513280f , 0.382683f , 0.768178f , 0.513749f , 0.380535f , 0.768914f , 
-0.375330f , 0.195090f , 0.906127f , 0.375408f , 0.193915f , 0.906339f , 
-0.212608f , 0.923880f , 0.318190f , 0.215491f , 0.921690f , 0.322489f , 
-0.108387f , 0.980785f , 0.162212f , 0.111637f , 0.979583f , 0.167089f , 
-0.146447f , 0.923880f , 0.353554f , 0.148412f , 0.921690f , 0.358348f , 
-0.308658f , -0.831470f , 0.461940f , 0.310984f , -0.828639f , 0.465407f , 
-0.392848f , -0.707107f , 0.587938f , 0.394513f , -0.704031f , 0.590442f , 
-0.212608f , -0.831470f , 0.513280f , 0.214209f , -0.828639f , 0.517136f , 
-0.555570f , 0.000000f , 0.831470f , 0.555559f , 0.000000f , 0.831446f , 
-0.544895f , 0.195090f , 0.815493f , 0.545000f , 0.193915f , 0.815668f , 
-0.382683f , 0.000000f , 0.923879f , 0.382672f , 0.000000f , 0.923856f , 
-0.308658f , 0.831470f , 0.461940f , 0.310984f , 0.828639f , 0.465407f , 
-0.212608f , 0.923880f , 0.318190f , 0.215491f , 0.921690f , 0.322489f , 
-0.212608f , 0.831470f , 0.513280f , 0.214209f , 0.828639f , 0.517136f , 
-0.212608f , -0.923880f , 0.318190f , 0.215491f , -0.921690f , 0.322489f , 
-0.308658f , -0.831470f , 0.461940f , 0.310984f , -0.828639f , 0.465407f , 
-0.146447f , -0.923880f , 0.353553f , 0.148412f , -0.921690f , 0.358348f , 
-0.544895f , -0.195090f , 0.815493f , 0.545000f , -0.193915f , 0.815668f , 
-0.555570f , 0.000000f , 0.831470f , 0.555559f , 0.000000f , 0.831446f , 
-0.375330f , -0.195090f , 0.906127f , 0.375408f , -0.193915f , 0.906339f , 
-0.392848f , 0.707107f , 0.587938f , 0.394513f , 0.704031f , 0.590442f , 
-0.308658f , 0.831470f , 0.461940f , 0.310984f , 0.828639f , 0.465407f , 
-0.270598f , 0.707107f , 0.653281f , 0.271737f , 0.704031f , 0.656056f , 
-0.108387f , -0.980785f , 0.162212f , 0.111637f , -0.979583f , 0.167089f , 
-0.212608f , -0.923880f , 0.318190f , 0.215491f , -0.921690f , 0.322489f , 
-0.074658f , -0.980785f , 0.180240f , 0.076907f , -0.979583f , 0.185644f , 
-0.513280f , -0.382683f , 0.768178f , 0.513749f , -0.380535f , 0.768914f , 
-0.544895f , -0.195090f , 0.815493f , 0.545000f , -0.193915f , 0.815668f , 
-0.375330f , -0.195090f , 0.906127f , 0.375408f , -0.193915f , 0.906339f , 
-0.461940f , 0.555570f , 0.691342f , 0.462966f , 0.552751f , 0.692892f , 
-0.392848f , 0.707107f , 0.587938f , 0.394513f , 0.704031f , 0.590442f , 
-0.318190f , 0.555570f , 0.768178f , 0.318888f , 0.552751f , 0.769890f , 
-0.461940f , -0.555570f , 0.691342f , 0.462966f , -0.552751f , 0.692892f , 
-0.513280f , -0.382683f , 0.768178f , 0.513749f , -0.380535f , 0.768914f , 
-0.318190f , -0.555570f , 0.768178f , 0.318888f , -0.552751f , 0.769890f , 
-0.353554f , -0.382683f , 0.853553f , 0.353862f , -0.380535f , 0.854366f , 
-0.375330f , -0.195090f , 0.906127f , 0.375408f , -0.193915f , 0.906339f , 
-0.191342f , -0.195090f , 0.961939f , 0.191382f , -0.193915f , 0.962157f , 
-0.318190f , 0.555570f , 0.768178f , 0.318888f , 0.552751f , 0.769890f , 
-0.270598f , 0.707107f , 0.653281f , 0.271737f , 0.704031f , 0.656056f , 
-0.162212f , 0.555570f , 0.815493f , 0.162572f , 0.552751f , 0.817316f , 
-0.318190f , -0.555570f , 0.768178f , 0.318888f , -0.552751f , 0.769890f , 
-0.353554f , -0.382683f , 0.853553f , 0.353862f , -0.380535f , 0.854366f , 
-0.162212f , -0.555570f , 0.815493f , 0.162572f , -0.552751f , 0.817316f , 
-0.353553f , 0.382683f , 0.853553f , 0.353862f , 0.380535f , 0.854366f , 
-0.318190f , 0.555570f , 0.768178f , 0.318888f , 0.552751f , 0.769890f , 
-0.180240f , 0.382683f , 0.906127f , 0.180395f , 0.380535f , 0.906980f , 
-0.270598f , -0.707107f , 0.653281f , 0.271737f , -0.704031f , 0.656056f , 
-0.318190f , -0.555570f , 0.768178f , 0.318888f , -0.552751f , 0.769890f , 
-0.137950f , -0.707107f , 0.693520f , 0.138524f , -0.704031f , 0.696493f , 
-0.375330f , 0.195090f , 0.906127f , 0.375408f , 0.193915f , 0.906339f , 
-0.353553f , 0.382683f , 0.853553f , 0.353862f , 0.380535f , 0.854366f , 
-0.191342f , 0.195090f , 0.961939f , 0.191382f , 0.193915f , 0.962157f , 
-0.146447f , 0.923880f , 0.353554f , 0.148412f , 0.921690f , 0.358348f , 
-0.074658f , 0.980785f , 0.180240f , 0.076907f , 0.979583f , 0.185644f , 
-0.074658f , 0.923880f , 0.375330f , 0.075655f , 0.921690f , 0.380413f , 
-0.212608f , -0.831470f , 0.513280f , 0.214209f , -0.828639f , 0.517136f , 
-0.270598f , -0.707107f , 0.653281f , 0.271737f , -0.704031f , 0.656056f , 
-0.108387f , -0.831470f , 0.544895f , 0.109195f , -0.828639f , 0.548997f , 
-0.382683f , 0.000000f , 0.923879f , 0.382672f , 0.000000f , 0.923856f , 
-0.375330f , 0.195090f , 0.906127f , 0.375408f , 0.193915f , 0.906339f , 
-0.195090f , 0.000000f , 0.980785f , 0.195074f , 0.000000f , 0.980773f , 
-0.212608f , 0.831470f , 0.513280f , 0.214209f , 0.828639f , 0.517136f , 
-0.146447f , 0.923880f , 0.353554f , 0.148412f , 0.921690f , 0.358348f , 
-0.108387f , 0.831470f , 0.544895f , 0.109195f , 0.828639f , 0.548997f , 
-0.146447f , -0.923880f , 0.353553f , 0.148412f , -0.921690f , 0.358348f , 
-0.212608f , -0.831470f , 0.513280f , 0.214209f , -0.828639f , 0.517136f , 
-0.074658f , -0.923880f , 0.375330f , 0.075655f , -0.921690f , 0.380413f , 
-0.375330f , -0.195090f , 0.906127f , 0.375408f , -0.193915f , 0.906339f , 
-0.382683f , 0.000000f , 0.923879f , 0.382672f , 0.000000f , 0.923856f , 
-0.191342f , -0.195090f , 0.961939f , 0.191382f , -0.193915f , 0.962157f , 
-0.270598f , 0.707107f , 0.653281f , 0.271737f , 0.704031f , 0.656056f , 
-0.212608f , 0.831470f , 0.513280f , 0.214209f , 0.828639f , 0.517136f , 
-0.137950f , 0.707107f , 0.693520f , 0.138524f , 0.704031f , 0.696493f , 
-0.074658f , -0.980785f , 0.180240f , 0.076907f , -0.979583f , 0.185644f , 
-0.146447f , -0.923880f , 0.353553f , 0.148412f , -0.921690f , 0.358348f , 
-0.038061f , -0.980785f , 0.191342f , 0.039186f , -0.979583f , 0.197089f , 
-0.074658f , -0.923880f , 0.375330f , 0.075655f , -0.921690f , 0.380413f , 
-0.108387f , -0.831470f , 0.544895f , 0.109195f , -0.828639f , 0.548997f , 
-0.000000f , -0.923880f , 0.382683f , 0.000000f , -0.921690f , 0.387860f , 
-0.191342f , -0.195090f , 0.961939f , 0.191382f , -0.193915f , 0.962157f , 
-0.195090f , 0.000000f , 0.980785f , 0.195074f , 0.000000f , 0.980773f , 
-0.000000f , -0.195090f , 0.980785f , 0.000000f , -0.193915f , 0.980987f , 
-0.137950f , 0.707107f , 0.693520f , 0.138524f , 0.704031f , 0.696493f , 
-0.108387f , 0.831470f , 0.544895f , 0.109195f , 0.828639f , 0.548997f , 
-0.000000f , 0.707107f , 0.707107f , 0.000000f , 0.704031f , 0.710135f , 
-0.038061f , -0.980785f , 0.191342f , 0.039186f , -0.979583f , 0.197089f , 
-0.074658f , -0.923880f , 0.375330f , 0.075655f , -0.921690f , 0.380413f , 
-0.000000f , -0.980785f , 0.195090f , 0.000000f , -0.979583f , 0.200964f , 
-0.180240f , -0.382683f , 0.906127f , 0.180395f , -0.380535f , 0.906980f , 
-0.191342f , -0.195090f , 0.961939f , 0.191382f , -0.193915f , 0.962157f , 
-0.000000f , -0.195090f , 0.980785f , 0.000000f , -0.193915f , 0.980987f , 
-0.162212f , 0.555570f , 0.815493f , 0.162572f , 0.552751f , 0.817316f , 
-0.137950f , 0.707107f , 0.693520f , 0.138524f , 0.704031f , 0.696493f , 
-0.000000f , 0.555570f , 0.831469f , 0.000000f , 0.552751f , 0.833338f , 
-0.162212f , -0.555570f , 0.815493f , 0.162572f , -0.552751f , 0.817316f , 
-0.180240f , -0.382683f , 0.906127f , 0.180395f , -0.380535f , 0.906980f , 
-0.000000f , -0.555570f , 0.831469f , 0.000000f , -0.552751f , 0.833338f , 
-0.180240f , 0.382683f , 0.906127f , 0.180395f , 0.380535f , 0.906980f , 
-0.162212f , 0.555570f , 0.815493f , 0.162572f , 0.552751f , 0.817316f , 
-0.000000f , 0.382683f , 0.923879f , 0.000000f , 0.380535f , 0.924741f , 
-0.137950f , -0.707107f , 0.693520f , 0.138524f , -0.704031f , 0.696493f , 
-0.162212f , -0.555570f , 0.815493f , 0.162572f , -0.552751f , 0.817316f , 
-0.000000f , -0.707107f , 0.707107f , 0.000000f , -0.704031f , 0.710135f , 
-0.191342f , 0.195090f , 0.961939f , 0.191382f , 0.193915f , 0.962157f , 
-0.180240f , 0.382683f , 0.906127f , 0.180395f , 0.380535f , 0.906980f , 
-0.000000f , 0.195090f , 0.980785f , 0.000000f , 0.193915f , 0.980987f , 
-0.074658f , 0.923880f , 0.375330f , 0.075655f , 0.921690f , 0.380413f , 
-0.038061f , 0.980785f , 0.191342f , 0.039186f , 0.979583f , 0.197089f , 
-0.000000f , 0.923880f , 0.382683f , 0.000000f , 0.921690f , 0.387860f , 
-0.108387f , -0.831470f , 0.544895f , 0.109195f , -0.828639f , 0.548997f , 
-0.137950f , -0.707107f , 0.693520f , 0.138524f , -0.704031f , 0.696493f , 
-0.000000f , -0.831470f , 0.555570f , 0.000000f , -0.828639f , 0.559771f , 
-0.195090f , 0.000000f , 0.980785f , 0.195074f , 0.000000f , 0.980773f , 
-0.191342f , 0.195090f , 0.961939f , 0.191382f , 0.193915f , 0.962157f , 
-0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 0.999969f , 
-0.108387f , 0.831470f , 0.544895f , 0.109195f , 0.828639f , 0.548997f , 
-0.074658f , 0.923880f , 0.375330f , 0.075655f , 0.921690f , 0.380413f , 
-0.000000f , 0.831470f , 0.555570f , 0.000000f , 0.828639f , 0.559771f , 
-0.000000f , 0.923880f , 0.382683f , 0.000000f , 0.921690f , 0.387860f , 
-0.000000f , 0.980785f , 0.195091f , 0.000000f , 0.979583f , 0.200964f , 
--0.074658f , 0.923880f , 0.375330f , -0.075655f , 0.921690f , 0.380413f , 
-0.000000f , -0.831470f , 0.555570f , 0.000000f , -0.828639f , 0.559771f , 
-0.000000f , -0.707107f , 0.707107f , 0.000000f , -0.704031f , 0.710135f , 
--0.108386f , -0.831470f , 0.544895f , -0.109195f , -0.828639f , 0.548997f , 
-0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 0.999969f , 
-0.000000f , 0.195090f , 0.980785f , 0.000000f , 0.193915f , 0.980987f , 
--0.195090f , 0.000000f , 0.980785f , -0.195074f , 0.000000f , 0.980773f , 
-0.000000f , 0.831470f , 0.555570f , 0.000000f , 0.828639f , 0.559771f , 
-0.000000f , 0.923880f , 0.382683f , 0.000000f , 0.921690f , 0.387860f , 
--0.108386f , 0.831470f , 0.544895f , -0.109195f , 0.828639f , 0.548997f , 
-0.000000f , -0.923880f , 0.382683f , 0.000000f , -0.921690f , 0.387860f , 
-0.000000f , -0.831470f , 0.555570f , 0.000000f , -0.828639f , 0.559771f , 
--0.074658f , -0.923880f , 0.375330f , -0.075655f , -0.921690f , 0.380413f , 
-0.000000f , -0.195090f , 0.980785f , 0.000000f , -0.193915f , 0.980987f , 
-0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 0.999969f , 
--0.191342f , -0.195090f , 0.961939f , -0.191382f , -0.193915f , 0.962157f , 
-0.000000f , 0.707107f , 0.707107f , 0.000000f , 0.704031f , 0.710135f , 
-0.000000f , 0.831470f , 0.555570f , 0.000000f , 0.828639f , 0.559771f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
-0.000000f , -0.980785f , 0.195090f , 0.000000f , -0.979583f , 0.200964f , 
-0.000000f , -0.923880f , 0.382683f , 0.000000f , -0.921690f , 0.387860f , 
--0.038060f , -0.980785f , 0.191342f , -0.039186f , -0.979583f , 0.197089f , 
-0.000000f , -0.382683f , 0.923879f , 0.000000f , -0.380535f , 0.924741f , 
-0.000000f , -0.195090f , 0.980785f , 0.000000f , -0.193915f , 0.980987f , 
--0.191342f , -0.195090f , 0.961939f , -0.191382f , -0.193915f , 0.962157f , 
-0.000000f , 0.555570f , 0.831469f , 0.000000f , 0.552751f , 0.833338f , 
-0.000000f , 0.707107f , 0.707107f , 0.000000f , 0.704031f , 0.710135f , 
--0.162211f , 0.555570f , 0.815493f , -0.162572f , 0.552751f , 0.817316f , 
-0.000000f , -0.555570f , 0.831469f , 0.000000f , -0.552751f , 0.833338f , 
-0.000000f , -0.382683f , 0.923879f , 0.000000f , -0.380535f , 0.924741f , 
--0.162211f , -0.555570f , 0.815493f , -0.162572f , -0.552751f , 0.817316f , 
-0.000000f , 0.382683f , 0.923879f , 0.000000f , 0.380535f , 0.924741f , 
-0.000000f , 0.555570f , 0.831469f , 0.000000f , 0.552751f , 0.833338f , 
--0.180240f , 0.382683f , 0.906127f , -0.180395f , 0.380535f , 0.906980f , 
-0.000000f , -0.707107f , 0.707107f , 0.000000f , -0.704031f , 0.710135f , 
-0.000000f , -0.555570f , 0.831469f , 0.000000f , -0.552751f , 0.833338f , 
--0.137949f , -0.707107f , 0.693520f , -0.138524f , -0.704031f , 0.696493f , 
-0.000000f , 0.195090f , 0.980785f , 0.000000f , 0.193915f , 0.980987f , 
-0.000000f , 0.382683f , 0.923879f , 0.000000f , 0.380535f , 0.924741f , 
--0.191341f , 0.195090f , 0.961939f , -0.191382f , 0.193915f , 0.962157f , 
--0.180240f , 0.382683f , 0.906127f , -0.180395f , 0.380535f , 0.906980f , 
--0.162211f , 0.555570f , 0.815493f , -0.162572f , 0.552751f , 0.817316f , 
--0.353553f , 0.382683f , 0.853553f , -0.353893f , 0.380535f , 0.854366f , 
--0.137949f , -0.707107f , 0.693520f , -0.138524f , -0.704031f , 0.696493f , 
--0.162211f , -0.555570f , 0.815493f , -0.162572f , -0.552751f , 0.817316f , 
--0.270598f , -0.707107f , 0.653281f , -0.271737f , -0.704031f , 0.656056f , 
--0.191341f , 0.195090f , 0.961939f , -0.191382f , 0.193915f , 0.962157f , 
--0.180240f , 0.382683f , 0.906127f , -0.180395f , 0.380535f , 0.906980f , 
--0.375330f , 0.195090f , 0.906127f , -0.375408f , 0.193915f , 0.906339f , 
--0.074658f , 0.923880f , 0.375330f , -0.075655f , 0.921690f , 0.380413f , 
--0.038060f , 0.980785f , 0.191342f , -0.039186f , 0.979583f , 0.197089f , 
--0.146446f , 0.923880f , 0.353553f , -0.148412f , 0.921690f , 0.358348f , 
--0.108386f , -0.831470f , 0.544895f , -0.109195f , -0.828639f , 0.548997f , 
--0.137949f , -0.707107f , 0.693520f , -0.138524f , -0.704031f , 0.696493f , 
--0.212607f , -0.831470f , 0.513280f , -0.214209f , -0.828639f , 0.517136f , 
--0.195090f , 0.000000f , 0.980785f , -0.195074f , 0.000000f , 0.980773f , 
--0.191341f , 0.195090f , 0.961939f , -0.191382f , 0.193915f , 0.962157f , 
--0.382683f , 0.000000f , 0.923879f , -0.382672f , 0.000000f , 0.923856f , 
--0.108386f , 0.831470f , 0.544895f , -0.109195f , 0.828639f , 0.548997f , 
--0.074658f , 0.923880f , 0.375330f , -0.075655f , 0.921690f , 0.380413f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.074658f , -0.923880f , 0.375330f , -0.075655f , -0.921690f , 0.380413f , 
--0.108386f , -0.831470f , 0.544895f , -0.109195f , -0.828639f , 0.548997f , 
--0.146446f , -0.923880f , 0.353553f , -0.148412f , -0.921690f , 0.358348f , 
--0.191342f , -0.195090f , 0.961939f , -0.191382f , -0.193915f , 0.962157f , 
--0.195090f , 0.000000f , 0.980785f , -0.195074f , 0.000000f , 0.980773f , 
--0.375330f , -0.195090f , 0.906127f , -0.375408f , -0.193915f , 0.906339f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
--0.108386f , 0.831470f , 0.544895f , -0.109195f , 0.828639f , 0.548997f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.038060f , -0.980785f , 0.191342f , -0.039186f , -0.979583f , 0.197089f , 
--0.074658f , -0.923880f , 0.375330f , -0.075655f , -0.921690f , 0.380413f , 
--0.074658f , -0.980785f , 0.180240f , -0.076907f , -0.979583f , 0.185644f , 
--0.180240f , -0.382683f , 0.906127f , -0.180395f , -0.380535f , 0.906980f , 
--0.191342f , -0.195090f , 0.961939f , -0.191382f , -0.193915f , 0.962157f , 
--0.375330f , -0.195090f , 0.906127f , -0.375408f , -0.193915f , 0.906339f , 
--0.162211f , 0.555570f , 0.815493f , -0.162572f , 0.552751f , 0.817316f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
--0.318189f , 0.555570f , 0.768177f , -0.318888f , 0.552751f , 0.769890f , 
--0.162211f , -0.555570f , 0.815493f , -0.162572f , -0.552751f , 0.817316f , 
--0.180240f , -0.382683f , 0.906127f , -0.180395f , -0.380535f , 0.906980f , 
--0.318189f , -0.555570f , 0.768177f , -0.318888f , -0.552751f , 0.769890f , 
--0.353553f , -0.382683f , 0.853553f , -0.353862f , -0.380535f , 0.854366f , 
--0.375330f , -0.195090f , 0.906127f , -0.375408f , -0.193915f , 0.906339f , 
--0.544895f , -0.195090f , 0.815493f , -0.545000f , -0.193915f , 0.815668f , 
--0.318189f , 0.555570f , 0.768177f , -0.318888f , 0.552751f , 0.769890f , 
--0.270598f , 0.707107f , 0.653281f , -0.271737f , 0.704031f , 0.656056f , 
--0.461939f , 0.555570f , 0.691341f , -0.462966f , 0.552751f , 0.692892f , 
--0.318189f , -0.555570f , 0.768177f , -0.318888f , -0.552751f , 0.769890f , 
--0.353553f , -0.382683f , 0.853553f , -0.353862f , -0.380535f , 0.854366f , 
--0.461939f , -0.555570f , 0.691341f , -0.462966f , -0.552751f , 0.692892f , 
--0.353553f , 0.382683f , 0.853553f , -0.353893f , 0.380535f , 0.854366f , 
--0.318189f , 0.555570f , 0.768177f , -0.318888f , 0.552751f , 0.769890f , 
--0.513280f , 0.382683f , 0.768177f , -0.513749f , 0.380535f , 0.768914f , 
--0.270598f , -0.707107f , 0.653281f , -0.271737f , -0.704031f , 0.656056f , 
--0.318189f , -0.555570f , 0.768177f , -0.318888f , -0.552751f , 0.769890f , 
--0.392847f , -0.707107f , 0.587937f , -0.394513f , -0.704031f , 0.590442f , 
--0.375330f , 0.195090f , 0.906127f , -0.375408f , 0.193915f , 0.906339f , 
--0.353553f , 0.382683f , 0.853553f , -0.353893f , 0.380535f , 0.854366f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.146446f , 0.923880f , 0.353553f , -0.148412f , 0.921690f , 0.358348f , 
--0.074658f , 0.980785f , 0.180240f , -0.076907f , 0.979583f , 0.185644f , 
--0.212607f , 0.923880f , 0.318190f , -0.215491f , 0.921690f , 0.322489f , 
--0.212607f , -0.831470f , 0.513280f , -0.214209f , -0.828639f , 0.517136f , 
--0.270598f , -0.707107f , 0.653281f , -0.271737f , -0.704031f , 0.656056f , 
--0.308658f , -0.831470f , 0.461939f , -0.310984f , -0.828639f , 0.465407f , 
--0.382683f , 0.000000f , 0.923879f , -0.382672f , 0.000000f , 0.923856f , 
--0.375330f , 0.195090f , 0.906127f , -0.375408f , 0.193915f , 0.906339f , 
--0.555570f , 0.000000f , 0.831469f , -0.555559f , 0.000000f , 0.831446f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.146446f , 0.923880f , 0.353553f , -0.148412f , 0.921690f , 0.358348f , 
--0.308658f , 0.831470f , 0.461939f , -0.310984f , 0.828639f , 0.465407f , 
--0.146446f , -0.923880f , 0.353553f , -0.148412f , -0.921690f , 0.358348f , 
--0.212607f , -0.831470f , 0.513280f , -0.214209f , -0.828639f , 0.517136f , 
--0.212607f , -0.923880f , 0.318189f , -0.215491f , -0.921690f , 0.322489f , 
--0.375330f , -0.195090f , 0.906127f , -0.375408f , -0.193915f , 0.906339f , 
--0.382683f , 0.000000f , 0.923879f , -0.382672f , 0.000000f , 0.923856f , 
--0.544895f , -0.195090f , 0.815493f , -0.545000f , -0.193915f , 0.815668f , 
--0.270598f , 0.707107f , 0.653281f , -0.271737f , 0.704031f , 0.656056f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.074658f , -0.980785f , 0.180240f , -0.076907f , -0.979583f , 0.185644f , 
--0.146446f , -0.923880f , 0.353553f , -0.148412f , -0.921690f , 0.358348f , 
--0.108386f , -0.980785f , 0.162212f , -0.111637f , -0.979583f , 0.167089f , 
--0.212607f , -0.923880f , 0.318189f , -0.215491f , -0.921690f , 0.322489f , 
--0.308658f , -0.831470f , 0.461939f , -0.310984f , -0.828639f , 0.465407f , 
--0.270598f , -0.923880f , 0.270598f , -0.274270f , -0.921690f , 0.274270f , 
--0.544895f , -0.195090f , 0.815493f , -0.545000f , -0.193915f , 0.815668f , 
--0.555570f , 0.000000f , 0.831469f , -0.555559f , 0.000000f , 0.831446f , 
--0.693520f , -0.195090f , 0.693519f , -0.693655f , -0.193915f , 0.693655f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.308658f , 0.831470f , 0.461939f , -0.310984f , 0.828639f , 0.465407f , 
--0.392847f , 0.831470f , 0.392847f , -0.395795f , 0.828639f , 0.395795f , 
--0.108386f , -0.980785f , 0.162212f , -0.111637f , -0.979583f , 0.167089f , 
--0.212607f , -0.923880f , 0.318189f , -0.215491f , -0.921690f , 0.322489f , 
--0.137949f , -0.980785f , 0.137950f , -0.142094f , -0.979583f , 0.142094f , 
--0.513279f , -0.382683f , 0.768177f , -0.513749f , -0.380535f , 0.768914f , 
--0.544895f , -0.195090f , 0.815493f , -0.545000f , -0.193915f , 0.815668f , 
--0.693520f , -0.195090f , 0.693519f , -0.693655f , -0.193915f , 0.693655f , 
--0.461939f , 0.555570f , 0.691341f , -0.462966f , 0.552751f , 0.692892f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.587937f , 0.555570f , 0.587937f , -0.589251f , 0.552751f , 0.589251f , 
--0.461939f , -0.555570f , 0.691341f , -0.462966f , -0.552751f , 0.692892f , 
--0.513279f , -0.382683f , 0.768177f , -0.513749f , -0.380535f , 0.768914f , 
--0.587937f , -0.555570f , 0.587937f , -0.589251f , -0.552751f , 0.589251f , 
--0.513280f , 0.382683f , 0.768177f , -0.513749f , 0.380535f , 0.768914f , 
--0.461939f , 0.555570f , 0.691341f , -0.462966f , 0.552751f , 0.692892f , 
--0.653281f , 0.382683f , 0.653281f , -0.653890f , 0.380535f , 0.653890f , 
--0.392847f , -0.707107f , 0.587937f , -0.394513f , -0.704031f , 0.590442f , 
--0.461939f , -0.555570f , 0.691341f , -0.462966f , -0.552751f , 0.692892f , 
--0.500000f , -0.707107f , 0.500000f , -0.502121f , -0.704031f , 0.502121f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.513280f , 0.382683f , 0.768177f , -0.513749f , 0.380535f , 0.768914f , 
--0.653281f , 0.382683f , 0.653281f , -0.653890f , 0.380535f , 0.653890f , 
--0.212607f , 0.923880f , 0.318190f , -0.215491f , 0.921690f , 0.322489f , 
--0.108386f , 0.980785f , 0.162212f , -0.111637f , 0.979583f , 0.167089f , 
--0.270598f , 0.923880f , 0.270598f , -0.274270f , 0.921690f , 0.274270f , 
--0.308658f , -0.831470f , 0.461939f , -0.310984f , -0.828639f , 0.465407f , 
--0.392847f , -0.707107f , 0.587937f , -0.394513f , -0.704031f , 0.590442f , 
--0.392847f , -0.831470f , 0.392847f , -0.395795f , -0.828639f , 0.395795f , 
--0.555570f , 0.000000f , 0.831469f , -0.555559f , 0.000000f , 0.831446f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.707106f , 0.000000f , 0.707106f , -0.707083f , 0.000000f , 0.707083f , 
--0.308658f , 0.831470f , 0.461939f , -0.310984f , 0.828639f , 0.465407f , 
--0.212607f , 0.923880f , 0.318190f , -0.215491f , 0.921690f , 0.322489f , 
--0.392847f , 0.831470f , 0.392847f , -0.395795f , 0.828639f , 0.395795f , 
--0.392847f , -0.831470f , 0.392847f , -0.395795f , -0.828639f , 0.395795f , 
--0.500000f , -0.707107f , 0.500000f , -0.502121f , -0.704031f , 0.502121f , 
--0.461939f , -0.831470f , 0.308658f , -0.465407f , -0.828639f , 0.310984f , 
--0.707106f , 0.000000f , 0.707106f , -0.707083f , 0.000000f , 0.707083f , 
--0.693519f , 0.195090f , 0.693519f , -0.693655f , 0.193915f , 0.693655f , 
--0.831469f , 0.000000f , 0.555570f , -0.831446f , 0.000000f , 0.555559f , 
--0.392847f , 0.831470f , 0.392847f , -0.395795f , 0.828639f , 0.395795f , 
--0.270598f , 0.923880f , 0.270598f , -0.274270f , 0.921690f , 0.274270f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.270598f , -0.923880f , 0.270598f , -0.274270f , -0.921690f , 0.274270f , 
--0.392847f , -0.831470f , 0.392847f , -0.395795f , -0.828639f , 0.395795f , 
--0.318189f , -0.923880f , 0.212607f , -0.322489f , -0.921690f , 0.215491f , 
--0.693520f , -0.195090f , 0.693519f , -0.693655f , -0.193915f , 0.693655f , 
--0.707106f , 0.000000f , 0.707106f , -0.707083f , 0.000000f , 0.707083f , 
--0.815493f , -0.195090f , 0.544895f , -0.815668f , -0.193915f , 0.545000f , 
--0.500000f , 0.707107f , 0.500000f , -0.502121f , 0.704031f , 0.502121f , 
--0.392847f , 0.831470f , 0.392847f , -0.395795f , 0.828639f , 0.395795f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.137949f , -0.980785f , 0.137950f , -0.142094f , -0.979583f , 0.142094f , 
--0.270598f , -0.923880f , 0.270598f , -0.274270f , -0.921690f , 0.274270f , 
--0.162211f , -0.980785f , 0.108386f , -0.167089f , -0.979583f , 0.111637f , 
--0.653281f , -0.382683f , 0.653281f , -0.653890f , -0.380535f , 0.653890f , 
--0.693520f , -0.195090f , 0.693519f , -0.693655f , -0.193915f , 0.693655f , 
--0.815493f , -0.195090f , 0.544895f , -0.815668f , -0.193915f , 0.545000f , 
--0.587937f , 0.555570f , 0.587937f , -0.589251f , 0.552751f , 0.589251f , 
--0.500000f , 0.707107f , 0.500000f , -0.502121f , 0.704031f , 0.502121f , 
--0.691341f , 0.555570f , 0.461939f , -0.692892f , 0.552751f , 0.462966f , 
--0.587937f , -0.555570f , 0.587937f , -0.589251f , -0.552751f , 0.589251f , 
--0.653281f , -0.382683f , 0.653281f , -0.653890f , -0.380535f , 0.653890f , 
--0.691341f , -0.555570f , 0.461939f , -0.692892f , -0.552751f , 0.462966f , 
--0.653281f , 0.382683f , 0.653281f , -0.653890f , 0.380535f , 0.653890f , 
--0.587937f , 0.555570f , 0.587937f , -0.589251f , 0.552751f , 0.589251f , 
--0.768177f , 0.382683f , 0.513279f , -0.768914f , 0.380535f , 0.513749f , 
--0.500000f , -0.707107f , 0.500000f , -0.502121f , -0.704031f , 0.502121f , 
--0.587937f , -0.555570f , 0.587937f , -0.589251f , -0.552751f , 0.589251f , 
--0.587937f , -0.707107f , 0.392847f , -0.590442f , -0.704031f , 0.394513f , 
--0.693519f , 0.195090f , 0.693519f , -0.693655f , 0.193915f , 0.693655f , 
--0.653281f , 0.382683f , 0.653281f , -0.653890f , 0.380535f , 0.653890f , 
--0.768177f , 0.382683f , 0.513279f , -0.768914f , 0.380535f , 0.513749f , 
--0.270598f , 0.923880f , 0.270598f , -0.274270f , 0.921690f , 0.274270f , 
--0.137950f , 0.980785f , 0.137950f , -0.142094f , 0.979583f , 0.142094f , 
--0.318189f , 0.923880f , 0.212607f , -0.322489f , 0.921690f , 0.215491f , 
--0.587937f , -0.707107f , 0.392847f , -0.590442f , -0.704031f , 0.394513f , 
--0.691341f , -0.555570f , 0.461939f , -0.692892f , -0.552751f , 0.462966f , 
--0.653281f , -0.707107f , 0.270598f , -0.656056f , -0.704031f , 0.271737f , 
--0.815492f , 0.195090f , 0.544895f , -0.815668f , 0.193915f , 0.545000f , 
--0.768177f , 0.382683f , 0.513279f , -0.768914f , 0.380535f , 0.513749f , 
--0.853553f , 0.382683f , 0.353553f , -0.854366f , 0.380535f , 0.353862f , 
--0.318189f , 0.923880f , 0.212607f , -0.322489f , 0.921690f , 0.215491f , 
--0.162212f , 0.980785f , 0.108386f , -0.167089f , 0.979583f , 0.111637f , 
--0.353553f , 0.923880f , 0.146446f , -0.358348f , 0.921690f , 0.148412f , 
--0.461939f , -0.831470f , 0.308658f , -0.465407f , -0.828639f , 0.310984f , 
--0.587937f , -0.707107f , 0.392847f , -0.590442f , -0.704031f , 0.394513f , 
--0.513279f , -0.831470f , 0.212607f , -0.517136f , -0.828639f , 0.214209f , 
--0.831469f , 0.000000f , 0.555570f , -0.831446f , 0.000000f , 0.555559f , 
--0.815492f , 0.195090f , 0.544895f , -0.815668f , 0.193915f , 0.545000f , 
--0.923879f , 0.000000f , 0.382683f , -0.923856f , 0.000000f , 0.382672f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.318189f , 0.923880f , 0.212607f , -0.322489f , 0.921690f , 0.215491f , 
--0.513279f , 0.831470f , 0.212607f , -0.517136f , 0.828639f , 0.214209f , 
--0.318189f , -0.923880f , 0.212607f , -0.322489f , -0.921690f , 0.215491f , 
--0.461939f , -0.831470f , 0.308658f , -0.465407f , -0.828639f , 0.310984f , 
--0.353553f , -0.923880f , 0.146446f , -0.358348f , -0.921690f , 0.148412f , 
--0.815493f , -0.195090f , 0.544895f , -0.815668f , -0.193915f , 0.545000f , 
--0.831469f , 0.000000f , 0.555570f , -0.831446f , 0.000000f , 0.555559f , 
--0.906127f , -0.195090f , 0.375330f , -0.906339f , -0.193915f , 0.375408f , 
--0.587937f , 0.707107f , 0.392847f , -0.590442f , 0.704031f , 0.394513f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.162211f , -0.980785f , 0.108386f , -0.167089f , -0.979583f , 0.111637f , 
--0.318189f , -0.923880f , 0.212607f , -0.322489f , -0.921690f , 0.215491f , 
--0.180240f , -0.980785f , 0.074658f , -0.185644f , -0.979583f , 0.076907f , 
--0.768177f , -0.382683f , 0.513280f , -0.768914f , -0.380535f , 0.513749f , 
--0.815493f , -0.195090f , 0.544895f , -0.815668f , -0.193915f , 0.545000f , 
--0.906127f , -0.195090f , 0.375330f , -0.906339f , -0.193915f , 0.375408f , 
--0.691341f , 0.555570f , 0.461939f , -0.692892f , 0.552751f , 0.462966f , 
--0.587937f , 0.707107f , 0.392847f , -0.590442f , 0.704031f , 0.394513f , 
--0.768177f , 0.555570f , 0.318189f , -0.769890f , 0.552751f , 0.318888f , 
--0.691341f , -0.555570f , 0.461939f , -0.692892f , -0.552751f , 0.462966f , 
--0.768177f , -0.382683f , 0.513280f , -0.768914f , -0.380535f , 0.513749f , 
--0.768177f , -0.555570f , 0.318189f , -0.769890f , -0.552751f , 0.318888f , 
--0.768177f , 0.382683f , 0.513279f , -0.768914f , 0.380535f , 0.513749f , 
--0.691341f , 0.555570f , 0.461939f , -0.692892f , 0.552751f , 0.462966f , 
--0.853553f , 0.382683f , 0.353553f , -0.854366f , 0.380535f , 0.353862f , 
--0.768177f , 0.555570f , 0.318189f , -0.769890f , 0.552751f , 0.318888f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.815493f , 0.555570f , 0.162211f , -0.817316f , 0.552751f , 0.162572f , 
--0.768177f , -0.555570f , 0.318189f , -0.769890f , -0.552751f , 0.318888f , 
--0.853553f , -0.382683f , 0.353553f , -0.854366f , -0.380535f , 0.353862f , 
--0.815493f , -0.555570f , 0.162211f , -0.817316f , -0.552751f , 0.162572f , 
--0.853553f , 0.382683f , 0.353553f , -0.854366f , 0.380535f , 0.353862f , 
--0.768177f , 0.555570f , 0.318189f , -0.769890f , 0.552751f , 0.318888f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.653281f , -0.707107f , 0.270598f , -0.656056f , -0.704031f , 0.271737f , 
--0.768177f , -0.555570f , 0.318189f , -0.769890f , -0.552751f , 0.318888f , 
--0.693519f , -0.707107f , 0.137949f , -0.696493f , -0.704031f , 0.138524f , 
--0.906127f , 0.195090f , 0.375330f , -0.906339f , 0.193915f , 0.375408f , 
--0.853553f , 0.382683f , 0.353553f , -0.854366f , 0.380535f , 0.353862f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.353553f , 0.923880f , 0.146446f , -0.358348f , 0.921690f , 0.148412f , 
--0.180240f , 0.980785f , 0.074658f , -0.185644f , 0.979583f , 0.076907f , 
--0.375330f , 0.923880f , 0.074658f , -0.380413f , 0.921690f , 0.075655f , 
--0.513279f , -0.831470f , 0.212607f , -0.517136f , -0.828639f , 0.214209f , 
--0.653281f , -0.707107f , 0.270598f , -0.656056f , -0.704031f , 0.271737f , 
--0.544895f , -0.831470f , 0.108386f , -0.548997f , -0.828639f , 0.109195f , 
--0.923879f , 0.000000f , 0.382683f , -0.923856f , 0.000000f , 0.382672f , 
--0.906127f , 0.195090f , 0.375330f , -0.906339f , 0.193915f , 0.375408f , 
--0.980784f , 0.000000f , 0.195090f , -0.980773f , 0.000000f , 0.195074f , 
--0.513279f , 0.831470f , 0.212607f , -0.517136f , 0.828639f , 0.214209f , 
--0.353553f , 0.923880f , 0.146446f , -0.358348f , 0.921690f , 0.148412f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.353553f , -0.923880f , 0.146446f , -0.358348f , -0.921690f , 0.148412f , 
--0.513279f , -0.831470f , 0.212607f , -0.517136f , -0.828639f , 0.214209f , 
--0.375330f , -0.923880f , 0.074658f , -0.380413f , -0.921690f , 0.075655f , 
--0.906127f , -0.195090f , 0.375330f , -0.906339f , -0.193915f , 0.375408f , 
--0.923879f , 0.000000f , 0.382683f , -0.923856f , 0.000000f , 0.382672f , 
--0.961939f , -0.195090f , 0.191341f , -0.962157f , -0.193915f , 0.191382f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.513279f , 0.831470f , 0.212607f , -0.517136f , 0.828639f , 0.214209f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.180240f , -0.980785f , 0.074658f , -0.185644f , -0.979583f , 0.076907f , 
--0.353553f , -0.923880f , 0.146446f , -0.358348f , -0.921690f , 0.148412f , 
--0.191341f , -0.980785f , 0.038060f , -0.197089f , -0.979583f , 0.039186f , 
--0.853553f , -0.382683f , 0.353553f , -0.854366f , -0.380535f , 0.353862f , 
--0.906127f , -0.195090f , 0.375330f , -0.906339f , -0.193915f , 0.375408f , 
--0.961939f , -0.195090f , 0.191341f , -0.962157f , -0.193915f , 0.191382f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.195090f , -0.980785f , 0.000000f , -0.200964f , -0.979583f , 0.000000f , 
--0.191341f , -0.980785f , -0.038060f , -0.197089f , -0.979583f , -0.039186f , 
--0.195090f , 0.980785f , 0.000000f , -0.200964f , 0.979583f , 0.000000f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.191342f , 0.980785f , -0.038060f , -0.197089f , 0.979583f , -0.039186f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.191341f , -0.980785f , -0.038060f , -0.197089f , -0.979583f , -0.039186f , 
--0.180240f , -0.980785f , -0.074658f , -0.185644f , -0.979583f , -0.076907f , 
--0.191342f , 0.980785f , -0.038060f , -0.197089f , 0.979583f , -0.039186f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.180240f , 0.980785f , -0.074658f , -0.185644f , 0.979583f , -0.076876f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.180240f , -0.980785f , -0.074658f , -0.185644f , -0.979583f , -0.076907f , 
--0.162211f , -0.980785f , -0.108386f , -0.167089f , -0.979583f , -0.111637f , 
--0.180240f , 0.980785f , -0.074658f , -0.185644f , 0.979583f , -0.076876f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.162212f , 0.980785f , -0.108387f , -0.167089f , 0.979583f , -0.111637f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.162211f , -0.980785f , -0.108386f , -0.167089f , -0.979583f , -0.111637f , 
--0.137949f , -0.980785f , -0.137950f , -0.142094f , -0.979583f , -0.142094f , 
--0.162212f , 0.980785f , -0.108387f , -0.167089f , 0.979583f , -0.111637f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.137950f , 0.980785f , -0.137950f , -0.142094f , 0.979583f , -0.142094f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.137949f , -0.980785f , -0.137950f , -0.142094f , -0.979583f , -0.142094f , 
--0.108386f , -0.980785f , -0.162212f , -0.111637f , -0.979583f , -0.167089f , 
--0.137950f , 0.980785f , -0.137950f , -0.142094f , 0.979583f , -0.142094f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.108386f , 0.980785f , -0.162212f , -0.111637f , 0.979583f , -0.167089f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.108386f , -0.980785f , -0.162212f , -0.111637f , -0.979583f , -0.167089f , 
--0.074658f , -0.980785f , -0.180240f , -0.076907f , -0.979583f , -0.185644f , 
--0.108386f , 0.980785f , -0.162212f , -0.111637f , 0.979583f , -0.167089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.074658f , 0.980785f , -0.180240f , -0.076907f , 0.979583f , -0.185644f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.074658f , -0.980785f , -0.180240f , -0.076907f , -0.979583f , -0.185644f , 
--0.038060f , -0.980785f , -0.191342f , -0.039186f , -0.979583f , -0.197089f , 
--0.074658f , 0.980785f , -0.180240f , -0.076907f , 0.979583f , -0.185644f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.038060f , 0.980785f , -0.191342f , -0.039186f , 0.979583f , -0.197089f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.038060f , -0.980785f , -0.191342f , -0.039186f , -0.979583f , -0.197089f , 
-0.000000f , -0.980785f , -0.195090f , 0.000000f , -0.979583f , -0.200964f , 
--0.038060f , 0.980785f , -0.191342f , -0.039186f , 0.979583f , -0.197089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.000000f , 0.980785f , -0.195091f , 0.000000f , 0.979583f , -0.200964f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.000000f , -0.980785f , -0.195090f , 0.000000f , -0.979583f , -0.200964f , 
-0.038061f , -0.980785f , -0.191342f , 0.039186f , -0.979583f , -0.197089f , 
-0.000000f , 0.980785f , -0.195091f , 0.000000f , 0.979583f , -0.200964f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.038061f , 0.980785f , -0.191342f , 0.039186f , 0.979583f , -0.197089f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.038061f , -0.980785f , -0.191342f , 0.039186f , -0.979583f , -0.197089f , 
-0.074658f , -0.980785f , -0.180240f , 0.076907f , -0.979583f , -0.185644f , 
-0.038061f , 0.980785f , -0.191342f , 0.039186f , 0.979583f , -0.197089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.074658f , 0.980785f , -0.180240f , 0.076907f , 0.979583f , -0.185644f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.074658f , -0.980785f , -0.180240f , 0.076907f , -0.979583f , -0.185644f , 
-0.108387f , -0.980785f , -0.162212f , 0.111637f , -0.979583f , -0.167089f , 
-0.074658f , 0.980785f , -0.180240f , 0.076907f , 0.979583f , -0.185644f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.108387f , 0.980785f , -0.162212f , 0.111637f , 0.979583f , -0.167089f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.108387f , -0.980785f , -0.162212f , 0.111637f , -0.979583f , -0.167089f , 
-0.137950f , -0.980785f , -0.137950f , 0.142094f , -0.979583f , -0.142094f , 
-0.108387f , 0.980785f , -0.162212f , 0.111637f , 0.979583f , -0.167089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.137950f , 0.980785f , -0.137950f , 0.142094f , 0.979583f , -0.142094f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.137950f , -0.980785f , -0.137950f , 0.142094f , -0.979583f , -0.142094f , 
-0.162212f , -0.980785f , -0.108386f , 0.167089f , -0.979583f , -0.111637f , 
-0.137950f , 0.980785f , -0.137950f , 0.142094f , 0.979583f , -0.142094f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.162212f , 0.980785f , -0.108387f , 0.167089f , 0.979583f , -0.111637f , 
-0.162212f , 0.980785f , -0.108387f , 0.167089f , 0.979583f , -0.111637f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.180241f , 0.980785f , -0.074658f , 0.185644f , 0.979583f , -0.076876f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.162212f , -0.980785f , -0.108386f , 0.167089f , -0.979583f , -0.111637f , 
-0.180240f , -0.980785f , -0.074658f , 0.185644f , -0.979583f , -0.076907f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.180240f , -0.980785f , -0.074658f , 0.185644f , -0.979583f , -0.076907f , 
-0.191342f , -0.980785f , -0.038060f , 0.197089f , -0.979583f , -0.039186f , 
-0.180241f , 0.980785f , -0.074658f , 0.185644f , 0.979583f , -0.076876f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.191342f , 0.980785f , -0.038060f , 0.197089f , 0.979583f , -0.039186f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.191342f , -0.980785f , -0.038060f , 0.197089f , -0.979583f , -0.039186f , 
-0.195091f , -0.980785f , 0.000000f , 0.200964f , -0.979583f , 0.000000f , 
-0.191342f , 0.980785f , -0.038060f , 0.197089f , 0.979583f , -0.039186f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.195091f , 0.980785f , 0.000000f , 0.200964f , 0.979583f , 0.000000f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.195091f , -0.980785f , 0.000000f , 0.200964f , -0.979583f , 0.000000f , 
-0.191342f , -0.980785f , 0.038060f , 0.197089f , -0.979583f , 0.039186f , 
-0.195091f , 0.980785f , 0.000000f , 0.200964f , 0.979583f , 0.000000f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.191342f , 0.980785f , 0.038060f , 0.197089f , 0.979583f , 0.039186f , 
-0.191342f , 0.980785f , 0.038060f , 0.197089f , 0.979583f , 0.039186f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.180240f , 0.980785f , 0.074658f , 0.185644f , 0.979583f , 0.076907f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.191342f , -0.980785f , 0.038060f , 0.197089f , -0.979583f , 0.039186f , 
-0.180240f , -0.980785f , 0.074658f , 0.185644f , -0.979583f , 0.076876f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.180240f , -0.980785f , 0.074658f , 0.185644f , -0.979583f , 0.076876f , 
-0.162212f , -0.980785f , 0.108386f , 0.167089f , -0.979583f , 0.111637f , 
-0.180240f , 0.980785f , 0.074658f , 0.185644f , 0.979583f , 0.076907f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.162212f , 0.980785f , 0.108387f , 0.167089f , 0.979583f , 0.111637f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.162212f , -0.980785f , 0.108386f , 0.167089f , -0.979583f , 0.111637f , 
-0.137950f , -0.980785f , 0.137950f , 0.142094f , -0.979583f , 0.142094f , 
-0.162212f , 0.980785f , 0.108387f , 0.167089f , 0.979583f , 0.111637f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.137950f , 0.980785f , 0.137950f , 0.142094f , 0.979583f , 0.142094f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.137950f , -0.980785f , 0.137950f , 0.142094f , -0.979583f , 0.142094f , 
-0.108387f , -0.980785f , 0.162212f , 0.111637f , -0.979583f , 0.167089f , 
-0.137950f , 0.980785f , 0.137950f , 0.142094f , 0.979583f , 0.142094f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.108387f , 0.980785f , 0.162212f , 0.111637f , 0.979583f , 0.167089f , 
-0.108387f , 0.980785f , 0.162212f , 0.111637f , 0.979583f , 0.167089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.074658f , 0.980785f , 0.180240f , 0.076907f , 0.979583f , 0.185644f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.108387f , -0.980785f , 0.162212f , 0.111637f , -0.979583f , 0.167089f , 
-0.074658f , -0.980785f , 0.180240f , 0.076907f , -0.979583f , 0.185644f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.074658f , -0.980785f , 0.180240f , 0.076907f , -0.979583f , 0.185644f , 
-0.038061f , -0.980785f , 0.191342f , 0.039186f , -0.979583f , 0.197089f , 
-0.074658f , 0.980785f , 0.180240f , 0.076907f , 0.979583f , 0.185644f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.038061f , 0.980785f , 0.191342f , 0.039186f , 0.979583f , 0.197089f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.038061f , -0.980785f , 0.191342f , 0.039186f , -0.979583f , 0.197089f , 
-0.000000f , -0.980785f , 0.195090f , 0.000000f , -0.979583f , 0.200964f , 
-0.038061f , 0.980785f , 0.191342f , 0.039186f , 0.979583f , 0.197089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
-0.000000f , 0.980785f , 0.195091f , 0.000000f , 0.979583f , 0.200964f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
-0.000000f , -0.980785f , 0.195090f , 0.000000f , -0.979583f , 0.200964f , 
--0.038060f , -0.980785f , 0.191342f , -0.039186f , -0.979583f , 0.197089f , 
-0.000000f , 0.980785f , 0.195091f , 0.000000f , 0.979583f , 0.200964f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.038060f , 0.980785f , 0.191342f , -0.039186f , 0.979583f , 0.197089f , 
--0.038060f , 0.980785f , 0.191342f , -0.039186f , 0.979583f , 0.197089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.074658f , 0.980785f , 0.180240f , -0.076907f , 0.979583f , 0.185644f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.038060f , -0.980785f , 0.191342f , -0.039186f , -0.979583f , 0.197089f , 
--0.074658f , -0.980785f , 0.180240f , -0.076907f , -0.979583f , 0.185644f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.074658f , -0.980785f , 0.180240f , -0.076907f , -0.979583f , 0.185644f , 
--0.108386f , -0.980785f , 0.162212f , -0.111637f , -0.979583f , 0.167089f , 
--0.074658f , 0.980785f , 0.180240f , -0.076907f , 0.979583f , 0.185644f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.108386f , 0.980785f , 0.162212f , -0.111637f , 0.979583f , 0.167089f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.108386f , -0.980785f , 0.162212f , -0.111637f , -0.979583f , 0.167089f , 
--0.137949f , -0.980785f , 0.137950f , -0.142094f , -0.979583f , 0.142094f , 
--0.108386f , 0.980785f , 0.162212f , -0.111637f , 0.979583f , 0.167089f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.137950f , 0.980785f , 0.137950f , -0.142094f , 0.979583f , 0.142094f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.137949f , -0.980785f , 0.137950f , -0.142094f , -0.979583f , 0.142094f , 
--0.162211f , -0.980785f , 0.108386f , -0.167089f , -0.979583f , 0.111637f , 
--0.137950f , 0.980785f , 0.137950f , -0.142094f , 0.979583f , 0.142094f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.162212f , 0.980785f , 0.108386f , -0.167089f , 0.979583f , 0.111637f , 
--0.162212f , 0.980785f , 0.108386f , -0.167089f , 0.979583f , 0.111637f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.180240f , 0.980785f , 0.074658f , -0.185644f , 0.979583f , 0.076907f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.162211f , -0.980785f , 0.108386f , -0.167089f , -0.979583f , 0.111637f , 
--0.180240f , -0.980785f , 0.074658f , -0.185644f , -0.979583f , 0.076907f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.180240f , -0.980785f , 0.074658f , -0.185644f , -0.979583f , 0.076907f , 
--0.191341f , -0.980785f , 0.038060f , -0.197089f , -0.979583f , 0.039186f , 
--0.180240f , 0.980785f , 0.074658f , -0.185644f , 0.979583f , 0.076907f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.191342f , 0.980785f , 0.038060f , -0.197089f , 0.979583f , 0.039186f , 
--0.961939f , -0.195090f , 0.191341f , -0.962157f , -0.193915f , 0.191382f , 
--0.980784f , 0.000000f , 0.195090f , -0.980773f , 0.000000f , 0.195074f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--0.693519f , 0.707107f , 0.137949f , -0.696493f , 0.704031f , 0.138524f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.707107f , 0.707107f , 0.000000f , -0.710135f , 0.704031f , 0.000000f , 
--0.191341f , -0.980785f , 0.038060f , -0.197089f , -0.979583f , 0.039186f , 
--0.375330f , -0.923880f , 0.074658f , -0.380413f , -0.921690f , 0.075655f , 
--0.382683f , -0.923880f , 0.000000f , -0.387860f , -0.921690f , 0.000000f , 
--0.906127f , -0.382683f , 0.180240f , -0.906980f , -0.380535f , 0.180395f , 
--0.961939f , -0.195090f , 0.191341f , -0.962157f , -0.193915f , 0.191382f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--0.815493f , 0.555570f , 0.162211f , -0.817316f , 0.552751f , 0.162572f , 
--0.693519f , 0.707107f , 0.137949f , -0.696493f , 0.704031f , 0.138524f , 
--0.831470f , 0.555570f , 0.000000f , -0.833338f , 0.552751f , 0.000000f , 
-0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 0.000000f , 
--0.191341f , -0.980785f , 0.038060f , -0.197089f , -0.979583f , 0.039186f , 
--0.195090f , -0.980785f , 0.000000f , -0.200964f , -0.979583f , 0.000000f , 
--0.815493f , -0.555570f , 0.162211f , -0.817316f , -0.552751f , 0.162572f , 
--0.906127f , -0.382683f , 0.180240f , -0.906980f , -0.380535f , 0.180395f , 
--0.923880f , -0.382683f , 0.000000f , -0.924741f , -0.380535f , 0.000000f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.815493f , 0.555570f , 0.162211f , -0.817316f , 0.552751f , 0.162572f , 
--0.923880f , 0.382683f , 0.000000f , -0.924741f , 0.380535f , 0.000000f , 
--0.191342f , 0.980785f , 0.038060f , -0.197089f , 0.979583f , 0.039186f , 
-0.000000f , 1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 
--0.195090f , 0.980785f , 0.000000f , -0.200964f , 0.979583f , 0.000000f , 
--0.693519f , -0.707107f , 0.137949f , -0.696493f , -0.704031f , 0.138524f , 
--0.815493f , -0.555570f , 0.162211f , -0.817316f , -0.552751f , 0.162572f , 
--0.831470f , -0.555570f , 0.000000f , -0.833338f , -0.552751f , 0.000000f , 
--0.961939f , 0.195090f , 0.191341f , -0.962157f , 0.193915f , 0.191382f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.980785f , 0.195090f , 0.000000f , -0.980987f , 0.193915f , 0.000000f , 
--0.375330f , 0.923880f , 0.074658f , -0.380413f , 0.921690f , 0.075655f , 
--0.191342f , 0.980785f , 0.038060f , -0.197089f , 0.979583f , 0.039186f , 
--0.382683f , 0.923880f , 0.000000f , -0.387860f , 0.921690f , 0.000000f , 
--0.544895f , -0.831470f , 0.108386f , -0.548997f , -0.828639f , 0.109195f , 
--0.693519f , -0.707107f , 0.137949f , -0.696493f , -0.704031f , 0.138524f , 
--0.707107f , -0.707107f , 0.000000f , -0.710135f , -0.704031f , 0.000000f , 
--0.980784f , 0.000000f , 0.195090f , -0.980773f , 0.000000f , 0.195074f , 
--0.961939f , 0.195090f , 0.191341f , -0.962157f , 0.193915f , 0.191382f , 
--1.000000f , 0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.375330f , 0.923880f , 0.074658f , -0.380413f , 0.921690f , 0.075655f , 
--0.555570f , 0.831470f , 0.000000f , -0.559771f , 0.828639f , 0.000000f , 
--0.375330f , -0.923880f , 0.074658f , -0.380413f , -0.921690f , 0.075655f , 
--0.544895f , -0.831470f , 0.108386f , -0.548997f , -0.828639f , 0.109195f , 
--0.555570f , -0.831470f , 0.000000f , -0.559771f , -0.828639f , 0.000000f , 
--0.923880f , -0.382683f , 0.000000f , -0.924741f , -0.380535f , 0.000000f , 
--0.906127f , -0.382683f , -0.180240f , -0.906980f , -0.380535f , -0.180395f , 
--0.815493f , -0.555570f , -0.162212f , -0.817316f , -0.552751f , -0.162572f , 
--0.831470f , 0.555570f , 0.000000f , -0.833338f , 0.552751f , 0.000000f , 
--0.815493f , 0.555570f , -0.162212f , -0.817316f , 0.552751f , -0.162572f , 
--0.906127f , 0.382683f , -0.180240f , -0.906980f , 0.380535f , -0.180395f , 
--0.831470f , -0.555570f , 0.000000f , -0.833338f , -0.552751f , 0.000000f , 
--0.815493f , -0.555570f , -0.162212f , -0.817316f , -0.552751f , -0.162572f , 
--0.693520f , -0.707107f , -0.137950f , -0.696493f , -0.704031f , -0.138524f , 
--0.923880f , 0.382683f , 0.000000f , -0.924741f , 0.380535f , 0.000000f , 
--0.906127f , 0.382683f , -0.180240f , -0.906980f , 0.380535f , -0.180395f , 
--0.961940f , 0.195090f , -0.191342f , -0.962157f , 0.193915f , -0.191382f , 
--0.195090f , 0.980785f , 0.000000f , -0.200964f , 0.979583f , 0.000000f , 
--0.191342f , 0.980785f , -0.038060f , -0.197089f , 0.979583f , -0.039186f , 
--0.375330f , 0.923880f , -0.074658f , -0.380413f , 0.921690f , -0.075655f , 
--0.707107f , -0.707107f , 0.000000f , -0.710135f , -0.704031f , 0.000000f , 
--0.693520f , -0.707107f , -0.137950f , -0.696493f , -0.704031f , -0.138524f , 
--0.544895f , -0.831470f , -0.108386f , -0.548997f , -0.828639f , -0.109195f , 
--0.980785f , 0.195090f , 0.000000f , -0.980987f , 0.193915f , 0.000000f , 
--0.961940f , 0.195090f , -0.191342f , -0.962157f , 0.193915f , -0.191382f , 
--0.980785f , 0.000000f , -0.195090f , -0.980773f , 0.000000f , -0.195074f , 
--0.382683f , 0.923880f , 0.000000f , -0.387860f , 0.921690f , 0.000000f , 
--0.375330f , 0.923880f , -0.074658f , -0.380413f , 0.921690f , -0.075655f , 
--0.544895f , 0.831470f , -0.108386f , -0.548997f , 0.828639f , -0.109195f , 
--0.555570f , -0.831470f , 0.000000f , -0.559771f , -0.828639f , 0.000000f , 
--0.544895f , -0.831470f , -0.108386f , -0.548997f , -0.828639f , -0.109195f , 
--0.375330f , -0.923880f , -0.074658f , -0.380413f , -0.921690f , -0.075655f , 
--1.000000f , 0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , 
--0.980785f , 0.000000f , -0.195090f , -0.980773f , 0.000000f , -0.195074f , 
--0.961940f , -0.195090f , -0.191342f , -0.962157f , -0.193915f , -0.191382f , 
--0.555570f , 0.831470f , 0.000000f , -0.559771f , 0.828639f , 0.000000f , 
--0.544895f , 0.831470f , -0.108386f , -0.548997f , 0.828639f , -0.109195f , 
--0.693520f , 0.707107f , -0.137950f , -0.696493f , 0.704031f , -0.138524f , 
--0.382683f , -0.923880f , 0.000000f , -0.387860f , -0.921690f , 0.000000f , 
--0.375330f , -0.923880f , -0.074658f , -0.380413f , -0.921690f , -0.075655f , 
--0.191341f , -0.980785f , -0.038060f , -0.197089f , -0.979583f , -0.039186f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--0.961940f , -0.195090f , -0.191342f , -0.962157f , -0.193915f , -0.191382f , 
--0.906127f , -0.382683f , -0.180240f , -0.906980f , -0.380535f , -0.180395f , 
--0.707107f , 0.707107f , 0.000000f , -0.710135f , 0.704031f , 0.000000f , 
--0.693520f , 0.707107f , -0.137950f , -0.696493f , 0.704031f , -0.138524f , 
--0.815493f , 0.555570f , -0.162212f , -0.817316f , 0.552751f , -0.162572f , 
--0.906127f , -0.382683f , -0.180240f , -0.906980f , -0.380535f , -0.180395f , 
--0.853553f , -0.382683f , -0.353554f , -0.854366f , -0.380535f , -0.353862f , 
--0.768178f , -0.555570f , -0.318190f , -0.769890f , -0.552751f , -0.318888f , 
--0.815493f , 0.555570f , -0.162212f , -0.817316f , 0.552751f , -0.162572f , 
--0.768178f , 0.555570f , -0.318190f , -0.769890f , 0.552751f , -0.318888f , 
--0.853553f , 0.382683f , -0.353553f , -0.854366f , 0.380535f , -0.353862f , 
--0.815493f , -0.555570f , -0.162212f , -0.817316f , -0.552751f , -0.162572f , 
--0.768178f , -0.555570f , -0.318190f , -0.769890f , -0.552751f , -0.318888f , 
--0.653281f , -0.707107f , -0.270598f , -0.656056f , -0.704031f , -0.271737f , 
--0.906127f , 0.382683f , -0.180240f , -0.906980f , 0.380535f , -0.180395f , 
--0.853553f , 0.382683f , -0.353553f , -0.854366f , 0.380535f , -0.353862f , 
--0.906127f , 0.195090f , -0.375330f , -0.906339f , 0.193915f , -0.375408f , 
--0.191342f , 0.980785f , -0.038060f , -0.197089f , 0.979583f , -0.039186f , 
--0.180240f , 0.980785f , -0.074658f , -0.185644f , 0.979583f , -0.076876f , 
--0.353553f , 0.923880f , -0.146447f , -0.358348f , 0.921690f , -0.148412f , 
--0.693520f , -0.707107f , -0.137950f , -0.696493f , -0.704031f , -0.138524f , 
--0.653281f , -0.707107f , -0.270598f , -0.656056f , -0.704031f , -0.271737f , 
--0.513280f , -0.831470f , -0.212608f , -0.517136f , -0.828639f , -0.214209f , 
--0.961940f , 0.195090f , -0.191342f , -0.962157f , 0.193915f , -0.191382f , 
--0.906127f , 0.195090f , -0.375330f , -0.906339f , 0.193915f , -0.375408f , 
--0.923880f , 0.000000f , -0.382684f , -0.923856f , 0.000000f , -0.382672f , 
--0.375330f , 0.923880f , -0.074658f , -0.380413f , 0.921690f , -0.075655f , 
--0.353553f , 0.923880f , -0.146447f , -0.358348f , 0.921690f , -0.148412f , 
--0.513280f , 0.831470f , -0.212608f , -0.517136f , 0.828639f , -0.214209f , 
--0.544895f , -0.831470f , -0.108386f , -0.548997f , -0.828639f , -0.109195f , 
--0.513280f , -0.831470f , -0.212608f , -0.517136f , -0.828639f , -0.214209f , 
--0.353553f , -0.923880f , -0.146447f , -0.358348f , -0.921690f , -0.148412f , 
--0.980785f , 0.000000f , -0.195090f , -0.980773f , 0.000000f , -0.195074f , 
--0.923880f , 0.000000f , -0.382684f , -0.923856f , 0.000000f , -0.382672f , 
--0.906127f , -0.195090f , -0.375330f , -0.906339f , -0.193915f , -0.375408f , 
--0.544895f , 0.831470f , -0.108386f , -0.548997f , 0.828639f , -0.109195f , 
--0.513280f , 0.831470f , -0.212608f , -0.517136f , 0.828639f , -0.214209f , 
--0.653281f , 0.707107f , -0.270598f , -0.656056f , 0.704031f , -0.271737f , 
--0.375330f , -0.923880f , -0.074658f , -0.380413f , -0.921690f , -0.075655f , 
--0.353553f , -0.923880f , -0.146447f , -0.358348f , -0.921690f , -0.148412f , 
--0.180240f , -0.980785f , -0.074658f , -0.185644f , -0.979583f , -0.076907f , 
--0.961940f , -0.195090f , -0.191342f , -0.962157f , -0.193915f , -0.191382f , 
--0.906127f , -0.195090f , -0.375330f , -0.906339f , -0.193915f , -0.375408f , 
--0.853553f , -0.382683f , -0.353554f , -0.854366f , -0.380535f , -0.353862f , 
--0.693520f , 0.707107f , -0.137950f , -0.696493f , 0.704031f , -0.138524f , 
--0.653281f , 0.707107f , -0.270598f , -0.656056f , 0.704031f , -0.271737f , 
--0.768178f , 0.555570f , -0.318190f , -0.769890f , 0.552751f , -0.318888f , 
--0.513280f , 0.831470f , -0.212608f , -0.517136f , 0.828639f , -0.214209f , 
--0.461940f , 0.831470f , -0.308658f , -0.465407f , 0.828639f , -0.310984f , 
--0.587938f , 0.707107f , -0.392848f , -0.590442f , 0.704031f , -0.394513f , 
--0.353553f , -0.923880f , -0.146447f , -0.358348f , -0.921690f , -0.148412f , 
--0.318189f , -0.923880f , -0.212608f , -0.322489f , -0.921690f , -0.215491f , 
--0.162211f , -0.980785f , -0.108386f , -0.167089f , -0.979583f , -0.111637f , 
--0.906127f , -0.195090f , -0.375330f , -0.906339f , -0.193915f , -0.375408f , 
--0.815493f , -0.195090f , -0.544895f , -0.815668f , -0.193915f , -0.545000f , 
--0.768178f , -0.382683f , -0.513280f , -0.768914f , -0.380535f , -0.513749f , 
--0.653281f , 0.707107f , -0.270598f , -0.656056f , 0.704031f , -0.271737f , 
--0.587938f , 0.707107f , -0.392848f , -0.590442f , 0.704031f , -0.394513f , 
--0.691342f , 0.555570f , -0.461940f , -0.692892f , 0.552751f , -0.462966f , 
--0.853553f , -0.382683f , -0.353554f , -0.854366f , -0.380535f , -0.353862f , 
--0.768178f , -0.382683f , -0.513280f , -0.768914f , -0.380535f , -0.513749f , 
--0.691342f , -0.555570f , -0.461940f , -0.692892f , -0.552751f , -0.462966f , 
--0.768178f , 0.555570f , -0.318190f , -0.769890f , 0.552751f , -0.318888f , 
--0.691342f , 0.555570f , -0.461940f , -0.692892f , 0.552751f , -0.462966f , 
--0.768178f , 0.382683f , -0.513280f , -0.768914f , 0.380535f , -0.513749f , 
--0.768178f , -0.555570f , -0.318190f , -0.769890f , -0.552751f , -0.318888f , 
--0.691342f , -0.555570f , -0.461940f , -0.692892f , -0.552751f , -0.462966f , 
--0.587938f , -0.707107f , -0.392848f , -0.590442f , -0.704031f , -0.394513f , 
--0.853553f , 0.382683f , -0.353553f , -0.854366f , 0.380535f , -0.353862f , 
--0.768178f , 0.382683f , -0.513280f , -0.768914f , 0.380535f , -0.513749f , 
--0.815493f , 0.195090f , -0.544895f , -0.815668f , 0.193915f , -0.545000f , 
--0.180240f , 0.980785f , -0.074658f , -0.185644f , 0.979583f , -0.076876f , 
--0.162212f , 0.980785f , -0.108387f , -0.167089f , 0.979583f , -0.111637f , 
--0.318190f , 0.923880f , -0.212608f , -0.322489f , 0.921690f , -0.215491f , 
--0.653281f , -0.707107f , -0.270598f , -0.656056f , -0.704031f , -0.271737f , 
--0.587938f , -0.707107f , -0.392848f , -0.590442f , -0.704031f , -0.394513f , 
--0.461940f , -0.831470f , -0.308658f , -0.465407f , -0.828639f , -0.310984f , 
--0.906127f , 0.195090f , -0.375330f , -0.906339f , 0.193915f , -0.375408f , 
--0.815493f , 0.195090f , -0.544895f , -0.815668f , 0.193915f , -0.545000f , 
--0.831470f , 0.000000f , -0.555570f , -0.831446f , 0.000000f , -0.555559f , 
--0.353553f , 0.923880f , -0.146447f , -0.358348f , 0.921690f , -0.148412f , 
--0.318190f , 0.923880f , -0.212608f , -0.322489f , 0.921690f , -0.215491f , 
--0.461940f , 0.831470f , -0.308658f , -0.465407f , 0.828639f , -0.310984f , 
--0.513280f , -0.831470f , -0.212608f , -0.517136f , -0.828639f , -0.214209f , 
--0.461940f , -0.831470f , -0.308658f , -0.465407f , -0.828639f , -0.310984f , 
--0.318189f , -0.923880f , -0.212608f , -0.322489f , -0.921690f , -0.215491f , 
--0.923880f , 0.000000f , -0.382684f , -0.923856f , 0.000000f , -0.382672f , 
--0.831470f , 0.000000f , -0.555570f , -0.831446f , 0.000000f , -0.555559f , 
--0.815493f , -0.195090f , -0.544895f , -0.815668f , -0.193915f , -0.545000f , 
--0.815493f , 0.195090f , -0.544895f , -0.815668f , 0.193915f , -0.545000f , 
--0.693520f , 0.195090f , -0.693520f , -0.693655f , 0.193915f , -0.693655f , 
--0.707107f , 0.000000f , -0.707107f , -0.707083f , 0.000000f , -0.707083f , 
--0.318190f , 0.923880f , -0.212608f , -0.322489f , 0.921690f , -0.215491f , 
--0.270598f , 0.923880f , -0.270598f , -0.274270f , 0.921690f , -0.274270f , 
--0.392847f , 0.831470f , -0.392848f , -0.395795f , 0.828639f , -0.395795f , 
--0.461940f , -0.831470f , -0.308658f , -0.465407f , -0.828639f , -0.310984f , 
--0.392847f , -0.831470f , -0.392848f , -0.395795f , -0.828639f , -0.395795f , 
--0.270598f , -0.923880f , -0.270598f , -0.274270f , -0.921690f , -0.274270f , 
--0.831470f , 0.000000f , -0.555570f , -0.831446f , 0.000000f , -0.555559f , 
--0.707107f , 0.000000f , -0.707107f , -0.707083f , 0.000000f , -0.707083f , 
--0.693520f , -0.195090f , -0.693520f , -0.693655f , -0.193915f , -0.693655f , 
--0.461940f , 0.831470f , -0.308658f , -0.465407f , 0.828639f , -0.310984f , 
--0.392847f , 0.831470f , -0.392848f , -0.395795f , 0.828639f , -0.395795f , 
--0.500000f , 0.707107f , -0.500000f , -0.502121f , 0.704031f , -0.502121f , 
--0.318189f , -0.923880f , -0.212608f , -0.322489f , -0.921690f , -0.215491f , 
--0.270598f , -0.923880f , -0.270598f , -0.274270f , -0.921690f , -0.274270f , 
--0.137949f , -0.980785f , -0.137950f , -0.142094f , -0.979583f , -0.142094f , 
--0.815493f , -0.195090f , -0.544895f , -0.815668f , -0.193915f , -0.545000f , 
--0.693520f , -0.195090f , -0.693520f , -0.693655f , -0.193915f , -0.693655f , 
--0.653281f , -0.382683f , -0.653282f , -0.653890f , -0.380535f , -0.653890f , 
--0.587938f , 0.707107f , -0.392848f , -0.590442f , 0.704031f , -0.394513f , 
--0.500000f , 0.707107f , -0.500000f , -0.502121f , 0.704031f , -0.502121f , 
--0.587938f , 0.555570f , -0.587938f , -0.589251f , 0.552751f , -0.589251f , 
--0.768178f , -0.382683f , -0.513280f , -0.768914f , -0.380535f , -0.513749f , 
--0.653281f , -0.382683f , -0.653282f , -0.653890f , -0.380535f , -0.653890f , 
--0.587938f , -0.555570f , -0.587938f , -0.589251f , -0.552751f , -0.589251f , 
--0.691342f , 0.555570f , -0.461940f , -0.692892f , 0.552751f , -0.462966f , 
--0.587938f , 0.555570f , -0.587938f , -0.589251f , 0.552751f , -0.589251f , 
--0.653281f , 0.382683f , -0.653282f , -0.653890f , 0.380535f , -0.653890f , 
--0.691342f , -0.555570f , -0.461940f , -0.692892f , -0.552751f , -0.462966f , 
--0.587938f , -0.555570f , -0.587938f , -0.589251f , -0.552751f , -0.589251f , 
--0.500000f , -0.707107f , -0.500000f , -0.502121f , -0.704031f , -0.502121f , 
--0.768178f , 0.382683f , -0.513280f , -0.768914f , 0.380535f , -0.513749f , 
--0.653281f , 0.382683f , -0.653282f , -0.653890f , 0.380535f , -0.653890f , 
--0.693520f , 0.195090f , -0.693520f , -0.693655f , 0.193915f , -0.693655f , 
--0.162212f , 0.980785f , -0.108387f , -0.167089f , 0.979583f , -0.111637f , 
--0.137950f , 0.980785f , -0.137950f , -0.142094f , 0.979583f , -0.142094f , 
--0.270598f , 0.923880f , -0.270598f , -0.274270f , 0.921690f , -0.274270f , 
--0.587938f , -0.707107f , -0.392848f , -0.590442f , -0.704031f , -0.394513f , 
--0.500000f , -0.707107f , -0.500000f , -0.502121f , -0.704031f , -0.502121f , 
--0.392847f , -0.831470f , -0.392848f , -0.395795f , -0.828639f , -0.395795f , 
--0.587938f , -0.555570f , -0.587938f , -0.589251f , -0.552751f , -0.589251f , 
--0.461940f , -0.555570f , -0.691342f , -0.462966f , -0.552751f , -0.692892f , 
--0.392847f , -0.707107f , -0.587938f , -0.394513f , -0.704031f , -0.590442f , 
--0.653281f , 0.382683f , -0.653282f , -0.653890f , 0.380535f , -0.653890f , 
--0.513280f , 0.382683f , -0.768178f , -0.513749f , 0.380535f , -0.768914f , 
--0.544895f , 0.195090f , -0.815493f , -0.545000f , 0.193915f , -0.815668f , 
--0.137950f , 0.980785f , -0.137950f , -0.142094f , 0.979583f , -0.142094f , 
--0.108386f , 0.980785f , -0.162212f , -0.111637f , 0.979583f , -0.167089f , 
--0.212607f , 0.923880f , -0.318190f , -0.215491f , 0.921690f , -0.322489f , 
--0.500000f , -0.707107f , -0.500000f , -0.502121f , -0.704031f , -0.502121f , 
--0.392847f , -0.707107f , -0.587938f , -0.394513f , -0.704031f , -0.590442f , 
--0.308658f , -0.831470f , -0.461940f , -0.310984f , -0.828639f , -0.465407f , 
--0.693520f , 0.195090f , -0.693520f , -0.693655f , 0.193915f , -0.693655f , 
--0.544895f , 0.195090f , -0.815493f , -0.545000f , 0.193915f , -0.815668f , 
--0.555570f , 0.000000f , -0.831470f , -0.555559f , 0.000000f , -0.831446f , 
--0.270598f , 0.923880f , -0.270598f , -0.274270f , 0.921690f , -0.274270f , 
--0.212607f , 0.923880f , -0.318190f , -0.215491f , 0.921690f , -0.322489f , 
--0.308658f , 0.831470f , -0.461940f , -0.310984f , 0.828639f , -0.465407f , 
--0.392847f , -0.831470f , -0.392848f , -0.395795f , -0.828639f , -0.395795f , 
--0.308658f , -0.831470f , -0.461940f , -0.310984f , -0.828639f , -0.465407f , 
--0.212607f , -0.923880f , -0.318190f , -0.215491f , -0.921690f , -0.322489f , 
--0.707107f , 0.000000f , -0.707107f , -0.707083f , 0.000000f , -0.707083f , 
--0.555570f , 0.000000f , -0.831470f , -0.555559f , 0.000000f , -0.831446f , 
--0.544895f , -0.195090f , -0.815493f , -0.545000f , -0.193915f , -0.815668f , 
--0.392847f , 0.831470f , -0.392848f , -0.395795f , 0.828639f , -0.395795f , 
--0.308658f , 0.831470f , -0.461940f , -0.310984f , 0.828639f , -0.465407f , 
--0.392847f , 0.707107f , -0.587938f , -0.394513f , 0.704031f , -0.590442f , 
--0.270598f , -0.923880f , -0.270598f , -0.274270f , -0.921690f , -0.274270f , 
--0.212607f , -0.923880f , -0.318190f , -0.215491f , -0.921690f , -0.322489f , 
--0.108386f , -0.980785f , -0.162212f , -0.111637f , -0.979583f , -0.167089f , 
--0.693520f , -0.195090f , -0.693520f , -0.693655f , -0.193915f , -0.693655f , 
--0.544895f , -0.195090f , -0.815493f , -0.545000f , -0.193915f , -0.815668f , 
--0.513280f , -0.382683f , -0.768178f , -0.513749f , -0.380535f , -0.768914f , 
--0.500000f , 0.707107f , -0.500000f , -0.502121f , 0.704031f , -0.502121f , 
--0.392847f , 0.707107f , -0.587938f , -0.394513f , 0.704031f , -0.590442f , 
--0.461940f , 0.555570f , -0.691342f , -0.462966f , 0.552751f , -0.692892f , 
--0.653281f , -0.382683f , -0.653282f , -0.653890f , -0.380535f , -0.653890f , 
--0.513280f , -0.382683f , -0.768178f , -0.513749f , -0.380535f , -0.768914f , 
--0.461940f , -0.555570f , -0.691342f , -0.462966f , -0.552751f , -0.692892f , 
--0.587938f , 0.555570f , -0.587938f , -0.589251f , 0.552751f , -0.589251f , 
--0.461940f , 0.555570f , -0.691342f , -0.462966f , 0.552751f , -0.692892f , 
--0.513280f , 0.382683f , -0.768178f , -0.513749f , 0.380535f , -0.768914f , 
--0.513280f , -0.382683f , -0.768178f , -0.513749f , -0.380535f , -0.768914f , 
--0.353553f , -0.382683f , -0.853554f , -0.353862f , -0.380535f , -0.854366f , 
--0.318189f , -0.555570f , -0.768178f , -0.318888f , -0.552751f , -0.769890f , 
--0.461940f , 0.555570f , -0.691342f , -0.462966f , 0.552751f , -0.692892f , 
--0.318189f , 0.555570f , -0.768178f , -0.318888f , 0.552751f , -0.769890f , 
--0.353553f , 0.382683f , -0.853554f , -0.353862f , 0.380535f , -0.854366f , 
--0.461940f , -0.555570f , -0.691342f , -0.462966f , -0.552751f , -0.692892f , 
--0.318189f , -0.555570f , -0.768178f , -0.318888f , -0.552751f , -0.769890f , 
--0.270598f , -0.707107f , -0.653282f , -0.271737f , -0.704031f , -0.656056f , 
--0.513280f , 0.382683f , -0.768178f , -0.513749f , 0.380535f , -0.768914f , 
--0.353553f , 0.382683f , -0.853554f , -0.353862f , 0.380535f , -0.854366f , 
--0.375330f , 0.195090f , -0.906128f , -0.375408f , 0.193915f , -0.906339f , 
--0.108386f , 0.980785f , -0.162212f , -0.111637f , 0.979583f , -0.167089f , 
--0.074658f , 0.980785f , -0.180240f , -0.076907f , 0.979583f , -0.185644f , 
--0.146446f , 0.923880f , -0.353554f , -0.148412f , 0.921690f , -0.358348f , 
--0.392847f , -0.707107f , -0.587938f , -0.394513f , -0.704031f , -0.590442f , 
--0.270598f , -0.707107f , -0.653282f , -0.271737f , -0.704031f , -0.656056f , 
--0.212607f , -0.831470f , -0.513280f , -0.214209f , -0.828639f , -0.517136f , 
--0.544895f , 0.195090f , -0.815493f , -0.545000f , 0.193915f , -0.815668f , 
--0.375330f , 0.195090f , -0.906128f , -0.375408f , 0.193915f , -0.906339f , 
--0.382683f , 0.000000f , -0.923880f , -0.382672f , 0.000000f , -0.923856f , 
--0.212607f , 0.923880f , -0.318190f , -0.215491f , 0.921690f , -0.322489f , 
--0.146446f , 0.923880f , -0.353554f , -0.148412f , 0.921690f , -0.358348f , 
--0.212607f , 0.831470f , -0.513280f , -0.214209f , 0.828639f , -0.517136f , 
--0.308658f , -0.831470f , -0.461940f , -0.310984f , -0.828639f , -0.465407f , 
--0.212607f , -0.831470f , -0.513280f , -0.214209f , -0.828639f , -0.517136f , 
--0.146446f , -0.923880f , -0.353553f , -0.148412f , -0.921690f , -0.358348f , 
--0.555570f , 0.000000f , -0.831470f , -0.555559f , 0.000000f , -0.831446f , 
--0.382683f , 0.000000f , -0.923880f , -0.382672f , 0.000000f , -0.923856f , 
--0.375330f , -0.195090f , -0.906128f , -0.375408f , -0.193915f , -0.906339f , 
--0.308658f , 0.831470f , -0.461940f , -0.310984f , 0.828639f , -0.465407f , 
--0.212607f , 0.831470f , -0.513280f , -0.214209f , 0.828639f , -0.517136f , 
--0.270598f , 0.707107f , -0.653282f , -0.271737f , 0.704031f , -0.656056f , 
--0.212607f , -0.923880f , -0.318190f , -0.215491f , -0.921690f , -0.322489f , 
--0.146446f , -0.923880f , -0.353553f , -0.148412f , -0.921690f , -0.358348f , 
--0.074658f , -0.980785f , -0.180240f , -0.076907f , -0.979583f , -0.185644f , 
--0.544895f , -0.195090f , -0.815493f , -0.545000f , -0.193915f , -0.815668f , 
--0.375330f , -0.195090f , -0.906128f , -0.375408f , -0.193915f , -0.906339f , 
--0.353553f , -0.382683f , -0.853554f , -0.353862f , -0.380535f , -0.854366f , 
--0.392847f , 0.707107f , -0.587938f , -0.394513f , 0.704031f , -0.590442f , 
--0.270598f , 0.707107f , -0.653282f , -0.271737f , 0.704031f , -0.656056f , 
--0.318189f , 0.555570f , -0.768178f , -0.318888f , 0.552751f , -0.769890f , 
--0.212607f , 0.831470f , -0.513280f , -0.214209f , 0.828639f , -0.517136f , 
--0.108386f , 0.831470f , -0.544895f , -0.109195f , 0.828639f , -0.548997f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
--0.146446f , -0.923880f , -0.353553f , -0.148412f , -0.921690f , -0.358348f , 
--0.074658f , -0.923880f , -0.375330f , -0.075655f , -0.921690f , -0.380413f , 
--0.038060f , -0.980785f , -0.191342f , -0.039186f , -0.979583f , -0.197089f , 
--0.375330f , -0.195090f , -0.906128f , -0.375408f , -0.193915f , -0.906339f , 
--0.191341f , -0.195090f , -0.961940f , -0.191382f , -0.193915f , -0.962157f , 
--0.180240f , -0.382683f , -0.906128f , -0.180395f , -0.380535f , -0.906980f , 
--0.270598f , 0.707107f , -0.653282f , -0.271737f , 0.704031f , -0.656056f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
--0.162211f , 0.555570f , -0.815493f , -0.162572f , 0.552751f , -0.817316f , 
--0.353553f , -0.382683f , -0.853554f , -0.353862f , -0.380535f , -0.854366f , 
--0.180240f , -0.382683f , -0.906128f , -0.180395f , -0.380535f , -0.906980f , 
--0.162211f , -0.555570f , -0.815493f , -0.162572f , -0.552751f , -0.817316f , 
--0.318189f , 0.555570f , -0.768178f , -0.318888f , 0.552751f , -0.769890f , 
--0.162211f , 0.555570f , -0.815493f , -0.162572f , 0.552751f , -0.817316f , 
--0.180240f , 0.382683f , -0.906128f , -0.180395f , 0.380535f , -0.906980f , 
--0.318189f , -0.555570f , -0.768178f , -0.318888f , -0.552751f , -0.769890f , 
--0.162211f , -0.555570f , -0.815493f , -0.162572f , -0.552751f , -0.817316f , 
--0.137949f , -0.707107f , -0.693520f , -0.138524f , -0.704031f , -0.696493f , 
--0.353553f , 0.382683f , -0.853554f , -0.353862f , 0.380535f , -0.854366f , 
--0.180240f , 0.382683f , -0.906128f , -0.180395f , 0.380535f , -0.906980f , 
--0.191341f , 0.195090f , -0.961940f , -0.191382f , 0.193915f , -0.962157f , 
--0.074658f , 0.980785f , -0.180240f , -0.076907f , 0.979583f , -0.185644f , 
--0.038060f , 0.980785f , -0.191342f , -0.039186f , 0.979583f , -0.197089f , 
--0.074658f , 0.923880f , -0.375331f , -0.075655f , 0.921690f , -0.380413f , 
--0.270598f , -0.707107f , -0.653282f , -0.271737f , -0.704031f , -0.656056f , 
--0.137949f , -0.707107f , -0.693520f , -0.138524f , -0.704031f , -0.696493f , 
--0.108386f , -0.831470f , -0.544895f , -0.109195f , -0.828639f , -0.548997f , 
--0.375330f , 0.195090f , -0.906128f , -0.375408f , 0.193915f , -0.906339f , 
--0.191341f , 0.195090f , -0.961940f , -0.191382f , 0.193915f , -0.962157f , 
--0.195090f , 0.000000f , -0.980785f , -0.195074f , 0.000000f , -0.980773f , 
--0.146446f , 0.923880f , -0.353554f , -0.148412f , 0.921690f , -0.358348f , 
--0.074658f , 0.923880f , -0.375331f , -0.075655f , 0.921690f , -0.380413f , 
--0.108386f , 0.831470f , -0.544895f , -0.109195f , 0.828639f , -0.548997f , 
--0.212607f , -0.831470f , -0.513280f , -0.214209f , -0.828639f , -0.517136f , 
--0.108386f , -0.831470f , -0.544895f , -0.109195f , -0.828639f , -0.548997f , 
--0.074658f , -0.923880f , -0.375330f , -0.075655f , -0.921690f , -0.380413f , 
--0.382683f , 0.000000f , -0.923880f , -0.382672f , 0.000000f , -0.923856f , 
--0.195090f , 0.000000f , -0.980785f , -0.195074f , 0.000000f , -0.980773f , 
--0.191341f , -0.195090f , -0.961940f , -0.191382f , -0.193915f , -0.962157f , 
--0.191341f , 0.195090f , -0.961940f , -0.191382f , 0.193915f , -0.962157f , 
-0.000000f , 0.195090f , -0.980785f , 0.000000f , 0.193915f , -0.980987f , 
-0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 
--0.074658f , 0.923880f , -0.375331f , -0.075655f , 0.921690f , -0.380413f , 
-0.000000f , 0.923880f , -0.382684f , 0.000000f , 0.921690f , -0.387860f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
--0.108386f , -0.831470f , -0.544895f , -0.109195f , -0.828639f , -0.548997f , 
-0.000000f , -0.831470f , -0.555570f , 0.000000f , -0.828639f , -0.559771f , 
-0.000000f , -0.923880f , -0.382684f , 0.000000f , -0.921690f , -0.387860f , 
--0.195090f , 0.000000f , -0.980785f , -0.195074f , 0.000000f , -0.980773f , 
-0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 
-0.000000f , -0.195090f , -0.980785f , 0.000000f , -0.193915f , -0.980987f , 
-0.000000f , 0.707107f , -0.707107f , 0.000000f , 0.704031f , -0.710135f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
--0.074658f , -0.923880f , -0.375330f , -0.075655f , -0.921690f , -0.380413f , 
-0.000000f , -0.923880f , -0.382684f , 0.000000f , -0.921690f , -0.387860f , 
-0.000000f , -0.980785f , -0.195090f , 0.000000f , -0.979583f , -0.200964f , 
--0.191341f , -0.195090f , -0.961940f , -0.191382f , -0.193915f , -0.962157f , 
-0.000000f , -0.195090f , -0.980785f , 0.000000f , -0.193915f , -0.980987f , 
-0.000000f , -0.382683f , -0.923880f , 0.000000f , -0.380535f , -0.924741f , 
--0.137949f , 0.707107f , -0.693520f , -0.138524f , 0.704031f , -0.696493f , 
-0.000000f , 0.707107f , -0.707107f , 0.000000f , 0.704031f , -0.710135f , 
-0.000000f , 0.555570f , -0.831470f , 0.000000f , 0.552751f , -0.833338f , 
--0.180240f , -0.382683f , -0.906128f , -0.180395f , -0.380535f , -0.906980f , 
-0.000000f , -0.382683f , -0.923880f , 0.000000f , -0.380535f , -0.924741f , 
-0.000000f , -0.555570f , -0.831470f , 0.000000f , -0.552751f , -0.833338f , 
--0.162211f , 0.555570f , -0.815493f , -0.162572f , 0.552751f , -0.817316f , 
-0.000000f , 0.555570f , -0.831470f , 0.000000f , 0.552751f , -0.833338f , 
-0.000000f , 0.382683f , -0.923880f , 0.000000f , 0.380535f , -0.924741f , 
--0.162211f , -0.555570f , -0.815493f , -0.162572f , -0.552751f , -0.817316f , 
-0.000000f , -0.555570f , -0.831470f , 0.000000f , -0.552751f , -0.833338f , 
-0.000000f , -0.707107f , -0.707107f , 0.000000f , -0.704031f , -0.710135f , 
--0.180240f , 0.382683f , -0.906128f , -0.180395f , 0.380535f , -0.906980f , 
-0.000000f , 0.382683f , -0.923880f , 0.000000f , 0.380535f , -0.924741f , 
-0.000000f , 0.195090f , -0.980785f , 0.000000f , 0.193915f , -0.980987f , 
--0.038060f , 0.980785f , -0.191342f , -0.039186f , 0.979583f , -0.197089f , 
-0.000000f , 0.980785f , -0.195091f , 0.000000f , 0.979583f , -0.200964f , 
-0.000000f , 0.923880f , -0.382684f , 0.000000f , 0.921690f , -0.387860f , 
--0.137949f , -0.707107f , -0.693520f , -0.138524f , -0.704031f , -0.696493f , 
-0.000000f , -0.707107f , -0.707107f , 0.000000f , -0.704031f , -0.710135f , 
-0.000000f , -0.831470f , -0.555570f , 0.000000f , -0.828639f , -0.559771f , 
-0.000000f , -0.555570f , -0.831470f , 0.000000f , -0.552751f , -0.833338f , 
-0.162212f , -0.555570f , -0.815493f , 0.162572f , -0.552751f , -0.817316f , 
-0.137950f , -0.707107f , -0.693520f , 0.138524f , -0.704031f , -0.696493f , 
-0.000000f , 0.382683f , -0.923880f , 0.000000f , 0.380535f , -0.924741f , 
-0.180240f , 0.382683f , -0.906128f , 0.180395f , 0.380535f , -0.906980f , 
-0.191342f , 0.195090f , -0.961940f , 0.191382f , 0.193915f , -0.962157f , 
-0.000000f , 0.980785f , -0.195091f , 0.000000f , 0.979583f , -0.200964f , 
-0.038061f , 0.980785f , -0.191342f , 0.039186f , 0.979583f , -0.197089f , 
-0.074658f , 0.923880f , -0.375330f , 0.075655f , 0.921690f , -0.380413f , 
-0.000000f , -0.707107f , -0.707107f , 0.000000f , -0.704031f , -0.710135f , 
-0.137950f , -0.707107f , -0.693520f , 0.138524f , -0.704031f , -0.696493f , 
-0.108387f , -0.831470f , -0.544895f , 0.109195f , -0.828639f , -0.548997f , 
-0.000000f , 0.195090f , -0.980785f , 0.000000f , 0.193915f , -0.980987f , 
-0.191342f , 0.195090f , -0.961940f , 0.191382f , 0.193915f , -0.962157f , 
-0.195091f , 0.000000f , -0.980785f , 0.195074f , 0.000000f , -0.980773f , 
-0.000000f , 0.923880f , -0.382684f , 0.000000f , 0.921690f , -0.387860f , 
-0.074658f , 0.923880f , -0.375330f , 0.075655f , 0.921690f , -0.380413f , 
-0.108387f , 0.831470f , -0.544895f , 0.109195f , 0.828639f , -0.548997f , 
-0.000000f , -0.831470f , -0.555570f , 0.000000f , -0.828639f , -0.559771f , 
-0.108387f , -0.831470f , -0.544895f , 0.109195f , -0.828639f , -0.548997f , 
-0.074658f , -0.923880f , -0.375330f , 0.075655f , -0.921690f , -0.380413f , 
-0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , -0.999969f , 
-0.195091f , 0.000000f , -0.980785f , 0.195074f , 0.000000f , -0.980773f , 
-0.191342f , -0.195090f , -0.961940f , 0.191382f , -0.193915f , -0.962157f , 
-0.000000f , 0.831470f , -0.555570f , 0.000000f , 0.828639f , -0.559771f , 
-0.108387f , 0.831470f , -0.544895f , 0.109195f , 0.828639f , -0.548997f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.000000f , -0.923880f , -0.382684f , 0.000000f , -0.921690f , -0.387860f , 
-0.074658f , -0.923880f , -0.375330f , 0.075655f , -0.921690f , -0.380413f , 
-0.038061f , -0.980785f , -0.191342f , 0.039186f , -0.979583f , -0.197089f , 
-0.000000f , -0.195090f , -0.980785f , 0.000000f , -0.193915f , -0.980987f , 
-0.191342f , -0.195090f , -0.961940f , 0.191382f , -0.193915f , -0.962157f , 
-0.180240f , -0.382683f , -0.906128f , 0.180395f , -0.380535f , -0.906980f , 
-0.000000f , 0.707107f , -0.707107f , 0.000000f , 0.704031f , -0.710135f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.162212f , 0.555570f , -0.815493f , 0.162572f , 0.552751f , -0.817316f , 
-0.000000f , -0.382683f , -0.923880f , 0.000000f , -0.380535f , -0.924741f , 
-0.180240f , -0.382683f , -0.906128f , 0.180395f , -0.380535f , -0.906980f , 
-0.162212f , -0.555570f , -0.815493f , 0.162572f , -0.552751f , -0.817316f , 
-0.000000f , 0.555570f , -0.831470f , 0.000000f , 0.552751f , -0.833338f , 
-0.162212f , 0.555570f , -0.815493f , 0.162572f , 0.552751f , -0.817316f , 
-0.180240f , 0.382683f , -0.906128f , 0.180395f , 0.380535f , -0.906980f , 
-0.180240f , -0.382683f , -0.906128f , 0.180395f , -0.380535f , -0.906980f , 
-0.353554f , -0.382683f , -0.853553f , 0.353862f , -0.380535f , -0.854366f , 
-0.318190f , -0.555570f , -0.768178f , 0.318888f , -0.552751f , -0.769890f , 
-0.162212f , 0.555570f , -0.815493f , 0.162572f , 0.552751f , -0.817316f , 
-0.318190f , 0.555570f , -0.768178f , 0.318888f , 0.552751f , -0.769890f , 
-0.353554f , 0.382683f , -0.853553f , 0.353893f , 0.380535f , -0.854366f , 
-0.162212f , -0.555570f , -0.815493f , 0.162572f , -0.552751f , -0.817316f , 
-0.318190f , -0.555570f , -0.768178f , 0.318888f , -0.552751f , -0.769890f , 
-0.270598f , -0.707107f , -0.653282f , 0.271737f , -0.704031f , -0.656056f , 
-0.180240f , 0.382683f , -0.906128f , 0.180395f , 0.380535f , -0.906980f , 
-0.353554f , 0.382683f , -0.853553f , 0.353893f , 0.380535f , -0.854366f , 
-0.375331f , 0.195090f , -0.906127f , 0.375408f , 0.193915f , -0.906339f , 
-0.038061f , 0.980785f , -0.191342f , 0.039186f , 0.979583f , -0.197089f , 
-0.074658f , 0.980785f , -0.180240f , 0.076907f , 0.979583f , -0.185644f , 
-0.146447f , 0.923880f , -0.353554f , 0.148412f , 0.921690f , -0.358348f , 
-0.137950f , -0.707107f , -0.693520f , 0.138524f , -0.704031f , -0.696493f , 
-0.270598f , -0.707107f , -0.653282f , 0.271737f , -0.704031f , -0.656056f , 
-0.212608f , -0.831470f , -0.513280f , 0.214209f , -0.828639f , -0.517136f , 
-0.191342f , 0.195090f , -0.961940f , 0.191382f , 0.193915f , -0.962157f , 
-0.375331f , 0.195090f , -0.906127f , 0.375408f , 0.193915f , -0.906339f , 
-0.382684f , 0.000000f , -0.923880f , 0.382672f , 0.000000f , -0.923856f , 
-0.074658f , 0.923880f , -0.375330f , 0.075655f , 0.921690f , -0.380413f , 
-0.146447f , 0.923880f , -0.353554f , 0.148412f , 0.921690f , -0.358348f , 
-0.212608f , 0.831470f , -0.513280f , 0.214209f , 0.828639f , -0.517136f , 
-0.108387f , -0.831470f , -0.544895f , 0.109195f , -0.828639f , -0.548997f , 
-0.212608f , -0.831470f , -0.513280f , 0.214209f , -0.828639f , -0.517136f , 
-0.146447f , -0.923880f , -0.353553f , 0.148412f , -0.921690f , -0.358348f , 
-0.195091f , 0.000000f , -0.980785f , 0.195074f , 0.000000f , -0.980773f , 
-0.382684f , 0.000000f , -0.923880f , 0.382672f , 0.000000f , -0.923856f , 
-0.375331f , -0.195090f , -0.906127f , 0.375408f , -0.193915f , -0.906339f , 
-0.270598f , 0.707107f , -0.653282f , 0.271737f , 0.704031f , -0.656056f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.212608f , 0.831470f , -0.513280f , 0.214209f , 0.828639f , -0.517136f , 
-0.074658f , -0.923880f , -0.375330f , 0.075655f , -0.921690f , -0.380413f , 
-0.146447f , -0.923880f , -0.353553f , 0.148412f , -0.921690f , -0.358348f , 
-0.074658f , -0.980785f , -0.180240f , 0.076907f , -0.979583f , -0.185644f , 
-0.191342f , -0.195090f , -0.961940f , 0.191382f , -0.193915f , -0.962157f , 
-0.375331f , -0.195090f , -0.906127f , 0.375408f , -0.193915f , -0.906339f , 
-0.353554f , -0.382683f , -0.853553f , 0.353862f , -0.380535f , -0.854366f , 
-0.137950f , 0.707107f , -0.693520f , 0.138524f , 0.704031f , -0.696493f , 
-0.270598f , 0.707107f , -0.653282f , 0.271737f , 0.704031f , -0.656056f , 
-0.318190f , 0.555570f , -0.768178f , 0.318888f , 0.552751f , -0.769890f , 
-0.146447f , -0.923880f , -0.353553f , 0.148412f , -0.921690f , -0.358348f , 
-0.212608f , -0.923880f , -0.318190f , 0.215491f , -0.921690f , -0.322489f , 
-0.108387f , -0.980785f , -0.162212f , 0.111637f , -0.979583f , -0.167089f , 
-0.375331f , -0.195090f , -0.906127f , 0.375408f , -0.193915f , -0.906339f , 
-0.544895f , -0.195090f , -0.815493f , 0.545000f , -0.193915f , -0.815668f , 
-0.513280f , -0.382683f , -0.768178f , 0.513749f , -0.380535f , -0.768914f , 
-0.270598f , 0.707107f , -0.653282f , 0.271737f , 0.704031f , -0.656056f , 
-0.392848f , 0.707107f , -0.587938f , 0.394513f , 0.704031f , -0.590442f , 
-0.461940f , 0.555570f , -0.691342f , 0.462966f , 0.552751f , -0.692892f , 
-0.353554f , -0.382683f , -0.853553f , 0.353862f , -0.380535f , -0.854366f , 
-0.513280f , -0.382683f , -0.768178f , 0.513749f , -0.380535f , -0.768914f , 
-0.461940f , -0.555570f , -0.691342f , 0.462966f , -0.552751f , -0.692892f , 
-0.318190f , 0.555570f , -0.768178f , 0.318888f , 0.552751f , -0.769890f , 
-0.461940f , 0.555570f , -0.691342f , 0.462966f , 0.552751f , -0.692892f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.318190f , -0.555570f , -0.768178f , 0.318888f , -0.552751f , -0.769890f , 
-0.461940f , -0.555570f , -0.691342f , 0.462966f , -0.552751f , -0.692892f , 
-0.392848f , -0.707107f , -0.587938f , 0.394513f , -0.704031f , -0.590442f , 
-0.353554f , 0.382683f , -0.853553f , 0.353893f , 0.380535f , -0.854366f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.544895f , 0.195090f , -0.815493f , 0.545000f , 0.193915f , -0.815668f , 
-0.074658f , 0.980785f , -0.180240f , 0.076907f , 0.979583f , -0.185644f , 
-0.108387f , 0.980785f , -0.162212f , 0.111637f , 0.979583f , -0.167089f , 
-0.212608f , 0.923880f , -0.318190f , 0.215491f , 0.921690f , -0.322489f , 
-0.270598f , -0.707107f , -0.653282f , 0.271737f , -0.704031f , -0.656056f , 
-0.392848f , -0.707107f , -0.587938f , 0.394513f , -0.704031f , -0.590442f , 
-0.308659f , -0.831470f , -0.461940f , 0.310984f , -0.828639f , -0.465407f , 
-0.375331f , 0.195090f , -0.906127f , 0.375408f , 0.193915f , -0.906339f , 
-0.544895f , 0.195090f , -0.815493f , 0.545000f , 0.193915f , -0.815668f , 
-0.555571f , 0.000000f , -0.831470f , 0.555559f , 0.000000f , -0.831446f , 
-0.146447f , 0.923880f , -0.353554f , 0.148412f , 0.921690f , -0.358348f , 
-0.212608f , 0.923880f , -0.318190f , 0.215491f , 0.921690f , -0.322489f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.212608f , -0.831470f , -0.513280f , 0.214209f , -0.828639f , -0.517136f , 
-0.308659f , -0.831470f , -0.461940f , 0.310984f , -0.828639f , -0.465407f , 
-0.212608f , -0.923880f , -0.318190f , 0.215491f , -0.921690f , -0.322489f , 
-0.382684f , 0.000000f , -0.923880f , 0.382672f , 0.000000f , -0.923856f , 
-0.555571f , 0.000000f , -0.831470f , 0.555559f , 0.000000f , -0.831446f , 
-0.544895f , -0.195090f , -0.815493f , 0.545000f , -0.193915f , -0.815668f , 
-0.392848f , 0.707107f , -0.587938f , 0.394513f , 0.704031f , -0.590442f , 
-0.270598f , 0.707107f , -0.653282f , 0.271737f , 0.704031f , -0.656056f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.212608f , 0.923880f , -0.318190f , 0.215491f , 0.921690f , -0.322489f , 
-0.270599f , 0.923880f , -0.270598f , 0.274270f , 0.921690f , -0.274270f , 
-0.392848f , 0.831470f , -0.392847f , 0.395795f , 0.828639f , -0.395795f , 
-0.308659f , -0.831470f , -0.461940f , 0.310984f , -0.828639f , -0.465407f , 
-0.392848f , -0.831470f , -0.392847f , 0.395795f , -0.828639f , -0.395795f , 
-0.270598f , -0.923880f , -0.270598f , 0.274270f , -0.921690f , -0.274270f , 
-0.555571f , 0.000000f , -0.831470f , 0.555559f , 0.000000f , -0.831446f , 
-0.707107f , 0.000000f , -0.707107f , 0.707083f , 0.000000f , -0.707083f , 
-0.693520f , -0.195090f , -0.693520f , 0.693655f , -0.193915f , -0.693655f , 
-0.308659f , 0.831470f , -0.461940f , 0.310984f , 0.828639f , -0.465407f , 
-0.392848f , 0.831470f , -0.392847f , 0.395795f , 0.828639f , -0.395795f , 
-0.500000f , 0.707107f , -0.500000f , 0.502121f , 0.704031f , -0.502121f , 
-0.212608f , -0.923880f , -0.318190f , 0.215491f , -0.921690f , -0.322489f , 
-0.270598f , -0.923880f , -0.270598f , 0.274270f , -0.921690f , -0.274270f , 
-0.137950f , -0.980785f , -0.137950f , 0.142094f , -0.979583f , -0.142094f , 
-0.544895f , -0.195090f , -0.815493f , 0.545000f , -0.193915f , -0.815668f , 
-0.693520f , -0.195090f , -0.693520f , 0.693655f , -0.193915f , -0.693655f , 
-0.653282f , -0.382683f , -0.653281f , 0.653890f , -0.380535f , -0.653890f , 
-0.392848f , 0.707107f , -0.587938f , 0.394513f , 0.704031f , -0.590442f , 
-0.500000f , 0.707107f , -0.500000f , 0.502121f , 0.704031f , -0.502121f , 
-0.587938f , 0.555570f , -0.587938f , 0.589251f , 0.552751f , -0.589251f , 
-0.513280f , -0.382683f , -0.768178f , 0.513749f , -0.380535f , -0.768914f , 
-0.653282f , -0.382683f , -0.653281f , 0.653890f , -0.380535f , -0.653890f , 
-0.587938f , -0.555570f , -0.587938f , 0.589251f , -0.552751f , -0.589251f , 
-0.653282f , 0.382683f , -0.653281f , 0.653890f , 0.380535f , -0.653890f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.587938f , 0.555570f , -0.587938f , 0.589251f , 0.552751f , -0.589251f , 
-0.461940f , -0.555570f , -0.691342f , 0.462966f , -0.552751f , -0.692892f , 
-0.587938f , -0.555570f , -0.587938f , 0.589251f , -0.552751f , -0.589251f , 
-0.500000f , -0.707107f , -0.500000f , 0.502121f , -0.704031f , -0.502121f , 
-0.513280f , 0.382683f , -0.768178f , 0.513749f , 0.380535f , -0.768914f , 
-0.653282f , 0.382683f , -0.653281f , 0.653890f , 0.380535f , -0.653890f , 
-0.693520f , 0.195090f , -0.693520f , 0.693655f , 0.193915f , -0.693655f , 
-0.108387f , 0.980785f , -0.162212f , 0.111637f , 0.979583f , -0.167089f , 
-0.137950f , 0.980785f , -0.137950f , 0.142094f , 0.979583f , -0.142094f , 
-0.270599f , 0.923880f , -0.270598f , 0.274270f , 0.921690f , -0.274270f , 
-0.392848f , -0.707107f , -0.587938f , 0.394513f , -0.704031f , -0.590442f , 
-0.500000f , -0.707107f , -0.500000f , 0.502121f , -0.704031f , -0.502121f , 
-0.392848f , -0.831470f , -0.392847f , 0.395795f , -0.828639f , -0.395795f , 
-0.544895f , 0.195090f , -0.815493f , 0.545000f , 0.193915f , -0.815668f , 
-0.693520f , 0.195090f , -0.693520f , 0.693655f , 0.193915f , -0.693655f , 
-0.707107f , 0.000000f , -0.707107f , 0.707083f , 0.000000f , -0.707083f , 
-0.653282f , 0.382683f , -0.653281f , 0.653890f , 0.380535f , -0.653890f , 
-0.768178f , 0.382683f , -0.513280f , 0.768914f , 0.380535f , -0.513749f , 
-0.815493f , 0.195090f , -0.544895f , 0.815668f , 0.193915f , -0.545000f , 
-0.137950f , 0.980785f , -0.137950f , 0.142094f , 0.979583f , -0.142094f , 
-0.162212f , 0.980785f , -0.108387f , 0.167089f , 0.979583f , -0.111637f , 
-0.318190f , 0.923880f , -0.212608f , 0.322489f , 0.921690f , -0.215491f , 
-0.500000f , -0.707107f , -0.500000f , 0.502121f , -0.704031f , -0.502121f , 
-0.587938f , -0.707107f , -0.392847f , 0.590442f , -0.704031f , -0.394513f , 
-0.461940f , -0.831470f , -0.308658f , 0.465407f , -0.828639f , -0.310984f , 
-0.693520f , 0.195090f , -0.693520f , 0.693655f , 0.193915f , -0.693655f , 
-0.815493f , 0.195090f , -0.544895f , 0.815668f , 0.193915f , -0.545000f , 
-0.831470f , 0.000000f , -0.555570f , 0.831446f , 0.000000f , -0.555559f , 
-0.270599f , 0.923880f , -0.270598f , 0.274270f , 0.921690f , -0.274270f , 
-0.318190f , 0.923880f , -0.212608f , 0.322489f , 0.921690f , -0.215491f , 
-0.461940f , 0.831470f , -0.308658f , 0.465407f , 0.828639f , -0.310984f , 
-0.392848f , -0.831470f , -0.392847f , 0.395795f , -0.828639f , -0.395795f , 
-0.461940f , -0.831470f , -0.308658f , 0.465407f , -0.828639f , -0.310984f , 
-0.318190f , -0.923880f , -0.212608f , 0.322489f , -0.921690f , -0.215491f , 
-0.707107f , 0.000000f , -0.707107f , 0.707083f , 0.000000f , -0.707083f , 
-0.831470f , 0.000000f , -0.555570f , 0.831446f , 0.000000f , -0.555559f , 
-0.815493f , -0.195090f , -0.544895f , 0.815668f , -0.193915f , -0.545000f , 
-0.392848f , 0.831470f , -0.392847f , 0.395795f , 0.828639f , -0.395795f , 
-0.461940f , 0.831470f , -0.308658f , 0.465407f , 0.828639f , -0.310984f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.270598f , -0.923880f , -0.270598f , 0.274270f , -0.921690f , -0.274270f , 
-0.318190f , -0.923880f , -0.212608f , 0.322489f , -0.921690f , -0.215491f , 
-0.162212f , -0.980785f , -0.108386f , 0.167089f , -0.979583f , -0.111637f , 
-0.693520f , -0.195090f , -0.693520f , 0.693655f , -0.193915f , -0.693655f , 
-0.815493f , -0.195090f , -0.544895f , 0.815668f , -0.193915f , -0.545000f , 
-0.768178f , -0.382683f , -0.513280f , 0.768914f , -0.380535f , -0.513749f , 
-0.500000f , 0.707107f , -0.500000f , 0.502121f , 0.704031f , -0.502121f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.691342f , 0.555570f , -0.461940f , 0.692892f , 0.552751f , -0.462966f , 
-0.653282f , -0.382683f , -0.653281f , 0.653890f , -0.380535f , -0.653890f , 
-0.768178f , -0.382683f , -0.513280f , 0.768914f , -0.380535f , -0.513749f , 
-0.691342f , -0.555570f , -0.461940f , 0.692892f , -0.552751f , -0.462966f , 
-0.768178f , 0.382683f , -0.513280f , 0.768914f , 0.380535f , -0.513749f , 
-0.653282f , 0.382683f , -0.653281f , 0.653890f , 0.380535f , -0.653890f , 
-0.691342f , 0.555570f , -0.461940f , 0.692892f , 0.552751f , -0.462966f , 
-0.587938f , -0.555570f , -0.587938f , 0.589251f , -0.552751f , -0.589251f , 
-0.691342f , -0.555570f , -0.461940f , 0.692892f , -0.552751f , -0.462966f , 
-0.587938f , -0.707107f , -0.392847f , 0.590442f , -0.704031f , -0.394513f , 
-0.768178f , -0.382683f , -0.513280f , 0.768914f , -0.380535f , -0.513749f , 
-0.853554f , -0.382683f , -0.353553f , 0.854366f , -0.380535f , -0.353862f , 
-0.768178f , -0.555570f , -0.318190f , 0.769890f , -0.552751f , -0.318888f , 
-0.853554f , 0.382683f , -0.353553f , 0.854366f , 0.380535f , -0.353862f , 
-0.768178f , 0.382683f , -0.513280f , 0.768914f , 0.380535f , -0.513749f , 
-0.768178f , 0.555570f , -0.318190f , 0.769890f , 0.552751f , -0.318888f , 
-0.691342f , -0.555570f , -0.461940f , 0.692892f , -0.552751f , -0.462966f , 
-0.768178f , -0.555570f , -0.318190f , 0.769890f , -0.552751f , -0.318888f , 
-0.653282f , -0.707107f , -0.270598f , 0.656056f , -0.704031f , -0.271737f , 
-0.768178f , 0.382683f , -0.513280f , 0.768914f , 0.380535f , -0.513749f , 
-0.853554f , 0.382683f , -0.353553f , 0.854366f , 0.380535f , -0.353862f , 
-0.906128f , 0.195090f , -0.375330f , 0.906339f , 0.193915f , -0.375408f , 
-0.162212f , 0.980785f , -0.108387f , 0.167089f , 0.979583f , -0.111637f , 
-0.180241f , 0.980785f , -0.074658f , 0.185644f , 0.979583f , -0.076876f , 
-0.353554f , 0.923880f , -0.146447f , 0.358348f , 0.921690f , -0.148412f , 
-0.587938f , -0.707107f , -0.392847f , 0.590442f , -0.704031f , -0.394513f , 
-0.653282f , -0.707107f , -0.270598f , 0.656056f , -0.704031f , -0.271737f , 
-0.513280f , -0.831470f , -0.212607f , 0.517136f , -0.828639f , -0.214209f , 
-0.815493f , 0.195090f , -0.544895f , 0.815668f , 0.193915f , -0.545000f , 
-0.906128f , 0.195090f , -0.375330f , 0.906339f , 0.193915f , -0.375408f , 
-0.923880f , 0.000000f , -0.382683f , 0.923856f , 0.000000f , -0.382672f , 
-0.318190f , 0.923880f , -0.212608f , 0.322489f , 0.921690f , -0.215491f , 
-0.353554f , 0.923880f , -0.146447f , 0.358348f , 0.921690f , -0.148412f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.461940f , -0.831470f , -0.308658f , 0.465407f , -0.828639f , -0.310984f , 
-0.513280f , -0.831470f , -0.212607f , 0.517136f , -0.828639f , -0.214209f , 
-0.353554f , -0.923880f , -0.146447f , 0.358348f , -0.921690f , -0.148412f , 
-0.831470f , 0.000000f , -0.555570f , 0.831446f , 0.000000f , -0.555559f , 
-0.923880f , 0.000000f , -0.382683f , 0.923856f , 0.000000f , -0.382672f , 
-0.906128f , -0.195090f , -0.375330f , 0.906339f , -0.193915f , -0.375408f , 
-0.653282f , 0.707107f , -0.270598f , 0.656056f , 0.704031f , -0.271737f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.318190f , -0.923880f , -0.212608f , 0.322489f , -0.921690f , -0.215491f , 
-0.353554f , -0.923880f , -0.146447f , 0.358348f , -0.921690f , -0.148412f , 
-0.180240f , -0.980785f , -0.074658f , 0.185644f , -0.979583f , -0.076907f , 
-0.815493f , -0.195090f , -0.544895f , 0.815668f , -0.193915f , -0.545000f , 
-0.906128f , -0.195090f , -0.375330f , 0.906339f , -0.193915f , -0.375408f , 
-0.853554f , -0.382683f , -0.353553f , 0.854366f , -0.380535f , -0.353862f , 
-0.587938f , 0.707107f , -0.392847f , 0.590442f , 0.704031f , -0.394513f , 
-0.653282f , 0.707107f , -0.270598f , 0.656056f , 0.704031f , -0.271737f , 
-0.768178f , 0.555570f , -0.318190f , 0.769890f , 0.552751f , -0.318888f , 
-0.353554f , -0.923880f , -0.146447f , 0.358348f , -0.921690f , -0.148412f , 
-0.375331f , -0.923880f , -0.074658f , 0.380413f , -0.921690f , -0.075655f , 
-0.191342f , -0.980785f , -0.038060f , 0.197089f , -0.979583f , -0.039186f , 
-0.906128f , -0.195090f , -0.375330f , 0.906339f , -0.193915f , -0.375408f , 
-0.961940f , -0.195090f , -0.191342f , 0.962157f , -0.193915f , -0.191382f , 
-0.906128f , -0.382683f , -0.180240f , 0.906980f , -0.380535f , -0.180395f , 
-0.653282f , 0.707107f , -0.270598f , 0.656056f , 0.704031f , -0.271737f , 
-0.693520f , 0.707107f , -0.137950f , 0.696493f , 0.704031f , -0.138524f , 
-0.815493f , 0.555570f , -0.162212f , 0.817316f , 0.552751f , -0.162572f , 
-0.853554f , -0.382683f , -0.353553f , 0.854366f , -0.380535f , -0.353862f , 
-0.906128f , -0.382683f , -0.180240f , 0.906980f , -0.380535f , -0.180395f , 
-0.815493f , -0.555570f , -0.162212f , 0.817316f , -0.552751f , -0.162572f , 
-0.906128f , 0.382683f , -0.180240f , 0.906980f , 0.380535f , -0.180395f , 
-0.853554f , 0.382683f , -0.353553f , 0.854366f , 0.380535f , -0.353862f , 
-0.815493f , 0.555570f , -0.162212f , 0.817316f , 0.552751f , -0.162572f , 
-0.768178f , -0.555570f , -0.318190f , 0.769890f , -0.552751f , -0.318888f , 
-0.815493f , -0.555570f , -0.162212f , 0.817316f , -0.552751f , -0.162572f , 
-0.693520f , -0.707107f , -0.137950f , 0.696493f , -0.704031f , -0.138524f , 
-0.853554f , 0.382683f , -0.353553f , 0.854366f , 0.380535f , -0.353862f , 
-0.906128f , 0.382683f , -0.180240f , 0.906980f , 0.380535f , -0.180395f , 
-0.961940f , 0.195090f , -0.191342f , 0.962157f , 0.193915f , -0.191382f , 
-0.180241f , 0.980785f , -0.074658f , 0.185644f , 0.979583f , -0.076876f , 
-0.191342f , 0.980785f , -0.038060f , 0.197089f , 0.979583f , -0.039186f , 
-0.375331f , 0.923880f , -0.074658f , 0.380413f , 0.921690f , -0.075655f , 
-0.653282f , -0.707107f , -0.270598f , 0.656056f , -0.704031f , -0.271737f , 
-0.693520f , -0.707107f , -0.137950f , 0.696493f , -0.704031f , -0.138524f , 
-0.544895f , -0.831470f , -0.108386f , 0.548997f , -0.828639f , -0.109195f , 
-0.906128f , 0.195090f , -0.375330f , 0.906339f , 0.193915f , -0.375408f , 
-0.961940f , 0.195090f , -0.191342f , 0.962157f , 0.193915f , -0.191382f , 
-0.980785f , 0.000000f , -0.195090f , 0.980773f , 0.000000f , -0.195074f , 
-0.353554f , 0.923880f , -0.146447f , 0.358348f , 0.921690f , -0.148412f , 
-0.375331f , 0.923880f , -0.074658f , 0.380413f , 0.921690f , -0.075655f , 
-0.544895f , 0.831470f , -0.108386f , 0.548997f , 0.828639f , -0.109195f , 
-0.513280f , -0.831470f , -0.212607f , 0.517136f , -0.828639f , -0.214209f , 
-0.544895f , -0.831470f , -0.108386f , 0.548997f , -0.828639f , -0.109195f , 
-0.375331f , -0.923880f , -0.074658f , 0.380413f , -0.921690f , -0.075655f , 
-0.923880f , 0.000000f , -0.382683f , 0.923856f , 0.000000f , -0.382672f , 
-0.980785f , 0.000000f , -0.195090f , 0.980773f , 0.000000f , -0.195074f , 
-0.961940f , -0.195090f , -0.191342f , 0.962157f , -0.193915f , -0.191382f , 
-0.513280f , 0.831470f , -0.212607f , 0.517136f , 0.828639f , -0.214209f , 
-0.544895f , 0.831470f , -0.108386f , 0.548997f , 0.828639f , -0.109195f , 
-0.693520f , 0.707107f , -0.137950f , 0.696493f , 0.704031f , -0.138524f , 
-0.375331f , 0.923880f , -0.074658f , 0.380413f , 0.921690f , -0.075655f , 
-0.382684f , 0.923880f , 0.000000f , 0.387860f , 0.921690f , 0.000000f , 
-0.555570f , 0.831470f , 0.000000f , 0.559771f , 0.828639f , 0.000000f , 
-0.544895f , -0.831470f , -0.108386f , 0.548997f , -0.828639f , -0.109195f , 
-0.555570f , -0.831470f , 0.000000f , 0.559771f , -0.828639f , 0.000000f , 
-0.382684f , -0.923880f , 0.000000f , 0.387860f , -0.921690f , 0.000000f , 
-0.980785f , 0.000000f , -0.195090f , 0.980773f , 0.000000f , -0.195074f , 
-1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 
-0.980785f , -0.195090f , 0.000000f , 0.980987f , -0.193915f , 0.000000f , 
-0.544895f , 0.831470f , -0.108386f , 0.548997f , 0.828639f , -0.109195f , 
-0.555570f , 0.831470f , 0.000000f , 0.559771f , 0.828639f , 0.000000f , 
-0.707107f , 0.707107f , 0.000000f , 0.710135f , 0.704031f , 0.000000f , 
-0.375331f , -0.923880f , -0.074658f , 0.380413f , -0.921690f , -0.075655f , 
-0.382684f , -0.923880f , 0.000000f , 0.387860f , -0.921690f , 0.000000f , 
-0.195091f , -0.980785f , 0.000000f , 0.200964f , -0.979583f , 0.000000f , 
-0.961940f , -0.195090f , -0.191342f , 0.962157f , -0.193915f , -0.191382f , 
-0.980785f , -0.195090f , 0.000000f , 0.980987f , -0.193915f , 0.000000f , 
-0.923880f , -0.382683f , 0.000000f , 0.924741f , -0.380535f , 0.000000f , 
-0.693520f , 0.707107f , -0.137950f , 0.696493f , 0.704031f , -0.138524f , 
-0.707107f , 0.707107f , 0.000000f , 0.710135f , 0.704031f , 0.000000f , 
-0.831470f , 0.555570f , 0.000000f , 0.833338f , 0.552751f , 0.000000f , 
-0.906128f , -0.382683f , -0.180240f , 0.906980f , -0.380535f , -0.180395f , 
-0.923880f , -0.382683f , 0.000000f , 0.924741f , -0.380535f , 0.000000f , 
-0.831470f , -0.555570f , 0.000000f , 0.833338f , -0.552751f , 0.000000f , 
-0.923880f , 0.382683f , 0.000000f , 0.924741f , 0.380535f , 0.000000f , 
-0.906128f , 0.382683f , -0.180240f , 0.906980f , 0.380535f , -0.180395f , 
-0.831470f , 0.555570f , 0.000000f , 0.833338f , 0.552751f , 0.000000f , 
-0.815493f , -0.555570f , -0.162212f , 0.817316f , -0.552751f , -0.162572f , 
-0.831470f , -0.555570f , 0.000000f , 0.833338f , -0.552751f , 0.000000f , 
-0.707107f , -0.707107f , 0.000000f , 0.710135f , -0.704031f , 0.000000f , 
-0.906128f , 0.382683f , -0.180240f , 0.906980f , 0.380535f , -0.180395f , 
-0.923880f , 0.382683f , 0.000000f , 0.924741f , 0.380535f , 0.000000f , 
-0.980785f , 0.195090f , 0.000000f , 0.980987f , 0.193915f , 0.000000f , 
-0.191342f , 0.980785f , -0.038060f , 0.197089f , 0.979583f , -0.039186f , 
-0.195091f , 0.980785f , 0.000000f , 0.200964f , 0.979583f , 0.000000f , 
-0.382684f , 0.923880f , 0.000000f , 0.387860f , 0.921690f , 0.000000f , 
-0.693520f , -0.707107f , -0.137950f , 0.696493f , -0.704031f , -0.138524f , 
-0.707107f , -0.707107f , 0.000000f , 0.710135f , -0.704031f , 0.000000f , 
-0.555570f , -0.831470f , 0.000000f , 0.559771f , -0.828639f , 0.000000f , 
-0.961940f , 0.195090f , -0.191342f , 0.962157f , 0.193915f , -0.191382f , 
-0.980785f , 0.195090f , 0.000000f , 0.980987f , 0.193915f , 0.000000f , 
-1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 
-0.923880f , 0.382683f , 0.000000f , 0.924741f , 0.380535f , 0.000000f , 
-0.906128f , 0.382683f , 0.180240f , 0.906980f , 0.380535f , 0.180395f , 
-0.961940f , 0.195090f , 0.191342f , 0.962157f , 0.193915f , 0.191382f , 
-0.195091f , 0.980785f , 0.000000f , 0.200964f , 0.979583f , 0.000000f , 
-0.191342f , 0.980785f , 0.038060f , 0.197089f , 0.979583f , 0.039186f , 
-0.375331f , 0.923880f , 0.074658f , 0.380413f , 0.921690f , 0.075655f , 
-0.707107f , -0.707107f , 0.000000f , 0.710135f , -0.704031f , 0.000000f , 
-0.693520f , -0.707107f , 0.137950f , 0.696493f , -0.704031f , 0.138524f , 
-0.544895f , -0.831470f , 0.108386f , 0.548997f , -0.828639f , 0.109195f , 
-0.980785f , 0.195090f , 0.000000f , 0.980987f , 0.193915f , 0.000000f , 
-0.961940f , 0.195090f , 0.191342f , 0.962157f , 0.193915f , 0.191382f , 
-0.980785f , 0.000000f , 0.195090f , 0.980773f , 0.000000f , 0.195074f , 
-0.382684f , 0.923880f , 0.000000f , 0.387860f , 0.921690f , 0.000000f , 
-0.375331f , 0.923880f , 0.074658f , 0.380413f , 0.921690f , 0.075655f , 
-0.544895f , 0.831470f , 0.108386f , 0.548997f , 0.828639f , 0.109195f , 
-0.555570f , -0.831470f , 0.000000f , 0.559771f , -0.828639f , 0.000000f , 
-0.544895f , -0.831470f , 0.108386f , 0.548997f , -0.828639f , 0.109195f , 
-0.375331f , -0.923880f , 0.074658f , 0.380413f , -0.921690f , 0.075655f , 
-1.000000f , 0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 
-0.980785f , 0.000000f , 0.195090f , 0.980773f , 0.000000f , 0.195074f , 
-0.961940f , -0.195090f , 0.191342f , 0.962157f , -0.193915f , 0.191382f , 
-0.555570f , 0.831470f , 0.000000f , 0.559771f , 0.828639f , 0.000000f , 
-0.544895f , 0.831470f , 0.108386f , 0.548997f , 0.828639f , 0.109195f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.382684f , -0.923880f , 0.000000f , 0.387860f , -0.921690f , 0.000000f , 
-0.375331f , -0.923880f , 0.074658f , 0.380413f , -0.921690f , 0.075655f , 
-0.191342f , -0.980785f , 0.038060f , 0.197089f , -0.979583f , 0.039186f , 
-0.980785f , -0.195090f , 0.000000f , 0.980987f , -0.193915f , 0.000000f , 
-0.961940f , -0.195090f , 0.191342f , 0.962157f , -0.193915f , 0.191382f , 
-0.906128f , -0.382683f , 0.180240f , 0.906980f , -0.380535f , 0.180395f , 
-0.707107f , 0.707107f , 0.000000f , 0.710135f , 0.704031f , 0.000000f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.923880f , -0.382683f , 0.000000f , 0.924741f , -0.380535f , 0.000000f , 
-0.906128f , -0.382683f , 0.180240f , 0.906980f , -0.380535f , 0.180395f , 
-0.815493f , -0.555570f , 0.162212f , 0.817316f , -0.552751f , 0.162572f , 
-0.906128f , 0.382683f , 0.180240f , 0.906980f , 0.380535f , 0.180395f , 
-0.923880f , 0.382683f , 0.000000f , 0.924741f , 0.380535f , 0.000000f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.831470f , -0.555570f , 0.000000f , 0.833338f , -0.552751f , 0.000000f , 
-0.815493f , -0.555570f , 0.162212f , 0.817316f , -0.552751f , 0.162572f , 
-0.693520f , -0.707107f , 0.137950f , 0.696493f , -0.704031f , 0.138524f , 
-0.906128f , -0.382683f , 0.180240f , 0.906980f , -0.380535f , 0.180395f , 
-0.853553f , -0.382683f , 0.353553f , 0.854366f , -0.380535f , 0.353893f , 
-0.768178f , -0.555570f , 0.318190f , 0.769890f , -0.552751f , 0.318888f , 
-0.815493f , 0.555570f , 0.162212f , 0.817316f , 0.552751f , 0.162572f , 
-0.768178f , 0.555570f , 0.318190f , 0.769890f , 0.552751f , 0.318888f , 
-0.853554f , 0.382683f , 0.353553f , 0.854366f , 0.380535f , 0.353893f , 
-0.815493f , -0.555570f , 0.162212f , 0.817316f , -0.552751f , 0.162572f , 
-0.768178f , -0.555570f , 0.318190f , 0.769890f , -0.552751f , 0.318888f , 
-0.653282f , -0.707107f , 0.270598f , 0.656056f , -0.704031f , 0.271737f , 
-0.906128f , 0.382683f , 0.180240f , 0.906980f , 0.380535f , 0.180395f , 
-0.853554f , 0.382683f , 0.353553f , 0.854366f , 0.380535f , 0.353893f , 
-0.906127f , 0.195090f , 0.375330f , 0.906339f , 0.193915f , 0.375408f , 
-0.191342f , 0.980785f , 0.038060f , 0.197089f , 0.979583f , 0.039186f , 
-0.180240f , 0.980785f , 0.074658f , 0.185644f , 0.979583f , 0.076907f , 
-0.353554f , 0.923880f , 0.146447f , 0.358348f , 0.921690f , 0.148412f , 
-0.693520f , -0.707107f , 0.137950f , 0.696493f , -0.704031f , 0.138524f , 
-0.653282f , -0.707107f , 0.270598f , 0.656056f , -0.704031f , 0.271737f , 
-0.513280f , -0.831470f , 0.212608f , 0.517136f , -0.828639f , 0.214209f , 
-0.961940f , 0.195090f , 0.191342f , 0.962157f , 0.193915f , 0.191382f , 
-0.906127f , 0.195090f , 0.375330f , 0.906339f , 0.193915f , 0.375408f , 
-0.923880f , 0.000000f , 0.382684f , 0.923856f , 0.000000f , 0.382672f , 
-0.375331f , 0.923880f , 0.074658f , 0.380413f , 0.921690f , 0.075655f , 
-0.353554f , 0.923880f , 0.146447f , 0.358348f , 0.921690f , 0.148412f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.544895f , -0.831470f , 0.108386f , 0.548997f , -0.828639f , 0.109195f , 
-0.513280f , -0.831470f , 0.212608f , 0.517136f , -0.828639f , 0.214209f , 
-0.353554f , -0.923880f , 0.146447f , 0.358348f , -0.921690f , 0.148412f , 
-0.980785f , 0.000000f , 0.195090f , 0.980773f , 0.000000f , 0.195074f , 
-0.923880f , 0.000000f , 0.382684f , 0.923856f , 0.000000f , 0.382672f , 
-0.906128f , -0.195090f , 0.375330f , 0.906339f , -0.193915f , 0.375408f , 
-0.653282f , 0.707107f , 0.270598f , 0.656056f , 0.704031f , 0.271737f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.375331f , -0.923880f , 0.074658f , 0.380413f , -0.921690f , 0.075655f , 
-0.353554f , -0.923880f , 0.146447f , 0.358348f , -0.921690f , 0.148412f , 
-0.180240f , -0.980785f , 0.074658f , 0.185644f , -0.979583f , 0.076876f , 
-0.961940f , -0.195090f , 0.191342f , 0.962157f , -0.193915f , 0.191382f , 
-0.906128f , -0.195090f , 0.375330f , 0.906339f , -0.193915f , 0.375408f , 
-0.853553f , -0.382683f , 0.353553f , 0.854366f , -0.380535f , 0.353893f , 
-0.693520f , 0.707107f , 0.137950f , 0.696493f , 0.704031f , 0.138524f , 
-0.653282f , 0.707107f , 0.270598f , 0.656056f , 0.704031f , 0.271737f , 
-0.768178f , 0.555570f , 0.318190f , 0.769890f , 0.552751f , 0.318888f , 
-0.353554f , -0.923880f , 0.146447f , 0.358348f , -0.921690f , 0.148412f , 
-0.318190f , -0.923880f , 0.212608f , 0.322489f , -0.921690f , 0.215491f , 
-0.162212f , -0.980785f , 0.108386f , 0.167089f , -0.979583f , 0.111637f , 
-0.906128f , -0.195090f , 0.375330f , 0.906339f , -0.193915f , 0.375408f , 
-0.815493f , -0.195090f , 0.544895f , 0.815668f , -0.193915f , 0.545000f , 
-0.768178f , -0.382683f , 0.513280f , 0.768914f , -0.380535f , 0.513749f , 
-0.653282f , 0.707107f , 0.270598f , 0.656056f , 0.704031f , 0.271737f , 
-0.587938f , 0.707107f , 0.392847f , 0.590442f , 0.704031f , 0.394513f , 
-0.691342f , 0.555570f , 0.461940f , 0.692892f , 0.552751f , 0.462966f , 
-0.853553f , -0.382683f , 0.353553f , 0.854366f , -0.380535f , 0.353893f , 
-0.768178f , -0.382683f , 0.513280f , 0.768914f , -0.380535f , 0.513749f , 
-0.691342f , -0.555570f , 0.461940f , 0.692892f , -0.552751f , 0.462966f , 
-0.768178f , 0.555570f , 0.318190f , 0.769890f , 0.552751f , 0.318888f , 
-0.691342f , 0.555570f , 0.461940f , 0.692892f , 0.552751f , 0.462966f , 
-0.768178f , 0.382683f , 0.513280f , 0.768914f , 0.380535f , 0.513749f , 
-0.768178f , -0.555570f , 0.318190f , 0.769890f , -0.552751f , 0.318888f , 
-0.691342f , -0.555570f , 0.461940f , 0.692892f , -0.552751f , 0.462966f , 
-0.587938f , -0.707107f , 0.392847f , 0.590442f , -0.704031f , 0.394513f , 
-0.853554f , 0.382683f , 0.353553f , 0.854366f , 0.380535f , 0.353893f , 
-0.768178f , 0.382683f , 0.513280f , 0.768914f , 0.380535f , 0.513749f , 
-0.815493f , 0.195090f , 0.544895f , 0.815668f , 0.193915f , 0.545000f , 
-0.180240f , 0.980785f , 0.074658f , 0.185644f , 0.979583f , 0.076907f , 
-0.162212f , 0.980785f , 0.108387f , 0.167089f , 0.979583f , 0.111637f , 
-0.318190f , 0.923880f , 0.212608f , 0.322489f , 0.921690f , 0.215491f , 
-0.653282f , -0.707107f , 0.270598f , 0.656056f , -0.704031f , 0.271737f , 
-0.587938f , -0.707107f , 0.392847f , 0.590442f , -0.704031f , 0.394513f , 
-0.461940f , -0.831470f , 0.308658f , 0.465407f , -0.828639f , 0.310984f , 
-0.906127f , 0.195090f , 0.375330f , 0.906339f , 0.193915f , 0.375408f , 
-0.815493f , 0.195090f , 0.544895f , 0.815668f , 0.193915f , 0.545000f , 
-0.831470f , 0.000000f , 0.555570f , 0.831446f , 0.000000f , 0.555559f , 
-0.353554f , 0.923880f , 0.146447f , 0.358348f , 0.921690f , 0.148412f , 
-0.318190f , 0.923880f , 0.212608f , 0.322489f , 0.921690f , 0.215491f , 
-0.461940f , 0.831470f , 0.308658f , 0.465407f , 0.828639f , 0.310984f , 
-0.513280f , -0.831470f , 0.212608f , 0.517136f , -0.828639f , 0.214209f , 
-0.461940f , -0.831470f , 0.308658f , 0.465407f , -0.828639f , 0.310984f , 
-0.318190f , -0.923880f , 0.212608f , 0.322489f , -0.921690f , 0.215491f , 
-0.923880f , 0.000000f , 0.382684f , 0.923856f , 0.000000f , 0.382672f , 
-0.831470f , 0.000000f , 0.555570f , 0.831446f , 0.000000f , 0.555559f , 
-0.815493f , -0.195090f , 0.544895f , 0.815668f , -0.193915f , 0.545000f , 
-0.513280f , 0.831470f , 0.212608f , 0.517136f , 0.828639f , 0.214209f , 
-0.461940f , 0.831470f , 0.308658f , 0.465407f , 0.828639f , 0.310984f , 
-0.587938f , 0.707107f , 0.392847f , 0.590442f , 0.704031f , 0.394513f , 
-0.461940f , -0.831470f , 0.308658f , 0.465407f , -0.828639f , 0.310984f , 
-0.392848f , -0.831470f , 0.392847f , 0.395795f , -0.828639f , 0.395795f , 
-0.270598f , -0.923880f , 0.270598f , 0.274270f , -0.921690f , 0.274270f , 
-0.831470f , 0.000000f , 0.555570f , 0.831446f , 0.000000f , 0.555559f , 
-0.707107f , 0.000000f , 0.707107f , 0.707083f , 0.000000f , 0.707083f , 
-0.693520f , -0.195090f , 0.693520f , 0.693655f , -0.193915f , 0.693655f , 
-0.461940f , 0.831470f , 0.308658f , 0.465407f , 0.828639f , 0.310984f , 
-0.392848f , 0.831470f , 0.392847f , 0.395795f , 0.828639f , 0.395795f , 
-0.500000f , 0.707107f , 0.500000f , 0.502121f , 0.704031f , 0.502121f , 
-0.318190f , -0.923880f , 0.212608f , 0.322489f , -0.921690f , 0.215491f , 
-0.270598f , -0.923880f , 0.270598f , 0.274270f , -0.921690f , 0.274270f , 
-0.137950f , -0.980785f , 0.137950f , 0.142094f , -0.979583f , 0.142094f , 
-0.815493f , -0.195090f , 0.544895f , 0.815668f , -0.193915f , 0.545000f , 
-0.693520f , -0.195090f , 0.693520f , 0.693655f , -0.193915f , 0.693655f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.587938f , 0.707107f , 0.392847f , 0.590442f , 0.704031f , 0.394513f , 
-0.500000f , 0.707107f , 0.500000f , 0.502121f , 0.704031f , 0.502121f , 
-0.587938f , 0.555570f , 0.587938f , 0.589251f , 0.552751f , 0.589251f , 
-0.768178f , -0.382683f , 0.513280f , 0.768914f , -0.380535f , 0.513749f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.587938f , -0.555570f , 0.587938f , 0.589251f , -0.552751f , 0.589251f , 
-0.691342f , 0.555570f , 0.461940f , 0.692892f , 0.552751f , 0.462966f , 
-0.587938f , 0.555570f , 0.587938f , 0.589251f , 0.552751f , 0.589251f , 
-0.653282f , 0.382683f , 0.653281f , 0.653890f , 0.380535f , 0.653890f , 
-0.691342f , -0.555570f , 0.461940f , 0.692892f , -0.552751f , 0.462966f , 
-0.587938f , -0.555570f , 0.587938f , 0.589251f , -0.552751f , 0.589251f , 
-0.500000f , -0.707107f , 0.500000f , 0.502121f , -0.704031f , 0.502121f , 
-0.768178f , 0.382683f , 0.513280f , 0.768914f , 0.380535f , 0.513749f , 
-0.653282f , 0.382683f , 0.653281f , 0.653890f , 0.380535f , 0.653890f , 
-0.693520f , 0.195090f , 0.693520f , 0.693655f , 0.193915f , 0.693655f , 
-0.162212f , 0.980785f , 0.108387f , 0.167089f , 0.979583f , 0.111637f , 
-0.137950f , 0.980785f , 0.137950f , 0.142094f , 0.979583f , 0.142094f , 
-0.270598f , 0.923880f , 0.270598f , 0.274270f , 0.921690f , 0.274270f , 
-0.587938f , -0.707107f , 0.392847f , 0.590442f , -0.704031f , 0.394513f , 
-0.500000f , -0.707107f , 0.500000f , 0.502121f , -0.704031f , 0.502121f , 
-0.392848f , -0.831470f , 0.392847f , 0.395795f , -0.828639f , 0.395795f , 
-0.815493f , 0.195090f , 0.544895f , 0.815668f , 0.193915f , 0.545000f , 
-0.693520f , 0.195090f , 0.693520f , 0.693655f , 0.193915f , 0.693655f , 
-0.707107f , 0.000000f , 0.707107f , 0.707083f , 0.000000f , 0.707083f , 
-0.318190f , 0.923880f , 0.212608f , 0.322489f , 0.921690f , 0.215491f , 
-0.270598f , 0.923880f , 0.270598f , 0.274270f , 0.921690f , 0.274270f , 
-0.392848f , 0.831470f , 0.392847f , 0.395795f , 0.828639f , 0.395795f , 
-0.137950f , 0.980785f , 0.137950f , 0.142094f , 0.979583f , 0.142094f , 
-0.108387f , 0.980785f , 0.162212f , 0.111637f , 0.979583f , 0.167089f , 
-0.212608f , 0.923880f , 0.318190f , 0.215491f , 0.921690f , 0.322489f , 
-0.500000f , -0.707107f , 0.500000f , 0.502121f , -0.704031f , 0.502121f , 
-0.392848f , -0.707107f , 0.587938f , 0.394513f , -0.704031f , 0.590442f , 
-0.308658f , -0.831470f , 0.461940f , 0.310984f , -0.828639f , 0.465407f , 
-0.693520f , 0.195090f , 0.693520f , 0.693655f , 0.193915f , 0.693655f , 
-0.544895f , 0.195090f , 0.815493f , 0.545000f , 0.193915f , 0.815668f , 
-0.555570f , 0.000000f , 0.831470f , 0.555559f , 0.000000f , 0.831446f , 
-0.270598f , 0.923880f , 0.270598f , 0.274270f , 0.921690f , 0.274270f , 
-0.212608f , 0.923880f , 0.318190f , 0.215491f , 0.921690f , 0.322489f , 
-0.308658f , 0.831470f , 0.461940f , 0.310984f , 0.828639f , 0.465407f , 
-0.392848f , -0.831470f , 0.392847f , 0.395795f , -0.828639f , 0.395795f , 
-0.308658f , -0.831470f , 0.461940f , 0.310984f , -0.828639f , 0.465407f , 
-0.212608f , -0.923880f , 0.318190f , 0.215491f , -0.921690f , 0.322489f , 
-0.707107f , 0.000000f , 0.707107f , 0.707083f , 0.000000f , 0.707083f , 
-0.555570f , 0.000000f , 0.831470f , 0.555559f , 0.000000f , 0.831446f , 
-0.544895f , -0.195090f , 0.815493f , 0.545000f , -0.193915f , 0.815668f , 
-0.392848f , 0.831470f , 0.392847f , 0.395795f , 0.828639f , 0.395795f , 
-0.308658f , 0.831470f , 0.461940f , 0.310984f , 0.828639f , 0.465407f , 
-0.392848f , 0.707107f , 0.587938f , 0.394513f , 0.704031f , 0.590442f , 
-0.270598f , -0.923880f , 0.270598f , 0.274270f , -0.921690f , 0.274270f , 
-0.212608f , -0.923880f , 0.318190f , 0.215491f , -0.921690f , 0.322489f , 
-0.108387f , -0.980785f , 0.162212f , 0.111637f , -0.979583f , 0.167089f , 
-0.513280f , -0.382683f , 0.768178f , 0.513749f , -0.380535f , 0.768914f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.544895f , -0.195090f , 0.815493f , 0.545000f , -0.193915f , 0.815668f , 
-0.500000f , 0.707107f , 0.500000f , 0.502121f , 0.704031f , 0.502121f , 
-0.392848f , 0.707107f , 0.587938f , 0.394513f , 0.704031f , 0.590442f , 
-0.461940f , 0.555570f , 0.691342f , 0.462966f , 0.552751f , 0.692892f , 
-0.653282f , -0.382683f , 0.653281f , 0.653890f , -0.380535f , 0.653890f , 
-0.513280f , -0.382683f , 0.768178f , 0.513749f , -0.380535f , 0.768914f , 
-0.461940f , -0.555570f , 0.691342f , 0.462966f , -0.552751f , 0.692892f , 
-0.587938f , 0.555570f , 0.587938f , 0.589251f , 0.552751f , 0.589251f , 
-0.461940f , 0.555570f , 0.691342f , 0.462966f , 0.552751f , 0.692892f , 
-0.513280f , 0.382683f , 0.768178f , 0.513749f , 0.380535f , 0.768914f , 
-0.587938f , -0.555570f , 0.587938f , 0.589251f , -0.552751f , 0.589251f , 
-0.461940f , -0.555570f , 0.691342f , 0.462966f , -0.552751f , 0.692892f , 
-0.392848f , -0.707107f , 0.587938f , 0.394513f , -0.704031f , 0.590442f , 
-0.653282f , 0.382683f , 0.653281f , 0.653890f , 0.380535f , 0.653890f , 
-0.513280f , 0.382683f , 0.768178f , 0.513749f , 0.380535f , 0.768914f , 
-0.544895f , 0.195090f , 0.815493f , 0.545000f , 0.193915f , 0.815668f , 
-0.461940f , 0.555570f , 0.691342f , 0.462966f , 0.552751f , 0.692892f , 
-0.318190f , 0.555570f , 0.768178f , 0.318888f , 0.552751f , 0.769890f , 
-0.353553f , 0.382683f , 0.853553f , 0.353862f , 0.380535f , 0.854366f , 
-0.461940f , -0.555570f , 0.691342f , 0.462966f , -0.552751f , 0.692892f , 
-0.318190f , -0.555570f , 0.768178f , 0.318888f , -0.552751f , 0.769890f , 
-0.270598f , -0.707107f , 0.653281f , 0.271737f , -0.704031f , 0.656056f , 
-0.513280f , 0.382683f , 0.768178f , 0.513749f , 0.380535f , 0.768914f , 
-0.353553f , 0.382683f , 0.853553f , 0.353862f , 0.380535f , 0.854366f , 
-0.375330f , 0.195090f , 0.906127f , 0.375408f , 0.193915f , 0.906339f , 
-0.108387f , 0.980785f , 0.162212f , 0.111637f , 0.979583f , 0.167089f , 
-0.074658f , 0.980785f , 0.180240f , 0.076907f , 0.979583f , 0.185644f , 
-0.146447f , 0.923880f , 0.353554f , 0.148412f , 0.921690f , 0.358348f , 
-0.392848f , -0.707107f , 0.587938f , 0.394513f , -0.704031f , 0.590442f , 
-0.270598f , -0.707107f , 0.653281f , 0.271737f , -0.704031f , 0.656056f , 
-0.212608f , -0.831470f , 0.513280f , 0.214209f , -0.828639f , 0.517136f , 
-0.544895f , 0.195090f , 0.815493f , 0.545000f , 0.193915f , 0.815668f , 
-0.375330f , 0.195090f , 0.906127f , 0.375408f , 0.193915f , 0.906339f , 
-0.382683f , 0.000000f , 0.923879f , 0.382672f , 0.000000f , 0.923856f , 
-0.212608f , 0.923880f , 0.318190f , 0.215491f , 0.921690f , 0.322489f , 
-0.146447f , 0.923880f , 0.353554f , 0.148412f , 0.921690f , 0.358348f , 
-0.212608f , 0.831470f , 0.513280f , 0.214209f , 0.828639f , 0.517136f , 
-0.308658f , -0.831470f , 0.461940f , 0.310984f , -0.828639f , 0.465407f , 
-0.212608f , -0.831470f , 0.513280f , 0.214209f , -0.828639f , 0.517136f , 
-0.146447f , -0.923880f , 0.353553f , 0.148412f , -0.921690f , 0.358348f , 
-0.555570f , 0.000000f , 0.831470f , 0.555559f , 0.000000f , 0.831446f , 
-0.382683f , 0.000000f , 0.923879f , 0.382672f , 0.000000f , 0.923856f , 
-0.375330f , -0.195090f , 0.906127f , 0.375408f , -0.193915f , 0.906339f , 
-0.308658f , 0.831470f , 0.461940f , 0.310984f , 0.828639f , 0.465407f , 
-0.212608f , 0.831470f , 0.513280f , 0.214209f , 0.828639f , 0.517136f , 
-0.270598f , 0.707107f , 0.653281f , 0.271737f , 0.704031f , 0.656056f , 
-0.212608f , -0.923880f , 0.318190f , 0.215491f , -0.921690f , 0.322489f , 
-0.146447f , -0.923880f , 0.353553f , 0.148412f , -0.921690f , 0.358348f , 
-0.074658f , -0.980785f , 0.180240f , 0.076907f , -0.979583f , 0.185644f , 
-0.353554f , -0.382683f , 0.853553f , 0.353862f , -0.380535f , 0.854366f , 
-0.513280f , -0.382683f , 0.768178f , 0.513749f , -0.380535f , 0.768914f , 
-0.375330f , -0.195090f , 0.906127f , 0.375408f , -0.193915f , 0.906339f , 
-0.392848f , 0.707107f , 0.587938f , 0.394513f , 0.704031f , 0.590442f , 
-0.270598f , 0.707107f , 0.653281f , 0.271737f , 0.704031f , 0.656056f , 
-0.318190f , 0.555570f , 0.768178f , 0.318888f , 0.552751f , 0.769890f , 
-0.513280f , -0.382683f , 0.768178f , 0.513749f , -0.380535f , 0.768914f , 
-0.353554f , -0.382683f , 0.853553f , 0.353862f , -0.380535f , 0.854366f , 
-0.318190f , -0.555570f , 0.768178f , 0.318888f , -0.552751f , 0.769890f , 
-0.180240f , -0.382683f , 0.906127f , 0.180395f , -0.380535f , 0.906980f , 
-0.353554f , -0.382683f , 0.853553f , 0.353862f , -0.380535f , 0.854366f , 
-0.191342f , -0.195090f , 0.961939f , 0.191382f , -0.193915f , 0.962157f , 
-0.270598f , 0.707107f , 0.653281f , 0.271737f , 0.704031f , 0.656056f , 
-0.137950f , 0.707107f , 0.693520f , 0.138524f , 0.704031f , 0.696493f , 
-0.162212f , 0.555570f , 0.815493f , 0.162572f , 0.552751f , 0.817316f , 
-0.353554f , -0.382683f , 0.853553f , 0.353862f , -0.380535f , 0.854366f , 
-0.180240f , -0.382683f , 0.906127f , 0.180395f , -0.380535f , 0.906980f , 
-0.162212f , -0.555570f , 0.815493f , 0.162572f , -0.552751f , 0.817316f , 
-0.318190f , 0.555570f , 0.768178f , 0.318888f , 0.552751f , 0.769890f , 
-0.162212f , 0.555570f , 0.815493f , 0.162572f , 0.552751f , 0.817316f , 
-0.180240f , 0.382683f , 0.906127f , 0.180395f , 0.380535f , 0.906980f , 
-0.318190f , -0.555570f , 0.768178f , 0.318888f , -0.552751f , 0.769890f , 
-0.162212f , -0.555570f , 0.815493f , 0.162572f , -0.552751f , 0.817316f , 
-0.137950f , -0.707107f , 0.693520f , 0.138524f , -0.704031f , 0.696493f , 
-0.353553f , 0.382683f , 0.853553f , 0.353862f , 0.380535f , 0.854366f , 
-0.180240f , 0.382683f , 0.906127f , 0.180395f , 0.380535f , 0.906980f , 
-0.191342f , 0.195090f , 0.961939f , 0.191382f , 0.193915f , 0.962157f , 
-0.074658f , 0.980785f , 0.180240f , 0.076907f , 0.979583f , 0.185644f , 
-0.038061f , 0.980785f , 0.191342f , 0.039186f , 0.979583f , 0.197089f , 
-0.074658f , 0.923880f , 0.375330f , 0.075655f , 0.921690f , 0.380413f , 
-0.270598f , -0.707107f , 0.653281f , 0.271737f , -0.704031f , 0.656056f , 
-0.137950f , -0.707107f , 0.693520f , 0.138524f , -0.704031f , 0.696493f , 
-0.108387f , -0.831470f , 0.544895f , 0.109195f , -0.828639f , 0.548997f , 
-0.375330f , 0.195090f , 0.906127f , 0.375408f , 0.193915f , 0.906339f , 
-0.191342f , 0.195090f , 0.961939f , 0.191382f , 0.193915f , 0.962157f , 
-0.195090f , 0.000000f , 0.980785f , 0.195074f , 0.000000f , 0.980773f , 
-0.146447f , 0.923880f , 0.353554f , 0.148412f , 0.921690f , 0.358348f , 
-0.074658f , 0.923880f , 0.375330f , 0.075655f , 0.921690f , 0.380413f , 
-0.108387f , 0.831470f , 0.544895f , 0.109195f , 0.828639f , 0.548997f , 
-0.212608f , -0.831470f , 0.513280f , 0.214209f , -0.828639f , 0.517136f , 
-0.108387f , -0.831470f , 0.544895f , 0.109195f , -0.828639f , 0.548997f , 
-0.074658f , -0.923880f , 0.375330f , 0.075655f , -0.921690f , 0.380413f , 
-0.382683f , 0.000000f , 0.923879f , 0.382672f , 0.000000f , 0.923856f , 
-0.195090f , 0.000000f , 0.980785f , 0.195074f , 0.000000f , 0.980773f , 
-0.191342f , -0.195090f , 0.961939f , 0.191382f , -0.193915f , 0.962157f , 
-0.212608f , 0.831470f , 0.513280f , 0.214209f , 0.828639f , 0.517136f , 
-0.108387f , 0.831470f , 0.544895f , 0.109195f , 0.828639f , 0.548997f , 
-0.137950f , 0.707107f , 0.693520f , 0.138524f , 0.704031f , 0.696493f , 
-0.146447f , -0.923880f , 0.353553f , 0.148412f , -0.921690f , 0.358348f , 
-0.074658f , -0.923880f , 0.375330f , 0.075655f , -0.921690f , 0.380413f , 
-0.038061f , -0.980785f , 0.191342f , 0.039186f , -0.979583f , 0.197089f , 
-0.108387f , -0.831470f , 0.544895f , 0.109195f , -0.828639f , 0.548997f , 
-0.000000f , -0.831470f , 0.555570f , 0.000000f , -0.828639f , 0.559771f , 
-0.000000f , -0.923880f , 0.382683f , 0.000000f , -0.921690f , 0.387860f , 
-0.195090f , 0.000000f , 0.980785f , 0.195074f , 0.000000f , 0.980773f , 
-0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 0.999969f , 
-0.000000f , -0.195090f , 0.980785f , 0.000000f , -0.193915f , 0.980987f , 
-0.108387f , 0.831470f , 0.544895f , 0.109195f , 0.828639f , 0.548997f , 
-0.000000f , 0.831470f , 0.555570f , 0.000000f , 0.828639f , 0.559771f , 
-0.000000f , 0.707107f , 0.707107f , 0.000000f , 0.704031f , 0.710135f , 
-0.074658f , -0.923880f , 0.375330f , 0.075655f , -0.921690f , 0.380413f , 
-0.000000f , -0.923880f , 0.382683f , 0.000000f , -0.921690f , 0.387860f , 
-0.000000f , -0.980785f , 0.195090f , 0.000000f , -0.979583f , 0.200964f , 
-0.000000f , -0.382683f , 0.923879f , 0.000000f , -0.380535f , 0.924741f , 
-0.180240f , -0.382683f , 0.906127f , 0.180395f , -0.380535f , 0.906980f , 
-0.000000f , -0.195090f , 0.980785f , 0.000000f , -0.193915f , 0.980987f , 
-0.137950f , 0.707107f , 0.693520f , 0.138524f , 0.704031f , 0.696493f , 
-0.000000f , 0.707107f , 0.707107f , 0.000000f , 0.704031f , 0.710135f , 
-0.000000f , 0.555570f , 0.831469f , 0.000000f , 0.552751f , 0.833338f , 
-0.180240f , -0.382683f , 0.906127f , 0.180395f , -0.380535f , 0.906980f , 
-0.000000f , -0.382683f , 0.923879f , 0.000000f , -0.380535f , 0.924741f , 
-0.000000f , -0.555570f , 0.831469f , 0.000000f , -0.552751f , 0.833338f , 
-0.162212f , 0.555570f , 0.815493f , 0.162572f , 0.552751f , 0.817316f , 
-0.000000f , 0.555570f , 0.831469f , 0.000000f , 0.552751f , 0.833338f , 
-0.000000f , 0.382683f , 0.923879f , 0.000000f , 0.380535f , 0.924741f , 
-0.162212f , -0.555570f , 0.815493f , 0.162572f , -0.552751f , 0.817316f , 
-0.000000f , -0.555570f , 0.831469f , 0.000000f , -0.552751f , 0.833338f , 
-0.000000f , -0.707107f , 0.707107f , 0.000000f , -0.704031f , 0.710135f , 
-0.180240f , 0.382683f , 0.906127f , 0.180395f , 0.380535f , 0.906980f , 
-0.000000f , 0.382683f , 0.923879f , 0.000000f , 0.380535f , 0.924741f , 
-0.000000f , 0.195090f , 0.980785f , 0.000000f , 0.193915f , 0.980987f , 
-0.038061f , 0.980785f , 0.191342f , 0.039186f , 0.979583f , 0.197089f , 
-0.000000f , 0.980785f , 0.195091f , 0.000000f , 0.979583f , 0.200964f , 
-0.000000f , 0.923880f , 0.382683f , 0.000000f , 0.921690f , 0.387860f , 
-0.137950f , -0.707107f , 0.693520f , 0.138524f , -0.704031f , 0.696493f , 
-0.000000f , -0.707107f , 0.707107f , 0.000000f , -0.704031f , 0.710135f , 
-0.000000f , -0.831470f , 0.555570f , 0.000000f , -0.828639f , 0.559771f , 
-0.191342f , 0.195090f , 0.961939f , 0.191382f , 0.193915f , 0.962157f , 
-0.000000f , 0.195090f , 0.980785f , 0.000000f , 0.193915f , 0.980987f , 
-0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 0.999969f , 
-0.074658f , 0.923880f , 0.375330f , 0.075655f , 0.921690f , 0.380413f , 
-0.000000f , 0.923880f , 0.382683f , 0.000000f , 0.921690f , 0.387860f , 
-0.000000f , 0.831470f , 0.555570f , 0.000000f , 0.828639f , 0.559771f , 
-0.000000f , 0.980785f , 0.195091f , 0.000000f , 0.979583f , 0.200964f , 
--0.038060f , 0.980785f , 0.191342f , -0.039186f , 0.979583f , 0.197089f , 
--0.074658f , 0.923880f , 0.375330f , -0.075655f , 0.921690f , 0.380413f , 
-0.000000f , -0.707107f , 0.707107f , 0.000000f , -0.704031f , 0.710135f , 
--0.137949f , -0.707107f , 0.693520f , -0.138524f , -0.704031f , 0.696493f , 
--0.108386f , -0.831470f , 0.544895f , -0.109195f , -0.828639f , 0.548997f , 
-0.000000f , 0.195090f , 0.980785f , 0.000000f , 0.193915f , 0.980987f , 
--0.191341f , 0.195090f , 0.961939f , -0.191382f , 0.193915f , 0.962157f , 
--0.195090f , 0.000000f , 0.980785f , -0.195074f , 0.000000f , 0.980773f , 
-0.000000f , 0.923880f , 0.382683f , 0.000000f , 0.921690f , 0.387860f , 
--0.074658f , 0.923880f , 0.375330f , -0.075655f , 0.921690f , 0.380413f , 
--0.108386f , 0.831470f , 0.544895f , -0.109195f , 0.828639f , 0.548997f , 
-0.000000f , -0.831470f , 0.555570f , 0.000000f , -0.828639f , 0.559771f , 
--0.108386f , -0.831470f , 0.544895f , -0.109195f , -0.828639f , 0.548997f , 
--0.074658f , -0.923880f , 0.375330f , -0.075655f , -0.921690f , 0.380413f , 
-0.000000f , 0.000000f , 1.000000f , 0.000000f , 0.000000f , 0.999969f , 
--0.195090f , 0.000000f , 0.980785f , -0.195074f , 0.000000f , 0.980773f , 
--0.191342f , -0.195090f , 0.961939f , -0.191382f , -0.193915f , 0.962157f , 
-0.000000f , 0.831470f , 0.555570f , 0.000000f , 0.828639f , 0.559771f , 
--0.108386f , 0.831470f , 0.544895f , -0.109195f , 0.828639f , 0.548997f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
-0.000000f , -0.923880f , 0.382683f , 0.000000f , -0.921690f , 0.387860f , 
--0.074658f , -0.923880f , 0.375330f , -0.075655f , -0.921690f , 0.380413f , 
--0.038060f , -0.980785f , 0.191342f , -0.039186f , -0.979583f , 0.197089f , 
--0.180240f , -0.382683f , 0.906127f , -0.180395f , -0.380535f , 0.906980f , 
-0.000000f , -0.382683f , 0.923879f , 0.000000f , -0.380535f , 0.924741f , 
--0.191342f , -0.195090f , 0.961939f , -0.191382f , -0.193915f , 0.962157f , 
-0.000000f , 0.707107f , 0.707107f , 0.000000f , 0.704031f , 0.710135f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
--0.162211f , 0.555570f , 0.815493f , -0.162572f , 0.552751f , 0.817316f , 
-0.000000f , -0.382683f , 0.923879f , 0.000000f , -0.380535f , 0.924741f , 
--0.180240f , -0.382683f , 0.906127f , -0.180395f , -0.380535f , 0.906980f , 
--0.162211f , -0.555570f , 0.815493f , -0.162572f , -0.552751f , 0.817316f , 
-0.000000f , 0.555570f , 0.831469f , 0.000000f , 0.552751f , 0.833338f , 
--0.162211f , 0.555570f , 0.815493f , -0.162572f , 0.552751f , 0.817316f , 
--0.180240f , 0.382683f , 0.906127f , -0.180395f , 0.380535f , 0.906980f , 
-0.000000f , -0.555570f , 0.831469f , 0.000000f , -0.552751f , 0.833338f , 
--0.162211f , -0.555570f , 0.815493f , -0.162572f , -0.552751f , 0.817316f , 
--0.137949f , -0.707107f , 0.693520f , -0.138524f , -0.704031f , 0.696493f , 
-0.000000f , 0.382683f , 0.923879f , 0.000000f , 0.380535f , 0.924741f , 
--0.180240f , 0.382683f , 0.906127f , -0.180395f , 0.380535f , 0.906980f , 
--0.191341f , 0.195090f , 0.961939f , -0.191382f , 0.193915f , 0.962157f , 
--0.162211f , 0.555570f , 0.815493f , -0.162572f , 0.552751f , 0.817316f , 
--0.318189f , 0.555570f , 0.768177f , -0.318888f , 0.552751f , 0.769890f , 
--0.353553f , 0.382683f , 0.853553f , -0.353893f , 0.380535f , 0.854366f , 
--0.162211f , -0.555570f , 0.815493f , -0.162572f , -0.552751f , 0.817316f , 
--0.318189f , -0.555570f , 0.768177f , -0.318888f , -0.552751f , 0.769890f , 
--0.270598f , -0.707107f , 0.653281f , -0.271737f , -0.704031f , 0.656056f , 
--0.180240f , 0.382683f , 0.906127f , -0.180395f , 0.380535f , 0.906980f , 
--0.353553f , 0.382683f , 0.853553f , -0.353893f , 0.380535f , 0.854366f , 
--0.375330f , 0.195090f , 0.906127f , -0.375408f , 0.193915f , 0.906339f , 
--0.038060f , 0.980785f , 0.191342f , -0.039186f , 0.979583f , 0.197089f , 
--0.074658f , 0.980785f , 0.180240f , -0.076907f , 0.979583f , 0.185644f , 
--0.146446f , 0.923880f , 0.353553f , -0.148412f , 0.921690f , 0.358348f , 
--0.137949f , -0.707107f , 0.693520f , -0.138524f , -0.704031f , 0.696493f , 
--0.270598f , -0.707107f , 0.653281f , -0.271737f , -0.704031f , 0.656056f , 
--0.212607f , -0.831470f , 0.513280f , -0.214209f , -0.828639f , 0.517136f , 
--0.191341f , 0.195090f , 0.961939f , -0.191382f , 0.193915f , 0.962157f , 
--0.375330f , 0.195090f , 0.906127f , -0.375408f , 0.193915f , 0.906339f , 
--0.382683f , 0.000000f , 0.923879f , -0.382672f , 0.000000f , 0.923856f , 
--0.074658f , 0.923880f , 0.375330f , -0.075655f , 0.921690f , 0.380413f , 
--0.146446f , 0.923880f , 0.353553f , -0.148412f , 0.921690f , 0.358348f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.108386f , -0.831470f , 0.544895f , -0.109195f , -0.828639f , 0.548997f , 
--0.212607f , -0.831470f , 0.513280f , -0.214209f , -0.828639f , 0.517136f , 
--0.146446f , -0.923880f , 0.353553f , -0.148412f , -0.921690f , 0.358348f , 
--0.195090f , 0.000000f , 0.980785f , -0.195074f , 0.000000f , 0.980773f , 
--0.382683f , 0.000000f , 0.923879f , -0.382672f , 0.000000f , 0.923856f , 
--0.375330f , -0.195090f , 0.906127f , -0.375408f , -0.193915f , 0.906339f , 
--0.270598f , 0.707107f , 0.653281f , -0.271737f , 0.704031f , 0.656056f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.074658f , -0.923880f , 0.375330f , -0.075655f , -0.921690f , 0.380413f , 
--0.146446f , -0.923880f , 0.353553f , -0.148412f , -0.921690f , 0.358348f , 
--0.074658f , -0.980785f , 0.180240f , -0.076907f , -0.979583f , 0.185644f , 
--0.353553f , -0.382683f , 0.853553f , -0.353862f , -0.380535f , 0.854366f , 
--0.180240f , -0.382683f , 0.906127f , -0.180395f , -0.380535f , 0.906980f , 
--0.375330f , -0.195090f , 0.906127f , -0.375408f , -0.193915f , 0.906339f , 
--0.137949f , 0.707107f , 0.693520f , -0.138524f , 0.704031f , 0.696493f , 
--0.270598f , 0.707107f , 0.653281f , -0.271737f , 0.704031f , 0.656056f , 
--0.318189f , 0.555570f , 0.768177f , -0.318888f , 0.552751f , 0.769890f , 
--0.180240f , -0.382683f , 0.906127f , -0.180395f , -0.380535f , 0.906980f , 
--0.353553f , -0.382683f , 0.853553f , -0.353862f , -0.380535f , 0.854366f , 
--0.318189f , -0.555570f , 0.768177f , -0.318888f , -0.552751f , 0.769890f , 
--0.513279f , -0.382683f , 0.768177f , -0.513749f , -0.380535f , 0.768914f , 
--0.353553f , -0.382683f , 0.853553f , -0.353862f , -0.380535f , 0.854366f , 
--0.544895f , -0.195090f , 0.815493f , -0.545000f , -0.193915f , 0.815668f , 
--0.270598f , 0.707107f , 0.653281f , -0.271737f , 0.704031f , 0.656056f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.461939f , 0.555570f , 0.691341f , -0.462966f , 0.552751f , 0.692892f , 
--0.353553f , -0.382683f , 0.853553f , -0.353862f , -0.380535f , 0.854366f , 
--0.513279f , -0.382683f , 0.768177f , -0.513749f , -0.380535f , 0.768914f , 
--0.461939f , -0.555570f , 0.691341f , -0.462966f , -0.552751f , 0.692892f , 
--0.318189f , 0.555570f , 0.768177f , -0.318888f , 0.552751f , 0.769890f , 
--0.461939f , 0.555570f , 0.691341f , -0.462966f , 0.552751f , 0.692892f , 
--0.513280f , 0.382683f , 0.768177f , -0.513749f , 0.380535f , 0.768914f , 
--0.318189f , -0.555570f , 0.768177f , -0.318888f , -0.552751f , 0.769890f , 
--0.461939f , -0.555570f , 0.691341f , -0.462966f , -0.552751f , 0.692892f , 
--0.392847f , -0.707107f , 0.587937f , -0.394513f , -0.704031f , 0.590442f , 
--0.353553f , 0.382683f , 0.853553f , -0.353893f , 0.380535f , 0.854366f , 
--0.513280f , 0.382683f , 0.768177f , -0.513749f , 0.380535f , 0.768914f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.074658f , 0.980785f , 0.180240f , -0.076907f , 0.979583f , 0.185644f , 
--0.108386f , 0.980785f , 0.162212f , -0.111637f , 0.979583f , 0.167089f , 
--0.212607f , 0.923880f , 0.318190f , -0.215491f , 0.921690f , 0.322489f , 
--0.270598f , -0.707107f , 0.653281f , -0.271737f , -0.704031f , 0.656056f , 
--0.392847f , -0.707107f , 0.587937f , -0.394513f , -0.704031f , 0.590442f , 
--0.308658f , -0.831470f , 0.461939f , -0.310984f , -0.828639f , 0.465407f , 
--0.375330f , 0.195090f , 0.906127f , -0.375408f , 0.193915f , 0.906339f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.555570f , 0.000000f , 0.831469f , -0.555559f , 0.000000f , 0.831446f , 
--0.146446f , 0.923880f , 0.353553f , -0.148412f , 0.921690f , 0.358348f , 
--0.212607f , 0.923880f , 0.318190f , -0.215491f , 0.921690f , 0.322489f , 
--0.308658f , 0.831470f , 0.461939f , -0.310984f , 0.828639f , 0.465407f , 
--0.212607f , -0.831470f , 0.513280f , -0.214209f , -0.828639f , 0.517136f , 
--0.308658f , -0.831470f , 0.461939f , -0.310984f , -0.828639f , 0.465407f , 
--0.212607f , -0.923880f , 0.318189f , -0.215491f , -0.921690f , 0.322489f , 
--0.382683f , 0.000000f , 0.923879f , -0.382672f , 0.000000f , 0.923856f , 
--0.555570f , 0.000000f , 0.831469f , -0.555559f , 0.000000f , 0.831446f , 
--0.544895f , -0.195090f , 0.815493f , -0.545000f , -0.193915f , 0.815668f , 
--0.212607f , 0.831470f , 0.513280f , -0.214209f , 0.828639f , 0.517136f , 
--0.308658f , 0.831470f , 0.461939f , -0.310984f , 0.828639f , 0.465407f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.146446f , -0.923880f , 0.353553f , -0.148412f , -0.921690f , 0.358348f , 
--0.212607f , -0.923880f , 0.318189f , -0.215491f , -0.921690f , 0.322489f , 
--0.108386f , -0.980785f , 0.162212f , -0.111637f , -0.979583f , 0.167089f , 
--0.308658f , -0.831470f , 0.461939f , -0.310984f , -0.828639f , 0.465407f , 
--0.392847f , -0.831470f , 0.392847f , -0.395795f , -0.828639f , 0.395795f , 
--0.270598f , -0.923880f , 0.270598f , -0.274270f , -0.921690f , 0.274270f , 
--0.555570f , 0.000000f , 0.831469f , -0.555559f , 0.000000f , 0.831446f , 
--0.707106f , 0.000000f , 0.707106f , -0.707083f , 0.000000f , 0.707083f , 
--0.693520f , -0.195090f , 0.693519f , -0.693655f , -0.193915f , 0.693655f , 
--0.500000f , 0.707107f , 0.500000f , -0.502121f , 0.704031f , 0.502121f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.392847f , 0.831470f , 0.392847f , -0.395795f , 0.828639f , 0.395795f , 
--0.212607f , -0.923880f , 0.318189f , -0.215491f , -0.921690f , 0.322489f , 
--0.270598f , -0.923880f , 0.270598f , -0.274270f , -0.921690f , 0.274270f , 
--0.137949f , -0.980785f , 0.137950f , -0.142094f , -0.979583f , 0.142094f , 
--0.653281f , -0.382683f , 0.653281f , -0.653890f , -0.380535f , 0.653890f , 
--0.513279f , -0.382683f , 0.768177f , -0.513749f , -0.380535f , 0.768914f , 
--0.693520f , -0.195090f , 0.693519f , -0.693655f , -0.193915f , 0.693655f , 
--0.392847f , 0.707107f , 0.587937f , -0.394513f , 0.704031f , 0.590442f , 
--0.500000f , 0.707107f , 0.500000f , -0.502121f , 0.704031f , 0.502121f , 
--0.587937f , 0.555570f , 0.587937f , -0.589251f , 0.552751f , 0.589251f , 
--0.513279f , -0.382683f , 0.768177f , -0.513749f , -0.380535f , 0.768914f , 
--0.653281f , -0.382683f , 0.653281f , -0.653890f , -0.380535f , 0.653890f , 
--0.587937f , -0.555570f , 0.587937f , -0.589251f , -0.552751f , 0.589251f , 
--0.461939f , 0.555570f , 0.691341f , -0.462966f , 0.552751f , 0.692892f , 
--0.587937f , 0.555570f , 0.587937f , -0.589251f , 0.552751f , 0.589251f , 
--0.653281f , 0.382683f , 0.653281f , -0.653890f , 0.380535f , 0.653890f , 
--0.461939f , -0.555570f , 0.691341f , -0.462966f , -0.552751f , 0.692892f , 
--0.587937f , -0.555570f , 0.587937f , -0.589251f , -0.552751f , 0.589251f , 
--0.500000f , -0.707107f , 0.500000f , -0.502121f , -0.704031f , 0.502121f , 
--0.693519f , 0.195090f , 0.693519f , -0.693655f , 0.193915f , 0.693655f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.653281f , 0.382683f , 0.653281f , -0.653890f , 0.380535f , 0.653890f , 
--0.108386f , 0.980785f , 0.162212f , -0.111637f , 0.979583f , 0.167089f , 
--0.137950f , 0.980785f , 0.137950f , -0.142094f , 0.979583f , 0.142094f , 
--0.270598f , 0.923880f , 0.270598f , -0.274270f , 0.921690f , 0.274270f , 
--0.392847f , -0.707107f , 0.587937f , -0.394513f , -0.704031f , 0.590442f , 
--0.500000f , -0.707107f , 0.500000f , -0.502121f , -0.704031f , 0.502121f , 
--0.392847f , -0.831470f , 0.392847f , -0.395795f , -0.828639f , 0.395795f , 
--0.544895f , 0.195090f , 0.815493f , -0.545000f , 0.193915f , 0.815668f , 
--0.693519f , 0.195090f , 0.693519f , -0.693655f , 0.193915f , 0.693655f , 
--0.707106f , 0.000000f , 0.707106f , -0.707083f , 0.000000f , 0.707083f , 
--0.212607f , 0.923880f , 0.318190f , -0.215491f , 0.921690f , 0.322489f , 
--0.270598f , 0.923880f , 0.270598f , -0.274270f , 0.921690f , 0.274270f , 
--0.392847f , 0.831470f , 0.392847f , -0.395795f , 0.828639f , 0.395795f , 
--0.500000f , -0.707107f , 0.500000f , -0.502121f , -0.704031f , 0.502121f , 
--0.587937f , -0.707107f , 0.392847f , -0.590442f , -0.704031f , 0.394513f , 
--0.461939f , -0.831470f , 0.308658f , -0.465407f , -0.828639f , 0.310984f , 
--0.693519f , 0.195090f , 0.693519f , -0.693655f , 0.193915f , 0.693655f , 
--0.815492f , 0.195090f , 0.544895f , -0.815668f , 0.193915f , 0.545000f , 
--0.831469f , 0.000000f , 0.555570f , -0.831446f , 0.000000f , 0.555559f , 
--0.270598f , 0.923880f , 0.270598f , -0.274270f , 0.921690f , 0.274270f , 
--0.318189f , 0.923880f , 0.212607f , -0.322489f , 0.921690f , 0.215491f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.392847f , -0.831470f , 0.392847f , -0.395795f , -0.828639f , 0.395795f , 
--0.461939f , -0.831470f , 0.308658f , -0.465407f , -0.828639f , 0.310984f , 
--0.318189f , -0.923880f , 0.212607f , -0.322489f , -0.921690f , 0.215491f , 
--0.707106f , 0.000000f , 0.707106f , -0.707083f , 0.000000f , 0.707083f , 
--0.831469f , 0.000000f , 0.555570f , -0.831446f , 0.000000f , 0.555559f , 
--0.815493f , -0.195090f , 0.544895f , -0.815668f , -0.193915f , 0.545000f , 
--0.587937f , 0.707107f , 0.392847f , -0.590442f , 0.704031f , 0.394513f , 
--0.500000f , 0.707107f , 0.500000f , -0.502121f , 0.704031f , 0.502121f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.270598f , -0.923880f , 0.270598f , -0.274270f , -0.921690f , 0.274270f , 
--0.318189f , -0.923880f , 0.212607f , -0.322489f , -0.921690f , 0.215491f , 
--0.162211f , -0.980785f , 0.108386f , -0.167089f , -0.979583f , 0.111637f , 
--0.768177f , -0.382683f , 0.513280f , -0.768914f , -0.380535f , 0.513749f , 
--0.653281f , -0.382683f , 0.653281f , -0.653890f , -0.380535f , 0.653890f , 
--0.815493f , -0.195090f , 0.544895f , -0.815668f , -0.193915f , 0.545000f , 
--0.500000f , 0.707107f , 0.500000f , -0.502121f , 0.704031f , 0.502121f , 
--0.587937f , 0.707107f , 0.392847f , -0.590442f , 0.704031f , 0.394513f , 
--0.691341f , 0.555570f , 0.461939f , -0.692892f , 0.552751f , 0.462966f , 
--0.653281f , -0.382683f , 0.653281f , -0.653890f , -0.380535f , 0.653890f , 
--0.768177f , -0.382683f , 0.513280f , -0.768914f , -0.380535f , 0.513749f , 
--0.691341f , -0.555570f , 0.461939f , -0.692892f , -0.552751f , 0.462966f , 
--0.587937f , 0.555570f , 0.587937f , -0.589251f , 0.552751f , 0.589251f , 
--0.691341f , 0.555570f , 0.461939f , -0.692892f , 0.552751f , 0.462966f , 
--0.768177f , 0.382683f , 0.513279f , -0.768914f , 0.380535f , 0.513749f , 
--0.587937f , -0.555570f , 0.587937f , -0.589251f , -0.552751f , 0.589251f , 
--0.691341f , -0.555570f , 0.461939f , -0.692892f , -0.552751f , 0.462966f , 
--0.587937f , -0.707107f , 0.392847f , -0.590442f , -0.704031f , 0.394513f , 
--0.815492f , 0.195090f , 0.544895f , -0.815668f , 0.193915f , 0.545000f , 
--0.693519f , 0.195090f , 0.693519f , -0.693655f , 0.193915f , 0.693655f , 
--0.768177f , 0.382683f , 0.513279f , -0.768914f , 0.380535f , 0.513749f , 
--0.137950f , 0.980785f , 0.137950f , -0.142094f , 0.979583f , 0.142094f , 
--0.162212f , 0.980785f , 0.108386f , -0.167089f , 0.979583f , 0.111637f , 
--0.318189f , 0.923880f , 0.212607f , -0.322489f , 0.921690f , 0.215491f , 
--0.691341f , -0.555570f , 0.461939f , -0.692892f , -0.552751f , 0.462966f , 
--0.768177f , -0.555570f , 0.318189f , -0.769890f , -0.552751f , 0.318888f , 
--0.653281f , -0.707107f , 0.270598f , -0.656056f , -0.704031f , 0.271737f , 
--0.906127f , 0.195090f , 0.375330f , -0.906339f , 0.193915f , 0.375408f , 
--0.815492f , 0.195090f , 0.544895f , -0.815668f , 0.193915f , 0.545000f , 
--0.853553f , 0.382683f , 0.353553f , -0.854366f , 0.380535f , 0.353862f , 
--0.162212f , 0.980785f , 0.108386f , -0.167089f , 0.979583f , 0.111637f , 
--0.180240f , 0.980785f , 0.074658f , -0.185644f , 0.979583f , 0.076907f , 
--0.353553f , 0.923880f , 0.146446f , -0.358348f , 0.921690f , 0.148412f , 
--0.587937f , -0.707107f , 0.392847f , -0.590442f , -0.704031f , 0.394513f , 
--0.653281f , -0.707107f , 0.270598f , -0.656056f , -0.704031f , 0.271737f , 
--0.513279f , -0.831470f , 0.212607f , -0.517136f , -0.828639f , 0.214209f , 
--0.815492f , 0.195090f , 0.544895f , -0.815668f , 0.193915f , 0.545000f , 
--0.906127f , 0.195090f , 0.375330f , -0.906339f , 0.193915f , 0.375408f , 
--0.923879f , 0.000000f , 0.382683f , -0.923856f , 0.000000f , 0.382672f , 
--0.318189f , 0.923880f , 0.212607f , -0.322489f , 0.921690f , 0.215491f , 
--0.353553f , 0.923880f , 0.146446f , -0.358348f , 0.921690f , 0.148412f , 
--0.513279f , 0.831470f , 0.212607f , -0.517136f , 0.828639f , 0.214209f , 
--0.461939f , -0.831470f , 0.308658f , -0.465407f , -0.828639f , 0.310984f , 
--0.513279f , -0.831470f , 0.212607f , -0.517136f , -0.828639f , 0.214209f , 
--0.353553f , -0.923880f , 0.146446f , -0.358348f , -0.921690f , 0.148412f , 
--0.831469f , 0.000000f , 0.555570f , -0.831446f , 0.000000f , 0.555559f , 
--0.923879f , 0.000000f , 0.382683f , -0.923856f , 0.000000f , 0.382672f , 
--0.906127f , -0.195090f , 0.375330f , -0.906339f , -0.193915f , 0.375408f , 
--0.461939f , 0.831470f , 0.308658f , -0.465407f , 0.828639f , 0.310984f , 
--0.513279f , 0.831470f , 0.212607f , -0.517136f , 0.828639f , 0.214209f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.318189f , -0.923880f , 0.212607f , -0.322489f , -0.921690f , 0.215491f , 
--0.353553f , -0.923880f , 0.146446f , -0.358348f , -0.921690f , 0.148412f , 
--0.180240f , -0.980785f , 0.074658f , -0.185644f , -0.979583f , 0.076907f , 
--0.853553f , -0.382683f , 0.353553f , -0.854366f , -0.380535f , 0.353862f , 
--0.768177f , -0.382683f , 0.513280f , -0.768914f , -0.380535f , 0.513749f , 
--0.906127f , -0.195090f , 0.375330f , -0.906339f , -0.193915f , 0.375408f , 
--0.587937f , 0.707107f , 0.392847f , -0.590442f , 0.704031f , 0.394513f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.768177f , 0.555570f , 0.318189f , -0.769890f , 0.552751f , 0.318888f , 
--0.768177f , -0.382683f , 0.513280f , -0.768914f , -0.380535f , 0.513749f , 
--0.853553f , -0.382683f , 0.353553f , -0.854366f , -0.380535f , 0.353862f , 
--0.768177f , -0.555570f , 0.318189f , -0.769890f , -0.552751f , 0.318888f , 
--0.691341f , 0.555570f , 0.461939f , -0.692892f , 0.552751f , 0.462966f , 
--0.768177f , 0.555570f , 0.318189f , -0.769890f , 0.552751f , 0.318888f , 
--0.853553f , 0.382683f , 0.353553f , -0.854366f , 0.380535f , 0.353862f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.693519f , 0.707107f , 0.137949f , -0.696493f , 0.704031f , 0.138524f , 
--0.815493f , 0.555570f , 0.162211f , -0.817316f , 0.552751f , 0.162572f , 
--0.853553f , -0.382683f , 0.353553f , -0.854366f , -0.380535f , 0.353862f , 
--0.906127f , -0.382683f , 0.180240f , -0.906980f , -0.380535f , 0.180395f , 
--0.815493f , -0.555570f , 0.162211f , -0.817316f , -0.552751f , 0.162572f , 
--0.768177f , 0.555570f , 0.318189f , -0.769890f , 0.552751f , 0.318888f , 
--0.815493f , 0.555570f , 0.162211f , -0.817316f , 0.552751f , 0.162572f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.768177f , -0.555570f , 0.318189f , -0.769890f , -0.552751f , 0.318888f , 
--0.815493f , -0.555570f , 0.162211f , -0.817316f , -0.552751f , 0.162572f , 
--0.693519f , -0.707107f , 0.137949f , -0.696493f , -0.704031f , 0.138524f , 
--0.961939f , 0.195090f , 0.191341f , -0.962157f , 0.193915f , 0.191382f , 
--0.906127f , 0.195090f , 0.375330f , -0.906339f , 0.193915f , 0.375408f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.180240f , 0.980785f , 0.074658f , -0.185644f , 0.979583f , 0.076907f , 
--0.191342f , 0.980785f , 0.038060f , -0.197089f , 0.979583f , 0.039186f , 
--0.375330f , 0.923880f , 0.074658f , -0.380413f , 0.921690f , 0.075655f , 
--0.653281f , -0.707107f , 0.270598f , -0.656056f , -0.704031f , 0.271737f , 
--0.693519f , -0.707107f , 0.137949f , -0.696493f , -0.704031f , 0.138524f , 
--0.544895f , -0.831470f , 0.108386f , -0.548997f , -0.828639f , 0.109195f , 
--0.906127f , 0.195090f , 0.375330f , -0.906339f , 0.193915f , 0.375408f , 
--0.961939f , 0.195090f , 0.191341f , -0.962157f , 0.193915f , 0.191382f , 
--0.980784f , 0.000000f , 0.195090f , -0.980773f , 0.000000f , 0.195074f , 
--0.353553f , 0.923880f , 0.146446f , -0.358348f , 0.921690f , 0.148412f , 
--0.375330f , 0.923880f , 0.074658f , -0.380413f , 0.921690f , 0.075655f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.513279f , -0.831470f , 0.212607f , -0.517136f , -0.828639f , 0.214209f , 
--0.544895f , -0.831470f , 0.108386f , -0.548997f , -0.828639f , 0.109195f , 
--0.375330f , -0.923880f , 0.074658f , -0.380413f , -0.921690f , 0.075655f , 
--0.923879f , 0.000000f , 0.382683f , -0.923856f , 0.000000f , 0.382672f , 
--0.980784f , 0.000000f , 0.195090f , -0.980773f , 0.000000f , 0.195074f , 
--0.961939f , -0.195090f , 0.191341f , -0.962157f , -0.193915f , 0.191382f , 
--0.693519f , 0.707107f , 0.137949f , -0.696493f , 0.704031f , 0.138524f , 
--0.653281f , 0.707107f , 0.270598f , -0.656056f , 0.704031f , 0.271737f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.353553f , -0.923880f , 0.146446f , -0.358348f , -0.921690f , 0.148412f , 
--0.375330f , -0.923880f , 0.074658f , -0.380413f , -0.921690f , 0.075655f , 
--0.191341f , -0.980785f , 0.038060f , -0.197089f , -0.979583f , 0.039186f , 
--0.906127f , -0.382683f , 0.180240f , -0.906980f , -0.380535f , 0.180395f , 
--0.853553f , -0.382683f , 0.353553f , -0.854366f , -0.380535f , 0.353862f , 
--0.961939f , -0.195090f , 0.191341f , -0.962157f , -0.193915f , 0.191382f , 
--0.980784f , 0.000000f , 0.195090f , -0.980773f , 0.000000f , 0.195074f , 
--1.000000f , 0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--0.544895f , 0.831470f , 0.108386f , -0.548997f , 0.828639f , 0.109195f , 
--0.555570f , 0.831470f , 0.000000f , -0.559771f , 0.828639f , 0.000000f , 
--0.707107f , 0.707107f , 0.000000f , -0.710135f , 0.704031f , 0.000000f , 
--0.195090f , -0.980785f , 0.000000f , -0.200964f , -0.979583f , 0.000000f , 
--0.191341f , -0.980785f , 0.038060f , -0.197089f , -0.979583f , 0.039186f , 
--0.382683f , -0.923880f , 0.000000f , -0.387860f , -0.921690f , 0.000000f , 
--0.923880f , -0.382683f , 0.000000f , -0.924741f , -0.380535f , 0.000000f , 
--0.906127f , -0.382683f , 0.180240f , -0.906980f , -0.380535f , 0.180395f , 
--0.980785f , -0.195090f , 0.000000f , -0.980987f , -0.193915f , 0.000000f , 
--0.693519f , 0.707107f , 0.137949f , -0.696493f , 0.704031f , 0.138524f , 
--0.707107f , 0.707107f , 0.000000f , -0.710135f , 0.704031f , 0.000000f , 
--0.831470f , 0.555570f , 0.000000f , -0.833338f , 0.552751f , 0.000000f , 
--0.831470f , -0.555570f , 0.000000f , -0.833338f , -0.552751f , 0.000000f , 
--0.815493f , -0.555570f , 0.162211f , -0.817316f , -0.552751f , 0.162572f , 
--0.923880f , -0.382683f , 0.000000f , -0.924741f , -0.380535f , 0.000000f , 
--0.815493f , 0.555570f , 0.162211f , -0.817316f , 0.552751f , 0.162572f , 
--0.831470f , 0.555570f , 0.000000f , -0.833338f , 0.552751f , 0.000000f , 
--0.923880f , 0.382683f , 0.000000f , -0.924741f , 0.380535f , 0.000000f , 
--0.707107f , -0.707107f , 0.000000f , -0.710135f , -0.704031f , 0.000000f , 
--0.693519f , -0.707107f , 0.137949f , -0.696493f , -0.704031f , 0.138524f , 
--0.831470f , -0.555570f , 0.000000f , -0.833338f , -0.552751f , 0.000000f , 
--0.906127f , 0.382683f , 0.180240f , -0.906980f , 0.380535f , 0.180395f , 
--0.923880f , 0.382683f , 0.000000f , -0.924741f , 0.380535f , 0.000000f , 
--0.980785f , 0.195090f , 0.000000f , -0.980987f , 0.193915f , 0.000000f , 
--0.191342f , 0.980785f , 0.038060f , -0.197089f , 0.979583f , 0.039186f , 
--0.195090f , 0.980785f , 0.000000f , -0.200964f , 0.979583f , 0.000000f , 
--0.382683f , 0.923880f , 0.000000f , -0.387860f , 0.921690f , 0.000000f , 
--0.555570f , -0.831470f , 0.000000f , -0.559771f , -0.828639f , 0.000000f , 
--0.544895f , -0.831470f , 0.108386f , -0.548997f , -0.828639f , 0.109195f , 
--0.707107f , -0.707107f , 0.000000f , -0.710135f , -0.704031f , 0.000000f , 
--0.961939f , 0.195090f , 0.191341f , -0.962157f , 0.193915f , 0.191382f , 
--0.980785f , 0.195090f , 0.000000f , -0.980987f , 0.193915f , 0.000000f , 
--1.000000f , 0.000000f , 0.000000f , -1.000000f , 0.000000f , 0.000000f , 
--0.375330f , 0.923880f , 0.074658f , -0.380413f , 0.921690f , 0.075655f , 
--0.382683f , 0.923880f , 0.000000f , -0.387860f , 0.921690f , 0.000000f , 
--0.555570f , 0.831470f , 0.000000f , -0.559771f , 0.828639f , 0.000000f , 
--0.382683f , -0.923880f , 0.000000f , -0.387860f , -0.921690f , 0.000000f , 
--0.375330f , -0.923880f , 0.074658f , -0.380413f , -0.921690f , 0.075655f , 
--0.555570f , -0.831470f , 0.000000f , -0.559771f , -0.828639f , 0.000000f
-};
@@ -1,2920 +0,0 @@
-/**
- * @file suzi_flat.h
- *
- * @brief Suzi model (Flat)
- *
- * @details  Command for rendering
- *           glDrawArrays(GL_TRIANGLES, 0, 2904);
- *
- * @author Martin Nemec
- *
- * @year 2023
- **/
-
-
-const float suziFlat[17424] ={
-0.468750f , 0.242187f , 0.757812f , 0.663036f , -0.192883f , 0.723312f ,
-0.437500f , 0.164062f , 0.765625f , 0.663036f , -0.192883f , 0.723312f ,
-0.562500f , 0.242187f , 0.671875f , 0.663036f , -0.192883f , 0.723312f ,
--0.500000f , 0.093750f , 0.687500f , -0.666010f , -0.204926f , 0.717242f ,
--0.437500f , 0.164062f , 0.765625f , -0.666010f , -0.204926f , 0.717242f ,
--0.562500f , 0.242187f , 0.671875f , -0.666010f , -0.204926f , 0.717242f ,
-0.562500f , 0.242187f , 0.671875f , 0.828520f , -0.299015f , 0.473440f ,
-0.500000f , 0.093750f , 0.687500f , 0.828520f , -0.299015f , 0.473440f ,
-0.625000f , 0.242187f , 0.562500f , 0.828520f , -0.299015f , 0.473440f ,
--0.546875f , 0.054687f , 0.578125f , -0.830101f , -0.307090f , 0.465433f ,
--0.500000f , 0.093750f , 0.687500f , -0.830101f , -0.307090f , 0.465433f ,
--0.625000f , 0.242187f , 0.562500f , -0.830101f , -0.307090f , 0.465433f ,
-0.500000f , 0.093750f , 0.687500f , 0.425062f , -0.779280f , 0.460484f ,
-0.351562f , 0.031250f , 0.718750f , 0.425062f , -0.779280f , 0.460484f ,
-0.546875f , 0.054687f , 0.578125f , 0.425062f , -0.779280f , 0.460484f ,
--0.351562f , -0.023438f , 0.617188f , -0.408092f , -0.803818f , 0.432825f ,
--0.351562f , 0.031250f , 0.718750f , -0.408092f , -0.803818f , 0.432825f ,
--0.546875f , 0.054687f , 0.578125f , -0.408092f , -0.803818f , 0.432825f ,
-0.437500f , 0.164062f , 0.765625f , 0.338487f , -0.548583f , 0.764515f ,
-0.351562f , 0.132812f , 0.781250f , 0.338487f , -0.548583f , 0.764515f ,
-0.500000f , 0.093750f , 0.687500f , 0.338487f , -0.548583f , 0.764515f ,
--0.351562f , 0.031250f , 0.718750f , -0.371366f , -0.486617f , 0.790753f ,
--0.351562f , 0.132812f , 0.781250f , -0.371366f , -0.486617f , 0.790753f ,
--0.500000f , 0.093750f , 0.687500f , -0.371366f , -0.486617f , 0.790753f ,
-0.351562f , 0.132812f , 0.781250f , -0.039277f , -0.523693f , 0.851001f ,
-0.273438f , 0.164062f , 0.796875f , -0.039277f , -0.523693f , 0.851001f ,
-0.351562f , 0.031250f , 0.718750f , -0.039277f , -0.523693f , 0.851001f ,
--0.203125f , 0.093750f , 0.742188f , 0.099184f , -0.547220f , 0.831091f ,
--0.273438f , 0.164062f , 0.796875f , 0.099184f , -0.547220f , 0.831091f ,
--0.351562f , 0.031250f , 0.718750f , 0.099184f , -0.547220f , 0.831091f ,
-0.351562f , 0.031250f , 0.718750f , -0.283710f , -0.844293f , 0.454619f ,
-0.203125f , 0.093750f , 0.742188f , -0.283710f , -0.844293f , 0.454619f ,
-0.351562f , -0.023438f , 0.617188f , -0.283710f , -0.844293f , 0.454619f ,
--0.156250f , 0.054687f , 0.648438f , 0.258889f , -0.838801f , 0.478945f ,
--0.203125f , 0.093750f , 0.742188f , 0.258889f , -0.838801f , 0.478945f ,
--0.351562f , -0.023438f , 0.617188f , 0.258889f , -0.838801f , 0.478945f ,
-0.203125f , 0.093750f , 0.742188f , -0.765568f , -0.322344f , 0.556777f ,
-0.140625f , 0.242187f , 0.742188f , -0.765568f , -0.322344f , 0.556777f ,
-0.078125f , 0.242187f , 0.656250f , -0.765568f , -0.322344f , 0.556777f ,
--0.078125f , 0.242187f , 0.656250f , 0.765568f , -0.322344f , 0.556777f ,
--0.140625f , 0.242187f , 0.742188f , 0.765568f , -0.322344f , 0.556777f ,
--0.203125f , 0.093750f , 0.742188f , 0.765568f , -0.322344f , 0.556777f ,
-0.273438f , 0.164062f , 0.796875f , -0.465798f , -0.186319f , 0.865053f ,
-0.242188f , 0.242187f , 0.796875f , -0.465798f , -0.186319f , 0.865053f ,
-0.140625f , 0.242187f , 0.742188f , -0.465798f , -0.186319f , 0.865053f ,
--0.140625f , 0.242187f , 0.742188f , 0.465798f , -0.186319f , 0.865053f ,
--0.242188f , 0.242187f , 0.796875f , 0.465798f , -0.186319f , 0.865053f ,
--0.273438f , 0.164062f , 0.796875f , 0.465798f , -0.186319f , 0.865053f ,
-0.242188f , 0.242187f , 0.796875f , -0.467208f , 0.169894f , 0.867671f ,
-0.273438f , 0.328125f , 0.796875f , -0.467208f , 0.169894f , 0.867671f ,
-0.140625f , 0.242187f , 0.742188f , -0.467208f , 0.169894f , 0.867671f ,
--0.203125f , 0.390625f , 0.742188f , 0.482283f , 0.203067f , 0.852154f ,
--0.273438f , 0.328125f , 0.796875f , 0.482283f , 0.203067f , 0.852154f ,
--0.140625f , 0.242187f , 0.742188f , 0.482283f , 0.203067f , 0.852154f ,
-0.140625f , 0.242187f , 0.742188f , -0.771027f , 0.324643f , 0.547835f ,
-0.203125f , 0.390625f , 0.742188f , -0.771027f , 0.324643f , 0.547835f ,
-0.156250f , 0.437500f , 0.648438f , -0.771027f , 0.324643f , 0.547835f ,
--0.156250f , 0.437500f , 0.648438f , 0.771027f , 0.324643f , 0.547835f ,
--0.203125f , 0.390625f , 0.742188f , 0.771027f , 0.324643f , 0.547835f ,
--0.140625f , 0.242187f , 0.742188f , 0.771027f , 0.324643f , 0.547835f ,
-0.203125f , 0.390625f , 0.742188f , -0.265910f , 0.820997f , 0.505229f ,
-0.351562f , 0.453125f , 0.718750f , -0.265910f , 0.820997f , 0.505229f ,
-0.351562f , 0.515625f , 0.617188f , -0.265910f , 0.820997f , 0.505229f ,
--0.351562f , 0.515625f , 0.617188f , 0.265910f , 0.820997f , 0.505229f ,
--0.351562f , 0.453125f , 0.718750f , 0.265910f , 0.820997f , 0.505229f ,
--0.203125f , 0.390625f , 0.742188f , 0.265910f , 0.820997f , 0.505229f ,
-0.273438f , 0.328125f , 0.796875f , -0.055385f , 0.553849f , 0.830773f ,
-0.351562f , 0.359375f , 0.781250f , -0.055385f , 0.553849f , 0.830773f ,
-0.351562f , 0.453125f , 0.718750f , -0.055385f , 0.553849f , 0.830773f ,
--0.351562f , 0.453125f , 0.718750f , 0.055385f , 0.553849f , 0.830773f ,
--0.351562f , 0.359375f , 0.781250f , 0.055385f , 0.553849f , 0.830773f ,
--0.273438f , 0.328125f , 0.796875f , 0.055385f , 0.553849f , 0.830773f ,
-0.351562f , 0.359375f , 0.781250f , 0.344839f , 0.578837f , 0.738941f ,
-0.437500f , 0.328125f , 0.765625f , 0.344839f , 0.578837f , 0.738941f ,
-0.500000f , 0.390625f , 0.687500f , 0.344839f , 0.578837f , 0.738941f ,
--0.500000f , 0.390625f , 0.687500f , -0.344839f , 0.578837f , 0.738941f ,
--0.437500f , 0.328125f , 0.765625f , -0.344839f , 0.578837f , 0.738941f ,
--0.351562f , 0.359375f , 0.781250f , -0.344839f , 0.578837f , 0.738941f ,
-0.351562f , 0.453125f , 0.718750f , 0.423136f , 0.752934f , 0.504030f ,
-0.500000f , 0.390625f , 0.687500f , 0.423136f , 0.752934f , 0.504030f ,
-0.546875f , 0.437500f , 0.578125f , 0.423136f , 0.752934f , 0.504030f ,
--0.546875f , 0.437500f , 0.578125f , -0.423136f , 0.752934f , 0.504030f ,
--0.500000f , 0.390625f , 0.687500f , -0.423136f , 0.752934f , 0.504030f ,
--0.351562f , 0.453125f , 0.718750f , -0.423136f , 0.752934f , 0.504030f ,
-0.500000f , 0.390625f , 0.687500f , 0.828520f , 0.299015f , 0.473440f ,
-0.562500f , 0.242187f , 0.671875f , 0.828520f , 0.299015f , 0.473440f ,
-0.625000f , 0.242187f , 0.562500f , 0.828520f , 0.299015f , 0.473440f ,
--0.625000f , 0.242187f , 0.562500f , -0.828520f , 0.299015f , 0.473440f ,
--0.562500f , 0.242187f , 0.671875f , -0.828520f , 0.299015f , 0.473440f ,
--0.500000f , 0.390625f , 0.687500f , -0.828520f , 0.299015f , 0.473440f ,
-0.437500f , 0.328125f , 0.765625f , 0.665187f , 0.175917f , 0.725658f ,
-0.468750f , 0.242187f , 0.757812f , 0.665187f , 0.175917f , 0.725658f ,
-0.562500f , 0.242187f , 0.671875f , 0.665187f , 0.175917f , 0.725658f ,
--0.562500f , 0.242187f , 0.671875f , -0.665187f , 0.175917f , 0.725658f ,
--0.468750f , 0.242187f , 0.757812f , -0.665187f , 0.175917f , 0.725658f ,
--0.437500f , 0.328125f , 0.765625f , -0.665187f , 0.175917f , 0.725658f ,
-0.468750f , 0.242187f , 0.757812f , 0.768350f , 0.329293f , -0.548821f ,
-0.437500f , 0.328125f , 0.765625f , 0.768350f , 0.329293f , -0.548821f ,
-0.445312f , 0.335937f , 0.781250f , 0.768350f , 0.329293f , -0.548821f ,
--0.445312f , 0.335937f , 0.781250f , -0.768350f , 0.329293f , -0.548821f ,
--0.437500f , 0.328125f , 0.765625f , -0.768350f , 0.329293f , -0.548821f ,
--0.468750f , 0.242187f , 0.757812f , -0.768350f , 0.329293f , -0.548821f ,
-0.437500f , 0.328125f , 0.765625f , 0.197727f , 0.815623f , -0.543749f ,
-0.351562f , 0.359375f , 0.781250f , 0.197727f , 0.815623f , -0.543749f ,
-0.351562f , 0.375000f , 0.804688f , 0.197727f , 0.815623f , -0.543749f ,
--0.351562f , 0.375000f , 0.804688f , -0.197727f , 0.815623f , -0.543749f ,
--0.351562f , 0.359375f , 0.781250f , -0.197727f , 0.815623f , -0.543749f ,
--0.437500f , 0.328125f , 0.765625f , -0.197727f , 0.815623f , -0.543749f ,
-0.351562f , 0.359375f , 0.781250f , -0.408248f , 0.816497f , -0.408248f ,
-0.273438f , 0.328125f , 0.796875f , -0.408248f , 0.816497f , -0.408248f ,
-0.265625f , 0.335937f , 0.820312f , -0.408248f , 0.816497f , -0.408248f ,
--0.265625f , 0.335937f , 0.820312f , 0.408248f , 0.816497f , -0.408248f ,
--0.273438f , 0.328125f , 0.796875f , 0.408248f , 0.816497f , -0.408248f ,
--0.351562f , 0.359375f , 0.781250f , 0.408248f , 0.816497f , -0.408248f ,
-0.273438f , 0.328125f , 0.796875f , -0.796395f , 0.289598f , -0.530930f ,
-0.242188f , 0.242187f , 0.796875f , -0.796395f , 0.289598f , -0.530930f ,
-0.226562f , 0.242187f , 0.820312f , -0.796395f , 0.289598f , -0.530930f ,
--0.226562f , 0.242187f , 0.820312f , 0.796395f , 0.289598f , -0.530930f ,
--0.242188f , 0.242187f , 0.796875f , 0.796395f , 0.289598f , -0.530930f ,
--0.273438f , 0.328125f , 0.796875f , 0.796395f , 0.289598f , -0.530930f ,
-0.242188f , 0.242187f , 0.796875f , -0.789474f , -0.315789f , -0.526316f ,
-0.273438f , 0.164062f , 0.796875f , -0.789474f , -0.315789f , -0.526316f ,
-0.226562f , 0.242187f , 0.820312f , -0.789474f , -0.315789f , -0.526316f ,
--0.265625f , 0.156250f , 0.820312f , 0.832845f , -0.378566f , -0.403804f ,
--0.273438f , 0.164062f , 0.796875f , 0.832845f , -0.378566f , -0.403804f ,
--0.226562f , 0.242187f , 0.820312f , 0.832845f , -0.378566f , -0.403804f ,
-0.273438f , 0.164062f , 0.796875f , -0.408248f , -0.816497f , -0.408248f ,
-0.351562f , 0.132812f , 0.781250f , -0.408248f , -0.816497f , -0.408248f ,
-0.265625f , 0.156250f , 0.820312f , -0.408248f , -0.816497f , -0.408248f ,
--0.351562f , 0.117187f , 0.804688f , 0.432041f , -0.750388f , -0.500259f ,
--0.351562f , 0.132812f , 0.781250f , 0.432041f , -0.750388f , -0.500259f ,
--0.265625f , 0.156250f , 0.820312f , 0.432041f , -0.750388f , -0.500259f ,
-0.351562f , 0.132812f , 0.781250f , 0.197727f , -0.815623f , -0.543749f ,
-0.437500f , 0.164062f , 0.765625f , 0.197727f , -0.815623f , -0.543749f ,
-0.351562f , 0.117187f , 0.804688f , 0.197727f , -0.815623f , -0.543749f ,
--0.445312f , 0.156250f , 0.781250f , -0.214297f , -0.826574f , -0.520435f ,
--0.437500f , 0.164062f , 0.765625f , -0.214297f , -0.826574f , -0.520435f ,
--0.351562f , 0.117187f , 0.804688f , -0.214297f , -0.826574f , -0.520435f ,
-0.437500f , 0.164062f , 0.765625f , 0.752217f , -0.356313f , -0.554265f ,
-0.468750f , 0.242187f , 0.757812f , 0.752217f , -0.356313f , -0.554265f ,
-0.445312f , 0.156250f , 0.781250f , 0.752217f , -0.356313f , -0.554265f ,
--0.476562f , 0.242187f , 0.773438f , -0.839964f , -0.343622f , -0.419982f ,
--0.468750f , 0.242187f , 0.757812f , -0.839964f , -0.343622f , -0.419982f ,
--0.445312f , 0.156250f , 0.781250f , -0.839964f , -0.343622f , -0.419982f ,
-0.351562f , 0.242187f , 0.828125f , 0.400039f , -0.062344f , 0.914375f ,
-0.445312f , 0.156250f , 0.781250f , 0.400039f , -0.062344f , 0.914375f ,
-0.476562f , 0.242187f , 0.773438f , 0.400039f , -0.062344f , 0.914375f ,
--0.476562f , 0.242187f , 0.773438f , -0.400039f , -0.062344f , 0.914375f ,
--0.445312f , 0.156250f , 0.781250f , -0.400039f , -0.062344f , 0.914375f ,
--0.351562f , 0.242187f , 0.828125f , -0.400039f , -0.062344f , 0.914375f ,
-0.351562f , 0.117187f , 0.804688f , 0.306938f , -0.175393f , 0.935429f ,
-0.445312f , 0.156250f , 0.781250f , 0.306938f , -0.175393f , 0.935429f ,
-0.351562f , 0.242187f , 0.828125f , 0.306938f , -0.175393f , 0.935429f ,
--0.351562f , 0.242187f , 0.828125f , -0.306938f , -0.175393f , 0.935429f ,
--0.445312f , 0.156250f , 0.781250f , -0.306938f , -0.175393f , 0.935429f ,
--0.351562f , 0.117187f , 0.804688f , -0.306938f , -0.175393f , 0.935429f ,
-0.351562f , 0.242187f , 0.828125f , 0.094512f , -0.183464f , 0.978473f ,
-0.265625f , 0.156250f , 0.820312f , 0.094512f , -0.183464f , 0.978473f ,
-0.351562f , 0.117187f , 0.804688f , 0.094512f , -0.183464f , 0.978473f ,
--0.351562f , 0.117187f , 0.804688f , -0.094512f , -0.183464f , 0.978473f ,
--0.265625f , 0.156250f , 0.820312f , -0.094512f , -0.183464f , 0.978473f ,
--0.351562f , 0.242187f , 0.828125f , -0.094512f , -0.183464f , 0.978473f ,
-0.351562f , 0.242187f , 0.828125f , -0.062353f , -0.028342f , 0.997652f ,
-0.226562f , 0.242187f , 0.820312f , -0.062353f , -0.028342f , 0.997652f ,
-0.265625f , 0.156250f , 0.820312f , -0.062353f , -0.028342f , 0.997652f ,
--0.265625f , 0.156250f , 0.820312f , 0.062353f , -0.028342f , 0.997652f ,
--0.226562f , 0.242187f , 0.820312f , 0.062353f , -0.028342f , 0.997652f ,
--0.351562f , 0.242187f , 0.828125f , 0.062353f , -0.028342f , 0.997652f ,
-0.351562f , 0.242187f , 0.828125f , -0.062357f , 0.025982f , 0.997716f ,
-0.265625f , 0.335937f , 0.820312f , -0.062357f , 0.025982f , 0.997716f ,
-0.226562f , 0.242187f , 0.820312f , -0.062357f , 0.025982f , 0.997716f ,
--0.226562f , 0.242187f , 0.820312f , 0.062357f , 0.025982f , 0.997716f ,
--0.265625f , 0.335937f , 0.820312f , 0.062357f , 0.025982f , 0.997716f ,
--0.351562f , 0.242187f , 0.828125f , 0.062357f , 0.025982f , 0.997716f ,
-0.351562f , 0.242187f , 0.828125f , 0.099561f , 0.172922f , 0.979891f ,
-0.351562f , 0.375000f , 0.804688f , 0.099561f , 0.172922f , 0.979891f ,
-0.265625f , 0.335937f , 0.820312f , 0.099561f , 0.172922f , 0.979891f ,
--0.265625f , 0.335937f , 0.820312f , -0.099561f , 0.172922f , 0.979891f ,
--0.351562f , 0.375000f , 0.804688f , -0.099561f , 0.172922f , 0.979891f ,
--0.351562f , 0.242187f , 0.828125f , -0.099561f , 0.172922f , 0.979891f ,
-0.351562f , 0.242187f , 0.828125f , 0.303571f , 0.165584f , 0.938310f ,
-0.445312f , 0.335937f , 0.781250f , 0.303571f , 0.165584f , 0.938310f ,
-0.351562f , 0.375000f , 0.804688f , 0.303571f , 0.165584f , 0.938310f ,
--0.351562f , 0.375000f , 0.804688f , -0.303571f , 0.165584f , 0.938310f ,
--0.445312f , 0.335937f , 0.781250f , -0.303571f , 0.165584f , 0.938310f ,
--0.351562f , 0.242187f , 0.828125f , -0.303571f , 0.165584f , 0.938310f ,
-0.351562f , 0.242187f , 0.828125f , 0.400163f , 0.057166f , 0.914659f ,
-0.476562f , 0.242187f , 0.773438f , 0.400163f , 0.057166f , 0.914659f ,
-0.445312f , 0.335937f , 0.781250f , 0.400163f , 0.057166f , 0.914659f ,
--0.445312f , 0.335937f , 0.781250f , -0.400163f , 0.057166f , 0.914659f ,
--0.476562f , 0.242187f , 0.773438f , -0.400163f , 0.057166f , 0.914659f ,
--0.351562f , 0.242187f , 0.828125f , -0.400163f , 0.057166f , 0.914659f ,
-0.179688f , -0.968750f , 0.554687f , 0.105862f , -0.880771f , 0.461558f ,
-0.164062f , -0.929688f , 0.632812f , 0.105862f , -0.880771f , 0.461558f ,
-0.000000f , -0.945312f , 0.640625f , 0.105862f , -0.880771f , 0.461558f ,
-0.000000f , -0.945312f , 0.640625f , -0.105862f , -0.880771f , 0.461558f ,
--0.164062f , -0.929688f , 0.632812f , -0.105862f , -0.880771f , 0.461558f ,
--0.179688f , -0.968750f , 0.554687f , -0.105862f , -0.880771f , 0.461558f ,
-0.328125f , -0.945312f , 0.523437f , 0.196715f , -0.885219f , 0.421533f ,
-0.234375f , -0.914062f , 0.632812f , 0.196715f , -0.885219f , 0.421533f ,
-0.164062f , -0.929688f , 0.632812f , 0.196715f , -0.885219f , 0.421533f ,
--0.164062f , -0.929688f , 0.632812f , -0.196715f , -0.885219f , 0.421533f ,
--0.234375f , -0.914062f , 0.632812f , -0.196715f , -0.885219f , 0.421533f ,
--0.328125f , -0.945312f , 0.523437f , -0.196715f , -0.885219f , 0.421533f ,
-0.367188f , -0.890625f , 0.531250f , 0.548630f , -0.488780f , 0.678306f ,
-0.265625f , -0.820312f , 0.664062f , 0.548630f , -0.488780f , 0.678306f ,
-0.328125f , -0.945312f , 0.523437f , 0.548630f , -0.488780f , 0.678306f ,
--0.234375f , -0.914062f , 0.632812f , -0.623035f , -0.426287f , 0.655826f ,
--0.265625f , -0.820312f , 0.664062f , -0.623035f , -0.426287f , 0.655826f ,
--0.328125f , -0.945312f , 0.523437f , -0.623035f , -0.426287f , 0.655826f ,
-0.351562f , -0.695312f , 0.570312f , 0.756147f , -0.069645f , 0.650685f ,
-0.250000f , -0.703125f , 0.687500f , 0.756147f , -0.069645f , 0.650685f ,
-0.367188f , -0.890625f , 0.531250f , 0.756147f , -0.069645f , 0.650685f ,
--0.265625f , -0.820312f , 0.664062f , -0.789793f , -0.017320f , 0.613129f ,
--0.250000f , -0.703125f , 0.687500f , -0.789793f , -0.017320f , 0.613129f ,
--0.367188f , -0.890625f , 0.531250f , -0.789793f , -0.017320f , 0.613129f ,
-0.312500f , -0.437500f , 0.570312f , 0.801465f , 0.121434f , 0.585582f ,
-0.210938f , -0.445313f , 0.710938f , 0.801465f , 0.121434f , 0.585582f ,
-0.351562f , -0.695312f , 0.570312f , 0.801465f , 0.121434f , 0.585582f ,
--0.250000f , -0.703125f , 0.687500f , -0.752771f , 0.054417f , 0.656029f ,
--0.210938f , -0.445313f , 0.710938f , -0.752771f , 0.054417f , 0.656029f ,
--0.351562f , -0.695312f , 0.570312f , -0.752771f , 0.054417f , 0.656029f ,
-0.203125f , -0.187500f , 0.562500f , 0.229854f , -0.896039f , 0.379843f ,
-0.437500f , -0.140625f , 0.531250f , 0.229854f , -0.896039f , 0.379843f ,
-0.125000f , -0.101563f , 0.812500f , 0.229854f , -0.896039f , 0.379843f ,
--0.398438f , -0.046875f , 0.671875f , -0.435894f , -0.688253f , 0.579917f ,
--0.437500f , -0.140625f , 0.531250f , -0.435894f , -0.688253f , 0.579917f ,
--0.125000f , -0.101563f , 0.812500f , -0.435894f , -0.688253f , 0.579917f ,
-0.437500f , -0.140625f , 0.531250f , 0.292803f , -0.619134f , 0.728656f ,
-0.632812f , -0.039063f , 0.539062f , 0.292803f , -0.619134f , 0.728656f ,
-0.617188f , 0.054687f , 0.625000f , 0.292803f , -0.619134f , 0.728656f ,
--0.617188f , 0.054687f , 0.625000f , -0.292803f , -0.619134f , 0.728656f ,
--0.632812f , -0.039063f , 0.539062f , -0.292803f , -0.619134f , 0.728656f ,
--0.437500f , -0.140625f , 0.531250f , -0.292803f , -0.619134f , 0.728656f ,
-0.632812f , -0.039063f , 0.539062f , 0.689086f , -0.423923f , 0.587750f ,
-0.828125f , 0.148437f , 0.445312f , 0.689086f , -0.423923f , 0.587750f ,
-0.617188f , 0.054687f , 0.625000f , 0.689086f , -0.423923f , 0.587750f ,
--0.726562f , 0.203125f , 0.601562f , -0.689836f , -0.414590f , 0.593500f ,
--0.828125f , 0.148437f , 0.445312f , -0.689836f , -0.414590f , 0.593500f ,
--0.617188f , 0.054687f , 0.625000f , -0.689836f , -0.414590f , 0.593500f ,
-0.828125f , 0.148437f , 0.445312f , 0.572975f , -0.431433f , 0.696825f ,
-0.859375f , 0.429687f , 0.593750f , 0.572975f , -0.431433f , 0.696825f ,
-0.742188f , 0.375000f , 0.656250f , 0.572975f , -0.431433f , 0.696825f ,
--0.742188f , 0.375000f , 0.656250f , -0.572975f , -0.431433f , 0.696825f ,
--0.859375f , 0.429687f , 0.593750f , -0.572975f , -0.431433f , 0.696825f ,
--0.828125f , 0.148437f , 0.445312f , -0.572975f , -0.431433f , 0.696825f ,
-0.859375f , 0.429687f , 0.593750f , 0.386059f , 0.714362f , 0.583649f ,
-0.710938f , 0.484375f , 0.625000f , 0.386059f , 0.714362f , 0.583649f ,
-0.687500f , 0.414062f , 0.726562f , 0.386059f , 0.714362f , 0.583649f ,
--0.687500f , 0.414062f , 0.726562f , -0.386059f , 0.714362f , 0.583649f ,
--0.710938f , 0.484375f , 0.625000f , -0.386059f , 0.714362f , 0.583649f ,
--0.859375f , 0.429687f , 0.593750f , -0.386059f , 0.714362f , 0.583649f ,
-0.710938f , 0.484375f , 0.625000f , 0.507932f , 0.641599f , 0.574766f ,
-0.492188f , 0.601562f , 0.687500f , 0.507932f , 0.641599f , 0.574766f ,
-0.437500f , 0.546875f , 0.796875f , 0.507932f , 0.641599f , 0.574766f ,
--0.437500f , 0.546875f , 0.796875f , -0.507932f , 0.641599f , 0.574766f ,
--0.492188f , 0.601562f , 0.687500f , -0.507932f , 0.641599f , 0.574766f ,
--0.710938f , 0.484375f , 0.625000f , -0.507932f , 0.641599f , 0.574766f ,
-0.492188f , 0.601562f , 0.687500f , 0.630433f , 0.520792f , 0.575613f ,
-0.320312f , 0.757812f , 0.734375f , 0.630433f , 0.520792f , 0.575613f ,
-0.437500f , 0.546875f , 0.796875f , 0.630433f , 0.520792f , 0.575613f ,
--0.312500f , 0.640625f , 0.835938f , -0.581007f , 0.510582f , 0.633827f ,
--0.320312f , 0.757812f , 0.734375f , -0.581007f , 0.510582f , 0.633827f ,
--0.437500f , 0.546875f , 0.796875f , -0.581007f , 0.510582f , 0.633827f ,
-0.320312f , 0.757812f , 0.734375f , -0.051675f , 0.664392f , 0.745596f ,
-0.156250f , 0.718750f , 0.757813f , -0.051675f , 0.664392f , 0.745596f ,
-0.203125f , 0.617187f , 0.851562f , -0.051675f , 0.664392f , 0.745596f ,
--0.203125f , 0.617187f , 0.851562f , 0.051675f , 0.664392f , 0.745596f ,
--0.156250f , 0.718750f , 0.757813f , 0.051675f , 0.664392f , 0.745596f ,
--0.320312f , 0.757812f , 0.734375f , 0.051675f , 0.664392f , 0.745596f ,
-0.156250f , 0.718750f , 0.757813f , -0.787931f , 0.307647f , 0.533403f ,
-0.062500f , 0.492187f , 0.750000f , -0.787931f , 0.307647f , 0.533403f ,
-0.101562f , 0.429687f , 0.843750f , -0.787931f , 0.307647f , 0.533403f ,
--0.101562f , 0.429687f , 0.843750f , 0.787931f , 0.307647f , 0.533403f ,
--0.062500f , 0.492187f , 0.750000f , 0.787931f , 0.307647f , 0.533403f ,
--0.156250f , 0.718750f , 0.757813f , 0.787931f , 0.307647f , 0.533403f ,
-0.062500f , 0.492187f , 0.750000f , -0.622543f , 0.553372f , 0.553372f ,
-0.000000f , 0.429687f , 0.742188f , -0.622543f , 0.553372f , 0.553372f ,
-0.000000f , 0.351562f , 0.820312f , -0.622543f , 0.553372f , 0.553372f ,
-0.000000f , 0.351562f , 0.820312f , 0.622543f , 0.553372f , 0.553372f ,
-0.000000f , 0.429687f , 0.742188f , 0.622543f , 0.553372f , 0.553372f ,
--0.062500f , 0.492187f , 0.750000f , 0.622543f , 0.553372f , 0.553372f ,
-0.164062f , 0.414062f , 0.773438f , 0.401601f , -0.395017f , 0.826244f ,
-0.250000f , 0.468750f , 0.757812f , 0.401601f , -0.395017f , 0.826244f ,
-0.203125f , 0.617187f , 0.851562f , 0.401601f , -0.395017f , 0.826244f ,
--0.203125f , 0.617187f , 0.851562f , -0.401601f , -0.395017f , 0.826244f ,
--0.250000f , 0.468750f , 0.757812f , -0.401601f , -0.395017f , 0.826244f ,
--0.164062f , 0.414062f , 0.773438f , -0.401601f , -0.395017f , 0.826244f ,
-0.250000f , 0.468750f , 0.757812f , 0.218052f , -0.470992f , 0.854763f ,
-0.328125f , 0.476562f , 0.742188f , 0.218052f , -0.470992f , 0.854763f ,
-0.203125f , 0.617187f , 0.851562f , 0.218052f , -0.470992f , 0.854763f ,
--0.312500f , 0.640625f , 0.835938f , -0.222422f , -0.467656f , 0.855468f ,
--0.328125f , 0.476562f , 0.742188f , -0.222422f , -0.467656f , 0.855468f ,
--0.203125f , 0.617187f , 0.851562f , -0.222422f , -0.467656f , 0.855468f ,
-0.429688f , 0.437500f , 0.718750f , -0.171076f , -0.564549f , 0.807476f ,
-0.437500f , 0.546875f , 0.796875f , -0.171076f , -0.564549f , 0.807476f ,
-0.312500f , 0.640625f , 0.835938f , -0.171076f , -0.564549f , 0.807476f ,
--0.312500f , 0.640625f , 0.835938f , 0.171076f , -0.564549f , 0.807476f ,
--0.437500f , 0.546875f , 0.796875f , 0.171076f , -0.564549f , 0.807476f ,
--0.429688f , 0.437500f , 0.718750f , 0.171076f , -0.564549f , 0.807476f ,
-0.601562f , 0.375000f , 0.664062f , -0.180308f , -0.703398f , 0.687547f ,
-0.687500f , 0.414062f , 0.726562f , -0.180308f , -0.703398f , 0.687547f ,
-0.437500f , 0.546875f , 0.796875f , -0.180308f , -0.703398f , 0.687547f ,
--0.437500f , 0.546875f , 0.796875f , 0.180308f , -0.703398f , 0.687547f ,
--0.687500f , 0.414062f , 0.726562f , 0.180308f , -0.703398f , 0.687547f ,
--0.601562f , 0.375000f , 0.664062f , 0.180308f , -0.703398f , 0.687547f ,
-0.640625f , 0.296875f , 0.648438f , 0.420679f , -0.613696f , 0.668137f ,
-0.742188f , 0.375000f , 0.656250f , 0.420679f , -0.613696f , 0.668137f ,
-0.687500f , 0.414062f , 0.726562f , 0.420679f , -0.613696f , 0.668137f ,
--0.687500f , 0.414062f , 0.726562f , -0.420679f , -0.613696f , 0.668137f ,
--0.742188f , 0.375000f , 0.656250f , -0.420679f , -0.613696f , 0.668137f ,
--0.640625f , 0.296875f , 0.648438f , -0.420679f , -0.613696f , 0.668137f ,
-0.625000f , 0.187500f , 0.648438f , 0.437336f , -0.308531f , 0.844717f ,
-0.726562f , 0.203125f , 0.601562f , 0.437336f , -0.308531f , 0.844717f ,
-0.742188f , 0.375000f , 0.656250f , 0.437336f , -0.308531f , 0.844717f ,
--0.742188f , 0.375000f , 0.656250f , -0.437336f , -0.308531f , 0.844717f ,
--0.726562f , 0.203125f , 0.601562f , -0.437336f , -0.308531f , 0.844717f ,
--0.625000f , 0.187500f , 0.648438f , -0.437336f , -0.308531f , 0.844717f ,
-0.492188f , 0.062500f , 0.671875f , 0.343363f , -0.105650f , 0.933242f ,
-0.617188f , 0.054687f , 0.625000f , 0.343363f , -0.105650f , 0.933242f ,
-0.726562f , 0.203125f , 0.601562f , 0.343363f , -0.105650f , 0.933242f ,
--0.726562f , 0.203125f , 0.601562f , -0.343363f , -0.105650f , 0.933242f ,
--0.617188f , 0.054687f , 0.625000f , -0.343363f , -0.105650f , 0.933242f ,
--0.492188f , 0.062500f , 0.671875f , -0.343363f , -0.105650f , 0.933242f ,
-0.375000f , 0.015625f , 0.703125f , 0.357888f , -0.306761f , 0.881938f ,
-0.398438f , -0.046875f , 0.671875f , 0.357888f , -0.306761f , 0.881938f ,
-0.492188f , 0.062500f , 0.671875f , 0.357888f , -0.306761f , 0.881938f ,
--0.617188f , 0.054687f , 0.625000f , -0.322277f , -0.276237f , 0.905445f ,
--0.398438f , -0.046875f , 0.671875f , -0.322277f , -0.276237f , 0.905445f ,
--0.492188f , 0.062500f , 0.671875f , -0.322277f , -0.276237f , 0.905445f ,
-0.203125f , 0.093750f , 0.742188f , 0.306946f , 0.211293f , 0.927976f ,
-0.125000f , -0.101563f , 0.812500f , 0.306946f , 0.211293f , 0.927976f ,
-0.375000f , 0.015625f , 0.703125f , 0.306946f , 0.211293f , 0.927976f ,
--0.398438f , -0.046875f , 0.671875f , -0.481543f , -0.240772f , 0.842701f ,
--0.125000f , -0.101563f , 0.812500f , -0.481543f , -0.240772f , 0.842701f ,
--0.375000f , 0.015625f , 0.703125f , -0.481543f , -0.240772f , 0.842701f ,
-0.203125f , 0.093750f , 0.742188f , 0.386906f , 0.171414f , 0.906047f ,
-0.164062f , 0.140625f , 0.750000f , 0.386906f , 0.171414f , 0.906047f ,
-0.125000f , -0.101563f , 0.812500f , 0.386906f , 0.171414f , 0.906047f ,
-0.000000f , 0.046875f , 0.726562f , 0.292159f , 0.282884f , 0.913575f ,
--0.164062f , 0.140625f , 0.750000f , 0.292159f , 0.282884f , 0.913575f ,
--0.125000f , -0.101563f , 0.812500f , 0.292159f , 0.282884f , 0.913575f ,
-0.164062f , 0.414062f , 0.773438f , 0.429933f , -0.721674f , 0.542535f ,
-0.101562f , 0.429687f , 0.843750f , 0.429933f , -0.721674f , 0.542535f ,
-0.000000f , 0.351562f , 0.820312f , 0.429933f , -0.721674f , 0.542535f ,
-0.000000f , 0.351562f , 0.820312f , -0.429933f , -0.721674f , 0.542535f ,
--0.101562f , 0.429687f , 0.843750f , -0.429933f , -0.721674f , 0.542535f ,
--0.164062f , 0.414062f , 0.773438f , -0.429933f , -0.721674f , 0.542535f ,
-0.125000f , 0.304687f , 0.765625f , 0.386342f , -0.044578f , 0.921278f ,
-0.000000f , 0.351562f , 0.820312f , 0.386342f , -0.044578f , 0.921278f ,
-0.132812f , 0.210937f , 0.757812f , 0.386342f , -0.044578f , 0.921278f ,
-0.000000f , 0.210937f , 0.765625f , -0.054742f , -0.361903f , 0.930607f ,
-0.000000f , 0.351562f , 0.820312f , -0.054742f , -0.361903f , 0.930607f ,
--0.132812f , 0.210937f , 0.757812f , -0.054742f , -0.361903f , 0.930607f ,
-0.000000f , 0.046875f , 0.726562f , -0.062564f , -0.137640f , 0.988504f ,
-0.164062f , 0.140625f , 0.750000f , -0.062564f , -0.137640f , 0.988504f ,
-0.132812f , 0.210937f , 0.757812f , -0.062564f , -0.137640f , 0.988504f ,
--0.132812f , 0.210937f , 0.757812f , 0.062564f , -0.137640f , 0.988504f ,
--0.164062f , 0.140625f , 0.750000f , 0.062564f , -0.137640f , 0.988504f ,
-0.000000f , 0.046875f , 0.726562f , 0.062564f , -0.137640f , 0.988504f ,
-0.062500f , -0.882813f , 0.695312f , 0.020355f , -0.783677f , 0.620835f ,
-0.000000f , -0.890625f , 0.687500f , 0.020355f , -0.783677f , 0.620835f ,
-0.164062f , -0.929688f , 0.632812f , 0.020355f , -0.783677f , 0.620835f ,
-0.000000f , -0.945312f , 0.640625f , -0.097666f , -0.647680f , 0.755626f ,
-0.000000f , -0.890625f , 0.687500f , -0.097666f , -0.647680f , 0.755626f ,
--0.164062f , -0.929688f , 0.632812f , -0.097666f , -0.647680f , 0.755626f ,
-0.117188f , -0.835938f , 0.710937f , 0.207390f , -0.518476f , 0.829561f ,
-0.062500f , -0.882813f , 0.695312f , 0.207390f , -0.518476f , 0.829561f ,
-0.234375f , -0.914062f , 0.632812f , 0.207390f , -0.518476f , 0.829561f ,
--0.164062f , -0.929688f , 0.632812f , -0.147043f , -0.661693f , 0.735214f ,
--0.062500f , -0.882813f , 0.695312f , -0.147043f , -0.661693f , 0.735214f ,
--0.234375f , -0.914062f , 0.632812f , -0.147043f , -0.661693f , 0.735214f ,
-0.109375f , -0.718750f , 0.734375f , 0.482516f , -0.140734f , 0.864507f ,
-0.117188f , -0.835938f , 0.710937f , 0.482516f , -0.140734f , 0.864507f ,
-0.234375f , -0.914062f , 0.632812f , 0.482516f , -0.140734f , 0.864507f ,
--0.234375f , -0.914062f , 0.632812f , -0.482516f , -0.140734f , 0.864507f ,
--0.117188f , -0.835938f , 0.710937f , -0.482516f , -0.140734f , 0.864507f ,
--0.109375f , -0.718750f , 0.734375f , -0.482516f , -0.140734f , 0.864507f ,
-0.210938f , -0.445313f , 0.710938f , 0.281888f , -0.044419f , 0.958419f ,
-0.078125f , -0.445313f , 0.750000f , 0.281888f , -0.044419f , 0.958419f ,
-0.250000f , -0.703125f , 0.687500f , 0.281888f , -0.044419f , 0.958419f ,
--0.117188f , -0.687500f , 0.734375f , -0.332048f , -0.007298f , 0.943234f ,
--0.078125f , -0.445313f , 0.750000f , -0.332048f , -0.007298f , 0.943234f ,
--0.250000f , -0.703125f , 0.687500f , -0.332048f , -0.007298f , 0.943234f ,
-0.109375f , -0.718750f , 0.734375f , 0.359533f , -0.089883f , 0.928793f ,
-0.265625f , -0.820312f , 0.664062f , 0.359533f , -0.089883f , 0.928793f ,
-0.117188f , -0.687500f , 0.734375f , 0.359533f , -0.089883f , 0.928793f ,
--0.250000f , -0.703125f , 0.687500f , -0.313971f , -0.145772f , 0.938175f ,
--0.265625f , -0.820312f , 0.664062f , -0.313971f , -0.145772f , 0.938175f ,
--0.117188f , -0.687500f , 0.734375f , -0.313971f , -0.145772f , 0.938175f ,
-0.085938f , -0.289063f , 0.742188f , -0.030222f , 0.066489f , 0.997329f ,
-0.000000f , -0.328125f , 0.742188f , -0.030222f , 0.066489f , 0.997329f ,
-0.000000f , -0.445313f , 0.750000f , -0.030222f , 0.066489f , 0.997329f ,
-0.000000f , -0.445313f , 0.750000f , 0.030222f , 0.066489f , 0.997329f ,
-0.000000f , -0.328125f , 0.742188f , 0.030222f , 0.066489f , 0.997329f ,
--0.085938f , -0.289063f , 0.742188f , 0.030222f , 0.066489f , 0.997329f ,
-0.117188f , -0.687500f , 0.734375f , 0.000000f , -0.064383f , 0.997925f ,
-0.078125f , -0.445313f , 0.750000f , 0.000000f , -0.064383f , 0.997925f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.064383f , 0.997925f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.064383f , 0.997925f ,
--0.078125f , -0.445313f , 0.750000f , 0.000000f , -0.064383f , 0.997925f ,
--0.117188f , -0.687500f , 0.734375f , 0.000000f , -0.064383f , 0.997925f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , 0.000000f , 1.000000f ,
-0.109375f , -0.718750f , 0.734375f , 0.000000f , 0.000000f , 1.000000f ,
-0.117188f , -0.687500f , 0.734375f , 0.000000f , 0.000000f , 1.000000f ,
--0.117188f , -0.687500f , 0.734375f , 0.000000f , 0.000000f , 1.000000f ,
--0.109375f , -0.718750f , 0.734375f , 0.000000f , 0.000000f , 1.000000f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , 0.000000f , 1.000000f ,
-0.125000f , -0.226563f , 0.750000f , 0.847337f , -0.511933f , -0.141223f ,
-0.132812f , -0.226563f , 0.796875f , 0.847337f , -0.511933f , -0.141223f ,
-0.085938f , -0.289063f , 0.742188f , 0.847337f , -0.511933f , -0.141223f ,
--0.093750f , -0.273438f , 0.781250f , -0.744073f , -0.658218f , 0.114473f ,
--0.132812f , -0.226563f , 0.796875f , -0.744073f , -0.658218f , 0.114473f ,
--0.085938f , -0.289063f , 0.742188f , -0.744073f , -0.658218f , 0.114473f ,
-0.101562f , -0.148438f , 0.742188f , 0.944759f , 0.191904f , -0.265713f ,
-0.109375f , -0.132813f , 0.781250f , 0.944759f , 0.191904f , -0.265713f ,
-0.132812f , -0.226563f , 0.796875f , 0.944759f , 0.191904f , -0.265713f ,
--0.132812f , -0.226563f , 0.796875f , -0.944759f , 0.191904f , -0.265713f ,
--0.109375f , -0.132813f , 0.781250f , -0.944759f , 0.191904f , -0.265713f ,
--0.101562f , -0.148438f , 0.742188f , -0.944759f , 0.191904f , -0.265713f ,
-0.000000f , -0.140625f , 0.742188f , 0.098456f , 0.886108f , -0.452900f ,
-0.039062f , -0.125000f , 0.781250f , 0.098456f , 0.886108f , -0.452900f ,
-0.109375f , -0.132813f , 0.781250f , 0.098456f , 0.886108f , -0.452900f ,
--0.109375f , -0.132813f , 0.781250f , -0.098456f , 0.886108f , -0.452900f ,
--0.039062f , -0.125000f , 0.781250f , -0.098456f , 0.886108f , -0.452900f ,
-0.000000f , -0.140625f , 0.742188f , -0.098456f , 0.886108f , -0.452900f ,
-0.000000f , -0.195313f , 0.750000f , -0.854358f , 0.512615f , -0.085436f ,
-0.000000f , -0.187500f , 0.796875f , -0.854358f , 0.512615f , -0.085436f ,
-0.039062f , -0.125000f , 0.781250f , -0.854358f , 0.512615f , -0.085436f ,
--0.039062f , -0.125000f , 0.781250f , 0.854358f , 0.512615f , -0.085436f ,
-0.000000f , -0.187500f , 0.796875f , 0.854358f , 0.512615f , -0.085436f ,
-0.000000f , -0.195313f , 0.750000f , 0.854358f , 0.512615f , -0.085436f ,
-0.000000f , -0.328125f , 0.742188f , 0.398334f , -0.876334f , 0.270867f ,
-0.085938f , -0.289063f , 0.742188f , 0.398334f , -0.876334f , 0.270867f ,
-0.093750f , -0.273438f , 0.781250f , 0.398334f , -0.876334f , 0.270867f ,
--0.093750f , -0.273438f , 0.781250f , -0.398334f , -0.876334f , 0.270867f ,
--0.085938f , -0.289063f , 0.742188f , -0.398334f , -0.876334f , 0.270867f ,
-0.000000f , -0.328125f , 0.742188f , -0.398334f , -0.876334f , 0.270867f ,
-0.000000f , -0.320313f , 0.781250f , 0.287348f , -0.574696f , 0.766261f ,
-0.093750f , -0.273438f , 0.781250f , 0.287348f , -0.574696f , 0.766261f ,
-0.078125f , -0.250000f , 0.804688f , 0.287348f , -0.574696f , 0.766261f ,
--0.078125f , -0.250000f , 0.804688f , -0.287348f , -0.574696f , 0.766261f ,
--0.093750f , -0.273438f , 0.781250f , -0.287348f , -0.574696f , 0.766261f ,
-0.000000f , -0.320313f , 0.781250f , -0.287348f , -0.574696f , 0.766261f ,
-0.000000f , -0.187500f , 0.796875f , -0.781404f , 0.558146f , 0.279073f ,
-0.000000f , -0.203125f , 0.828125f , -0.781404f , 0.558146f , 0.279073f ,
-0.039062f , -0.125000f , 0.781250f , -0.781404f , 0.558146f , 0.279073f ,
--0.046875f , -0.148438f , 0.812500f , 0.520719f , 0.615395f , 0.591726f ,
-0.000000f , -0.203125f , 0.828125f , 0.520719f , 0.615395f , 0.591726f ,
--0.039062f , -0.125000f , 0.781250f , 0.520719f , 0.615395f , 0.591726f ,
-0.039062f , -0.125000f , 0.781250f , 0.089712f , 0.807410f , 0.583130f ,
-0.046875f , -0.148438f , 0.812500f , 0.089712f , 0.807410f , 0.583130f ,
-0.109375f , -0.132813f , 0.781250f , 0.089712f , 0.807410f , 0.583130f ,
--0.093750f , -0.156250f , 0.812500f , -0.127000f , 0.762001f , 0.635001f ,
--0.046875f , -0.148438f , 0.812500f , -0.127000f , 0.762001f , 0.635001f ,
--0.109375f , -0.132813f , 0.781250f , -0.127000f , 0.762001f , 0.635001f ,
-0.109375f , -0.132813f , 0.781250f , 0.745356f , 0.298142f , 0.596285f ,
-0.093750f , -0.156250f , 0.812500f , 0.745356f , 0.298142f , 0.596285f ,
-0.109375f , -0.226563f , 0.828125f , 0.745356f , 0.298142f , 0.596285f ,
--0.109375f , -0.226563f , 0.828125f , -0.745356f , 0.298142f , 0.596285f ,
--0.093750f , -0.156250f , 0.812500f , -0.745356f , 0.298142f , 0.596285f ,
--0.109375f , -0.132813f , 0.781250f , -0.745356f , 0.298142f , 0.596285f ,
-0.132812f , -0.226563f , 0.796875f , 0.604551f , -0.654930f , 0.453413f ,
-0.109375f , -0.226563f , 0.828125f , 0.604551f , -0.654930f , 0.453413f ,
-0.093750f , -0.273438f , 0.781250f , 0.604551f , -0.654930f , 0.453413f ,
--0.078125f , -0.250000f , 0.804688f , 0.000000f , -0.707107f , 0.707107f ,
--0.109375f , -0.226563f , 0.828125f , 0.000000f , -0.707107f , 0.707107f ,
--0.093750f , -0.273438f , 0.781250f , 0.000000f , -0.707107f , 0.707107f ,
-0.000000f , -0.203125f , 0.828125f , 0.048634f , 0.226961f , 0.972689f ,
-0.109375f , -0.226563f , 0.828125f , 0.048634f , 0.226961f , 0.972689f ,
-0.093750f , -0.156250f , 0.812500f , 0.048634f , 0.226961f , 0.972689f ,
--0.093750f , -0.156250f , 0.812500f , -0.048634f , 0.226961f , 0.972689f ,
--0.109375f , -0.226563f , 0.828125f , -0.048634f , 0.226961f , 0.972689f ,
-0.000000f , -0.203125f , 0.828125f , -0.048634f , 0.226961f , 0.972689f ,
-0.000000f , -0.203125f , 0.828125f , -0.056293f , -0.262700f , 0.963234f ,
-0.000000f , -0.289063f , 0.804688f , -0.056293f , -0.262700f , 0.963234f ,
-0.109375f , -0.226563f , 0.828125f , -0.056293f , -0.262700f , 0.963234f ,
--0.078125f , -0.250000f , 0.804688f , -0.428571f , -0.857143f , 0.285714f ,
-0.000000f , -0.289063f , 0.804688f , -0.428571f , -0.857143f , 0.285714f ,
--0.109375f , -0.226563f , 0.828125f , -0.428571f , -0.857143f , 0.285714f ,
-0.000000f , -0.140625f , 0.742188f , 0.006388f , 0.083044f , 0.996525f ,
-0.101562f , -0.148438f , 0.742188f , 0.006388f , 0.083044f , 0.996525f ,
-0.000000f , 0.046875f , 0.726562f , 0.006388f , 0.083044f , 0.996525f ,
--0.125000f , -0.101563f , 0.812500f , 0.781795f , -0.366157f , 0.504703f ,
--0.101562f , -0.148438f , 0.742188f , 0.781795f , -0.366157f , 0.504703f ,
-0.000000f , 0.046875f , 0.726562f , 0.781795f , -0.366157f , 0.504703f ,
-0.101562f , -0.148438f , 0.742188f , -0.872872f , -0.218218f , 0.436436f ,
-0.125000f , -0.226563f , 0.750000f , -0.872872f , -0.218218f , 0.436436f ,
-0.125000f , -0.101563f , 0.812500f , -0.872872f , -0.218218f , 0.436436f ,
--0.164062f , -0.242188f , 0.710938f , -0.581914f , -0.363697f , 0.727393f ,
--0.125000f , -0.226563f , 0.750000f , -0.581914f , -0.363697f , 0.727393f ,
--0.125000f , -0.101563f , 0.812500f , -0.581914f , -0.363697f , 0.727393f ,
-0.125000f , -0.226563f , 0.750000f , 0.243483f , -0.268670f , 0.931951f ,
-0.085938f , -0.289063f , 0.742188f , 0.243483f , -0.268670f , 0.931951f ,
-0.179688f , -0.312500f , 0.710938f , 0.243483f , -0.268670f , 0.931951f ,
--0.179688f , -0.312500f , 0.710938f , -0.243483f , -0.268670f , 0.931951f ,
--0.085938f , -0.289063f , 0.742188f , -0.243483f , -0.268670f , 0.931951f ,
--0.125000f , -0.226563f , 0.750000f , -0.243483f , -0.268670f , 0.931951f ,
-0.085938f , -0.289063f , 0.742188f , 0.282005f , 0.033841f , 0.958816f ,
-0.078125f , -0.445313f , 0.750000f , 0.282005f , 0.033841f , 0.958816f ,
-0.210938f , -0.445313f , 0.710938f , 0.282005f , 0.033841f , 0.958816f ,
--0.210938f , -0.445313f , 0.710938f , -0.282005f , 0.033841f , 0.958816f ,
--0.078125f , -0.445313f , 0.750000f , -0.282005f , 0.033841f , 0.958816f ,
--0.085938f , -0.289063f , 0.742188f , -0.282005f , 0.033841f , 0.958816f ,
-0.312500f , -0.437500f , 0.570312f , 0.816497f , 0.408248f , 0.408248f ,
-0.257812f , -0.312500f , 0.554688f , 0.816497f , 0.408248f , 0.408248f ,
-0.179688f , -0.312500f , 0.710938f , 0.816497f , 0.408248f , 0.408248f ,
--0.179688f , -0.312500f , 0.710938f , -0.816497f , 0.408248f , 0.408248f ,
--0.257812f , -0.312500f , 0.554688f , -0.816497f , 0.408248f , 0.408248f ,
--0.312500f , -0.437500f , 0.570312f , -0.816497f , 0.408248f , 0.408248f ,
-0.257812f , -0.312500f , 0.554688f , 0.868220f , 0.325582f , 0.374420f ,
-0.234375f , -0.250000f , 0.554688f , 0.868220f , 0.325582f , 0.374420f ,
-0.164062f , -0.242188f , 0.710938f , 0.868220f , 0.325582f , 0.374420f ,
--0.164062f , -0.242188f , 0.710938f , -0.868220f , 0.325582f , 0.374420f ,
--0.234375f , -0.250000f , 0.554688f , -0.868220f , 0.325582f , 0.374420f ,
--0.257812f , -0.312500f , 0.554688f , -0.868220f , 0.325582f , 0.374420f ,
-0.203125f , -0.187500f , 0.562500f , 0.893156f , 0.430173f , 0.131239f ,
-0.125000f , -0.101563f , 0.812500f , 0.893156f , 0.430173f , 0.131239f ,
-0.234375f , -0.250000f , 0.554688f , 0.893156f , 0.430173f , 0.131239f ,
--0.164062f , -0.242188f , 0.710938f , -0.910178f , -0.044591f , 0.411810f ,
--0.125000f , -0.101563f , 0.812500f , -0.910178f , -0.044591f , 0.411810f ,
--0.234375f , -0.250000f , 0.554688f , -0.910178f , -0.044591f , 0.411810f ,
-0.109375f , -0.718750f , 0.734375f , 0.357930f , -0.835170f , 0.417585f ,
-0.000000f , -0.765625f , 0.734375f , 0.357930f , -0.835170f , 0.417585f ,
-0.000000f , -0.773438f , 0.718750f , 0.357930f , -0.835170f , 0.417585f ,
-0.000000f , -0.773438f , 0.718750f , -0.357930f , -0.835170f , 0.417585f ,
-0.000000f , -0.765625f , 0.734375f , -0.357930f , -0.835170f , 0.417585f ,
--0.109375f , -0.718750f , 0.734375f , -0.357930f , -0.835170f , 0.417585f ,
-0.117188f , -0.835938f , 0.710937f , -0.135319f , -0.202979f , 0.969788f ,
-0.109375f , -0.718750f , 0.734375f , -0.135319f , -0.202979f , 0.969788f ,
-0.093750f , -0.820313f , 0.710937f , -0.135319f , -0.202979f , 0.969788f ,
--0.093750f , -0.742188f , 0.726562f , 0.192450f , -0.192450f , 0.962250f ,
--0.109375f , -0.718750f , 0.734375f , 0.192450f , -0.192450f , 0.962250f ,
--0.093750f , -0.820313f , 0.710937f , 0.192450f , -0.192450f , 0.962250f ,
-0.062500f , -0.882813f , 0.695312f , -0.356915f , 0.107075f , 0.927980f ,
-0.117188f , -0.835938f , 0.710937f , -0.356915f , 0.107075f , 0.927980f ,
-0.046875f , -0.867188f , 0.687500f , -0.356915f , 0.107075f , 0.927980f ,
--0.093750f , -0.820313f , 0.710937f , 0.188144f , -0.282216f , 0.940721f ,
--0.117188f , -0.835938f , 0.710937f , 0.188144f , -0.282216f , 0.940721f ,
--0.046875f , -0.867188f , 0.687500f , 0.188144f , -0.282216f , 0.940721f ,
-0.000000f , -0.890625f , 0.687500f , -0.124035f , 0.000000f , 0.992278f ,
-0.062500f , -0.882813f , 0.695312f , -0.124035f , 0.000000f , 0.992278f ,
-0.000000f , -0.875000f , 0.687500f , -0.124035f , 0.000000f , 0.992278f ,
--0.046875f , -0.867188f , 0.687500f , 0.065512f , 0.393073f , 0.917171f ,
--0.062500f , -0.882813f , 0.695312f , 0.065512f , 0.393073f , 0.917171f ,
-0.000000f , -0.875000f , 0.687500f , 0.065512f , 0.393073f , 0.917171f ,
-0.000000f , -0.875000f , 0.687500f , -0.158235f , 0.949410f , 0.271261f ,
-0.046875f , -0.867188f , 0.687500f , -0.158235f , 0.949410f , 0.271261f ,
-0.046875f , -0.851562f , 0.632812f , -0.158235f , 0.949410f , 0.271261f ,
--0.046875f , -0.851562f , 0.632812f , 0.158235f , 0.949410f , 0.271261f ,
--0.046875f , -0.867188f , 0.687500f , 0.158235f , 0.949410f , 0.271261f ,
-0.000000f , -0.875000f , 0.687500f , 0.158235f , 0.949410f , 0.271261f ,
-0.046875f , -0.867188f , 0.687500f , -0.739600f , 0.647150f , 0.184901f ,
-0.093750f , -0.820313f , 0.710937f , -0.739600f , 0.647150f , 0.184901f ,
-0.046875f , -0.851562f , 0.632812f , -0.739600f , 0.647150f , 0.184901f ,
--0.093750f , -0.812500f , 0.640625f , 0.646159f , 0.758535f , 0.084282f ,
--0.093750f , -0.820313f , 0.710937f , 0.646159f , 0.758535f , 0.084282f ,
--0.046875f , -0.851562f , 0.632812f , 0.646159f , 0.758535f , 0.084282f ,
-0.093750f , -0.820313f , 0.710937f , -1.000000f , -0.000000f , 0.000000f ,
-0.093750f , -0.742188f , 0.726562f , -1.000000f , -0.000000f , 0.000000f ,
-0.093750f , -0.812500f , 0.640625f , -1.000000f , -0.000000f , 0.000000f ,
--0.093750f , -0.750000f , 0.664062f , 1.000000f , -0.000000f , 0.000000f ,
--0.093750f , -0.742188f , 0.726562f , 1.000000f , -0.000000f , 0.000000f ,
--0.093750f , -0.812500f , 0.640625f , 1.000000f , -0.000000f , 0.000000f ,
-0.093750f , -0.742188f , 0.726562f , 0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.773438f , 0.718750f , 0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.781250f , 0.656250f , 0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.781250f , 0.656250f , -0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.773438f , 0.718750f , -0.305141f , -0.944953f , 0.118118f ,
--0.093750f , -0.742188f , 0.726562f , -0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.781250f , 0.656250f , 0.015962f , -0.287311f , 0.957704f ,
-0.000000f , -0.859375f , 0.632812f , 0.015962f , -0.287311f , 0.957704f ,
-0.093750f , -0.750000f , 0.664062f , 0.015962f , -0.287311f , 0.957704f ,
--0.046875f , -0.851562f , 0.632812f , -0.052632f , -0.315789f , 0.947368f ,
-0.000000f , -0.859375f , 0.632812f , -0.052632f , -0.315789f , 0.947368f ,
--0.093750f , -0.750000f , 0.664062f , -0.052632f , -0.315789f , 0.947368f ,
-0.093750f , -0.750000f , 0.664062f , 0.135293f , -0.347895f , 0.927720f ,
-0.046875f , -0.851562f , 0.632812f , 0.135293f , -0.347895f , 0.927720f ,
-0.093750f , -0.812500f , 0.640625f , 0.135293f , -0.347895f , 0.927720f ,
--0.093750f , -0.812500f , 0.640625f , -0.135293f , -0.347895f , 0.927720f ,
--0.046875f , -0.851562f , 0.632812f , -0.135293f , -0.347895f , 0.927720f ,
--0.093750f , -0.750000f , 0.664062f , -0.135293f , -0.347895f , 0.927720f ,
-0.132812f , 0.210937f , 0.757812f , -0.448143f , -0.293016f , 0.844577f ,
-0.164062f , 0.140625f , 0.750000f , -0.448143f , -0.293016f , 0.844577f ,
-0.171875f , 0.218750f , 0.781250f , -0.448143f , -0.293016f , 0.844577f ,
--0.187500f , 0.156250f , 0.773438f , 0.598986f , -0.245040f , 0.762346f ,
--0.164062f , 0.140625f , 0.750000f , 0.598986f , -0.245040f , 0.762346f ,
--0.171875f , 0.218750f , 0.781250f , 0.598986f , -0.245040f , 0.762346f ,
-0.125000f , 0.304687f , 0.765625f , -0.286864f , -0.103271f , 0.952389f ,
-0.132812f , 0.210937f , 0.757812f , -0.286864f , -0.103271f , 0.952389f ,
-0.179688f , 0.296875f , 0.781250f , -0.286864f , -0.103271f , 0.952389f ,
--0.171875f , 0.218750f , 0.781250f , 0.521443f , 0.052144f , 0.851691f ,
--0.132812f , 0.210937f , 0.757812f , 0.521443f , 0.052144f , 0.851691f ,
--0.179688f , 0.296875f , 0.781250f , 0.521443f , 0.052144f , 0.851691f ,
-0.164062f , 0.414062f , 0.773438f , -0.270910f , 0.028025f , 0.962197f ,
-0.125000f , 0.304687f , 0.765625f , -0.270910f , 0.028025f , 0.962197f ,
-0.179688f , 0.296875f , 0.781250f , -0.270910f , 0.028025f , 0.962197f ,
--0.179688f , 0.296875f , 0.781250f , 0.270910f , 0.028025f , 0.962197f ,
--0.125000f , 0.304687f , 0.765625f , 0.270910f , 0.028025f , 0.962197f ,
--0.164062f , 0.414062f , 0.773438f , 0.270910f , 0.028025f , 0.962197f ,
-0.164062f , 0.140625f , 0.750000f , -0.577350f , -0.577350f , 0.577350f ,
-0.203125f , 0.093750f , 0.742188f , -0.577350f , -0.577350f , 0.577350f ,
-0.226562f , 0.109375f , 0.781250f , -0.577350f , -0.577350f , 0.577350f ,
--0.226562f , 0.109375f , 0.781250f , 0.577350f , -0.577350f , 0.577350f ,
--0.203125f , 0.093750f , 0.742188f , 0.577350f , -0.577350f , 0.577350f ,
--0.164062f , 0.140625f , 0.750000f , 0.577350f , -0.577350f , 0.577350f ,
-0.203125f , 0.093750f , 0.742188f , -0.265483f , -0.829636f , 0.491144f ,
-0.375000f , 0.015625f , 0.703125f , -0.265483f , -0.829636f , 0.491144f ,
-0.226562f , 0.109375f , 0.781250f , -0.265483f , -0.829636f , 0.491144f ,
--0.375000f , 0.062500f , 0.742188f , 0.000000f , -0.640184f , 0.768221f ,
--0.375000f , 0.015625f , 0.703125f , 0.000000f , -0.640184f , 0.768221f ,
--0.226562f , 0.109375f , 0.781250f , 0.000000f , -0.640184f , 0.768221f ,
-0.375000f , 0.015625f , 0.703125f , 0.418605f , -0.581395f , 0.697674f ,
-0.492188f , 0.062500f , 0.671875f , 0.418605f , -0.581395f , 0.697674f ,
-0.375000f , 0.062500f , 0.742188f , 0.418605f , -0.581395f , 0.697674f ,
--0.476562f , 0.101562f , 0.718750f , -0.397220f , -0.635553f , 0.662034f ,
--0.492188f , 0.062500f , 0.671875f , -0.397220f , -0.635553f , 0.662034f ,
--0.375000f , 0.062500f , 0.742188f , -0.397220f , -0.635553f , 0.662034f ,
-0.492188f , 0.062500f , 0.671875f , 0.591414f , -0.511493f , 0.623382f ,
-0.625000f , 0.187500f , 0.648438f , 0.591414f , -0.511493f , 0.623382f ,
-0.476562f , 0.101562f , 0.718750f , 0.591414f , -0.511493f , 0.623382f ,
--0.578125f , 0.195312f , 0.679688f , -0.516784f , -0.214514f , 0.828805f ,
--0.625000f , 0.187500f , 0.648438f , -0.516784f , -0.214514f , 0.828805f ,
--0.476562f , 0.101562f , 0.718750f , -0.516784f , -0.214514f , 0.828805f ,
-0.625000f , 0.187500f , 0.648438f , 0.544023f , -0.077718f , 0.835464f ,
-0.640625f , 0.296875f , 0.648438f , 0.544023f , -0.077718f , 0.835464f ,
-0.578125f , 0.195312f , 0.679688f , 0.544023f , -0.077718f , 0.835464f ,
--0.585938f , 0.289062f , 0.687500f , -0.588227f , -0.115717f , 0.800374f ,
--0.640625f , 0.296875f , 0.648438f , -0.588227f , -0.115717f , 0.800374f ,
--0.578125f , 0.195312f , 0.679688f , -0.588227f , -0.115717f , 0.800374f ,
-0.640625f , 0.296875f , 0.648438f , 0.573167f , 0.124602f , 0.809910f ,
-0.601562f , 0.375000f , 0.664062f , 0.573167f , 0.124602f , 0.809910f ,
-0.562500f , 0.351562f , 0.695312f , 0.573167f , 0.124602f , 0.809910f ,
--0.562500f , 0.351562f , 0.695312f , -0.573167f , 0.124602f , 0.809910f ,
--0.601562f , 0.375000f , 0.664062f , -0.573167f , 0.124602f , 0.809910f ,
--0.640625f , 0.296875f , 0.648438f , -0.573167f , 0.124602f , 0.809910f ,
-0.601562f , 0.375000f , 0.664062f , 0.434745f , 0.702281f , 0.563736f ,
-0.429688f , 0.437500f , 0.718750f , 0.434745f , 0.702281f , 0.563736f ,
-0.421875f , 0.398437f , 0.773438f , 0.434745f , 0.702281f , 0.563736f ,
--0.421875f , 0.398437f , 0.773438f , -0.434745f , 0.702281f , 0.563736f ,
--0.429688f , 0.437500f , 0.718750f , -0.434745f , 0.702281f , 0.563736f ,
--0.601562f , 0.375000f , 0.664062f , -0.434745f , 0.702281f , 0.563736f ,
-0.429688f , 0.437500f , 0.718750f , 0.406303f , 0.715093f , 0.568824f ,
-0.328125f , 0.476562f , 0.742188f , 0.406303f , 0.715093f , 0.568824f ,
-0.421875f , 0.398437f , 0.773438f , 0.406303f , 0.715093f , 0.568824f ,
--0.335938f , 0.429687f , 0.757812f , 0.061285f , 0.306426f , 0.949920f ,
--0.328125f , 0.476562f , 0.742188f , 0.061285f , 0.306426f , 0.949920f ,
--0.421875f , 0.398437f , 0.773438f , 0.061285f , 0.306426f , 0.949920f ,
-0.328125f , 0.476562f , 0.742188f , 0.152410f , 0.335302f , 0.929701f ,
-0.250000f , 0.468750f , 0.757812f , 0.152410f , 0.335302f , 0.929701f ,
-0.335938f , 0.429687f , 0.757812f , 0.152410f , 0.335302f , 0.929701f ,
--0.273438f , 0.421875f , 0.773438f , -0.177192f , 0.389823f , 0.903682f ,
--0.250000f , 0.468750f , 0.757812f , -0.177192f , 0.389823f , 0.903682f ,
--0.335938f , 0.429687f , 0.757812f , -0.177192f , 0.389823f , 0.903682f ,
-0.250000f , 0.468750f , 0.757812f , -0.021878f , 0.306290f , 0.951687f ,
-0.164062f , 0.414062f , 0.773438f , -0.021878f , 0.306290f , 0.951687f ,
-0.273438f , 0.421875f , 0.773438f , -0.021878f , 0.306290f , 0.951687f ,
--0.210938f , 0.375000f , 0.781250f , 0.012939f , 0.181147f , 0.983371f ,
--0.164062f , 0.414062f , 0.773438f , 0.012939f , 0.181147f , 0.983371f ,
--0.273438f , 0.421875f , 0.773438f , 0.012939f , 0.181147f , 0.983371f ,
-0.273438f , 0.421875f , 0.773438f , 0.280430f , -0.218112f , 0.934765f ,
-0.210938f , 0.375000f , 0.781250f , 0.280430f , -0.218112f , 0.934765f ,
-0.281250f , 0.398437f , 0.765625f , 0.280430f , -0.218112f , 0.934765f ,
--0.234375f , 0.359375f , 0.757812f , -0.355266f , -0.573890f , 0.737859f ,
--0.210938f , 0.375000f , 0.781250f , -0.355266f , -0.573890f , 0.737859f ,
--0.281250f , 0.398437f , 0.765625f , -0.355266f , -0.573890f , 0.737859f ,
-0.335938f , 0.429687f , 0.757812f , 0.266679f , -0.304776f , 0.914327f ,
-0.273438f , 0.421875f , 0.773438f , 0.266679f , -0.304776f , 0.914327f ,
-0.335938f , 0.406250f , 0.750000f , 0.266679f , -0.304776f , 0.914327f ,
--0.281250f , 0.398437f , 0.765625f , -0.296334f , -0.211667f , 0.931334f ,
--0.273438f , 0.421875f , 0.773438f , -0.296334f , -0.211667f , 0.931334f ,
--0.335938f , 0.406250f , 0.750000f , -0.296334f , -0.211667f , 0.931334f ,
-0.421875f , 0.398437f , 0.773438f , -0.276289f , -0.303918f , 0.911755f ,
-0.335938f , 0.429687f , 0.757812f , -0.276289f , -0.303918f , 0.911755f ,
-0.335938f , 0.406250f , 0.750000f , -0.276289f , -0.303918f , 0.911755f ,
--0.335938f , 0.406250f , 0.750000f , 0.276289f , -0.303918f , 0.911755f ,
--0.335938f , 0.429687f , 0.757812f , 0.276289f , -0.303918f , 0.911755f ,
--0.421875f , 0.398437f , 0.773438f , 0.276289f , -0.303918f , 0.911755f ,
-0.562500f , 0.351562f , 0.695312f , -0.116248f , -0.929981f , 0.348743f ,
-0.421875f , 0.398437f , 0.773438f , -0.116248f , -0.929981f , 0.348743f ,
-0.414062f , 0.390625f , 0.750000f , -0.116248f , -0.929981f , 0.348743f ,
--0.414062f , 0.390625f , 0.750000f , 0.116248f , -0.929981f , 0.348743f ,
--0.421875f , 0.398437f , 0.773438f , 0.116248f , -0.929981f , 0.348743f ,
--0.562500f , 0.351562f , 0.695312f , 0.116248f , -0.929981f , 0.348743f ,
-0.585938f , 0.289062f , 0.687500f , -0.381000f , -0.254000f , 0.889001f ,
-0.562500f , 0.351562f , 0.695312f , -0.381000f , -0.254000f , 0.889001f ,
-0.554688f , 0.281250f , 0.671875f , -0.381000f , -0.254000f , 0.889001f ,
--0.531250f , 0.335937f , 0.679688f , 0.320713f , -0.267261f , 0.908688f ,
--0.562500f , 0.351562f , 0.695312f , 0.320713f , -0.267261f , 0.908688f ,
--0.554688f , 0.281250f , 0.671875f , 0.320713f , -0.267261f , 0.908688f ,
-0.578125f , 0.195312f , 0.679688f , -0.439232f , -0.038194f , 0.897561f ,
-0.585938f , 0.289062f , 0.687500f , -0.439232f , -0.038194f , 0.897561f ,
-0.554688f , 0.281250f , 0.671875f , -0.439232f , -0.038194f , 0.897561f ,
--0.554688f , 0.281250f , 0.671875f , 0.439232f , -0.038194f , 0.897561f ,
--0.585938f , 0.289062f , 0.687500f , 0.439232f , -0.038194f , 0.897561f ,
--0.578125f , 0.195312f , 0.679688f , 0.439232f , -0.038194f , 0.897561f ,
-0.476562f , 0.101562f , 0.718750f , -0.221581f , 0.569780f , 0.791361f ,
-0.578125f , 0.195312f , 0.679688f , -0.221581f , 0.569780f , 0.791361f ,
-0.460938f , 0.117187f , 0.703125f , -0.221581f , 0.569780f , 0.791361f ,
--0.546875f , 0.210937f , 0.671875f , 0.053239f , 0.359362f , 0.931678f ,
--0.578125f , 0.195312f , 0.679688f , 0.053239f , 0.359362f , 0.931678f ,
--0.460938f , 0.117187f , 0.703125f , 0.053239f , 0.359362f , 0.931678f ,
-0.375000f , 0.062500f , 0.742188f , -0.082761f , 0.662085f , 0.744845f ,
-0.476562f , 0.101562f , 0.718750f , -0.082761f , 0.662085f , 0.744845f ,
-0.460938f , 0.117187f , 0.703125f , -0.082761f , 0.662085f , 0.744845f ,
--0.460938f , 0.117187f , 0.703125f , 0.082761f , 0.662085f , 0.744845f ,
--0.476562f , 0.101562f , 0.718750f , 0.082761f , 0.662085f , 0.744845f ,
--0.375000f , 0.062500f , 0.742188f , 0.082761f , 0.662085f , 0.744845f ,
-0.226562f , 0.109375f , 0.781250f , 0.366677f , 0.516064f , 0.774097f ,
-0.375000f , 0.062500f , 0.742188f , 0.366677f , 0.516064f , 0.774097f ,
-0.375000f , 0.085937f , 0.726562f , 0.366677f , 0.516064f , 0.774097f ,
--0.375000f , 0.085937f , 0.726562f , -0.366677f , 0.516064f , 0.774097f ,
--0.375000f , 0.062500f , 0.742188f , -0.366677f , 0.516064f , 0.774097f ,
--0.226562f , 0.109375f , 0.781250f , -0.366677f , 0.516064f , 0.774097f ,
-0.187500f , 0.156250f , 0.773438f , 0.498784f , 0.529958f , 0.685828f ,
-0.226562f , 0.109375f , 0.781250f , 0.498784f , 0.529958f , 0.685828f ,
-0.203125f , 0.171875f , 0.750000f , 0.498784f , 0.529958f , 0.685828f ,
--0.242188f , 0.125000f , 0.757812f , -0.498784f , 0.529958f , 0.685828f ,
--0.226562f , 0.109375f , 0.781250f , -0.498784f , 0.529958f , 0.685828f ,
--0.203125f , 0.171875f , 0.750000f , -0.498784f , 0.529958f , 0.685828f ,
-0.210938f , 0.375000f , 0.781250f , 0.601445f , -0.240578f , 0.761831f ,
-0.179688f , 0.296875f , 0.781250f , 0.601445f , -0.240578f , 0.761831f ,
-0.234375f , 0.359375f , 0.757812f , 0.601445f , -0.240578f , 0.761831f ,
--0.195312f , 0.296875f , 0.757812f , -0.738200f , -0.461375f , 0.492133f ,
--0.179688f , 0.296875f , 0.781250f , -0.738200f , -0.461375f , 0.492133f ,
--0.234375f , 0.359375f , 0.757812f , -0.738200f , -0.461375f , 0.492133f ,
-0.179688f , 0.296875f , 0.781250f , 0.829185f , -0.082919f , 0.552790f ,
-0.171875f , 0.218750f , 0.781250f , 0.829185f , -0.082919f , 0.552790f ,
-0.195312f , 0.296875f , 0.757812f , 0.829185f , -0.082919f , 0.552790f ,
--0.195312f , 0.226562f , 0.750000f , -0.806064f , -0.065357f , 0.588209f ,
--0.171875f , 0.218750f , 0.781250f , -0.806064f , -0.065357f , 0.588209f ,
--0.195312f , 0.296875f , 0.757812f , -0.806064f , -0.065357f , 0.588209f ,
-0.171875f , 0.218750f , 0.781250f , 0.779987f , 0.118180f , 0.614535f ,
-0.187500f , 0.156250f , 0.773438f , 0.779987f , 0.118180f , 0.614535f ,
-0.195312f , 0.226562f , 0.750000f , 0.779987f , 0.118180f , 0.614535f ,
--0.203125f , 0.171875f , 0.750000f , -0.790345f , 0.112906f , 0.602168f ,
--0.187500f , 0.156250f , 0.773438f , -0.790345f , 0.112906f , 0.602168f ,
--0.195312f , 0.226562f , 0.750000f , -0.790345f , 0.112906f , 0.602168f ,
-0.000000f , 0.429687f , 0.742188f , -0.694716f , 0.709497f , -0.118250f ,
-0.062500f , 0.492187f , 0.750000f , -0.694716f , 0.709497f , -0.118250f ,
-0.000000f , 0.406250f , 0.601562f , -0.694716f , 0.709497f , -0.118250f ,
--0.109375f , 0.460937f , 0.609375f , 0.404311f , 0.855017f , -0.324774f ,
--0.062500f , 0.492187f , 0.750000f , 0.404311f , 0.855017f , -0.324774f ,
-0.000000f , 0.406250f , 0.601562f , 0.404311f , 0.855017f , -0.324774f ,
-0.062500f , 0.492187f , 0.750000f , -0.855186f , 0.366508f , -0.366508f ,
-0.156250f , 0.718750f , 0.757813f , -0.855186f , 0.366508f , -0.366508f ,
-0.109375f , 0.460937f , 0.609375f , -0.855186f , 0.366508f , -0.366508f ,
--0.195312f , 0.664062f , 0.617188f , 0.846507f , 0.372757f , -0.380102f ,
--0.156250f , 0.718750f , 0.757813f , 0.846507f , 0.372757f , -0.380102f ,
--0.109375f , 0.460937f , 0.609375f , 0.846507f , 0.372757f , -0.380102f ,
-0.156250f , 0.718750f , 0.757813f , -0.267242f , 0.849692f , -0.454539f ,
-0.320312f , 0.757812f , 0.734375f , -0.267242f , 0.849692f , -0.454539f ,
-0.335938f , 0.687500f , 0.593750f , -0.267242f , 0.849692f , -0.454539f ,
--0.335938f , 0.687500f , 0.593750f , 0.267242f , 0.849692f , -0.454539f ,
--0.320312f , 0.757812f , 0.734375f , 0.267242f , 0.849692f , -0.454539f ,
--0.156250f , 0.718750f , 0.757813f , 0.267242f , 0.849692f , -0.454539f ,
-0.320312f , 0.757812f , 0.734375f , 0.596285f , 0.745356f , -0.298142f ,
-0.492188f , 0.601562f , 0.687500f , 0.596285f , 0.745356f , -0.298142f ,
-0.484375f , 0.554688f , 0.554688f , 0.596285f , 0.745356f , -0.298142f ,
--0.484375f , 0.554688f , 0.554688f , -0.596285f , 0.745356f , -0.298142f ,
--0.492188f , 0.601562f , 0.687500f , -0.596285f , 0.745356f , -0.298142f ,
--0.320312f , 0.757812f , 0.734375f , -0.596285f , 0.745356f , -0.298142f ,
-0.492188f , 0.601562f , 0.687500f , 0.383926f , 0.874593f , -0.296122f ,
-0.710938f , 0.484375f , 0.625000f , 0.383926f , 0.874593f , -0.296122f ,
-0.679688f , 0.453125f , 0.492188f , 0.383926f , 0.874593f , -0.296122f ,
--0.679688f , 0.453125f , 0.492188f , -0.383926f , 0.874593f , -0.296122f ,
--0.710938f , 0.484375f , 0.625000f , -0.383926f , 0.874593f , -0.296122f ,
--0.492188f , 0.601562f , 0.687500f , -0.383926f , 0.874593f , -0.296122f ,
-0.710938f , 0.484375f , 0.625000f , 0.278943f , 0.918076f , -0.281652f ,
-0.859375f , 0.429687f , 0.593750f , 0.278943f , 0.918076f , -0.281652f ,
-0.679688f , 0.453125f , 0.492188f , 0.278943f , 0.918076f , -0.281652f ,
--0.796875f , 0.406250f , 0.460938f , -0.285868f , 0.911603f , -0.295397f ,
--0.859375f , 0.429687f , 0.593750f , -0.285868f , 0.911603f , -0.295397f ,
--0.679688f , 0.453125f , 0.492188f , -0.285868f , 0.911603f , -0.295397f ,
-0.859375f , 0.429687f , 0.593750f , 0.793636f , 0.212659f , -0.570015f ,
-0.828125f , 0.148437f , 0.445312f , 0.793636f , 0.212659f , -0.570015f ,
-0.773438f , 0.164062f , 0.375000f , 0.793636f , 0.212659f , -0.570015f ,
--0.773438f , 0.164062f , 0.375000f , -0.793636f , 0.212659f , -0.570015f ,
--0.828125f , 0.148437f , 0.445312f , -0.793636f , 0.212659f , -0.570015f ,
--0.859375f , 0.429687f , 0.593750f , -0.793636f , 0.212659f , -0.570015f ,
-0.828125f , 0.148437f , 0.445312f , 0.452713f , -0.728585f , -0.514018f ,
-0.632812f , -0.039063f , 0.539062f , 0.452713f , -0.728585f , -0.514018f ,
-0.773438f , 0.164062f , 0.375000f , 0.452713f , -0.728585f , -0.514018f ,
--0.601562f , -0.000000f , 0.414062f , -0.595505f , -0.712308f , -0.371472f ,
--0.632812f , -0.039063f , 0.539062f , -0.595505f , -0.712308f , -0.371472f ,
--0.773438f , 0.164062f , 0.375000f , -0.595505f , -0.712308f , -0.371472f ,
-0.632812f , -0.039063f , 0.539062f , 0.440781f , -0.819481f , -0.366283f ,
-0.437500f , -0.140625f , 0.531250f , 0.440781f , -0.819481f , -0.366283f ,
-0.601562f , -0.000000f , 0.414062f , 0.440781f , -0.819481f , -0.366283f ,
--0.437500f , -0.093750f , 0.468750f , -0.249041f , -0.774794f , -0.581096f ,
--0.437500f , -0.140625f , 0.531250f , -0.249041f , -0.774794f , -0.581096f ,
--0.601562f , -0.000000f , 0.414062f , -0.249041f , -0.774794f , -0.581096f ,
-0.000000f , -0.570312f , 0.320312f , 0.043139f , -0.413418f , -0.909519f ,
-0.000000f , -0.484375f , 0.281250f , 0.043139f , -0.413418f , -0.909519f ,
-0.179688f , -0.414062f , 0.257812f , 0.043139f , -0.413418f , -0.909519f ,
--0.179688f , -0.414062f , 0.257812f , -0.043139f , -0.413418f , -0.909519f ,
-0.000000f , -0.484375f , 0.281250f , -0.043139f , -0.413418f , -0.909519f ,
-0.000000f , -0.570312f , 0.320312f , -0.043139f , -0.413418f , -0.909519f ,
-0.000000f , -0.804688f , 0.343750f , 0.318353f , -0.094327f , -0.943268f ,
-0.000000f , -0.570312f , 0.320312f , 0.318353f , -0.094327f , -0.943268f ,
-0.125000f , -0.539062f , 0.359375f , 0.318353f , -0.094327f , -0.943268f ,
--0.125000f , -0.539062f , 0.359375f , -0.318353f , -0.094327f , -0.943268f ,
-0.000000f , -0.570312f , 0.320312f , -0.318353f , -0.094327f , -0.943268f ,
-0.000000f , -0.804688f , 0.343750f , -0.318353f , -0.094327f , -0.943268f ,
-0.000000f , -0.976562f , 0.460937f , 0.309502f , -0.535676f , -0.785659f ,
-0.000000f , -0.804688f , 0.343750f , 0.309502f , -0.535676f , -0.785659f ,
-0.140625f , -0.757812f , 0.367187f , 0.309502f , -0.535676f , -0.785659f ,
--0.140625f , -0.757812f , 0.367187f , -0.309502f , -0.535676f , -0.785659f ,
-0.000000f , -0.804688f , 0.343750f , -0.309502f , -0.535676f , -0.785659f ,
-0.000000f , -0.976562f , 0.460937f , -0.309502f , -0.535676f , -0.785659f ,
-0.179688f , -0.968750f , 0.554687f , 0.058475f , -0.977375f , -0.203272f ,
-0.000000f , -0.984375f , 0.578125f , 0.058475f , -0.977375f , -0.203272f ,
-0.164062f , -0.945312f , 0.437500f , 0.058475f , -0.977375f , -0.203272f ,
-0.000000f , -0.976562f , 0.460937f , -0.177679f , -0.981909f , -0.065461f ,
-0.000000f , -0.984375f , 0.578125f , -0.177679f , -0.981909f , -0.065461f ,
--0.164062f , -0.945312f , 0.437500f , -0.177679f , -0.981909f , -0.065461f ,
-0.328125f , -0.945312f , 0.523437f , 0.101592f , -0.965123f , -0.241281f ,
-0.179688f , -0.968750f , 0.554687f , 0.101592f , -0.965123f , -0.241281f ,
-0.328125f , -0.914062f , 0.398437f , 0.101592f , -0.965123f , -0.241281f ,
--0.164062f , -0.945312f , 0.437500f , -0.134050f , -0.968141f , -0.211502f ,
--0.179688f , -0.968750f , 0.554687f , -0.134050f , -0.968141f , -0.211502f ,
--0.328125f , -0.914062f , 0.398437f , -0.134050f , -0.968141f , -0.211502f ,
-0.367188f , -0.890625f , 0.531250f , 0.608216f , -0.331400f , -0.721282f ,
-0.328125f , -0.945312f , 0.523437f , 0.608216f , -0.331400f , -0.721282f ,
-0.289062f , -0.710938f , 0.382812f , 0.608216f , -0.331400f , -0.721282f ,
--0.328125f , -0.914062f , 0.398437f , -0.980180f , 0.192192f , 0.048048f ,
--0.328125f , -0.945312f , 0.523437f , -0.980180f , 0.192192f , 0.048048f ,
--0.289062f , -0.710938f , 0.382812f , -0.980180f , 0.192192f , 0.048048f ,
-0.351562f , -0.695312f , 0.570312f , 0.920777f , 0.146009f , -0.361734f ,
-0.367188f , -0.890625f , 0.531250f , 0.920777f , 0.146009f , -0.361734f ,
-0.250000f , -0.500000f , 0.390625f , 0.920777f , 0.146009f , -0.361734f ,
--0.289062f , -0.710938f , 0.382812f , -0.944069f , 0.184939f , -0.273005f ,
--0.367188f , -0.890625f , 0.531250f , -0.944069f , 0.184939f , -0.273005f ,
--0.250000f , -0.500000f , 0.390625f , -0.944069f , 0.184939f , -0.273005f ,
-0.289062f , -0.710938f , 0.382812f , 0.087930f , 0.053124f , -0.994709f ,
-0.140625f , -0.757812f , 0.367187f , 0.087930f , 0.053124f , -0.994709f ,
-0.250000f , -0.500000f , 0.390625f , 0.087930f , 0.053124f , -0.994709f ,
--0.125000f , -0.539062f , 0.359375f , -0.247475f , -0.016921f , -0.968747f ,
--0.140625f , -0.757812f , 0.367187f , -0.247475f , -0.016921f , -0.968747f ,
--0.250000f , -0.500000f , 0.390625f , -0.247475f , -0.016921f , -0.968747f ,
-0.289062f , -0.710938f , 0.382812f , -0.209312f , -0.114950f , -0.971069f ,
-0.328125f , -0.914062f , 0.398437f , -0.209312f , -0.114950f , -0.971069f ,
-0.164062f , -0.945312f , 0.437500f , -0.209312f , -0.114950f , -0.971069f ,
--0.164062f , -0.945312f , 0.437500f , 0.209312f , -0.114950f , -0.971069f ,
--0.328125f , -0.914062f , 0.398437f , 0.209312f , -0.114950f , -0.971069f ,
--0.289062f , -0.710938f , 0.382812f , 0.209312f , -0.114950f , -0.971069f ,
-0.234375f , -0.351563f , 0.406250f , 0.204116f , 0.123707f , -0.971099f ,
-0.250000f , -0.500000f , 0.390625f , 0.204116f , 0.123707f , -0.971099f ,
-0.125000f , -0.539062f , 0.359375f , 0.204116f , 0.123707f , -0.971099f ,
--0.125000f , -0.539062f , 0.359375f , -0.204116f , 0.123707f , -0.971099f ,
--0.250000f , -0.500000f , 0.390625f , -0.204116f , 0.123707f , -0.971099f ,
--0.234375f , -0.351563f , 0.406250f , -0.204116f , 0.123707f , -0.971099f ,
-0.312500f , -0.437500f , 0.570312f , 0.920408f , 0.139456f , -0.365241f ,
-0.351562f , -0.695312f , 0.570312f , 0.920408f , 0.139456f , -0.365241f ,
-0.234375f , -0.351563f , 0.406250f , 0.920408f , 0.139456f , -0.365241f ,
--0.250000f , -0.500000f , 0.390625f , -0.918440f , 0.135786f , -0.371525f ,
--0.351562f , -0.695312f , 0.570312f , -0.918440f , 0.135786f , -0.371525f ,
--0.234375f , -0.351563f , 0.406250f , -0.918440f , 0.135786f , -0.371525f ,
-0.257812f , -0.312500f , 0.554688f , 0.931845f , 0.289437f , -0.218842f ,
-0.218750f , -0.281250f , 0.429688f , 0.931845f , 0.289437f , -0.218842f ,
-0.210938f , -0.226563f , 0.468750f , 0.931845f , 0.289437f , -0.218842f ,
--0.210938f , -0.226563f , 0.468750f , -0.931845f , 0.289437f , -0.218842f ,
--0.218750f , -0.281250f , 0.429688f , -0.931845f , 0.289437f , -0.218842f ,
--0.257812f , -0.312500f , 0.554688f , -0.931845f , 0.289437f , -0.218842f ,
-0.312500f , -0.437500f , 0.570312f , 0.913248f , 0.296189f , -0.279733f ,
-0.234375f , -0.351563f , 0.406250f , 0.913248f , 0.296189f , -0.279733f ,
-0.218750f , -0.281250f , 0.429688f , 0.913248f , 0.296189f , -0.279733f ,
--0.218750f , -0.281250f , 0.429688f , -0.913248f , 0.296189f , -0.279733f ,
--0.234375f , -0.351563f , 0.406250f , -0.913248f , 0.296189f , -0.279733f ,
--0.312500f , -0.437500f , 0.570312f , -0.913248f , 0.296189f , -0.279733f ,
-0.203125f , -0.187500f , 0.562500f , 0.882456f , 0.455774f , -0.116368f ,
-0.234375f , -0.250000f , 0.554688f , 0.882456f , 0.455774f , -0.116368f ,
-0.210938f , -0.226563f , 0.468750f , 0.882456f , 0.455774f , -0.116368f ,
--0.210938f , -0.226563f , 0.468750f , -0.882456f , 0.455774f , -0.116368f ,
--0.234375f , -0.250000f , 0.554688f , -0.882456f , 0.455774f , -0.116368f ,
--0.203125f , -0.187500f , 0.562500f , -0.882456f , 0.455774f , -0.116368f ,
-0.203125f , -0.187500f , 0.562500f , 0.279448f , -0.931493f , -0.232873f ,
-0.203125f , -0.171875f , 0.500000f , 0.279448f , -0.931493f , -0.232873f ,
-0.437500f , -0.093750f , 0.468750f , 0.279448f , -0.931493f , -0.232873f ,
--0.437500f , -0.093750f , 0.468750f , -0.279448f , -0.931493f , -0.232873f ,
--0.203125f , -0.171875f , 0.500000f , -0.279448f , -0.931493f , -0.232873f ,
--0.203125f , -0.187500f , 0.562500f , -0.279448f , -0.931493f , -0.232873f ,
-0.000000f , 0.070313f , -0.828125f , 0.367655f , -0.477093f , -0.798255f ,
-0.335938f , 0.054688f , -0.664062f , 0.367655f , -0.477093f , -0.798255f ,
-0.343750f , -0.148437f , -0.539062f , 0.367655f , -0.477093f , -0.798255f ,
--0.343750f , -0.148437f , -0.539062f , -0.367655f , -0.477093f , -0.798255f ,
--0.335938f , 0.054688f , -0.664062f , -0.367655f , -0.477093f , -0.798255f ,
-0.000000f , 0.070313f , -0.828125f , -0.367655f , -0.477093f , -0.798255f ,
-0.000000f , -0.195312f , -0.671875f , 0.290628f , -0.841642f , -0.455163f ,
-0.343750f , -0.148437f , -0.539062f , 0.290628f , -0.841642f , -0.455163f ,
-0.296875f , -0.312500f , -0.265625f , 0.290628f , -0.841642f , -0.455163f ,
--0.296875f , -0.312500f , -0.265625f , -0.290628f , -0.841642f , -0.455163f ,
--0.343750f , -0.148437f , -0.539062f , -0.290628f , -0.841642f , -0.455163f ,
-0.000000f , -0.195312f , -0.671875f , -0.290628f , -0.841642f , -0.455163f ,
-0.000000f , -0.382812f , -0.351563f , 0.265974f , -0.954013f , -0.138263f ,
-0.296875f , -0.312500f , -0.265625f , 0.265974f , -0.954013f , -0.138263f ,
-0.000000f , -0.460938f , 0.187500f , 0.265974f , -0.954013f , -0.138263f ,
--0.210938f , -0.390625f , 0.164062f , -0.303090f , -0.946422f , -0.111459f ,
--0.296875f , -0.312500f , -0.265625f , -0.303090f , -0.946422f , -0.111459f ,
-0.000000f , -0.460938f , 0.187500f , -0.303090f , -0.946422f , -0.111459f ,
-0.000000f , -0.460938f , 0.187500f , 0.284208f , -0.930136f , -0.232534f ,
-0.210938f , -0.390625f , 0.164062f , 0.284208f , -0.930136f , -0.232534f ,
-0.000000f , -0.484375f , 0.281250f , 0.284208f , -0.930136f , -0.232534f ,
--0.179688f , -0.414062f , 0.257812f , -0.348743f , -0.929981f , -0.116248f ,
--0.210938f , -0.390625f , 0.164062f , -0.348743f , -0.929981f , -0.116248f ,
-0.000000f , -0.484375f , 0.281250f , -0.348743f , -0.929981f , -0.116248f ,
-0.234375f , -0.351563f , 0.406250f , 0.690268f , -0.721850f , 0.049627f ,
-0.179688f , -0.414062f , 0.257812f , 0.690268f , -0.721850f , 0.049627f ,
-0.210938f , -0.390625f , 0.164062f , 0.690268f , -0.721850f , 0.049627f ,
--0.210938f , -0.390625f , 0.164062f , -0.690268f , -0.721850f , 0.049627f ,
--0.179688f , -0.414062f , 0.257812f , -0.690268f , -0.721850f , 0.049627f ,
--0.234375f , -0.351563f , 0.406250f , -0.690268f , -0.721850f , 0.049627f ,
-0.773438f , 0.164062f , 0.375000f , 0.691649f , -0.722163f , 0.010171f ,
-0.601562f , -0.000000f , 0.414062f , 0.691649f , -0.722163f , 0.010171f ,
-0.851562f , 0.234375f , 0.054688f , 0.691649f , -0.722163f , 0.010171f ,
--0.734375f , -0.046875f , 0.070312f , -0.861521f , -0.337915f , 0.378940f ,
--0.601562f , -0.000000f , 0.414062f , -0.861521f , -0.337915f , 0.378940f ,
--0.851562f , 0.234375f , 0.054688f , -0.861521f , -0.337915f , 0.378940f ,
-0.000000f , 0.562500f , -0.851562f , 0.256742f , -0.180715f , -0.949434f ,
-0.460938f , 0.437500f , -0.703125f , 0.256742f , -0.180715f , -0.949434f ,
-0.335938f , 0.054688f , -0.664062f , 0.256742f , -0.180715f , -0.949434f ,
--0.335938f , 0.054688f , -0.664062f , -0.256742f , -0.180715f , -0.949434f ,
--0.460938f , 0.437500f , -0.703125f , -0.256742f , -0.180715f , -0.949434f ,
-0.000000f , 0.562500f , -0.851562f , -0.256742f , -0.180715f , -0.949434f ,
-0.000000f , 0.898438f , 0.289063f , 0.129094f , 0.960558f , 0.246297f ,
-0.453125f , 0.851562f , 0.234375f , 0.129094f , 0.960558f , 0.246297f ,
-0.453125f , 0.929688f , -0.070312f , 0.129094f , 0.960558f , 0.246297f ,
--0.453125f , 0.929688f , -0.070312f , -0.129094f , 0.960558f , 0.246297f ,
--0.453125f , 0.851562f , 0.234375f , -0.129094f , 0.960558f , 0.246297f ,
-0.000000f , 0.898438f , 0.289063f , -0.129094f , 0.960558f , 0.246297f ,
-0.000000f , 0.984375f , -0.078125f , 0.120926f , 0.976388f , -0.179005f ,
-0.453125f , 0.929688f , -0.070312f , 0.120926f , 0.976388f , -0.179005f ,
-0.000000f , 0.898438f , -0.546875f , 0.120926f , 0.976388f , -0.179005f ,
--0.453125f , 0.867188f , -0.382812f , -0.137320f , 0.971291f , -0.194258f ,
--0.453125f , 0.929688f , -0.070312f , -0.137320f , 0.971291f , -0.194258f ,
-0.000000f , 0.898438f , -0.546875f , -0.137320f , 0.971291f , -0.194258f ,
-0.000000f , 0.898438f , -0.546875f , 0.300033f , 0.640864f , -0.706593f ,
-0.453125f , 0.867188f , -0.382812f , 0.300033f , 0.640864f , -0.706593f ,
-0.000000f , 0.562500f , -0.851562f , 0.300033f , 0.640864f , -0.706593f ,
--0.460938f , 0.437500f , -0.703125f , -0.387556f , 0.555474f , -0.735696f ,
--0.453125f , 0.867188f , -0.382812f , -0.387556f , 0.555474f , -0.735696f ,
-0.000000f , 0.562500f , -0.851562f , -0.387556f , 0.555474f , -0.735696f ,
-0.679688f , 0.453125f , 0.492188f , 0.352190f , 0.932651f , -0.078264f ,
-0.796875f , 0.406250f , 0.460938f , 0.352190f , 0.932651f , -0.078264f ,
-0.632812f , 0.453125f , 0.281250f , 0.352190f , 0.932651f , -0.078264f ,
--0.726562f , 0.406250f , 0.335938f , -0.565951f , 0.760496f , -0.318347f ,
--0.796875f , 0.406250f , 0.460938f , -0.565951f , 0.760496f , -0.318347f ,
--0.632812f , 0.453125f , 0.281250f , -0.565951f , 0.760496f , -0.318347f ,
-0.632812f , 0.453125f , 0.281250f , -0.094386f , 0.670139f , 0.736210f ,
-0.726562f , 0.406250f , 0.335938f , -0.094386f , 0.670139f , 0.736210f ,
-0.640625f , 0.703125f , 0.054688f , -0.094386f , 0.670139f , 0.736210f ,
--0.796875f , 0.562500f , 0.125000f , -0.343166f , 0.696426f , 0.630260f ,
--0.726562f , 0.406250f , 0.335938f , -0.343166f , 0.696426f , 0.630260f ,
--0.640625f , 0.703125f , 0.054688f , -0.343166f , 0.696426f , 0.630260f ,
-0.640625f , 0.703125f , 0.054688f , 0.625482f , 0.766875f , 0.143789f ,
-0.796875f , 0.562500f , 0.125000f , 0.625482f , 0.766875f , 0.143789f ,
-0.640625f , 0.750000f , -0.195312f , 0.625482f , 0.766875f , 0.143789f ,
--0.796875f , 0.617188f , -0.117187f , -0.583767f , 0.791981f , 0.178834f ,
--0.796875f , 0.562500f , 0.125000f , -0.583767f , 0.791981f , 0.178834f ,
--0.640625f , 0.750000f , -0.195312f , -0.583767f , 0.791981f , 0.178834f ,
-0.640625f , 0.750000f , -0.195312f , 0.690128f , 0.696659f , -0.195935f ,
-0.796875f , 0.617188f , -0.117187f , 0.690128f , 0.696659f , -0.195935f ,
-0.640625f , 0.679688f , -0.445312f , 0.690128f , 0.696659f , -0.195935f ,
--0.796875f , 0.539062f , -0.359375f , -0.715914f , 0.664472f , -0.214346f ,
--0.796875f , 0.617188f , -0.117187f , -0.715914f , 0.664472f , -0.214346f ,
--0.640625f , 0.679688f , -0.445312f , -0.715914f , 0.664472f , -0.214346f ,
-0.773438f , 0.265625f , -0.437500f , 0.716578f , 0.217341f , -0.662781f ,
-0.617188f , 0.328125f , -0.585938f , 0.716578f , 0.217341f , -0.662781f ,
-0.640625f , 0.679688f , -0.445312f , 0.716578f , 0.217341f , -0.662781f ,
--0.640625f , 0.679688f , -0.445312f , -0.716578f , 0.217341f , -0.662781f ,
--0.617188f , 0.328125f , -0.585938f , -0.716578f , 0.217341f , -0.662781f ,
--0.773438f , 0.265625f , -0.437500f , -0.716578f , 0.217341f , -0.662781f ,
-0.460938f , 0.437500f , -0.703125f , 0.714499f , 0.426452f , -0.554643f ,
-0.453125f , 0.867188f , -0.382812f , 0.714499f , 0.426452f , -0.554643f ,
-0.617188f , 0.328125f , -0.585938f , 0.714499f , 0.426452f , -0.554643f ,
--0.640625f , 0.679688f , -0.445312f , -0.058015f , 0.367429f , -0.928241f ,
--0.453125f , 0.867188f , -0.382812f , -0.058015f , 0.367429f , -0.928241f ,
--0.617188f , 0.328125f , -0.585938f , -0.058015f , 0.367429f , -0.928241f ,
-0.453125f , 0.867188f , -0.382812f , 0.675140f , 0.723364f , -0.144673f ,
-0.453125f , 0.929688f , -0.070312f , 0.675140f , 0.723364f , -0.144673f ,
-0.640625f , 0.679688f , -0.445312f , 0.675140f , 0.723364f , -0.144673f ,
--0.640625f , 0.750000f , -0.195312f , -0.595903f , 0.773063f , -0.217424f ,
--0.453125f , 0.929688f , -0.070312f , -0.595903f , 0.773063f , -0.217424f ,
--0.640625f , 0.679688f , -0.445312f , -0.595903f , 0.773063f , -0.217424f ,
-0.453125f , 0.929688f , -0.070312f , 0.738071f , 0.653580f , 0.167585f ,
-0.453125f , 0.851562f , 0.234375f , 0.738071f , 0.653580f , 0.167585f ,
-0.640625f , 0.750000f , -0.195312f , 0.738071f , 0.653580f , 0.167585f ,
--0.640625f , 0.703125f , 0.054688f , -0.690541f , 0.710905f , 0.133295f ,
--0.453125f , 0.851562f , 0.234375f , -0.690541f , 0.710905f , 0.133295f ,
--0.640625f , 0.750000f , -0.195312f , -0.690541f , 0.710905f , 0.133295f ,
-0.453125f , 0.851562f , 0.234375f , 0.776627f , 0.335766f , 0.533022f ,
-0.460938f , 0.523438f , 0.429688f , 0.776627f , 0.335766f , 0.533022f ,
-0.640625f , 0.703125f , 0.054688f , 0.776627f , 0.335766f , 0.533022f ,
--0.632812f , 0.453125f , 0.281250f , -0.677195f , 0.482375f , 0.555627f ,
--0.460938f , 0.523438f , 0.429688f , -0.677195f , 0.482375f , 0.555627f ,
--0.640625f , 0.703125f , 0.054688f , -0.677195f , 0.482375f , 0.555627f ,
-0.484375f , 0.554688f , 0.554688f , 0.434689f , 0.895385f , -0.096597f ,
-0.679688f , 0.453125f , 0.492188f , 0.434689f , 0.895385f , -0.096597f ,
-0.632812f , 0.453125f , 0.281250f , 0.434689f , 0.895385f , -0.096597f ,
--0.632812f , 0.453125f , 0.281250f , -0.434689f , 0.895385f , -0.096597f ,
--0.679688f , 0.453125f , 0.492188f , -0.434689f , 0.895385f , -0.096597f ,
--0.484375f , 0.554688f , 0.554688f , -0.434689f , 0.895385f , -0.096597f ,
-0.000000f , 0.570312f , 0.570312f , 0.299340f , 0.493283f , 0.816742f ,
-0.460938f , 0.523438f , 0.429688f , 0.299340f , 0.493283f , 0.816742f ,
-0.453125f , 0.851562f , 0.234375f , 0.299340f , 0.493283f , 0.816742f ,
--0.453125f , 0.851562f , 0.234375f , -0.299340f , 0.493283f , 0.816742f ,
--0.460938f , 0.523438f , 0.429688f , -0.299340f , 0.493283f , 0.816742f ,
-0.000000f , 0.570312f , 0.570312f , -0.299340f , 0.493283f , 0.816742f ,
-0.109375f , 0.460937f , 0.609375f , -0.181856f , 0.114502f , -0.976636f ,
-0.195312f , 0.664062f , 0.617188f , -0.181856f , 0.114502f , -0.976636f ,
-0.335938f , 0.687500f , 0.593750f , -0.181856f , 0.114502f , -0.976636f ,
--0.335938f , 0.687500f , 0.593750f , 0.181856f , 0.114502f , -0.976636f ,
--0.195312f , 0.664062f , 0.617188f , 0.181856f , 0.114502f , -0.976636f ,
--0.109375f , 0.460937f , 0.609375f , 0.181856f , 0.114502f , -0.976636f ,
-0.109375f , 0.460937f , 0.609375f , 0.041931f , 0.372966f , 0.926897f ,
-0.484375f , 0.554688f , 0.554688f , 0.041931f , 0.372966f , 0.926897f ,
-0.000000f , 0.570312f , 0.570312f , 0.041931f , 0.372966f , 0.926897f ,
--0.460938f , 0.523438f , 0.429688f , -0.023299f , 0.968843f , -0.246579f ,
--0.484375f , 0.554688f , 0.554688f , -0.023299f , 0.968843f , -0.246579f ,
-0.000000f , 0.570312f , 0.570312f , -0.023299f , 0.968843f , -0.246579f ,
-0.000000f , 0.406250f , 0.601562f , -0.161572f , 0.184654f , 0.969432f ,
-0.109375f , 0.460937f , 0.609375f , -0.161572f , 0.184654f , 0.969432f ,
-0.000000f , 0.570312f , 0.570312f , -0.161572f , 0.184654f , 0.969432f ,
-0.000000f , 0.570312f , 0.570312f , 0.161572f , 0.184654f , 0.969432f ,
--0.109375f , 0.460937f , 0.609375f , 0.161572f , 0.184654f , 0.969432f ,
-0.000000f , 0.406250f , 0.601562f , 0.161572f , 0.184654f , 0.969432f ,
-0.796875f , 0.406250f , 0.460938f , 0.966016f , -0.164293f , 0.199549f ,
-0.773438f , 0.164062f , 0.375000f , 0.966016f , -0.164293f , 0.199549f ,
-0.851562f , 0.234375f , 0.054688f , 0.966016f , -0.164293f , 0.199549f ,
--0.851562f , 0.234375f , 0.054688f , -0.966016f , -0.164293f , 0.199549f ,
--0.773438f , 0.164062f , 0.375000f , -0.966016f , -0.164293f , 0.199549f ,
--0.796875f , 0.406250f , 0.460938f , -0.966016f , -0.164293f , 0.199549f ,
-0.851562f , 0.234375f , 0.054688f , 0.933361f , 0.235393f , 0.270976f ,
-0.859375f , 0.320312f , -0.046875f , 0.933361f , 0.235393f , 0.270976f ,
-0.726562f , 0.406250f , 0.335938f , 0.933361f , 0.235393f , 0.270976f ,
--0.796875f , 0.562500f , 0.125000f , -0.945595f , 0.013329f , 0.325072f ,
--0.859375f , 0.320312f , -0.046875f , -0.945595f , 0.013329f , 0.325072f ,
--0.726562f , 0.406250f , 0.335938f , -0.945595f , 0.013329f , 0.325072f ,
-0.859375f , 0.320312f , -0.046875f , 0.901926f , 0.379315f , -0.206516f ,
-0.820312f , 0.328125f , -0.203125f , 0.901926f , 0.379315f , -0.206516f ,
-0.796875f , 0.562500f , 0.125000f , 0.901926f , 0.379315f , -0.206516f ,
--0.796875f , 0.617188f , -0.117187f , -0.996980f , 0.075751f , 0.017105f ,
--0.820312f , 0.328125f , -0.203125f , -0.996980f , 0.075751f , 0.017105f ,
--0.796875f , 0.562500f , 0.125000f , -0.996980f , 0.075751f , 0.017105f ,
-0.773438f , 0.265625f , -0.437500f , 0.995115f , -0.093955f , 0.030308f ,
-0.796875f , 0.539062f , -0.359375f , 0.995115f , -0.093955f , 0.030308f ,
-0.796875f , 0.617188f , -0.117187f , 0.995115f , -0.093955f , 0.030308f ,
--0.796875f , 0.617188f , -0.117187f , -0.995115f , -0.093955f , 0.030308f ,
--0.796875f , 0.539062f , -0.359375f , -0.995115f , -0.093955f , 0.030308f ,
--0.773438f , 0.265625f , -0.437500f , -0.995115f , -0.093955f , 0.030308f ,
-0.210938f , -0.390625f , 0.164062f , 0.662473f , -0.749076f , -0.003701f ,
-0.296875f , -0.312500f , -0.265625f , 0.662473f , -0.749076f , -0.003701f ,
-0.429688f , -0.195312f , -0.210938f , 0.662473f , -0.749076f , -0.003701f ,
--0.429688f , -0.195312f , -0.210938f , -0.662473f , -0.749076f , -0.003701f ,
--0.296875f , -0.312500f , -0.265625f , -0.662473f , -0.749076f , -0.003701f ,
--0.210938f , -0.390625f , 0.164062f , -0.662473f , -0.749076f , -0.003701f ,
-0.734375f , -0.046875f , 0.070312f , 0.372238f , -0.924278f , 0.084555f ,
-0.406250f , -0.171875f , 0.148437f , 0.372238f , -0.924278f , 0.084555f ,
-0.429688f , -0.195312f , -0.210938f , 0.372238f , -0.924278f , 0.084555f ,
--0.429688f , -0.195312f , -0.210938f , -0.372238f , -0.924278f , 0.084555f ,
--0.406250f , -0.171875f , 0.148437f , -0.372238f , -0.924278f , 0.084555f ,
--0.734375f , -0.046875f , 0.070312f , -0.372238f , -0.924278f , 0.084555f ,
-0.601562f , -0.000000f , 0.414062f , 0.548020f , -0.773958f , 0.317275f ,
-0.437500f , -0.093750f , 0.468750f , 0.548020f , -0.773958f , 0.317275f ,
-0.734375f , -0.046875f , 0.070312f , 0.548020f , -0.773958f , 0.317275f ,
--0.406250f , -0.171875f , 0.148437f , -0.387671f , -0.903540f , 0.182554f ,
--0.437500f , -0.093750f , 0.468750f , -0.387671f , -0.903540f , 0.182554f ,
--0.734375f , -0.046875f , 0.070312f , -0.387671f , -0.903540f , 0.182554f ,
-0.437500f , -0.093750f , 0.468750f , 0.499284f , -0.851720f , 0.159026f ,
-0.210938f , -0.226563f , 0.468750f , 0.499284f , -0.851720f , 0.159026f ,
-0.406250f , -0.171875f , 0.148437f , 0.499284f , -0.851720f , 0.159026f ,
--0.218750f , -0.281250f , 0.429688f , -0.848945f , -0.221464f , 0.479839f ,
--0.210938f , -0.226563f , 0.468750f , -0.848945f , -0.221464f , 0.479839f ,
--0.406250f , -0.171875f , 0.148437f , -0.848945f , -0.221464f , 0.479839f ,
-0.218750f , -0.281250f , 0.429688f , 0.732489f , -0.636817f , 0.240675f ,
-0.210938f , -0.390625f , 0.164062f , 0.732489f , -0.636817f , 0.240675f ,
-0.406250f , -0.171875f , 0.148437f , 0.732489f , -0.636817f , 0.240675f ,
--0.406250f , -0.171875f , 0.148437f , -0.732489f , -0.636817f , 0.240675f ,
--0.210938f , -0.390625f , 0.164062f , -0.732489f , -0.636817f , 0.240675f ,
--0.218750f , -0.281250f , 0.429688f , -0.732489f , -0.636817f , 0.240675f ,
-0.437500f , -0.093750f , 0.468750f , 0.263732f , -0.449896f , 0.853252f ,
-0.203125f , -0.171875f , 0.500000f , 0.263732f , -0.449896f , 0.853252f ,
-0.210938f , -0.226563f , 0.468750f , 0.263732f , -0.449896f , 0.853252f ,
--0.210938f , -0.226563f , 0.468750f , -0.263732f , -0.449896f , 0.853252f ,
--0.203125f , -0.171875f , 0.500000f , -0.263732f , -0.449896f , 0.853252f ,
--0.437500f , -0.093750f , 0.468750f , -0.263732f , -0.449896f , 0.853252f ,
-0.773438f , 0.265625f , -0.437500f , 0.538262f , -0.284111f , -0.793445f ,
-0.640625f , -0.007812f , -0.429688f , 0.538262f , -0.284111f , -0.793445f ,
-0.484375f , 0.023438f , -0.546875f , 0.538262f , -0.284111f , -0.793445f ,
--0.484375f , 0.023438f , -0.546875f , -0.538262f , -0.284111f , -0.793445f ,
--0.640625f , -0.007812f , -0.429688f , -0.538262f , -0.284111f , -0.793445f ,
--0.773438f , 0.265625f , -0.437500f , -0.538262f , -0.284111f , -0.793445f ,
-0.460938f , 0.437500f , -0.703125f , 0.431030f , -0.297118f , -0.852017f ,
-0.617188f , 0.328125f , -0.585938f , 0.431030f , -0.297118f , -0.852017f ,
-0.484375f , 0.023438f , -0.546875f , 0.431030f , -0.297118f , -0.852017f ,
--0.484375f , 0.023438f , -0.546875f , -0.431030f , -0.297118f , -0.852017f ,
--0.617188f , 0.328125f , -0.585938f , -0.431030f , -0.297118f , -0.852017f ,
--0.460938f , 0.437500f , -0.703125f , -0.431030f , -0.297118f , -0.852017f ,
-0.593750f , -0.125000f , -0.164062f , 0.456721f , -0.777659f , -0.432033f ,
-0.429688f , -0.195312f , -0.210938f , 0.456721f , -0.777659f , -0.432033f ,
-0.484375f , 0.023438f , -0.546875f , 0.456721f , -0.777659f , -0.432033f ,
--0.484375f , 0.023438f , -0.546875f , -0.456721f , -0.777659f , -0.432033f ,
--0.429688f , -0.195312f , -0.210938f , -0.456721f , -0.777659f , -0.432033f ,
--0.593750f , -0.125000f , -0.164062f , -0.456721f , -0.777659f , -0.432033f ,
-0.296875f , -0.312500f , -0.265625f , 0.744954f , -0.620629f , -0.244671f ,
-0.343750f , -0.148437f , -0.539062f , 0.744954f , -0.620629f , -0.244671f ,
-0.484375f , 0.023438f , -0.546875f , 0.744954f , -0.620629f , -0.244671f ,
--0.484375f , 0.023438f , -0.546875f , -0.744954f , -0.620629f , -0.244671f ,
--0.343750f , -0.148437f , -0.539062f , -0.744954f , -0.620629f , -0.244671f ,
--0.296875f , -0.312500f , -0.265625f , -0.744954f , -0.620629f , -0.244671f ,
-0.335938f , 0.054688f , -0.664062f , 0.497205f , -0.440774f , -0.747333f ,
-0.484375f , 0.023438f , -0.546875f , 0.497205f , -0.440774f , -0.747333f ,
-0.343750f , -0.148437f , -0.539062f , 0.497205f , -0.440774f , -0.747333f ,
--0.343750f , -0.148437f , -0.539062f , -0.497205f , -0.440774f , -0.747333f ,
--0.484375f , 0.023438f , -0.546875f , -0.497205f , -0.440774f , -0.747333f ,
--0.335938f , 0.054688f , -0.664062f , -0.497205f , -0.440774f , -0.747333f ,
-1.023438f , 0.476562f , -0.312500f , 0.259062f , 0.456442f , 0.851203f ,
-0.890625f , 0.406250f , -0.234375f , 0.259062f , 0.456442f , 0.851203f ,
-0.921875f , 0.359375f , -0.218750f , 0.259062f , 0.456442f , 0.851203f ,
--0.921875f , 0.359375f , -0.218750f , -0.259062f , 0.456442f , 0.851203f ,
--0.890625f , 0.406250f , -0.234375f , -0.259062f , 0.456442f , 0.851203f ,
--1.023438f , 0.476562f , -0.312500f , -0.259062f , 0.456442f , 0.851203f ,
-1.023438f , 0.476562f , -0.312500f , 0.410191f , 0.274828f , 0.869605f ,
-1.015625f , 0.414062f , -0.289062f , 0.410191f , 0.274828f , 0.869605f ,
-1.234375f , 0.507812f , -0.421875f , 0.410191f , 0.274828f , 0.869605f ,
--1.187500f , 0.437500f , -0.390625f , -0.503292f , 0.047933f , 0.862786f ,
--1.015625f , 0.414062f , -0.289062f , -0.503292f , 0.047933f , 0.862786f ,
--1.234375f , 0.507812f , -0.421875f , -0.503292f , 0.047933f , 0.862786f ,
-1.234375f , 0.507812f , -0.421875f , 0.415279f , 0.123700f , 0.901244f ,
-1.187500f , 0.437500f , -0.390625f , 0.415279f , 0.123700f , 0.901244f ,
-1.265625f , 0.289063f , -0.406250f , 0.415279f , 0.123700f , 0.901244f ,
--1.265625f , 0.289063f , -0.406250f , -0.415279f , 0.123700f , 0.901244f ,
--1.187500f , 0.437500f , -0.390625f , -0.415279f , 0.123700f , 0.901244f ,
--1.234375f , 0.507812f , -0.421875f , -0.415279f , 0.123700f , 0.901244f ,
-1.351562f , 0.320313f , -0.421875f , 0.196561f , -0.050960f , 0.979166f ,
-1.265625f , 0.289063f , -0.406250f , 0.196561f , -0.050960f , 0.979166f ,
-1.210938f , 0.078125f , -0.406250f , 0.196561f , -0.050960f , 0.979166f ,
--1.210938f , 0.078125f , -0.406250f , -0.196561f , -0.050960f , 0.979166f ,
--1.265625f , 0.289063f , -0.406250f , -0.196561f , -0.050960f , 0.979166f ,
--1.351562f , 0.320313f , -0.421875f , -0.196561f , -0.050960f , 0.979166f ,
-1.281250f , 0.054688f , -0.429688f , 0.372046f , 0.212598f , 0.903540f ,
-1.210938f , 0.078125f , -0.406250f , 0.372046f , 0.212598f , 0.903540f ,
-1.031250f , -0.039062f , -0.304688f , 0.372046f , 0.212598f , 0.903540f ,
--1.031250f , -0.039062f , -0.304688f , -0.372046f , 0.212598f , 0.903540f ,
--1.210938f , 0.078125f , -0.406250f , -0.372046f , 0.212598f , 0.903540f ,
--1.281250f , 0.054688f , -0.429688f , -0.372046f , 0.212598f , 0.903540f ,
-1.039062f , -0.101562f , -0.328125f , 0.613244f , -0.208998f , 0.761743f ,
-1.031250f , -0.039062f , -0.304688f , 0.613244f , -0.208998f , 0.761743f ,
-0.773438f , -0.140625f , -0.125000f , 0.613244f , -0.208998f , 0.761743f ,
--0.828125f , -0.070312f , -0.132812f , -0.624650f , -0.412140f , 0.663289f ,
--1.031250f , -0.039062f , -0.304688f , -0.624650f , -0.412140f , 0.663289f ,
--0.773438f , -0.140625f , -0.125000f , -0.624650f , -0.412140f , 0.663289f ,
-1.031250f , -0.039062f , -0.304688f , 0.407491f , 0.750641f , 0.520087f ,
-1.039062f , 0.000000f , -0.367188f , 0.407491f , 0.750641f , 0.520087f ,
-0.882812f , -0.023437f , -0.210938f , 0.407491f , 0.750641f , 0.520087f ,
--0.882812f , -0.023437f , -0.210938f , -0.407491f , 0.750641f , 0.520087f ,
--1.039062f , 0.000000f , -0.367188f , -0.407491f , 0.750641f , 0.520087f ,
--1.031250f , -0.039062f , -0.304688f , -0.407491f , 0.750641f , 0.520087f ,
-1.210938f , 0.078125f , -0.406250f , -0.264198f , 0.830336f , 0.490653f ,
-1.187500f , 0.093750f , -0.445312f , -0.264198f , 0.830336f , 0.490653f ,
-1.031250f , -0.039062f , -0.304688f , -0.264198f , 0.830336f , 0.490653f ,
--1.039062f , 0.000000f , -0.367188f , 0.269338f , 0.831434f , 0.485979f ,
--1.187500f , 0.093750f , -0.445312f , 0.269338f , 0.831434f , 0.485979f ,
--1.031250f , -0.039062f , -0.304688f , 0.269338f , 0.831434f , 0.485979f ,
-1.265625f , 0.289063f , -0.406250f , -0.863868f , 0.259161f , 0.431934f ,
-1.234375f , 0.250000f , -0.445312f , -0.863868f , 0.259161f , 0.431934f ,
-1.187500f , 0.093750f , -0.445312f , -0.863868f , 0.259161f , 0.431934f ,
--1.187500f , 0.093750f , -0.445312f , 0.863868f , 0.259161f , 0.431934f ,
--1.234375f , 0.250000f , -0.445312f , 0.863868f , 0.259161f , 0.431934f ,
--1.265625f , 0.289063f , -0.406250f , 0.863868f , 0.259161f , 0.431934f ,
-1.187500f , 0.437500f , -0.390625f , -0.528033f , -0.356779f , 0.770643f ,
-1.171875f , 0.359375f , -0.437500f , -0.528033f , -0.356779f , 0.770643f ,
-1.234375f , 0.250000f , -0.445312f , -0.528033f , -0.356779f , 0.770643f ,
--1.234375f , 0.250000f , -0.445312f , 0.528033f , -0.356779f , 0.770643f ,
--1.171875f , 0.359375f , -0.437500f , 0.528033f , -0.356779f , 0.770643f ,
--1.187500f , 0.437500f , -0.390625f , 0.528033f , -0.356779f , 0.770643f ,
-1.015625f , 0.414062f , -0.289062f , 0.415649f , -0.619625f , 0.665808f ,
-1.023438f , 0.343750f , -0.359375f , 0.415649f , -0.619625f , 0.665808f ,
-1.171875f , 0.359375f , -0.437500f , 0.415649f , -0.619625f , 0.665808f ,
--1.171875f , 0.359375f , -0.437500f , -0.415649f , -0.619625f , 0.665808f ,
--1.023438f , 0.343750f , -0.359375f , -0.415649f , -0.619625f , 0.665808f ,
--1.015625f , 0.414062f , -0.289062f , -0.415649f , -0.619625f , 0.665808f ,
-1.015625f , 0.414062f , -0.289062f , 0.688357f , -0.473246f , 0.549730f ,
-0.921875f , 0.359375f , -0.218750f , 0.688357f , -0.473246f , 0.549730f ,
-1.023438f , 0.343750f , -0.359375f , 0.688357f , -0.473246f , 0.549730f ,
--0.945312f , 0.304688f , -0.289062f , -0.714339f , -0.416698f , 0.562212f ,
--0.921875f , 0.359375f , -0.218750f , -0.714339f , -0.416698f , 0.562212f ,
--1.023438f , 0.343750f , -0.359375f , -0.714339f , -0.416698f , 0.562212f ,
-0.734375f , -0.046875f , 0.070312f , 0.622061f , -0.774466f , -0.115081f ,
-0.593750f , -0.125000f , -0.164062f , 0.622061f , -0.774466f , -0.115081f ,
-0.718750f , -0.023437f , -0.171875f , 0.622061f , -0.774466f , -0.115081f ,
--0.718750f , -0.023437f , -0.171875f , -0.622061f , -0.774466f , -0.115081f ,
--0.593750f , -0.125000f , -0.164062f , -0.622061f , -0.774466f , -0.115081f ,
--0.734375f , -0.046875f , 0.070312f , -0.622061f , -0.774466f , -0.115081f ,
-0.593750f , -0.125000f , -0.164062f , -0.184950f , 0.249468f , 0.950557f ,
-0.773438f , -0.140625f , -0.125000f , -0.184950f , 0.249468f , 0.950557f ,
-0.828125f , -0.070312f , -0.132812f , -0.184950f , 0.249468f , 0.950557f ,
--0.828125f , -0.070312f , -0.132812f , 0.184950f , 0.249468f , 0.950557f ,
--0.773438f , -0.140625f , -0.125000f , 0.184950f , 0.249468f , 0.950557f ,
--0.593750f , -0.125000f , -0.164062f , 0.184950f , 0.249468f , 0.950557f ,
-0.851562f , 0.234375f , 0.054688f , 0.887036f , -0.383852f , -0.256564f ,
-0.734375f , -0.046875f , 0.070312f , 0.887036f , -0.383852f , -0.256564f ,
-0.859375f , 0.320312f , -0.046875f , 0.887036f , -0.383852f , -0.256564f ,
--0.726562f , 0.000000f , -0.070312f , -0.914238f , -0.366421f , -0.172931f ,
--0.734375f , -0.046875f , 0.070312f , -0.914238f , -0.366421f , -0.172931f ,
--0.859375f , 0.320312f , -0.046875f , -0.914238f , -0.366421f , -0.172931f ,
-0.820312f , 0.328125f , -0.203125f , 0.371135f , 0.037113f , 0.927837f ,
-0.843750f , 0.289062f , -0.210937f , 0.371135f , 0.037113f , 0.927837f ,
-0.890625f , 0.406250f , -0.234375f , 0.371135f , 0.037113f , 0.927837f ,
--0.921875f , 0.359375f , -0.218750f , 0.120386f , 0.240772f , 0.963087f ,
--0.843750f , 0.289062f , -0.210937f , 0.120386f , 0.240772f , 0.963087f ,
--0.890625f , 0.406250f , -0.234375f , 0.120386f , 0.240772f , 0.963087f ,
-0.828125f , -0.070312f , -0.132812f , 0.137793f , 0.803793f , 0.578731f ,
-0.882812f , -0.023437f , -0.210938f , 0.137793f , 0.803793f , 0.578731f ,
-0.718750f , -0.023437f , -0.171875f , 0.137793f , 0.803793f , 0.578731f ,
--0.812500f , -0.015625f , -0.273438f , -0.023355f , 0.994904f , 0.098089f ,
--0.882812f , -0.023437f , -0.210938f , -0.023355f , 0.994904f , 0.098089f ,
--0.718750f , -0.023437f , -0.171875f , -0.023355f , 0.994904f , 0.098089f ,
-0.843750f , 0.015625f , -0.273438f , 0.580247f , 0.197531f , 0.790123f ,
-0.718750f , 0.039063f , -0.187500f , 0.580247f , 0.197531f , 0.790123f ,
-0.718750f , -0.023437f , -0.171875f , 0.580247f , 0.197531f , 0.790123f ,
--0.718750f , -0.023437f , -0.171875f , -0.580247f , 0.197531f , 0.790123f ,
--0.718750f , 0.039063f , -0.187500f , -0.580247f , 0.197531f , 0.790123f ,
--0.843750f , 0.015625f , -0.273438f , -0.580247f , 0.197531f , 0.790123f ,
-0.757812f , 0.093750f , -0.273438f , 0.102194f , 0.817553f , 0.566713f ,
-0.718750f , 0.039063f , -0.187500f , 0.102194f , 0.817553f , 0.566713f ,
-0.820312f , 0.085938f , -0.273438f , 0.102194f , 0.817553f , 0.566713f ,
--0.843750f , 0.015625f , -0.273438f , -0.580199f , 0.193400f , 0.791180f ,
--0.718750f , 0.039063f , -0.187500f , -0.580199f , 0.193400f , 0.791180f ,
--0.820312f , 0.085938f , -0.273438f , -0.580199f , 0.193400f , 0.791180f ,
-0.835938f , 0.171875f , -0.273438f , 0.749675f , -0.270716f , 0.603904f ,
-0.796875f , 0.203125f , -0.210937f , 0.749675f , -0.270716f , 0.603904f ,
-0.718750f , 0.039063f , -0.187500f , 0.749675f , -0.270716f , 0.603904f ,
--0.718750f , 0.039063f , -0.187500f , -0.749675f , -0.270716f , 0.603904f ,
--0.796875f , 0.203125f , -0.210937f , -0.749675f , -0.270716f , 0.603904f ,
--0.835938f , 0.171875f , -0.273438f , -0.749675f , -0.270716f , 0.603904f ,
-0.843750f , 0.289062f , -0.210937f , 0.689502f , -0.376092f , 0.618985f ,
-0.796875f , 0.203125f , -0.210937f , 0.689502f , -0.376092f , 0.618985f ,
-0.835938f , 0.171875f , -0.273438f , 0.689502f , -0.376092f , 0.618985f ,
--0.835938f , 0.171875f , -0.273438f , -0.689502f , -0.376092f , 0.618985f ,
--0.796875f , 0.203125f , -0.210937f , -0.689502f , -0.376092f , 0.618985f ,
--0.843750f , 0.289062f , -0.210937f , -0.689502f , -0.376092f , 0.618985f ,
-0.921875f , 0.359375f , -0.218750f , 0.466760f , -0.432937f , 0.771168f ,
-0.843750f , 0.289062f , -0.210937f , 0.466760f , -0.432937f , 0.771168f ,
-0.890625f , 0.242188f , -0.265625f , 0.466760f , -0.432937f , 0.771168f ,
--0.890625f , 0.242188f , -0.265625f , -0.466760f , -0.432937f , 0.771168f ,
--0.843750f , 0.289062f , -0.210937f , -0.466760f , -0.432937f , 0.771168f ,
--0.921875f , 0.359375f , -0.218750f , -0.466760f , -0.432937f , 0.771168f ,
-0.859375f , 0.320312f , -0.046875f , 0.877870f , -0.478838f , 0.007601f ,
-0.796875f , 0.203125f , -0.210937f , 0.877870f , -0.478838f , 0.007601f ,
-0.843750f , 0.289062f , -0.210937f , 0.877870f , -0.478838f , 0.007601f ,
--0.843750f , 0.289062f , -0.210937f , -0.877870f , -0.478838f , 0.007601f ,
--0.796875f , 0.203125f , -0.210937f , -0.877870f , -0.478838f , 0.007601f ,
--0.859375f , 0.320312f , -0.046875f , -0.877870f , -0.478838f , 0.007601f ,
-0.859375f , 0.320312f , -0.046875f , 0.912871f , -0.365148f , -0.182574f ,
-0.726562f , 0.000000f , -0.070312f , 0.912871f , -0.365148f , -0.182574f ,
-0.718750f , 0.039063f , -0.187500f , 0.912871f , -0.365148f , -0.182574f ,
--0.718750f , 0.039063f , -0.187500f , -0.912871f , -0.365148f , -0.182574f ,
--0.726562f , 0.000000f , -0.070312f , -0.912871f , -0.365148f , -0.182574f ,
--0.859375f , 0.320312f , -0.046875f , -0.912871f , -0.365148f , -0.182574f ,
-0.726562f , 0.000000f , -0.070312f , 0.997202f , -0.018131f , -0.072524f ,
-0.718750f , -0.023437f , -0.171875f , 0.997202f , -0.018131f , -0.072524f ,
-0.718750f , 0.039063f , -0.187500f , 0.997202f , -0.018131f , -0.072524f ,
--0.718750f , 0.039063f , -0.187500f , -0.997202f , -0.018131f , -0.072524f ,
--0.718750f , -0.023437f , -0.171875f , -0.997202f , -0.018131f , -0.072524f ,
--0.726562f , 0.000000f , -0.070312f , -0.997202f , -0.018131f , -0.072524f ,
-0.945312f , 0.304688f , -0.289062f , 0.772350f , -0.573034f , 0.274059f ,
-0.890625f , 0.242188f , -0.265625f , 0.772350f , -0.573034f , 0.274059f ,
-0.953125f , 0.289063f , -0.343750f , 0.772350f , -0.573034f , 0.274059f ,
--0.890625f , 0.234375f , -0.320312f , -0.676753f , -0.728811f , 0.104116f ,
--0.890625f , 0.242188f , -0.265625f , -0.676753f , -0.728811f , 0.104116f ,
--0.953125f , 0.289063f , -0.343750f , -0.676753f , -0.728811f , 0.104116f ,
-0.890625f , 0.242188f , -0.265625f , 0.775715f , -0.617699f , 0.129286f ,
-0.835938f , 0.171875f , -0.273438f , 0.775715f , -0.617699f , 0.129286f ,
-0.843750f , 0.171875f , -0.320312f , 0.775715f , -0.617699f , 0.129286f ,
--0.843750f , 0.171875f , -0.320312f , -0.775715f , -0.617699f , 0.129286f ,
--0.835938f , 0.171875f , -0.273438f , -0.775715f , -0.617699f , 0.129286f ,
--0.890625f , 0.242188f , -0.265625f , -0.775715f , -0.617699f , 0.129286f ,
-0.835938f , 0.171875f , -0.273438f , 0.702247f , -0.702247f , 0.117041f ,
-0.757812f , 0.093750f , -0.273438f , 0.702247f , -0.702247f , 0.117041f ,
-0.843750f , 0.171875f , -0.320312f , 0.702247f , -0.702247f , 0.117041f ,
--0.765625f , 0.093750f , -0.320312f , -0.702247f , -0.702247f , 0.117041f ,
--0.757812f , 0.093750f , -0.273438f , -0.702247f , -0.702247f , 0.117041f ,
--0.843750f , 0.171875f , -0.320312f , -0.702247f , -0.702247f , 0.117041f ,
-0.757812f , 0.093750f , -0.273438f , 0.122756f , 0.982049f , -0.143215f ,
-0.820312f , 0.085938f , -0.273438f , 0.122756f , 0.982049f , -0.143215f ,
-0.828125f , 0.078125f , -0.320312f , 0.122756f , 0.982049f , -0.143215f ,
--0.828125f , 0.078125f , -0.320312f , -0.122756f , 0.982049f , -0.143215f ,
--0.820312f , 0.085938f , -0.273438f , -0.122756f , 0.982049f , -0.143215f ,
--0.757812f , 0.093750f , -0.273438f , -0.122756f , 0.982049f , -0.143215f ,
-0.820312f , 0.085938f , -0.273438f , 0.937043f , 0.312348f , 0.156174f ,
-0.843750f , 0.015625f , -0.273438f , 0.937043f , 0.312348f , 0.156174f ,
-0.851562f , 0.015625f , -0.320312f , 0.937043f , 0.312348f , 0.156174f ,
--0.851562f , 0.015625f , -0.320312f , -0.937043f , 0.312348f , 0.156174f ,
--0.843750f , 0.015625f , -0.273438f , -0.937043f , 0.312348f , 0.156174f ,
--0.820312f , 0.085938f , -0.273438f , -0.937043f , 0.312348f , 0.156174f ,
-0.843750f , 0.015625f , -0.273438f , 0.702247f , -0.702247f , 0.117041f ,
-0.812500f , -0.015625f , -0.273438f , 0.702247f , -0.702247f , 0.117041f ,
-0.851562f , 0.015625f , -0.320312f , 0.702247f , -0.702247f , 0.117041f ,
--0.812500f , -0.015625f , -0.320312f , -0.624695f , -0.780869f , -0.000000f ,
--0.812500f , -0.015625f , -0.273438f , -0.624695f , -0.780869f , -0.000000f ,
--0.851562f , 0.015625f , -0.320312f , -0.624695f , -0.780869f , -0.000000f ,
-0.812500f , -0.015625f , -0.273438f , 0.110432f , 0.993884f , 0.000000f ,
-0.882812f , -0.023437f , -0.210938f , 0.110432f , 0.993884f , 0.000000f ,
-0.812500f , -0.015625f , -0.320312f , 0.110432f , 0.993884f , 0.000000f ,
--0.882812f , -0.015625f , -0.265625f , 0.109335f , 0.984015f , 0.140574f ,
--0.882812f , -0.023437f , -0.210938f , 0.109335f , 0.984015f , 0.140574f ,
--0.812500f , -0.015625f , -0.320312f , 0.109335f , 0.984015f , 0.140574f ,
-1.023438f , 0.343750f , -0.359375f , 0.661828f , -0.649341f , 0.374620f ,
-0.945312f , 0.304688f , -0.289062f , 0.661828f , -0.649341f , 0.374620f ,
-1.039062f , 0.328125f , -0.414062f , 0.661828f , -0.649341f , 0.374620f ,
--0.953125f , 0.289063f , -0.343750f , -0.586648f , -0.752681f , 0.298858f ,
--0.945312f , 0.304688f , -0.289062f , -0.586648f , -0.752681f , 0.298858f ,
--1.039062f , 0.328125f , -0.414062f , -0.586648f , -0.752681f , 0.298858f ,
-1.171875f , 0.359375f , -0.437500f , 0.296806f , -0.871867f , 0.389557f ,
-1.023438f , 0.343750f , -0.359375f , 0.296806f , -0.871867f , 0.389557f ,
-1.187500f , 0.343750f , -0.484375f , 0.296806f , -0.871867f , 0.389557f ,
--1.039062f , 0.328125f , -0.414062f , -0.252879f , -0.908786f , 0.331904f ,
--1.023438f , 0.343750f , -0.359375f , -0.252879f , -0.908786f , 0.331904f ,
--1.187500f , 0.343750f , -0.484375f , -0.252879f , -0.908786f , 0.331904f ,
-1.234375f , 0.250000f , -0.445312f , -0.827110f , -0.448433f , -0.338816f ,
-1.171875f , 0.359375f , -0.437500f , -0.827110f , -0.448433f , -0.338816f ,
-1.257812f , 0.242188f , -0.492188f , -0.827110f , -0.448433f , -0.338816f ,
--1.187500f , 0.343750f , -0.484375f , 0.822210f , -0.562565f , -0.086549f ,
--1.171875f , 0.359375f , -0.437500f , 0.822210f , -0.562565f , -0.086549f ,
--1.257812f , 0.242188f , -0.492188f , 0.822210f , -0.562565f , -0.086549f ,
-1.187500f , 0.093750f , -0.445312f , -0.847427f , 0.254228f , -0.466085f ,
-1.234375f , 0.250000f , -0.445312f , -0.847427f , 0.254228f , -0.466085f ,
-1.257812f , 0.242188f , -0.492188f , -0.847427f , 0.254228f , -0.466085f ,
--1.257812f , 0.242188f , -0.492188f , 0.847427f , 0.254228f , -0.466085f ,
--1.234375f , 0.250000f , -0.445312f , 0.847427f , 0.254228f , -0.466085f ,
--1.187500f , 0.093750f , -0.445312f , 0.847427f , 0.254228f , -0.466085f ,
-1.039062f , 0.000000f , -0.367188f , -0.635053f , 0.589692f , -0.498970f ,
-1.187500f , 0.093750f , -0.445312f , -0.635053f , 0.589692f , -0.498970f ,
-1.210938f , 0.085938f , -0.484375f , -0.635053f , 0.589692f , -0.498970f ,
--1.210938f , 0.085938f , -0.484375f , 0.635053f , 0.589692f , -0.498970f ,
--1.187500f , 0.093750f , -0.445312f , 0.635053f , 0.589692f , -0.498970f ,
--1.039062f , 0.000000f , -0.367188f , 0.635053f , 0.589692f , -0.498970f ,
-0.882812f , -0.023437f , -0.210938f , -0.172328f , 0.984732f , -0.024618f ,
-1.039062f , 0.000000f , -0.367188f , -0.172328f , 0.984732f , -0.024618f ,
-1.046875f , 0.000000f , -0.421875f , -0.172328f , 0.984732f , -0.024618f ,
--1.046875f , 0.000000f , -0.421875f , 0.172328f , 0.984732f , -0.024618f ,
--1.039062f , 0.000000f , -0.367188f , 0.172328f , 0.984732f , -0.024618f ,
--0.882812f , -0.023437f , -0.210938f , 0.172328f , 0.984732f , -0.024618f ,
-0.828125f , 0.078125f , -0.320312f , 0.149019f , 0.055882f , 0.987254f ,
-0.851562f , 0.015625f , -0.320312f , 0.149019f , 0.055882f , 0.987254f ,
-0.937500f , 0.062500f , -0.335938f , 0.149019f , 0.055882f , 0.987254f ,
--0.937500f , 0.062500f , -0.335938f , -0.149019f , 0.055882f , 0.987254f ,
--0.851562f , 0.015625f , -0.320312f , -0.149019f , 0.055882f , 0.987254f ,
--0.828125f , 0.078125f , -0.320312f , -0.149019f , 0.055882f , 0.987254f ,
-0.890625f , 0.109375f , -0.328125f , 0.312348f , 0.156174f , 0.937043f ,
-0.937500f , 0.062500f , -0.335938f , 0.312348f , 0.156174f , 0.937043f ,
-1.000000f , 0.125000f , -0.367188f , 0.312348f , 0.156174f , 0.937043f ,
--1.000000f , 0.125000f , -0.367188f , -0.312348f , 0.156174f , 0.937043f ,
--0.937500f , 0.062500f , -0.335938f , -0.312348f , 0.156174f , 0.937043f ,
--0.890625f , 0.109375f , -0.328125f , -0.312348f , 0.156174f , 0.937043f ,
-0.960938f , 0.171875f , -0.351562f , 0.382991f , 0.011264f , 0.923684f ,
-1.000000f , 0.125000f , -0.367188f , 0.382991f , 0.011264f , 0.923684f ,
-1.015625f , 0.234375f , -0.375000f , 0.382991f , 0.011264f , 0.923684f ,
--1.054688f , 0.187500f , -0.382812f , -0.236807f , 0.035521f , 0.970907f ,
--1.000000f , 0.125000f , -0.367188f , -0.236807f , 0.035521f , 0.970907f ,
--1.015625f , 0.234375f , -0.375000f , -0.236807f , 0.035521f , 0.970907f ,
-1.015625f , 0.234375f , -0.375000f , 0.155869f , -0.034638f , 0.987170f ,
-1.054688f , 0.187500f , -0.382812f , 0.155869f , -0.034638f , 0.987170f ,
-1.109375f , 0.210938f , -0.390625f , 0.155869f , -0.034638f , 0.987170f ,
--1.109375f , 0.210938f , -0.390625f , -0.155869f , -0.034638f , 0.987170f ,
--1.054688f , 0.187500f , -0.382812f , -0.155869f , -0.034638f , 0.987170f ,
--1.015625f , 0.234375f , -0.375000f , -0.155869f , -0.034638f , 0.987170f ,
-1.039062f , 0.328125f , -0.414062f , 0.328721f , 0.595807f , 0.732774f ,
-0.953125f , 0.289063f , -0.343750f , 0.328721f , 0.595807f , 0.732774f ,
-1.085938f , 0.273438f , -0.390625f , 0.328721f , 0.595807f , 0.732774f ,
--1.015625f , 0.234375f , -0.375000f , -0.308264f , -0.181332f , 0.933859f ,
--0.953125f , 0.289063f , -0.343750f , -0.308264f , -0.181332f , 0.933859f ,
--1.085938f , 0.273438f , -0.390625f , -0.308264f , -0.181332f , 0.933859f ,
-0.890625f , 0.234375f , -0.320312f , 0.400809f , -0.007157f , 0.916134f ,
-0.960938f , 0.171875f , -0.351562f , 0.400809f , -0.007157f , 0.916134f ,
-1.015625f , 0.234375f , -0.375000f , 0.400809f , -0.007157f , 0.916134f ,
--1.015625f , 0.234375f , -0.375000f , -0.400809f , -0.007157f , 0.916134f ,
--0.960938f , 0.171875f , -0.351562f , -0.400809f , -0.007157f , 0.916134f ,
--0.890625f , 0.234375f , -0.320312f , -0.400809f , -0.007157f , 0.916134f ,
-0.890625f , 0.234375f , -0.320312f , 0.082885f , -0.062164f , 0.994618f ,
-0.843750f , 0.171875f , -0.320312f , 0.082885f , -0.062164f , 0.994618f ,
-0.890625f , 0.109375f , -0.328125f , 0.082885f , -0.062164f , 0.994618f ,
--0.890625f , 0.109375f , -0.328125f , -0.082885f , -0.062164f , 0.994618f ,
--0.843750f , 0.171875f , -0.320312f , -0.082885f , -0.062164f , 0.994618f ,
--0.890625f , 0.234375f , -0.320312f , -0.082885f , -0.062164f , 0.994618f ,
-0.828125f , 0.078125f , -0.320312f , 0.041065f , 0.164260f , 0.985562f ,
-0.890625f , 0.109375f , -0.328125f , 0.041065f , 0.164260f , 0.985562f ,
-0.765625f , 0.093750f , -0.320312f , 0.041065f , 0.164260f , 0.985562f ,
--0.843750f , 0.171875f , -0.320312f , -0.071067f , -0.071067f , 0.994937f ,
--0.890625f , 0.109375f , -0.328125f , -0.071067f , -0.071067f , 0.994937f ,
--0.765625f , 0.093750f , -0.320312f , -0.071067f , -0.071067f , 0.994937f ,
-0.812500f , -0.015625f , -0.320312f , -0.487049f , 0.608811f , 0.626205f ,
-0.882812f , -0.015625f , -0.265625f , -0.487049f , 0.608811f , 0.626205f ,
-0.851562f , 0.015625f , -0.320312f , -0.487049f , 0.608811f , 0.626205f ,
--0.937500f , 0.062500f , -0.335938f , 0.298142f , 0.745356f , 0.596285f ,
--0.882812f , -0.015625f , -0.265625f , 0.298142f , 0.745356f , 0.596285f ,
--0.851562f , 0.015625f , -0.320312f , 0.298142f , 0.745356f , 0.596285f ,
-1.046875f , 0.000000f , -0.421875f , 0.557086f , -0.148556f , 0.817060f ,
-1.000000f , 0.125000f , -0.367188f , 0.557086f , -0.148556f , 0.817060f ,
-0.937500f , 0.062500f , -0.335938f , 0.557086f , -0.148556f , 0.817060f ,
--0.937500f , 0.062500f , -0.335938f , -0.557086f , -0.148556f , 0.817060f ,
--1.000000f , 0.125000f , -0.367188f , -0.557086f , -0.148556f , 0.817060f ,
--1.046875f , 0.000000f , -0.421875f , -0.557086f , -0.148556f , 0.817060f ,
-1.210938f , 0.085938f , -0.484375f , 0.452596f , -0.177557f , 0.873859f ,
-1.054688f , 0.187500f , -0.382812f , 0.452596f , -0.177557f , 0.873859f ,
-1.000000f , 0.125000f , -0.367188f , 0.452596f , -0.177557f , 0.873859f ,
--1.000000f , 0.125000f , -0.367188f , -0.452596f , -0.177557f , 0.873859f ,
--1.054688f , 0.187500f , -0.382812f , -0.452596f , -0.177557f , 0.873859f ,
--1.210938f , 0.085938f , -0.484375f , -0.452596f , -0.177557f , 0.873859f ,
-1.257812f , 0.242188f , -0.492188f , 0.411054f , -0.845597f , 0.340588f ,
-1.109375f , 0.210938f , -0.390625f , 0.411054f , -0.845597f , 0.340588f ,
-1.054688f , 0.187500f , -0.382812f , 0.411054f , -0.845597f , 0.340588f ,
--1.054688f , 0.187500f , -0.382812f , -0.411054f , -0.845597f , 0.340588f ,
--1.109375f , 0.210938f , -0.390625f , -0.411054f , -0.845597f , 0.340588f ,
--1.257812f , 0.242188f , -0.492188f , -0.411054f , -0.845597f , 0.340588f ,
-1.187500f , 0.343750f , -0.484375f , 0.525068f , 0.302312f , 0.795557f ,
-1.085938f , 0.273438f , -0.390625f , 0.525068f , 0.302312f , 0.795557f ,
-1.257812f , 0.242188f , -0.492188f , 0.525068f , 0.302312f , 0.795557f ,
--1.109375f , 0.210938f , -0.390625f , -0.525058f , 0.196897f , 0.827977f ,
--1.085938f , 0.273438f , -0.390625f , -0.525058f , 0.196897f , 0.827977f ,
--1.257812f , 0.242188f , -0.492188f , -0.525058f , 0.196897f , 0.827977f ,
-1.039062f , 0.328125f , -0.414062f , 0.297964f , 0.580246f , 0.757979f ,
-1.085938f , 0.273438f , -0.390625f , 0.297964f , 0.580246f , 0.757979f ,
-1.187500f , 0.343750f , -0.484375f , 0.297964f , 0.580246f , 0.757979f ,
--1.187500f , 0.343750f , -0.484375f , -0.297964f , 0.580246f , 0.757979f ,
--1.085938f , 0.273438f , -0.390625f , -0.297964f , 0.580246f , 0.757979f ,
--1.039062f , 0.328125f , -0.414062f , -0.297964f , 0.580246f , 0.757979f ,
-1.039062f , -0.101562f , -0.328125f , 0.073694f , -0.992789f , -0.094551f ,
-0.773438f , -0.140625f , -0.125000f , 0.073694f , -0.992789f , -0.094551f ,
-1.039062f , -0.085937f , -0.492188f , 0.073694f , -0.992789f , -0.094551f ,
--0.789062f , -0.125000f , -0.328125f , -0.110453f , -0.991568f , -0.067778f ,
--0.773438f , -0.140625f , -0.125000f , -0.110453f , -0.991568f , -0.067778f ,
--1.039062f , -0.085937f , -0.492188f , -0.110453f , -0.991568f , -0.067778f ,
-1.281250f , 0.054688f , -0.429688f , 0.585489f , -0.790410f , 0.180150f ,
-1.039062f , -0.101562f , -0.328125f , 0.585489f , -0.790410f , 0.180150f ,
-1.312500f , 0.054688f , -0.531250f , 0.585489f , -0.790410f , 0.180150f ,
--1.039062f , -0.085937f , -0.492188f , -0.446086f , -0.890959f , -0.084853f ,
--1.039062f , -0.101562f , -0.328125f , -0.446086f , -0.890959f , -0.084853f ,
--1.312500f , 0.054688f , -0.531250f , -0.446086f , -0.890959f , -0.084853f ,
-1.351562f , 0.320313f , -0.421875f , 0.924652f , -0.253129f , 0.284508f ,
-1.281250f , 0.054688f , -0.429688f , 0.924652f , -0.253129f , 0.284508f ,
-1.312500f , 0.054688f , -0.531250f , 0.924652f , -0.253129f , 0.284508f ,
--1.312500f , 0.054688f , -0.531250f , -0.924652f , -0.253129f , 0.284508f ,
--1.281250f , 0.054688f , -0.429688f , -0.924652f , -0.253129f , 0.284508f ,
--1.351562f , 0.320313f , -0.421875f , -0.924652f , -0.253129f , 0.284508f ,
-1.234375f , 0.507812f , -0.421875f , 0.847951f , 0.529969f , 0.010599f ,
-1.351562f , 0.320313f , -0.421875f , 0.847951f , 0.529969f , 0.010599f ,
-1.367188f , 0.296875f , -0.500000f , 0.847951f , 0.529969f , 0.010599f ,
--1.367188f , 0.296875f , -0.500000f , -0.847951f , 0.529969f , 0.010599f ,
--1.351562f , 0.320313f , -0.421875f , -0.847951f , 0.529969f , 0.010599f ,
--1.234375f , 0.507812f , -0.421875f , -0.847951f , 0.529969f , 0.010599f ,
-1.023438f , 0.476562f , -0.312500f , -0.298426f , 0.899733f , -0.318469f ,
-1.234375f , 0.507812f , -0.421875f , -0.298426f , 0.899733f , -0.318469f ,
-1.250000f , 0.468750f , -0.546875f , -0.298426f , 0.899733f , -0.318469f ,
--1.250000f , 0.468750f , -0.546875f , 0.298426f , 0.899733f , -0.318469f ,
--1.234375f , 0.507812f , -0.421875f , 0.298426f , 0.899733f , -0.318469f ,
--1.023438f , 0.476562f , -0.312500f , 0.298426f , 0.899733f , -0.318469f ,
-0.890625f , 0.406250f , -0.234375f , -0.542987f , 0.818859f , -0.186104f ,
-1.023438f , 0.476562f , -0.312500f , -0.542987f , 0.818859f , -0.186104f ,
-1.023438f , 0.437500f , -0.484375f , -0.542987f , 0.818859f , -0.186104f ,
--1.023438f , 0.437500f , -0.484375f , 0.542987f , 0.818859f , -0.186104f ,
--1.023438f , 0.476562f , -0.312500f , 0.542987f , 0.818859f , -0.186104f ,
--0.890625f , 0.406250f , -0.234375f , 0.542987f , 0.818859f , -0.186104f ,
-1.023438f , 0.437500f , -0.484375f , -0.548228f , -0.003883f , -0.836320f ,
-1.039062f , -0.085937f , -0.492188f , -0.548228f , -0.003883f , -0.836320f ,
-0.789062f , -0.125000f , -0.328125f , -0.548228f , -0.003883f , -0.836320f ,
--0.789062f , -0.125000f , -0.328125f , 0.548228f , -0.003883f , -0.836320f ,
--1.039062f , -0.085937f , -0.492188f , 0.548228f , -0.003883f , -0.836320f ,
--1.023438f , 0.437500f , -0.484375f , 0.548228f , -0.003883f , -0.836320f ,
-1.023438f , 0.437500f , -0.484375f , -0.266747f , 0.006422f , -0.963745f ,
-1.250000f , 0.468750f , -0.546875f , -0.266747f , 0.006422f , -0.963745f ,
-1.039062f , -0.085937f , -0.492188f , -0.266747f , 0.006422f , -0.963745f ,
--1.312500f , 0.054688f , -0.531250f , 0.113643f , -0.054588f , -0.992021f ,
--1.250000f , 0.468750f , -0.546875f , 0.113643f , -0.054588f , -0.992021f ,
--1.039062f , -0.085937f , -0.492188f , 0.113643f , -0.054588f , -0.992021f ,
-1.250000f , 0.468750f , -0.546875f , 0.404624f , 0.026581f , -0.914097f ,
-1.367188f , 0.296875f , -0.500000f , 0.404624f , 0.026581f , -0.914097f ,
-1.312500f , 0.054688f , -0.531250f , 0.404624f , 0.026581f , -0.914097f ,
--1.312500f , 0.054688f , -0.531250f , -0.404624f , 0.026581f , -0.914097f ,
--1.367188f , 0.296875f , -0.500000f , -0.404624f , 0.026581f , -0.914097f ,
--1.250000f , 0.468750f , -0.546875f , -0.404624f , 0.026581f , -0.914097f ,
-0.773438f , 0.265625f , -0.437500f , -0.748378f , 0.662721f , -0.027050f ,
-0.820312f , 0.328125f , -0.203125f , -0.748378f , 0.662721f , -0.027050f ,
-0.890625f , 0.406250f , -0.234375f , -0.748378f , 0.662721f , -0.027050f ,
--0.890625f , 0.406250f , -0.234375f , 0.748378f , 0.662721f , -0.027050f ,
--0.820312f , 0.328125f , -0.203125f , 0.748378f , 0.662721f , -0.027050f ,
--0.773438f , 0.265625f , -0.437500f , 0.748378f , 0.662721f , -0.027050f ,
-0.773438f , 0.265625f , -0.437500f , 0.684353f , -0.171088f , -0.708794f ,
-0.859375f , 0.382813f , -0.382812f , 0.684353f , -0.171088f , -0.708794f ,
-0.789062f , -0.125000f , -0.328125f , 0.684353f , -0.171088f , -0.708794f ,
--0.789062f , -0.125000f , -0.328125f , -0.684353f , -0.171088f , -0.708794f ,
--0.859375f , 0.382813f , -0.382812f , -0.684353f , -0.171088f , -0.708794f ,
--0.773438f , 0.265625f , -0.437500f , -0.684353f , -0.171088f , -0.708794f ,
-0.593750f , -0.125000f , -0.164062f , 0.007891f , -0.915403f , -0.402462f ,
-0.640625f , -0.007812f , -0.429688f , 0.007891f , -0.915403f , -0.402462f ,
-0.773438f , -0.140625f , -0.125000f , 0.007891f , -0.915403f , -0.402462f ,
--0.789062f , -0.125000f , -0.328125f , 0.570200f , -0.814571f , -0.106521f ,
--0.640625f , -0.007812f , -0.429688f , 0.570200f , -0.814571f , -0.106521f ,
--0.773438f , -0.140625f , -0.125000f , 0.570200f , -0.814571f , -0.106521f ,
-0.437500f , 0.164062f , 0.765625f , 0.666010f , -0.204926f , 0.717242f ,
-0.500000f , 0.093750f , 0.687500f , 0.666010f , -0.204926f , 0.717242f ,
-0.562500f , 0.242187f , 0.671875f , 0.666010f , -0.204926f , 0.717242f ,
--0.437500f , 0.164062f , 0.765625f , -0.663036f , -0.192883f , 0.723312f ,
--0.468750f , 0.242187f , 0.757812f , -0.663036f , -0.192883f , 0.723312f ,
--0.562500f , 0.242187f , 0.671875f , -0.663036f , -0.192883f , 0.723312f ,
-0.500000f , 0.093750f , 0.687500f , 0.830101f , -0.307090f , 0.465433f ,
-0.546875f , 0.054687f , 0.578125f , 0.830101f , -0.307090f , 0.465433f ,
-0.625000f , 0.242187f , 0.562500f , 0.830101f , -0.307090f , 0.465433f ,
--0.500000f , 0.093750f , 0.687500f , -0.828520f , -0.299015f , 0.473440f ,
--0.562500f , 0.242187f , 0.671875f , -0.828520f , -0.299015f , 0.473440f ,
--0.625000f , 0.242187f , 0.562500f , -0.828520f , -0.299015f , 0.473440f ,
-0.351562f , 0.031250f , 0.718750f , 0.408092f , -0.803818f , 0.432825f ,
-0.351562f , -0.023438f , 0.617188f , 0.408092f , -0.803818f , 0.432825f ,
-0.546875f , 0.054687f , 0.578125f , 0.408092f , -0.803818f , 0.432825f ,
--0.351562f , 0.031250f , 0.718750f , -0.425062f , -0.779280f , 0.460484f ,
--0.500000f , 0.093750f , 0.687500f , -0.425062f , -0.779280f , 0.460484f ,
--0.546875f , 0.054687f , 0.578125f , -0.425062f , -0.779280f , 0.460484f ,
-0.351562f , 0.132812f , 0.781250f , 0.371366f , -0.486617f , 0.790753f ,
-0.351562f , 0.031250f , 0.718750f , 0.371366f , -0.486617f , 0.790753f ,
-0.500000f , 0.093750f , 0.687500f , 0.371366f , -0.486617f , 0.790753f ,
--0.351562f , 0.132812f , 0.781250f , -0.338487f , -0.548583f , 0.764515f ,
--0.437500f , 0.164062f , 0.765625f , -0.338487f , -0.548583f , 0.764515f ,
--0.500000f , 0.093750f , 0.687500f , -0.338487f , -0.548583f , 0.764515f ,
-0.273438f , 0.164062f , 0.796875f , -0.099184f , -0.547220f , 0.831091f ,
-0.203125f , 0.093750f , 0.742188f , -0.099184f , -0.547220f , 0.831091f ,
-0.351562f , 0.031250f , 0.718750f , -0.099184f , -0.547220f , 0.831091f ,
--0.273438f , 0.164062f , 0.796875f , 0.039277f , -0.523693f , 0.851001f ,
--0.351562f , 0.132812f , 0.781250f , 0.039277f , -0.523693f , 0.851001f ,
--0.351562f , 0.031250f , 0.718750f , 0.039277f , -0.523693f , 0.851001f ,
-0.203125f , 0.093750f , 0.742188f , -0.258889f , -0.838801f , 0.478945f ,
-0.156250f , 0.054687f , 0.648438f , -0.258889f , -0.838801f , 0.478945f ,
-0.351562f , -0.023438f , 0.617188f , -0.258889f , -0.838801f , 0.478945f ,
--0.203125f , 0.093750f , 0.742188f , 0.283710f , -0.844293f , 0.454619f ,
--0.351562f , 0.031250f , 0.718750f , 0.283710f , -0.844293f , 0.454619f ,
--0.351562f , -0.023438f , 0.617188f , 0.283710f , -0.844293f , 0.454619f ,
-0.156250f , 0.054687f , 0.648438f , -0.774251f , -0.344719f , 0.530758f ,
-0.203125f , 0.093750f , 0.742188f , -0.774251f , -0.344719f , 0.530758f ,
-0.078125f , 0.242187f , 0.656250f , -0.774251f , -0.344719f , 0.530758f ,
--0.156250f , 0.054687f , 0.648438f , 0.774251f , -0.344719f , 0.530758f ,
--0.078125f , 0.242187f , 0.656250f , 0.774251f , -0.344719f , 0.530758f ,
--0.203125f , 0.093750f , 0.742188f , 0.774251f , -0.344719f , 0.530758f ,
-0.203125f , 0.093750f , 0.742188f , -0.470597f , -0.198146f , 0.859812f ,
-0.273438f , 0.164062f , 0.796875f , -0.470597f , -0.198146f , 0.859812f ,
-0.140625f , 0.242187f , 0.742188f , -0.470597f , -0.198146f , 0.859812f ,
--0.203125f , 0.093750f , 0.742188f , 0.470597f , -0.198146f , 0.859812f ,
--0.140625f , 0.242187f , 0.742188f , 0.470597f , -0.198146f , 0.859812f ,
--0.273438f , 0.164062f , 0.796875f , 0.470597f , -0.198146f , 0.859812f ,
-0.273438f , 0.328125f , 0.796875f , -0.482283f , 0.203067f , 0.852154f ,
-0.203125f , 0.390625f , 0.742188f , -0.482283f , 0.203067f , 0.852154f ,
-0.140625f , 0.242187f , 0.742188f , -0.482283f , 0.203067f , 0.852154f ,
--0.273438f , 0.328125f , 0.796875f , 0.467208f , 0.169894f , 0.867671f ,
--0.242188f , 0.242187f , 0.796875f , 0.467208f , 0.169894f , 0.867671f ,
--0.140625f , 0.242187f , 0.742188f , 0.467208f , 0.169894f , 0.867671f ,
-0.078125f , 0.242187f , 0.656250f , -0.764039f , 0.327842f , 0.555665f ,
-0.140625f , 0.242187f , 0.742188f , -0.764039f , 0.327842f , 0.555665f ,
-0.156250f , 0.437500f , 0.648438f , -0.764039f , 0.327842f , 0.555665f ,
--0.078125f , 0.242187f , 0.656250f , 0.764039f , 0.327842f , 0.555665f ,
--0.156250f , 0.437500f , 0.648438f , 0.764039f , 0.327842f , 0.555665f ,
--0.140625f , 0.242187f , 0.742188f , 0.764039f , 0.327842f , 0.555665f ,
-0.156250f , 0.437500f , 0.648438f , -0.241291f , 0.814358f , 0.527825f ,
-0.203125f , 0.390625f , 0.742188f , -0.241291f , 0.814358f , 0.527825f ,
-0.351562f , 0.515625f , 0.617188f , -0.241291f , 0.814358f , 0.527825f ,
--0.156250f , 0.437500f , 0.648438f , 0.241291f , 0.814358f , 0.527825f ,
--0.351562f , 0.515625f , 0.617188f , 0.241291f , 0.814358f , 0.527825f ,
--0.203125f , 0.390625f , 0.742188f , 0.241291f , 0.814358f , 0.527825f ,
-0.203125f , 0.390625f , 0.742188f , -0.115470f , 0.577350f , 0.808290f ,
-0.273438f , 0.328125f , 0.796875f , -0.115470f , 0.577350f , 0.808290f ,
-0.351562f , 0.453125f , 0.718750f , -0.115470f , 0.577350f , 0.808290f ,
--0.203125f , 0.390625f , 0.742188f , 0.115470f , 0.577350f , 0.808290f ,
--0.351562f , 0.453125f , 0.718750f , 0.115470f , 0.577350f , 0.808290f ,
--0.273438f , 0.328125f , 0.796875f , 0.115470f , 0.577350f , 0.808290f ,
-0.351562f , 0.453125f , 0.718750f , 0.378344f , 0.513467f , 0.770200f ,
-0.351562f , 0.359375f , 0.781250f , 0.378344f , 0.513467f , 0.770200f ,
-0.500000f , 0.390625f , 0.687500f , 0.378344f , 0.513467f , 0.770200f ,
--0.351562f , 0.453125f , 0.718750f , -0.378344f , 0.513467f , 0.770200f ,
--0.500000f , 0.390625f , 0.687500f , -0.378344f , 0.513467f , 0.770200f ,
--0.351562f , 0.359375f , 0.781250f , -0.378344f , 0.513467f , 0.770200f ,
-0.351562f , 0.515625f , 0.617188f , 0.406930f , 0.777955f , 0.478742f ,
-0.351562f , 0.453125f , 0.718750f , 0.406930f , 0.777955f , 0.478742f ,
-0.546875f , 0.437500f , 0.578125f , 0.406930f , 0.777955f , 0.478742f ,
--0.351562f , 0.515625f , 0.617188f , -0.406930f , 0.777955f , 0.478742f ,
--0.546875f , 0.437500f , 0.578125f , -0.406930f , 0.777955f , 0.478742f ,
--0.351562f , 0.453125f , 0.718750f , -0.406930f , 0.777955f , 0.478742f ,
-0.546875f , 0.437500f , 0.578125f , 0.827165f , 0.292478f , 0.479847f ,
-0.500000f , 0.390625f , 0.687500f , 0.827165f , 0.292478f , 0.479847f ,
-0.625000f , 0.242187f , 0.562500f , 0.827165f , 0.292478f , 0.479847f ,
--0.546875f , 0.437500f , 0.578125f , -0.827165f , 0.292478f , 0.479847f ,
--0.625000f , 0.242187f , 0.562500f , -0.827165f , 0.292478f , 0.479847f ,
--0.500000f , 0.390625f , 0.687500f , -0.827165f , 0.292478f , 0.479847f ,
-0.500000f , 0.390625f , 0.687500f , 0.674819f , 0.209652f , 0.707577f ,
-0.437500f , 0.328125f , 0.765625f , 0.674819f , 0.209652f , 0.707577f ,
-0.562500f , 0.242187f , 0.671875f , 0.674819f , 0.209652f , 0.707577f ,
--0.500000f , 0.390625f , 0.687500f , -0.674819f , 0.209652f , 0.707577f ,
--0.562500f , 0.242187f , 0.671875f , -0.674819f , 0.209652f , 0.707577f ,
--0.437500f , 0.328125f , 0.765625f , -0.674819f , 0.209652f , 0.707577f ,
-0.476562f , 0.242187f , 0.773438f , 0.847998f , 0.317999f , -0.423999f ,
-0.468750f , 0.242187f , 0.757812f , 0.847998f , 0.317999f , -0.423999f ,
-0.445312f , 0.335937f , 0.781250f , 0.847998f , 0.317999f , -0.423999f ,
--0.476562f , 0.242187f , 0.773438f , -0.847998f , 0.317999f , -0.423999f ,
--0.445312f , 0.335937f , 0.781250f , -0.847998f , 0.317999f , -0.423999f ,
--0.468750f , 0.242187f , 0.757812f , -0.847998f , 0.317999f , -0.423999f ,
-0.445312f , 0.335937f , 0.781250f , 0.214297f , 0.826574f , -0.520435f ,
-0.437500f , 0.328125f , 0.765625f , 0.214297f , 0.826574f , -0.520435f ,
-0.351562f , 0.375000f , 0.804688f , 0.214297f , 0.826574f , -0.520435f ,
--0.445312f , 0.335937f , 0.781250f , -0.214297f , 0.826574f , -0.520435f ,
--0.351562f , 0.375000f , 0.804688f , -0.214297f , 0.826574f , -0.520435f ,
--0.437500f , 0.328125f , 0.765625f , -0.214297f , 0.826574f , -0.520435f ,
-0.351562f , 0.375000f , 0.804688f , -0.432041f , 0.750388f , -0.500258f ,
-0.351562f , 0.359375f , 0.781250f , -0.432041f , 0.750388f , -0.500258f ,
-0.265625f , 0.335937f , 0.820312f , -0.432041f , 0.750388f , -0.500258f ,
--0.351562f , 0.375000f , 0.804688f , 0.432041f , 0.750388f , -0.500258f ,
--0.265625f , 0.335937f , 0.820312f , 0.432041f , 0.750388f , -0.500258f ,
--0.351562f , 0.359375f , 0.781250f , 0.432041f , 0.750388f , -0.500258f ,
-0.265625f , 0.335937f , 0.820312f , -0.846181f , 0.352575f , -0.399585f ,
-0.273438f , 0.328125f , 0.796875f , -0.846181f , 0.352575f , -0.399585f ,
-0.226562f , 0.242187f , 0.820312f , -0.846181f , 0.352575f , -0.399585f ,
--0.265625f , 0.335937f , 0.820312f , 0.846181f , 0.352575f , -0.399585f ,
--0.226562f , 0.242187f , 0.820312f , 0.846181f , 0.352575f , -0.399585f ,
--0.273438f , 0.328125f , 0.796875f , 0.846181f , 0.352575f , -0.399585f ,
-0.273438f , 0.164062f , 0.796875f , -0.832845f , -0.378566f , -0.403804f ,
-0.265625f , 0.156250f , 0.820312f , -0.832845f , -0.378566f , -0.403804f ,
-0.226562f , 0.242187f , 0.820312f , -0.832845f , -0.378566f , -0.403804f ,
--0.273438f , 0.164062f , 0.796875f , 0.789474f , -0.315789f , -0.526316f ,
--0.242188f , 0.242187f , 0.796875f , 0.789474f , -0.315789f , -0.526316f ,
--0.226562f , 0.242187f , 0.820312f , 0.789474f , -0.315789f , -0.526316f ,
-0.351562f , 0.132812f , 0.781250f , -0.432041f , -0.750388f , -0.500259f ,
-0.351562f , 0.117187f , 0.804688f , -0.432041f , -0.750388f , -0.500259f ,
-0.265625f , 0.156250f , 0.820312f , -0.432041f , -0.750388f , -0.500259f ,
--0.351562f , 0.132812f , 0.781250f , 0.408248f , -0.816497f , -0.408248f ,
--0.273438f , 0.164062f , 0.796875f , 0.408248f , -0.816497f , -0.408248f ,
--0.265625f , 0.156250f , 0.820312f , 0.408248f , -0.816497f , -0.408248f ,
-0.437500f , 0.164062f , 0.765625f , 0.214297f , -0.826574f , -0.520435f ,
-0.445312f , 0.156250f , 0.781250f , 0.214297f , -0.826574f , -0.520435f ,
-0.351562f , 0.117187f , 0.804688f , 0.214297f , -0.826574f , -0.520435f ,
--0.437500f , 0.164062f , 0.765625f , -0.197727f , -0.815623f , -0.543749f ,
--0.351562f , 0.132812f , 0.781250f , -0.197727f , -0.815623f , -0.543749f ,
--0.351562f , 0.117187f , 0.804688f , -0.197727f , -0.815623f , -0.543749f ,
-0.468750f , 0.242187f , 0.757812f , 0.839964f , -0.343622f , -0.419982f ,
-0.476562f , 0.242187f , 0.773438f , 0.839964f , -0.343622f , -0.419982f ,
-0.445312f , 0.156250f , 0.781250f , 0.839964f , -0.343622f , -0.419982f ,
--0.468750f , 0.242187f , 0.757812f , -0.752217f , -0.356313f , -0.554265f ,
--0.437500f , 0.164062f , 0.765625f , -0.752217f , -0.356313f , -0.554265f ,
--0.445312f , 0.156250f , 0.781250f , -0.752217f , -0.356313f , -0.554265f ,
-0.000000f , -0.984375f , 0.578125f , 0.141433f , -0.839474f , 0.524671f ,
-0.179688f , -0.968750f , 0.554687f , 0.141433f , -0.839474f , 0.524671f ,
-0.000000f , -0.945312f , 0.640625f , 0.141433f , -0.839474f , 0.524671f ,
-0.000000f , -0.984375f , 0.578125f , -0.141433f , -0.839474f , 0.524671f ,
-0.000000f , -0.945312f , 0.640625f , -0.141433f , -0.839474f , 0.524671f ,
--0.179688f , -0.968750f , 0.554687f , -0.141433f , -0.839474f , 0.524671f ,
-0.179688f , -0.968750f , 0.554687f , 0.233571f , -0.850198f , 0.471813f ,
-0.328125f , -0.945312f , 0.523437f , 0.233571f , -0.850198f , 0.471813f ,
-0.164062f , -0.929688f , 0.632812f , 0.233571f , -0.850198f , 0.471813f ,
--0.179688f , -0.968750f , 0.554687f , -0.233571f , -0.850198f , 0.471813f ,
--0.164062f , -0.929688f , 0.632812f , -0.233571f , -0.850198f , 0.471813f ,
--0.328125f , -0.945312f , 0.523437f , -0.233571f , -0.850198f , 0.471813f ,
-0.265625f , -0.820312f , 0.664062f , 0.623035f , -0.426287f , 0.655826f ,
-0.234375f , -0.914062f , 0.632812f , 0.623035f , -0.426287f , 0.655826f ,
-0.328125f , -0.945312f , 0.523437f , 0.623035f , -0.426287f , 0.655826f ,
--0.265625f , -0.820312f , 0.664062f , -0.548630f , -0.488780f , 0.678306f ,
--0.367188f , -0.890625f , 0.531250f , -0.548630f , -0.488780f , 0.678306f ,
--0.328125f , -0.945312f , 0.523437f , -0.548630f , -0.488780f , 0.678306f ,
-0.250000f , -0.703125f , 0.687500f , 0.789793f , -0.017320f , 0.613129f ,
-0.265625f , -0.820312f , 0.664062f , 0.789793f , -0.017320f , 0.613129f ,
-0.367188f , -0.890625f , 0.531250f , 0.789793f , -0.017320f , 0.613129f ,
--0.250000f , -0.703125f , 0.687500f , -0.756147f , -0.069645f , 0.650685f ,
--0.351562f , -0.695312f , 0.570312f , -0.756147f , -0.069645f , 0.650685f ,
--0.367188f , -0.890625f , 0.531250f , -0.756147f , -0.069645f , 0.650685f ,
-0.210938f , -0.445313f , 0.710938f , 0.752771f , 0.054417f , 0.656029f ,
-0.250000f , -0.703125f , 0.687500f , 0.752771f , 0.054417f , 0.656029f ,
-0.351562f , -0.695312f , 0.570312f , 0.752771f , 0.054417f , 0.656029f ,
--0.210938f , -0.445313f , 0.710938f , -0.801465f , 0.121434f , 0.585582f ,
--0.312500f , -0.437500f , 0.570312f , -0.801465f , 0.121434f , 0.585582f ,
--0.351562f , -0.695312f , 0.570312f , -0.801465f , 0.121434f , 0.585582f ,
-0.437500f , -0.140625f , 0.531250f , 0.435894f , -0.688253f , 0.579917f ,
-0.398438f , -0.046875f , 0.671875f , 0.435894f , -0.688253f , 0.579917f ,
-0.125000f , -0.101563f , 0.812500f , 0.435894f , -0.688253f , 0.579917f ,
--0.437500f , -0.140625f , 0.531250f , -0.229854f , -0.896039f , 0.379843f ,
--0.203125f , -0.187500f , 0.562500f , -0.229854f , -0.896039f , 0.379843f ,
--0.125000f , -0.101563f , 0.812500f , -0.229854f , -0.896039f , 0.379843f ,
-0.398438f , -0.046875f , 0.671875f , 0.442082f , -0.684793f , 0.579329f ,
-0.437500f , -0.140625f , 0.531250f , 0.442082f , -0.684793f , 0.579329f ,
-0.617188f , 0.054687f , 0.625000f , 0.442082f , -0.684793f , 0.579329f ,
--0.398438f , -0.046875f , 0.671875f , -0.442082f , -0.684793f , 0.579329f ,
--0.617188f , 0.054687f , 0.625000f , -0.442082f , -0.684793f , 0.579329f ,
--0.437500f , -0.140625f , 0.531250f , -0.442082f , -0.684793f , 0.579329f ,
-0.828125f , 0.148437f , 0.445312f , 0.689836f , -0.414590f , 0.593500f ,
-0.726562f , 0.203125f , 0.601562f , 0.689836f , -0.414590f , 0.593500f ,
-0.617188f , 0.054687f , 0.625000f , 0.689836f , -0.414590f , 0.593500f ,
--0.828125f , 0.148437f , 0.445312f , -0.689086f , -0.423923f , 0.587750f ,
--0.632812f , -0.039063f , 0.539062f , -0.689086f , -0.423923f , 0.587750f ,
--0.617188f , 0.054687f , 0.625000f , -0.689086f , -0.423923f , 0.587750f ,
-0.726562f , 0.203125f , 0.601562f , 0.766752f , -0.256891f , 0.588301f ,
-0.828125f , 0.148437f , 0.445312f , 0.766752f , -0.256891f , 0.588301f ,
-0.742188f , 0.375000f , 0.656250f , 0.766752f , -0.256891f , 0.588301f ,
--0.726562f , 0.203125f , 0.601562f , -0.766752f , -0.256891f , 0.588301f ,
--0.742188f , 0.375000f , 0.656250f , -0.766752f , -0.256891f , 0.588301f ,
--0.828125f , 0.148437f , 0.445312f , -0.766752f , -0.256891f , 0.588301f ,
-0.742188f , 0.375000f , 0.656250f , 0.573765f , -0.440072f , 0.690746f ,
-0.859375f , 0.429687f , 0.593750f , 0.573765f , -0.440072f , 0.690746f ,
-0.687500f , 0.414062f , 0.726562f , 0.573765f , -0.440072f , 0.690746f ,
--0.742188f , 0.375000f , 0.656250f , -0.573765f , -0.440072f , 0.690746f ,
--0.687500f , 0.414062f , 0.726562f , -0.573765f , -0.440072f , 0.690746f ,
--0.859375f , 0.429687f , 0.593750f , -0.573765f , -0.440072f , 0.690746f ,
-0.687500f , 0.414062f , 0.726562f , 0.505128f , 0.650645f , 0.567015f ,
-0.710938f , 0.484375f , 0.625000f , 0.505128f , 0.650645f , 0.567015f ,
-0.437500f , 0.546875f , 0.796875f , 0.505128f , 0.650645f , 0.567015f ,
--0.687500f , 0.414062f , 0.726562f , -0.505128f , 0.650645f , 0.567015f ,
--0.437500f , 0.546875f , 0.796875f , -0.505128f , 0.650645f , 0.567015f ,
--0.710938f , 0.484375f , 0.625000f , -0.505128f , 0.650645f , 0.567015f ,
-0.320312f , 0.757812f , 0.734375f , 0.581007f , 0.510582f , 0.633827f ,
-0.312500f , 0.640625f , 0.835938f , 0.581007f , 0.510582f , 0.633827f ,
-0.437500f , 0.546875f , 0.796875f , 0.581007f , 0.510582f , 0.633827f ,
--0.320312f , 0.757812f , 0.734375f , -0.630433f , 0.520792f , 0.575613f ,
--0.492188f , 0.601562f , 0.687500f , -0.630433f , 0.520792f , 0.575613f ,
--0.437500f , 0.546875f , 0.796875f , -0.630433f , 0.520792f , 0.575613f ,
-0.312500f , 0.640625f , 0.835938f , -0.032791f , 0.655826f , 0.754200f ,
-0.320312f , 0.757812f , 0.734375f , -0.032791f , 0.655826f , 0.754200f ,
-0.203125f , 0.617187f , 0.851562f , -0.032791f , 0.655826f , 0.754200f ,
--0.312500f , 0.640625f , 0.835938f , 0.032791f , 0.655826f , 0.754200f ,
--0.203125f , 0.617187f , 0.851562f , 0.032791f , 0.655826f , 0.754200f ,
--0.320312f , 0.757812f , 0.734375f , 0.032791f , 0.655826f , 0.754200f ,
-0.203125f , 0.617187f , 0.851562f , -0.655169f , 0.326496f , 0.681289f ,
-0.156250f , 0.718750f , 0.757813f , -0.655169f , 0.326496f , 0.681289f ,
-0.101562f , 0.429687f , 0.843750f , -0.655169f , 0.326496f , 0.681289f ,
--0.203125f , 0.617187f , 0.851562f , 0.655169f , 0.326496f , 0.681289f ,
--0.101562f , 0.429687f , 0.843750f , 0.655169f , 0.326496f , 0.681289f ,
--0.156250f , 0.718750f , 0.757813f , 0.655169f , 0.326496f , 0.681289f ,
-0.101562f , 0.429687f , 0.843750f , -0.567735f , 0.555907f , 0.607161f ,
-0.062500f , 0.492187f , 0.750000f , -0.567735f , 0.555907f , 0.607161f ,
-0.000000f , 0.351562f , 0.820312f , -0.567735f , 0.555907f , 0.607161f ,
--0.101562f , 0.429687f , 0.843750f , 0.567735f , 0.555907f , 0.607161f ,
-0.000000f , 0.351562f , 0.820312f , 0.567735f , 0.555907f , 0.607161f ,
--0.062500f , 0.492187f , 0.750000f , 0.567735f , 0.555907f , 0.607161f ,
-0.101562f , 0.429687f , 0.843750f , 0.648351f , -0.378710f , 0.660470f ,
-0.164062f , 0.414062f , 0.773438f , 0.648351f , -0.378710f , 0.660470f ,
-0.203125f , 0.617187f , 0.851562f , 0.648351f , -0.378710f , 0.660470f ,
--0.101562f , 0.429687f , 0.843750f , -0.648351f , -0.378710f , 0.660470f ,
--0.203125f , 0.617187f , 0.851562f , -0.648351f , -0.378710f , 0.660470f ,
--0.164062f , 0.414062f , 0.773438f , -0.648351f , -0.378710f , 0.660470f ,
-0.328125f , 0.476562f , 0.742188f , 0.222422f , -0.467656f , 0.855468f ,
-0.312500f , 0.640625f , 0.835938f , 0.222422f , -0.467656f , 0.855468f ,
-0.203125f , 0.617187f , 0.851562f , 0.222422f , -0.467656f , 0.855468f ,
--0.328125f , 0.476562f , 0.742188f , -0.218052f , -0.470992f , 0.854763f ,
--0.250000f , 0.468750f , 0.757812f , -0.218052f , -0.470992f , 0.854763f ,
--0.203125f , 0.617187f , 0.851562f , -0.218052f , -0.470992f , 0.854763f ,
-0.328125f , 0.476562f , 0.742188f , 0.009908f , -0.495403f , 0.868607f ,
-0.429688f , 0.437500f , 0.718750f , 0.009908f , -0.495403f , 0.868607f ,
-0.312500f , 0.640625f , 0.835938f , 0.009908f , -0.495403f , 0.868607f ,
--0.328125f , 0.476562f , 0.742188f , -0.009908f , -0.495403f , 0.868607f ,
--0.312500f , 0.640625f , 0.835938f , -0.009908f , -0.495403f , 0.868607f ,
--0.429688f , 0.437500f , 0.718750f , -0.009908f , -0.495403f , 0.868607f ,
-0.429688f , 0.437500f , 0.718750f , 0.046213f , -0.582801f , 0.811300f ,
-0.601562f , 0.375000f , 0.664062f , 0.046213f , -0.582801f , 0.811300f ,
-0.437500f , 0.546875f , 0.796875f , 0.046213f , -0.582801f , 0.811300f ,
--0.429688f , 0.437500f , 0.718750f , -0.046213f , -0.582801f , 0.811300f ,
--0.437500f , 0.546875f , 0.796875f , -0.046213f , -0.582801f , 0.811300f ,
--0.601562f , 0.375000f , 0.664062f , -0.046213f , -0.582801f , 0.811300f ,
-0.601562f , 0.375000f , 0.664062f , -0.426251f , -0.377537f , 0.822056f ,
-0.640625f , 0.296875f , 0.648438f , -0.426251f , -0.377537f , 0.822056f ,
-0.687500f , 0.414062f , 0.726562f , -0.426251f , -0.377537f , 0.822056f ,
--0.601562f , 0.375000f , 0.664062f , 0.426251f , -0.377537f , 0.822056f ,
--0.687500f , 0.414062f , 0.726562f , 0.426251f , -0.377537f , 0.822056f ,
--0.640625f , 0.296875f , 0.648438f , 0.426251f , -0.377537f , 0.822056f ,
-0.640625f , 0.296875f , 0.648438f , -0.086092f , 0.012299f , 0.996211f ,
-0.625000f , 0.187500f , 0.648438f , -0.086092f , 0.012299f , 0.996211f ,
-0.742188f , 0.375000f , 0.656250f , -0.086092f , 0.012299f , 0.996211f ,
--0.640625f , 0.296875f , 0.648438f , 0.086092f , 0.012299f , 0.996211f ,
--0.742188f , 0.375000f , 0.656250f , 0.086092f , 0.012299f , 0.996211f ,
--0.625000f , 0.187500f , 0.648438f , 0.086092f , 0.012299f , 0.996211f ,
-0.625000f , 0.187500f , 0.648438f , 0.437362f , -0.306154f , 0.845567f ,
-0.492188f , 0.062500f , 0.671875f , 0.437362f , -0.306154f , 0.845567f ,
-0.726562f , 0.203125f , 0.601562f , 0.437362f , -0.306154f , 0.845567f ,
--0.625000f , 0.187500f , 0.648438f , -0.437362f , -0.306154f , 0.845567f ,
--0.726562f , 0.203125f , 0.601562f , -0.437362f , -0.306154f , 0.845567f ,
--0.492188f , 0.062500f , 0.671875f , -0.437362f , -0.306154f , 0.845567f ,
-0.398438f , -0.046875f , 0.671875f , 0.322277f , -0.276237f , 0.905445f ,
-0.617188f , 0.054687f , 0.625000f , 0.322277f , -0.276237f , 0.905445f ,
-0.492188f , 0.062500f , 0.671875f , 0.322277f , -0.276237f , 0.905445f ,
--0.398438f , -0.046875f , 0.671875f , -0.357888f , -0.306761f , 0.881938f ,
--0.375000f , 0.015625f , 0.703125f , -0.357888f , -0.306761f , 0.881938f ,
--0.492188f , 0.062500f , 0.671875f , -0.357888f , -0.306761f , 0.881938f ,
-0.125000f , -0.101563f , 0.812500f , 0.481543f , -0.240772f , 0.842701f ,
-0.398438f , -0.046875f , 0.671875f , 0.481543f , -0.240772f , 0.842701f ,
-0.375000f , 0.015625f , 0.703125f , 0.481543f , -0.240772f , 0.842701f ,
--0.125000f , -0.101563f , 0.812500f , -0.306946f , 0.211293f , 0.927976f ,
--0.203125f , 0.093750f , 0.742188f , -0.306946f , 0.211293f , 0.927976f ,
--0.375000f , 0.015625f , 0.703125f , -0.306946f , 0.211293f , 0.927976f ,
-0.164062f , 0.140625f , 0.750000f , -0.292159f , 0.282884f , 0.913575f ,
-0.000000f , 0.046875f , 0.726562f , -0.292159f , 0.282884f , 0.913575f ,
-0.125000f , -0.101563f , 0.812500f , -0.292159f , 0.282884f , 0.913575f ,
--0.164062f , 0.140625f , 0.750000f , -0.386906f , 0.171414f , 0.906047f ,
--0.203125f , 0.093750f , 0.742188f , -0.386906f , 0.171414f , 0.906047f ,
--0.125000f , -0.101563f , 0.812500f , -0.386906f , 0.171414f , 0.906047f ,
-0.125000f , 0.304687f , 0.765625f , 0.334643f , -0.185509f , 0.923905f ,
-0.164062f , 0.414062f , 0.773438f , 0.334643f , -0.185509f , 0.923905f ,
-0.000000f , 0.351562f , 0.820312f , 0.334643f , -0.185509f , 0.923905f ,
--0.125000f , 0.304687f , 0.765625f , -0.334643f , -0.185509f , 0.923905f ,
-0.000000f , 0.351562f , 0.820312f , -0.334643f , -0.185509f , 0.923905f ,
--0.164062f , 0.414062f , 0.773438f , -0.334643f , -0.185509f , 0.923905f ,
-0.000000f , 0.351562f , 0.820312f , 0.054742f , -0.361903f , 0.930607f ,
-0.000000f , 0.210937f , 0.765625f , 0.054742f , -0.361903f , 0.930607f ,
-0.132812f , 0.210937f , 0.757812f , 0.054742f , -0.361903f , 0.930607f ,
-0.000000f , 0.351562f , 0.820312f , -0.386342f , -0.044578f , 0.921278f ,
--0.125000f , 0.304687f , 0.765625f , -0.386342f , -0.044578f , 0.921278f ,
--0.132812f , 0.210937f , 0.757812f , -0.386342f , -0.044578f , 0.921278f ,
-0.000000f , 0.210937f , 0.765625f , 0.057130f , -0.231242f , 0.971217f ,
-0.000000f , 0.046875f , 0.726562f , 0.057130f , -0.231242f , 0.971217f ,
-0.132812f , 0.210937f , 0.757812f , 0.057130f , -0.231242f , 0.971217f ,
-0.000000f , 0.210937f , 0.765625f , -0.057130f , -0.231242f , 0.971217f ,
--0.132812f , 0.210937f , 0.757812f , -0.057130f , -0.231242f , 0.971217f ,
-0.000000f , 0.046875f , 0.726562f , -0.057130f , -0.231242f , 0.971217f ,
-0.000000f , -0.890625f , 0.687500f , 0.097666f , -0.647680f , 0.755626f ,
-0.000000f , -0.945312f , 0.640625f , 0.097666f , -0.647680f , 0.755626f ,
-0.164062f , -0.929688f , 0.632812f , 0.097666f , -0.647680f , 0.755626f ,
-0.000000f , -0.890625f , 0.687500f , -0.020355f , -0.783677f , 0.620835f ,
--0.062500f , -0.882813f , 0.695312f , -0.020355f , -0.783677f , 0.620835f ,
--0.164062f , -0.929688f , 0.632812f , -0.020355f , -0.783677f , 0.620835f ,
-0.062500f , -0.882813f , 0.695312f , 0.147043f , -0.661693f , 0.735214f ,
-0.164062f , -0.929688f , 0.632812f , 0.147043f , -0.661693f , 0.735214f ,
-0.234375f , -0.914062f , 0.632812f , 0.147043f , -0.661693f , 0.735214f ,
--0.062500f , -0.882813f , 0.695312f , -0.207390f , -0.518476f , 0.829561f ,
--0.117188f , -0.835938f , 0.710937f , -0.207390f , -0.518476f , 0.829561f ,
--0.234375f , -0.914062f , 0.632812f , -0.207390f , -0.518476f , 0.829561f ,
-0.265625f , -0.820312f , 0.664062f , 0.175467f , -0.363467f , 0.914934f ,
-0.109375f , -0.718750f , 0.734375f , 0.175467f , -0.363467f , 0.914934f ,
-0.234375f , -0.914062f , 0.632812f , 0.175467f , -0.363467f , 0.914934f ,
--0.265625f , -0.820312f , 0.664062f , -0.175467f , -0.363467f , 0.914934f ,
--0.234375f , -0.914062f , 0.632812f , -0.175467f , -0.363467f , 0.914934f ,
--0.109375f , -0.718750f , 0.734375f , -0.175467f , -0.363467f , 0.914934f ,
-0.078125f , -0.445313f , 0.750000f , 0.332048f , -0.007298f , 0.943234f ,
-0.117188f , -0.687500f , 0.734375f , 0.332048f , -0.007298f , 0.943234f ,
-0.250000f , -0.703125f , 0.687500f , 0.332048f , -0.007298f , 0.943234f ,
--0.078125f , -0.445313f , 0.750000f , -0.281888f , -0.044419f , 0.958419f ,
--0.210938f , -0.445313f , 0.710938f , -0.281888f , -0.044419f , 0.958419f ,
--0.250000f , -0.703125f , 0.687500f , -0.281888f , -0.044419f , 0.958419f ,
-0.265625f , -0.820312f , 0.664062f , 0.313971f , -0.145772f , 0.938175f ,
-0.250000f , -0.703125f , 0.687500f , 0.313971f , -0.145772f , 0.938175f ,
-0.117188f , -0.687500f , 0.734375f , 0.313971f , -0.145772f , 0.938175f ,
--0.265625f , -0.820312f , 0.664062f , -0.359533f , -0.089883f , 0.928793f ,
--0.109375f , -0.718750f , 0.734375f , -0.359533f , -0.089883f , 0.928793f ,
--0.117188f , -0.687500f , 0.734375f , -0.359533f , -0.089883f , 0.928793f ,
-0.078125f , -0.445313f , 0.750000f , 0.000000f , 0.049938f , 0.998752f ,
-0.085938f , -0.289063f , 0.742188f , 0.000000f , 0.049938f , 0.998752f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , 0.049938f , 0.998752f ,
--0.078125f , -0.445313f , 0.750000f , 0.000000f , 0.049938f , 0.998752f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , 0.049938f , 0.998752f ,
--0.085938f , -0.289063f , 0.742188f , 0.000000f , 0.049938f , 0.998752f ,
-0.000000f , -0.679688f , 0.734375f , -0.004434f , -0.066518f , 0.997775f ,
-0.117188f , -0.687500f , 0.734375f , -0.004434f , -0.066518f , 0.997775f ,
-0.000000f , -0.445313f , 0.750000f , -0.004434f , -0.066518f , 0.997775f ,
-0.000000f , -0.679688f , 0.734375f , 0.004434f , -0.066518f , 0.997775f ,
-0.000000f , -0.445313f , 0.750000f , 0.004434f , -0.066518f , 0.997775f ,
--0.117188f , -0.687500f , 0.734375f , 0.004434f , -0.066518f , 0.997775f ,
-0.000000f , -0.679688f , 0.734375f , 0.000000f , -0.000001f , 1.000000f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.000001f , 1.000000f ,
-0.117188f , -0.687500f , 0.734375f , 0.000000f , -0.000001f , 1.000000f ,
-0.000000f , -0.679688f , 0.734375f , 0.000000f , -0.000001f , 1.000000f ,
--0.117188f , -0.687500f , 0.734375f , 0.000000f , -0.000001f , 1.000000f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.000001f , 1.000000f ,
-0.132812f , -0.226563f , 0.796875f , 0.744073f , -0.658218f , 0.114473f ,
-0.093750f , -0.273438f , 0.781250f , 0.744073f , -0.658218f , 0.114473f ,
-0.085938f , -0.289063f , 0.742188f , 0.744073f , -0.658218f , 0.114473f ,
--0.132812f , -0.226563f , 0.796875f , -0.847337f , -0.511933f , -0.141223f ,
--0.125000f , -0.226563f , 0.750000f , -0.847337f , -0.511933f , -0.141223f ,
--0.085938f , -0.289063f , 0.742188f , -0.847337f , -0.511933f , -0.141223f ,
-0.125000f , -0.226563f , 0.750000f , 0.949990f , 0.269164f , -0.158332f ,
-0.101562f , -0.148438f , 0.742188f , 0.949990f , 0.269164f , -0.158332f ,
-0.132812f , -0.226563f , 0.796875f , 0.949990f , 0.269164f , -0.158332f ,
--0.125000f , -0.226563f , 0.750000f , -0.949990f , 0.269164f , -0.158332f ,
--0.132812f , -0.226563f , 0.796875f , -0.949990f , 0.269164f , -0.158332f ,
--0.101562f , -0.148438f , 0.742188f , -0.949990f , 0.269164f , -0.158332f ,
-0.101562f , -0.148438f , 0.742188f , 0.070860f , 0.921175f , -0.382642f ,
-0.000000f , -0.140625f , 0.742188f , 0.070860f , 0.921175f , -0.382642f ,
-0.109375f , -0.132813f , 0.781250f , 0.070860f , 0.921175f , -0.382642f ,
--0.101562f , -0.148438f , 0.742188f , -0.070860f , 0.921175f , -0.382642f ,
--0.109375f , -0.132813f , 0.781250f , -0.070860f , 0.921175f , -0.382642f ,
-0.000000f , -0.140625f , 0.742188f , -0.070860f , 0.921175f , -0.382642f ,
-0.000000f , -0.140625f , 0.742188f , -0.722993f , 0.097702f , 0.683912f ,
-0.000000f , -0.195313f , 0.750000f , -0.722993f , 0.097702f , 0.683912f ,
-0.039062f , -0.125000f , 0.781250f , -0.722993f , 0.097702f , 0.683912f ,
-0.000000f , -0.140625f , 0.742188f , 0.722993f , 0.097702f , 0.683912f ,
--0.039062f , -0.125000f , 0.781250f , 0.722993f , 0.097702f , 0.683912f ,
-0.000000f , -0.195313f , 0.750000f , 0.722993f , 0.097702f , 0.683912f ,
-0.000000f , -0.320313f , 0.781250f , 0.440225f , -0.880451f , 0.176090f ,
-0.000000f , -0.328125f , 0.742188f , 0.440225f , -0.880451f , 0.176090f ,
-0.093750f , -0.273438f , 0.781250f , 0.440225f , -0.880451f , 0.176090f ,
-0.000000f , -0.320313f , 0.781250f , -0.440225f , -0.880451f , 0.176090f ,
--0.093750f , -0.273438f , 0.781250f , -0.440225f , -0.880451f , 0.176090f ,
-0.000000f , -0.328125f , 0.742188f , -0.440225f , -0.880451f , 0.176090f ,
-0.000000f , -0.289063f , 0.804688f , 0.287348f , -0.574696f , 0.766261f ,
-0.000000f , -0.320313f , 0.781250f , 0.287348f , -0.574696f , 0.766261f ,
-0.078125f , -0.250000f , 0.804688f , 0.287348f , -0.574696f , 0.766261f ,
-0.000000f , -0.289063f , 0.804688f , -0.287348f , -0.574696f , 0.766261f ,
--0.078125f , -0.250000f , 0.804688f , -0.287348f , -0.574696f , 0.766261f ,
-0.000000f , -0.320313f , 0.781250f , -0.287348f , -0.574696f , 0.766261f ,
-0.000000f , -0.203125f , 0.828125f , -0.520719f , 0.615395f , 0.591726f ,
-0.046875f , -0.148438f , 0.812500f , -0.520719f , 0.615395f , 0.591726f ,
-0.039062f , -0.125000f , 0.781250f , -0.520719f , 0.615395f , 0.591726f ,
-0.000000f , -0.203125f , 0.828125f , 0.781404f , 0.558146f , 0.279073f ,
-0.000000f , -0.187500f , 0.796875f , 0.781404f , 0.558146f , 0.279073f ,
--0.039062f , -0.125000f , 0.781250f , 0.781404f , 0.558146f , 0.279073f ,
-0.046875f , -0.148438f , 0.812500f , 0.127000f , 0.762001f , 0.635001f ,
-0.093750f , -0.156250f , 0.812500f , 0.127000f , 0.762001f , 0.635001f ,
-0.109375f , -0.132813f , 0.781250f , 0.127000f , 0.762001f , 0.635001f ,
--0.046875f , -0.148438f , 0.812500f , -0.089712f , 0.807410f , 0.583130f ,
--0.039062f , -0.125000f , 0.781250f , -0.089712f , 0.807410f , 0.583130f ,
--0.109375f , -0.132813f , 0.781250f , -0.089712f , 0.807410f , 0.583130f ,
-0.132812f , -0.226563f , 0.796875f , 0.766261f , 0.287348f , 0.574696f ,
-0.109375f , -0.132813f , 0.781250f , 0.766261f , 0.287348f , 0.574696f ,
-0.109375f , -0.226563f , 0.828125f , 0.766261f , 0.287348f , 0.574696f ,
--0.132812f , -0.226563f , 0.796875f , -0.766261f , 0.287348f , 0.574696f ,
--0.109375f , -0.226563f , 0.828125f , -0.766261f , 0.287348f , 0.574696f ,
--0.109375f , -0.132813f , 0.781250f , -0.766261f , 0.287348f , 0.574696f ,
-0.109375f , -0.226563f , 0.828125f , 0.000000f , -0.707107f , 0.707107f ,
-0.078125f , -0.250000f , 0.804688f , 0.000000f , -0.707107f , 0.707107f ,
-0.093750f , -0.273438f , 0.781250f , 0.000000f , -0.707107f , 0.707107f ,
--0.109375f , -0.226563f , 0.828125f , -0.604551f , -0.654930f , 0.453413f ,
--0.132812f , -0.226563f , 0.796875f , -0.604551f , -0.654930f , 0.453413f ,
--0.093750f , -0.273438f , 0.781250f , -0.604551f , -0.654930f , 0.453413f ,
-0.046875f , -0.148438f , 0.812500f , 0.040390f , 0.242338f , 0.969351f ,
-0.000000f , -0.203125f , 0.828125f , 0.040390f , 0.242338f , 0.969351f ,
-0.093750f , -0.156250f , 0.812500f , 0.040390f , 0.242338f , 0.969351f ,
--0.046875f , -0.148438f , 0.812500f , -0.040390f , 0.242338f , 0.969351f ,
--0.093750f , -0.156250f , 0.812500f , -0.040390f , 0.242338f , 0.969351f ,
-0.000000f , -0.203125f , 0.828125f , -0.040390f , 0.242338f , 0.969351f ,
-0.000000f , -0.289063f , 0.804688f , 0.428571f , -0.857143f , 0.285714f ,
-0.078125f , -0.250000f , 0.804688f , 0.428571f , -0.857143f , 0.285714f ,
-0.109375f , -0.226563f , 0.828125f , 0.428571f , -0.857143f , 0.285714f ,
-0.000000f , -0.289063f , 0.804688f , 0.056293f , -0.262700f , 0.963234f ,
-0.000000f , -0.203125f , 0.828125f , 0.056293f , -0.262700f , 0.963234f ,
--0.109375f , -0.226563f , 0.828125f , 0.056293f , -0.262700f , 0.963234f ,
-0.101562f , -0.148438f , 0.742188f , -0.781795f , -0.366157f , 0.504703f ,
-0.125000f , -0.101563f , 0.812500f , -0.781795f , -0.366157f , 0.504703f ,
-0.000000f , 0.046875f , 0.726562f , -0.781795f , -0.366157f , 0.504703f ,
--0.101562f , -0.148438f , 0.742188f , -0.006388f , 0.083044f , 0.996525f ,
-0.000000f , -0.140625f , 0.742188f , -0.006388f , 0.083044f , 0.996525f ,
-0.000000f , 0.046875f , 0.726562f , -0.006388f , 0.083044f , 0.996525f ,
-0.125000f , -0.226563f , 0.750000f , 0.581914f , -0.363696f , 0.727393f ,
-0.164062f , -0.242188f , 0.710938f , 0.581914f , -0.363696f , 0.727393f ,
-0.125000f , -0.101563f , 0.812500f , 0.581914f , -0.363696f , 0.727393f ,
--0.125000f , -0.226563f , 0.750000f , 0.872872f , -0.218218f , 0.436436f ,
--0.101562f , -0.148438f , 0.742188f , 0.872872f , -0.218218f , 0.436436f ,
--0.125000f , -0.101563f , 0.812500f , 0.872872f , -0.218218f , 0.436436f ,
-0.164062f , -0.242188f , 0.710938f , 0.729421f , 0.162094f , 0.664583f ,
-0.125000f , -0.226563f , 0.750000f , 0.729421f , 0.162094f , 0.664583f ,
-0.179688f , -0.312500f , 0.710938f , 0.729421f , 0.162094f , 0.664583f ,
--0.164062f , -0.242188f , 0.710938f , -0.729421f , 0.162094f , 0.664583f ,
--0.179688f , -0.312500f , 0.710938f , -0.729421f , 0.162094f , 0.664583f ,
--0.125000f , -0.226563f , 0.750000f , -0.729421f , 0.162094f , 0.664583f ,
-0.179688f , -0.312500f , 0.710938f , 0.332822f , 0.078311f , 0.939732f ,
-0.085938f , -0.289063f , 0.742188f , 0.332822f , 0.078311f , 0.939732f ,
-0.210938f , -0.445313f , 0.710938f , 0.332822f , 0.078311f , 0.939732f ,
--0.179688f , -0.312500f , 0.710938f , -0.332822f , 0.078311f , 0.939732f ,
--0.210938f , -0.445313f , 0.710938f , -0.332822f , 0.078311f , 0.939732f ,
--0.085938f , -0.289063f , 0.742188f , -0.332822f , 0.078311f , 0.939732f ,
-0.210938f , -0.445313f , 0.710938f , 0.791554f , 0.186248f , 0.582025f ,
-0.312500f , -0.437500f , 0.570312f , 0.791554f , 0.186248f , 0.582025f ,
-0.179688f , -0.312500f , 0.710938f , 0.791554f , 0.186248f , 0.582025f ,
--0.210938f , -0.445313f , 0.710938f , -0.791554f , 0.186248f , 0.582025f ,
--0.179688f , -0.312500f , 0.710938f , -0.791554f , 0.186248f , 0.582025f ,
--0.312500f , -0.437500f , 0.570312f , -0.791554f , 0.186248f , 0.582025f ,
-0.179688f , -0.312500f , 0.710938f , 0.877266f , 0.194948f , 0.438633f ,
-0.257812f , -0.312500f , 0.554688f , 0.877266f , 0.194948f , 0.438633f ,
-0.164062f , -0.242188f , 0.710938f , 0.877266f , 0.194948f , 0.438633f ,
--0.179688f , -0.312500f , 0.710938f , -0.877266f , 0.194948f , 0.438633f ,
--0.164062f , -0.242188f , 0.710938f , -0.877266f , 0.194948f , 0.438633f ,
--0.257812f , -0.312500f , 0.554688f , -0.877266f , 0.194948f , 0.438633f ,
-0.125000f , -0.101563f , 0.812500f , 0.910178f , -0.044591f , 0.411810f ,
-0.164062f , -0.242188f , 0.710938f , 0.910178f , -0.044591f , 0.411810f ,
-0.234375f , -0.250000f , 0.554688f , 0.910178f , -0.044591f , 0.411810f ,
--0.125000f , -0.101563f , 0.812500f , -0.893156f , 0.430173f , 0.131239f ,
--0.203125f , -0.187500f , 0.562500f , -0.893156f , 0.430173f , 0.131239f ,
--0.234375f , -0.250000f , 0.554688f , -0.893156f , 0.430173f , 0.131239f ,
-0.093750f , -0.742188f , 0.726562f , 0.033615f , -0.336146f , 0.941210f ,
-0.109375f , -0.718750f , 0.734375f , 0.033615f , -0.336146f , 0.941210f ,
-0.000000f , -0.773438f , 0.718750f , 0.033615f , -0.336146f , 0.941210f ,
--0.093750f , -0.742188f , 0.726562f , -0.033615f , -0.336146f , 0.941210f ,
-0.000000f , -0.773438f , 0.718750f , -0.033615f , -0.336146f , 0.941210f ,
--0.109375f , -0.718750f , 0.734375f , -0.033615f , -0.336146f , 0.941210f ,
-0.109375f , -0.718750f , 0.734375f , -0.192450f , -0.192450f , 0.962250f ,
-0.093750f , -0.742188f , 0.726562f , -0.192450f , -0.192450f , 0.962250f ,
-0.093750f , -0.820313f , 0.710937f , -0.192450f , -0.192450f , 0.962250f ,
--0.109375f , -0.718750f , 0.734375f , 0.135319f , -0.202979f , 0.969788f ,
--0.117188f , -0.835938f , 0.710937f , 0.135319f , -0.202979f , 0.969788f ,
--0.093750f , -0.820313f , 0.710937f , 0.135319f , -0.202979f , 0.969788f ,
-0.117188f , -0.835938f , 0.710937f , -0.188144f , -0.282216f , 0.940721f ,
-0.093750f , -0.820313f , 0.710937f , -0.188144f , -0.282216f , 0.940721f ,
-0.046875f , -0.867188f , 0.687500f , -0.188144f , -0.282216f , 0.940721f ,
--0.117188f , -0.835938f , 0.710937f , 0.356915f , 0.107075f , 0.927980f ,
--0.062500f , -0.882813f , 0.695312f , 0.356915f , 0.107075f , 0.927980f ,
--0.046875f , -0.867188f , 0.687500f , 0.356915f , 0.107075f , 0.927980f ,
-0.062500f , -0.882813f , 0.695312f , -0.065512f , 0.393073f , 0.917171f ,
-0.046875f , -0.867188f , 0.687500f , -0.065512f , 0.393073f , 0.917171f ,
-0.000000f , -0.875000f , 0.687500f , -0.065512f , 0.393073f , 0.917171f ,
--0.062500f , -0.882813f , 0.695312f , 0.124035f , 0.000000f , 0.992278f ,
-0.000000f , -0.890625f , 0.687500f , 0.124035f , 0.000000f , 0.992278f ,
-0.000000f , -0.875000f , 0.687500f , 0.124035f , 0.000000f , 0.992278f ,
-0.000000f , -0.859375f , 0.632812f , -0.158235f , 0.949410f , 0.271261f ,
-0.000000f , -0.875000f , 0.687500f , -0.158235f , 0.949410f , 0.271261f ,
-0.046875f , -0.851562f , 0.632812f , -0.158235f , 0.949410f , 0.271261f ,
-0.000000f , -0.859375f , 0.632812f , 0.158235f , 0.949410f , 0.271261f ,
--0.046875f , -0.851562f , 0.632812f , 0.158235f , 0.949410f , 0.271261f ,
-0.000000f , -0.875000f , 0.687500f , 0.158235f , 0.949410f , 0.271261f ,
-0.093750f , -0.820313f , 0.710937f , -0.646159f , 0.758535f , 0.084282f ,
-0.093750f , -0.812500f , 0.640625f , -0.646159f , 0.758535f , 0.084282f ,
-0.046875f , -0.851562f , 0.632812f , -0.646159f , 0.758535f , 0.084282f ,
--0.093750f , -0.820313f , 0.710937f , 0.739600f , 0.647150f , 0.184901f ,
--0.046875f , -0.867188f , 0.687500f , 0.739600f , 0.647150f , 0.184901f ,
--0.046875f , -0.851562f , 0.632812f , 0.739600f , 0.647150f , 0.184901f ,
-0.093750f , -0.742188f , 0.726562f , -1.000000f , -0.000000f , 0.000000f ,
-0.093750f , -0.750000f , 0.664062f , -1.000000f , -0.000000f , 0.000000f ,
-0.093750f , -0.812500f , 0.640625f , -1.000000f , -0.000000f , 0.000000f ,
--0.093750f , -0.742188f , 0.726562f , 1.000000f , -0.000000f , 0.000000f ,
--0.093750f , -0.820313f , 0.710937f , 1.000000f , -0.000000f , 0.000000f ,
--0.093750f , -0.812500f , 0.640625f , 1.000000f , -0.000000f , 0.000000f ,
-0.093750f , -0.750000f , 0.664062f , 0.305141f , -0.944953f , 0.118118f ,
-0.093750f , -0.742188f , 0.726562f , 0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.781250f , 0.656250f , 0.305141f , -0.944953f , 0.118118f ,
--0.093750f , -0.750000f , 0.664062f , -0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.781250f , 0.656250f , -0.305141f , -0.944953f , 0.118118f ,
--0.093750f , -0.742188f , 0.726562f , -0.305141f , -0.944953f , 0.118118f ,
-0.000000f , -0.859375f , 0.632812f , 0.052632f , -0.315789f , 0.947368f ,
-0.046875f , -0.851562f , 0.632812f , 0.052632f , -0.315789f , 0.947368f ,
-0.093750f , -0.750000f , 0.664062f , 0.052632f , -0.315789f , 0.947368f ,
-0.000000f , -0.859375f , 0.632812f , -0.015962f , -0.287311f , 0.957704f ,
-0.000000f , -0.781250f , 0.656250f , -0.015962f , -0.287311f , 0.957704f ,
--0.093750f , -0.750000f , 0.664062f , -0.015962f , -0.287311f , 0.957704f ,
-0.164062f , 0.140625f , 0.750000f , -0.598986f , -0.245040f , 0.762346f ,
-0.187500f , 0.156250f , 0.773438f , -0.598986f , -0.245040f , 0.762346f ,
-0.171875f , 0.218750f , 0.781250f , -0.598986f , -0.245040f , 0.762346f ,
--0.164062f , 0.140625f , 0.750000f , 0.448143f , -0.293016f , 0.844577f ,
--0.132812f , 0.210937f , 0.757812f , 0.448143f , -0.293016f , 0.844577f ,
--0.171875f , 0.218750f , 0.781250f , 0.448143f , -0.293016f , 0.844577f ,
-0.132812f , 0.210937f , 0.757812f , -0.521443f , 0.052144f , 0.851691f ,
-0.171875f , 0.218750f , 0.781250f , -0.521443f , 0.052144f , 0.851691f ,
-0.179688f , 0.296875f , 0.781250f , -0.521443f , 0.052144f , 0.851691f ,
--0.132812f , 0.210937f , 0.757812f , 0.286864f , -0.103271f , 0.952389f ,
--0.125000f , 0.304687f , 0.765625f , 0.286864f , -0.103271f , 0.952389f ,
--0.179688f , 0.296875f , 0.781250f , 0.286864f , -0.103271f , 0.952389f ,
-0.210938f , 0.375000f , 0.781250f , -0.123882f , 0.049553f , 0.991059f ,
-0.164062f , 0.414062f , 0.773438f , -0.123882f , 0.049553f , 0.991059f ,
-0.179688f , 0.296875f , 0.781250f , -0.123882f , 0.049553f , 0.991059f ,
--0.210938f , 0.375000f , 0.781250f , 0.123882f , 0.049553f , 0.991059f ,
--0.179688f , 0.296875f , 0.781250f , 0.123882f , 0.049553f , 0.991059f ,
--0.164062f , 0.414062f , 0.773438f , 0.123882f , 0.049553f , 0.991059f ,
-0.187500f , 0.156250f , 0.773438f , -0.548821f , -0.329293f , 0.768350f ,
-0.164062f , 0.140625f , 0.750000f , -0.548821f , -0.329293f , 0.768350f ,
-0.226562f , 0.109375f , 0.781250f , -0.548821f , -0.329293f , 0.768350f ,
--0.187500f , 0.156250f , 0.773438f , 0.548821f , -0.329293f , 0.768350f ,
--0.226562f , 0.109375f , 0.781250f , 0.548821f , -0.329293f , 0.768350f ,
--0.164062f , 0.140625f , 0.750000f , 0.548821f , -0.329293f , 0.768350f ,
-0.375000f , 0.015625f , 0.703125f , 0.000000f , -0.640184f , 0.768221f ,
-0.375000f , 0.062500f , 0.742188f , 0.000000f , -0.640184f , 0.768221f ,
-0.226562f , 0.109375f , 0.781250f , 0.000000f , -0.640184f , 0.768221f ,
--0.375000f , 0.015625f , 0.703125f , 0.265483f , -0.829636f , 0.491144f ,
--0.203125f , 0.093750f , 0.742188f , 0.265483f , -0.829636f , 0.491144f ,
--0.226562f , 0.109375f , 0.781250f , 0.265483f , -0.829636f , 0.491144f ,
-0.492188f , 0.062500f , 0.671875f , 0.397220f , -0.635553f , 0.662034f ,
-0.476562f , 0.101562f , 0.718750f , 0.397220f , -0.635553f , 0.662034f ,
-0.375000f , 0.062500f , 0.742188f , 0.397220f , -0.635553f , 0.662034f ,
--0.492188f , 0.062500f , 0.671875f , -0.418605f , -0.581395f , 0.697674f ,
--0.375000f , 0.015625f , 0.703125f , -0.418605f , -0.581395f , 0.697674f ,
--0.375000f , 0.062500f , 0.742188f , -0.418605f , -0.581395f , 0.697674f ,
-0.625000f , 0.187500f , 0.648438f , 0.516784f , -0.214514f , 0.828805f ,
-0.578125f , 0.195312f , 0.679688f , 0.516784f , -0.214514f , 0.828805f ,
-0.476562f , 0.101562f , 0.718750f , 0.516784f , -0.214514f , 0.828805f ,
--0.625000f , 0.187500f , 0.648438f , -0.591414f , -0.511493f , 0.623382f ,
--0.492188f , 0.062500f , 0.671875f , -0.591414f , -0.511493f , 0.623382f ,
--0.476562f , 0.101562f , 0.718750f , -0.591414f , -0.511493f , 0.623382f ,
-0.640625f , 0.296875f , 0.648438f , 0.588227f , -0.115717f , 0.800374f ,
-0.585938f , 0.289062f , 0.687500f , 0.588227f , -0.115717f , 0.800374f ,
-0.578125f , 0.195312f , 0.679688f , 0.588227f , -0.115717f , 0.800374f ,
--0.640625f , 0.296875f , 0.648438f , -0.544023f , -0.077718f , 0.835464f ,
--0.625000f , 0.187500f , 0.648438f , -0.544023f , -0.077718f , 0.835464f ,
--0.578125f , 0.195312f , 0.679688f , -0.544023f , -0.077718f , 0.835464f ,
-0.585938f , 0.289062f , 0.687500f , 0.567152f , 0.110664f , 0.816145f ,
-0.640625f , 0.296875f , 0.648438f , 0.567152f , 0.110664f , 0.816145f ,
-0.562500f , 0.351562f , 0.695312f , 0.567152f , 0.110664f , 0.816145f ,
--0.585938f , 0.289062f , 0.687500f , -0.567152f , 0.110664f , 0.816145f ,
--0.562500f , 0.351562f , 0.695312f , -0.567152f , 0.110664f , 0.816145f ,
--0.640625f , 0.296875f , 0.648438f , -0.567152f , 0.110664f , 0.816145f ,
-0.562500f , 0.351562f , 0.695312f , 0.528094f , 0.215149f , 0.821479f ,
-0.601562f , 0.375000f , 0.664062f , 0.528094f , 0.215149f , 0.821479f ,
-0.421875f , 0.398437f , 0.773438f , 0.528094f , 0.215149f , 0.821479f ,
--0.562500f , 0.351562f , 0.695312f , -0.528094f , 0.215149f , 0.821479f ,
--0.421875f , 0.398437f , 0.773438f , -0.528094f , 0.215149f , 0.821479f ,
--0.601562f , 0.375000f , 0.664062f , -0.528094f , 0.215149f , 0.821479f ,
-0.328125f , 0.476562f , 0.742188f , -0.061285f , 0.306426f , 0.949920f ,
-0.335938f , 0.429687f , 0.757812f , -0.061285f , 0.306426f , 0.949920f ,
-0.421875f , 0.398437f , 0.773438f , -0.061285f , 0.306426f , 0.949920f ,
--0.328125f , 0.476562f , 0.742188f , -0.406303f , 0.715093f , 0.568824f ,
--0.429688f , 0.437500f , 0.718750f , -0.406303f , 0.715093f , 0.568824f ,
--0.421875f , 0.398437f , 0.773438f , -0.406303f , 0.715093f , 0.568824f ,
-0.250000f , 0.468750f , 0.757812f , 0.177192f , 0.389823f , 0.903682f ,
-0.273438f , 0.421875f , 0.773438f , 0.177192f , 0.389823f , 0.903682f ,
-0.335938f , 0.429687f , 0.757812f , 0.177192f , 0.389823f , 0.903682f ,
--0.250000f , 0.468750f , 0.757812f , -0.152410f , 0.335302f , 0.929701f ,
--0.328125f , 0.476562f , 0.742188f , -0.152410f , 0.335302f , 0.929701f ,
--0.335938f , 0.429687f , 0.757812f , -0.152410f , 0.335302f , 0.929701f ,
-0.164062f , 0.414062f , 0.773438f , -0.012939f , 0.181147f , 0.983371f ,
-0.210938f , 0.375000f , 0.781250f , -0.012939f , 0.181147f , 0.983371f ,
-0.273438f , 0.421875f , 0.773438f , -0.012939f , 0.181147f , 0.983371f ,
--0.164062f , 0.414062f , 0.773438f , 0.021878f , 0.306290f , 0.951687f ,
--0.250000f , 0.468750f , 0.757812f , 0.021878f , 0.306290f , 0.951687f ,
--0.273438f , 0.421875f , 0.773438f , 0.021878f , 0.306290f , 0.951687f ,
-0.210938f , 0.375000f , 0.781250f , 0.355266f , -0.573890f , 0.737859f ,
-0.234375f , 0.359375f , 0.757812f , 0.355266f , -0.573890f , 0.737859f ,
-0.281250f , 0.398437f , 0.765625f , 0.355266f , -0.573890f , 0.737859f ,
--0.210938f , 0.375000f , 0.781250f , -0.280430f , -0.218112f , 0.934765f ,
--0.273438f , 0.421875f , 0.773438f , -0.280430f , -0.218112f , 0.934765f ,
--0.281250f , 0.398437f , 0.765625f , -0.280430f , -0.218112f , 0.934765f ,
-0.273438f , 0.421875f , 0.773438f , 0.296334f , -0.211667f , 0.931334f ,
-0.281250f , 0.398437f , 0.765625f , 0.296334f , -0.211667f , 0.931334f ,
-0.335938f , 0.406250f , 0.750000f , 0.296334f , -0.211667f , 0.931334f ,
--0.273438f , 0.421875f , 0.773438f , -0.266679f , -0.304776f , 0.914327f ,
--0.335938f , 0.429687f , 0.757812f , -0.266679f , -0.304776f , 0.914327f ,
--0.335938f , 0.406250f , 0.750000f , -0.266679f , -0.304776f , 0.914327f ,
-0.414062f , 0.390625f , 0.750000f , -0.182574f , -0.912871f , 0.365148f ,
-0.421875f , 0.398437f , 0.773438f , -0.182574f , -0.912871f , 0.365148f ,
-0.335938f , 0.406250f , 0.750000f , -0.182574f , -0.912871f , 0.365148f ,
--0.414062f , 0.390625f , 0.750000f , 0.182574f , -0.912871f , 0.365148f ,
--0.335938f , 0.406250f , 0.750000f , 0.182574f , -0.912871f , 0.365148f ,
--0.421875f , 0.398437f , 0.773438f , 0.182574f , -0.912871f , 0.365148f ,
-0.531250f , 0.335937f , 0.679688f , 0.045478f , -0.750388f , 0.659432f ,
-0.562500f , 0.351562f , 0.695312f , 0.045478f , -0.750388f , 0.659432f ,
-0.414062f , 0.390625f , 0.750000f , 0.045478f , -0.750388f , 0.659432f ,
--0.531250f , 0.335937f , 0.679688f , -0.045478f , -0.750388f , 0.659432f ,
--0.414062f , 0.390625f , 0.750000f , -0.045478f , -0.750388f , 0.659432f ,
--0.562500f , 0.351562f , 0.695312f , -0.045478f , -0.750388f , 0.659432f ,
-0.562500f , 0.351562f , 0.695312f , -0.320713f , -0.267261f , 0.908688f ,
-0.531250f , 0.335937f , 0.679688f , -0.320713f , -0.267261f , 0.908688f ,
-0.554688f , 0.281250f , 0.671875f , -0.320713f , -0.267261f , 0.908688f ,
--0.562500f , 0.351562f , 0.695312f , 0.381000f , -0.254000f , 0.889001f ,
--0.585938f , 0.289062f , 0.687500f , 0.381000f , -0.254000f , 0.889001f ,
--0.554688f , 0.281250f , 0.671875f , 0.381000f , -0.254000f , 0.889001f ,
-0.546875f , 0.210937f , 0.671875f , -0.230391f , 0.025599f , 0.972761f ,
-0.578125f , 0.195312f , 0.679688f , -0.230391f , 0.025599f , 0.972761f ,
-0.554688f , 0.281250f , 0.671875f , -0.230391f , 0.025599f , 0.972761f ,
--0.546875f , 0.210937f , 0.671875f , 0.230391f , 0.025599f , 0.972761f ,
--0.554688f , 0.281250f , 0.671875f , 0.230391f , 0.025599f , 0.972761f ,
--0.578125f , 0.195312f , 0.679688f , 0.230391f , 0.025599f , 0.972761f ,
-0.578125f , 0.195312f , 0.679688f , -0.053239f , 0.359362f , 0.931678f ,
-0.546875f , 0.210937f , 0.671875f , -0.053239f , 0.359362f , 0.931678f ,
-0.460938f , 0.117187f , 0.703125f , -0.053239f , 0.359362f , 0.931678f ,
--0.578125f , 0.195312f , 0.679688f , 0.221581f , 0.569780f , 0.791361f ,
--0.476562f , 0.101562f , 0.718750f , 0.221581f , 0.569780f , 0.791361f ,
--0.460938f , 0.117187f , 0.703125f , 0.221581f , 0.569780f , 0.791361f ,
-0.375000f , 0.085937f , 0.726562f , 0.025206f , 0.554524f , 0.831786f ,
-0.375000f , 0.062500f , 0.742188f , 0.025206f , 0.554524f , 0.831786f ,
-0.460938f , 0.117187f , 0.703125f , 0.025206f , 0.554524f , 0.831786f ,
--0.375000f , 0.085937f , 0.726562f , -0.025206f , 0.554524f , 0.831786f ,
--0.460938f , 0.117187f , 0.703125f , -0.025206f , 0.554524f , 0.831786f ,
--0.375000f , 0.062500f , 0.742188f , -0.025206f , 0.554524f , 0.831786f ,
-0.242188f , 0.125000f , 0.757812f , 0.350177f , 0.654679f , 0.669904f ,
-0.226562f , 0.109375f , 0.781250f , 0.350177f , 0.654679f , 0.669904f ,
-0.375000f , 0.085937f , 0.726562f , 0.350177f , 0.654679f , 0.669904f ,
--0.242188f , 0.125000f , 0.757812f , -0.350177f , 0.654679f , 0.669904f ,
--0.375000f , 0.085937f , 0.726562f , -0.350177f , 0.654679f , 0.669904f ,
--0.226562f , 0.109375f , 0.781250f , -0.350177f , 0.654679f , 0.669904f ,
-0.226562f , 0.109375f , 0.781250f , 0.498784f , 0.529958f , 0.685828f ,
-0.242188f , 0.125000f , 0.757812f , 0.498784f , 0.529958f , 0.685828f ,
-0.203125f , 0.171875f , 0.750000f , 0.498784f , 0.529958f , 0.685828f ,
--0.226562f , 0.109375f , 0.781250f , -0.498784f , 0.529958f , 0.685828f ,
--0.187500f , 0.156250f , 0.773438f , -0.498784f , 0.529958f , 0.685828f ,
--0.203125f , 0.171875f , 0.750000f , -0.498784f , 0.529958f , 0.685828f ,
-0.179688f , 0.296875f , 0.781250f , 0.738200f , -0.461375f , 0.492133f ,
-0.195312f , 0.296875f , 0.757812f , 0.738200f , -0.461375f , 0.492133f ,
-0.234375f , 0.359375f , 0.757812f , 0.738200f , -0.461375f , 0.492133f ,
--0.179688f , 0.296875f , 0.781250f , -0.601445f , -0.240578f , 0.761831f ,
--0.210938f , 0.375000f , 0.781250f , -0.601445f , -0.240578f , 0.761831f ,
--0.234375f , 0.359375f , 0.757812f , -0.601445f , -0.240578f , 0.761831f ,
-0.171875f , 0.218750f , 0.781250f , 0.806064f , -0.065357f , 0.588209f ,
-0.195312f , 0.226562f , 0.750000f , 0.806064f , -0.065357f , 0.588209f ,
-0.195312f , 0.296875f , 0.757812f , 0.806064f , -0.065357f , 0.588209f ,
--0.171875f , 0.218750f , 0.781250f , -0.829185f , -0.082919f , 0.552790f ,
--0.179688f , 0.296875f , 0.781250f , -0.829185f , -0.082919f , 0.552790f ,
--0.195312f , 0.296875f , 0.757812f , -0.829185f , -0.082919f , 0.552790f ,
-0.187500f , 0.156250f , 0.773438f , 0.790345f , 0.112906f , 0.602168f ,
-0.203125f , 0.171875f , 0.750000f , 0.790345f , 0.112906f , 0.602168f ,
-0.195312f , 0.226562f , 0.750000f , 0.790345f , 0.112906f , 0.602168f ,
--0.187500f , 0.156250f , 0.773438f , -0.779987f , 0.118180f , 0.614535f ,
--0.171875f , 0.218750f , 0.781250f , -0.779987f , 0.118180f , 0.614535f ,
--0.195312f , 0.226562f , 0.750000f , -0.779987f , 0.118180f , 0.614535f ,
-0.062500f , 0.492187f , 0.750000f , -0.404311f , 0.855017f , -0.324774f ,
-0.109375f , 0.460937f , 0.609375f , -0.404311f , 0.855017f , -0.324774f ,
-0.000000f , 0.406250f , 0.601562f , -0.404311f , 0.855017f , -0.324774f ,
--0.062500f , 0.492187f , 0.750000f , 0.694716f , 0.709497f , -0.118250f ,
-0.000000f , 0.429687f , 0.742188f , 0.694716f , 0.709497f , -0.118250f ,
-0.000000f , 0.406250f , 0.601562f , 0.694716f , 0.709497f , -0.118250f ,
-0.156250f , 0.718750f , 0.757813f , -0.846507f , 0.372757f , -0.380102f ,
-0.195312f , 0.664062f , 0.617188f , -0.846507f , 0.372757f , -0.380102f ,
-0.109375f , 0.460937f , 0.609375f , -0.846507f , 0.372757f , -0.380102f ,
--0.156250f , 0.718750f , 0.757813f , 0.855186f , 0.366508f , -0.366508f ,
--0.062500f , 0.492187f , 0.750000f , 0.855186f , 0.366508f , -0.366508f ,
--0.109375f , 0.460937f , 0.609375f , 0.855186f , 0.366508f , -0.366508f ,
-0.195312f , 0.664062f , 0.617188f , -0.215621f , 0.888361f , -0.405368f ,
-0.156250f , 0.718750f , 0.757813f , -0.215621f , 0.888361f , -0.405368f ,
-0.335938f , 0.687500f , 0.593750f , -0.215621f , 0.888361f , -0.405368f ,
--0.195312f , 0.664062f , 0.617188f , 0.215621f , 0.888361f , -0.405368f ,
--0.335938f , 0.687500f , 0.593750f , 0.215621f , 0.888361f , -0.405368f ,
--0.156250f , 0.718750f , 0.757813f , 0.215621f , 0.888361f , -0.405368f ,
-0.335938f , 0.687500f , 0.593750f , 0.587871f , 0.747790f , -0.308575f ,
-0.320312f , 0.757812f , 0.734375f , 0.587871f , 0.747790f , -0.308575f ,
-0.484375f , 0.554688f , 0.554688f , 0.587871f , 0.747790f , -0.308575f ,
--0.335938f , 0.687500f , 0.593750f , -0.587871f , 0.747790f , -0.308575f ,
--0.484375f , 0.554688f , 0.554688f , -0.587871f , 0.747790f , -0.308575f ,
--0.320312f , 0.757812f , 0.734375f , -0.587871f , 0.747790f , -0.308575f ,
-0.484375f , 0.554688f , 0.554688f , 0.350238f , 0.876606f , -0.329992f ,
-0.492188f , 0.601562f , 0.687500f , 0.350238f , 0.876606f , -0.329992f ,
-0.679688f , 0.453125f , 0.492188f , 0.350238f , 0.876606f , -0.329992f ,
--0.484375f , 0.554688f , 0.554688f , -0.350238f , 0.876606f , -0.329992f ,
--0.679688f , 0.453125f , 0.492188f , -0.350238f , 0.876606f , -0.329992f ,
--0.492188f , 0.601562f , 0.687500f , -0.350238f , 0.876606f , -0.329992f ,
-0.859375f , 0.429687f , 0.593750f , 0.285868f , 0.911603f , -0.295397f ,
-0.796875f , 0.406250f , 0.460938f , 0.285868f , 0.911603f , -0.295397f ,
-0.679688f , 0.453125f , 0.492188f , 0.285868f , 0.911603f , -0.295397f ,
--0.859375f , 0.429687f , 0.593750f , -0.278943f , 0.918076f , -0.281652f ,
--0.710938f , 0.484375f , 0.625000f , -0.278943f , 0.918076f , -0.281652f ,
--0.679688f , 0.453125f , 0.492188f , -0.278943f , 0.918076f , -0.281652f ,
-0.796875f , 0.406250f , 0.460938f , 0.898143f , 0.067270f , -0.434527f ,
-0.859375f , 0.429687f , 0.593750f , 0.898143f , 0.067270f , -0.434527f ,
-0.773438f , 0.164062f , 0.375000f , 0.898143f , 0.067270f , -0.434527f ,
--0.796875f , 0.406250f , 0.460938f , -0.898143f , 0.067270f , -0.434527f ,
--0.773438f , 0.164062f , 0.375000f , -0.898143f , 0.067270f , -0.434527f ,
--0.859375f , 0.429687f , 0.593750f , -0.898143f , 0.067270f , -0.434527f ,
-0.632812f , -0.039063f , 0.539062f , 0.595505f , -0.712308f , -0.371472f ,
-0.601562f , -0.000000f , 0.414062f , 0.595505f , -0.712308f , -0.371472f ,
-0.773438f , 0.164062f , 0.375000f , 0.595505f , -0.712308f , -0.371472f ,
--0.632812f , -0.039063f , 0.539062f , -0.452713f , -0.728585f , -0.514018f ,
--0.828125f , 0.148437f , 0.445312f , -0.452713f , -0.728585f , -0.514018f ,
--0.773438f , 0.164062f , 0.375000f , -0.452713f , -0.728585f , -0.514018f ,
-0.437500f , -0.140625f , 0.531250f , 0.249041f , -0.774794f , -0.581096f ,
-0.437500f , -0.093750f , 0.468750f , 0.249041f , -0.774794f , -0.581096f ,
-0.601562f , -0.000000f , 0.414062f , 0.249041f , -0.774794f , -0.581096f ,
--0.437500f , -0.140625f , 0.531250f , -0.440781f , -0.819481f , -0.366283f ,
--0.632812f , -0.039063f , 0.539062f , -0.440781f , -0.819481f , -0.366283f ,
--0.601562f , -0.000000f , 0.414062f , -0.440781f , -0.819481f , -0.366283f ,
-0.125000f , -0.539062f , 0.359375f , 0.368294f , -0.677996f , -0.636145f ,
-0.000000f , -0.570312f , 0.320312f , 0.368294f , -0.677996f , -0.636145f ,
-0.179688f , -0.414062f , 0.257812f , 0.368294f , -0.677996f , -0.636145f ,
--0.125000f , -0.539062f , 0.359375f , -0.368294f , -0.677996f , -0.636145f ,
--0.179688f , -0.414062f , 0.257812f , -0.368294f , -0.677996f , -0.636145f ,
-0.000000f , -0.570312f , 0.320312f , -0.368294f , -0.677996f , -0.636145f ,
-0.140625f , -0.757812f , 0.367187f , 0.171779f , -0.022904f , -0.984869f ,
-0.000000f , -0.804688f , 0.343750f , 0.171779f , -0.022904f , -0.984869f ,
-0.125000f , -0.539062f , 0.359375f , 0.171779f , -0.022904f , -0.984869f ,
--0.140625f , -0.757812f , 0.367187f , -0.171779f , -0.022904f , -0.984869f ,
--0.125000f , -0.539062f , 0.359375f , -0.171779f , -0.022904f , -0.984869f ,
-0.000000f , -0.804688f , 0.343750f , -0.171779f , -0.022904f , -0.984869f ,
-0.164062f , -0.945312f , 0.437500f , -0.064999f , -0.357494f , -0.931651f ,
-0.000000f , -0.976562f , 0.460937f , -0.064999f , -0.357494f , -0.931651f ,
-0.140625f , -0.757812f , 0.367187f , -0.064999f , -0.357494f , -0.931651f ,
--0.164062f , -0.945312f , 0.437500f , 0.064999f , -0.357494f , -0.931651f ,
--0.140625f , -0.757812f , 0.367187f , 0.064999f , -0.357494f , -0.931651f ,
-0.000000f , -0.976562f , 0.460937f , 0.064999f , -0.357494f , -0.931651f ,
-0.000000f , -0.984375f , 0.578125f , 0.177679f , -0.981909f , -0.065461f ,
-0.000000f , -0.976562f , 0.460937f , 0.177679f , -0.981909f , -0.065461f ,
-0.164062f , -0.945312f , 0.437500f , 0.177679f , -0.981909f , -0.065461f ,
-0.000000f , -0.984375f , 0.578125f , -0.058475f , -0.977375f , -0.203272f ,
--0.179688f , -0.968750f , 0.554687f , -0.058475f , -0.977375f , -0.203272f ,
--0.164062f , -0.945312f , 0.437500f , -0.058475f , -0.977375f , -0.203272f ,
-0.179688f , -0.968750f , 0.554687f , 0.134050f , -0.968141f , -0.211502f ,
-0.164062f , -0.945312f , 0.437500f , 0.134050f , -0.968141f , -0.211502f ,
-0.328125f , -0.914062f , 0.398437f , 0.134050f , -0.968141f , -0.211502f ,
--0.179688f , -0.968750f , 0.554687f , -0.101592f , -0.965123f , -0.241281f ,
--0.328125f , -0.945312f , 0.523437f , -0.101592f , -0.965123f , -0.241281f ,
--0.328125f , -0.914062f , 0.398437f , -0.101592f , -0.965123f , -0.241281f ,
-0.328125f , -0.945312f , 0.523437f , 0.980180f , 0.192192f , 0.048048f ,
-0.328125f , -0.914062f , 0.398437f , 0.980180f , 0.192192f , 0.048048f ,
-0.289062f , -0.710938f , 0.382812f , 0.980180f , 0.192192f , 0.048048f ,
--0.328125f , -0.945312f , 0.523437f , -0.608216f , -0.331400f , -0.721282f ,
--0.367188f , -0.890625f , 0.531250f , -0.608216f , -0.331400f , -0.721282f ,
--0.289062f , -0.710938f , 0.382812f , -0.608216f , -0.331400f , -0.721282f ,
-0.367188f , -0.890625f , 0.531250f , 0.944069f , 0.184939f , -0.273005f ,
-0.289062f , -0.710938f , 0.382812f , 0.944069f , 0.184939f , -0.273005f ,
-0.250000f , -0.500000f , 0.390625f , 0.944069f , 0.184939f , -0.273005f ,
--0.367188f , -0.890625f , 0.531250f , -0.920777f , 0.146009f , -0.361734f ,
--0.351562f , -0.695312f , 0.570312f , -0.920777f , 0.146009f , -0.361734f ,
--0.250000f , -0.500000f , 0.390625f , -0.920777f , 0.146009f , -0.361734f ,
-0.140625f , -0.757812f , 0.367187f , 0.247475f , -0.016921f , -0.968747f ,
-0.125000f , -0.539062f , 0.359375f , 0.247475f , -0.016921f , -0.968747f ,
-0.250000f , -0.500000f , 0.390625f , 0.247475f , -0.016921f , -0.968747f ,
--0.140625f , -0.757812f , 0.367187f , -0.087930f , 0.053124f , -0.994709f ,
--0.289062f , -0.710938f , 0.382812f , -0.087930f , 0.053124f , -0.994709f ,
--0.250000f , -0.500000f , 0.390625f , -0.087930f , 0.053124f , -0.994709f ,
-0.140625f , -0.757812f , 0.367187f , 0.199158f , -0.322167f , -0.925497f ,
-0.289062f , -0.710938f , 0.382812f , 0.199158f , -0.322167f , -0.925497f ,
-0.164062f , -0.945312f , 0.437500f , 0.199158f , -0.322167f , -0.925497f ,
--0.140625f , -0.757812f , 0.367187f , -0.199158f , -0.322167f , -0.925497f ,
--0.164062f , -0.945312f , 0.437500f , -0.199158f , -0.322167f , -0.925497f ,
--0.289062f , -0.710938f , 0.382812f , -0.199158f , -0.322167f , -0.925497f ,
-0.179688f , -0.414062f , 0.257812f , 0.870302f , -0.477813f , -0.119453f ,
-0.234375f , -0.351563f , 0.406250f , 0.870302f , -0.477813f , -0.119453f ,
-0.125000f , -0.539062f , 0.359375f , 0.870302f , -0.477813f , -0.119453f ,
--0.179688f , -0.414062f , 0.257812f , -0.870302f , -0.477813f , -0.119453f ,
--0.125000f , -0.539062f , 0.359375f , -0.870302f , -0.477813f , -0.119453f ,
--0.234375f , -0.351563f , 0.406250f , -0.870302f , -0.477813f , -0.119453f ,
-0.351562f , -0.695312f , 0.570312f , 0.918440f , 0.135786f , -0.371525f ,
-0.250000f , -0.500000f , 0.390625f , 0.918440f , 0.135786f , -0.371525f ,
-0.234375f , -0.351563f , 0.406250f , 0.918440f , 0.135786f , -0.371525f ,
--0.351562f , -0.695312f , 0.570312f , -0.920408f , 0.139456f , -0.365241f ,
--0.312500f , -0.437500f , 0.570312f , -0.920408f , 0.139456f , -0.365241f ,
--0.234375f , -0.351563f , 0.406250f , -0.920408f , 0.139456f , -0.365241f ,
-0.234375f , -0.250000f , 0.554688f , 0.924627f , 0.346735f , -0.157607f ,
-0.257812f , -0.312500f , 0.554688f , 0.924627f , 0.346735f , -0.157607f ,
-0.210938f , -0.226563f , 0.468750f , 0.924627f , 0.346735f , -0.157607f ,
--0.234375f , -0.250000f , 0.554688f , -0.924627f , 0.346735f , -0.157607f ,
--0.210938f , -0.226563f , 0.468750f , -0.924627f , 0.346735f , -0.157607f ,
--0.257812f , -0.312500f , 0.554688f , -0.924627f , 0.346735f , -0.157607f ,
-0.257812f , -0.312500f , 0.554688f , 0.907920f , 0.373419f , -0.190370f ,
-0.312500f , -0.437500f , 0.570312f , 0.907920f , 0.373419f , -0.190370f ,
-0.218750f , -0.281250f , 0.429688f , 0.907920f , 0.373419f , -0.190370f ,
--0.257812f , -0.312500f , 0.554688f , -0.907920f , 0.373419f , -0.190370f ,
--0.218750f , -0.281250f , 0.429688f , -0.907920f , 0.373419f , -0.190370f ,
--0.312500f , -0.437500f , 0.570312f , -0.907920f , 0.373419f , -0.190370f ,
-0.203125f , -0.171875f , 0.500000f , 0.991801f , 0.123975f , 0.030994f ,
-0.203125f , -0.187500f , 0.562500f , 0.991801f , 0.123975f , 0.030994f ,
-0.210938f , -0.226563f , 0.468750f , 0.991801f , 0.123975f , 0.030994f ,
--0.203125f , -0.171875f , 0.500000f , -0.991801f , 0.123975f , 0.030994f ,
--0.210938f , -0.226563f , 0.468750f , -0.991801f , 0.123975f , 0.030994f ,
--0.203125f , -0.187500f , 0.562500f , -0.991801f , 0.123975f , 0.030994f ,
-0.437500f , -0.140625f , 0.531250f , 0.079745f , -0.797452f , -0.598089f ,
-0.203125f , -0.187500f , 0.562500f , 0.079745f , -0.797452f , -0.598089f ,
-0.437500f , -0.093750f , 0.468750f , 0.079745f , -0.797452f , -0.598089f ,
--0.437500f , -0.140625f , 0.531250f , -0.079745f , -0.797452f , -0.598089f ,
--0.437500f , -0.093750f , 0.468750f , -0.079745f , -0.797452f , -0.598089f ,
--0.203125f , -0.187500f , 0.562500f , -0.079745f , -0.797452f , -0.598089f ,
-0.000000f , -0.195312f , -0.671875f , 0.373117f , -0.470405f , -0.799689f ,
-0.000000f , 0.070313f , -0.828125f , 0.373117f , -0.470405f , -0.799689f ,
-0.343750f , -0.148437f , -0.539062f , 0.373117f , -0.470405f , -0.799689f ,
-0.000000f , -0.195312f , -0.671875f , -0.373117f , -0.470405f , -0.799689f ,
--0.343750f , -0.148437f , -0.539062f , -0.373117f , -0.470405f , -0.799689f ,
-0.000000f , 0.070313f , -0.828125f , -0.373117f , -0.470405f , -0.799689f ,
-0.000000f , -0.382812f , -0.351563f , 0.330884f , -0.814402f , -0.476723f ,
-0.000000f , -0.195312f , -0.671875f , 0.330884f , -0.814402f , -0.476723f ,
-0.296875f , -0.312500f , -0.265625f , 0.330884f , -0.814402f , -0.476723f ,
-0.000000f , -0.382812f , -0.351563f , -0.330884f , -0.814402f , -0.476723f ,
--0.296875f , -0.312500f , -0.265625f , -0.330884f , -0.814402f , -0.476723f ,
-0.000000f , -0.195312f , -0.671875f , -0.330884f , -0.814402f , -0.476723f ,
-0.296875f , -0.312500f , -0.265625f , 0.303090f , -0.946422f , -0.111459f ,
-0.210938f , -0.390625f , 0.164062f , 0.303090f , -0.946422f , -0.111459f ,
-0.000000f , -0.460938f , 0.187500f , 0.303090f , -0.946422f , -0.111459f ,
--0.296875f , -0.312500f , -0.265625f , -0.265974f , -0.954013f , -0.138263f ,
-0.000000f , -0.382812f , -0.351563f , -0.265974f , -0.954013f , -0.138263f ,
-0.000000f , -0.460938f , 0.187500f , -0.265974f , -0.954013f , -0.138263f ,
-0.210938f , -0.390625f , 0.164062f , 0.348743f , -0.929981f , -0.116248f ,
-0.179688f , -0.414062f , 0.257812f , 0.348743f , -0.929981f , -0.116248f ,
-0.000000f , -0.484375f , 0.281250f , 0.348743f , -0.929981f , -0.116248f ,
--0.210938f , -0.390625f , 0.164062f , -0.284208f , -0.930136f , -0.232534f ,
-0.000000f , -0.460938f , 0.187500f , -0.284208f , -0.930136f , -0.232534f ,
-0.000000f , -0.484375f , 0.281250f , -0.284208f , -0.930136f , -0.232534f ,
-0.218750f , -0.281250f , 0.429688f , 0.956962f , 0.257365f , -0.134120f ,
-0.234375f , -0.351563f , 0.406250f , 0.956962f , 0.257365f , -0.134120f ,
-0.210938f , -0.390625f , 0.164062f , 0.956962f , 0.257365f , -0.134120f ,
--0.218750f , -0.281250f , 0.429688f , -0.956962f , 0.257365f , -0.134120f ,
--0.210938f , -0.390625f , 0.164062f , -0.956962f , 0.257365f , -0.134120f ,
--0.234375f , -0.351563f , 0.406250f , -0.956962f , 0.257365f , -0.134120f ,
-0.601562f , -0.000000f , 0.414062f , 0.861521f , -0.337915f , 0.378940f ,
-0.734375f , -0.046875f , 0.070312f , 0.861521f , -0.337915f , 0.378940f ,
-0.851562f , 0.234375f , 0.054688f , 0.861521f , -0.337915f , 0.378940f ,
--0.601562f , -0.000000f , 0.414062f , -0.691649f , -0.722163f , 0.010171f ,
--0.773438f , 0.164062f , 0.375000f , -0.691649f , -0.722163f , 0.010171f ,
--0.851562f , 0.234375f , 0.054688f , -0.691649f , -0.722163f , 0.010171f ,
-0.000000f , 0.070313f , -0.828125f , 0.436826f , -0.042787f , -0.898528f ,
-0.000000f , 0.562500f , -0.851562f , 0.436826f , -0.042787f , -0.898528f ,
-0.335938f , 0.054688f , -0.664062f , 0.436826f , -0.042787f , -0.898528f ,
-0.000000f , 0.070313f , -0.828125f , -0.436826f , -0.042787f , -0.898528f ,
--0.335938f , 0.054688f , -0.664062f , -0.436826f , -0.042787f , -0.898528f ,
-0.000000f , 0.562500f , -0.851562f , -0.436826f , -0.042787f , -0.898528f ,
-0.000000f , 0.984375f , -0.078125f , 0.112859f , 0.967467f , 0.226428f ,
-0.000000f , 0.898438f , 0.289063f , 0.112859f , 0.967467f , 0.226428f ,
-0.453125f , 0.929688f , -0.070312f , 0.112859f , 0.967467f , 0.226428f ,
-0.000000f , 0.984375f , -0.078125f , -0.112859f , 0.967467f , 0.226428f ,
--0.453125f , 0.929688f , -0.070312f , -0.112859f , 0.967467f , 0.226428f ,
-0.000000f , 0.898438f , 0.289063f , -0.112859f , 0.967467f , 0.226428f ,
-0.453125f , 0.929688f , -0.070312f , 0.137320f , 0.971291f , -0.194258f ,
-0.453125f , 0.867188f , -0.382812f , 0.137320f , 0.971291f , -0.194258f ,
-0.000000f , 0.898438f , -0.546875f , 0.137320f , 0.971291f , -0.194258f ,
--0.453125f , 0.929688f , -0.070312f , -0.120926f , 0.976388f , -0.179005f ,
-0.000000f , 0.984375f , -0.078125f , -0.120926f , 0.976388f , -0.179005f ,
-0.000000f , 0.898438f , -0.546875f , -0.120926f , 0.976388f , -0.179005f ,
-0.453125f , 0.867188f , -0.382812f , 0.387556f , 0.555474f , -0.735696f ,
-0.460938f , 0.437500f , -0.703125f , 0.387556f , 0.555474f , -0.735696f ,
-0.000000f , 0.562500f , -0.851562f , 0.387556f , 0.555474f , -0.735696f ,
--0.453125f , 0.867188f , -0.382812f , -0.300033f , 0.640864f , -0.706593f ,
-0.000000f , 0.898438f , -0.546875f , -0.300033f , 0.640864f , -0.706593f ,
-0.000000f , 0.562500f , -0.851562f , -0.300033f , 0.640864f , -0.706593f ,
-0.796875f , 0.406250f , 0.460938f , 0.565951f , 0.760496f , -0.318347f ,
-0.726562f , 0.406250f , 0.335938f , 0.565951f , 0.760496f , -0.318347f ,
-0.632812f , 0.453125f , 0.281250f , 0.565951f , 0.760496f , -0.318347f ,
--0.796875f , 0.406250f , 0.460938f , -0.352190f , 0.932651f , -0.078264f ,
--0.679688f , 0.453125f , 0.492188f , -0.352190f , 0.932651f , -0.078264f ,
--0.632812f , 0.453125f , 0.281250f , -0.352190f , 0.932651f , -0.078264f ,
-0.726562f , 0.406250f , 0.335938f , 0.343166f , 0.696426f , 0.630260f ,
-0.796875f , 0.562500f , 0.125000f , 0.343166f , 0.696426f , 0.630260f ,
-0.640625f , 0.703125f , 0.054688f , 0.343166f , 0.696426f , 0.630260f ,
--0.726562f , 0.406250f , 0.335938f , 0.094386f , 0.670139f , 0.736210f ,
--0.632812f , 0.453125f , 0.281250f , 0.094386f , 0.670139f , 0.736210f ,
--0.640625f , 0.703125f , 0.054688f , 0.094386f , 0.670139f , 0.736210f ,
-0.796875f , 0.562500f , 0.125000f , 0.583767f , 0.791981f , 0.178834f ,
-0.796875f , 0.617188f , -0.117187f , 0.583767f , 0.791981f , 0.178834f ,
-0.640625f , 0.750000f , -0.195312f , 0.583767f , 0.791981f , 0.178834f ,
--0.796875f , 0.562500f , 0.125000f , -0.625482f , 0.766875f , 0.143789f ,
--0.640625f , 0.703125f , 0.054688f , -0.625482f , 0.766875f , 0.143789f ,
--0.640625f , 0.750000f , -0.195312f , -0.625482f , 0.766875f , 0.143789f ,
-0.796875f , 0.617188f , -0.117187f , 0.715914f , 0.664472f , -0.214346f ,
-0.796875f , 0.539062f , -0.359375f , 0.715914f , 0.664472f , -0.214346f ,
-0.640625f , 0.679688f , -0.445312f , 0.715914f , 0.664472f , -0.214346f ,
--0.796875f , 0.617188f , -0.117187f , -0.690128f , 0.696659f , -0.195935f ,
--0.640625f , 0.750000f , -0.195312f , -0.690128f , 0.696659f , -0.195935f ,
--0.640625f , 0.679688f , -0.445312f , -0.690128f , 0.696659f , -0.195935f ,
-0.796875f , 0.539062f , -0.359375f , 0.590457f , 0.174525f , -0.787973f ,
-0.773438f , 0.265625f , -0.437500f , 0.590457f , 0.174525f , -0.787973f ,
-0.640625f , 0.679688f , -0.445312f , 0.590457f , 0.174525f , -0.787973f ,
--0.796875f , 0.539062f , -0.359375f , -0.590457f , 0.174525f , -0.787973f ,
--0.640625f , 0.679688f , -0.445312f , -0.590457f , 0.174525f , -0.787973f ,
--0.773438f , 0.265625f , -0.437500f , -0.590457f , 0.174525f , -0.787973f ,
-0.453125f , 0.867188f , -0.382812f , 0.058015f , 0.367429f , -0.928240f ,
-0.640625f , 0.679688f , -0.445312f , 0.058015f , 0.367429f , -0.928240f ,
-0.617188f , 0.328125f , -0.585938f , 0.058015f , 0.367429f , -0.928240f ,
--0.453125f , 0.867188f , -0.382812f , -0.714499f , 0.426452f , -0.554643f ,
--0.460938f , 0.437500f , -0.703125f , -0.714499f , 0.426452f , -0.554643f ,
--0.617188f , 0.328125f , -0.585938f , -0.714499f , 0.426452f , -0.554643f ,
-0.453125f , 0.929688f , -0.070312f , 0.595903f , 0.773063f , -0.217424f ,
-0.640625f , 0.750000f , -0.195312f , 0.595903f , 0.773063f , -0.217424f ,
-0.640625f , 0.679688f , -0.445312f , 0.595903f , 0.773063f , -0.217424f ,
--0.453125f , 0.929688f , -0.070312f , -0.675140f , 0.723364f , -0.144673f ,
--0.453125f , 0.867188f , -0.382812f , -0.675140f , 0.723364f , -0.144673f ,
--0.640625f , 0.679688f , -0.445312f , -0.675140f , 0.723364f , -0.144673f ,
-0.453125f , 0.851562f , 0.234375f , 0.690541f , 0.710905f , 0.133295f ,
-0.640625f , 0.703125f , 0.054688f , 0.690541f , 0.710905f , 0.133295f ,
-0.640625f , 0.750000f , -0.195312f , 0.690541f , 0.710905f , 0.133295f ,
--0.453125f , 0.851562f , 0.234375f , -0.738071f , 0.653580f , 0.167585f ,
--0.453125f , 0.929688f , -0.070312f , -0.738071f , 0.653580f , 0.167585f ,
--0.640625f , 0.750000f , -0.195312f , -0.738071f , 0.653580f , 0.167585f ,
-0.460938f , 0.523438f , 0.429688f , 0.677195f , 0.482375f , 0.555627f ,
-0.632812f , 0.453125f , 0.281250f , 0.677195f , 0.482375f , 0.555627f ,
-0.640625f , 0.703125f , 0.054688f , 0.677195f , 0.482375f , 0.555627f ,
--0.460938f , 0.523438f , 0.429688f , -0.776627f , 0.335766f , 0.533022f ,
--0.453125f , 0.851562f , 0.234375f , -0.776627f , 0.335766f , 0.533022f ,
--0.640625f , 0.703125f , 0.054688f , -0.776627f , 0.335766f , 0.533022f ,
-0.460938f , 0.523438f , 0.429688f , 0.158041f , 0.950572f , -0.267276f ,
-0.484375f , 0.554688f , 0.554688f , 0.158041f , 0.950572f , -0.267276f ,
-0.632812f , 0.453125f , 0.281250f , 0.158041f , 0.950572f , -0.267276f ,
--0.460938f , 0.523438f , 0.429688f , -0.158041f , 0.950572f , -0.267276f ,
--0.632812f , 0.453125f , 0.281250f , -0.158041f , 0.950572f , -0.267276f ,
--0.484375f , 0.554688f , 0.554688f , -0.158041f , 0.950572f , -0.267276f ,
-0.000000f , 0.898438f , 0.289063f , 0.156987f , 0.642722f , 0.749842f ,
-0.000000f , 0.570312f , 0.570312f , 0.156987f , 0.642722f , 0.749842f ,
-0.453125f , 0.851562f , 0.234375f , 0.156987f , 0.642722f , 0.749842f ,
-0.000000f , 0.898438f , 0.289063f , -0.156987f , 0.642722f , 0.749842f ,
--0.453125f , 0.851562f , 0.234375f , -0.156987f , 0.642722f , 0.749842f ,
-0.000000f , 0.570312f , 0.570312f , -0.156987f , 0.642722f , 0.749842f ,
-0.484375f , 0.554688f , 0.554688f , -0.168134f , 0.100505f , -0.980627f ,
-0.109375f , 0.460937f , 0.609375f , -0.168134f , 0.100505f , -0.980627f ,
-0.335938f , 0.687500f , 0.593750f , -0.168134f , 0.100505f , -0.980627f ,
--0.484375f , 0.554688f , 0.554688f , 0.168134f , 0.100505f , -0.980627f ,
--0.335938f , 0.687500f , 0.593750f , 0.168134f , 0.100505f , -0.980627f ,
--0.109375f , 0.460937f , 0.609375f , 0.168134f , 0.100505f , -0.980627f ,
-0.484375f , 0.554688f , 0.554688f , 0.023299f , 0.968843f , -0.246579f ,
-0.460938f , 0.523438f , 0.429688f , 0.023299f , 0.968843f , -0.246579f ,
-0.000000f , 0.570312f , 0.570312f , 0.023299f , 0.968843f , -0.246579f ,
--0.484375f , 0.554688f , 0.554688f , -0.041931f , 0.372966f , 0.926897f ,
--0.109375f , 0.460937f , 0.609375f , -0.041931f , 0.372966f , 0.926897f ,
-0.000000f , 0.570312f , 0.570312f , -0.041931f , 0.372966f , 0.926897f ,
-0.726562f , 0.406250f , 0.335938f , 0.498048f , 0.820648f , -0.280152f ,
-0.796875f , 0.406250f , 0.460938f , 0.498048f , 0.820648f , -0.280152f ,
-0.851562f , 0.234375f , 0.054688f , 0.498048f , 0.820648f , -0.280152f ,
--0.726562f , 0.406250f , 0.335938f , -0.498048f , 0.820648f , -0.280152f ,
--0.851562f , 0.234375f , 0.054688f , -0.498048f , 0.820648f , -0.280152f ,
--0.796875f , 0.406250f , 0.460938f , -0.498048f , 0.820648f , -0.280152f ,
-0.859375f , 0.320312f , -0.046875f , 0.945595f , 0.013329f , 0.325072f ,
-0.796875f , 0.562500f , 0.125000f , 0.945595f , 0.013329f , 0.325072f ,
-0.726562f , 0.406250f , 0.335938f , 0.945595f , 0.013329f , 0.325072f ,
--0.859375f , 0.320312f , -0.046875f , -0.933361f , 0.235393f , 0.270976f ,
--0.851562f , 0.234375f , 0.054688f , -0.933361f , 0.235393f , 0.270976f ,
--0.726562f , 0.406250f , 0.335938f , -0.933361f , 0.235393f , 0.270976f ,
-0.820312f , 0.328125f , -0.203125f , 0.996980f , 0.075751f , 0.017105f ,
-0.796875f , 0.617188f , -0.117187f , 0.996980f , 0.075751f , 0.017105f ,
-0.796875f , 0.562500f , 0.125000f , 0.996980f , 0.075751f , 0.017105f ,
--0.820312f , 0.328125f , -0.203125f , -0.901926f , 0.379315f , -0.206516f ,
--0.859375f , 0.320312f , -0.046875f , -0.901926f , 0.379315f , -0.206516f ,
--0.796875f , 0.562500f , 0.125000f , -0.901926f , 0.379315f , -0.206516f ,
-0.820312f , 0.328125f , -0.203125f , 0.961699f , 0.146796f , -0.231485f ,
-0.773438f , 0.265625f , -0.437500f , 0.961699f , 0.146796f , -0.231485f ,
-0.796875f , 0.617188f , -0.117187f , 0.961699f , 0.146796f , -0.231485f ,
--0.820312f , 0.328125f , -0.203125f , -0.961699f , 0.146796f , -0.231485f ,
--0.796875f , 0.617188f , -0.117187f , -0.961699f , 0.146796f , -0.231485f ,
--0.773438f , 0.265625f , -0.437500f , -0.961699f , 0.146796f , -0.231485f ,
-0.406250f , -0.171875f , 0.148437f , 0.746041f , -0.659560f , 0.091670f ,
-0.210938f , -0.390625f , 0.164062f , 0.746041f , -0.659560f , 0.091670f ,
-0.429688f , -0.195312f , -0.210938f , 0.746041f , -0.659560f , 0.091670f ,
--0.406250f , -0.171875f , 0.148437f , -0.746041f , -0.659560f , 0.091670f ,
--0.429688f , -0.195312f , -0.210938f , -0.746041f , -0.659560f , 0.091670f ,
--0.210938f , -0.390625f , 0.164062f , -0.746041f , -0.659560f , 0.091670f ,
-0.593750f , -0.125000f , -0.164062f , 0.371878f , -0.924382f , 0.085001f ,
-0.734375f , -0.046875f , 0.070312f , 0.371878f , -0.924382f , 0.085001f ,
-0.429688f , -0.195312f , -0.210938f , 0.371878f , -0.924382f , 0.085001f ,
--0.593750f , -0.125000f , -0.164062f , -0.371878f , -0.924382f , 0.085001f ,
--0.429688f , -0.195312f , -0.210938f , -0.371878f , -0.924382f , 0.085001f ,
--0.734375f , -0.046875f , 0.070312f , -0.371878f , -0.924382f , 0.085001f ,
-0.437500f , -0.093750f , 0.468750f , 0.387671f , -0.903540f , 0.182554f ,
-0.406250f , -0.171875f , 0.148437f , 0.387671f , -0.903540f , 0.182554f ,
-0.734375f , -0.046875f , 0.070312f , 0.387671f , -0.903540f , 0.182554f ,
--0.437500f , -0.093750f , 0.468750f , -0.548020f , -0.773958f , 0.317275f ,
--0.601562f , -0.000000f , 0.414062f , -0.548020f , -0.773958f , 0.317275f ,
--0.734375f , -0.046875f , 0.070312f , -0.548020f , -0.773958f , 0.317275f ,
-0.210938f , -0.226563f , 0.468750f , 0.848945f , -0.221464f , 0.479839f ,
-0.218750f , -0.281250f , 0.429688f , 0.848945f , -0.221464f , 0.479839f ,
-0.406250f , -0.171875f , 0.148437f , 0.848945f , -0.221464f , 0.479839f ,
--0.210938f , -0.226563f , 0.468750f , -0.499284f , -0.851720f , 0.159026f ,
--0.437500f , -0.093750f , 0.468750f , -0.499284f , -0.851720f , 0.159026f ,
--0.406250f , -0.171875f , 0.148437f , -0.499284f , -0.851720f , 0.159026f ,
-0.617188f , 0.328125f , -0.585938f , 0.570582f , -0.344303f , -0.745582f ,
-0.773438f , 0.265625f , -0.437500f , 0.570582f , -0.344303f , -0.745582f ,
-0.484375f , 0.023438f , -0.546875f , 0.570582f , -0.344303f , -0.745582f ,
--0.617188f , 0.328125f , -0.585938f , -0.570582f , -0.344303f , -0.745582f ,
--0.484375f , 0.023438f , -0.546875f , -0.570582f , -0.344303f , -0.745582f ,
--0.773438f , 0.265625f , -0.437500f , -0.570582f , -0.344303f , -0.745582f ,
-0.335938f , 0.054688f , -0.664062f , 0.562892f , -0.263733f , -0.783325f ,
-0.460938f , 0.437500f , -0.703125f , 0.562892f , -0.263733f , -0.783325f ,
-0.484375f , 0.023438f , -0.546875f , 0.562892f , -0.263733f , -0.783325f ,
--0.335938f , 0.054688f , -0.664062f , -0.562892f , -0.263733f , -0.783325f ,
--0.484375f , 0.023438f , -0.546875f , -0.562892f , -0.263733f , -0.783325f ,
--0.460938f , 0.437500f , -0.703125f , -0.562892f , -0.263733f , -0.783325f ,
-0.640625f , -0.007812f , -0.429688f , 0.105938f , -0.916539f , -0.385660f ,
-0.593750f , -0.125000f , -0.164062f , 0.105938f , -0.916539f , -0.385660f ,
-0.484375f , 0.023438f , -0.546875f , 0.105938f , -0.916539f , -0.385660f ,
--0.640625f , -0.007812f , -0.429688f , -0.105938f , -0.916539f , -0.385660f ,
--0.484375f , 0.023438f , -0.546875f , -0.105938f , -0.916539f , -0.385660f ,
--0.593750f , -0.125000f , -0.164062f , -0.105938f , -0.916539f , -0.385660f ,
-0.429688f , -0.195312f , -0.210938f , 0.697614f , -0.647014f , -0.307746f ,
-0.296875f , -0.312500f , -0.265625f , 0.697614f , -0.647014f , -0.307746f ,
-0.484375f , 0.023438f , -0.546875f , 0.697614f , -0.647014f , -0.307746f ,
--0.429688f , -0.195312f , -0.210938f , -0.697614f , -0.647014f , -0.307746f ,
--0.484375f , 0.023438f , -0.546875f , -0.697614f , -0.647014f , -0.307746f ,
--0.296875f , -0.312500f , -0.265625f , -0.697614f , -0.647014f , -0.307746f ,
-1.015625f , 0.414062f , -0.289062f , 0.480811f , 0.254547f , 0.839063f ,
-1.023438f , 0.476562f , -0.312500f , 0.480811f , 0.254547f , 0.839063f ,
-0.921875f , 0.359375f , -0.218750f , 0.480811f , 0.254547f , 0.839063f ,
--1.015625f , 0.414062f , -0.289062f , -0.480811f , 0.254547f , 0.839063f ,
--0.921875f , 0.359375f , -0.218750f , -0.480811f , 0.254547f , 0.839063f ,
--1.023438f , 0.476562f , -0.312500f , -0.480811f , 0.254547f , 0.839063f ,
-1.015625f , 0.414062f , -0.289062f , 0.503292f , 0.047933f , 0.862786f ,
-1.187500f , 0.437500f , -0.390625f , 0.503292f , 0.047933f , 0.862786f ,
-1.234375f , 0.507812f , -0.421875f , 0.503292f , 0.047933f , 0.862786f ,
--1.015625f , 0.414062f , -0.289062f , -0.410191f , 0.274828f , 0.869605f ,
--1.023438f , 0.476562f , -0.312500f , -0.410191f , 0.274828f , 0.869605f ,
--1.234375f , 0.507812f , -0.421875f , -0.410191f , 0.274828f , 0.869605f ,
-1.351562f , 0.320313f , -0.421875f , 0.145938f , 0.091211f , 0.985080f ,
-1.234375f , 0.507812f , -0.421875f , 0.145938f , 0.091211f , 0.985080f ,
-1.265625f , 0.289063f , -0.406250f , 0.145938f , 0.091211f , 0.985080f ,
--1.351562f , 0.320313f , -0.421875f , -0.145938f , 0.091211f , 0.985080f ,
--1.265625f , 0.289063f , -0.406250f , -0.145938f , 0.091211f , 0.985080f ,
--1.234375f , 0.507812f , -0.421875f , -0.145938f , 0.091211f , 0.985080f ,
-1.281250f , 0.054688f , -0.429688f , 0.283452f , -0.103074f , 0.953431f ,
-1.351562f , 0.320313f , -0.421875f , 0.283452f , -0.103074f , 0.953431f ,
-1.210938f , 0.078125f , -0.406250f , 0.283452f , -0.103074f , 0.953431f ,
--1.281250f , 0.054688f , -0.429688f , -0.283452f , -0.103074f , 0.953431f ,
--1.210938f , 0.078125f , -0.406250f , -0.283452f , -0.103074f , 0.953431f ,
--1.351562f , 0.320313f , -0.421875f , -0.283452f , -0.103074f , 0.953431f ,
-1.039062f , -0.101562f , -0.328125f , 0.505826f , -0.246744f , 0.826594f ,
-1.281250f , 0.054688f , -0.429688f , 0.505826f , -0.246744f , 0.826594f ,
-1.031250f , -0.039062f , -0.304688f , 0.505826f , -0.246744f , 0.826594f ,
--1.039062f , -0.101562f , -0.328125f , -0.505826f , -0.246744f , 0.826594f ,
--1.031250f , -0.039062f , -0.304688f , -0.505826f , -0.246744f , 0.826594f ,
--1.281250f , 0.054688f , -0.429688f , -0.505826f , -0.246744f , 0.826594f ,
-1.031250f , -0.039062f , -0.304688f , 0.624650f , -0.412140f , 0.663289f ,
-0.828125f , -0.070312f , -0.132812f , 0.624650f , -0.412140f , 0.663289f ,
-0.773438f , -0.140625f , -0.125000f , 0.624650f , -0.412140f , 0.663289f ,
--1.031250f , -0.039062f , -0.304688f , -0.613244f , -0.208998f , 0.761743f ,
--1.039062f , -0.101562f , -0.328125f , -0.613244f , -0.208998f , 0.761743f ,
--0.773438f , -0.140625f , -0.125000f , -0.613244f , -0.208998f , 0.761743f ,
-0.828125f , -0.070312f , -0.132812f , 0.484318f , 0.558018f , 0.673834f ,
-1.031250f , -0.039062f , -0.304688f , 0.484318f , 0.558018f , 0.673834f ,
-0.882812f , -0.023437f , -0.210938f , 0.484318f , 0.558018f , 0.673834f ,
--0.828125f , -0.070312f , -0.132812f , -0.484318f , 0.558018f , 0.673833f ,
--0.882812f , -0.023437f , -0.210938f , -0.484318f , 0.558018f , 0.673833f ,
--1.031250f , -0.039062f , -0.304688f , -0.484318f , 0.558018f , 0.673833f ,
-1.187500f , 0.093750f , -0.445312f , -0.269338f , 0.831434f , 0.485979f ,
-1.039062f , 0.000000f , -0.367188f , -0.269338f , 0.831434f , 0.485979f ,
-1.031250f , -0.039062f , -0.304688f , -0.269338f , 0.831434f , 0.485979f ,
--1.187500f , 0.093750f , -0.445312f , 0.264198f , 0.830336f , 0.490653f ,
--1.210938f , 0.078125f , -0.406250f , 0.264198f , 0.830336f , 0.490653f ,
--1.031250f , -0.039062f , -0.304688f , 0.264198f , 0.830336f , 0.490653f ,
-1.210938f , 0.078125f , -0.406250f , -0.800022f , 0.207413f , 0.562979f ,
-1.265625f , 0.289063f , -0.406250f , -0.800022f , 0.207413f , 0.562979f ,
-1.187500f , 0.093750f , -0.445312f , -0.800022f , 0.207413f , 0.562979f ,
--1.210938f , 0.078125f , -0.406250f , 0.800022f , 0.207413f , 0.562978f ,
--1.187500f , 0.093750f , -0.445312f , 0.800022f , 0.207413f , 0.562978f ,
--1.265625f , 0.289063f , -0.406250f , 0.800022f , 0.207413f , 0.562978f ,
-1.265625f , 0.289063f , -0.406250f , -0.522496f , -0.356527f , 0.774523f ,
-1.187500f , 0.437500f , -0.390625f , -0.522496f , -0.356527f , 0.774523f ,
-1.234375f , 0.250000f , -0.445312f , -0.522496f , -0.356527f , 0.774523f ,
--1.265625f , 0.289063f , -0.406250f , 0.522496f , -0.356527f , 0.774523f ,
--1.234375f , 0.250000f , -0.445312f , 0.522496f , -0.356527f , 0.774523f ,
--1.187500f , 0.437500f , -0.390625f , 0.522496f , -0.356527f , 0.774523f ,
-1.187500f , 0.437500f , -0.390625f , 0.486190f , -0.519041f , 0.703005f ,
-1.015625f , 0.414062f , -0.289062f , 0.486190f , -0.519041f , 0.703005f ,
-1.171875f , 0.359375f , -0.437500f , 0.486190f , -0.519041f , 0.703005f ,
--1.187500f , 0.437500f , -0.390625f , -0.486190f , -0.519041f , 0.703005f ,
--1.171875f , 0.359375f , -0.437500f , -0.486190f , -0.519041f , 0.703005f ,
--1.015625f , 0.414062f , -0.289062f , -0.486190f , -0.519041f , 0.703005f ,
-0.921875f , 0.359375f , -0.218750f , 0.714339f , -0.416698f , 0.562212f ,
-0.945312f , 0.304688f , -0.289062f , 0.714339f , -0.416698f , 0.562212f ,
-1.023438f , 0.343750f , -0.359375f , 0.714339f , -0.416698f , 0.562212f ,
--0.921875f , 0.359375f , -0.218750f , -0.688357f , -0.473246f , 0.549730f ,
--1.015625f , 0.414062f , -0.289062f , -0.688357f , -0.473246f , 0.549730f ,
--1.023438f , 0.343750f , -0.359375f , -0.688357f , -0.473246f , 0.549730f ,
-0.726562f , 0.000000f , -0.070312f , 0.996972f , -0.037764f , -0.067975f ,
-0.734375f , -0.046875f , 0.070312f , 0.996972f , -0.037764f , -0.067975f ,
-0.718750f , -0.023437f , -0.171875f , 0.996972f , -0.037764f , -0.067975f ,
--0.726562f , 0.000000f , -0.070312f , -0.996972f , -0.037764f , -0.067975f ,
--0.718750f , -0.023437f , -0.171875f , -0.996972f , -0.037764f , -0.067975f ,
--0.734375f , -0.046875f , 0.070312f , -0.996972f , -0.037764f , -0.067975f ,
-0.718750f , -0.023437f , -0.171875f , -0.197104f , 0.314030f , 0.928728f ,
-0.593750f , -0.125000f , -0.164062f , -0.197104f , 0.314030f , 0.928728f ,
-0.828125f , -0.070312f , -0.132812f , -0.197104f , 0.314030f , 0.928728f ,
--0.718750f , -0.023437f , -0.171875f , 0.197104f , 0.314030f , 0.928728f ,
--0.828125f , -0.070312f , -0.132812f , 0.197104f , 0.314030f , 0.928728f ,
--0.593750f , -0.125000f , -0.164062f , 0.197104f , 0.314030f , 0.928728f ,
-0.734375f , -0.046875f , 0.070312f , 0.914238f , -0.366421f , -0.172931f ,
-0.726562f , 0.000000f , -0.070312f , 0.914238f , -0.366421f , -0.172931f ,
-0.859375f , 0.320312f , -0.046875f , 0.914238f , -0.366421f , -0.172931f ,
--0.734375f , -0.046875f , 0.070312f , -0.887036f , -0.383852f , -0.256564f ,
--0.851562f , 0.234375f , 0.054688f , -0.887036f , -0.383852f , -0.256564f ,
--0.859375f , 0.320312f , -0.046875f , -0.887036f , -0.383852f , -0.256564f ,
-0.843750f , 0.289062f , -0.210937f , -0.120386f , 0.240772f , 0.963087f ,
-0.921875f , 0.359375f , -0.218750f , -0.120386f , 0.240772f , 0.963087f ,
-0.890625f , 0.406250f , -0.234375f , -0.120386f , 0.240772f , 0.963087f ,
--0.843750f , 0.289062f , -0.210937f , -0.371135f , 0.037113f , 0.927837f ,
--0.820312f , 0.328125f , -0.203125f , -0.371135f , 0.037113f , 0.927837f ,
--0.890625f , 0.406250f , -0.234375f , -0.371135f , 0.037113f , 0.927837f ,
-0.882812f , -0.023437f , -0.210938f , 0.023355f , 0.994904f , 0.098089f ,
-0.812500f , -0.015625f , -0.273438f , 0.023355f , 0.994904f , 0.098089f ,
-0.718750f , -0.023437f , -0.171875f , 0.023355f , 0.994904f , 0.098089f ,
--0.882812f , -0.023437f , -0.210938f , -0.137793f , 0.803793f , 0.578731f ,
--0.828125f , -0.070312f , -0.132812f , -0.137793f , 0.803793f , 0.578731f ,
--0.718750f , -0.023437f , -0.171875f , -0.137793f , 0.803793f , 0.578731f ,
-0.812500f , -0.015625f , -0.273438f , 0.606788f , -0.606788f , 0.513436f ,
-0.843750f , 0.015625f , -0.273438f , 0.606788f , -0.606788f , 0.513436f ,
-0.718750f , -0.023437f , -0.171875f , 0.606788f , -0.606788f , 0.513436f ,
--0.812500f , -0.015625f , -0.273438f , -0.606788f , -0.606788f , 0.513436f ,
--0.718750f , -0.023437f , -0.171875f , -0.606788f , -0.606788f , 0.513436f ,
--0.843750f , 0.015625f , -0.273438f , -0.606788f , -0.606788f , 0.513436f ,
-0.718750f , 0.039063f , -0.187500f , 0.580199f , 0.193400f , 0.791180f ,
-0.843750f , 0.015625f , -0.273438f , 0.580199f , 0.193400f , 0.791180f ,
-0.820312f , 0.085938f , -0.273438f , 0.580199f , 0.193400f , 0.791180f ,
--0.718750f , 0.039063f , -0.187500f , -0.102194f , 0.817553f , 0.566713f ,
--0.757812f , 0.093750f , -0.273438f , -0.102194f , 0.817553f , 0.566713f ,
--0.820312f , 0.085938f , -0.273438f , -0.102194f , 0.817553f , 0.566713f ,
-0.757812f , 0.093750f , -0.273438f , 0.701334f , -0.701334f , -0.127515f ,
-0.835938f , 0.171875f , -0.273438f , 0.701334f , -0.701334f , -0.127515f ,
-0.718750f , 0.039063f , -0.187500f , 0.701334f , -0.701334f , -0.127515f ,
--0.757812f , 0.093750f , -0.273438f , -0.701334f , -0.701334f , -0.127515f ,
--0.718750f , 0.039063f , -0.187500f , -0.701334f , -0.701334f , -0.127515f ,
--0.835938f , 0.171875f , -0.273438f , -0.701334f , -0.701334f , -0.127515f ,
-0.890625f , 0.242188f , -0.265625f , 0.457983f , -0.441913f , 0.771339f ,
-0.843750f , 0.289062f , -0.210937f , 0.457983f , -0.441913f , 0.771339f ,
-0.835938f , 0.171875f , -0.273438f , 0.457983f , -0.441913f , 0.771339f ,
--0.890625f , 0.242188f , -0.265625f , -0.457983f , -0.441913f , 0.771339f ,
--0.835938f , 0.171875f , -0.273438f , -0.457983f , -0.441913f , 0.771339f ,
--0.843750f , 0.289062f , -0.210937f , -0.457983f , -0.441913f , 0.771339f ,
-0.945312f , 0.304688f , -0.289062f , 0.715512f , -0.415459f , 0.561638f ,
-0.921875f , 0.359375f , -0.218750f , 0.715512f , -0.415459f , 0.561638f ,
-0.890625f , 0.242188f , -0.265625f , 0.715512f , -0.415459f , 0.561638f ,
--0.945312f , 0.304688f , -0.289062f , -0.715512f , -0.415459f , 0.561638f ,
--0.890625f , 0.242188f , -0.265625f , -0.715512f , -0.415459f , 0.561638f ,
--0.921875f , 0.359375f , -0.218750f , -0.715512f , -0.415459f , 0.561638f ,
-0.820312f , 0.328125f , -0.203125f , 0.827147f , 0.532322f , -0.180171f ,
-0.859375f , 0.320312f , -0.046875f , 0.827147f , 0.532322f , -0.180171f ,
-0.843750f , 0.289062f , -0.210937f , 0.827147f , 0.532322f , -0.180171f ,
--0.820312f , 0.328125f , -0.203125f , -0.827147f , 0.532322f , -0.180171f ,
--0.843750f , 0.289062f , -0.210937f , -0.827147f , 0.532322f , -0.180171f ,
--0.859375f , 0.320312f , -0.046875f , -0.827147f , 0.532322f , -0.180171f ,
-0.796875f , 0.203125f , -0.210937f , 0.900500f , -0.433574f , -0.033352f ,
-0.859375f , 0.320312f , -0.046875f , 0.900500f , -0.433574f , -0.033352f ,
-0.718750f , 0.039063f , -0.187500f , 0.900500f , -0.433574f , -0.033352f ,
--0.796875f , 0.203125f , -0.210937f , -0.900500f , -0.433574f , -0.033352f ,
--0.718750f , 0.039063f , -0.187500f , -0.900500f , -0.433574f , -0.033352f ,
--0.859375f , 0.320312f , -0.046875f , -0.900500f , -0.433574f , -0.033352f ,
-0.890625f , 0.242188f , -0.265625f , 0.676753f , -0.728811f , 0.104116f ,
-0.890625f , 0.234375f , -0.320312f , 0.676753f , -0.728811f , 0.104116f ,
-0.953125f , 0.289063f , -0.343750f , 0.676753f , -0.728811f , 0.104116f ,
--0.890625f , 0.242188f , -0.265625f , -0.772350f , -0.573034f , 0.274059f ,
--0.945312f , 0.304688f , -0.289062f , -0.772350f , -0.573034f , 0.274059f ,
--0.953125f , 0.289063f , -0.343750f , -0.772350f , -0.573034f , 0.274059f ,
-0.890625f , 0.234375f , -0.320312f , 0.797077f , -0.597808f , 0.085401f ,
-0.890625f , 0.242188f , -0.265625f , 0.797077f , -0.597808f , 0.085401f ,
-0.843750f , 0.171875f , -0.320312f , 0.797077f , -0.597808f , 0.085401f ,
--0.890625f , 0.234375f , -0.320312f , -0.797077f , -0.597808f , 0.085401f ,
--0.843750f , 0.171875f , -0.320312f , -0.797077f , -0.597808f , 0.085401f ,
--0.890625f , 0.242188f , -0.265625f , -0.797077f , -0.597808f , 0.085401f ,
-0.757812f , 0.093750f , -0.273438f , 0.702247f , -0.702247f , 0.117041f ,
-0.765625f , 0.093750f , -0.320312f , 0.702247f , -0.702247f , 0.117041f ,
-0.843750f , 0.171875f , -0.320312f , 0.702247f , -0.702247f , 0.117041f ,
--0.757812f , 0.093750f , -0.273438f , -0.702247f , -0.702247f , 0.117041f ,
--0.835938f , 0.171875f , -0.273438f , -0.702247f , -0.702247f , 0.117041f ,
--0.843750f , 0.171875f , -0.320312f , -0.702247f , -0.702247f , 0.117041f ,
-0.765625f , 0.093750f , -0.320312f , 0.242338f , 0.969351f , 0.040390f ,
-0.757812f , 0.093750f , -0.273438f , 0.242338f , 0.969351f , 0.040390f ,
-0.828125f , 0.078125f , -0.320312f , 0.242338f , 0.969351f , 0.040390f ,
--0.765625f , 0.093750f , -0.320312f , -0.242338f , 0.969351f , 0.040390f ,
--0.828125f , 0.078125f , -0.320312f , -0.242338f , 0.969351f , 0.040390f ,
--0.757812f , 0.093750f , -0.273438f , -0.242338f , 0.969351f , 0.040390f ,
-0.828125f , 0.078125f , -0.320312f , 0.931907f , 0.349465f , 0.097074f ,
-0.820312f , 0.085938f , -0.273438f , 0.931907f , 0.349465f , 0.097074f ,
-0.851562f , 0.015625f , -0.320312f , 0.931907f , 0.349465f , 0.097074f ,
--0.828125f , 0.078125f , -0.320312f , -0.931907f , 0.349465f , 0.097074f ,
--0.851562f , 0.015625f , -0.320312f , -0.931907f , 0.349465f , 0.097074f ,
--0.820312f , 0.085938f , -0.273438f , -0.931907f , 0.349465f , 0.097074f ,
-0.812500f , -0.015625f , -0.273438f , 0.624695f , -0.780869f , -0.000000f ,
-0.812500f , -0.015625f , -0.320312f , 0.624695f , -0.780869f , -0.000000f ,
-0.851562f , 0.015625f , -0.320312f , 0.624695f , -0.780869f , -0.000000f ,
--0.812500f , -0.015625f , -0.273438f , -0.702247f , -0.702247f , 0.117041f ,
--0.843750f , 0.015625f , -0.273438f , -0.702247f , -0.702247f , 0.117041f ,
--0.851562f , 0.015625f , -0.320312f , -0.702247f , -0.702247f , 0.117041f ,
-0.882812f , -0.023437f , -0.210938f , -0.109335f , 0.984015f , 0.140574f ,
-0.882812f , -0.015625f , -0.265625f , -0.109335f , 0.984015f , 0.140574f ,
-0.812500f , -0.015625f , -0.320312f , -0.109335f , 0.984015f , 0.140574f ,
--0.882812f , -0.023437f , -0.210938f , -0.110432f , 0.993884f , 0.000000f ,
--0.812500f , -0.015625f , -0.273438f , -0.110432f , 0.993884f , 0.000000f ,
--0.812500f , -0.015625f , -0.320312f , -0.110432f , 0.993884f , 0.000000f ,
-0.945312f , 0.304688f , -0.289062f , 0.586648f , -0.752681f , 0.298858f ,
-0.953125f , 0.289063f , -0.343750f , 0.586648f , -0.752681f , 0.298858f ,
-1.039062f , 0.328125f , -0.414062f , 0.586648f , -0.752681f , 0.298858f ,
--0.945312f , 0.304688f , -0.289062f , -0.661828f , -0.649341f , 0.374620f ,
--1.023438f , 0.343750f , -0.359375f , -0.661828f , -0.649341f , 0.374620f ,
--1.039062f , 0.328125f , -0.414062f , -0.661828f , -0.649341f , 0.374620f ,
-1.023438f , 0.343750f , -0.359375f , 0.252879f , -0.908786f , 0.331904f ,
-1.039062f , 0.328125f , -0.414062f , 0.252879f , -0.908786f , 0.331904f ,
-1.187500f , 0.343750f , -0.484375f , 0.252879f , -0.908786f , 0.331904f ,
--1.023438f , 0.343750f , -0.359375f , -0.296806f , -0.871867f , 0.389557f ,
--1.171875f , 0.359375f , -0.437500f , -0.296806f , -0.871867f , 0.389557f ,
--1.187500f , 0.343750f , -0.484375f , -0.296806f , -0.871867f , 0.389557f ,
-1.171875f , 0.359375f , -0.437500f , -0.822210f , -0.562565f , -0.086549f ,
-1.187500f , 0.343750f , -0.484375f , -0.822210f , -0.562565f , -0.086549f ,
-1.257812f , 0.242188f , -0.492188f , -0.822210f , -0.562565f , -0.086549f ,
--1.171875f , 0.359375f , -0.437500f , 0.827110f , -0.448433f , -0.338816f ,
--1.234375f , 0.250000f , -0.445312f , 0.827110f , -0.448433f , -0.338816f ,
--1.257812f , 0.242188f , -0.492188f , 0.827110f , -0.448433f , -0.338816f ,
-1.210938f , 0.085938f , -0.484375f , -0.816910f , 0.218382f , -0.533823f ,
-1.187500f , 0.093750f , -0.445312f , -0.816910f , 0.218382f , -0.533823f ,
-1.257812f , 0.242188f , -0.492188f , -0.816910f , 0.218382f , -0.533823f ,
--1.210938f , 0.085938f , -0.484375f , 0.816910f , 0.218382f , -0.533823f ,
--1.257812f , 0.242188f , -0.492188f , 0.816910f , 0.218382f , -0.533823f ,
--1.187500f , 0.093750f , -0.445312f , 0.816910f , 0.218382f , -0.533823f ,
-1.046875f , 0.000000f , -0.421875f , -0.483417f , 0.872662f , -0.069060f ,
-1.039062f , 0.000000f , -0.367188f , -0.483417f , 0.872662f , -0.069060f ,
-1.210938f , 0.085938f , -0.484375f , -0.483417f , 0.872662f , -0.069060f ,
--1.046875f , 0.000000f , -0.421875f , 0.483417f , 0.872662f , -0.069060f ,
--1.210938f , 0.085938f , -0.484375f , 0.483417f , 0.872662f , -0.069060f ,
--1.039062f , 0.000000f , -0.367188f , 0.483417f , 0.872662f , -0.069060f ,
-0.882812f , -0.015625f , -0.265625f , 0.040373f , 0.989142f , 0.141306f ,
-0.882812f , -0.023437f , -0.210938f , 0.040373f , 0.989142f , 0.141306f ,
-1.046875f , 0.000000f , -0.421875f , 0.040373f , 0.989142f , 0.141306f ,
--0.882812f , -0.015625f , -0.265625f , -0.040373f , 0.989142f , 0.141306f ,
--1.046875f , 0.000000f , -0.421875f , -0.040373f , 0.989142f , 0.141306f ,
--0.882812f , -0.023437f , -0.210938f , -0.040373f , 0.989142f , 0.141306f ,
-0.890625f , 0.109375f , -0.328125f , 0.137516f , -0.027503f , 0.990118f ,
-0.828125f , 0.078125f , -0.320312f , 0.137516f , -0.027503f , 0.990118f ,
-0.937500f , 0.062500f , -0.335938f , 0.137516f , -0.027503f , 0.990118f ,
--0.890625f , 0.109375f , -0.328125f , -0.137516f , -0.027503f , 0.990118f ,
--0.937500f , 0.062500f , -0.335938f , -0.137516f , -0.027503f , 0.990118f ,
--0.828125f , 0.078125f , -0.320312f , -0.137516f , -0.027503f , 0.990118f ,
-0.960938f , 0.171875f , -0.351562f , 0.339983f , -0.029999f , 0.939953f ,
-0.890625f , 0.109375f , -0.328125f , 0.339983f , -0.029999f , 0.939953f ,
-1.000000f , 0.125000f , -0.367188f , 0.339983f , -0.029999f , 0.939953f ,
--0.960938f , 0.171875f , -0.351562f , -0.339983f , -0.029999f , 0.939953f ,
--1.000000f , 0.125000f , -0.367188f , -0.339983f , -0.029999f , 0.939953f ,
--0.890625f , 0.109375f , -0.328125f , -0.339983f , -0.029999f , 0.939953f ,
-1.000000f , 0.125000f , -0.367188f , 0.236807f , 0.035521f , 0.970907f ,
-1.054688f , 0.187500f , -0.382812f , 0.236807f , 0.035521f , 0.970907f ,
-1.015625f , 0.234375f , -0.375000f , 0.236807f , 0.035521f , 0.970907f ,
--1.000000f , 0.125000f , -0.367188f , -0.382991f , 0.011264f , 0.923684f ,
--0.960938f , 0.171875f , -0.351562f , -0.382991f , 0.011264f , 0.923684f ,
--1.015625f , 0.234375f , -0.375000f , -0.382991f , 0.011264f , 0.923684f ,
-1.085938f , 0.273438f , -0.390625f , 0.180460f , 0.067673f , 0.981252f ,
-1.015625f , 0.234375f , -0.375000f , 0.180460f , 0.067673f , 0.981252f ,
-1.109375f , 0.210938f , -0.390625f , 0.180460f , 0.067673f , 0.981252f ,
--1.085938f , 0.273438f , -0.390625f , -0.180460f , 0.067673f , 0.981252f ,
--1.109375f , 0.210938f , -0.390625f , -0.180460f , 0.067673f , 0.981252f ,
--1.015625f , 0.234375f , -0.375000f , -0.180460f , 0.067673f , 0.981252f ,
-0.953125f , 0.289063f , -0.343750f , 0.308264f , -0.181332f , 0.933859f ,
-1.015625f , 0.234375f , -0.375000f , 0.308264f , -0.181332f , 0.933859f ,
-1.085938f , 0.273438f , -0.390625f , 0.308264f , -0.181332f , 0.933859f ,
--0.953125f , 0.289063f , -0.343750f , -0.328721f , 0.595807f , 0.732774f ,
--1.039062f , 0.328125f , -0.414062f , -0.328721f , 0.595807f , 0.732774f ,
--1.085938f , 0.273438f , -0.390625f , -0.328721f , 0.595807f , 0.732774f ,
-0.953125f , 0.289063f , -0.343750f , 0.399963f , -0.065300f , 0.914202f ,
-0.890625f , 0.234375f , -0.320312f , 0.399963f , -0.065300f , 0.914202f ,
-1.015625f , 0.234375f , -0.375000f , 0.399963f , -0.065300f , 0.914202f ,
--0.953125f , 0.289063f , -0.343750f , -0.399963f , -0.065300f , 0.914202f ,
--1.015625f , 0.234375f , -0.375000f , -0.399963f , -0.065300f , 0.914202f ,
--0.890625f , 0.234375f , -0.320312f , -0.399963f , -0.065300f , 0.914202f ,
-0.960938f , 0.171875f , -0.351562f , 0.361833f , -0.058152f , 0.930428f ,
-0.890625f , 0.234375f , -0.320312f , 0.361833f , -0.058152f , 0.930428f ,
-0.890625f , 0.109375f , -0.328125f , 0.361833f , -0.058152f , 0.930428f ,
--0.960938f , 0.171875f , -0.351562f , -0.361833f , -0.058152f , 0.930428f ,
--0.890625f , 0.109375f , -0.328125f , -0.361833f , -0.058152f , 0.930428f ,
--0.890625f , 0.234375f , -0.320312f , -0.361833f , -0.058152f , 0.930428f ,
-0.890625f , 0.109375f , -0.328125f , 0.071067f , -0.071067f , 0.994937f ,
-0.843750f , 0.171875f , -0.320312f , 0.071067f , -0.071067f , 0.994937f ,
-0.765625f , 0.093750f , -0.320312f , 0.071067f , -0.071067f , 0.994937f ,
--0.890625f , 0.109375f , -0.328125f , -0.041065f , 0.164260f , 0.985562f ,
--0.828125f , 0.078125f , -0.320312f , -0.041065f , 0.164260f , 0.985562f ,
--0.765625f , 0.093750f , -0.320312f , -0.041065f , 0.164260f , 0.985562f ,
-0.882812f , -0.015625f , -0.265625f , -0.298142f , 0.745356f , 0.596285f ,
-0.937500f , 0.062500f , -0.335938f , -0.298142f , 0.745356f , 0.596285f ,
-0.851562f , 0.015625f , -0.320312f , -0.298142f , 0.745356f , 0.596285f ,
--0.882812f , -0.015625f , -0.265625f , 0.487049f , 0.608811f , 0.626205f ,
--0.812500f , -0.015625f , -0.320312f , 0.487049f , 0.608811f , 0.626205f ,
--0.851562f , 0.015625f , -0.320312f , 0.487049f , 0.608811f , 0.626205f ,
-0.882812f , -0.015625f , -0.265625f , 0.669312f , 0.180199f , 0.720798f ,
-1.046875f , 0.000000f , -0.421875f , 0.669312f , 0.180199f , 0.720798f ,
-0.937500f , 0.062500f , -0.335938f , 0.669312f , 0.180199f , 0.720798f ,
--0.882812f , -0.015625f , -0.265625f , -0.669312f , 0.180199f , 0.720798f ,
--0.937500f , 0.062500f , -0.335938f , -0.669312f , 0.180199f , 0.720798f ,
--1.046875f , 0.000000f , -0.421875f , -0.669312f , 0.180199f , 0.720798f ,
-1.046875f , 0.000000f , -0.421875f , 0.443738f , -0.214293f , 0.870158f ,
-1.210938f , 0.085938f , -0.484375f , 0.443738f , -0.214293f , 0.870158f ,
-1.000000f , 0.125000f , -0.367188f , 0.443738f , -0.214293f , 0.870158f ,
--1.046875f , 0.000000f , -0.421875f , -0.443738f , -0.214293f , 0.870158f ,
--1.000000f , 0.125000f , -0.367188f , -0.443738f , -0.214293f , 0.870158f ,
--1.210938f , 0.085938f , -0.484375f , -0.443738f , -0.214293f , 0.870158f ,
-1.210938f , 0.085938f , -0.484375f , 0.493213f , -0.104785f , 0.863575f ,
-1.257812f , 0.242188f , -0.492188f , 0.493213f , -0.104785f , 0.863575f ,
-1.054688f , 0.187500f , -0.382812f , 0.493213f , -0.104785f , 0.863575f ,
--1.210938f , 0.085938f , -0.484375f , -0.493213f , -0.104785f , 0.863575f ,
--1.054688f , 0.187500f , -0.382812f , -0.493213f , -0.104785f , 0.863575f ,
--1.257812f , 0.242188f , -0.492188f , -0.493213f , -0.104785f , 0.863575f ,
-1.085938f , 0.273438f , -0.390625f , 0.525058f , 0.196897f , 0.827977f ,
-1.109375f , 0.210938f , -0.390625f , 0.525058f , 0.196897f , 0.827977f ,
-1.257812f , 0.242188f , -0.492188f , 0.525058f , 0.196897f , 0.827977f ,
--1.085938f , 0.273438f , -0.390625f , -0.525068f , 0.302312f , 0.795557f ,
--1.187500f , 0.343750f , -0.484375f , -0.525068f , 0.302312f , 0.795557f ,
--1.257812f , 0.242188f , -0.492188f , -0.525068f , 0.302312f , 0.795557f ,
-0.773438f , -0.140625f , -0.125000f , 0.110453f , -0.991568f , -0.067778f ,
-0.789062f , -0.125000f , -0.328125f , 0.110453f , -0.991568f , -0.067778f ,
-1.039062f , -0.085937f , -0.492188f , 0.110453f , -0.991568f , -0.067778f ,
--0.773438f , -0.140625f , -0.125000f , -0.073694f , -0.992789f , -0.094551f ,
--1.039062f , -0.101562f , -0.328125f , -0.073694f , -0.992789f , -0.094551f ,
--1.039062f , -0.085937f , -0.492188f , -0.073694f , -0.992789f , -0.094551f ,
-1.039062f , -0.101562f , -0.328125f , 0.446086f , -0.890959f , -0.084853f ,
-1.039062f , -0.085937f , -0.492188f , 0.446086f , -0.890959f , -0.084853f ,
-1.312500f , 0.054688f , -0.531250f , 0.446086f , -0.890959f , -0.084853f ,
--1.039062f , -0.101562f , -0.328125f , -0.585489f , -0.790410f , 0.180150f ,
--1.281250f , 0.054688f , -0.429688f , -0.585489f , -0.790410f , 0.180150f ,
--1.312500f , 0.054688f , -0.531250f , -0.585489f , -0.790410f , 0.180150f ,
-1.367188f , 0.296875f , -0.500000f , 0.934096f , -0.244495f , 0.260168f ,
-1.351562f , 0.320313f , -0.421875f , 0.934096f , -0.244495f , 0.260168f ,
-1.312500f , 0.054688f , -0.531250f , 0.934096f , -0.244495f , 0.260168f ,
--1.367188f , 0.296875f , -0.500000f , -0.934096f , -0.244495f , 0.260168f ,
--1.312500f , 0.054688f , -0.531250f , -0.934096f , -0.244495f , 0.260168f ,
--1.351562f , 0.320313f , -0.421875f , -0.934096f , -0.244495f , 0.260168f ,
-1.250000f , 0.468750f , -0.546875f , 0.832821f , 0.549401f , -0.067585f ,
-1.234375f , 0.507812f , -0.421875f , 0.832821f , 0.549401f , -0.067585f ,
-1.367188f , 0.296875f , -0.500000f , 0.832821f , 0.549401f , -0.067585f ,
--1.250000f , 0.468750f , -0.546875f , -0.832821f , 0.549401f , -0.067585f ,
--1.367188f , 0.296875f , -0.500000f , -0.832821f , 0.549401f , -0.067585f ,
--1.234375f , 0.507812f , -0.421875f , -0.832821f , 0.549401f , -0.067585f ,
-1.023438f , 0.437500f , -0.484375f , -0.191998f , 0.956991f , -0.217498f ,
-1.023438f , 0.476562f , -0.312500f , -0.191998f , 0.956991f , -0.217498f ,
-1.250000f , 0.468750f , -0.546875f , -0.191998f , 0.956991f , -0.217498f ,
--1.023438f , 0.437500f , -0.484375f , 0.191998f , 0.956991f , -0.217498f ,
--1.250000f , 0.468750f , -0.546875f , 0.191998f , 0.956991f , -0.217498f ,
--1.023438f , 0.476562f , -0.312500f , 0.191998f , 0.956991f , -0.217498f ,
-0.859375f , 0.382813f , -0.382812f , -0.355407f , 0.931910f , -0.072321f ,
-0.890625f , 0.406250f , -0.234375f , -0.355407f , 0.931910f , -0.072321f ,
-1.023438f , 0.437500f , -0.484375f , -0.355407f , 0.931910f , -0.072321f ,
--0.859375f , 0.382813f , -0.382812f , 0.355407f , 0.931910f , -0.072321f ,
--1.023438f , 0.437500f , -0.484375f , 0.355407f , 0.931910f , -0.072321f ,
--0.890625f , 0.406250f , -0.234375f , 0.355407f , 0.931910f , -0.072321f ,
-0.859375f , 0.382813f , -0.382812f , -0.521508f , -0.019655f , -0.853020f ,
-1.023438f , 0.437500f , -0.484375f , -0.521508f , -0.019655f , -0.853020f ,
-0.789062f , -0.125000f , -0.328125f , -0.521508f , -0.019655f , -0.853020f ,
--0.859375f , 0.382813f , -0.382812f , 0.521508f , -0.019655f , -0.853020f ,
--0.789062f , -0.125000f , -0.328125f , 0.521508f , -0.019655f , -0.853020f ,
--1.023438f , 0.437500f , -0.484375f , 0.521508f , -0.019655f , -0.853020f ,
-1.250000f , 0.468750f , -0.546875f , -0.113643f , -0.054588f , -0.992021f ,
-1.312500f , 0.054688f , -0.531250f , -0.113643f , -0.054588f , -0.992021f ,
-1.039062f , -0.085937f , -0.492188f , -0.113643f , -0.054588f , -0.992021f ,
--1.250000f , 0.468750f , -0.546875f , 0.266747f , 0.006422f , -0.963745f ,
--1.023438f , 0.437500f , -0.484375f , 0.266747f , 0.006422f , -0.963745f ,
--1.039062f , -0.085937f , -0.492188f , 0.266747f , 0.006422f , -0.963745f ,
-0.859375f , 0.382813f , -0.382812f , -0.821852f , 0.563467f , 0.084053f ,
-0.773438f , 0.265625f , -0.437500f , -0.821852f , 0.563467f , 0.084053f ,
-0.890625f , 0.406250f , -0.234375f , -0.821852f , 0.563467f , 0.084053f ,
--0.859375f , 0.382813f , -0.382812f , 0.821852f , 0.563467f , 0.084053f ,
--0.890625f , 0.406250f , -0.234375f , 0.821852f , 0.563467f , 0.084053f ,
--0.773438f , 0.265625f , -0.437500f , 0.821852f , 0.563467f , 0.084053f ,
-0.640625f , -0.007812f , -0.429688f , 0.419982f , -0.229081f , -0.878144f ,
-0.773438f , 0.265625f , -0.437500f , 0.419982f , -0.229081f , -0.878144f ,
-0.789062f , -0.125000f , -0.328125f , 0.419982f , -0.229081f , -0.878144f ,
--0.640625f , -0.007812f , -0.429688f , -0.419982f , -0.229081f , -0.878144f ,
--0.789062f , -0.125000f , -0.328125f , -0.419982f , -0.229081f , -0.878144f ,
--0.773438f , 0.265625f , -0.437500f , -0.419982f , -0.229081f , -0.878144f ,
-0.640625f , -0.007812f , -0.429688f , -0.570200f , -0.814571f , -0.106521f ,
-0.789062f , -0.125000f , -0.328125f , -0.570200f , -0.814571f , -0.106521f ,
-0.773438f , -0.140625f , -0.125000f , -0.570200f , -0.814571f , -0.106521f ,
--0.640625f , -0.007812f , -0.429688f , -0.007891f , -0.915403f , -0.402462f ,
--0.593750f , -0.125000f , -0.164062f , -0.007891f , -0.915403f , -0.402462f ,
--0.773438f , -0.140625f , -0.125000f , -0.007891f , -0.915403f , -0.402462f ,
-};
@@ -1,2920 +0,0 @@
-/**
- * @file suzi_smooth.h
- *
- * @brief Suzi model (Smooth)
- *
- * @details  Command for rendering
- *           glDrawArrays(GL_TRIANGLES, 0, 2904);
- *
- * @author Martin Nemec
- *
- * @year 2023
- **/
-
-
-const float suziSmooth[17424] = {
-0.468750f , 0.242187f , 0.757812f , 0.970580f , -0.015168f , 0.240181f ,
-0.437500f , 0.164062f , 0.765625f , 0.711631f , -0.679250f , 0.179327f ,
-0.562500f , 0.242187f , 0.671875f , 0.801782f , -0.000977f , 0.597583f ,
--0.500000f , 0.093750f , 0.687500f , -0.605304f , -0.505783f , 0.614612f ,
--0.437500f , 0.164062f , 0.765625f , -0.711631f , -0.679250f , 0.179327f ,
--0.562500f , 0.242187f , 0.671875f , -0.801782f , -0.000977f , 0.597583f ,
-0.562500f , 0.242187f , 0.671875f , 0.801782f , -0.000977f , 0.597583f ,
-0.500000f , 0.093750f , 0.687500f , 0.605304f , -0.505783f , 0.614612f ,
-0.625000f , 0.242187f , 0.562500f , 0.868374f , -0.002258f , 0.495834f ,
--0.546875f , 0.054687f , 0.578125f , -0.683645f , -0.547288f , 0.482742f ,
--0.500000f , 0.093750f , 0.687500f , -0.605304f , -0.505783f , 0.614612f ,
--0.625000f , 0.242187f , 0.562500f , -0.868374f , -0.002258f , 0.495834f ,
-0.500000f , 0.093750f , 0.687500f , 0.605304f , -0.505783f , 0.614612f ,
-0.351562f , 0.031250f , 0.718750f , 0.096896f , -0.751030f , 0.653096f ,
-0.546875f , 0.054687f , 0.578125f , 0.683645f , -0.547288f , 0.482742f ,
--0.351562f , -0.023438f , 0.617188f , -0.109470f , -0.872951f , 0.475295f ,
--0.351562f , 0.031250f , 0.718750f , -0.096896f , -0.751030f , 0.653096f ,
--0.546875f , 0.054687f , 0.578125f , -0.683645f , -0.547288f , 0.482742f ,
-0.437500f , 0.164062f , 0.765625f , 0.711631f , -0.679250f , 0.179327f ,
-0.351562f , 0.132812f , 0.781250f , 0.048738f , -0.965545f , 0.255562f ,
-0.500000f , 0.093750f , 0.687500f , 0.605304f , -0.505783f , 0.614612f ,
--0.351562f , 0.031250f , 0.718750f , -0.096896f , -0.751030f , 0.653096f ,
--0.351562f , 0.132812f , 0.781250f , -0.048738f , -0.965545f , 0.255562f ,
--0.500000f , 0.093750f , 0.687500f , -0.605304f , -0.505783f , 0.614612f ,
-0.351562f , 0.132812f , 0.781250f , 0.048738f , -0.965545f , 0.255562f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.351562f , 0.031250f , 0.718750f , 0.096896f , -0.751030f , 0.653096f ,
--0.203125f , 0.093750f , 0.742188f , 0.454909f , -0.541520f , 0.706931f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
--0.351562f , 0.031250f , 0.718750f , -0.096896f , -0.751030f , 0.653096f ,
-0.351562f , 0.031250f , 0.718750f , 0.096896f , -0.751030f , 0.653096f ,
-0.203125f , 0.093750f , 0.742188f , -0.454909f , -0.541520f , 0.706931f ,
-0.351562f , -0.023438f , 0.617188f , 0.109470f , -0.872951f , 0.475295f ,
--0.156250f , 0.054687f , 0.648438f , 0.547227f , -0.639424f , 0.540025f ,
--0.203125f , 0.093750f , 0.742188f , 0.454909f , -0.541520f , 0.706931f ,
--0.351562f , -0.023438f , 0.617188f , -0.109470f , -0.872951f , 0.475295f ,
-0.203125f , 0.093750f , 0.742188f , -0.454909f , -0.541520f , 0.706931f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
-0.078125f , 0.242187f , 0.656250f , -0.811914f , -0.000916f , 0.583728f ,
--0.078125f , 0.242187f , 0.656250f , 0.811914f , -0.000916f , 0.583728f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
--0.203125f , 0.093750f , 0.742188f , 0.454909f , -0.541520f , 0.706931f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.242188f , 0.242187f , 0.796875f , -0.955748f , -0.018250f , 0.293588f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
--0.242188f , 0.242187f , 0.796875f , 0.955748f , -0.018250f , 0.293588f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
-0.242188f , 0.242187f , 0.796875f , -0.955748f , -0.018250f , 0.293588f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
--0.203125f , 0.390625f , 0.742188f , 0.460402f , 0.527726f , 0.713767f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
-0.203125f , 0.390625f , 0.742188f , -0.460402f , 0.527726f , 0.713767f ,
-0.156250f , 0.437500f , 0.648438f , -0.525071f , 0.625446f , 0.577136f ,
--0.156250f , 0.437500f , 0.648438f , 0.525071f , 0.625446f , 0.577136f ,
--0.203125f , 0.390625f , 0.742188f , 0.460402f , 0.527726f , 0.713767f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
-0.203125f , 0.390625f , 0.742188f , -0.460402f , 0.527726f , 0.713767f ,
-0.351562f , 0.453125f , 0.718750f , 0.100864f , 0.739555f , 0.665456f ,
-0.351562f , 0.515625f , 0.617188f , 0.116337f , 0.843501f , 0.524338f ,
--0.351562f , 0.515625f , 0.617188f , -0.116337f , 0.843501f , 0.524338f ,
--0.351562f , 0.453125f , 0.718750f , -0.100864f , 0.739555f , 0.665456f ,
--0.203125f , 0.390625f , 0.742188f , 0.460402f , 0.527726f , 0.713767f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.351562f , 0.359375f , 0.781250f , 0.043336f , 0.971313f , 0.233741f ,
-0.351562f , 0.453125f , 0.718750f , 0.100864f , 0.739555f , 0.665456f ,
--0.351562f , 0.453125f , 0.718750f , -0.100864f , 0.739555f , 0.665456f ,
--0.351562f , 0.359375f , 0.781250f , -0.043336f , 0.971313f , 0.233741f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
-0.351562f , 0.359375f , 0.781250f , 0.043336f , 0.971313f , 0.233741f ,
-0.437500f , 0.328125f , 0.765625f , 0.716178f , 0.677053f , 0.169225f ,
-0.500000f , 0.390625f , 0.687500f , 0.609790f , 0.492203f , 0.621143f ,
--0.500000f , 0.390625f , 0.687500f , -0.609790f , 0.492203f , 0.621143f ,
--0.437500f , 0.328125f , 0.765625f , -0.716178f , 0.677053f , 0.169225f ,
--0.351562f , 0.359375f , 0.781250f , -0.043336f , 0.971313f , 0.233741f ,
-0.351562f , 0.453125f , 0.718750f , 0.100864f , 0.739555f , 0.665456f ,
-0.500000f , 0.390625f , 0.687500f , 0.609790f , 0.492203f , 0.621143f ,
-0.546875f , 0.437500f , 0.578125f , 0.672658f , 0.534715f , 0.511429f ,
--0.546875f , 0.437500f , 0.578125f , -0.672658f , 0.534715f , 0.511429f ,
--0.500000f , 0.390625f , 0.687500f , -0.609790f , 0.492203f , 0.621143f ,
--0.351562f , 0.453125f , 0.718750f , -0.100864f , 0.739555f , 0.665456f ,
-0.500000f , 0.390625f , 0.687500f , 0.609790f , 0.492203f , 0.621143f ,
-0.562500f , 0.242187f , 0.671875f , 0.801782f , -0.000977f , 0.597583f ,
-0.625000f , 0.242187f , 0.562500f , 0.868374f , -0.002258f , 0.495834f ,
--0.625000f , 0.242187f , 0.562500f , -0.868374f , -0.002258f , 0.495834f ,
--0.562500f , 0.242187f , 0.671875f , -0.801782f , -0.000977f , 0.597583f ,
--0.500000f , 0.390625f , 0.687500f , -0.609790f , 0.492203f , 0.621143f ,
-0.437500f , 0.328125f , 0.765625f , 0.716178f , 0.677053f , 0.169225f ,
-0.468750f , 0.242187f , 0.757812f , 0.970580f , -0.015168f , 0.240181f ,
-0.562500f , 0.242187f , 0.671875f , 0.801782f , -0.000977f , 0.597583f ,
--0.562500f , 0.242187f , 0.671875f , -0.801782f , -0.000977f , 0.597583f ,
--0.468750f , 0.242187f , 0.757812f , -0.970580f , -0.015168f , 0.240181f ,
--0.437500f , 0.328125f , 0.765625f , -0.716178f , 0.677053f , 0.169225f ,
-0.468750f , 0.242187f , 0.757812f , 0.970580f , -0.015168f , 0.240181f ,
-0.437500f , 0.328125f , 0.765625f , 0.716178f , 0.677053f , 0.169225f ,
-0.445312f , 0.335937f , 0.781250f , 0.717948f , 0.658193f , 0.226417f ,
--0.445312f , 0.335937f , 0.781250f , -0.717948f , 0.658193f , 0.226417f ,
--0.437500f , 0.328125f , 0.765625f , -0.716178f , 0.677053f , 0.169225f ,
--0.468750f , 0.242187f , 0.757812f , -0.970580f , -0.015168f , 0.240181f ,
-0.437500f , 0.328125f , 0.765625f , 0.716178f , 0.677053f , 0.169225f ,
-0.351562f , 0.359375f , 0.781250f , 0.043336f , 0.971313f , 0.233741f ,
-0.351562f , 0.375000f , 0.804688f , 0.030793f , 0.939726f , 0.340495f ,
--0.351562f , 0.375000f , 0.804688f , -0.030793f , 0.939726f , 0.340495f ,
--0.351562f , 0.359375f , 0.781250f , -0.043336f , 0.971313f , 0.233741f ,
--0.437500f , 0.328125f , 0.765625f , -0.716178f , 0.677053f , 0.169225f ,
-0.351562f , 0.359375f , 0.781250f , 0.043336f , 0.971313f , 0.233741f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.265625f , 0.335937f , 0.820312f , -0.607074f , 0.644795f , 0.464400f ,
--0.265625f , 0.335937f , 0.820312f , 0.607074f , 0.644795f , 0.464400f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
--0.351562f , 0.359375f , 0.781250f , -0.043336f , 0.971313f , 0.233741f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.242188f , 0.242187f , 0.796875f , -0.955748f , -0.018250f , 0.293588f ,
-0.226562f , 0.242187f , 0.820312f , -0.923856f , -0.013306f , 0.382427f ,
--0.226562f , 0.242187f , 0.820312f , 0.923856f , -0.013306f , 0.382427f ,
--0.242188f , 0.242187f , 0.796875f , 0.955748f , -0.018250f , 0.293588f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
-0.242188f , 0.242187f , 0.796875f , -0.955748f , -0.018250f , 0.293588f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.226562f , 0.242187f , 0.820312f , -0.923856f , -0.013306f , 0.382427f ,
--0.265625f , 0.156250f , 0.820312f , 0.599200f , -0.652425f , 0.463973f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
--0.226562f , 0.242187f , 0.820312f , 0.923856f , -0.013306f , 0.382427f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.351562f , 0.132812f , 0.781250f , 0.048738f , -0.965545f , 0.255562f ,
-0.265625f , 0.156250f , 0.820312f , -0.599200f , -0.652425f , 0.463973f ,
--0.351562f , 0.117187f , 0.804688f , -0.030305f , -0.941191f , 0.336497f ,
--0.351562f , 0.132812f , 0.781250f , -0.048738f , -0.965545f , 0.255562f ,
--0.265625f , 0.156250f , 0.820312f , 0.599200f , -0.652425f , 0.463973f ,
-0.351562f , 0.132812f , 0.781250f , 0.048738f , -0.965545f , 0.255562f ,
-0.437500f , 0.164062f , 0.765625f , 0.711631f , -0.679250f , 0.179327f ,
-0.351562f , 0.117187f , 0.804688f , 0.030305f , -0.941191f , 0.336497f ,
--0.445312f , 0.156250f , 0.781250f , -0.710624f , -0.665792f , 0.227363f ,
--0.437500f , 0.164062f , 0.765625f , -0.711631f , -0.679250f , 0.179327f ,
--0.351562f , 0.117187f , 0.804688f , -0.030305f , -0.941191f , 0.336497f ,
-0.437500f , 0.164062f , 0.765625f , 0.711631f , -0.679250f , 0.179327f ,
-0.468750f , 0.242187f , 0.757812f , 0.970580f , -0.015168f , 0.240181f ,
-0.445312f , 0.156250f , 0.781250f , 0.710624f , -0.665792f , 0.227363f ,
--0.476562f , 0.242187f , 0.773438f , -0.962584f , -0.011292f , 0.270669f ,
--0.468750f , 0.242187f , 0.757812f , -0.970580f , -0.015168f , 0.240181f ,
--0.445312f , 0.156250f , 0.781250f , -0.710624f , -0.665792f , 0.227363f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.445312f , 0.156250f , 0.781250f , 0.710624f , -0.665792f , 0.227363f ,
-0.476562f , 0.242187f , 0.773438f , 0.962584f , -0.011292f , 0.270669f ,
--0.476562f , 0.242187f , 0.773438f , -0.962584f , -0.011292f , 0.270669f ,
--0.445312f , 0.156250f , 0.781250f , -0.710624f , -0.665792f , 0.227363f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.117187f , 0.804688f , 0.030305f , -0.941191f , 0.336497f ,
-0.445312f , 0.156250f , 0.781250f , 0.710624f , -0.665792f , 0.227363f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
--0.445312f , 0.156250f , 0.781250f , -0.710624f , -0.665792f , 0.227363f ,
--0.351562f , 0.117187f , 0.804688f , -0.030305f , -0.941191f , 0.336497f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.265625f , 0.156250f , 0.820312f , -0.599200f , -0.652425f , 0.463973f ,
-0.351562f , 0.117187f , 0.804688f , 0.030305f , -0.941191f , 0.336497f ,
--0.351562f , 0.117187f , 0.804688f , -0.030305f , -0.941191f , 0.336497f ,
--0.265625f , 0.156250f , 0.820312f , 0.599200f , -0.652425f , 0.463973f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.226562f , 0.242187f , 0.820312f , -0.923856f , -0.013306f , 0.382427f ,
-0.265625f , 0.156250f , 0.820312f , -0.599200f , -0.652425f , 0.463973f ,
--0.265625f , 0.156250f , 0.820312f , 0.599200f , -0.652425f , 0.463973f ,
--0.226562f , 0.242187f , 0.820312f , 0.923856f , -0.013306f , 0.382427f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.265625f , 0.335937f , 0.820312f , -0.607074f , 0.644795f , 0.464400f ,
-0.226562f , 0.242187f , 0.820312f , -0.923856f , -0.013306f , 0.382427f ,
--0.226562f , 0.242187f , 0.820312f , 0.923856f , -0.013306f , 0.382427f ,
--0.265625f , 0.335937f , 0.820312f , 0.607074f , 0.644795f , 0.464400f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.375000f , 0.804688f , 0.030793f , 0.939726f , 0.340495f ,
-0.265625f , 0.335937f , 0.820312f , -0.607074f , 0.644795f , 0.464400f ,
--0.265625f , 0.335937f , 0.820312f , 0.607074f , 0.644795f , 0.464400f ,
--0.351562f , 0.375000f , 0.804688f , -0.030793f , 0.939726f , 0.340495f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.445312f , 0.335937f , 0.781250f , 0.717948f , 0.658193f , 0.226417f ,
-0.351562f , 0.375000f , 0.804688f , 0.030793f , 0.939726f , 0.340495f ,
--0.351562f , 0.375000f , 0.804688f , -0.030793f , 0.939726f , 0.340495f ,
--0.445312f , 0.335937f , 0.781250f , -0.717948f , 0.658193f , 0.226417f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.351562f , 0.242187f , 0.828125f , 0.183599f , -0.005310f , 0.982971f ,
-0.476562f , 0.242187f , 0.773438f , 0.962584f , -0.011292f , 0.270669f ,
-0.445312f , 0.335937f , 0.781250f , 0.717948f , 0.658193f , 0.226417f ,
--0.445312f , 0.335937f , 0.781250f , -0.717948f , 0.658193f , 0.226417f ,
--0.476562f , 0.242187f , 0.773438f , -0.962584f , -0.011292f , 0.270669f ,
--0.351562f , 0.242187f , 0.828125f , -0.183599f , -0.005310f , 0.982971f ,
-0.179688f , -0.968750f , 0.554687f , 0.147160f , -0.978057f , 0.147404f ,
-0.164062f , -0.929688f , 0.632812f , 0.146062f , -0.788720f , 0.597125f ,
-0.000000f , -0.945312f , 0.640625f , 0.000000f , -0.766656f , 0.642018f ,
-0.000000f , -0.945312f , 0.640625f , 0.000000f , -0.766656f , 0.642018f ,
--0.164062f , -0.929688f , 0.632812f , -0.146062f , -0.788720f , 0.597125f ,
--0.179688f , -0.968750f , 0.554687f , -0.147160f , -0.978057f , 0.147404f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
-0.234375f , -0.914062f , 0.632812f , 0.357830f , -0.633290f , 0.686209f ,
-0.164062f , -0.929688f , 0.632812f , 0.146062f , -0.788720f , 0.597125f ,
--0.164062f , -0.929688f , 0.632812f , -0.146062f , -0.788720f , 0.597125f ,
--0.234375f , -0.914062f , 0.632812f , -0.357830f , -0.633290f , 0.686209f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
-0.367188f , -0.890625f , 0.531250f , 0.938444f , -0.345103f , 0.014252f ,
-0.265625f , -0.820312f , 0.664062f , 0.531480f , -0.237861f , 0.812952f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
--0.234375f , -0.914062f , 0.632812f , -0.357830f , -0.633290f , 0.686209f ,
--0.265625f , -0.820312f , 0.664062f , -0.531480f , -0.237861f , 0.812952f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
-0.351562f , -0.695312f , 0.570312f , 0.978179f , 0.080081f , 0.191687f ,
-0.250000f , -0.703125f , 0.687500f , 0.556566f , -0.045656f , 0.829524f ,
-0.367188f , -0.890625f , 0.531250f , 0.938444f , -0.345103f , 0.014252f ,
--0.265625f , -0.820312f , 0.664062f , -0.531480f , -0.237861f , 0.812952f ,
--0.250000f , -0.703125f , 0.687500f , -0.556566f , -0.045656f , 0.829524f ,
--0.367188f , -0.890625f , 0.531250f , -0.938444f , -0.345103f , 0.014252f ,
-0.312500f , -0.437500f , 0.570312f , 0.963622f , 0.232734f , 0.131199f ,
-0.210938f , -0.445313f , 0.710938f , 0.570360f , 0.075137f , 0.817927f ,
-0.351562f , -0.695312f , 0.570312f , 0.978179f , 0.080081f , 0.191687f ,
--0.250000f , -0.703125f , 0.687500f , -0.556566f , -0.045656f , 0.829524f ,
--0.210938f , -0.445313f , 0.710938f , -0.570360f , 0.075137f , 0.817927f ,
--0.351562f , -0.695312f , 0.570312f , -0.978179f , 0.080081f , 0.191687f ,
-0.203125f , -0.187500f , 0.562500f , 0.936064f , -0.336802f , 0.101566f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
--0.398438f , -0.046875f , 0.671875f , -0.438826f , -0.518998f , 0.733482f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.632812f , -0.039063f , 0.539062f , 0.581133f , -0.781213f , 0.227912f ,
-0.617188f , 0.054687f , 0.625000f , 0.481735f , -0.373577f , 0.792688f ,
--0.617188f , 0.054687f , 0.625000f , -0.481735f , -0.373577f , 0.792688f ,
--0.632812f , -0.039063f , 0.539062f , -0.581133f , -0.781213f , 0.227912f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
-0.632812f , -0.039063f , 0.539062f , 0.581133f , -0.781213f , 0.227912f ,
-0.828125f , 0.148437f , 0.445312f , 0.911802f , -0.386059f , -0.139866f ,
-0.617188f , 0.054687f , 0.625000f , 0.481735f , -0.373577f , 0.792688f ,
--0.726562f , 0.203125f , 0.601562f , -0.625019f , -0.315714f , 0.713858f ,
--0.828125f , 0.148437f , 0.445312f , -0.911802f , -0.386059f , -0.139866f ,
--0.617188f , 0.054687f , 0.625000f , -0.481735f , -0.373577f , 0.792688f ,
-0.828125f , 0.148437f , 0.445312f , 0.911802f , -0.386059f , -0.139866f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.742188f , 0.375000f , 0.656250f , 0.525010f , -0.437666f , 0.729911f ,
--0.742188f , 0.375000f , 0.656250f , -0.525010f , -0.437666f , 0.729911f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
--0.828125f , 0.148437f , 0.445312f , -0.911802f , -0.386059f , -0.139866f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.710938f , 0.484375f , 0.625000f , 0.434889f , 0.886593f , 0.157414f ,
-0.687500f , 0.414062f , 0.726562f , 0.345073f , -0.068087f , 0.936094f ,
--0.687500f , 0.414062f , 0.726562f , -0.345073f , -0.068087f , 0.936094f ,
--0.710938f , 0.484375f , 0.625000f , -0.434889f , 0.886593f , 0.157414f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
-0.710938f , 0.484375f , 0.625000f , 0.434889f , 0.886593f , 0.157414f ,
-0.492188f , 0.601562f , 0.687500f , 0.602344f , 0.781274f , 0.163610f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
--0.492188f , 0.601562f , 0.687500f , -0.602344f , 0.781274f , 0.163610f ,
--0.710938f , 0.484375f , 0.625000f , -0.434889f , 0.886593f , 0.157414f ,
-0.492188f , 0.601562f , 0.687500f , 0.602344f , 0.781274f , 0.163610f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
--0.312500f , 0.640625f , 0.835938f , -0.261391f , 0.206458f , 0.942869f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.062500f , 0.492187f , 0.750000f , -0.810816f , 0.562304f , 0.162267f ,
-0.101562f , 0.429687f , 0.843750f , -0.023072f , -0.175695f , 0.984161f ,
--0.101562f , 0.429687f , 0.843750f , 0.023072f , -0.175695f , 0.984161f ,
--0.062500f , 0.492187f , 0.750000f , 0.810816f , 0.562304f , 0.162267f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
-0.062500f , 0.492187f , 0.750000f , -0.810816f , 0.562304f , 0.162267f ,
-0.000000f , 0.429687f , 0.742188f , 0.000000f , 0.934080f , 0.357006f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
-0.000000f , 0.429687f , 0.742188f , 0.000000f , 0.934080f , 0.357006f ,
--0.062500f , 0.492187f , 0.750000f , 0.810816f , 0.562304f , 0.162267f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.250000f , 0.468750f , 0.757812f , 0.222877f , -0.111332f , 0.968444f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
--0.250000f , 0.468750f , 0.757812f , -0.222877f , -0.111332f , 0.968444f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
-0.250000f , 0.468750f , 0.757812f , 0.222877f , -0.111332f , 0.968444f ,
-0.328125f , 0.476562f , 0.742188f , 0.138340f , -0.104190f , 0.984863f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
--0.312500f , 0.640625f , 0.835938f , -0.261391f , 0.206458f , 0.942869f ,
--0.328125f , 0.476562f , 0.742188f , -0.138340f , -0.104190f , 0.984863f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
-0.429688f , 0.437500f , 0.718750f , 0.291940f , 0.106296f , 0.950499f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
-0.312500f , 0.640625f , 0.835938f , 0.261391f , 0.206458f , 0.942869f ,
--0.312500f , 0.640625f , 0.835938f , -0.261391f , 0.206458f , 0.942869f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
--0.429688f , 0.437500f , 0.718750f , -0.291940f , 0.106296f , 0.950499f ,
-0.601562f , 0.375000f , 0.664062f , 0.081545f , -0.288308f , 0.954039f ,
-0.687500f , 0.414062f , 0.726562f , 0.345073f , -0.068087f , 0.936094f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
--0.687500f , 0.414062f , 0.726562f , -0.345073f , -0.068087f , 0.936094f ,
--0.601562f , 0.375000f , 0.664062f , -0.081545f , -0.288308f , 0.954039f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.742188f , 0.375000f , 0.656250f , 0.525010f , -0.437666f , 0.729911f ,
-0.687500f , 0.414062f , 0.726562f , 0.345073f , -0.068087f , 0.936094f ,
--0.687500f , 0.414062f , 0.726562f , -0.345073f , -0.068087f , 0.936094f ,
--0.742188f , 0.375000f , 0.656250f , -0.525010f , -0.437666f , 0.729911f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
-0.625000f , 0.187500f , 0.648438f , 0.455184f , -0.237373f , 0.858150f ,
-0.726562f , 0.203125f , 0.601562f , 0.625019f , -0.315714f , 0.713858f ,
-0.742188f , 0.375000f , 0.656250f , 0.525010f , -0.437666f , 0.729911f ,
--0.742188f , 0.375000f , 0.656250f , -0.525010f , -0.437666f , 0.729911f ,
--0.726562f , 0.203125f , 0.601562f , -0.625019f , -0.315714f , 0.713858f ,
--0.625000f , 0.187500f , 0.648438f , -0.455184f , -0.237373f , 0.858150f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
-0.617188f , 0.054687f , 0.625000f , 0.481735f , -0.373577f , 0.792688f ,
-0.726562f , 0.203125f , 0.601562f , 0.625019f , -0.315714f , 0.713858f ,
--0.726562f , 0.203125f , 0.601562f , -0.625019f , -0.315714f , 0.713858f ,
--0.617188f , 0.054687f , 0.625000f , -0.481735f , -0.373577f , 0.792688f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
-0.375000f , 0.015625f , 0.703125f , 0.345805f , -0.372234f , 0.861263f ,
-0.398438f , -0.046875f , 0.671875f , 0.438826f , -0.518998f , 0.733482f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
--0.617188f , 0.054687f , 0.625000f , -0.481735f , -0.373577f , 0.792688f ,
--0.398438f , -0.046875f , 0.671875f , -0.438826f , -0.518998f , 0.733482f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
-0.203125f , 0.093750f , 0.742188f , -0.000916f , -0.275307f , 0.961333f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
-0.375000f , 0.015625f , 0.703125f , 0.345805f , -0.372234f , 0.861263f ,
--0.398438f , -0.046875f , 0.671875f , -0.438826f , -0.518998f , 0.733482f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
--0.375000f , 0.015625f , 0.703125f , -0.345805f , -0.372234f , 0.861263f ,
-0.203125f , 0.093750f , 0.742188f , -0.000916f , -0.275307f , 0.961333f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.101562f , 0.429687f , 0.843750f , -0.023072f , -0.175695f , 0.984161f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.101562f , 0.429687f , 0.843750f , 0.023072f , -0.175695f , 0.984161f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
-0.125000f , 0.304687f , 0.765625f , 0.088595f , -0.080569f , 0.992798f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
-0.000000f , 0.210937f , 0.765625f , 0.000000f , -0.298441f , 0.954405f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.062500f , -0.882813f , 0.695312f , -0.070894f , -0.387036f , 0.919309f ,
-0.000000f , -0.890625f , 0.687500f , 0.000000f , -0.411603f , 0.911344f ,
-0.164062f , -0.929688f , 0.632812f , 0.146062f , -0.788720f , 0.597125f ,
-0.000000f , -0.945312f , 0.640625f , 0.000000f , -0.766656f , 0.642018f ,
-0.000000f , -0.890625f , 0.687500f , 0.000000f , -0.411603f , 0.911344f ,
--0.164062f , -0.929688f , 0.632812f , -0.146062f , -0.788720f , 0.597125f ,
-0.117188f , -0.835938f , 0.710937f , 0.172948f , -0.282754f , 0.943449f ,
-0.062500f , -0.882813f , 0.695312f , -0.070894f , -0.387036f , 0.919309f ,
-0.234375f , -0.914062f , 0.632812f , 0.357830f , -0.633290f , 0.686209f ,
--0.164062f , -0.929688f , 0.632812f , -0.146062f , -0.788720f , 0.597125f ,
--0.062500f , -0.882813f , 0.695312f , 0.070894f , -0.387036f , 0.919309f ,
--0.234375f , -0.914062f , 0.632812f , -0.357830f , -0.633290f , 0.686209f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.117188f , -0.835938f , 0.710937f , 0.172948f , -0.282754f , 0.943449f ,
-0.234375f , -0.914062f , 0.632812f , 0.357830f , -0.633290f , 0.686209f ,
--0.234375f , -0.914062f , 0.632812f , -0.357830f , -0.633290f , 0.686209f ,
--0.117188f , -0.835938f , 0.710937f , -0.172948f , -0.282754f , 0.943449f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
-0.210938f , -0.445313f , 0.710938f , 0.570360f , 0.075137f , 0.817927f ,
-0.078125f , -0.445313f , 0.750000f , 0.136204f , -0.004028f , 0.990661f ,
-0.250000f , -0.703125f , 0.687500f , 0.556566f , -0.045656f , 0.829524f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
--0.078125f , -0.445313f , 0.750000f , -0.136204f , -0.004028f , 0.990661f ,
--0.250000f , -0.703125f , 0.687500f , -0.556566f , -0.045656f , 0.829524f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.265625f , -0.820312f , 0.664062f , 0.531480f , -0.237861f , 0.812952f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
--0.250000f , -0.703125f , 0.687500f , -0.556566f , -0.045656f , 0.829524f ,
--0.265625f , -0.820312f , 0.664062f , -0.531480f , -0.237861f , 0.812952f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
-0.000000f , -0.328125f , 0.742188f , 0.000000f , -0.458022f , 0.888913f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
-0.000000f , -0.328125f , 0.742188f , 0.000000f , -0.458022f , 0.888913f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
-0.078125f , -0.445313f , 0.750000f , 0.136204f , -0.004028f , 0.990661f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
--0.078125f , -0.445313f , 0.750000f , -0.136204f , -0.004028f , 0.990661f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.610096f , 0.792322f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.610096f , 0.792322f ,
-0.125000f , -0.226563f , 0.750000f , 0.819605f , -0.279183f , 0.500259f ,
-0.132812f , -0.226563f , 0.796875f , 0.949583f , -0.177892f , 0.258095f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
--0.093750f , -0.273438f , 0.781250f , -0.514969f , -0.744621f , 0.424604f ,
--0.132812f , -0.226563f , 0.796875f , -0.949583f , -0.177892f , 0.258095f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.101562f , -0.148438f , 0.742188f , -0.427076f , 0.574236f , 0.698416f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
-0.132812f , -0.226563f , 0.796875f , 0.949583f , -0.177892f , 0.258095f ,
--0.132812f , -0.226563f , 0.796875f , -0.949583f , -0.177892f , 0.258095f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
--0.101562f , -0.148438f , 0.742188f , 0.427076f , 0.574236f , 0.698416f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.039062f , -0.125000f , 0.781250f , -0.292520f , 0.943937f , 0.152806f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
--0.039062f , -0.125000f , 0.781250f , 0.292520f , 0.943937f , 0.152806f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.000000f , -0.195313f , 0.750000f , 0.000000f , 0.838038f , 0.545579f ,
-0.000000f , -0.187500f , 0.796875f , 0.000000f , 0.972320f , 0.233528f ,
-0.039062f , -0.125000f , 0.781250f , -0.292520f , 0.943937f , 0.152806f ,
--0.039062f , -0.125000f , 0.781250f , 0.292520f , 0.943937f , 0.152806f ,
-0.000000f , -0.187500f , 0.796875f , 0.000000f , 0.972320f , 0.233528f ,
-0.000000f , -0.195313f , 0.750000f , 0.000000f , 0.838038f , 0.545579f ,
-0.000000f , -0.328125f , 0.742188f , 0.000000f , -0.458022f , 0.888913f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
-0.093750f , -0.273438f , 0.781250f , 0.514969f , -0.744621f , 0.424604f ,
--0.093750f , -0.273438f , 0.781250f , -0.514969f , -0.744621f , 0.424604f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.000000f , -0.328125f , 0.742188f , 0.000000f , -0.458022f , 0.888913f ,
-0.000000f , -0.320313f , 0.781250f , 0.000000f , -0.870785f , 0.491592f ,
-0.093750f , -0.273438f , 0.781250f , 0.514969f , -0.744621f , 0.424604f ,
-0.078125f , -0.250000f , 0.804688f , 0.269021f , -0.771874f , 0.576006f ,
--0.078125f , -0.250000f , 0.804688f , -0.269021f , -0.771874f , 0.576006f ,
--0.093750f , -0.273438f , 0.781250f , -0.514969f , -0.744621f , 0.424604f ,
-0.000000f , -0.320313f , 0.781250f , 0.000000f , -0.870785f , 0.491592f ,
-0.000000f , -0.187500f , 0.796875f , 0.000000f , 0.972320f , 0.233528f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.039062f , -0.125000f , 0.781250f , -0.292520f , 0.943937f , 0.152806f ,
--0.046875f , -0.148438f , 0.812500f , 0.145390f , 0.590960f , 0.793451f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
--0.039062f , -0.125000f , 0.781250f , 0.292520f , 0.943937f , 0.152806f ,
-0.039062f , -0.125000f , 0.781250f , -0.292520f , 0.943937f , 0.152806f ,
-0.046875f , -0.148438f , 0.812500f , -0.145390f , 0.590960f , 0.793451f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
--0.093750f , -0.156250f , 0.812500f , -0.364666f , 0.463973f , 0.807276f ,
--0.046875f , -0.148438f , 0.812500f , 0.145390f , 0.590960f , 0.793451f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
-0.093750f , -0.156250f , 0.812500f , 0.364666f , 0.463973f , 0.807276f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
--0.093750f , -0.156250f , 0.812500f , -0.364666f , 0.463973f , 0.807276f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
-0.132812f , -0.226563f , 0.796875f , 0.949583f , -0.177892f , 0.258095f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
-0.093750f , -0.273438f , 0.781250f , 0.514969f , -0.744621f , 0.424604f ,
--0.078125f , -0.250000f , 0.804688f , -0.269021f , -0.771874f , 0.576006f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
--0.093750f , -0.273438f , 0.781250f , -0.514969f , -0.744621f , 0.424604f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
-0.093750f , -0.156250f , 0.812500f , 0.364666f , 0.463973f , 0.807276f ,
--0.093750f , -0.156250f , 0.812500f , -0.364666f , 0.463973f , 0.807276f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.000000f , -0.289063f , 0.804688f , 0.000000f , -0.522172f , 0.852809f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
--0.078125f , -0.250000f , 0.804688f , -0.269021f , -0.771874f , 0.576006f ,
-0.000000f , -0.289063f , 0.804688f , 0.000000f , -0.522172f , 0.852809f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.101562f , -0.148438f , 0.742188f , -0.427076f , 0.574236f , 0.698416f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
--0.101562f , -0.148438f , 0.742188f , 0.427076f , 0.574236f , 0.698416f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.101562f , -0.148438f , 0.742188f , -0.427076f , 0.574236f , 0.698416f ,
-0.125000f , -0.226563f , 0.750000f , 0.819605f , -0.279183f , 0.500259f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
--0.164062f , -0.242188f , 0.710938f , -0.836604f , 0.046083f , 0.545824f ,
--0.125000f , -0.226563f , 0.750000f , -0.819605f , -0.279183f , 0.500259f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
-0.125000f , -0.226563f , 0.750000f , 0.819605f , -0.279183f , 0.500259f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
-0.179688f , -0.312500f , 0.710938f , 0.655446f , 0.133946f , 0.743248f ,
--0.179688f , -0.312500f , 0.710938f , -0.655446f , 0.133946f , 0.743248f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
--0.125000f , -0.226563f , 0.750000f , -0.819605f , -0.279183f , 0.500259f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
-0.078125f , -0.445313f , 0.750000f , 0.136204f , -0.004028f , 0.990661f ,
-0.210938f , -0.445313f , 0.710938f , 0.570360f , 0.075137f , 0.817927f ,
--0.210938f , -0.445313f , 0.710938f , -0.570360f , 0.075137f , 0.817927f ,
--0.078125f , -0.445313f , 0.750000f , -0.136204f , -0.004028f , 0.990661f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.312500f , -0.437500f , 0.570312f , 0.963622f , 0.232734f , 0.131199f ,
-0.257812f , -0.312500f , 0.554688f , 0.922819f , 0.371471f , 0.101871f ,
-0.179688f , -0.312500f , 0.710938f , 0.655446f , 0.133946f , 0.743248f ,
--0.179688f , -0.312500f , 0.710938f , -0.655446f , 0.133946f , 0.743248f ,
--0.257812f , -0.312500f , 0.554688f , -0.922819f , 0.371471f , 0.101871f ,
--0.312500f , -0.437500f , 0.570312f , -0.963622f , 0.232734f , 0.131199f ,
-0.257812f , -0.312500f , 0.554688f , 0.922819f , 0.371471f , 0.101871f ,
-0.234375f , -0.250000f , 0.554688f , 0.928922f , 0.361003f , 0.082034f ,
-0.164062f , -0.242188f , 0.710938f , 0.836604f , 0.046083f , 0.545824f ,
--0.164062f , -0.242188f , 0.710938f , -0.836604f , 0.046083f , 0.545824f ,
--0.234375f , -0.250000f , 0.554688f , -0.928922f , 0.361003f , 0.082034f ,
--0.257812f , -0.312500f , 0.554688f , -0.922819f , 0.371471f , 0.101871f ,
-0.203125f , -0.187500f , 0.562500f , 0.936064f , -0.336802f , 0.101566f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
-0.234375f , -0.250000f , 0.554688f , 0.928922f , 0.361003f , 0.082034f ,
--0.164062f , -0.242188f , 0.710938f , -0.836604f , 0.046083f , 0.545824f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
--0.234375f , -0.250000f , 0.554688f , -0.928922f , 0.361003f , 0.082034f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.610096f , 0.792322f ,
-0.000000f , -0.773438f , 0.718750f , 0.000000f , -0.952239f , 0.305307f ,
-0.000000f , -0.773438f , 0.718750f , 0.000000f , -0.952239f , 0.305307f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.610096f , 0.792322f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
-0.117188f , -0.835938f , 0.710937f , 0.172948f , -0.282754f , 0.943449f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.093750f , -0.820313f , 0.710937f , -0.633198f , -0.000183f , 0.773980f ,
--0.093750f , -0.742188f , 0.726562f , 0.210639f , -0.466750f , 0.858913f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
--0.093750f , -0.820313f , 0.710937f , 0.633198f , -0.000183f , 0.773980f ,
-0.062500f , -0.882813f , 0.695312f , -0.070894f , -0.387036f , 0.919309f ,
-0.117188f , -0.835938f , 0.710937f , 0.172948f , -0.282754f , 0.943449f ,
-0.046875f , -0.867188f , 0.687500f , -0.366924f , 0.603717f , 0.707694f ,
--0.093750f , -0.820313f , 0.710937f , 0.633198f , -0.000183f , 0.773980f ,
--0.117188f , -0.835938f , 0.710937f , -0.172948f , -0.282754f , 0.943449f ,
--0.046875f , -0.867188f , 0.687500f , 0.366924f , 0.603717f , 0.707694f ,
-0.000000f , -0.890625f , 0.687500f , 0.000000f , -0.411603f , 0.911344f ,
-0.062500f , -0.882813f , 0.695312f , -0.070894f , -0.387036f , 0.919309f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
--0.046875f , -0.867188f , 0.687500f , 0.366924f , 0.603717f , 0.707694f ,
--0.062500f , -0.882813f , 0.695312f , 0.070894f , -0.387036f , 0.919309f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
-0.046875f , -0.867188f , 0.687500f , -0.366924f , 0.603717f , 0.707694f ,
-0.046875f , -0.851562f , 0.632812f , -0.318979f , 0.469222f , 0.823420f ,
--0.046875f , -0.851562f , 0.632812f , 0.318979f , 0.469222f , 0.823420f ,
--0.046875f , -0.867188f , 0.687500f , 0.366924f , 0.603717f , 0.707694f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
-0.046875f , -0.867188f , 0.687500f , -0.366924f , 0.603717f , 0.707694f ,
-0.093750f , -0.820313f , 0.710937f , -0.633198f , -0.000183f , 0.773980f ,
-0.046875f , -0.851562f , 0.632812f , -0.318979f , 0.469222f , 0.823420f ,
--0.093750f , -0.812500f , 0.640625f , 0.671468f , 0.144963f , 0.726707f ,
--0.093750f , -0.820313f , 0.710937f , 0.633198f , -0.000183f , 0.773980f ,
--0.046875f , -0.851562f , 0.632812f , 0.318979f , 0.469222f , 0.823420f ,
-0.093750f , -0.820313f , 0.710937f , -0.633198f , -0.000183f , 0.773980f ,
-0.093750f , -0.742188f , 0.726562f , -0.210639f , -0.466750f , 0.858913f ,
-0.093750f , -0.812500f , 0.640625f , -0.671468f , 0.144963f , 0.726707f ,
--0.093750f , -0.750000f , 0.664062f , 0.516800f , -0.703696f , 0.487533f ,
--0.093750f , -0.742188f , 0.726562f , 0.210639f , -0.466750f , 0.858913f ,
--0.093750f , -0.812500f , 0.640625f , 0.671468f , 0.144963f , 0.726707f ,
-0.093750f , -0.742188f , 0.726562f , -0.210639f , -0.466750f , 0.858913f ,
-0.000000f , -0.773438f , 0.718750f , 0.000000f , -0.952239f , 0.305307f ,
-0.000000f , -0.781250f , 0.656250f , 0.000000f , -0.693747f , 0.720176f ,
-0.000000f , -0.781250f , 0.656250f , 0.000000f , -0.693747f , 0.720176f ,
-0.000000f , -0.773438f , 0.718750f , 0.000000f , -0.952239f , 0.305307f ,
--0.093750f , -0.742188f , 0.726562f , 0.210639f , -0.466750f , 0.858913f ,
-0.000000f , -0.781250f , 0.656250f , 0.000000f , -0.693747f , 0.720176f ,
-0.000000f , -0.859375f , 0.632812f , 0.000000f , 0.527390f , 0.849605f ,
-0.093750f , -0.750000f , 0.664062f , -0.516800f , -0.703696f , 0.487533f ,
--0.046875f , -0.851562f , 0.632812f , 0.318979f , 0.469222f , 0.823420f ,
-0.000000f , -0.859375f , 0.632812f , 0.000000f , 0.527390f , 0.849605f ,
--0.093750f , -0.750000f , 0.664062f , 0.516800f , -0.703696f , 0.487533f ,
-0.093750f , -0.750000f , 0.664062f , -0.516800f , -0.703696f , 0.487533f ,
-0.046875f , -0.851562f , 0.632812f , -0.318979f , 0.469222f , 0.823420f ,
-0.093750f , -0.812500f , 0.640625f , -0.671468f , 0.144963f , 0.726707f ,
--0.093750f , -0.812500f , 0.640625f , 0.671468f , 0.144963f , 0.726707f ,
--0.046875f , -0.851562f , 0.632812f , 0.318979f , 0.469222f , 0.823420f ,
--0.093750f , -0.750000f , 0.664062f , 0.516800f , -0.703696f , 0.487533f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.171875f , 0.218750f , 0.781250f , 0.118717f , -0.055208f , 0.991363f ,
--0.187500f , 0.156250f , 0.773438f , 0.044038f , 0.005310f , 0.998993f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
--0.171875f , 0.218750f , 0.781250f , -0.118717f , -0.055208f , 0.991363f ,
-0.125000f , 0.304687f , 0.765625f , 0.088595f , -0.080569f , 0.992798f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
--0.171875f , 0.218750f , 0.781250f , -0.118717f , -0.055208f , 0.991363f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.125000f , 0.304687f , 0.765625f , 0.088595f , -0.080569f , 0.992798f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
--0.125000f , 0.304687f , 0.765625f , -0.088595f , -0.080569f , 0.992798f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.203125f , 0.093750f , 0.742188f , -0.000916f , -0.275307f , 0.961333f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
--0.203125f , 0.093750f , 0.742188f , 0.000916f , -0.275307f , 0.961333f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
-0.203125f , 0.093750f , 0.742188f , -0.000916f , -0.275307f , 0.961333f ,
-0.375000f , 0.015625f , 0.703125f , 0.345805f , -0.372234f , 0.861263f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
--0.375000f , 0.062500f , 0.742188f , -0.249458f , -0.171087f , 0.953124f ,
--0.375000f , 0.015625f , 0.703125f , -0.345805f , -0.372234f , 0.861263f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
-0.375000f , 0.015625f , 0.703125f , 0.345805f , -0.372234f , 0.861263f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
-0.375000f , 0.062500f , 0.742188f , 0.249458f , -0.171087f , 0.953124f ,
--0.476562f , 0.101562f , 0.718750f , -0.263497f , -0.028809f , 0.964202f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
--0.375000f , 0.062500f , 0.742188f , -0.249458f , -0.171087f , 0.953124f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
-0.625000f , 0.187500f , 0.648438f , 0.455184f , -0.237373f , 0.858150f ,
-0.476562f , 0.101562f , 0.718750f , 0.263497f , -0.028809f , 0.964202f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
--0.625000f , 0.187500f , 0.648438f , -0.455184f , -0.237373f , 0.858150f ,
--0.476562f , 0.101562f , 0.718750f , -0.263497f , -0.028809f , 0.964202f ,
-0.625000f , 0.187500f , 0.648438f , 0.455184f , -0.237373f , 0.858150f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
--0.585938f , 0.289062f , 0.687500f , -0.168096f , -0.079531f , 0.982543f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.601562f , 0.375000f , 0.664062f , 0.081545f , -0.288308f , 0.954039f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
--0.601562f , 0.375000f , 0.664062f , -0.081545f , -0.288308f , 0.954039f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
-0.601562f , 0.375000f , 0.664062f , 0.081545f , -0.288308f , 0.954039f ,
-0.429688f , 0.437500f , 0.718750f , 0.291940f , 0.106296f , 0.950499f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
--0.429688f , 0.437500f , 0.718750f , -0.291940f , 0.106296f , 0.950499f ,
--0.601562f , 0.375000f , 0.664062f , -0.081545f , -0.288308f , 0.954039f ,
-0.429688f , 0.437500f , 0.718750f , 0.291940f , 0.106296f , 0.950499f ,
-0.328125f , 0.476562f , 0.742188f , 0.138340f , -0.104190f , 0.984863f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
--0.335938f , 0.429687f , 0.757812f , -0.029572f , 0.058473f , 0.997833f ,
--0.328125f , 0.476562f , 0.742188f , -0.138340f , -0.104190f , 0.984863f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
-0.328125f , 0.476562f , 0.742188f , 0.138340f , -0.104190f , 0.984863f ,
-0.250000f , 0.468750f , 0.757812f , 0.222877f , -0.111332f , 0.968444f ,
-0.335938f , 0.429687f , 0.757812f , 0.029572f , 0.058473f , 0.997833f ,
--0.273438f , 0.421875f , 0.773438f , -0.174657f , 0.098758f , 0.979644f ,
--0.250000f , 0.468750f , 0.757812f , -0.222877f , -0.111332f , 0.968444f ,
--0.335938f , 0.429687f , 0.757812f , -0.029572f , 0.058473f , 0.997833f ,
-0.250000f , 0.468750f , 0.757812f , 0.222877f , -0.111332f , 0.968444f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.273438f , 0.421875f , 0.773438f , 0.174657f , 0.098758f , 0.979644f ,
--0.210938f , 0.375000f , 0.781250f , -0.175176f , -0.091525f , 0.980255f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
--0.273438f , 0.421875f , 0.773438f , -0.174657f , 0.098758f , 0.979644f ,
-0.273438f , 0.421875f , 0.773438f , 0.174657f , 0.098758f , 0.979644f ,
-0.210938f , 0.375000f , 0.781250f , 0.175176f , -0.091525f , 0.980255f ,
-0.281250f , 0.398437f , 0.765625f , 0.300699f , -0.264077f , 0.916410f ,
--0.234375f , 0.359375f , 0.757812f , -0.500839f , -0.444319f , 0.742759f ,
--0.210938f , 0.375000f , 0.781250f , -0.175176f , -0.091525f , 0.980255f ,
--0.281250f , 0.398437f , 0.765625f , -0.300699f , -0.264077f , 0.916410f ,
-0.335938f , 0.429687f , 0.757812f , 0.029572f , 0.058473f , 0.997833f ,
-0.273438f , 0.421875f , 0.773438f , 0.174657f , 0.098758f , 0.979644f ,
-0.335938f , 0.406250f , 0.750000f , -0.013581f , -0.367992f , 0.929716f ,
--0.281250f , 0.398437f , 0.765625f , -0.300699f , -0.264077f , 0.916410f ,
--0.273438f , 0.421875f , 0.773438f , -0.174657f , 0.098758f , 0.979644f ,
--0.335938f , 0.406250f , 0.750000f , 0.013581f , -0.367992f , 0.929716f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
-0.335938f , 0.429687f , 0.757812f , 0.029572f , 0.058473f , 0.997833f ,
-0.335938f , 0.406250f , 0.750000f , -0.013581f , -0.367992f , 0.929716f ,
--0.335938f , 0.406250f , 0.750000f , 0.013581f , -0.367992f , 0.929716f ,
--0.335938f , 0.429687f , 0.757812f , -0.029572f , 0.058473f , 0.997833f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
-0.414062f , 0.390625f , 0.750000f , -0.139470f , -0.915372f , 0.377606f ,
--0.414062f , 0.390625f , 0.750000f , 0.139470f , -0.915372f , 0.377606f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
-0.585938f , 0.289062f , 0.687500f , 0.168096f , -0.079531f , 0.982543f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
-0.554688f , 0.281250f , 0.671875f , -0.383984f , -0.135075f , 0.913388f ,
--0.531250f , 0.335937f , 0.679688f , 0.134617f , -0.552934f , 0.822230f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
--0.554688f , 0.281250f , 0.671875f , 0.383984f , -0.135075f , 0.913388f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
-0.585938f , 0.289062f , 0.687500f , 0.168096f , -0.079531f , 0.982543f ,
-0.554688f , 0.281250f , 0.671875f , -0.383984f , -0.135075f , 0.913388f ,
--0.554688f , 0.281250f , 0.671875f , 0.383984f , -0.135075f , 0.913388f ,
--0.585938f , 0.289062f , 0.687500f , -0.168096f , -0.079531f , 0.982543f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
-0.476562f , 0.101562f , 0.718750f , 0.263497f , -0.028809f , 0.964202f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
-0.460938f , 0.117187f , 0.703125f , -0.133824f , 0.598590f , 0.789758f ,
--0.546875f , 0.210937f , 0.671875f , 0.147710f , 0.189856f , 0.970611f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
--0.460938f , 0.117187f , 0.703125f , 0.133824f , 0.598590f , 0.789758f ,
-0.375000f , 0.062500f , 0.742188f , 0.249458f , -0.171087f , 0.953124f ,
-0.476562f , 0.101562f , 0.718750f , 0.263497f , -0.028809f , 0.964202f ,
-0.460938f , 0.117187f , 0.703125f , -0.133824f , 0.598590f , 0.789758f ,
--0.460938f , 0.117187f , 0.703125f , 0.133824f , 0.598590f , 0.789758f ,
--0.476562f , 0.101562f , 0.718750f , -0.263497f , -0.028809f , 0.964202f ,
--0.375000f , 0.062500f , 0.742188f , -0.249458f , -0.171087f , 0.953124f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
-0.375000f , 0.062500f , 0.742188f , 0.249458f , -0.171087f , 0.953124f ,
-0.375000f , 0.085937f , 0.726562f , 0.183325f , 0.552324f , 0.813196f ,
--0.375000f , 0.085937f , 0.726562f , -0.183325f , 0.552324f , 0.813196f ,
--0.375000f , 0.062500f , 0.742188f , -0.249458f , -0.171087f , 0.953124f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
-0.187500f , 0.156250f , 0.773438f , -0.044038f , 0.005310f , 0.998993f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
-0.203125f , 0.171875f , 0.750000f , 0.692007f , 0.295755f , 0.658498f ,
--0.242188f , 0.125000f , 0.757812f , -0.419660f , 0.600818f , 0.680319f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
--0.203125f , 0.171875f , 0.750000f , -0.692007f , 0.295755f , 0.658498f ,
-0.210938f , 0.375000f , 0.781250f , 0.175176f , -0.091525f , 0.980255f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
-0.234375f , 0.359375f , 0.757812f , 0.500839f , -0.444319f , 0.742759f ,
--0.195312f , 0.296875f , 0.757812f , -0.793847f , -0.286508f , 0.536363f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
--0.234375f , 0.359375f , 0.757812f , -0.500839f , -0.444319f , 0.742759f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
-0.171875f , 0.218750f , 0.781250f , 0.118717f , -0.055208f , 0.991363f ,
-0.195312f , 0.296875f , 0.757812f , 0.793847f , -0.286508f , 0.536363f ,
--0.195312f , 0.226562f , 0.750000f , -0.798669f , 0.019379f , 0.601428f ,
--0.171875f , 0.218750f , 0.781250f , -0.118717f , -0.055208f , 0.991363f ,
--0.195312f , 0.296875f , 0.757812f , -0.793847f , -0.286508f , 0.536363f ,
-0.171875f , 0.218750f , 0.781250f , 0.118717f , -0.055208f , 0.991363f ,
-0.187500f , 0.156250f , 0.773438f , -0.044038f , 0.005310f , 0.998993f ,
-0.195312f , 0.226562f , 0.750000f , 0.798669f , 0.019379f , 0.601428f ,
--0.203125f , 0.171875f , 0.750000f , -0.692007f , 0.295755f , 0.658498f ,
--0.187500f , 0.156250f , 0.773438f , 0.044038f , 0.005310f , 0.998993f ,
--0.195312f , 0.226562f , 0.750000f , -0.798669f , 0.019379f , 0.601428f ,
-0.000000f , 0.429687f , 0.742188f , 0.000000f , 0.934080f , 0.357006f ,
-0.062500f , 0.492187f , 0.750000f , -0.810816f , 0.562304f , 0.162267f ,
-0.000000f , 0.406250f , 0.601562f , 0.000000f , 0.886868f , 0.461959f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
--0.062500f , 0.492187f , 0.750000f , 0.810816f , 0.562304f , 0.162267f ,
-0.000000f , 0.406250f , 0.601562f , 0.000000f , 0.886868f , 0.461959f ,
-0.062500f , 0.492187f , 0.750000f , -0.810816f , 0.562304f , 0.162267f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
--0.195312f , 0.664062f , 0.617188f , 0.470138f , 0.525224f , -0.709250f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.335938f , 0.687500f , 0.593750f , 0.112644f , 0.654836f , -0.747276f ,
--0.335938f , 0.687500f , 0.593750f , -0.112644f , 0.654836f , -0.747276f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.492188f , 0.601562f , 0.687500f , 0.602344f , 0.781274f , 0.163610f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
--0.492188f , 0.601562f , 0.687500f , -0.602344f , 0.781274f , 0.163610f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
-0.492188f , 0.601562f , 0.687500f , 0.602344f , 0.781274f , 0.163610f ,
-0.710938f , 0.484375f , 0.625000f , 0.434889f , 0.886593f , 0.157414f ,
-0.679688f , 0.453125f , 0.492188f , 0.362590f , 0.911954f , -0.191870f ,
--0.679688f , 0.453125f , 0.492188f , -0.362590f , 0.911954f , -0.191870f ,
--0.710938f , 0.484375f , 0.625000f , -0.434889f , 0.886593f , 0.157414f ,
--0.492188f , 0.601562f , 0.687500f , -0.602344f , 0.781274f , 0.163610f ,
-0.710938f , 0.484375f , 0.625000f , 0.434889f , 0.886593f , 0.157414f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.679688f , 0.453125f , 0.492188f , 0.362590f , 0.911954f , -0.191870f ,
--0.796875f , 0.406250f , 0.460938f , -0.739097f , 0.606952f , -0.292032f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
--0.679688f , 0.453125f , 0.492188f , -0.362590f , 0.911954f , -0.191870f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.828125f , 0.148437f , 0.445312f , 0.911802f , -0.386059f , -0.139866f ,
-0.773438f , 0.164062f , 0.375000f , 0.856471f , -0.470870f , -0.211341f ,
--0.773438f , 0.164062f , 0.375000f , -0.856471f , -0.470870f , -0.211341f ,
--0.828125f , 0.148437f , 0.445312f , -0.911802f , -0.386059f , -0.139866f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
-0.828125f , 0.148437f , 0.445312f , 0.911802f , -0.386059f , -0.139866f ,
-0.632812f , -0.039063f , 0.539062f , 0.581133f , -0.781213f , 0.227912f ,
-0.773438f , 0.164062f , 0.375000f , 0.856471f , -0.470870f , -0.211341f ,
--0.601562f , -0.000000f , 0.414062f , -0.626057f , -0.778191f , -0.049348f ,
--0.632812f , -0.039063f , 0.539062f , -0.581133f , -0.781213f , 0.227912f ,
--0.773438f , 0.164062f , 0.375000f , -0.856471f , -0.470870f , -0.211341f ,
-0.632812f , -0.039063f , 0.539062f , 0.581133f , -0.781213f , 0.227912f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.601562f , -0.000000f , 0.414062f , 0.626057f , -0.778191f , -0.049348f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
--0.601562f , -0.000000f , 0.414062f , -0.626057f , -0.778191f , -0.049348f ,
-0.000000f , -0.570312f , 0.320312f , 0.000000f , -0.326731f , -0.945097f ,
-0.000000f , -0.484375f , 0.281250f , 0.000000f , -0.710898f , -0.703269f ,
-0.179688f , -0.414062f , 0.257812f , 0.609485f , -0.776421f , -0.160131f ,
--0.179688f , -0.414062f , 0.257812f , -0.609485f , -0.776421f , -0.160131f ,
-0.000000f , -0.484375f , 0.281250f , 0.000000f , -0.710898f , -0.703269f ,
-0.000000f , -0.570312f , 0.320312f , 0.000000f , -0.326731f , -0.945097f ,
-0.000000f , -0.804688f , 0.343750f , 0.000000f , -0.356853f , -0.934141f ,
-0.000000f , -0.570312f , 0.320312f , 0.000000f , -0.326731f , -0.945097f ,
-0.125000f , -0.539062f , 0.359375f , 0.408521f , -0.291971f , -0.864772f ,
--0.125000f , -0.539062f , 0.359375f , -0.408521f , -0.291971f , -0.864772f ,
-0.000000f , -0.570312f , 0.320312f , 0.000000f , -0.326731f , -0.945097f ,
-0.000000f , -0.804688f , 0.343750f , 0.000000f , -0.356853f , -0.934141f ,
-0.000000f , -0.976562f , 0.460937f , 0.000000f , -0.867061f , -0.498154f ,
-0.000000f , -0.804688f , 0.343750f , 0.000000f , -0.356853f , -0.934141f ,
-0.140625f , -0.757812f , 0.367187f , 0.172246f , -0.199896f , -0.964538f ,
--0.140625f , -0.757812f , 0.367187f , -0.172246f , -0.199896f , -0.964538f ,
-0.000000f , -0.804688f , 0.343750f , 0.000000f , -0.356853f , -0.934141f ,
-0.000000f , -0.976562f , 0.460937f , 0.000000f , -0.867061f , -0.498154f ,
-0.179688f , -0.968750f , 0.554687f , 0.147160f , -0.978057f , 0.147404f ,
-0.000000f , -0.984375f , 0.578125f , 0.000000f , -0.971221f , 0.238075f ,
-0.164062f , -0.945312f , 0.437500f , 0.039674f , -0.749474f , -0.660787f ,
-0.000000f , -0.976562f , 0.460937f , 0.000000f , -0.867061f , -0.498154f ,
-0.000000f , -0.984375f , 0.578125f , 0.000000f , -0.971221f , 0.238075f ,
--0.164062f , -0.945312f , 0.437500f , -0.039674f , -0.749474f , -0.660787f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
-0.179688f , -0.968750f , 0.554687f , 0.147160f , -0.978057f , 0.147404f ,
-0.328125f , -0.914062f , 0.398437f , 0.630482f , -0.407788f , -0.660421f ,
--0.164062f , -0.945312f , 0.437500f , -0.039674f , -0.749474f , -0.660787f ,
--0.179688f , -0.968750f , 0.554687f , -0.147160f , -0.978057f , 0.147404f ,
--0.328125f , -0.914062f , 0.398437f , -0.630482f , -0.407788f , -0.660421f ,
-0.367188f , -0.890625f , 0.531250f , 0.938444f , -0.345103f , 0.014252f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
-0.289062f , -0.710938f , 0.382812f , 0.613178f , 0.041017f , -0.788842f ,
--0.328125f , -0.914062f , 0.398437f , -0.630482f , -0.407788f , -0.660421f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
--0.289062f , -0.710938f , 0.382812f , -0.613178f , 0.041017f , -0.788842f ,
-0.351562f , -0.695312f , 0.570312f , 0.978179f , 0.080081f , 0.191687f ,
-0.367188f , -0.890625f , 0.531250f , 0.938444f , -0.345103f , 0.014252f ,
-0.250000f , -0.500000f , 0.390625f , 0.624897f , 0.122379f , -0.771020f ,
--0.289062f , -0.710938f , 0.382812f , -0.613178f , 0.041017f , -0.788842f ,
--0.367188f , -0.890625f , 0.531250f , -0.938444f , -0.345103f , 0.014252f ,
--0.250000f , -0.500000f , 0.390625f , -0.624897f , 0.122379f , -0.771020f ,
-0.289062f , -0.710938f , 0.382812f , 0.613178f , 0.041017f , -0.788842f ,
-0.140625f , -0.757812f , 0.367187f , 0.172246f , -0.199896f , -0.964538f ,
-0.250000f , -0.500000f , 0.390625f , 0.624897f , 0.122379f , -0.771020f ,
--0.125000f , -0.539062f , 0.359375f , -0.408521f , -0.291971f , -0.864772f ,
--0.140625f , -0.757812f , 0.367187f , -0.172246f , -0.199896f , -0.964538f ,
--0.250000f , -0.500000f , 0.390625f , -0.624897f , 0.122379f , -0.771020f ,
-0.289062f , -0.710938f , 0.382812f , 0.613178f , 0.041017f , -0.788842f ,
-0.328125f , -0.914062f , 0.398437f , 0.630482f , -0.407788f , -0.660421f ,
-0.164062f , -0.945312f , 0.437500f , 0.039674f , -0.749474f , -0.660787f ,
--0.164062f , -0.945312f , 0.437500f , -0.039674f , -0.749474f , -0.660787f ,
--0.328125f , -0.914062f , 0.398437f , -0.630482f , -0.407788f , -0.660421f ,
--0.289062f , -0.710938f , 0.382812f , -0.613178f , 0.041017f , -0.788842f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
-0.250000f , -0.500000f , 0.390625f , 0.624897f , 0.122379f , -0.771020f ,
-0.125000f , -0.539062f , 0.359375f , 0.408521f , -0.291971f , -0.864772f ,
--0.125000f , -0.539062f , 0.359375f , -0.408521f , -0.291971f , -0.864772f ,
--0.250000f , -0.500000f , 0.390625f , -0.624897f , 0.122379f , -0.771020f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
-0.312500f , -0.437500f , 0.570312f , 0.963622f , 0.232734f , 0.131199f ,
-0.351562f , -0.695312f , 0.570312f , 0.978179f , 0.080081f , 0.191687f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
--0.250000f , -0.500000f , 0.390625f , -0.624897f , 0.122379f , -0.771020f ,
--0.351562f , -0.695312f , 0.570312f , -0.978179f , 0.080081f , 0.191687f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
-0.257812f , -0.312500f , 0.554688f , 0.922819f , 0.371471f , 0.101871f ,
-0.218750f , -0.281250f , 0.429688f , 0.998230f , 0.018311f , 0.056459f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.218750f , -0.281250f , 0.429688f , -0.998230f , 0.018311f , 0.056459f ,
--0.257812f , -0.312500f , 0.554688f , -0.922819f , 0.371471f , 0.101871f ,
-0.312500f , -0.437500f , 0.570312f , 0.963622f , 0.232734f , 0.131199f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
-0.218750f , -0.281250f , 0.429688f , 0.998230f , 0.018311f , 0.056459f ,
--0.218750f , -0.281250f , 0.429688f , -0.998230f , 0.018311f , 0.056459f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
--0.312500f , -0.437500f , 0.570312f , -0.963622f , 0.232734f , 0.131199f ,
-0.203125f , -0.187500f , 0.562500f , 0.936064f , -0.336802f , 0.101566f ,
-0.234375f , -0.250000f , 0.554688f , 0.928922f , 0.361003f , 0.082034f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.234375f , -0.250000f , 0.554688f , -0.928922f , 0.361003f , 0.082034f ,
--0.203125f , -0.187500f , 0.562500f , -0.936064f , -0.336802f , 0.101566f ,
-0.203125f , -0.187500f , 0.562500f , 0.936064f , -0.336802f , 0.101566f ,
-0.203125f , -0.171875f , 0.500000f , 0.752586f , -0.591113f , 0.290109f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
--0.203125f , -0.171875f , 0.500000f , -0.752586f , -0.591113f , 0.290109f ,
--0.203125f , -0.187500f , 0.562500f , -0.936064f , -0.336802f , 0.101566f ,
-0.000000f , 0.070313f , -0.828125f , 0.000000f , -0.264321f , -0.964415f ,
-0.335938f , 0.054688f , -0.664062f , 0.440352f , -0.320841f , -0.838496f ,
-0.343750f , -0.148437f , -0.539062f , 0.526444f , -0.659352f , -0.536699f ,
--0.343750f , -0.148437f , -0.539062f , -0.526444f , -0.659352f , -0.536699f ,
--0.335938f , 0.054688f , -0.664062f , -0.440352f , -0.320841f , -0.838496f ,
-0.000000f , 0.070313f , -0.828125f , 0.000000f , -0.264321f , -0.964415f ,
-0.000000f , -0.195312f , -0.671875f , 0.000000f , -0.695578f , -0.718406f ,
-0.343750f , -0.148437f , -0.539062f , 0.526444f , -0.659352f , -0.536699f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
--0.343750f , -0.148437f , -0.539062f , -0.526444f , -0.659352f , -0.536699f ,
-0.000000f , -0.195312f , -0.671875f , 0.000000f , -0.695578f , -0.718406f ,
-0.000000f , -0.382812f , -0.351563f , 0.000000f , -0.936583f , -0.350383f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
-0.000000f , -0.460938f , 0.187500f , 0.000000f , -0.981475f , -0.191473f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
-0.000000f , -0.460938f , 0.187500f , 0.000000f , -0.981475f , -0.191473f ,
-0.000000f , -0.460938f , 0.187500f , 0.000000f , -0.981475f , -0.191473f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
-0.000000f , -0.484375f , 0.281250f , 0.000000f , -0.710898f , -0.703269f ,
--0.179688f , -0.414062f , 0.257812f , -0.609485f , -0.776421f , -0.160131f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
-0.000000f , -0.484375f , 0.281250f , 0.000000f , -0.710898f , -0.703269f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
-0.179688f , -0.414062f , 0.257812f , 0.609485f , -0.776421f , -0.160131f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
--0.179688f , -0.414062f , 0.257812f , -0.609485f , -0.776421f , -0.160131f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
-0.773438f , 0.164062f , 0.375000f , 0.856471f , -0.470870f , -0.211341f ,
-0.601562f , -0.000000f , 0.414062f , 0.626057f , -0.778191f , -0.049348f ,
-0.851562f , 0.234375f , 0.054688f , 0.985504f , -0.161412f , 0.052156f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
--0.601562f , -0.000000f , 0.414062f , -0.626057f , -0.778191f , -0.049348f ,
--0.851562f , 0.234375f , 0.054688f , -0.985504f , -0.161412f , 0.052156f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
-0.460938f , 0.437500f , -0.703125f , 0.512650f , 0.168615f , -0.841853f ,
-0.335938f , 0.054688f , -0.664062f , 0.440352f , -0.320841f , -0.838496f ,
--0.335938f , 0.054688f , -0.664062f , -0.440352f , -0.320841f , -0.838496f ,
--0.460938f , 0.437500f , -0.703125f , -0.512650f , 0.168615f , -0.841853f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
-0.000000f , 0.898438f , 0.289063f , 0.000000f , 0.847743f , 0.530381f ,
-0.453125f , 0.851562f , 0.234375f , 0.479781f , 0.718162f , 0.504013f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
--0.453125f , 0.851562f , 0.234375f , -0.479781f , 0.718162f , 0.504013f ,
-0.000000f , 0.898438f , 0.289063f , 0.000000f , 0.847743f , 0.530381f ,
-0.000000f , 0.984375f , -0.078125f , 0.000000f , 0.999756f , 0.021729f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
-0.000000f , 0.898438f , -0.546875f , 0.000000f , 0.846492f , -0.532365f ,
--0.453125f , 0.867188f , -0.382812f , -0.426527f , 0.799676f , -0.422498f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
-0.000000f , 0.898438f , -0.546875f , 0.000000f , 0.846492f , -0.532365f ,
-0.000000f , 0.898438f , -0.546875f , 0.000000f , 0.846492f , -0.532365f ,
-0.453125f , 0.867188f , -0.382812f , 0.426527f , 0.799676f , -0.422498f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
--0.460938f , 0.437500f , -0.703125f , -0.512650f , 0.168615f , -0.841853f ,
--0.453125f , 0.867188f , -0.382812f , -0.426527f , 0.799676f , -0.422498f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
-0.679688f , 0.453125f , 0.492188f , 0.362590f , 0.911954f , -0.191870f ,
-0.796875f , 0.406250f , 0.460938f , 0.739097f , 0.606952f , -0.292032f ,
-0.632812f , 0.453125f , 0.281250f , 0.354289f , 0.818659f , 0.451918f ,
--0.726562f , 0.406250f , 0.335938f , -0.624470f , 0.780328f , -0.033204f ,
--0.796875f , 0.406250f , 0.460938f , -0.739097f , 0.606952f , -0.292032f ,
--0.632812f , 0.453125f , 0.281250f , -0.354289f , 0.818659f , 0.451918f ,
-0.632812f , 0.453125f , 0.281250f , 0.354289f , 0.818659f , 0.451918f ,
-0.726562f , 0.406250f , 0.335938f , 0.624470f , 0.780328f , -0.033204f ,
-0.640625f , 0.703125f , 0.054688f , 0.655019f , 0.685110f , 0.318613f ,
--0.796875f , 0.562500f , 0.125000f , -0.790765f , 0.485611f , 0.372570f ,
--0.726562f , 0.406250f , 0.335938f , -0.624470f , 0.780328f , -0.033204f ,
--0.640625f , 0.703125f , 0.054688f , -0.655019f , 0.685110f , 0.318613f ,
-0.640625f , 0.703125f , 0.054688f , 0.655019f , 0.685110f , 0.318613f ,
-0.796875f , 0.562500f , 0.125000f , 0.790765f , 0.485611f , 0.372570f ,
-0.640625f , 0.750000f , -0.195312f , 0.659536f , 0.748070f , -0.073275f ,
--0.796875f , 0.617188f , -0.117187f , -0.867824f , 0.496811f , 0.002960f ,
--0.796875f , 0.562500f , 0.125000f , -0.790765f , 0.485611f , 0.372570f ,
--0.640625f , 0.750000f , -0.195312f , -0.659536f , 0.748070f , -0.073275f ,
-0.640625f , 0.750000f , -0.195312f , 0.659536f , 0.748070f , -0.073275f ,
-0.796875f , 0.617188f , -0.117187f , 0.867824f , 0.496811f , 0.002960f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
--0.796875f , 0.539062f , -0.359375f , -0.893521f , 0.254524f , -0.369823f ,
--0.796875f , 0.617188f , -0.117187f , -0.867824f , 0.496811f , 0.002960f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.617188f , 0.328125f , -0.585938f , 0.609943f , -0.022065f , -0.792108f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
--0.617188f , 0.328125f , -0.585938f , -0.609943f , -0.022065f , -0.792108f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.460938f , 0.437500f , -0.703125f , 0.512650f , 0.168615f , -0.841853f ,
-0.453125f , 0.867188f , -0.382812f , 0.426527f , 0.799676f , -0.422498f ,
-0.617188f , 0.328125f , -0.585938f , 0.609943f , -0.022065f , -0.792108f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
--0.453125f , 0.867188f , -0.382812f , -0.426527f , 0.799676f , -0.422498f ,
--0.617188f , 0.328125f , -0.585938f , -0.609943f , -0.022065f , -0.792108f ,
-0.453125f , 0.867188f , -0.382812f , 0.426527f , 0.799676f , -0.422498f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
--0.640625f , 0.750000f , -0.195312f , -0.659536f , 0.748070f , -0.073275f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
-0.453125f , 0.851562f , 0.234375f , 0.479781f , 0.718162f , 0.504013f ,
-0.640625f , 0.750000f , -0.195312f , 0.659536f , 0.748070f , -0.073275f ,
--0.640625f , 0.703125f , 0.054688f , -0.655019f , 0.685110f , 0.318613f ,
--0.453125f , 0.851562f , 0.234375f , -0.479781f , 0.718162f , 0.504013f ,
--0.640625f , 0.750000f , -0.195312f , -0.659536f , 0.748070f , -0.073275f ,
-0.453125f , 0.851562f , 0.234375f , 0.479781f , 0.718162f , 0.504013f ,
-0.460938f , 0.523438f , 0.429688f , 0.364483f , 0.902860f , 0.227973f ,
-0.640625f , 0.703125f , 0.054688f , 0.655019f , 0.685110f , 0.318613f ,
--0.632812f , 0.453125f , 0.281250f , -0.354289f , 0.818659f , 0.451918f ,
--0.460938f , 0.523438f , 0.429688f , -0.364483f , 0.902860f , 0.227973f ,
--0.640625f , 0.703125f , 0.054688f , -0.655019f , 0.685110f , 0.318613f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
-0.679688f , 0.453125f , 0.492188f , 0.362590f , 0.911954f , -0.191870f ,
-0.632812f , 0.453125f , 0.281250f , 0.354289f , 0.818659f , 0.451918f ,
--0.632812f , 0.453125f , 0.281250f , -0.354289f , 0.818659f , 0.451918f ,
--0.679688f , 0.453125f , 0.492188f , -0.362590f , 0.911954f , -0.191870f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.460938f , 0.523438f , 0.429688f , 0.364483f , 0.902860f , 0.227973f ,
-0.453125f , 0.851562f , 0.234375f , 0.479781f , 0.718162f , 0.504013f ,
--0.453125f , 0.851562f , 0.234375f , -0.479781f , 0.718162f , 0.504013f ,
--0.460938f , 0.523438f , 0.429688f , -0.364483f , 0.902860f , 0.227973f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
-0.195312f , 0.664062f , 0.617188f , -0.470138f , 0.525224f , -0.709250f ,
-0.335938f , 0.687500f , 0.593750f , 0.112644f , 0.654836f , -0.747276f ,
--0.335938f , 0.687500f , 0.593750f , -0.112644f , 0.654836f , -0.747276f ,
--0.195312f , 0.664062f , 0.617188f , 0.470138f , 0.525224f , -0.709250f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
--0.460938f , 0.523438f , 0.429688f , -0.364483f , 0.902860f , 0.227973f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.000000f , 0.406250f , 0.601562f , 0.000000f , 0.886868f , 0.461959f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
-0.000000f , 0.406250f , 0.601562f , 0.000000f , 0.886868f , 0.461959f ,
-0.796875f , 0.406250f , 0.460938f , 0.739097f , 0.606952f , -0.292032f ,
-0.773438f , 0.164062f , 0.375000f , 0.856471f , -0.470870f , -0.211341f ,
-0.851562f , 0.234375f , 0.054688f , 0.985504f , -0.161412f , 0.052156f ,
--0.851562f , 0.234375f , 0.054688f , -0.985504f , -0.161412f , 0.052156f ,
--0.773438f , 0.164062f , 0.375000f , -0.856471f , -0.470870f , -0.211341f ,
--0.796875f , 0.406250f , 0.460938f , -0.739097f , 0.606952f , -0.292032f ,
-0.851562f , 0.234375f , 0.054688f , 0.985504f , -0.161412f , 0.052156f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.726562f , 0.406250f , 0.335938f , 0.624470f , 0.780328f , -0.033204f ,
--0.796875f , 0.562500f , 0.125000f , -0.790765f , 0.485611f , 0.372570f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
--0.726562f , 0.406250f , 0.335938f , -0.624470f , 0.780328f , -0.033204f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.820312f , 0.328125f , -0.203125f , 0.835170f , 0.529893f , 0.147160f ,
-0.796875f , 0.562500f , 0.125000f , 0.790765f , 0.485611f , 0.372570f ,
--0.796875f , 0.617188f , -0.117187f , -0.867824f , 0.496811f , 0.002960f ,
--0.820312f , 0.328125f , -0.203125f , -0.835170f , 0.529893f , 0.147160f ,
--0.796875f , 0.562500f , 0.125000f , -0.790765f , 0.485611f , 0.372570f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.796875f , 0.539062f , -0.359375f , 0.893521f , 0.254524f , -0.369823f ,
-0.796875f , 0.617188f , -0.117187f , 0.867824f , 0.496811f , 0.002960f ,
--0.796875f , 0.617188f , -0.117187f , -0.867824f , 0.496811f , 0.002960f ,
--0.796875f , 0.539062f , -0.359375f , -0.893521f , 0.254524f , -0.369823f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
-0.429688f , -0.195312f , -0.210938f , 0.596820f , -0.785852f , -0.161840f ,
--0.429688f , -0.195312f , -0.210938f , -0.596820f , -0.785852f , -0.161840f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.406250f , -0.171875f , 0.148437f , 0.567309f , -0.808283f , 0.157537f ,
-0.429688f , -0.195312f , -0.210938f , 0.596820f , -0.785852f , -0.161840f ,
--0.429688f , -0.195312f , -0.210938f , -0.596820f , -0.785852f , -0.161840f ,
--0.406250f , -0.171875f , 0.148437f , -0.567309f , -0.808283f , 0.157537f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
-0.601562f , -0.000000f , 0.414062f , 0.626057f , -0.778191f , -0.049348f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
--0.406250f , -0.171875f , 0.148437f , -0.567309f , -0.808283f , 0.157537f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
-0.406250f , -0.171875f , 0.148437f , 0.567309f , -0.808283f , 0.157537f ,
--0.218750f , -0.281250f , 0.429688f , -0.998230f , 0.018311f , 0.056459f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.406250f , -0.171875f , 0.148437f , -0.567309f , -0.808283f , 0.157537f ,
-0.218750f , -0.281250f , 0.429688f , 0.998230f , 0.018311f , 0.056459f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
-0.406250f , -0.171875f , 0.148437f , 0.567309f , -0.808283f , 0.157537f ,
--0.406250f , -0.171875f , 0.148437f , -0.567309f , -0.808283f , 0.157537f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
--0.218750f , -0.281250f , 0.429688f , -0.998230f , 0.018311f , 0.056459f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
-0.203125f , -0.171875f , 0.500000f , 0.752586f , -0.591113f , 0.290109f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.203125f , -0.171875f , 0.500000f , -0.752586f , -0.591113f , 0.290109f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.640625f , -0.007812f , -0.429688f , 0.281991f , -0.651753f , -0.704001f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.640625f , -0.007812f , -0.429688f , -0.281991f , -0.651753f , -0.704001f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.460938f , 0.437500f , -0.703125f , 0.512650f , 0.168615f , -0.841853f ,
-0.617188f , 0.328125f , -0.585938f , 0.609943f , -0.022065f , -0.792108f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.617188f , 0.328125f , -0.585938f , -0.609943f , -0.022065f , -0.792108f ,
--0.460938f , 0.437500f , -0.703125f , -0.512650f , 0.168615f , -0.841853f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.429688f , -0.195312f , -0.210938f , 0.596820f , -0.785852f , -0.161840f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.429688f , -0.195312f , -0.210938f , -0.596820f , -0.785852f , -0.161840f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
-0.343750f , -0.148437f , -0.539062f , 0.526444f , -0.659352f , -0.536699f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.343750f , -0.148437f , -0.539062f , -0.526444f , -0.659352f , -0.536699f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
-0.335938f , 0.054688f , -0.664062f , 0.440352f , -0.320841f , -0.838496f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
-0.343750f , -0.148437f , -0.539062f , 0.526444f , -0.659352f , -0.536699f ,
--0.343750f , -0.148437f , -0.539062f , -0.526444f , -0.659352f , -0.536699f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.335938f , 0.054688f , -0.664062f , -0.440352f , -0.320841f , -0.838496f ,
-1.023438f , 0.476562f , -0.312500f , -0.037965f , 0.887082f , 0.460036f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
--1.023438f , 0.476562f , -0.312500f , 0.037965f , 0.887082f , 0.460036f ,
-1.023438f , 0.476562f , -0.312500f , -0.037965f , 0.887082f , 0.460036f ,
-1.015625f , 0.414062f , -0.289062f , 0.571978f , -0.114872f , 0.812159f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
--1.187500f , 0.437500f , -0.390625f , -0.391095f , -0.121403f , 0.912290f ,
--1.015625f , 0.414062f , -0.289062f , -0.571978f , -0.114872f , 0.812159f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
-1.187500f , 0.437500f , -0.390625f , 0.391095f , -0.121403f , 0.912290f ,
-1.265625f , 0.289063f , -0.406250f , -0.154607f , -0.077700f , 0.984893f ,
--1.265625f , 0.289063f , -0.406250f , 0.154607f , -0.077700f , 0.984893f ,
--1.187500f , 0.437500f , -0.390625f , -0.391095f , -0.121403f , 0.912290f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
-1.351562f , 0.320313f , -0.421875f , 0.762596f , 0.175115f , 0.622700f ,
-1.265625f , 0.289063f , -0.406250f , -0.154607f , -0.077700f , 0.984893f ,
-1.210938f , 0.078125f , -0.406250f , -0.045839f , 0.361248f , 0.931333f ,
--1.210938f , 0.078125f , -0.406250f , 0.045839f , 0.361248f , 0.931333f ,
--1.265625f , 0.289063f , -0.406250f , 0.154607f , -0.077700f , 0.984893f ,
--1.351562f , 0.320313f , -0.421875f , -0.762596f , 0.175115f , 0.622700f ,
-1.281250f , 0.054688f , -0.429688f , 0.680380f , -0.426405f , 0.595996f ,
-1.210938f , 0.078125f , -0.406250f , -0.045839f , 0.361248f , 0.931333f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
--1.210938f , 0.078125f , -0.406250f , 0.045839f , 0.361248f , 0.931333f ,
--1.281250f , 0.054688f , -0.429688f , -0.680380f , -0.426405f , 0.595996f ,
-1.039062f , -0.101562f , -0.328125f , 0.461257f , -0.798151f , 0.387494f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
--0.828125f , -0.070312f , -0.132812f , -0.355480f , 0.228431f , 0.906308f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
-1.039062f , 0.000000f , -0.367188f , -0.208777f , 0.953673f , 0.216468f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
--1.039062f , 0.000000f , -0.367188f , 0.208777f , 0.953673f , 0.216468f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
-1.210938f , 0.078125f , -0.406250f , -0.045839f , 0.361248f , 0.931333f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
--1.039062f , 0.000000f , -0.367188f , 0.208777f , 0.953673f , 0.216468f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
-1.265625f , 0.289063f , -0.406250f , -0.154607f , -0.077700f , 0.984893f ,
-1.234375f , 0.250000f , -0.445312f , -0.993072f , -0.055208f , 0.103519f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
--1.234375f , 0.250000f , -0.445312f , 0.993072f , -0.055208f , 0.103519f ,
--1.265625f , 0.289063f , -0.406250f , 0.154607f , -0.077700f , 0.984893f ,
-1.187500f , 0.437500f , -0.390625f , 0.391095f , -0.121403f , 0.912290f ,
-1.171875f , 0.359375f , -0.437500f , -0.127598f , -0.758476f , 0.639058f ,
-1.234375f , 0.250000f , -0.445312f , -0.993072f , -0.055208f , 0.103519f ,
--1.234375f , 0.250000f , -0.445312f , 0.993072f , -0.055208f , 0.103519f ,
--1.171875f , 0.359375f , -0.437500f , 0.127598f , -0.758476f , 0.639058f ,
--1.187500f , 0.437500f , -0.390625f , -0.391095f , -0.121403f , 0.912290f ,
-1.015625f , 0.414062f , -0.289062f , 0.571978f , -0.114872f , 0.812159f ,
-1.023438f , 0.343750f , -0.359375f , 0.558458f , -0.654469f , 0.509629f ,
-1.171875f , 0.359375f , -0.437500f , -0.127598f , -0.758476f , 0.639058f ,
--1.171875f , 0.359375f , -0.437500f , 0.127598f , -0.758476f , 0.639058f ,
--1.023438f , 0.343750f , -0.359375f , -0.558458f , -0.654469f , 0.509629f ,
--1.015625f , 0.414062f , -0.289062f , -0.571978f , -0.114872f , 0.812159f ,
-1.015625f , 0.414062f , -0.289062f , 0.571978f , -0.114872f , 0.812159f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
-1.023438f , 0.343750f , -0.359375f , 0.558458f , -0.654469f , 0.509629f ,
--0.945312f , 0.304688f , -0.289062f , -0.727409f , -0.512742f , 0.456008f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
--1.023438f , 0.343750f , -0.359375f , -0.558458f , -0.654469f , 0.509629f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
-0.828125f , -0.070312f , -0.132812f , 0.355480f , 0.228431f , 0.906308f ,
--0.828125f , -0.070312f , -0.132812f , -0.355480f , 0.228431f , 0.906308f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
-0.851562f , 0.234375f , 0.054688f , 0.985504f , -0.161412f , 0.052156f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
--0.726562f , 0.000000f , -0.070312f , -0.971038f , -0.203528f , -0.125004f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
-0.820312f , 0.328125f , -0.203125f , 0.835170f , 0.529893f , 0.147160f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
-0.828125f , -0.070312f , -0.132812f , 0.355480f , 0.228431f , 0.906308f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
--0.812500f , -0.015625f , -0.273438f , -0.804621f , 0.430494f , 0.408918f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
-0.843750f , 0.015625f , -0.273438f , 0.875362f , -0.183599f , 0.447188f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.843750f , 0.015625f , -0.273438f , -0.875362f , -0.183599f , 0.447188f ,
-0.757812f , 0.093750f , -0.273438f , 0.954314f , 0.102573f , 0.280587f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
-0.820312f , 0.085938f , -0.273438f , 0.570055f , 0.736076f , 0.364940f ,
--0.843750f , 0.015625f , -0.273438f , -0.875362f , -0.183599f , 0.447188f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.820312f , 0.085938f , -0.273438f , -0.570055f , 0.736076f , 0.364940f ,
-0.835938f , 0.171875f , -0.273438f , 0.746544f , -0.565935f , 0.349773f ,
-0.796875f , 0.203125f , -0.210937f , 0.853206f , -0.408429f , 0.324259f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.796875f , 0.203125f , -0.210937f , -0.853206f , -0.408429f , 0.324259f ,
--0.835938f , 0.171875f , -0.273438f , -0.746544f , -0.565935f , 0.349773f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
-0.796875f , 0.203125f , -0.210937f , 0.853206f , -0.408429f , 0.324259f ,
-0.835938f , 0.171875f , -0.273438f , 0.746544f , -0.565935f , 0.349773f ,
--0.835938f , 0.171875f , -0.273438f , -0.746544f , -0.565935f , 0.349773f ,
--0.796875f , 0.203125f , -0.210937f , -0.853206f , -0.408429f , 0.324259f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.796875f , 0.203125f , -0.210937f , 0.853206f , -0.408429f , 0.324259f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
--0.796875f , 0.203125f , -0.210937f , -0.853206f , -0.408429f , 0.324259f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.726562f , 0.000000f , -0.070312f , 0.971038f , -0.203528f , -0.125004f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.726562f , 0.000000f , -0.070312f , -0.971038f , -0.203528f , -0.125004f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
-0.726562f , 0.000000f , -0.070312f , 0.971038f , -0.203528f , -0.125004f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
--0.726562f , 0.000000f , -0.070312f , -0.971038f , -0.203528f , -0.125004f ,
-0.945312f , 0.304688f , -0.289062f , 0.727409f , -0.512742f , 0.456008f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
-0.953125f , 0.289063f , -0.343750f , 0.621509f , -0.442213f , 0.646626f ,
--0.890625f , 0.234375f , -0.320312f , -0.663869f , -0.467299f , 0.583819f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
--0.953125f , 0.289063f , -0.343750f , -0.621509f , -0.442213f , 0.646626f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
-0.835938f , 0.171875f , -0.273438f , 0.746544f , -0.565935f , 0.349773f ,
-0.843750f , 0.171875f , -0.320312f , 0.517594f , -0.452284f , 0.726279f ,
--0.843750f , 0.171875f , -0.320312f , -0.517594f , -0.452284f , 0.726279f ,
--0.835938f , 0.171875f , -0.273438f , -0.746544f , -0.565935f , 0.349773f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
-0.835938f , 0.171875f , -0.273438f , 0.746544f , -0.565935f , 0.349773f ,
-0.757812f , 0.093750f , -0.273438f , 0.954314f , 0.102573f , 0.280587f ,
-0.843750f , 0.171875f , -0.320312f , 0.517594f , -0.452284f , 0.726279f ,
--0.765625f , 0.093750f , -0.320312f , -0.767510f , 0.233589f , 0.596912f ,
--0.757812f , 0.093750f , -0.273438f , -0.954314f , 0.102573f , 0.280587f ,
--0.843750f , 0.171875f , -0.320312f , -0.517594f , -0.452284f , 0.726279f ,
-0.757812f , 0.093750f , -0.273438f , 0.954314f , 0.102573f , 0.280587f ,
-0.820312f , 0.085938f , -0.273438f , 0.570055f , 0.736076f , 0.364940f ,
-0.828125f , 0.078125f , -0.320312f , 0.424299f , 0.457137f , 0.781640f ,
--0.828125f , 0.078125f , -0.320312f , -0.424299f , 0.457137f , 0.781640f ,
--0.820312f , 0.085938f , -0.273438f , -0.570055f , 0.736076f , 0.364940f ,
--0.757812f , 0.093750f , -0.273438f , -0.954314f , 0.102573f , 0.280587f ,
-0.820312f , 0.085938f , -0.273438f , 0.570055f , 0.736076f , 0.364940f ,
-0.843750f , 0.015625f , -0.273438f , 0.875362f , -0.183599f , 0.447188f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
--0.843750f , 0.015625f , -0.273438f , -0.875362f , -0.183599f , 0.447188f ,
--0.820312f , 0.085938f , -0.273438f , -0.570055f , 0.736076f , 0.364940f ,
-0.843750f , 0.015625f , -0.273438f , 0.875362f , -0.183599f , 0.447188f ,
-0.812500f , -0.015625f , -0.273438f , 0.804621f , 0.430494f , 0.408918f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
--0.812500f , -0.015625f , -0.320312f , -0.651234f , 0.269478f , 0.709403f ,
--0.812500f , -0.015625f , -0.273438f , -0.804621f , 0.430494f , 0.408918f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
-0.812500f , -0.015625f , -0.273438f , 0.804621f , 0.430494f , 0.408918f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
-0.812500f , -0.015625f , -0.320312f , 0.651234f , 0.269478f , 0.709403f ,
--0.882812f , -0.015625f , -0.265625f , 0.047365f , 0.938444f , 0.342112f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
--0.812500f , -0.015625f , -0.320312f , -0.651234f , 0.269478f , 0.709403f ,
-1.023438f , 0.343750f , -0.359375f , 0.558458f , -0.654469f , 0.509629f ,
-0.945312f , 0.304688f , -0.289062f , 0.727409f , -0.512742f , 0.456008f ,
-1.039062f , 0.328125f , -0.414062f , 0.520493f , -0.249794f , 0.816492f ,
--0.953125f , 0.289063f , -0.343750f , -0.621509f , -0.442213f , 0.646626f ,
--0.945312f , 0.304688f , -0.289062f , -0.727409f , -0.512742f , 0.456008f ,
--1.039062f , 0.328125f , -0.414062f , -0.520493f , -0.249794f , 0.816492f ,
-1.171875f , 0.359375f , -0.437500f , -0.127598f , -0.758476f , 0.639058f ,
-1.023438f , 0.343750f , -0.359375f , 0.558458f , -0.654469f , 0.509629f ,
-1.187500f , 0.343750f , -0.484375f , -0.208350f , -0.539689f , 0.815638f ,
--1.039062f , 0.328125f , -0.414062f , -0.520493f , -0.249794f , 0.816492f ,
--1.023438f , 0.343750f , -0.359375f , -0.558458f , -0.654469f , 0.509629f ,
--1.187500f , 0.343750f , -0.484375f , 0.208350f , -0.539689f , 0.815638f ,
-1.234375f , 0.250000f , -0.445312f , -0.993072f , -0.055208f , 0.103519f ,
-1.171875f , 0.359375f , -0.437500f , -0.127598f , -0.758476f , 0.639058f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
--1.187500f , 0.343750f , -0.484375f , 0.208350f , -0.539689f , 0.815638f ,
--1.171875f , 0.359375f , -0.437500f , 0.127598f , -0.758476f , 0.639058f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
-1.234375f , 0.250000f , -0.445312f , -0.993072f , -0.055208f , 0.103519f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
--1.234375f , 0.250000f , -0.445312f , 0.993072f , -0.055208f , 0.103519f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
-1.039062f , 0.000000f , -0.367188f , -0.208777f , 0.953673f , 0.216468f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
-1.210938f , 0.085938f , -0.484375f , -0.600940f , 0.491745f , 0.630055f ,
--1.210938f , 0.085938f , -0.484375f , 0.600940f , 0.491745f , 0.630055f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
--1.039062f , 0.000000f , -0.367188f , 0.208777f , 0.953673f , 0.216468f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
-1.039062f , 0.000000f , -0.367188f , -0.208777f , 0.953673f , 0.216468f ,
-1.046875f , 0.000000f , -0.421875f , 0.110843f , 0.695120f , 0.710288f ,
--1.046875f , 0.000000f , -0.421875f , -0.110843f , 0.695120f , 0.710288f ,
--1.039062f , 0.000000f , -0.367188f , 0.208777f , 0.953673f , 0.216468f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
-0.828125f , 0.078125f , -0.320312f , 0.424299f , 0.457137f , 0.781640f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
-0.937500f , 0.062500f , -0.335938f , 0.403455f , 0.151097f , 0.902402f ,
--0.937500f , 0.062500f , -0.335938f , -0.403455f , 0.151097f , 0.902402f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
--0.828125f , 0.078125f , -0.320312f , -0.424299f , 0.457137f , 0.781640f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
-0.937500f , 0.062500f , -0.335938f , 0.403455f , 0.151097f , 0.902402f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--0.937500f , 0.062500f , -0.335938f , -0.403455f , 0.151097f , 0.902402f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
-0.960938f , 0.171875f , -0.351562f , 0.372265f , -0.019379f , 0.927915f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
--1.054688f , 0.187500f , -0.382812f , -0.325419f , -0.115177f , 0.938505f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
-1.054688f , 0.187500f , -0.382812f , 0.325419f , -0.115177f , 0.938505f ,
-1.109375f , 0.210938f , -0.390625f , 0.462752f , -0.381817f , 0.800012f ,
--1.109375f , 0.210938f , -0.390625f , -0.462752f , -0.381817f , 0.800012f ,
--1.054688f , 0.187500f , -0.382812f , -0.325419f , -0.115177f , 0.938505f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
-1.039062f , 0.328125f , -0.414062f , 0.520493f , -0.249794f , 0.816492f ,
-0.953125f , 0.289063f , -0.343750f , 0.621509f , -0.442213f , 0.646626f ,
-1.085938f , 0.273438f , -0.390625f , 0.358562f , 0.308054f , 0.881191f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
--0.953125f , 0.289063f , -0.343750f , -0.621509f , -0.442213f , 0.646626f ,
--1.085938f , 0.273438f , -0.390625f , -0.358562f , 0.308054f , 0.881191f ,
-0.890625f , 0.234375f , -0.320312f , 0.663869f , -0.467299f , 0.583819f ,
-0.960938f , 0.171875f , -0.351562f , 0.372265f , -0.019379f , 0.927915f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
--0.960938f , 0.171875f , -0.351562f , -0.372265f , -0.019379f , 0.927915f ,
--0.890625f , 0.234375f , -0.320312f , -0.663869f , -0.467299f , 0.583819f ,
-0.890625f , 0.234375f , -0.320312f , 0.663869f , -0.467299f , 0.583819f ,
-0.843750f , 0.171875f , -0.320312f , 0.517594f , -0.452284f , 0.726279f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
--0.843750f , 0.171875f , -0.320312f , -0.517594f , -0.452284f , 0.726279f ,
--0.890625f , 0.234375f , -0.320312f , -0.663869f , -0.467299f , 0.583819f ,
-0.828125f , 0.078125f , -0.320312f , 0.424299f , 0.457137f , 0.781640f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
-0.765625f , 0.093750f , -0.320312f , 0.767510f , 0.233589f , 0.596912f ,
--0.843750f , 0.171875f , -0.320312f , -0.517594f , -0.452284f , 0.726279f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
--0.765625f , 0.093750f , -0.320312f , -0.767510f , 0.233589f , 0.596912f ,
-0.812500f , -0.015625f , -0.320312f , 0.651234f , 0.269478f , 0.709403f ,
-0.882812f , -0.015625f , -0.265625f , -0.047365f , 0.938444f , 0.342112f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
--0.937500f , 0.062500f , -0.335938f , -0.403455f , 0.151097f , 0.902402f ,
--0.882812f , -0.015625f , -0.265625f , 0.047365f , 0.938444f , 0.342112f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
-1.046875f , 0.000000f , -0.421875f , 0.110843f , 0.695120f , 0.710288f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
-0.937500f , 0.062500f , -0.335938f , 0.403455f , 0.151097f , 0.902402f ,
--0.937500f , 0.062500f , -0.335938f , -0.403455f , 0.151097f , 0.902402f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--1.046875f , 0.000000f , -0.421875f , -0.110843f , 0.695120f , 0.710288f ,
-1.210938f , 0.085938f , -0.484375f , -0.600940f , 0.491745f , 0.630055f ,
-1.054688f , 0.187500f , -0.382812f , 0.325419f , -0.115177f , 0.938505f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--1.054688f , 0.187500f , -0.382812f , -0.325419f , -0.115177f , 0.938505f ,
--1.210938f , 0.085938f , -0.484375f , 0.600940f , 0.491745f , 0.630055f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
-1.109375f , 0.210938f , -0.390625f , 0.462752f , -0.381817f , 0.800012f ,
-1.054688f , 0.187500f , -0.382812f , 0.325419f , -0.115177f , 0.938505f ,
--1.054688f , 0.187500f , -0.382812f , -0.325419f , -0.115177f , 0.938505f ,
--1.109375f , 0.210938f , -0.390625f , -0.462752f , -0.381817f , 0.800012f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
-1.187500f , 0.343750f , -0.484375f , -0.208350f , -0.539689f , 0.815638f ,
-1.085938f , 0.273438f , -0.390625f , 0.358562f , 0.308054f , 0.881191f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
--1.109375f , 0.210938f , -0.390625f , -0.462752f , -0.381817f , 0.800012f ,
--1.085938f , 0.273438f , -0.390625f , -0.358562f , 0.308054f , 0.881191f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
-1.039062f , 0.328125f , -0.414062f , 0.520493f , -0.249794f , 0.816492f ,
-1.085938f , 0.273438f , -0.390625f , 0.358562f , 0.308054f , 0.881191f ,
-1.187500f , 0.343750f , -0.484375f , -0.208350f , -0.539689f , 0.815638f ,
--1.187500f , 0.343750f , -0.484375f , 0.208350f , -0.539689f , 0.815638f ,
--1.085938f , 0.273438f , -0.390625f , -0.358562f , 0.308054f , 0.881191f ,
--1.039062f , 0.328125f , -0.414062f , -0.520493f , -0.249794f , 0.816492f ,
-1.039062f , -0.101562f , -0.328125f , 0.461257f , -0.798151f , 0.387494f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
-1.039062f , -0.085937f , -0.492188f , -0.064669f , -0.682638f , -0.727836f ,
--0.789062f , -0.125000f , -0.328125f , 0.225867f , -0.848079f , -0.479293f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
--1.039062f , -0.085937f , -0.492188f , 0.064669f , -0.682638f , -0.727836f ,
-1.281250f , 0.054688f , -0.429688f , 0.680380f , -0.426405f , 0.595996f ,
-1.039062f , -0.101562f , -0.328125f , 0.461257f , -0.798151f , 0.387494f ,
-1.312500f , 0.054688f , -0.531250f , 0.659566f , -0.485519f , -0.573779f ,
--1.039062f , -0.085937f , -0.492188f , 0.064669f , -0.682638f , -0.727836f ,
--1.039062f , -0.101562f , -0.328125f , -0.461257f , -0.798151f , 0.387494f ,
--1.312500f , 0.054688f , -0.531250f , -0.659566f , -0.485519f , -0.573779f ,
-1.351562f , 0.320313f , -0.421875f , 0.762596f , 0.175115f , 0.622700f ,
-1.281250f , 0.054688f , -0.429688f , 0.680380f , -0.426405f , 0.595996f ,
-1.312500f , 0.054688f , -0.531250f , 0.659566f , -0.485519f , -0.573779f ,
--1.312500f , 0.054688f , -0.531250f , -0.659566f , -0.485519f , -0.573779f ,
--1.281250f , 0.054688f , -0.429688f , -0.680380f , -0.426405f , 0.595996f ,
--1.351562f , 0.320313f , -0.421875f , -0.762596f , 0.175115f , 0.622700f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
-1.351562f , 0.320313f , -0.421875f , 0.762596f , 0.175115f , 0.622700f ,
-1.367188f , 0.296875f , -0.500000f , 0.923978f , 0.086001f , -0.372600f ,
--1.367188f , 0.296875f , -0.500000f , -0.923978f , 0.086001f , -0.372600f ,
--1.351562f , 0.320313f , -0.421875f , -0.762596f , 0.175115f , 0.622700f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
-1.023438f , 0.476562f , -0.312500f , -0.037965f , 0.887082f , 0.460036f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
-1.250000f , 0.468750f , -0.546875f , 0.279580f , 0.620777f , -0.732414f ,
--1.250000f , 0.468750f , -0.546875f , -0.279580f , 0.620777f , -0.732414f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
--1.023438f , 0.476562f , -0.312500f , 0.037965f , 0.887082f , 0.460036f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
-1.023438f , 0.476562f , -0.312500f , -0.037965f , 0.887082f , 0.460036f ,
-1.023438f , 0.437500f , -0.484375f , -0.427778f , 0.575518f , -0.696951f ,
--1.023438f , 0.437500f , -0.484375f , 0.427778f , 0.575518f , -0.696951f ,
--1.023438f , 0.476562f , -0.312500f , 0.037965f , 0.887082f , 0.460036f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
-1.023438f , 0.437500f , -0.484375f , -0.427778f , 0.575518f , -0.696951f ,
-1.039062f , -0.085937f , -0.492188f , -0.064669f , -0.682638f , -0.727836f ,
-0.789062f , -0.125000f , -0.328125f , -0.225867f , -0.848079f , -0.479293f ,
--0.789062f , -0.125000f , -0.328125f , 0.225867f , -0.848079f , -0.479293f ,
--1.039062f , -0.085937f , -0.492188f , 0.064669f , -0.682638f , -0.727836f ,
--1.023438f , 0.437500f , -0.484375f , 0.427778f , 0.575518f , -0.696951f ,
-1.023438f , 0.437500f , -0.484375f , -0.427778f , 0.575518f , -0.696951f ,
-1.250000f , 0.468750f , -0.546875f , 0.279580f , 0.620777f , -0.732414f ,
-1.039062f , -0.085937f , -0.492188f , -0.064669f , -0.682638f , -0.727836f ,
--1.312500f , 0.054688f , -0.531250f , -0.659566f , -0.485519f , -0.573779f ,
--1.250000f , 0.468750f , -0.546875f , -0.279580f , 0.620777f , -0.732414f ,
--1.039062f , -0.085937f , -0.492188f , 0.064669f , -0.682638f , -0.727836f ,
-1.250000f , 0.468750f , -0.546875f , 0.279580f , 0.620777f , -0.732414f ,
-1.367188f , 0.296875f , -0.500000f , 0.923978f , 0.086001f , -0.372600f ,
-1.312500f , 0.054688f , -0.531250f , 0.659566f , -0.485519f , -0.573779f ,
--1.312500f , 0.054688f , -0.531250f , -0.659566f , -0.485519f , -0.573779f ,
--1.367188f , 0.296875f , -0.500000f , -0.923978f , 0.086001f , -0.372600f ,
--1.250000f , 0.468750f , -0.546875f , -0.279580f , 0.620777f , -0.732414f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.820312f , 0.328125f , -0.203125f , 0.835170f , 0.529893f , 0.147160f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
--0.820312f , 0.328125f , -0.203125f , -0.835170f , 0.529893f , 0.147160f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.859375f , 0.382813f , -0.382812f , -0.652333f , 0.601001f , -0.461715f ,
-0.789062f , -0.125000f , -0.328125f , -0.225867f , -0.848079f , -0.479293f ,
--0.789062f , -0.125000f , -0.328125f , 0.225867f , -0.848079f , -0.479293f ,
--0.859375f , 0.382813f , -0.382812f , 0.652333f , 0.601001f , -0.461715f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.640625f , -0.007812f , -0.429688f , 0.281991f , -0.651753f , -0.704001f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
--0.789062f , -0.125000f , -0.328125f , 0.225867f , -0.848079f , -0.479293f ,
--0.640625f , -0.007812f , -0.429688f , -0.281991f , -0.651753f , -0.704001f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
-0.437500f , 0.164062f , 0.765625f , 0.711631f , -0.679250f , 0.179327f ,
-0.500000f , 0.093750f , 0.687500f , 0.605304f , -0.505783f , 0.614612f ,
-0.562500f , 0.242187f , 0.671875f , 0.801782f , -0.000977f , 0.597583f ,
--0.437500f , 0.164062f , 0.765625f , -0.711631f , -0.679250f , 0.179327f ,
--0.468750f , 0.242187f , 0.757812f , -0.970580f , -0.015168f , 0.240181f ,
--0.562500f , 0.242187f , 0.671875f , -0.801782f , -0.000977f , 0.597583f ,
-0.500000f , 0.093750f , 0.687500f , 0.605304f , -0.505783f , 0.614612f ,
-0.546875f , 0.054687f , 0.578125f , 0.683645f , -0.547288f , 0.482742f ,
-0.625000f , 0.242187f , 0.562500f , 0.868374f , -0.002258f , 0.495834f ,
--0.500000f , 0.093750f , 0.687500f , -0.605304f , -0.505783f , 0.614612f ,
--0.562500f , 0.242187f , 0.671875f , -0.801782f , -0.000977f , 0.597583f ,
--0.625000f , 0.242187f , 0.562500f , -0.868374f , -0.002258f , 0.495834f ,
-0.351562f , 0.031250f , 0.718750f , 0.096896f , -0.751030f , 0.653096f ,
-0.351562f , -0.023438f , 0.617188f , 0.109470f , -0.872951f , 0.475295f ,
-0.546875f , 0.054687f , 0.578125f , 0.683645f , -0.547288f , 0.482742f ,
--0.351562f , 0.031250f , 0.718750f , -0.096896f , -0.751030f , 0.653096f ,
--0.500000f , 0.093750f , 0.687500f , -0.605304f , -0.505783f , 0.614612f ,
--0.546875f , 0.054687f , 0.578125f , -0.683645f , -0.547288f , 0.482742f ,
-0.351562f , 0.132812f , 0.781250f , 0.048738f , -0.965545f , 0.255562f ,
-0.351562f , 0.031250f , 0.718750f , 0.096896f , -0.751030f , 0.653096f ,
-0.500000f , 0.093750f , 0.687500f , 0.605304f , -0.505783f , 0.614612f ,
--0.351562f , 0.132812f , 0.781250f , -0.048738f , -0.965545f , 0.255562f ,
--0.437500f , 0.164062f , 0.765625f , -0.711631f , -0.679250f , 0.179327f ,
--0.500000f , 0.093750f , 0.687500f , -0.605304f , -0.505783f , 0.614612f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.203125f , 0.093750f , 0.742188f , -0.454909f , -0.541520f , 0.706931f ,
-0.351562f , 0.031250f , 0.718750f , 0.096896f , -0.751030f , 0.653096f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
--0.351562f , 0.132812f , 0.781250f , -0.048738f , -0.965545f , 0.255562f ,
--0.351562f , 0.031250f , 0.718750f , -0.096896f , -0.751030f , 0.653096f ,
-0.203125f , 0.093750f , 0.742188f , -0.454909f , -0.541520f , 0.706931f ,
-0.156250f , 0.054687f , 0.648438f , -0.547227f , -0.639424f , 0.540025f ,
-0.351562f , -0.023438f , 0.617188f , 0.109470f , -0.872951f , 0.475295f ,
--0.203125f , 0.093750f , 0.742188f , 0.454909f , -0.541520f , 0.706931f ,
--0.351562f , 0.031250f , 0.718750f , -0.096896f , -0.751030f , 0.653096f ,
--0.351562f , -0.023438f , 0.617188f , -0.109470f , -0.872951f , 0.475295f ,
-0.156250f , 0.054687f , 0.648438f , -0.547227f , -0.639424f , 0.540025f ,
-0.203125f , 0.093750f , 0.742188f , -0.454909f , -0.541520f , 0.706931f ,
-0.078125f , 0.242187f , 0.656250f , -0.811914f , -0.000916f , 0.583728f ,
--0.156250f , 0.054687f , 0.648438f , 0.547227f , -0.639424f , 0.540025f ,
--0.078125f , 0.242187f , 0.656250f , 0.811914f , -0.000916f , 0.583728f ,
--0.203125f , 0.093750f , 0.742188f , 0.454909f , -0.541520f , 0.706931f ,
-0.203125f , 0.093750f , 0.742188f , -0.454909f , -0.541520f , 0.706931f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
--0.203125f , 0.093750f , 0.742188f , 0.454909f , -0.541520f , 0.706931f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.203125f , 0.390625f , 0.742188f , -0.460402f , 0.527726f , 0.713767f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
--0.242188f , 0.242187f , 0.796875f , 0.955748f , -0.018250f , 0.293588f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
-0.078125f , 0.242187f , 0.656250f , -0.811914f , -0.000916f , 0.583728f ,
-0.140625f , 0.242187f , 0.742188f , -0.690115f , 0.000336f , 0.723685f ,
-0.156250f , 0.437500f , 0.648438f , -0.525071f , 0.625446f , 0.577136f ,
--0.078125f , 0.242187f , 0.656250f , 0.811914f , -0.000916f , 0.583728f ,
--0.156250f , 0.437500f , 0.648438f , 0.525071f , 0.625446f , 0.577136f ,
--0.140625f , 0.242187f , 0.742188f , 0.690115f , 0.000336f , 0.723685f ,
-0.156250f , 0.437500f , 0.648438f , -0.525071f , 0.625446f , 0.577136f ,
-0.203125f , 0.390625f , 0.742188f , -0.460402f , 0.527726f , 0.713767f ,
-0.351562f , 0.515625f , 0.617188f , 0.116337f , 0.843501f , 0.524338f ,
--0.156250f , 0.437500f , 0.648438f , 0.525071f , 0.625446f , 0.577136f ,
--0.351562f , 0.515625f , 0.617188f , -0.116337f , 0.843501f , 0.524338f ,
--0.203125f , 0.390625f , 0.742188f , 0.460402f , 0.527726f , 0.713767f ,
-0.203125f , 0.390625f , 0.742188f , -0.460402f , 0.527726f , 0.713767f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.351562f , 0.453125f , 0.718750f , 0.100864f , 0.739555f , 0.665456f ,
--0.203125f , 0.390625f , 0.742188f , 0.460402f , 0.527726f , 0.713767f ,
--0.351562f , 0.453125f , 0.718750f , -0.100864f , 0.739555f , 0.665456f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
-0.351562f , 0.453125f , 0.718750f , 0.100864f , 0.739555f , 0.665456f ,
-0.351562f , 0.359375f , 0.781250f , 0.043336f , 0.971313f , 0.233741f ,
-0.500000f , 0.390625f , 0.687500f , 0.609790f , 0.492203f , 0.621143f ,
--0.351562f , 0.453125f , 0.718750f , -0.100864f , 0.739555f , 0.665456f ,
--0.500000f , 0.390625f , 0.687500f , -0.609790f , 0.492203f , 0.621143f ,
--0.351562f , 0.359375f , 0.781250f , -0.043336f , 0.971313f , 0.233741f ,
-0.351562f , 0.515625f , 0.617188f , 0.116337f , 0.843501f , 0.524338f ,
-0.351562f , 0.453125f , 0.718750f , 0.100864f , 0.739555f , 0.665456f ,
-0.546875f , 0.437500f , 0.578125f , 0.672658f , 0.534715f , 0.511429f ,
--0.351562f , 0.515625f , 0.617188f , -0.116337f , 0.843501f , 0.524338f ,
--0.546875f , 0.437500f , 0.578125f , -0.672658f , 0.534715f , 0.511429f ,
--0.351562f , 0.453125f , 0.718750f , -0.100864f , 0.739555f , 0.665456f ,
-0.546875f , 0.437500f , 0.578125f , 0.672658f , 0.534715f , 0.511429f ,
-0.500000f , 0.390625f , 0.687500f , 0.609790f , 0.492203f , 0.621143f ,
-0.625000f , 0.242187f , 0.562500f , 0.868374f , -0.002258f , 0.495834f ,
--0.546875f , 0.437500f , 0.578125f , -0.672658f , 0.534715f , 0.511429f ,
--0.625000f , 0.242187f , 0.562500f , -0.868374f , -0.002258f , 0.495834f ,
--0.500000f , 0.390625f , 0.687500f , -0.609790f , 0.492203f , 0.621143f ,
-0.500000f , 0.390625f , 0.687500f , 0.609790f , 0.492203f , 0.621143f ,
-0.437500f , 0.328125f , 0.765625f , 0.716178f , 0.677053f , 0.169225f ,
-0.562500f , 0.242187f , 0.671875f , 0.801782f , -0.000977f , 0.597583f ,
--0.500000f , 0.390625f , 0.687500f , -0.609790f , 0.492203f , 0.621143f ,
--0.562500f , 0.242187f , 0.671875f , -0.801782f , -0.000977f , 0.597583f ,
--0.437500f , 0.328125f , 0.765625f , -0.716178f , 0.677053f , 0.169225f ,
-0.476562f , 0.242187f , 0.773438f , 0.962584f , -0.011292f , 0.270669f ,
-0.468750f , 0.242187f , 0.757812f , 0.970580f , -0.015168f , 0.240181f ,
-0.445312f , 0.335937f , 0.781250f , 0.717948f , 0.658193f , 0.226417f ,
--0.476562f , 0.242187f , 0.773438f , -0.962584f , -0.011292f , 0.270669f ,
--0.445312f , 0.335937f , 0.781250f , -0.717948f , 0.658193f , 0.226417f ,
--0.468750f , 0.242187f , 0.757812f , -0.970580f , -0.015168f , 0.240181f ,
-0.445312f , 0.335937f , 0.781250f , 0.717948f , 0.658193f , 0.226417f ,
-0.437500f , 0.328125f , 0.765625f , 0.716178f , 0.677053f , 0.169225f ,
-0.351562f , 0.375000f , 0.804688f , 0.030793f , 0.939726f , 0.340495f ,
--0.445312f , 0.335937f , 0.781250f , -0.717948f , 0.658193f , 0.226417f ,
--0.351562f , 0.375000f , 0.804688f , -0.030793f , 0.939726f , 0.340495f ,
--0.437500f , 0.328125f , 0.765625f , -0.716178f , 0.677053f , 0.169225f ,
-0.351562f , 0.375000f , 0.804688f , 0.030793f , 0.939726f , 0.340495f ,
-0.351562f , 0.359375f , 0.781250f , 0.043336f , 0.971313f , 0.233741f ,
-0.265625f , 0.335937f , 0.820312f , -0.607074f , 0.644795f , 0.464400f ,
--0.351562f , 0.375000f , 0.804688f , -0.030793f , 0.939726f , 0.340495f ,
--0.265625f , 0.335937f , 0.820312f , 0.607074f , 0.644795f , 0.464400f ,
--0.351562f , 0.359375f , 0.781250f , -0.043336f , 0.971313f , 0.233741f ,
-0.265625f , 0.335937f , 0.820312f , -0.607074f , 0.644795f , 0.464400f ,
-0.273438f , 0.328125f , 0.796875f , -0.645833f , 0.694693f , 0.316630f ,
-0.226562f , 0.242187f , 0.820312f , -0.923856f , -0.013306f , 0.382427f ,
--0.265625f , 0.335937f , 0.820312f , 0.607074f , 0.644795f , 0.464400f ,
--0.226562f , 0.242187f , 0.820312f , 0.923856f , -0.013306f , 0.382427f ,
--0.273438f , 0.328125f , 0.796875f , 0.645833f , 0.694693f , 0.316630f ,
-0.273438f , 0.164062f , 0.796875f , -0.638600f , -0.696463f , 0.327250f ,
-0.265625f , 0.156250f , 0.820312f , -0.599200f , -0.652425f , 0.463973f ,
-0.226562f , 0.242187f , 0.820312f , -0.923856f , -0.013306f , 0.382427f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
--0.242188f , 0.242187f , 0.796875f , 0.955748f , -0.018250f , 0.293588f ,
--0.226562f , 0.242187f , 0.820312f , 0.923856f , -0.013306f , 0.382427f ,
-0.351562f , 0.132812f , 0.781250f , 0.048738f , -0.965545f , 0.255562f ,
-0.351562f , 0.117187f , 0.804688f , 0.030305f , -0.941191f , 0.336497f ,
-0.265625f , 0.156250f , 0.820312f , -0.599200f , -0.652425f , 0.463973f ,
--0.351562f , 0.132812f , 0.781250f , -0.048738f , -0.965545f , 0.255562f ,
--0.273438f , 0.164062f , 0.796875f , 0.638600f , -0.696463f , 0.327250f ,
--0.265625f , 0.156250f , 0.820312f , 0.599200f , -0.652425f , 0.463973f ,
-0.437500f , 0.164062f , 0.765625f , 0.711631f , -0.679250f , 0.179327f ,
-0.445312f , 0.156250f , 0.781250f , 0.710624f , -0.665792f , 0.227363f ,
-0.351562f , 0.117187f , 0.804688f , 0.030305f , -0.941191f , 0.336497f ,
--0.437500f , 0.164062f , 0.765625f , -0.711631f , -0.679250f , 0.179327f ,
--0.351562f , 0.132812f , 0.781250f , -0.048738f , -0.965545f , 0.255562f ,
--0.351562f , 0.117187f , 0.804688f , -0.030305f , -0.941191f , 0.336497f ,
-0.468750f , 0.242187f , 0.757812f , 0.970580f , -0.015168f , 0.240181f ,
-0.476562f , 0.242187f , 0.773438f , 0.962584f , -0.011292f , 0.270669f ,
-0.445312f , 0.156250f , 0.781250f , 0.710624f , -0.665792f , 0.227363f ,
--0.468750f , 0.242187f , 0.757812f , -0.970580f , -0.015168f , 0.240181f ,
--0.437500f , 0.164062f , 0.765625f , -0.711631f , -0.679250f , 0.179327f ,
--0.445312f , 0.156250f , 0.781250f , -0.710624f , -0.665792f , 0.227363f ,
-0.000000f , -0.984375f , 0.578125f , 0.000000f , -0.971221f , 0.238075f ,
-0.179688f , -0.968750f , 0.554687f , 0.147160f , -0.978057f , 0.147404f ,
-0.000000f , -0.945312f , 0.640625f , 0.000000f , -0.766656f , 0.642018f ,
-0.000000f , -0.984375f , 0.578125f , 0.000000f , -0.971221f , 0.238075f ,
-0.000000f , -0.945312f , 0.640625f , 0.000000f , -0.766656f , 0.642018f ,
--0.179688f , -0.968750f , 0.554687f , -0.147160f , -0.978057f , 0.147404f ,
-0.179688f , -0.968750f , 0.554687f , 0.147160f , -0.978057f , 0.147404f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
-0.164062f , -0.929688f , 0.632812f , 0.146062f , -0.788720f , 0.597125f ,
--0.179688f , -0.968750f , 0.554687f , -0.147160f , -0.978057f , 0.147404f ,
--0.164062f , -0.929688f , 0.632812f , -0.146062f , -0.788720f , 0.597125f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
-0.265625f , -0.820312f , 0.664062f , 0.531480f , -0.237861f , 0.812952f ,
-0.234375f , -0.914062f , 0.632812f , 0.357830f , -0.633290f , 0.686209f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
--0.265625f , -0.820312f , 0.664062f , -0.531480f , -0.237861f , 0.812952f ,
--0.367188f , -0.890625f , 0.531250f , -0.938444f , -0.345103f , 0.014252f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
-0.250000f , -0.703125f , 0.687500f , 0.556566f , -0.045656f , 0.829524f ,
-0.265625f , -0.820312f , 0.664062f , 0.531480f , -0.237861f , 0.812952f ,
-0.367188f , -0.890625f , 0.531250f , 0.938444f , -0.345103f , 0.014252f ,
--0.250000f , -0.703125f , 0.687500f , -0.556566f , -0.045656f , 0.829524f ,
--0.351562f , -0.695312f , 0.570312f , -0.978179f , 0.080081f , 0.191687f ,
--0.367188f , -0.890625f , 0.531250f , -0.938444f , -0.345103f , 0.014252f ,
-0.210938f , -0.445313f , 0.710938f , 0.570360f , 0.075137f , 0.817927f ,
-0.250000f , -0.703125f , 0.687500f , 0.556566f , -0.045656f , 0.829524f ,
-0.351562f , -0.695312f , 0.570312f , 0.978179f , 0.080081f , 0.191687f ,
--0.210938f , -0.445313f , 0.710938f , -0.570360f , 0.075137f , 0.817927f ,
--0.312500f , -0.437500f , 0.570312f , -0.963622f , 0.232734f , 0.131199f ,
--0.351562f , -0.695312f , 0.570312f , -0.978179f , 0.080081f , 0.191687f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.398438f , -0.046875f , 0.671875f , 0.438826f , -0.518998f , 0.733482f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
--0.203125f , -0.187500f , 0.562500f , -0.936064f , -0.336802f , 0.101566f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
-0.398438f , -0.046875f , 0.671875f , 0.438826f , -0.518998f , 0.733482f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.617188f , 0.054687f , 0.625000f , 0.481735f , -0.373577f , 0.792688f ,
--0.398438f , -0.046875f , 0.671875f , -0.438826f , -0.518998f , 0.733482f ,
--0.617188f , 0.054687f , 0.625000f , -0.481735f , -0.373577f , 0.792688f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
-0.828125f , 0.148437f , 0.445312f , 0.911802f , -0.386059f , -0.139866f ,
-0.726562f , 0.203125f , 0.601562f , 0.625019f , -0.315714f , 0.713858f ,
-0.617188f , 0.054687f , 0.625000f , 0.481735f , -0.373577f , 0.792688f ,
--0.828125f , 0.148437f , 0.445312f , -0.911802f , -0.386059f , -0.139866f ,
--0.632812f , -0.039063f , 0.539062f , -0.581133f , -0.781213f , 0.227912f ,
--0.617188f , 0.054687f , 0.625000f , -0.481735f , -0.373577f , 0.792688f ,
-0.726562f , 0.203125f , 0.601562f , 0.625019f , -0.315714f , 0.713858f ,
-0.828125f , 0.148437f , 0.445312f , 0.911802f , -0.386059f , -0.139866f ,
-0.742188f , 0.375000f , 0.656250f , 0.525010f , -0.437666f , 0.729911f ,
--0.726562f , 0.203125f , 0.601562f , -0.625019f , -0.315714f , 0.713858f ,
--0.742188f , 0.375000f , 0.656250f , -0.525010f , -0.437666f , 0.729911f ,
--0.828125f , 0.148437f , 0.445312f , -0.911802f , -0.386059f , -0.139866f ,
-0.742188f , 0.375000f , 0.656250f , 0.525010f , -0.437666f , 0.729911f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.687500f , 0.414062f , 0.726562f , 0.345073f , -0.068087f , 0.936094f ,
--0.742188f , 0.375000f , 0.656250f , -0.525010f , -0.437666f , 0.729911f ,
--0.687500f , 0.414062f , 0.726562f , -0.345073f , -0.068087f , 0.936094f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
-0.687500f , 0.414062f , 0.726562f , 0.345073f , -0.068087f , 0.936094f ,
-0.710938f , 0.484375f , 0.625000f , 0.434889f , 0.886593f , 0.157414f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
--0.687500f , 0.414062f , 0.726562f , -0.345073f , -0.068087f , 0.936094f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
--0.710938f , 0.484375f , 0.625000f , -0.434889f , 0.886593f , 0.157414f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.312500f , 0.640625f , 0.835938f , 0.261391f , 0.206458f , 0.942869f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
--0.492188f , 0.601562f , 0.687500f , -0.602344f , 0.781274f , 0.163610f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
-0.312500f , 0.640625f , 0.835938f , 0.261391f , 0.206458f , 0.942869f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
--0.312500f , 0.640625f , 0.835938f , -0.261391f , 0.206458f , 0.942869f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.101562f , 0.429687f , 0.843750f , -0.023072f , -0.175695f , 0.984161f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
--0.101562f , 0.429687f , 0.843750f , 0.023072f , -0.175695f , 0.984161f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
-0.101562f , 0.429687f , 0.843750f , -0.023072f , -0.175695f , 0.984161f ,
-0.062500f , 0.492187f , 0.750000f , -0.810816f , 0.562304f , 0.162267f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.101562f , 0.429687f , 0.843750f , 0.023072f , -0.175695f , 0.984161f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.062500f , 0.492187f , 0.750000f , 0.810816f , 0.562304f , 0.162267f ,
-0.101562f , 0.429687f , 0.843750f , -0.023072f , -0.175695f , 0.984161f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
--0.101562f , 0.429687f , 0.843750f , 0.023072f , -0.175695f , 0.984161f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
-0.328125f , 0.476562f , 0.742188f , 0.138340f , -0.104190f , 0.984863f ,
-0.312500f , 0.640625f , 0.835938f , 0.261391f , 0.206458f , 0.942869f ,
-0.203125f , 0.617187f , 0.851562f , -0.130619f , 0.157781f , 0.978790f ,
--0.328125f , 0.476562f , 0.742188f , -0.138340f , -0.104190f , 0.984863f ,
--0.250000f , 0.468750f , 0.757812f , -0.222877f , -0.111332f , 0.968444f ,
--0.203125f , 0.617187f , 0.851562f , 0.130619f , 0.157781f , 0.978790f ,
-0.328125f , 0.476562f , 0.742188f , 0.138340f , -0.104190f , 0.984863f ,
-0.429688f , 0.437500f , 0.718750f , 0.291940f , 0.106296f , 0.950499f ,
-0.312500f , 0.640625f , 0.835938f , 0.261391f , 0.206458f , 0.942869f ,
--0.328125f , 0.476562f , 0.742188f , -0.138340f , -0.104190f , 0.984863f ,
--0.312500f , 0.640625f , 0.835938f , -0.261391f , 0.206458f , 0.942869f ,
--0.429688f , 0.437500f , 0.718750f , -0.291940f , 0.106296f , 0.950499f ,
-0.429688f , 0.437500f , 0.718750f , 0.291940f , 0.106296f , 0.950499f ,
-0.601562f , 0.375000f , 0.664062f , 0.081545f , -0.288308f , 0.954039f ,
-0.437500f , 0.546875f , 0.796875f , 0.290201f , -0.040590f , 0.956084f ,
--0.429688f , 0.437500f , 0.718750f , -0.291940f , 0.106296f , 0.950499f ,
--0.437500f , 0.546875f , 0.796875f , -0.290201f , -0.040590f , 0.956084f ,
--0.601562f , 0.375000f , 0.664062f , -0.081545f , -0.288308f , 0.954039f ,
-0.601562f , 0.375000f , 0.664062f , 0.081545f , -0.288308f , 0.954039f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.687500f , 0.414062f , 0.726562f , 0.345073f , -0.068087f , 0.936094f ,
--0.601562f , 0.375000f , 0.664062f , -0.081545f , -0.288308f , 0.954039f ,
--0.687500f , 0.414062f , 0.726562f , -0.345073f , -0.068087f , 0.936094f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.625000f , 0.187500f , 0.648438f , 0.455184f , -0.237373f , 0.858150f ,
-0.742188f , 0.375000f , 0.656250f , 0.525010f , -0.437666f , 0.729911f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
--0.742188f , 0.375000f , 0.656250f , -0.525010f , -0.437666f , 0.729911f ,
--0.625000f , 0.187500f , 0.648438f , -0.455184f , -0.237373f , 0.858150f ,
-0.625000f , 0.187500f , 0.648438f , 0.455184f , -0.237373f , 0.858150f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
-0.726562f , 0.203125f , 0.601562f , 0.625019f , -0.315714f , 0.713858f ,
--0.625000f , 0.187500f , 0.648438f , -0.455184f , -0.237373f , 0.858150f ,
--0.726562f , 0.203125f , 0.601562f , -0.625019f , -0.315714f , 0.713858f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
-0.398438f , -0.046875f , 0.671875f , 0.438826f , -0.518998f , 0.733482f ,
-0.617188f , 0.054687f , 0.625000f , 0.481735f , -0.373577f , 0.792688f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
--0.398438f , -0.046875f , 0.671875f , -0.438826f , -0.518998f , 0.733482f ,
--0.375000f , 0.015625f , 0.703125f , -0.345805f , -0.372234f , 0.861263f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
-0.398438f , -0.046875f , 0.671875f , 0.438826f , -0.518998f , 0.733482f ,
-0.375000f , 0.015625f , 0.703125f , 0.345805f , -0.372234f , 0.861263f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
--0.203125f , 0.093750f , 0.742188f , 0.000916f , -0.275307f , 0.961333f ,
--0.375000f , 0.015625f , 0.703125f , -0.345805f , -0.372234f , 0.861263f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
--0.203125f , 0.093750f , 0.742188f , 0.000916f , -0.275307f , 0.961333f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
-0.125000f , 0.304687f , 0.765625f , 0.088595f , -0.080569f , 0.992798f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.125000f , 0.304687f , 0.765625f , -0.088595f , -0.080569f , 0.992798f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
-0.000000f , 0.210937f , 0.765625f , 0.000000f , -0.298441f , 0.954405f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
-0.000000f , 0.351562f , 0.820312f , 0.000000f , -0.030091f , 0.999542f ,
--0.125000f , 0.304687f , 0.765625f , -0.088595f , -0.080569f , 0.992798f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
-0.000000f , 0.210937f , 0.765625f , 0.000000f , -0.298441f , 0.954405f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
-0.000000f , 0.210937f , 0.765625f , 0.000000f , -0.298441f , 0.954405f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.000000f , -0.890625f , 0.687500f , 0.000000f , -0.411603f , 0.911344f ,
-0.000000f , -0.945312f , 0.640625f , 0.000000f , -0.766656f , 0.642018f ,
-0.164062f , -0.929688f , 0.632812f , 0.146062f , -0.788720f , 0.597125f ,
-0.000000f , -0.890625f , 0.687500f , 0.000000f , -0.411603f , 0.911344f ,
--0.062500f , -0.882813f , 0.695312f , 0.070894f , -0.387036f , 0.919309f ,
--0.164062f , -0.929688f , 0.632812f , -0.146062f , -0.788720f , 0.597125f ,
-0.062500f , -0.882813f , 0.695312f , -0.070894f , -0.387036f , 0.919309f ,
-0.164062f , -0.929688f , 0.632812f , 0.146062f , -0.788720f , 0.597125f ,
-0.234375f , -0.914062f , 0.632812f , 0.357830f , -0.633290f , 0.686209f ,
--0.062500f , -0.882813f , 0.695312f , 0.070894f , -0.387036f , 0.919309f ,
--0.117188f , -0.835938f , 0.710937f , -0.172948f , -0.282754f , 0.943449f ,
--0.234375f , -0.914062f , 0.632812f , -0.357830f , -0.633290f , 0.686209f ,
-0.265625f , -0.820312f , 0.664062f , 0.531480f , -0.237861f , 0.812952f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.234375f , -0.914062f , 0.632812f , 0.357830f , -0.633290f , 0.686209f ,
--0.265625f , -0.820312f , 0.664062f , -0.531480f , -0.237861f , 0.812952f ,
--0.234375f , -0.914062f , 0.632812f , -0.357830f , -0.633290f , 0.686209f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
-0.078125f , -0.445313f , 0.750000f , 0.136204f , -0.004028f , 0.990661f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
-0.250000f , -0.703125f , 0.687500f , 0.556566f , -0.045656f , 0.829524f ,
--0.078125f , -0.445313f , 0.750000f , -0.136204f , -0.004028f , 0.990661f ,
--0.210938f , -0.445313f , 0.710938f , -0.570360f , 0.075137f , 0.817927f ,
--0.250000f , -0.703125f , 0.687500f , -0.556566f , -0.045656f , 0.829524f ,
-0.265625f , -0.820312f , 0.664062f , 0.531480f , -0.237861f , 0.812952f ,
-0.250000f , -0.703125f , 0.687500f , 0.556566f , -0.045656f , 0.829524f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
--0.265625f , -0.820312f , 0.664062f , -0.531480f , -0.237861f , 0.812952f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
-0.078125f , -0.445313f , 0.750000f , 0.136204f , -0.004028f , 0.990661f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
--0.078125f , -0.445313f , 0.750000f , -0.136204f , -0.004028f , 0.990661f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.000000f , -0.679688f , 0.734375f , 0.000000f , -0.034669f , 0.999390f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
-0.000000f , -0.679688f , 0.734375f , 0.000000f , -0.034669f , 0.999390f ,
-0.000000f , -0.445313f , 0.750000f , 0.000000f , -0.004883f , 0.999969f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
-0.000000f , -0.679688f , 0.734375f , 0.000000f , -0.034669f , 0.999390f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.610096f , 0.792322f ,
-0.117188f , -0.687500f , 0.734375f , 0.192938f , -0.046358f , 0.980102f ,
-0.000000f , -0.679688f , 0.734375f , 0.000000f , -0.034669f , 0.999390f ,
--0.117188f , -0.687500f , 0.734375f , -0.192938f , -0.046358f , 0.980102f ,
-0.000000f , -0.765625f , 0.734375f , 0.000000f , -0.610096f , 0.792322f ,
-0.132812f , -0.226563f , 0.796875f , 0.949583f , -0.177892f , 0.258095f ,
-0.093750f , -0.273438f , 0.781250f , 0.514969f , -0.744621f , 0.424604f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
--0.132812f , -0.226563f , 0.796875f , -0.949583f , -0.177892f , 0.258095f ,
--0.125000f , -0.226563f , 0.750000f , -0.819605f , -0.279183f , 0.500259f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.125000f , -0.226563f , 0.750000f , 0.819605f , -0.279183f , 0.500259f ,
-0.101562f , -0.148438f , 0.742188f , -0.427076f , 0.574236f , 0.698416f ,
-0.132812f , -0.226563f , 0.796875f , 0.949583f , -0.177892f , 0.258095f ,
--0.125000f , -0.226563f , 0.750000f , -0.819605f , -0.279183f , 0.500259f ,
--0.132812f , -0.226563f , 0.796875f , -0.949583f , -0.177892f , 0.258095f ,
--0.101562f , -0.148438f , 0.742188f , 0.427076f , 0.574236f , 0.698416f ,
-0.101562f , -0.148438f , 0.742188f , -0.427076f , 0.574236f , 0.698416f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
--0.101562f , -0.148438f , 0.742188f , 0.427076f , 0.574236f , 0.698416f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.000000f , -0.195313f , 0.750000f , 0.000000f , 0.838038f , 0.545579f ,
-0.039062f , -0.125000f , 0.781250f , -0.292520f , 0.943937f , 0.152806f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
--0.039062f , -0.125000f , 0.781250f , 0.292520f , 0.943937f , 0.152806f ,
-0.000000f , -0.195313f , 0.750000f , 0.000000f , 0.838038f , 0.545579f ,
-0.000000f , -0.320313f , 0.781250f , 0.000000f , -0.870785f , 0.491592f ,
-0.000000f , -0.328125f , 0.742188f , 0.000000f , -0.458022f , 0.888913f ,
-0.093750f , -0.273438f , 0.781250f , 0.514969f , -0.744621f , 0.424604f ,
-0.000000f , -0.320313f , 0.781250f , 0.000000f , -0.870785f , 0.491592f ,
--0.093750f , -0.273438f , 0.781250f , -0.514969f , -0.744621f , 0.424604f ,
-0.000000f , -0.328125f , 0.742188f , 0.000000f , -0.458022f , 0.888913f ,
-0.000000f , -0.289063f , 0.804688f , 0.000000f , -0.522172f , 0.852809f ,
-0.000000f , -0.320313f , 0.781250f , 0.000000f , -0.870785f , 0.491592f ,
-0.078125f , -0.250000f , 0.804688f , 0.269021f , -0.771874f , 0.576006f ,
-0.000000f , -0.289063f , 0.804688f , 0.000000f , -0.522172f , 0.852809f ,
--0.078125f , -0.250000f , 0.804688f , -0.269021f , -0.771874f , 0.576006f ,
-0.000000f , -0.320313f , 0.781250f , 0.000000f , -0.870785f , 0.491592f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.046875f , -0.148438f , 0.812500f , -0.145390f , 0.590960f , 0.793451f ,
-0.039062f , -0.125000f , 0.781250f , -0.292520f , 0.943937f , 0.152806f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.000000f , -0.187500f , 0.796875f , 0.000000f , 0.972320f , 0.233528f ,
--0.039062f , -0.125000f , 0.781250f , 0.292520f , 0.943937f , 0.152806f ,
-0.046875f , -0.148438f , 0.812500f , -0.145390f , 0.590960f , 0.793451f ,
-0.093750f , -0.156250f , 0.812500f , 0.364666f , 0.463973f , 0.807276f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
--0.046875f , -0.148438f , 0.812500f , 0.145390f , 0.590960f , 0.793451f ,
--0.039062f , -0.125000f , 0.781250f , 0.292520f , 0.943937f , 0.152806f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
-0.132812f , -0.226563f , 0.796875f , 0.949583f , -0.177892f , 0.258095f ,
-0.109375f , -0.132813f , 0.781250f , 0.627552f , 0.771203f , 0.106479f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
--0.132812f , -0.226563f , 0.796875f , -0.949583f , -0.177892f , 0.258095f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
--0.109375f , -0.132813f , 0.781250f , -0.627552f , 0.771203f , 0.106479f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
-0.078125f , -0.250000f , 0.804688f , 0.269021f , -0.771874f , 0.576006f ,
-0.093750f , -0.273438f , 0.781250f , 0.514969f , -0.744621f , 0.424604f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
--0.132812f , -0.226563f , 0.796875f , -0.949583f , -0.177892f , 0.258095f ,
--0.093750f , -0.273438f , 0.781250f , -0.514969f , -0.744621f , 0.424604f ,
-0.046875f , -0.148438f , 0.812500f , -0.145390f , 0.590960f , 0.793451f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.093750f , -0.156250f , 0.812500f , 0.364666f , 0.463973f , 0.807276f ,
--0.046875f , -0.148438f , 0.812500f , 0.145390f , 0.590960f , 0.793451f ,
--0.093750f , -0.156250f , 0.812500f , -0.364666f , 0.463973f , 0.807276f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
-0.000000f , -0.289063f , 0.804688f , 0.000000f , -0.522172f , 0.852809f ,
-0.078125f , -0.250000f , 0.804688f , 0.269021f , -0.771874f , 0.576006f ,
-0.109375f , -0.226563f , 0.828125f , 0.467605f , -0.215186f , 0.857326f ,
-0.000000f , -0.289063f , 0.804688f , 0.000000f , -0.522172f , 0.852809f ,
-0.000000f , -0.203125f , 0.828125f , 0.000000f , 0.176153f , 0.984344f ,
--0.109375f , -0.226563f , 0.828125f , -0.467605f , -0.215186f , 0.857326f ,
-0.101562f , -0.148438f , 0.742188f , -0.427076f , 0.574236f , 0.698416f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
--0.101562f , -0.148438f , 0.742188f , 0.427076f , 0.574236f , 0.698416f ,
-0.000000f , -0.140625f , 0.742188f , 0.000000f , 0.399121f , 0.916868f ,
-0.000000f , 0.046875f , 0.726562f , 0.000000f , 0.023225f , 0.999725f ,
-0.125000f , -0.226563f , 0.750000f , 0.819605f , -0.279183f , 0.500259f ,
-0.164062f , -0.242188f , 0.710938f , 0.836604f , 0.046083f , 0.545824f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
--0.125000f , -0.226563f , 0.750000f , -0.819605f , -0.279183f , 0.500259f ,
--0.101562f , -0.148438f , 0.742188f , 0.427076f , 0.574236f , 0.698416f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
-0.164062f , -0.242188f , 0.710938f , 0.836604f , 0.046083f , 0.545824f ,
-0.125000f , -0.226563f , 0.750000f , 0.819605f , -0.279183f , 0.500259f ,
-0.179688f , -0.312500f , 0.710938f , 0.655446f , 0.133946f , 0.743248f ,
--0.164062f , -0.242188f , 0.710938f , -0.836604f , 0.046083f , 0.545824f ,
--0.179688f , -0.312500f , 0.710938f , -0.655446f , 0.133946f , 0.743248f ,
--0.125000f , -0.226563f , 0.750000f , -0.819605f , -0.279183f , 0.500259f ,
-0.179688f , -0.312500f , 0.710938f , 0.655446f , 0.133946f , 0.743248f ,
-0.085938f , -0.289063f , 0.742188f , 0.432936f , -0.464339f , 0.772607f ,
-0.210938f , -0.445313f , 0.710938f , 0.570360f , 0.075137f , 0.817927f ,
--0.179688f , -0.312500f , 0.710938f , -0.655446f , 0.133946f , 0.743248f ,
--0.210938f , -0.445313f , 0.710938f , -0.570360f , 0.075137f , 0.817927f ,
--0.085938f , -0.289063f , 0.742188f , -0.432936f , -0.464339f , 0.772607f ,
-0.210938f , -0.445313f , 0.710938f , 0.570360f , 0.075137f , 0.817927f ,
-0.312500f , -0.437500f , 0.570312f , 0.963622f , 0.232734f , 0.131199f ,
-0.179688f , -0.312500f , 0.710938f , 0.655446f , 0.133946f , 0.743248f ,
--0.210938f , -0.445313f , 0.710938f , -0.570360f , 0.075137f , 0.817927f ,
--0.179688f , -0.312500f , 0.710938f , -0.655446f , 0.133946f , 0.743248f ,
--0.312500f , -0.437500f , 0.570312f , -0.963622f , 0.232734f , 0.131199f ,
-0.179688f , -0.312500f , 0.710938f , 0.655446f , 0.133946f , 0.743248f ,
-0.257812f , -0.312500f , 0.554688f , 0.922819f , 0.371471f , 0.101871f ,
-0.164062f , -0.242188f , 0.710938f , 0.836604f , 0.046083f , 0.545824f ,
--0.179688f , -0.312500f , 0.710938f , -0.655446f , 0.133946f , 0.743248f ,
--0.164062f , -0.242188f , 0.710938f , -0.836604f , 0.046083f , 0.545824f ,
--0.257812f , -0.312500f , 0.554688f , -0.922819f , 0.371471f , 0.101871f ,
-0.125000f , -0.101563f , 0.812500f , -0.120579f , -0.287240f , 0.950224f ,
-0.164062f , -0.242188f , 0.710938f , 0.836604f , 0.046083f , 0.545824f ,
-0.234375f , -0.250000f , 0.554688f , 0.928922f , 0.361003f , 0.082034f ,
--0.125000f , -0.101563f , 0.812500f , 0.120579f , -0.287240f , 0.950224f ,
--0.203125f , -0.187500f , 0.562500f , -0.936064f , -0.336802f , 0.101566f ,
--0.234375f , -0.250000f , 0.554688f , -0.928922f , 0.361003f , 0.082034f ,
-0.093750f , -0.742188f , 0.726562f , -0.210639f , -0.466750f , 0.858913f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.000000f , -0.773438f , 0.718750f , 0.000000f , -0.952239f , 0.305307f ,
--0.093750f , -0.742188f , 0.726562f , 0.210639f , -0.466750f , 0.858913f ,
-0.000000f , -0.773438f , 0.718750f , 0.000000f , -0.952239f , 0.305307f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
-0.109375f , -0.718750f , 0.734375f , 0.156987f , -0.132542f , 0.978637f ,
-0.093750f , -0.742188f , 0.726562f , -0.210639f , -0.466750f , 0.858913f ,
-0.093750f , -0.820313f , 0.710937f , -0.633198f , -0.000183f , 0.773980f ,
--0.109375f , -0.718750f , 0.734375f , -0.156987f , -0.132542f , 0.978637f ,
--0.117188f , -0.835938f , 0.710937f , -0.172948f , -0.282754f , 0.943449f ,
--0.093750f , -0.820313f , 0.710937f , 0.633198f , -0.000183f , 0.773980f ,
-0.117188f , -0.835938f , 0.710937f , 0.172948f , -0.282754f , 0.943449f ,
-0.093750f , -0.820313f , 0.710937f , -0.633198f , -0.000183f , 0.773980f ,
-0.046875f , -0.867188f , 0.687500f , -0.366924f , 0.603717f , 0.707694f ,
--0.117188f , -0.835938f , 0.710937f , -0.172948f , -0.282754f , 0.943449f ,
--0.062500f , -0.882813f , 0.695312f , 0.070894f , -0.387036f , 0.919309f ,
--0.046875f , -0.867188f , 0.687500f , 0.366924f , 0.603717f , 0.707694f ,
-0.062500f , -0.882813f , 0.695312f , -0.070894f , -0.387036f , 0.919309f ,
-0.046875f , -0.867188f , 0.687500f , -0.366924f , 0.603717f , 0.707694f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
--0.062500f , -0.882813f , 0.695312f , 0.070894f , -0.387036f , 0.919309f ,
-0.000000f , -0.890625f , 0.687500f , 0.000000f , -0.411603f , 0.911344f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
-0.000000f , -0.859375f , 0.632812f , 0.000000f , 0.527390f , 0.849605f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
-0.046875f , -0.851562f , 0.632812f , -0.318979f , 0.469222f , 0.823420f ,
-0.000000f , -0.859375f , 0.632812f , 0.000000f , 0.527390f , 0.849605f ,
--0.046875f , -0.851562f , 0.632812f , 0.318979f , 0.469222f , 0.823420f ,
-0.000000f , -0.875000f , 0.687500f , 0.000000f , 0.592303f , 0.805689f ,
-0.093750f , -0.820313f , 0.710937f , -0.633198f , -0.000183f , 0.773980f ,
-0.093750f , -0.812500f , 0.640625f , -0.671468f , 0.144963f , 0.726707f ,
-0.046875f , -0.851562f , 0.632812f , -0.318979f , 0.469222f , 0.823420f ,
--0.093750f , -0.820313f , 0.710937f , 0.633198f , -0.000183f , 0.773980f ,
--0.046875f , -0.867188f , 0.687500f , 0.366924f , 0.603717f , 0.707694f ,
--0.046875f , -0.851562f , 0.632812f , 0.318979f , 0.469222f , 0.823420f ,
-0.093750f , -0.742188f , 0.726562f , -0.210639f , -0.466750f , 0.858913f ,
-0.093750f , -0.750000f , 0.664062f , -0.516800f , -0.703696f , 0.487533f ,
-0.093750f , -0.812500f , 0.640625f , -0.671468f , 0.144963f , 0.726707f ,
--0.093750f , -0.742188f , 0.726562f , 0.210639f , -0.466750f , 0.858913f ,
--0.093750f , -0.820313f , 0.710937f , 0.633198f , -0.000183f , 0.773980f ,
--0.093750f , -0.812500f , 0.640625f , 0.671468f , 0.144963f , 0.726707f ,
-0.093750f , -0.750000f , 0.664062f , -0.516800f , -0.703696f , 0.487533f ,
-0.093750f , -0.742188f , 0.726562f , -0.210639f , -0.466750f , 0.858913f ,
-0.000000f , -0.781250f , 0.656250f , 0.000000f , -0.693747f , 0.720176f ,
--0.093750f , -0.750000f , 0.664062f , 0.516800f , -0.703696f , 0.487533f ,
-0.000000f , -0.781250f , 0.656250f , 0.000000f , -0.693747f , 0.720176f ,
--0.093750f , -0.742188f , 0.726562f , 0.210639f , -0.466750f , 0.858913f ,
-0.000000f , -0.859375f , 0.632812f , 0.000000f , 0.527390f , 0.849605f ,
-0.046875f , -0.851562f , 0.632812f , -0.318979f , 0.469222f , 0.823420f ,
-0.093750f , -0.750000f , 0.664062f , -0.516800f , -0.703696f , 0.487533f ,
-0.000000f , -0.859375f , 0.632812f , 0.000000f , 0.527390f , 0.849605f ,
-0.000000f , -0.781250f , 0.656250f , 0.000000f , -0.693747f , 0.720176f ,
--0.093750f , -0.750000f , 0.664062f , 0.516800f , -0.703696f , 0.487533f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.187500f , 0.156250f , 0.773438f , -0.044038f , 0.005310f , 0.998993f ,
-0.171875f , 0.218750f , 0.781250f , 0.118717f , -0.055208f , 0.991363f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
--0.171875f , 0.218750f , 0.781250f , -0.118717f , -0.055208f , 0.991363f ,
-0.132812f , 0.210937f , 0.757812f , -0.158055f , -0.186285f , 0.969665f ,
-0.171875f , 0.218750f , 0.781250f , 0.118717f , -0.055208f , 0.991363f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
--0.132812f , 0.210937f , 0.757812f , 0.158055f , -0.186285f , 0.969665f ,
--0.125000f , 0.304687f , 0.765625f , -0.088595f , -0.080569f , 0.992798f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
-0.210938f , 0.375000f , 0.781250f , 0.175176f , -0.091525f , 0.980255f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
--0.210938f , 0.375000f , 0.781250f , -0.175176f , -0.091525f , 0.980255f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
-0.187500f , 0.156250f , 0.773438f , -0.044038f , 0.005310f , 0.998993f ,
-0.164062f , 0.140625f , 0.750000f , -0.282662f , -0.146336f , 0.947966f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
--0.187500f , 0.156250f , 0.773438f , 0.044038f , 0.005310f , 0.998993f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
--0.164062f , 0.140625f , 0.750000f , 0.282662f , -0.146336f , 0.947966f ,
-0.375000f , 0.015625f , 0.703125f , 0.345805f , -0.372234f , 0.861263f ,
-0.375000f , 0.062500f , 0.742188f , 0.249458f , -0.171087f , 0.953124f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
--0.375000f , 0.015625f , 0.703125f , -0.345805f , -0.372234f , 0.861263f ,
--0.203125f , 0.093750f , 0.742188f , 0.000916f , -0.275307f , 0.961333f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
-0.492188f , 0.062500f , 0.671875f , 0.421644f , -0.403058f , 0.812220f ,
-0.476562f , 0.101562f , 0.718750f , 0.263497f , -0.028809f , 0.964202f ,
-0.375000f , 0.062500f , 0.742188f , 0.249458f , -0.171087f , 0.953124f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
--0.375000f , 0.015625f , 0.703125f , -0.345805f , -0.372234f , 0.861263f ,
--0.375000f , 0.062500f , 0.742188f , -0.249458f , -0.171087f , 0.953124f ,
-0.625000f , 0.187500f , 0.648438f , 0.455184f , -0.237373f , 0.858150f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
-0.476562f , 0.101562f , 0.718750f , 0.263497f , -0.028809f , 0.964202f ,
--0.625000f , 0.187500f , 0.648438f , -0.455184f , -0.237373f , 0.858150f ,
--0.492188f , 0.062500f , 0.671875f , -0.421644f , -0.403058f , 0.812220f ,
--0.476562f , 0.101562f , 0.718750f , -0.263497f , -0.028809f , 0.964202f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.585938f , 0.289062f , 0.687500f , 0.168096f , -0.079531f , 0.982543f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
--0.625000f , 0.187500f , 0.648438f , -0.455184f , -0.237373f , 0.858150f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
-0.585938f , 0.289062f , 0.687500f , 0.168096f , -0.079531f , 0.982543f ,
-0.640625f , 0.296875f , 0.648438f , 0.204047f , -0.125462f , 0.970855f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
--0.585938f , 0.289062f , 0.687500f , -0.168096f , -0.079531f , 0.982543f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
--0.640625f , 0.296875f , 0.648438f , -0.204047f , -0.125462f , 0.970855f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
-0.601562f , 0.375000f , 0.664062f , 0.081545f , -0.288308f , 0.954039f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
--0.601562f , 0.375000f , 0.664062f , -0.081545f , -0.288308f , 0.954039f ,
-0.328125f , 0.476562f , 0.742188f , 0.138340f , -0.104190f , 0.984863f ,
-0.335938f , 0.429687f , 0.757812f , 0.029572f , 0.058473f , 0.997833f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
--0.328125f , 0.476562f , 0.742188f , -0.138340f , -0.104190f , 0.984863f ,
--0.429688f , 0.437500f , 0.718750f , -0.291940f , 0.106296f , 0.950499f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
-0.250000f , 0.468750f , 0.757812f , 0.222877f , -0.111332f , 0.968444f ,
-0.273438f , 0.421875f , 0.773438f , 0.174657f , 0.098758f , 0.979644f ,
-0.335938f , 0.429687f , 0.757812f , 0.029572f , 0.058473f , 0.997833f ,
--0.250000f , 0.468750f , 0.757812f , -0.222877f , -0.111332f , 0.968444f ,
--0.328125f , 0.476562f , 0.742188f , -0.138340f , -0.104190f , 0.984863f ,
--0.335938f , 0.429687f , 0.757812f , -0.029572f , 0.058473f , 0.997833f ,
-0.164062f , 0.414062f , 0.773438f , 0.278664f , -0.214545f , 0.936094f ,
-0.210938f , 0.375000f , 0.781250f , 0.175176f , -0.091525f , 0.980255f ,
-0.273438f , 0.421875f , 0.773438f , 0.174657f , 0.098758f , 0.979644f ,
--0.164062f , 0.414062f , 0.773438f , -0.278664f , -0.214545f , 0.936094f ,
--0.250000f , 0.468750f , 0.757812f , -0.222877f , -0.111332f , 0.968444f ,
--0.273438f , 0.421875f , 0.773438f , -0.174657f , 0.098758f , 0.979644f ,
-0.210938f , 0.375000f , 0.781250f , 0.175176f , -0.091525f , 0.980255f ,
-0.234375f , 0.359375f , 0.757812f , 0.500839f , -0.444319f , 0.742759f ,
-0.281250f , 0.398437f , 0.765625f , 0.300699f , -0.264077f , 0.916410f ,
--0.210938f , 0.375000f , 0.781250f , -0.175176f , -0.091525f , 0.980255f ,
--0.273438f , 0.421875f , 0.773438f , -0.174657f , 0.098758f , 0.979644f ,
--0.281250f , 0.398437f , 0.765625f , -0.300699f , -0.264077f , 0.916410f ,
-0.273438f , 0.421875f , 0.773438f , 0.174657f , 0.098758f , 0.979644f ,
-0.281250f , 0.398437f , 0.765625f , 0.300699f , -0.264077f , 0.916410f ,
-0.335938f , 0.406250f , 0.750000f , -0.013581f , -0.367992f , 0.929716f ,
--0.273438f , 0.421875f , 0.773438f , -0.174657f , 0.098758f , 0.979644f ,
--0.335938f , 0.429687f , 0.757812f , -0.029572f , 0.058473f , 0.997833f ,
--0.335938f , 0.406250f , 0.750000f , 0.013581f , -0.367992f , 0.929716f ,
-0.414062f , 0.390625f , 0.750000f , -0.139470f , -0.915372f , 0.377606f ,
-0.421875f , 0.398437f , 0.773438f , 0.196112f , -0.195929f , 0.960784f ,
-0.335938f , 0.406250f , 0.750000f , -0.013581f , -0.367992f , 0.929716f ,
--0.414062f , 0.390625f , 0.750000f , 0.139470f , -0.915372f , 0.377606f ,
--0.335938f , 0.406250f , 0.750000f , 0.013581f , -0.367992f , 0.929716f ,
--0.421875f , 0.398437f , 0.773438f , -0.196112f , -0.195929f , 0.960784f ,
-0.531250f , 0.335937f , 0.679688f , -0.134617f , -0.552934f , 0.822230f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
-0.414062f , 0.390625f , 0.750000f , -0.139470f , -0.915372f , 0.377606f ,
--0.531250f , 0.335937f , 0.679688f , 0.134617f , -0.552934f , 0.822230f ,
--0.414062f , 0.390625f , 0.750000f , 0.139470f , -0.915372f , 0.377606f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
-0.562500f , 0.351562f , 0.695312f , 0.310068f , -0.103214f , 0.945067f ,
-0.531250f , 0.335937f , 0.679688f , -0.134617f , -0.552934f , 0.822230f ,
-0.554688f , 0.281250f , 0.671875f , -0.383984f , -0.135075f , 0.913388f ,
--0.562500f , 0.351562f , 0.695312f , -0.310068f , -0.103214f , 0.945067f ,
--0.585938f , 0.289062f , 0.687500f , -0.168096f , -0.079531f , 0.982543f ,
--0.554688f , 0.281250f , 0.671875f , 0.383984f , -0.135075f , 0.913388f ,
-0.546875f , 0.210937f , 0.671875f , -0.147710f , 0.189856f , 0.970611f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
-0.554688f , 0.281250f , 0.671875f , -0.383984f , -0.135075f , 0.913388f ,
--0.546875f , 0.210937f , 0.671875f , 0.147710f , 0.189856f , 0.970611f ,
--0.554688f , 0.281250f , 0.671875f , 0.383984f , -0.135075f , 0.913388f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
-0.578125f , 0.195312f , 0.679688f , 0.281503f , -0.021332f , 0.959288f ,
-0.546875f , 0.210937f , 0.671875f , -0.147710f , 0.189856f , 0.970611f ,
-0.460938f , 0.117187f , 0.703125f , -0.133824f , 0.598590f , 0.789758f ,
--0.578125f , 0.195312f , 0.679688f , -0.281503f , -0.021332f , 0.959288f ,
--0.476562f , 0.101562f , 0.718750f , -0.263497f , -0.028809f , 0.964202f ,
--0.460938f , 0.117187f , 0.703125f , 0.133824f , 0.598590f , 0.789758f ,
-0.375000f , 0.085937f , 0.726562f , 0.183325f , 0.552324f , 0.813196f ,
-0.375000f , 0.062500f , 0.742188f , 0.249458f , -0.171087f , 0.953124f ,
-0.460938f , 0.117187f , 0.703125f , -0.133824f , 0.598590f , 0.789758f ,
--0.375000f , 0.085937f , 0.726562f , -0.183325f , 0.552324f , 0.813196f ,
--0.460938f , 0.117187f , 0.703125f , 0.133824f , 0.598590f , 0.789758f ,
--0.375000f , 0.062500f , 0.742188f , -0.249458f , -0.171087f , 0.953124f ,
-0.242188f , 0.125000f , 0.757812f , 0.419660f , 0.600818f , 0.680319f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
-0.375000f , 0.085937f , 0.726562f , 0.183325f , 0.552324f , 0.813196f ,
--0.242188f , 0.125000f , 0.757812f , -0.419660f , 0.600818f , 0.680319f ,
--0.375000f , 0.085937f , 0.726562f , -0.183325f , 0.552324f , 0.813196f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
-0.226562f , 0.109375f , 0.781250f , -0.030885f , -0.186071f , 0.982025f ,
-0.242188f , 0.125000f , 0.757812f , 0.419660f , 0.600818f , 0.680319f ,
-0.203125f , 0.171875f , 0.750000f , 0.692007f , 0.295755f , 0.658498f ,
--0.226562f , 0.109375f , 0.781250f , 0.030885f , -0.186071f , 0.982025f ,
--0.187500f , 0.156250f , 0.773438f , 0.044038f , 0.005310f , 0.998993f ,
--0.203125f , 0.171875f , 0.750000f , -0.692007f , 0.295755f , 0.658498f ,
-0.179688f , 0.296875f , 0.781250f , 0.255715f , -0.137944f , 0.956847f ,
-0.195312f , 0.296875f , 0.757812f , 0.793847f , -0.286508f , 0.536363f ,
-0.234375f , 0.359375f , 0.757812f , 0.500839f , -0.444319f , 0.742759f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
--0.210938f , 0.375000f , 0.781250f , -0.175176f , -0.091525f , 0.980255f ,
--0.234375f , 0.359375f , 0.757812f , -0.500839f , -0.444319f , 0.742759f ,
-0.171875f , 0.218750f , 0.781250f , 0.118717f , -0.055208f , 0.991363f ,
-0.195312f , 0.226562f , 0.750000f , 0.798669f , 0.019379f , 0.601428f ,
-0.195312f , 0.296875f , 0.757812f , 0.793847f , -0.286508f , 0.536363f ,
--0.171875f , 0.218750f , 0.781250f , -0.118717f , -0.055208f , 0.991363f ,
--0.179688f , 0.296875f , 0.781250f , -0.255715f , -0.137944f , 0.956847f ,
--0.195312f , 0.296875f , 0.757812f , -0.793847f , -0.286508f , 0.536363f ,
-0.187500f , 0.156250f , 0.773438f , -0.044038f , 0.005310f , 0.998993f ,
-0.203125f , 0.171875f , 0.750000f , 0.692007f , 0.295755f , 0.658498f ,
-0.195312f , 0.226562f , 0.750000f , 0.798669f , 0.019379f , 0.601428f ,
--0.187500f , 0.156250f , 0.773438f , 0.044038f , 0.005310f , 0.998993f ,
--0.171875f , 0.218750f , 0.781250f , -0.118717f , -0.055208f , 0.991363f ,
--0.195312f , 0.226562f , 0.750000f , -0.798669f , 0.019379f , 0.601428f ,
-0.062500f , 0.492187f , 0.750000f , -0.810816f , 0.562304f , 0.162267f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
-0.000000f , 0.406250f , 0.601562f , 0.000000f , 0.886868f , 0.461959f ,
--0.062500f , 0.492187f , 0.750000f , 0.810816f , 0.562304f , 0.162267f ,
-0.000000f , 0.429687f , 0.742188f , 0.000000f , 0.934080f , 0.357006f ,
-0.000000f , 0.406250f , 0.601562f , 0.000000f , 0.886868f , 0.461959f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.195312f , 0.664062f , 0.617188f , -0.470138f , 0.525224f , -0.709250f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
--0.062500f , 0.492187f , 0.750000f , 0.810816f , 0.562304f , 0.162267f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
-0.195312f , 0.664062f , 0.617188f , -0.470138f , 0.525224f , -0.709250f ,
-0.156250f , 0.718750f , 0.757813f , -0.595233f , 0.779077f , 0.196753f ,
-0.335938f , 0.687500f , 0.593750f , 0.112644f , 0.654836f , -0.747276f ,
--0.195312f , 0.664062f , 0.617188f , 0.470138f , 0.525224f , -0.709250f ,
--0.335938f , 0.687500f , 0.593750f , -0.112644f , 0.654836f , -0.747276f ,
--0.156250f , 0.718750f , 0.757813f , 0.595233f , 0.779077f , 0.196753f ,
-0.335938f , 0.687500f , 0.593750f , 0.112644f , 0.654836f , -0.747276f ,
-0.320312f , 0.757812f , 0.734375f , 0.218940f , 0.961943f , 0.163274f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
--0.335938f , 0.687500f , 0.593750f , -0.112644f , 0.654836f , -0.747276f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
--0.320312f , 0.757812f , 0.734375f , -0.218940f , 0.961943f , 0.163274f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
-0.492188f , 0.601562f , 0.687500f , 0.602344f , 0.781274f , 0.163610f ,
-0.679688f , 0.453125f , 0.492188f , 0.362590f , 0.911954f , -0.191870f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
--0.679688f , 0.453125f , 0.492188f , -0.362590f , 0.911954f , -0.191870f ,
--0.492188f , 0.601562f , 0.687500f , -0.602344f , 0.781274f , 0.163610f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.796875f , 0.406250f , 0.460938f , 0.739097f , 0.606952f , -0.292032f ,
-0.679688f , 0.453125f , 0.492188f , 0.362590f , 0.911954f , -0.191870f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
--0.710938f , 0.484375f , 0.625000f , -0.434889f , 0.886593f , 0.157414f ,
--0.679688f , 0.453125f , 0.492188f , -0.362590f , 0.911954f , -0.191870f ,
-0.796875f , 0.406250f , 0.460938f , 0.739097f , 0.606952f , -0.292032f ,
-0.859375f , 0.429687f , 0.593750f , 0.883724f , 0.392834f , 0.254280f ,
-0.773438f , 0.164062f , 0.375000f , 0.856471f , -0.470870f , -0.211341f ,
--0.796875f , 0.406250f , 0.460938f , -0.739097f , 0.606952f , -0.292032f ,
--0.773438f , 0.164062f , 0.375000f , -0.856471f , -0.470870f , -0.211341f ,
--0.859375f , 0.429687f , 0.593750f , -0.883724f , 0.392834f , 0.254280f ,
-0.632812f , -0.039063f , 0.539062f , 0.581133f , -0.781213f , 0.227912f ,
-0.601562f , -0.000000f , 0.414062f , 0.626057f , -0.778191f , -0.049348f ,
-0.773438f , 0.164062f , 0.375000f , 0.856471f , -0.470870f , -0.211341f ,
--0.632812f , -0.039063f , 0.539062f , -0.581133f , -0.781213f , 0.227912f ,
--0.828125f , 0.148437f , 0.445312f , -0.911802f , -0.386059f , -0.139866f ,
--0.773438f , 0.164062f , 0.375000f , -0.856471f , -0.470870f , -0.211341f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
-0.601562f , -0.000000f , 0.414062f , 0.626057f , -0.778191f , -0.049348f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
--0.632812f , -0.039063f , 0.539062f , -0.581133f , -0.781213f , 0.227912f ,
--0.601562f , -0.000000f , 0.414062f , -0.626057f , -0.778191f , -0.049348f ,
-0.125000f , -0.539062f , 0.359375f , 0.408521f , -0.291971f , -0.864772f ,
-0.000000f , -0.570312f , 0.320312f , 0.000000f , -0.326731f , -0.945097f ,
-0.179688f , -0.414062f , 0.257812f , 0.609485f , -0.776421f , -0.160131f ,
--0.125000f , -0.539062f , 0.359375f , -0.408521f , -0.291971f , -0.864772f ,
--0.179688f , -0.414062f , 0.257812f , -0.609485f , -0.776421f , -0.160131f ,
-0.000000f , -0.570312f , 0.320312f , 0.000000f , -0.326731f , -0.945097f ,
-0.140625f , -0.757812f , 0.367187f , 0.172246f , -0.199896f , -0.964538f ,
-0.000000f , -0.804688f , 0.343750f , 0.000000f , -0.356853f , -0.934141f ,
-0.125000f , -0.539062f , 0.359375f , 0.408521f , -0.291971f , -0.864772f ,
--0.140625f , -0.757812f , 0.367187f , -0.172246f , -0.199896f , -0.964538f ,
--0.125000f , -0.539062f , 0.359375f , -0.408521f , -0.291971f , -0.864772f ,
-0.000000f , -0.804688f , 0.343750f , 0.000000f , -0.356853f , -0.934141f ,
-0.164062f , -0.945312f , 0.437500f , 0.039674f , -0.749474f , -0.660787f ,
-0.000000f , -0.976562f , 0.460937f , 0.000000f , -0.867061f , -0.498154f ,
-0.140625f , -0.757812f , 0.367187f , 0.172246f , -0.199896f , -0.964538f ,
--0.164062f , -0.945312f , 0.437500f , -0.039674f , -0.749474f , -0.660787f ,
--0.140625f , -0.757812f , 0.367187f , -0.172246f , -0.199896f , -0.964538f ,
-0.000000f , -0.976562f , 0.460937f , 0.000000f , -0.867061f , -0.498154f ,
-0.000000f , -0.984375f , 0.578125f , 0.000000f , -0.971221f , 0.238075f ,
-0.000000f , -0.976562f , 0.460937f , 0.000000f , -0.867061f , -0.498154f ,
-0.164062f , -0.945312f , 0.437500f , 0.039674f , -0.749474f , -0.660787f ,
-0.000000f , -0.984375f , 0.578125f , 0.000000f , -0.971221f , 0.238075f ,
--0.179688f , -0.968750f , 0.554687f , -0.147160f , -0.978057f , 0.147404f ,
--0.164062f , -0.945312f , 0.437500f , -0.039674f , -0.749474f , -0.660787f ,
-0.179688f , -0.968750f , 0.554687f , 0.147160f , -0.978057f , 0.147404f ,
-0.164062f , -0.945312f , 0.437500f , 0.039674f , -0.749474f , -0.660787f ,
-0.328125f , -0.914062f , 0.398437f , 0.630482f , -0.407788f , -0.660421f ,
--0.179688f , -0.968750f , 0.554687f , -0.147160f , -0.978057f , 0.147404f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
--0.328125f , -0.914062f , 0.398437f , -0.630482f , -0.407788f , -0.660421f ,
-0.328125f , -0.945312f , 0.523437f , 0.623890f , -0.777184f , 0.081668f ,
-0.328125f , -0.914062f , 0.398437f , 0.630482f , -0.407788f , -0.660421f ,
-0.289062f , -0.710938f , 0.382812f , 0.613178f , 0.041017f , -0.788842f ,
--0.328125f , -0.945312f , 0.523437f , -0.623890f , -0.777184f , 0.081668f ,
--0.367188f , -0.890625f , 0.531250f , -0.938444f , -0.345103f , 0.014252f ,
--0.289062f , -0.710938f , 0.382812f , -0.613178f , 0.041017f , -0.788842f ,
-0.367188f , -0.890625f , 0.531250f , 0.938444f , -0.345103f , 0.014252f ,
-0.289062f , -0.710938f , 0.382812f , 0.613178f , 0.041017f , -0.788842f ,
-0.250000f , -0.500000f , 0.390625f , 0.624897f , 0.122379f , -0.771020f ,
--0.367188f , -0.890625f , 0.531250f , -0.938444f , -0.345103f , 0.014252f ,
--0.351562f , -0.695312f , 0.570312f , -0.978179f , 0.080081f , 0.191687f ,
--0.250000f , -0.500000f , 0.390625f , -0.624897f , 0.122379f , -0.771020f ,
-0.140625f , -0.757812f , 0.367187f , 0.172246f , -0.199896f , -0.964538f ,
-0.125000f , -0.539062f , 0.359375f , 0.408521f , -0.291971f , -0.864772f ,
-0.250000f , -0.500000f , 0.390625f , 0.624897f , 0.122379f , -0.771020f ,
--0.140625f , -0.757812f , 0.367187f , -0.172246f , -0.199896f , -0.964538f ,
--0.289062f , -0.710938f , 0.382812f , -0.613178f , 0.041017f , -0.788842f ,
--0.250000f , -0.500000f , 0.390625f , -0.624897f , 0.122379f , -0.771020f ,
-0.140625f , -0.757812f , 0.367187f , 0.172246f , -0.199896f , -0.964538f ,
-0.289062f , -0.710938f , 0.382812f , 0.613178f , 0.041017f , -0.788842f ,
-0.164062f , -0.945312f , 0.437500f , 0.039674f , -0.749474f , -0.660787f ,
--0.140625f , -0.757812f , 0.367187f , -0.172246f , -0.199896f , -0.964538f ,
--0.164062f , -0.945312f , 0.437500f , -0.039674f , -0.749474f , -0.660787f ,
--0.289062f , -0.710938f , 0.382812f , -0.613178f , 0.041017f , -0.788842f ,
-0.179688f , -0.414062f , 0.257812f , 0.609485f , -0.776421f , -0.160131f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
-0.125000f , -0.539062f , 0.359375f , 0.408521f , -0.291971f , -0.864772f ,
--0.179688f , -0.414062f , 0.257812f , -0.609485f , -0.776421f , -0.160131f ,
--0.125000f , -0.539062f , 0.359375f , -0.408521f , -0.291971f , -0.864772f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
-0.351562f , -0.695312f , 0.570312f , 0.978179f , 0.080081f , 0.191687f ,
-0.250000f , -0.500000f , 0.390625f , 0.624897f , 0.122379f , -0.771020f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
--0.351562f , -0.695312f , 0.570312f , -0.978179f , 0.080081f , 0.191687f ,
--0.312500f , -0.437500f , 0.570312f , -0.963622f , 0.232734f , 0.131199f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
-0.234375f , -0.250000f , 0.554688f , 0.928922f , 0.361003f , 0.082034f ,
-0.257812f , -0.312500f , 0.554688f , 0.922819f , 0.371471f , 0.101871f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
--0.234375f , -0.250000f , 0.554688f , -0.928922f , 0.361003f , 0.082034f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.257812f , -0.312500f , 0.554688f , -0.922819f , 0.371471f , 0.101871f ,
-0.257812f , -0.312500f , 0.554688f , 0.922819f , 0.371471f , 0.101871f ,
-0.312500f , -0.437500f , 0.570312f , 0.963622f , 0.232734f , 0.131199f ,
-0.218750f , -0.281250f , 0.429688f , 0.998230f , 0.018311f , 0.056459f ,
--0.257812f , -0.312500f , 0.554688f , -0.922819f , 0.371471f , 0.101871f ,
--0.218750f , -0.281250f , 0.429688f , -0.998230f , 0.018311f , 0.056459f ,
--0.312500f , -0.437500f , 0.570312f , -0.963622f , 0.232734f , 0.131199f ,
-0.203125f , -0.171875f , 0.500000f , 0.752586f , -0.591113f , 0.290109f ,
-0.203125f , -0.187500f , 0.562500f , 0.936064f , -0.336802f , 0.101566f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
--0.203125f , -0.171875f , 0.500000f , -0.752586f , -0.591113f , 0.290109f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.203125f , -0.187500f , 0.562500f , -0.936064f , -0.336802f , 0.101566f ,
-0.437500f , -0.140625f , 0.531250f , 0.338298f , -0.940672f , -0.025025f ,
-0.203125f , -0.187500f , 0.562500f , 0.936064f , -0.336802f , 0.101566f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
--0.437500f , -0.140625f , 0.531250f , -0.338298f , -0.940672f , -0.025025f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
--0.203125f , -0.187500f , 0.562500f , -0.936064f , -0.336802f , 0.101566f ,
-0.000000f , -0.195312f , -0.671875f , 0.000000f , -0.695578f , -0.718406f ,
-0.000000f , 0.070313f , -0.828125f , 0.000000f , -0.264321f , -0.964415f ,
-0.343750f , -0.148437f , -0.539062f , 0.526444f , -0.659352f , -0.536699f ,
-0.000000f , -0.195312f , -0.671875f , 0.000000f , -0.695578f , -0.718406f ,
--0.343750f , -0.148437f , -0.539062f , -0.526444f , -0.659352f , -0.536699f ,
-0.000000f , 0.070313f , -0.828125f , 0.000000f , -0.264321f , -0.964415f ,
-0.000000f , -0.382812f , -0.351563f , 0.000000f , -0.936583f , -0.350383f ,
-0.000000f , -0.195312f , -0.671875f , 0.000000f , -0.695578f , -0.718406f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
-0.000000f , -0.382812f , -0.351563f , 0.000000f , -0.936583f , -0.350383f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
-0.000000f , -0.195312f , -0.671875f , 0.000000f , -0.695578f , -0.718406f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
-0.000000f , -0.460938f , 0.187500f , 0.000000f , -0.981475f , -0.191473f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
-0.000000f , -0.382812f , -0.351563f , 0.000000f , -0.936583f , -0.350383f ,
-0.000000f , -0.460938f , 0.187500f , 0.000000f , -0.981475f , -0.191473f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
-0.179688f , -0.414062f , 0.257812f , 0.609485f , -0.776421f , -0.160131f ,
-0.000000f , -0.484375f , 0.281250f , 0.000000f , -0.710898f , -0.703269f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
-0.000000f , -0.460938f , 0.187500f , 0.000000f , -0.981475f , -0.191473f ,
-0.000000f , -0.484375f , 0.281250f , 0.000000f , -0.710898f , -0.703269f ,
-0.218750f , -0.281250f , 0.429688f , 0.998230f , 0.018311f , 0.056459f ,
-0.234375f , -0.351563f , 0.406250f , 0.943876f , 0.105594f , -0.312906f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
--0.218750f , -0.281250f , 0.429688f , -0.998230f , 0.018311f , 0.056459f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
--0.234375f , -0.351563f , 0.406250f , -0.943876f , 0.105594f , -0.312906f ,
-0.601562f , -0.000000f , 0.414062f , 0.626057f , -0.778191f , -0.049348f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.851562f , 0.234375f , 0.054688f , 0.985504f , -0.161412f , 0.052156f ,
--0.601562f , -0.000000f , 0.414062f , -0.626057f , -0.778191f , -0.049348f ,
--0.773438f , 0.164062f , 0.375000f , -0.856471f , -0.470870f , -0.211341f ,
--0.851562f , 0.234375f , 0.054688f , -0.985504f , -0.161412f , 0.052156f ,
-0.000000f , 0.070313f , -0.828125f , 0.000000f , -0.264321f , -0.964415f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
-0.335938f , 0.054688f , -0.664062f , 0.440352f , -0.320841f , -0.838496f ,
-0.000000f , 0.070313f , -0.828125f , 0.000000f , -0.264321f , -0.964415f ,
--0.335938f , 0.054688f , -0.664062f , -0.440352f , -0.320841f , -0.838496f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
-0.000000f , 0.984375f , -0.078125f , 0.000000f , 0.999756f , 0.021729f ,
-0.000000f , 0.898438f , 0.289063f , 0.000000f , 0.847743f , 0.530381f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
-0.000000f , 0.984375f , -0.078125f , 0.000000f , 0.999756f , 0.021729f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
-0.000000f , 0.898438f , 0.289063f , 0.000000f , 0.847743f , 0.530381f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
-0.453125f , 0.867188f , -0.382812f , 0.426527f , 0.799676f , -0.422498f ,
-0.000000f , 0.898438f , -0.546875f , 0.000000f , 0.846492f , -0.532365f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
-0.000000f , 0.984375f , -0.078125f , 0.000000f , 0.999756f , 0.021729f ,
-0.000000f , 0.898438f , -0.546875f , 0.000000f , 0.846492f , -0.532365f ,
-0.453125f , 0.867188f , -0.382812f , 0.426527f , 0.799676f , -0.422498f ,
-0.460938f , 0.437500f , -0.703125f , 0.512650f , 0.168615f , -0.841853f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
--0.453125f , 0.867188f , -0.382812f , -0.426527f , 0.799676f , -0.422498f ,
-0.000000f , 0.898438f , -0.546875f , 0.000000f , 0.846492f , -0.532365f ,
-0.000000f , 0.562500f , -0.851562f , 0.000000f , 0.314829f , -0.949126f ,
-0.796875f , 0.406250f , 0.460938f , 0.739097f , 0.606952f , -0.292032f ,
-0.726562f , 0.406250f , 0.335938f , 0.624470f , 0.780328f , -0.033204f ,
-0.632812f , 0.453125f , 0.281250f , 0.354289f , 0.818659f , 0.451918f ,
--0.796875f , 0.406250f , 0.460938f , -0.739097f , 0.606952f , -0.292032f ,
--0.679688f , 0.453125f , 0.492188f , -0.362590f , 0.911954f , -0.191870f ,
--0.632812f , 0.453125f , 0.281250f , -0.354289f , 0.818659f , 0.451918f ,
-0.726562f , 0.406250f , 0.335938f , 0.624470f , 0.780328f , -0.033204f ,
-0.796875f , 0.562500f , 0.125000f , 0.790765f , 0.485611f , 0.372570f ,
-0.640625f , 0.703125f , 0.054688f , 0.655019f , 0.685110f , 0.318613f ,
--0.726562f , 0.406250f , 0.335938f , -0.624470f , 0.780328f , -0.033204f ,
--0.632812f , 0.453125f , 0.281250f , -0.354289f , 0.818659f , 0.451918f ,
--0.640625f , 0.703125f , 0.054688f , -0.655019f , 0.685110f , 0.318613f ,
-0.796875f , 0.562500f , 0.125000f , 0.790765f , 0.485611f , 0.372570f ,
-0.796875f , 0.617188f , -0.117187f , 0.867824f , 0.496811f , 0.002960f ,
-0.640625f , 0.750000f , -0.195312f , 0.659536f , 0.748070f , -0.073275f ,
--0.796875f , 0.562500f , 0.125000f , -0.790765f , 0.485611f , 0.372570f ,
--0.640625f , 0.703125f , 0.054688f , -0.655019f , 0.685110f , 0.318613f ,
--0.640625f , 0.750000f , -0.195312f , -0.659536f , 0.748070f , -0.073275f ,
-0.796875f , 0.617188f , -0.117187f , 0.867824f , 0.496811f , 0.002960f ,
-0.796875f , 0.539062f , -0.359375f , 0.893521f , 0.254524f , -0.369823f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
--0.796875f , 0.617188f , -0.117187f , -0.867824f , 0.496811f , 0.002960f ,
--0.640625f , 0.750000f , -0.195312f , -0.659536f , 0.748070f , -0.073275f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
-0.796875f , 0.539062f , -0.359375f , 0.893521f , 0.254524f , -0.369823f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
--0.796875f , 0.539062f , -0.359375f , -0.893521f , 0.254524f , -0.369823f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.453125f , 0.867188f , -0.382812f , 0.426527f , 0.799676f , -0.422498f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
-0.617188f , 0.328125f , -0.585938f , 0.609943f , -0.022065f , -0.792108f ,
--0.453125f , 0.867188f , -0.382812f , -0.426527f , 0.799676f , -0.422498f ,
--0.460938f , 0.437500f , -0.703125f , -0.512650f , 0.168615f , -0.841853f ,
--0.617188f , 0.328125f , -0.585938f , -0.609943f , -0.022065f , -0.792108f ,
-0.453125f , 0.929688f , -0.070312f , 0.428785f , 0.902493f , 0.039796f ,
-0.640625f , 0.750000f , -0.195312f , 0.659536f , 0.748070f , -0.073275f ,
-0.640625f , 0.679688f , -0.445312f , 0.498611f , 0.550218f , -0.669790f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
--0.453125f , 0.867188f , -0.382812f , -0.426527f , 0.799676f , -0.422498f ,
--0.640625f , 0.679688f , -0.445312f , -0.498611f , 0.550218f , -0.669790f ,
-0.453125f , 0.851562f , 0.234375f , 0.479781f , 0.718162f , 0.504013f ,
-0.640625f , 0.703125f , 0.054688f , 0.655019f , 0.685110f , 0.318613f ,
-0.640625f , 0.750000f , -0.195312f , 0.659536f , 0.748070f , -0.073275f ,
--0.453125f , 0.851562f , 0.234375f , -0.479781f , 0.718162f , 0.504013f ,
--0.453125f , 0.929688f , -0.070312f , -0.428785f , 0.902493f , 0.039796f ,
--0.640625f , 0.750000f , -0.195312f , -0.659536f , 0.748070f , -0.073275f ,
-0.460938f , 0.523438f , 0.429688f , 0.364483f , 0.902860f , 0.227973f ,
-0.632812f , 0.453125f , 0.281250f , 0.354289f , 0.818659f , 0.451918f ,
-0.640625f , 0.703125f , 0.054688f , 0.655019f , 0.685110f , 0.318613f ,
--0.460938f , 0.523438f , 0.429688f , -0.364483f , 0.902860f , 0.227973f ,
--0.453125f , 0.851562f , 0.234375f , -0.479781f , 0.718162f , 0.504013f ,
--0.640625f , 0.703125f , 0.054688f , -0.655019f , 0.685110f , 0.318613f ,
-0.460938f , 0.523438f , 0.429688f , 0.364483f , 0.902860f , 0.227973f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
-0.632812f , 0.453125f , 0.281250f , 0.354289f , 0.818659f , 0.451918f ,
--0.460938f , 0.523438f , 0.429688f , -0.364483f , 0.902860f , 0.227973f ,
--0.632812f , 0.453125f , 0.281250f , -0.354289f , 0.818659f , 0.451918f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
-0.000000f , 0.898438f , 0.289063f , 0.000000f , 0.847743f , 0.530381f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.453125f , 0.851562f , 0.234375f , 0.479781f , 0.718162f , 0.504013f ,
-0.000000f , 0.898438f , 0.289063f , 0.000000f , 0.847743f , 0.530381f ,
--0.453125f , 0.851562f , 0.234375f , -0.479781f , 0.718162f , 0.504013f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
-0.109375f , 0.460937f , 0.609375f , -0.563402f , 0.765130f , 0.311624f ,
-0.335938f , 0.687500f , 0.593750f , 0.112644f , 0.654836f , -0.747276f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
--0.335938f , 0.687500f , 0.593750f , -0.112644f , 0.654836f , -0.747276f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
-0.484375f , 0.554688f , 0.554688f , 0.275338f , 0.887692f , -0.368938f ,
-0.460938f , 0.523438f , 0.429688f , 0.364483f , 0.902860f , 0.227973f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
--0.484375f , 0.554688f , 0.554688f , -0.275338f , 0.887692f , -0.368938f ,
--0.109375f , 0.460937f , 0.609375f , 0.563402f , 0.765130f , 0.311624f ,
-0.000000f , 0.570312f , 0.570312f , 0.000000f , 0.517228f , 0.855800f ,
-0.726562f , 0.406250f , 0.335938f , 0.624470f , 0.780328f , -0.033204f ,
-0.796875f , 0.406250f , 0.460938f , 0.739097f , 0.606952f , -0.292032f ,
-0.851562f , 0.234375f , 0.054688f , 0.985504f , -0.161412f , 0.052156f ,
--0.726562f , 0.406250f , 0.335938f , -0.624470f , 0.780328f , -0.033204f ,
--0.851562f , 0.234375f , 0.054688f , -0.985504f , -0.161412f , 0.052156f ,
--0.796875f , 0.406250f , 0.460938f , -0.739097f , 0.606952f , -0.292032f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.796875f , 0.562500f , 0.125000f , 0.790765f , 0.485611f , 0.372570f ,
-0.726562f , 0.406250f , 0.335938f , 0.624470f , 0.780328f , -0.033204f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
--0.851562f , 0.234375f , 0.054688f , -0.985504f , -0.161412f , 0.052156f ,
--0.726562f , 0.406250f , 0.335938f , -0.624470f , 0.780328f , -0.033204f ,
-0.820312f , 0.328125f , -0.203125f , 0.835170f , 0.529893f , 0.147160f ,
-0.796875f , 0.617188f , -0.117187f , 0.867824f , 0.496811f , 0.002960f ,
-0.796875f , 0.562500f , 0.125000f , 0.790765f , 0.485611f , 0.372570f ,
--0.820312f , 0.328125f , -0.203125f , -0.835170f , 0.529893f , 0.147160f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
--0.796875f , 0.562500f , 0.125000f , -0.790765f , 0.485611f , 0.372570f ,
-0.820312f , 0.328125f , -0.203125f , 0.835170f , 0.529893f , 0.147160f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.796875f , 0.617188f , -0.117187f , 0.867824f , 0.496811f , 0.002960f ,
--0.820312f , 0.328125f , -0.203125f , -0.835170f , 0.529893f , 0.147160f ,
--0.796875f , 0.617188f , -0.117187f , -0.867824f , 0.496811f , 0.002960f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.406250f , -0.171875f , 0.148437f , 0.567309f , -0.808283f , 0.157537f ,
-0.210938f , -0.390625f , 0.164062f , 0.574694f , -0.818323f , 0.000885f ,
-0.429688f , -0.195312f , -0.210938f , 0.596820f , -0.785852f , -0.161840f ,
--0.406250f , -0.171875f , 0.148437f , -0.567309f , -0.808283f , 0.157537f ,
--0.429688f , -0.195312f , -0.210938f , -0.596820f , -0.785852f , -0.161840f ,
--0.210938f , -0.390625f , 0.164062f , -0.574694f , -0.818323f , 0.000885f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.429688f , -0.195312f , -0.210938f , 0.596820f , -0.785852f , -0.161840f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
--0.429688f , -0.195312f , -0.210938f , -0.596820f , -0.785852f , -0.161840f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
-0.437500f , -0.093750f , 0.468750f , 0.367626f , -0.909513f , -0.193915f ,
-0.406250f , -0.171875f , 0.148437f , 0.567309f , -0.808283f , 0.157537f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
--0.601562f , -0.000000f , 0.414062f , -0.626057f , -0.778191f , -0.049348f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
-0.210938f , -0.226563f , 0.468750f , 0.956206f , -0.136235f , 0.258950f ,
-0.218750f , -0.281250f , 0.429688f , 0.998230f , 0.018311f , 0.056459f ,
-0.406250f , -0.171875f , 0.148437f , 0.567309f , -0.808283f , 0.157537f ,
--0.210938f , -0.226563f , 0.468750f , -0.956206f , -0.136235f , 0.258950f ,
--0.437500f , -0.093750f , 0.468750f , -0.367626f , -0.909513f , -0.193915f ,
--0.406250f , -0.171875f , 0.148437f , -0.567309f , -0.808283f , 0.157537f ,
-0.617188f , 0.328125f , -0.585938f , 0.609943f , -0.022065f , -0.792108f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.617188f , 0.328125f , -0.585938f , -0.609943f , -0.022065f , -0.792108f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.335938f , 0.054688f , -0.664062f , 0.440352f , -0.320841f , -0.838496f ,
-0.460938f , 0.437500f , -0.703125f , 0.512650f , 0.168615f , -0.841853f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.335938f , 0.054688f , -0.664062f , -0.440352f , -0.320841f , -0.838496f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.460938f , 0.437500f , -0.703125f , -0.512650f , 0.168615f , -0.841853f ,
-0.640625f , -0.007812f , -0.429688f , 0.281991f , -0.651753f , -0.704001f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.640625f , -0.007812f , -0.429688f , -0.281991f , -0.651753f , -0.704001f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
-0.429688f , -0.195312f , -0.210938f , 0.596820f , -0.785852f , -0.161840f ,
-0.296875f , -0.312500f , -0.265625f , 0.501724f , -0.833308f , -0.232002f ,
-0.484375f , 0.023438f , -0.546875f , 0.542100f , -0.499283f , -0.675863f ,
--0.429688f , -0.195312f , -0.210938f , -0.596820f , -0.785852f , -0.161840f ,
--0.484375f , 0.023438f , -0.546875f , -0.542100f , -0.499283f , -0.675863f ,
--0.296875f , -0.312500f , -0.265625f , -0.501724f , -0.833308f , -0.232002f ,
-1.015625f , 0.414062f , -0.289062f , 0.571978f , -0.114872f , 0.812159f ,
-1.023438f , 0.476562f , -0.312500f , -0.037965f , 0.887082f , 0.460036f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
--1.015625f , 0.414062f , -0.289062f , -0.571978f , -0.114872f , 0.812159f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
--1.023438f , 0.476562f , -0.312500f , 0.037965f , 0.887082f , 0.460036f ,
-1.015625f , 0.414062f , -0.289062f , 0.571978f , -0.114872f , 0.812159f ,
-1.187500f , 0.437500f , -0.390625f , 0.391095f , -0.121403f , 0.912290f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
--1.015625f , 0.414062f , -0.289062f , -0.571978f , -0.114872f , 0.812159f ,
--1.023438f , 0.476562f , -0.312500f , 0.037965f , 0.887082f , 0.460036f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
-1.351562f , 0.320313f , -0.421875f , 0.762596f , 0.175115f , 0.622700f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
-1.265625f , 0.289063f , -0.406250f , -0.154607f , -0.077700f , 0.984893f ,
--1.351562f , 0.320313f , -0.421875f , -0.762596f , 0.175115f , 0.622700f ,
--1.265625f , 0.289063f , -0.406250f , 0.154607f , -0.077700f , 0.984893f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
-1.281250f , 0.054688f , -0.429688f , 0.680380f , -0.426405f , 0.595996f ,
-1.351562f , 0.320313f , -0.421875f , 0.762596f , 0.175115f , 0.622700f ,
-1.210938f , 0.078125f , -0.406250f , -0.045839f , 0.361248f , 0.931333f ,
--1.281250f , 0.054688f , -0.429688f , -0.680380f , -0.426405f , 0.595996f ,
--1.210938f , 0.078125f , -0.406250f , 0.045839f , 0.361248f , 0.931333f ,
--1.351562f , 0.320313f , -0.421875f , -0.762596f , 0.175115f , 0.622700f ,
-1.039062f , -0.101562f , -0.328125f , 0.461257f , -0.798151f , 0.387494f ,
-1.281250f , 0.054688f , -0.429688f , 0.680380f , -0.426405f , 0.595996f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
--1.039062f , -0.101562f , -0.328125f , -0.461257f , -0.798151f , 0.387494f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
--1.281250f , 0.054688f , -0.429688f , -0.680380f , -0.426405f , 0.595996f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
-0.828125f , -0.070312f , -0.132812f , 0.355480f , 0.228431f , 0.906308f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
--1.039062f , -0.101562f , -0.328125f , -0.461257f , -0.798151f , 0.387494f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
-0.828125f , -0.070312f , -0.132812f , 0.355480f , 0.228431f , 0.906308f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
--0.828125f , -0.070312f , -0.132812f , -0.355480f , 0.228431f , 0.906308f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
-1.039062f , 0.000000f , -0.367188f , -0.208777f , 0.953673f , 0.216468f ,
-1.031250f , -0.039062f , -0.304688f , 0.499130f , 0.288949f , 0.816919f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
--1.210938f , 0.078125f , -0.406250f , 0.045839f , 0.361248f , 0.931333f ,
--1.031250f , -0.039062f , -0.304688f , -0.499130f , 0.288949f , 0.816919f ,
-1.210938f , 0.078125f , -0.406250f , -0.045839f , 0.361248f , 0.931333f ,
-1.265625f , 0.289063f , -0.406250f , -0.154607f , -0.077700f , 0.984893f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
--1.210938f , 0.078125f , -0.406250f , 0.045839f , 0.361248f , 0.931333f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
--1.265625f , 0.289063f , -0.406250f , 0.154607f , -0.077700f , 0.984893f ,
-1.265625f , 0.289063f , -0.406250f , -0.154607f , -0.077700f , 0.984893f ,
-1.187500f , 0.437500f , -0.390625f , 0.391095f , -0.121403f , 0.912290f ,
-1.234375f , 0.250000f , -0.445312f , -0.993072f , -0.055208f , 0.103519f ,
--1.265625f , 0.289063f , -0.406250f , 0.154607f , -0.077700f , 0.984893f ,
--1.234375f , 0.250000f , -0.445312f , 0.993072f , -0.055208f , 0.103519f ,
--1.187500f , 0.437500f , -0.390625f , -0.391095f , -0.121403f , 0.912290f ,
-1.187500f , 0.437500f , -0.390625f , 0.391095f , -0.121403f , 0.912290f ,
-1.015625f , 0.414062f , -0.289062f , 0.571978f , -0.114872f , 0.812159f ,
-1.171875f , 0.359375f , -0.437500f , -0.127598f , -0.758476f , 0.639058f ,
--1.187500f , 0.437500f , -0.390625f , -0.391095f , -0.121403f , 0.912290f ,
--1.171875f , 0.359375f , -0.437500f , 0.127598f , -0.758476f , 0.639058f ,
--1.015625f , 0.414062f , -0.289062f , -0.571978f , -0.114872f , 0.812159f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
-0.945312f , 0.304688f , -0.289062f , 0.727409f , -0.512742f , 0.456008f ,
-1.023438f , 0.343750f , -0.359375f , 0.558458f , -0.654469f , 0.509629f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
--1.015625f , 0.414062f , -0.289062f , -0.571978f , -0.114872f , 0.812159f ,
--1.023438f , 0.343750f , -0.359375f , -0.558458f , -0.654469f , 0.509629f ,
-0.726562f , 0.000000f , -0.070312f , 0.971038f , -0.203528f , -0.125004f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
--0.726562f , 0.000000f , -0.070312f , -0.971038f , -0.203528f , -0.125004f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
-0.593750f , -0.125000f , -0.164062f , 0.333506f , -0.938871f , -0.085238f ,
-0.828125f , -0.070312f , -0.132812f , 0.355480f , 0.228431f , 0.906308f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
--0.828125f , -0.070312f , -0.132812f , -0.355480f , 0.228431f , 0.906308f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
-0.734375f , -0.046875f , 0.070312f , 0.750359f , -0.650197f , 0.119053f ,
-0.726562f , 0.000000f , -0.070312f , 0.971038f , -0.203528f , -0.125004f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
--0.734375f , -0.046875f , 0.070312f , -0.750359f , -0.650197f , 0.119053f ,
--0.851562f , 0.234375f , 0.054688f , -0.985504f , -0.161412f , 0.052156f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
--0.820312f , 0.328125f , -0.203125f , -0.835170f , 0.529893f , 0.147160f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
-0.812500f , -0.015625f , -0.273438f , 0.804621f , 0.430494f , 0.408918f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
--0.828125f , -0.070312f , -0.132812f , -0.355480f , 0.228431f , 0.906308f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
-0.812500f , -0.015625f , -0.273438f , 0.804621f , 0.430494f , 0.408918f ,
-0.843750f , 0.015625f , -0.273438f , 0.875362f , -0.183599f , 0.447188f ,
-0.718750f , -0.023437f , -0.171875f , 0.734062f , 0.141392f , 0.664174f ,
--0.812500f , -0.015625f , -0.273438f , -0.804621f , 0.430494f , 0.408918f ,
--0.718750f , -0.023437f , -0.171875f , -0.734062f , 0.141392f , 0.664174f ,
--0.843750f , 0.015625f , -0.273438f , -0.875362f , -0.183599f , 0.447188f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
-0.843750f , 0.015625f , -0.273438f , 0.875362f , -0.183599f , 0.447188f ,
-0.820312f , 0.085938f , -0.273438f , 0.570055f , 0.736076f , 0.364940f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.757812f , 0.093750f , -0.273438f , -0.954314f , 0.102573f , 0.280587f ,
--0.820312f , 0.085938f , -0.273438f , -0.570055f , 0.736076f , 0.364940f ,
-0.757812f , 0.093750f , -0.273438f , 0.954314f , 0.102573f , 0.280587f ,
-0.835938f , 0.171875f , -0.273438f , 0.746544f , -0.565935f , 0.349773f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
--0.757812f , 0.093750f , -0.273438f , -0.954314f , 0.102573f , 0.280587f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.835938f , 0.171875f , -0.273438f , -0.746544f , -0.565935f , 0.349773f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
-0.835938f , 0.171875f , -0.273438f , 0.746544f , -0.565935f , 0.349773f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
--0.835938f , 0.171875f , -0.273438f , -0.746544f , -0.565935f , 0.349773f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
-0.945312f , 0.304688f , -0.289062f , 0.727409f , -0.512742f , 0.456008f ,
-0.921875f , 0.359375f , -0.218750f , 0.391888f , -0.023072f , 0.919706f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
--0.945312f , 0.304688f , -0.289062f , -0.727409f , -0.512742f , 0.456008f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
--0.921875f , 0.359375f , -0.218750f , -0.391888f , -0.023072f , 0.919706f ,
-0.820312f , 0.328125f , -0.203125f , 0.835170f , 0.529893f , 0.147160f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.843750f , 0.289062f , -0.210937f , 0.786157f , -0.217750f , 0.578356f ,
--0.820312f , 0.328125f , -0.203125f , -0.835170f , 0.529893f , 0.147160f ,
--0.843750f , 0.289062f , -0.210937f , -0.786157f , -0.217750f , 0.578356f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
-0.796875f , 0.203125f , -0.210937f , 0.853206f , -0.408429f , 0.324259f ,
-0.859375f , 0.320312f , -0.046875f , 0.997925f , 0.040437f , -0.049684f ,
-0.718750f , 0.039063f , -0.187500f , 0.934416f , -0.089084f , 0.344829f ,
--0.796875f , 0.203125f , -0.210937f , -0.853206f , -0.408429f , 0.324259f ,
--0.718750f , 0.039063f , -0.187500f , -0.934416f , -0.089084f , 0.344829f ,
--0.859375f , 0.320312f , -0.046875f , -0.997925f , 0.040437f , -0.049684f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
-0.890625f , 0.234375f , -0.320312f , 0.663869f , -0.467299f , 0.583819f ,
-0.953125f , 0.289063f , -0.343750f , 0.621509f , -0.442213f , 0.646626f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
--0.945312f , 0.304688f , -0.289062f , -0.727409f , -0.512742f , 0.456008f ,
--0.953125f , 0.289063f , -0.343750f , -0.621509f , -0.442213f , 0.646626f ,
-0.890625f , 0.234375f , -0.320312f , 0.663869f , -0.467299f , 0.583819f ,
-0.890625f , 0.242188f , -0.265625f , 0.665517f , -0.560930f , 0.492325f ,
-0.843750f , 0.171875f , -0.320312f , 0.517594f , -0.452284f , 0.726279f ,
--0.890625f , 0.234375f , -0.320312f , -0.663869f , -0.467299f , 0.583819f ,
--0.843750f , 0.171875f , -0.320312f , -0.517594f , -0.452284f , 0.726279f ,
--0.890625f , 0.242188f , -0.265625f , -0.665517f , -0.560930f , 0.492325f ,
-0.757812f , 0.093750f , -0.273438f , 0.954314f , 0.102573f , 0.280587f ,
-0.765625f , 0.093750f , -0.320312f , 0.767510f , 0.233589f , 0.596912f ,
-0.843750f , 0.171875f , -0.320312f , 0.517594f , -0.452284f , 0.726279f ,
--0.757812f , 0.093750f , -0.273438f , -0.954314f , 0.102573f , 0.280587f ,
--0.835938f , 0.171875f , -0.273438f , -0.746544f , -0.565935f , 0.349773f ,
--0.843750f , 0.171875f , -0.320312f , -0.517594f , -0.452284f , 0.726279f ,
-0.765625f , 0.093750f , -0.320312f , 0.767510f , 0.233589f , 0.596912f ,
-0.757812f , 0.093750f , -0.273438f , 0.954314f , 0.102573f , 0.280587f ,
-0.828125f , 0.078125f , -0.320312f , 0.424299f , 0.457137f , 0.781640f ,
--0.765625f , 0.093750f , -0.320312f , -0.767510f , 0.233589f , 0.596912f ,
--0.828125f , 0.078125f , -0.320312f , -0.424299f , 0.457137f , 0.781640f ,
--0.757812f , 0.093750f , -0.273438f , -0.954314f , 0.102573f , 0.280587f ,
-0.828125f , 0.078125f , -0.320312f , 0.424299f , 0.457137f , 0.781640f ,
-0.820312f , 0.085938f , -0.273438f , 0.570055f , 0.736076f , 0.364940f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
--0.828125f , 0.078125f , -0.320312f , -0.424299f , 0.457137f , 0.781640f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
--0.820312f , 0.085938f , -0.273438f , -0.570055f , 0.736076f , 0.364940f ,
-0.812500f , -0.015625f , -0.273438f , 0.804621f , 0.430494f , 0.408918f ,
-0.812500f , -0.015625f , -0.320312f , 0.651234f , 0.269478f , 0.709403f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
--0.812500f , -0.015625f , -0.273438f , -0.804621f , 0.430494f , 0.408918f ,
--0.843750f , 0.015625f , -0.273438f , -0.875362f , -0.183599f , 0.447188f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
-0.882812f , -0.015625f , -0.265625f , -0.047365f , 0.938444f , 0.342112f ,
-0.812500f , -0.015625f , -0.320312f , 0.651234f , 0.269478f , 0.709403f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
--0.812500f , -0.015625f , -0.273438f , -0.804621f , 0.430494f , 0.408918f ,
--0.812500f , -0.015625f , -0.320312f , -0.651234f , 0.269478f , 0.709403f ,
-0.945312f , 0.304688f , -0.289062f , 0.727409f , -0.512742f , 0.456008f ,
-0.953125f , 0.289063f , -0.343750f , 0.621509f , -0.442213f , 0.646626f ,
-1.039062f , 0.328125f , -0.414062f , 0.520493f , -0.249794f , 0.816492f ,
--0.945312f , 0.304688f , -0.289062f , -0.727409f , -0.512742f , 0.456008f ,
--1.023438f , 0.343750f , -0.359375f , -0.558458f , -0.654469f , 0.509629f ,
--1.039062f , 0.328125f , -0.414062f , -0.520493f , -0.249794f , 0.816492f ,
-1.023438f , 0.343750f , -0.359375f , 0.558458f , -0.654469f , 0.509629f ,
-1.039062f , 0.328125f , -0.414062f , 0.520493f , -0.249794f , 0.816492f ,
-1.187500f , 0.343750f , -0.484375f , -0.208350f , -0.539689f , 0.815638f ,
--1.023438f , 0.343750f , -0.359375f , -0.558458f , -0.654469f , 0.509629f ,
--1.171875f , 0.359375f , -0.437500f , 0.127598f , -0.758476f , 0.639058f ,
--1.187500f , 0.343750f , -0.484375f , 0.208350f , -0.539689f , 0.815638f ,
-1.171875f , 0.359375f , -0.437500f , -0.127598f , -0.758476f , 0.639058f ,
-1.187500f , 0.343750f , -0.484375f , -0.208350f , -0.539689f , 0.815638f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
--1.171875f , 0.359375f , -0.437500f , 0.127598f , -0.758476f , 0.639058f ,
--1.234375f , 0.250000f , -0.445312f , 0.993072f , -0.055208f , 0.103519f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
-1.210938f , 0.085938f , -0.484375f , -0.600940f , 0.491745f , 0.630055f ,
-1.187500f , 0.093750f , -0.445312f , -0.809534f , 0.584704f , -0.052431f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
--1.210938f , 0.085938f , -0.484375f , 0.600940f , 0.491745f , 0.630055f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
--1.187500f , 0.093750f , -0.445312f , 0.809534f , 0.584704f , -0.052431f ,
-1.046875f , 0.000000f , -0.421875f , 0.110843f , 0.695120f , 0.710288f ,
-1.039062f , 0.000000f , -0.367188f , -0.208777f , 0.953673f , 0.216468f ,
-1.210938f , 0.085938f , -0.484375f , -0.600940f , 0.491745f , 0.630055f ,
--1.046875f , 0.000000f , -0.421875f , -0.110843f , 0.695120f , 0.710288f ,
--1.210938f , 0.085938f , -0.484375f , 0.600940f , 0.491745f , 0.630055f ,
--1.039062f , 0.000000f , -0.367188f , 0.208777f , 0.953673f , 0.216468f ,
-0.882812f , -0.015625f , -0.265625f , -0.047365f , 0.938444f , 0.342112f ,
-0.882812f , -0.023437f , -0.210938f , 0.252144f , 0.854823f , 0.453505f ,
-1.046875f , 0.000000f , -0.421875f , 0.110843f , 0.695120f , 0.710288f ,
--0.882812f , -0.015625f , -0.265625f , 0.047365f , 0.938444f , 0.342112f ,
--1.046875f , 0.000000f , -0.421875f , -0.110843f , 0.695120f , 0.710288f ,
--0.882812f , -0.023437f , -0.210938f , -0.252144f , 0.854823f , 0.453505f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
-0.828125f , 0.078125f , -0.320312f , 0.424299f , 0.457137f , 0.781640f ,
-0.937500f , 0.062500f , -0.335938f , 0.403455f , 0.151097f , 0.902402f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
--0.937500f , 0.062500f , -0.335938f , -0.403455f , 0.151097f , 0.902402f ,
--0.828125f , 0.078125f , -0.320312f , -0.424299f , 0.457137f , 0.781640f ,
-0.960938f , 0.171875f , -0.351562f , 0.372265f , -0.019379f , 0.927915f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
--0.960938f , 0.171875f , -0.351562f , -0.372265f , -0.019379f , 0.927915f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
-1.054688f , 0.187500f , -0.382812f , 0.325419f , -0.115177f , 0.938505f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--0.960938f , 0.171875f , -0.351562f , -0.372265f , -0.019379f , 0.927915f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
-1.085938f , 0.273438f , -0.390625f , 0.358562f , 0.308054f , 0.881191f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
-1.109375f , 0.210938f , -0.390625f , 0.462752f , -0.381817f , 0.800012f ,
--1.085938f , 0.273438f , -0.390625f , -0.358562f , 0.308054f , 0.881191f ,
--1.109375f , 0.210938f , -0.390625f , -0.462752f , -0.381817f , 0.800012f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
-0.953125f , 0.289063f , -0.343750f , 0.621509f , -0.442213f , 0.646626f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
-1.085938f , 0.273438f , -0.390625f , 0.358562f , 0.308054f , 0.881191f ,
--0.953125f , 0.289063f , -0.343750f , -0.621509f , -0.442213f , 0.646626f ,
--1.039062f , 0.328125f , -0.414062f , -0.520493f , -0.249794f , 0.816492f ,
--1.085938f , 0.273438f , -0.390625f , -0.358562f , 0.308054f , 0.881191f ,
-0.953125f , 0.289063f , -0.343750f , 0.621509f , -0.442213f , 0.646626f ,
-0.890625f , 0.234375f , -0.320312f , 0.663869f , -0.467299f , 0.583819f ,
-1.015625f , 0.234375f , -0.375000f , 0.299570f , -0.054537f , 0.952483f ,
--0.953125f , 0.289063f , -0.343750f , -0.621509f , -0.442213f , 0.646626f ,
--1.015625f , 0.234375f , -0.375000f , -0.299570f , -0.054537f , 0.952483f ,
--0.890625f , 0.234375f , -0.320312f , -0.663869f , -0.467299f , 0.583819f ,
-0.960938f , 0.171875f , -0.351562f , 0.372265f , -0.019379f , 0.927915f ,
-0.890625f , 0.234375f , -0.320312f , 0.663869f , -0.467299f , 0.583819f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
--0.960938f , 0.171875f , -0.351562f , -0.372265f , -0.019379f , 0.927915f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
--0.890625f , 0.234375f , -0.320312f , -0.663869f , -0.467299f , 0.583819f ,
-0.890625f , 0.109375f , -0.328125f , 0.193274f , -0.005554f , 0.981109f ,
-0.843750f , 0.171875f , -0.320312f , 0.517594f , -0.452284f , 0.726279f ,
-0.765625f , 0.093750f , -0.320312f , 0.767510f , 0.233589f , 0.596912f ,
--0.890625f , 0.109375f , -0.328125f , -0.193274f , -0.005554f , 0.981109f ,
--0.828125f , 0.078125f , -0.320312f , -0.424299f , 0.457137f , 0.781640f ,
--0.765625f , 0.093750f , -0.320312f , -0.767510f , 0.233589f , 0.596912f ,
-0.882812f , -0.015625f , -0.265625f , -0.047365f , 0.938444f , 0.342112f ,
-0.937500f , 0.062500f , -0.335938f , 0.403455f , 0.151097f , 0.902402f ,
-0.851562f , 0.015625f , -0.320312f , 0.318278f , 0.387738f , 0.865047f ,
--0.882812f , -0.015625f , -0.265625f , 0.047365f , 0.938444f , 0.342112f ,
--0.812500f , -0.015625f , -0.320312f , -0.651234f , 0.269478f , 0.709403f ,
--0.851562f , 0.015625f , -0.320312f , -0.318278f , 0.387738f , 0.865047f ,
-0.882812f , -0.015625f , -0.265625f , -0.047365f , 0.938444f , 0.342112f ,
-1.046875f , 0.000000f , -0.421875f , 0.110843f , 0.695120f , 0.710288f ,
-0.937500f , 0.062500f , -0.335938f , 0.403455f , 0.151097f , 0.902402f ,
--0.882812f , -0.015625f , -0.265625f , 0.047365f , 0.938444f , 0.342112f ,
--0.937500f , 0.062500f , -0.335938f , -0.403455f , 0.151097f , 0.902402f ,
--1.046875f , 0.000000f , -0.421875f , -0.110843f , 0.695120f , 0.710288f ,
-1.046875f , 0.000000f , -0.421875f , 0.110843f , 0.695120f , 0.710288f ,
-1.210938f , 0.085938f , -0.484375f , -0.600940f , 0.491745f , 0.630055f ,
-1.000000f , 0.125000f , -0.367188f , 0.418226f , -0.076937f , 0.905057f ,
--1.046875f , 0.000000f , -0.421875f , -0.110843f , 0.695120f , 0.710288f ,
--1.000000f , 0.125000f , -0.367188f , -0.418226f , -0.076937f , 0.905057f ,
--1.210938f , 0.085938f , -0.484375f , 0.600940f , 0.491745f , 0.630055f ,
-1.210938f , 0.085938f , -0.484375f , -0.600940f , 0.491745f , 0.630055f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
-1.054688f , 0.187500f , -0.382812f , 0.325419f , -0.115177f , 0.938505f ,
--1.210938f , 0.085938f , -0.484375f , 0.600940f , 0.491745f , 0.630055f ,
--1.054688f , 0.187500f , -0.382812f , -0.325419f , -0.115177f , 0.938505f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
-1.085938f , 0.273438f , -0.390625f , 0.358562f , 0.308054f , 0.881191f ,
-1.109375f , 0.210938f , -0.390625f , 0.462752f , -0.381817f , 0.800012f ,
-1.257812f , 0.242188f , -0.492188f , -0.760613f , -0.032777f , 0.648335f ,
--1.085938f , 0.273438f , -0.390625f , -0.358562f , 0.308054f , 0.881191f ,
--1.187500f , 0.343750f , -0.484375f , 0.208350f , -0.539689f , 0.815638f ,
--1.257812f , 0.242188f , -0.492188f , 0.760613f , -0.032777f , 0.648335f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
-0.789062f , -0.125000f , -0.328125f , -0.225867f , -0.848079f , -0.479293f ,
-1.039062f , -0.085937f , -0.492188f , -0.064669f , -0.682638f , -0.727836f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
--1.039062f , -0.101562f , -0.328125f , -0.461257f , -0.798151f , 0.387494f ,
--1.039062f , -0.085937f , -0.492188f , 0.064669f , -0.682638f , -0.727836f ,
-1.039062f , -0.101562f , -0.328125f , 0.461257f , -0.798151f , 0.387494f ,
-1.039062f , -0.085937f , -0.492188f , -0.064669f , -0.682638f , -0.727836f ,
-1.312500f , 0.054688f , -0.531250f , 0.659566f , -0.485519f , -0.573779f ,
--1.039062f , -0.101562f , -0.328125f , -0.461257f , -0.798151f , 0.387494f ,
--1.281250f , 0.054688f , -0.429688f , -0.680380f , -0.426405f , 0.595996f ,
--1.312500f , 0.054688f , -0.531250f , -0.659566f , -0.485519f , -0.573779f ,
-1.367188f , 0.296875f , -0.500000f , 0.923978f , 0.086001f , -0.372600f ,
-1.351562f , 0.320313f , -0.421875f , 0.762596f , 0.175115f , 0.622700f ,
-1.312500f , 0.054688f , -0.531250f , 0.659566f , -0.485519f , -0.573779f ,
--1.367188f , 0.296875f , -0.500000f , -0.923978f , 0.086001f , -0.372600f ,
--1.312500f , 0.054688f , -0.531250f , -0.659566f , -0.485519f , -0.573779f ,
--1.351562f , 0.320313f , -0.421875f , -0.762596f , 0.175115f , 0.622700f ,
-1.250000f , 0.468750f , -0.546875f , 0.279580f , 0.620777f , -0.732414f ,
-1.234375f , 0.507812f , -0.421875f , 0.365947f , 0.871059f , 0.327555f ,
-1.367188f , 0.296875f , -0.500000f , 0.923978f , 0.086001f , -0.372600f ,
--1.250000f , 0.468750f , -0.546875f , -0.279580f , 0.620777f , -0.732414f ,
--1.367188f , 0.296875f , -0.500000f , -0.923978f , 0.086001f , -0.372600f ,
--1.234375f , 0.507812f , -0.421875f , -0.365947f , 0.871059f , 0.327555f ,
-1.023438f , 0.437500f , -0.484375f , -0.427778f , 0.575518f , -0.696951f ,
-1.023438f , 0.476562f , -0.312500f , -0.037965f , 0.887082f , 0.460036f ,
-1.250000f , 0.468750f , -0.546875f , 0.279580f , 0.620777f , -0.732414f ,
--1.023438f , 0.437500f , -0.484375f , 0.427778f , 0.575518f , -0.696951f ,
--1.250000f , 0.468750f , -0.546875f , -0.279580f , 0.620777f , -0.732414f ,
--1.023438f , 0.476562f , -0.312500f , 0.037965f , 0.887082f , 0.460036f ,
-0.859375f , 0.382813f , -0.382812f , -0.652333f , 0.601001f , -0.461715f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
-1.023438f , 0.437500f , -0.484375f , -0.427778f , 0.575518f , -0.696951f ,
--0.859375f , 0.382813f , -0.382812f , 0.652333f , 0.601001f , -0.461715f ,
--1.023438f , 0.437500f , -0.484375f , 0.427778f , 0.575518f , -0.696951f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
-0.859375f , 0.382813f , -0.382812f , -0.652333f , 0.601001f , -0.461715f ,
-1.023438f , 0.437500f , -0.484375f , -0.427778f , 0.575518f , -0.696951f ,
-0.789062f , -0.125000f , -0.328125f , -0.225867f , -0.848079f , -0.479293f ,
--0.859375f , 0.382813f , -0.382812f , 0.652333f , 0.601001f , -0.461715f ,
--0.789062f , -0.125000f , -0.328125f , 0.225867f , -0.848079f , -0.479293f ,
--1.023438f , 0.437500f , -0.484375f , 0.427778f , 0.575518f , -0.696951f ,
-1.250000f , 0.468750f , -0.546875f , 0.279580f , 0.620777f , -0.732414f ,
-1.312500f , 0.054688f , -0.531250f , 0.659566f , -0.485519f , -0.573779f ,
-1.039062f , -0.085937f , -0.492188f , -0.064669f , -0.682638f , -0.727836f ,
--1.250000f , 0.468750f , -0.546875f , -0.279580f , 0.620777f , -0.732414f ,
--1.023438f , 0.437500f , -0.484375f , 0.427778f , 0.575518f , -0.696951f ,
--1.039062f , -0.085937f , -0.492188f , 0.064669f , -0.682638f , -0.727836f ,
-0.859375f , 0.382813f , -0.382812f , -0.652333f , 0.601001f , -0.461715f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.890625f , 0.406250f , -0.234375f , -0.329600f , 0.748497f , 0.575365f ,
--0.859375f , 0.382813f , -0.382812f , 0.652333f , 0.601001f , -0.461715f ,
--0.890625f , 0.406250f , -0.234375f , 0.329600f , 0.748497f , 0.575365f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.640625f , -0.007812f , -0.429688f , 0.281991f , -0.651753f , -0.704001f ,
-0.773438f , 0.265625f , -0.437500f , 0.669942f , -0.017060f , -0.742180f ,
-0.789062f , -0.125000f , -0.328125f , -0.225867f , -0.848079f , -0.479293f ,
--0.640625f , -0.007812f , -0.429688f , -0.281991f , -0.651753f , -0.704001f ,
--0.789062f , -0.125000f , -0.328125f , 0.225867f , -0.848079f , -0.479293f ,
--0.773438f , 0.265625f , -0.437500f , -0.669942f , -0.017060f , -0.742180f ,
-0.640625f , -0.007812f , -0.429688f , 0.281991f , -0.651753f , -0.704001f ,
-0.789062f , -0.125000f , -0.328125f , -0.225867f , -0.848079f , -0.479293f ,
-0.773438f , -0.140625f , -0.125000f , -0.021424f , -0.683279f , 0.729820f ,
--0.640625f , -0.007812f , -0.429688f , -0.281991f , -0.651753f , -0.704001f ,
--0.593750f , -0.125000f , -0.164062f , -0.333506f , -0.938871f , -0.085238f ,
--0.773438f , -0.140625f , -0.125000f , 0.021424f , -0.683279f , 0.729820f ,
-};
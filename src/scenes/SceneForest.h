@@ -9,7 +9,8 @@
 #include "../Light.h"
 #include "../Skybox.h"
 #include "../Transformation.h"
-#include "../drawable/Bush.h"
+#include "../drawable/MeshPool.h"
+#include "../drawable/StaticMesh.h"
 #include "../drawable/Tree.h"
 #include "../shaders/ShaderLightTexture.h"
 #include "../shaders/ShaderLights.h"
@@ -30,15 +31,17 @@ class ForestFloor {
   public:
     explicit ForestFloor(const std::shared_ptr<AssetManager> &am,
                          Camera &camera,
-                         const std::shared_ptr<LightsCollection> &lights)
-        : textureGrass(am->loadTexture("grass.png")),
+                         const std::shared_ptr<LightsCollection> &lights,
+                         const std::shared_ptr<MaterialRegistry> &materials)
+        : textureGrass(am->loadTextureAsync("grass.png")),
           shaderTexture(ShaderLightTexture::load(am).value()) {
         shaderTexture->setLightCollection(lights);
+        shaderTexture->setMaterialRegistry(materials);
 
         auto material =
             Material(glm::vec4(0.1), glm::vec4(0.419, 0.678, 0.274, 1),
                      glm::vec4(0.047, 1, 0, 1), 64);
-        shaderTexture->setMaterial(material);
+        shaderTexture->setMaterialIndex(materials->intern(material));
 
         camera.attach(shaderTexture);
         camera.projection()->attach(shaderTexture);
@@ -48,14 +51,13 @@ class ForestFloor {
                           .build();
 
         shaderTexture->bind();
-        shaderTexture->setTextureUnitId(textureGrass->getTextureUnit());
         shaderTexture->modelMatrix(modelMatrix);
         shaderTexture->unbind();
     }
 
     void render() {
         shaderTexture->bind();
-
+        shaderTexture->setTexture(*textureGrass);
         cube.draw();
 
         shaderTexture->unbind();
@@ -65,8 +67,9 @@ class ForestFloor {
 class SceneForest : public BasicScene {
   private:
     Tree tree;
-    Bush bush;
+    StaticMesh bush;
     std::shared_ptr<LightsCollection> lights;
+    std::shared_ptr<MaterialRegistry> materials;
 
     std::shared_ptr<ShaderLights> shaderLights;
     std::shared_ptr<ShaderLightCube> shaderLightCube;
@@ -89,6 +92,8 @@ class SceneForest : public BasicScene {
 
     ForestFloor floor;
 
+    // Streamed textures are requested from it every frame
+    std::shared_ptr<AssetManager> assets;
     std::shared_ptr<DynamicModel> houseModel;
     std::shared_ptr<DynamicModel> loginModel;
     glm::mat4 loginModelMatrix;
@@ -96,6 +101,22 @@ class SceneForest : public BasicScene {
     std::shared_ptr<ShaderLightTexture> shaderLightsTexture;
     glm::mat4 houseModelMatrix;
 
+    // First of the house materials, material i of the model is
+    // houseMaterial + i
+    MaterialIndex houseMaterial = 0;
+    // House model is loaded asynchronously, its materials are known only then
+    bool houseMaterialLoaded = false;
+    MaterialIndex loginMaterial;
+    MaterialIndex vegetationMaterial;
+
+    // Vertex pulling path, everything lit by shaderLights in one multi-draw
+    bool vertexPulling = false;
+    MeshPool meshPool;
+    std::shared_ptr<ShaderPulledLights> shaderPulledLights;
+    MeshIndex treeMesh;
+    MeshIndex bushMesh;
+    MeshIndex loginMesh;
+
     void renderMenu() override {
         ImGui::Begin("SceneForest controls");
 
@@ -122,6 +143,12 @@ class SceneForest : public BasicScene {
             skybox->setFollow(followSkybox);
         }
 
+        ImGui::Checkbox("Vertex pulling", &vertexPulling);
+        if (vertexPulling && !MeshPool::hasDrawParameters()) {
+            ImGui::Text("ARB_shader_draw_parameters is not supported, "
+                        "drawing one by one");
+        }
+
         ImGui::End();
     }
 
@@ -150,21 +177,44 @@ class SceneForest : public BasicScene {
     }
 
   public:
+    /*
+     * Reads ahead the files the constructor loads, see SceneSwitcher
+     */
+    static void prefetch(AssetManager &assets) {
+        for (const char *model : {"bushes.obj", "house.obj", "login.obj"}) {
+            assets.prefetch(ASSET_MODEL, model);
+        }
+        assets.prefetch(ASSET_TEXTURE, "grass.png");
+        assets.prefetch(ASSET_TEXTURE, "house.png");
+        assets.prefetchCubemap("skybox-night", "png");
+    }
+
     explicit SceneForest(const std::shared_ptr<GLWindow> &window,
                          const std::shared_ptr<AssetManager> &loader)
-        : BasicScene(window), lights(std::make_shared<LightsCollection>()),
+        : BasicScene(window), bush(loader, "bushes.obj"),
+          lights(std::make_shared<LightsCollection>()),
+          materials(std::make_shared<MaterialRegistry>()),
           shaderLights(ShaderLights::load(loader).value()),
           shaderLightCube(ShaderLightCube::load(loader).value()),
           sun(camera, lights, shaderLightCube),
           flashlight(Flashlight::construct(camera, lights, shaderLightCube)),
           skybox(Skybox::construct(camera, loader, "skybox-night", "png")),
-          floor(loader, camera, lights),
-          houseModel(loader->loadModel("house.obj")),
+          floor(loader, camera, lights, materials),
+          assets(loader), houseModel(loader->loadModelAsync("house.obj")),
           loginModel(loader->loadModel("login.obj")),
-          houseTexture(loader->loadTexture("house.png")),
-          shaderLightsTexture(ShaderLightTexture::load(loader).value()) {
+          houseTexture(loader->loadTextureStreamed("house.png")),
+          shaderLightsTexture(ShaderLightTexture::load(loader).value()),
+          shaderPulledLights(ShaderPulledLights::load(loader).value()) {
         shaderLights->setLightCollection(lights);
         shaderLightsTexture->setLightCollection(lights);
+        shaderLights->setMaterialRegistry(materials);
+        shaderLightsTexture->setMaterialRegistry(materials);
+
+        loginMaterial = materials->intern(
+            Material(glm::vec4(0.1), glm::vec4(0.6), glm::vec4(0.6), 64));
+        vegetationMaterial = materials->intern(
+            Material(glm::vec4(0.1), glm::vec4(0.419, 0.678, 0.274, 1),
+                     glm::vec4(0.047, 1, 0, 1), 64));
         treeTrans = scatterObjects(numberOfTrees);
         bushesTrans = scatterObjects(numberOfBushes);
         camera.attach(shaderLights);
@@ -175,6 +225,16 @@ class SceneForest : public BasicScene {
 
         shaderLights->applyBlinnPhong();
 
+        shaderPulledLights->setLightCollection(lights);
+        shaderPulledLights->setMaterialRegistry(materials);
+        camera.attach(shaderPulledLights);
+        camera.projection()->attach(shaderPulledLights);
+        shaderPulledLights->applyBlinnPhong();
+
+        treeMesh = meshPool.add(tree.getModel());
+        bushMesh = meshPool.add(bush.getModel());
+        loginMesh = meshPool.add(*loginModel);
+
         sun.setPosition(glm::vec3(0, 10, 0));
         sun.setConfigurable(true);
         sun.setColor(glm::vec3(1));
@@ -198,14 +258,24 @@ class SceneForest : public BasicScene {
     }
 
     void renderScene() override {
+        if (!houseMaterialLoaded && houseModel->isReady()) {
+            houseMaterial = materials->addAll(houseModel->getMaterials());
+            houseMaterialLoaded = true;
+        }
+
         skybox->render();
         floor.render();
 
         shaderLightsTexture->bind();
-        shaderLightsTexture->setMaterial(houseModel->getMaterial());
-        shaderLightsTexture->setTextureUnitId(houseTexture->getTextureUnit());
-        shaderLightsTexture->modelMatrix(houseModelMatrix);
-        houseModel->draw();
+        auto houseSphere = houseModel->getBounds().sphere(houseModelMatrix);
+        assets->getTextureStreamer().request(*houseTexture,
+                                             camera.projectedSize(houseSphere));
+        shaderLightsTexture->setTexture(*houseTexture);
+        shaderLightsTexture->modelMatrix(houseModelMatrix *
+                                         houseModel->getPositionTransform());
+        houseModel->draw([&](uint32_t material) {
+            shaderLightsTexture->setMaterialIndex(houseMaterial + material);
+        });
         shaderLightsTexture->unbind();
 
         shaderLightCube->bind();
@@ -215,29 +285,49 @@ class SceneForest : public BasicScene {
             firefly.render();
         }
         shaderLightCube->unbind();
+
+        if (vertexPulling) {
+            renderPulled();
+            return;
+        }
+
         shaderLights->bind();
 
-        shaderLights->setMaterial(
-            Material(glm::vec4(0.1), glm::vec4(0.6), glm::vec4(0.6), 64));
-        shaderLights->modelMatrix(loginModelMatrix);
+        shaderLights->setMaterialIndex(loginMaterial);
+        shaderLights->modelMatrix(loginModelMatrix *
+                                  loginModel->getPositionTransform());
         loginModel->draw();
 
-        shaderLights->setMaterial(Material(glm::vec4(0.1),
-                                           glm::vec4(0.419, 0.678, 0.274, 1),
-                                           glm::vec4(0.047, 1, 0, 1), 64));
+        shaderLights->setMaterialIndex(vegetationMaterial);
 
+        auto treePositions = tree.getPositionTransform();
         for (const auto &item : treeTrans) {
-            shaderLights->modelMatrix(item);
+            shaderLights->modelMatrix(item * treePositions);
             tree.draw();
         }
 
+        auto bushPositions = bush.getPositionTransform();
         for (const auto &item : bushesTrans) {
-            shaderLights->modelMatrix(item);
+            shaderLights->modelMatrix(item * bushPositions);
             bush.draw();
         }
 
         shaderLights->unbind();
     }
 
+    void renderPulled() {
+        meshPool.push(loginMesh, loginModelMatrix, loginMaterial);
+        for (const auto &item : treeTrans) {
+            meshPool.push(treeMesh, item, vegetationMaterial);
+        }
+        for (const auto &item : bushesTrans) {
+            meshPool.push(bushMesh, item, vegetationMaterial);
+        }
+
+        shaderPulledLights->bind();
+        meshPool.draw(*shaderPulledLights);
+        shaderPulledLights->unbind();
+    }
+
     const char *getId() override { return "forest"; }
 };
@@ -5,6 +5,9 @@
 #pragma once
 
 #include "Scene.h"
+#include "../GLStateCache.h"
+#include "../TextureBinder.h"
+#include "../drawable/GeometryRegistry.h"
 #include "imgui.h"
 #include <memory>
 #include <chrono>
@@ -29,6 +32,19 @@ public:
         ImGui::Text("Frame time: %ld ms", duration_ms);
         ImGui::Text("Fps: %f", fps);
         ImGui::Text("Min fps: %f", minFps);
+        // counters of the previous frame, the current one is not finished yet
+        const GLStateStats &stats = GLStateCache::get().lastFrameStats();
+        ImGui::Text("GL state calls issued: %lu", stats.issued);
+        ImGui::Text("GL state calls elided: %lu", stats.elided);
+        const TextureBinderStats &binds =
+            TextureBinder::get().lastFrameStats();
+        ImGui::Text("Texture binds: %lu hits, %lu misses", binds.hits,
+                    binds.misses);
+        const GeometryStats geometry = GeometryRegistry::get().stats();
+        ImGui::Text("Shared meshes: %zu, %zu KiB", geometry.meshes,
+                    geometry.gpuBytes / 1024);
+        ImGui::Text("Mesh uploads: %lu, reuses: %lu", geometry.uploads,
+                    geometry.reuses);
         ImGui::End();
     }
 
@@ -6,17 +6,17 @@
 #include "../Skybox.h"
 #include "../Transformation.h"
 #include "../drawable/PlaneWithTexture.h"
-#include "../shaders/ShaderBasicTexture.h"
+#include "../shaders/ShaderBasicTextureArray.h"
 #include "BasicScene.h"
 #include <memory.h>
 #include <memory>
 
 class SceneHeloTexture : public BasicScene {
     TestModel plane;
-    std::shared_ptr<Texture> woodenFence;
-    std::shared_ptr<Texture> grass;
+    TextureLayer woodenFence;
+    TextureLayer grass;
     std::shared_ptr<GLWindow> window;
-    std::shared_ptr<ShaderBasicTexture> shader;
+    std::shared_ptr<ShaderBasicTextureArray> shader;
     std::shared_ptr<Skybox> skybox;
     TransformationBuilder trans;
 
@@ -38,13 +38,24 @@ class SceneHeloTexture : public BasicScene {
         translate->setPosition(glm::vec3(-0.5, 0, 0));
     }
 
+    void setTexture(const TextureLayer &texture) {
+        shader->setTextureArrayId(static_cast<int32_t>(texture.bind()));
+        shader->setTextureLayer(texture.layer);
+    }
+
   public:
+    static void prefetch(AssetManager &assets) {
+        assets.prefetch(ASSET_TEXTURE, "wooden_fence.png");
+        assets.prefetch(ASSET_TEXTURE, "grass.png");
+        assets.prefetchCubemap("skybox-bright", "jpg");
+    }
+
     explicit SceneHeloTexture(const std::shared_ptr<GLWindow> &window,
                               const std::shared_ptr<AssetManager> &loader)
         : BasicScene(window),
-          woodenFence(loader->loadTexture("wooden_fence.png")),
-          grass(loader->loadTexture("grass.png")), window(window),
-          shader(ShaderBasicTexture::load(loader).value()),
+          woodenFence(loader->loadTextureLayer("wooden_fence.png")),
+          grass(loader->loadTextureLayer("grass.png")), window(window),
+          shader(ShaderBasicTextureArray::load(loader).value()),
           skybox(Skybox::construct(camera, loader, "skybox-bright", "jpg")) {
         shader->update(CameraProperties::defaultProps());
         shader->update(ProjectionMatrix::_default());
@@ -59,12 +70,12 @@ class SceneHeloTexture : public BasicScene {
         shader->bind();
         moveObj1();
         shader->modelMatrix(trans.build());
-        shader->setTextureId(woodenFence->getTextureUnit());
+        setTexture(woodenFence);
         plane.draw();
 
         moveObj2();
         shader->modelMatrix(trans.build());
-        shader->setTextureId(grass->getTextureUnit());
+        setTexture(grass);
         plane.draw();
 
         shader->unbind();
@@ -8,14 +8,17 @@
 #include "../GLWindow.h"
 #include "../Projection.h"
 #include "../Transformation.h"
-#include "../drawable/Sphere.h"
+#include "../drawable/GeometryRegistry.h"
 #include "../shaders/ShaderLights.h"
 #include "BasicScene.h"
 #include <memory>
 
 class SceneLightningBalls : public BasicScene {
-    Sphere sphere;
+    // Procedural, its tessellation can be changed in the menu
+    std::shared_ptr<DynamicModel> sphere;
+    int sphereSegments = 32;
     std::shared_ptr<LightsCollection> lights;
+    std::shared_ptr<MaterialRegistry> materials;
     std::shared_ptr<ShaderLights> shaderLightning;
     std::vector<glm::mat4> ballsModel;
 
@@ -41,11 +44,14 @@ class SceneLightningBalls : public BasicScene {
   public:
     explicit SceneLightningBalls(const std::shared_ptr<GLWindow> &window,
                                  const std::shared_ptr<AssetManager> &loader)
-        : BasicScene(window), sphere(),
+        : BasicScene(window),
+          sphere(GeometryRegistry::get().primitive(Primitive::uvSphere())),
           lights(std::make_shared<LightsCollection>()),
+          materials(std::make_shared<MaterialRegistry>()),
           shaderLightning(std::move(ShaderLights::load(loader).value())),
           ballsModel() {
         shaderLightning->setLightCollection(lights);
+        shaderLightning->setMaterialRegistry(materials);
         camera.attach(shaderLightning);
         camera.projection()->attach(shaderLightning);
         makeBalls();
@@ -60,15 +66,16 @@ class SceneLightningBalls : public BasicScene {
         lights->addLight(light);
         auto material =
             Material(glm::vec4(0.1), glm::vec4(0.5), glm::vec4(0.7), 32);
-        shaderLightning->setMaterial(material);
+        shaderLightning->setMaterialIndex(materials->intern(material));
     }
 
     void renderScene() override {
         shaderLightning->bind();
 
         for (const auto &item : ballsModel) {
-            shaderLightning->modelMatrix(item);
-            sphere.draw();
+            shaderLightning->modelMatrix(item *
+                                         sphere->getPositionTransform());
+            sphere->draw();
         }
 
         shaderLightning->unbind();
@@ -105,6 +112,11 @@ class SceneLightningBalls : public BasicScene {
         //                    ambientColor[2]));
         //        }
 
+        if (ImGui::SliderInt("Sphere segments", &sphereSegments, 4, 128)) {
+            sphere = GeometryRegistry::get().primitive(
+                Primitive::uvSphere(sphereSegments, sphereSegments / 2));
+        }
+
         if (ImGui::Button("Reset camera")) {
             resetCamera();
         }
@@ -16,27 +16,36 @@ class SceneModels : public BasicScene {
     std::shared_ptr<ShaderBasicTexture> shader;
     std::shared_ptr<Texture> texture;
     std::shared_ptr<Skybox> skybox;
+    std::shared_ptr<AssetManager> assets;
 
   public:
+    static void prefetch(AssetManager &assets) {
+        assets.prefetch(ASSET_MODEL, "house.obj");
+        assets.prefetch(ASSET_TEXTURE, "house.png");
+        assets.prefetchCubemap("skybox-bright", "jpg");
+    }
+
     explicit SceneModels(const std::shared_ptr<GLWindow> &window,
                          const std::shared_ptr<AssetManager> &loader)
-        : BasicScene(window), model(loader->loadModel("house.obj")),
+        : BasicScene(window), model(loader->loadModelAsync("house.obj")),
           shader(ShaderBasicTexture::load(loader).value()),
-          texture(loader->loadTexture("house.png")),
-          skybox(Skybox::construct(camera, loader, "skybox-bright", "jpg")) {
+          texture(loader->loadTextureStreamed("house.png")),
+          skybox(Skybox::construct(camera, loader, "skybox-bright", "jpg")),
+          assets(loader) {
         camera.attach(shader);
         camera.projection()->attach(shader);
-        shader->setTextureId(texture->getTextureUnit());
-
-        shader->bind();
-        shader->modelMatrix(glm::mat4(1));
-        shader->unbind();
     }
 
     void renderScene() override {
         skybox->render();
 
         shader->bind();
+        auto sphere = model->getBounds().sphere(glm::mat4(1));
+        assets->getTextureStreamer().request(*texture,
+                                             camera.projectedSize(sphere));
+        shader->setTexture(*texture);
+        // Changes when the model is loaded, positions may be quantised
+        shader->modelMatrix(model->getPositionTransform());
         model->draw();
         shader->unbind();
     }
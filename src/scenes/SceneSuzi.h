@@ -6,24 +6,31 @@
 
 #include "../Camera.h"
 #include "../Projection.h"
-#include "../drawable/Suzi.h"
+#include "../drawable/StaticMesh.h"
 #include "../shaders/ShaderLights.h"
 #include "BasicScene.h"
 #include <memory>
 
 class SceneSuzi : public BasicScene {
-    Suzi suzi;
+    StaticMesh suzi;
     //    std::shared_ptr<ShaderBasic> shaderBasic;
     std::shared_ptr<LightsCollection> lights;
+    std::shared_ptr<MaterialRegistry> materials;
     std::shared_ptr<ShaderLights> shader;
 
   public:
+    static void prefetch(AssetManager &assets) {
+        assets.prefetch(ASSET_MODEL, "suzi_smooth.obj");
+    }
+
     explicit SceneSuzi(const std::shared_ptr<GLWindow> &window,
                        const std::shared_ptr<AssetManager> &loader)
-        : BasicScene(window), suzi(),
+        : BasicScene(window), suzi(loader, "suzi_smooth.obj"),
           lights(std::make_shared<LightsCollection>()),
+          materials(std::make_shared<MaterialRegistry>()),
           shader(std::move(ShaderLights::load(loader).value())) {
         shader->setLightCollection(lights);
+        shader->setMaterialRegistry(materials);
         camera.attach(shader);
         camera.projection()->attach(shader);
 
@@ -34,12 +41,12 @@ class SceneSuzi : public BasicScene {
         lights->addLight(light);
         auto material =
             Material(glm::vec4(0.1), glm::vec4(0.1), glm::vec4(0.1), 32);
-        shader->setMaterial(material);
+        shader->setMaterialIndex(materials->intern(material));
     }
 
     void renderScene() override {
         shader->bind();
-        shader->modelMatrix(glm::mat4(1));
+        shader->modelMatrix(suzi.getPositionTransform());
         suzi.draw();
         shader->unbind();
     }
@@ -5,24 +5,107 @@
 #pragma once
 
 #include "Scene.h"
+#include <chrono>
+#include <functional>
+#include <string>
 #include <vector>
 #include <memory>
+#include "../AssetManager.h"
 #include "../assertions.h"
 #include "imgui.h"
 
+/*
+ * Menu of scenes. Scenes are constructed the first time they are selected,
+ * so only the assets of the scenes that are actually opened get loaded.
+ * While the menu is shown, the assets of the scene under the mouse are read
+ * ahead, and scenes that weren't shown for IDLE_TIMEOUT are destroyed. Their
+ * models and textures are then held only by the AssetManager caches, which
+ * evict them when they need the memory.
+ */
 class SceneSwitcher : public Scene {
+public:
+    using Factory = std::function<std::shared_ptr<Scene>()>;
+    using Prefetch = std::function<void(AssetManager &)>;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr Clock::duration IDLE_TIMEOUT = std::chrono::minutes(2);
+
 private:
-    std::vector<std::shared_ptr<Scene>> scenes;
-    Scene* current = nullptr;
+    struct Entry {
+        std::string id;
+        Factory factory;
+        // Starts reading the files the factory loads, may be empty
+        Prefetch prefetch;
+        bool prefetched = false;
+        // nullptr until the scene is selected, and after it's released
+        std::shared_ptr<Scene> scene;
+        Clock::time_point lastShown;
+    };
+
+    static constexpr size_t NONE = SIZE_MAX;
+
+    std::shared_ptr<AssetManager> assets;
+    std::vector<Entry> scenes;
+    size_t current = NONE;
+    Clock::duration idleTimeout = IDLE_TIMEOUT;
     bool running = true;
 
+    void prefetch(Entry &entry) {
+        if (entry.prefetched || entry.scene || !entry.prefetch) {
+            return;
+        }
+        std::cout << "Prefetching scene " << entry.id << std::endl;
+        entry.prefetch(*assets);
+        entry.prefetched = true;
+    }
+
+    void open(size_t index) {
+        Entry &entry = scenes[index];
+        std::cout << "Changing scene to: " << entry.id << std::endl;
+        if (!entry.scene) {
+            auto start = Clock::now();
+            entry.scene = entry.factory();
+            DEBUG_ASSERT_NOT_NULL(entry.scene);
+            DEBUG_ASSERTF(entry.id == entry.scene->getId(),
+                          "Scene registered as %s is %s", entry.id.c_str(),
+                          entry.scene->getId());
+            auto elapsed =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    Clock::now() - start);
+            std::cout << "Scene " << entry.id << " constructed in "
+                      << elapsed.count() << " ms" << std::endl;
+        }
+        entry.lastShown = Clock::now();
+        current = index;
+    }
+
+    /*
+     * Destroys the scenes nobody looked at for idleTimeout, the next
+     * selection constructs them again
+     */
+    void releaseIdle() {
+        auto now = Clock::now();
+        for (size_t i = 0; i < scenes.size(); i++) {
+            Entry &entry = scenes[i];
+            if (i == current || !entry.scene ||
+                now - entry.lastShown < idleTimeout) {
+                continue;
+            }
+            std::cout << "Releasing idle scene " << entry.id << std::endl;
+            entry.scene.reset();
+            entry.prefetched = false;
+        }
+    }
+
     void renderMenu() {
-        DEBUG_ASSERT(nullptr == current);
+        DEBUG_ASSERT(NONE == current);
         ImGui::Begin("Scene selector");
-        for (auto &scene: scenes) {
-            if (ImGui::Button(scene->getId())) {
-                std::cout << "Changing scene to: " << scene->getId() << std::endl;
-                current = scene.get();
+        for (size_t i = 0; i < scenes.size(); i++) {
+            if (ImGui::Button(scenes[i].id.c_str())) {
+                open(i);
+            } else if (ImGui::IsItemHovered()) {
+                // Likely the next one
+                prefetch(scenes[i]);
             }
         }
         if (ImGui::Button("Exit")) {
@@ -32,24 +115,36 @@ private:
     }
 
 public:
-    void addScene(const std::shared_ptr<Scene> &scene) {
-        scenes.emplace_back(scene);
+    explicit SceneSwitcher(const std::shared_ptr<AssetManager> &assets)
+        : assets(assets) {}
+
+    /*
+     * `id` has to be what getId() of the created scene returns, it's shown
+     * in the menu before the scene exists
+     */
+    void addScene(const std::string &id, Factory factory,
+                  Prefetch prefetch = {}) {
+        scenes.push_back({id, std::move(factory), std::move(prefetch)});
     }
 
+    void setIdleTimeout(Clock::duration timeout) { idleTimeout = timeout; }
+
     void render() override {
-        if (nullptr == current) {
+        releaseIdle();
+        if (NONE == current) {
             renderMenu();
         } else {
-            current->render();
+            scenes[current].lastShown = Clock::now();
+            scenes[current].scene->render();
         }
     }
 
     [[nodiscard]] bool shouldExit() override {
-        if (nullptr == current) {
+        if (NONE == current) {
             return !running;
         } else {
-            if (current->shouldExit()) {
-                current = nullptr;
+            if (scenes[current].scene->shouldExit()) {
+                current = NONE;
             }
         }
         return false;
@@ -15,6 +15,7 @@ class SceneTreeLights : public BasicScene {
   private:
     Tree tree;
     std::shared_ptr<LightsCollection> lights;
+    std::shared_ptr<MaterialRegistry> materials;
     std::shared_ptr<ShaderLights> shaderLightning;
     std::shared_ptr<ShaderLightCube> shaderLightCube;
     TransformationBuilder treeTransformations;
@@ -28,6 +29,7 @@ class SceneTreeLights : public BasicScene {
     glm::vec3 diffuse = glm::vec3(0.2);
     glm::vec3 specular = glm::vec3(0.3);
     float shininess = 8;
+    MaterialIndex materialIndex;
 
     float lightX = 0;
     float lightY = 10;
@@ -57,12 +59,13 @@ class SceneTreeLights : public BasicScene {
         updateLightPos();
     }
 
-    void updateMaterial() {
-        auto material = Material(glm::vec4(ambient, 1), glm::vec4(diffuse, 1),
-                                 glm::vec4(specular, 1), shininess);
-        shaderLightning->setMaterial(material);
+    [[nodiscard]] Material currentMaterial() const {
+        return Material(glm::vec4(ambient, 1), glm::vec4(diffuse, 1),
+                        glm::vec4(specular, 1), shininess);
     }
 
+    void updateMaterial() { materials->set(materialIndex, currentMaterial()); }
+
     void updateLightPos() {
         pointLight.setPosition(glm::vec3(lightX, lightY, lightZ));
     }
@@ -106,14 +109,18 @@ class SceneTreeLights : public BasicScene {
     explicit SceneTreeLights(const std::shared_ptr<GLWindow> &window,
                              const std::shared_ptr<AssetManager> &loader)
         : BasicScene(window), lights(std::make_shared<LightsCollection>()),
+          materials(std::make_shared<MaterialRegistry>()),
           shaderLightning(ShaderLights::load(loader).value()),
           shaderLightCube(ShaderLightCube::load(loader).value()),
           pointLight(PointLight(camera, lights, shaderLightCube)) {
         shaderLightning->setLightCollection(lights);
+        shaderLightning->setMaterialRegistry(materials);
         camera.attach(shaderLightning);
         camera.projection()->attach(shaderLightning);
 
-        updateMaterial();
+        // Own entry, it's edited from the menu
+        materialIndex = materials->add(currentMaterial());
+        shaderLightning->setMaterialIndex(materialIndex);
         shaderLightning->applyBlinnPhong();
 
         treeTransformations = TransformationBuilder().rotateY(0);
@@ -133,7 +140,8 @@ class SceneTreeLights : public BasicScene {
 
         shaderLightning->bind();
         applyRotation();
-        shaderLightning->modelMatrix(treeTransformations.build());
+        shaderLightning->modelMatrix(treeTransformations.build() *
+                                     tree.getPositionTransform());
         tree.draw();
 
         //        shader->modelMatrix(transformationBuilder1.build());
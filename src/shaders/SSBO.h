@@ -7,7 +7,9 @@
 #include <GL/glew.h>
 #include <GL/gl.h>
 #include <vector>
+#include "../GLStateCache.h"
 #include "../assertions.h"
+#include "../gl_dsa.h"
 #include "../gl_utils.h"
 
 template<typename Inner>
@@ -21,36 +23,29 @@ private:
     std::vector<Inner> m_objects;
     size_t m_allocSize = 0;
 
-    inline void bindGlBuffer() {
-        DEBUG_ASSERT(0 != m_ssboId);
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ssboId);
-        gl::assertNoError();
-    }
-
-    inline void unbindGlBuffer() {
-#ifdef DEBUG_ASSERTIONS
-        int currentSSBO = gl::getCurrentSSBO();
-        DEBUG_ASSERTF(currentSSBO == m_ssboId, "Trying to unbind another SSBO");
-        // unbind the buffer
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
-#endif
-        gl::assertNoError();
-    }
-
-
 public:
     // Reallocates the buffer to match our internal representation
     void realloc() {
         DEBUG_ASSERT(0 != m_ssboId);
         DEBUG_ASSERTF((m_objects.size() * sizeof(Inner)) != m_allocSize,
                       "Sizes didn't change, use updateAt(idx) to change element");
-        this->bindGlBuffer();
 
         m_allocSize = m_objects.size() * sizeof(Inner);
-        glBufferData(GL_SHADER_STORAGE_BUFFER, m_allocSize, m_objects.data(), GL_DYNAMIC_DRAW);
-        gl::assertNoError();
+        // Buffer is edited by name, nothing has to be bound
+        gl::bufferData(m_ssboId, m_allocSize, m_objects.data(), GL_DYNAMIC_DRAW);
+    }
 
-        this->unbindGlBuffer();
+    /*
+     * Uploads all objects, reallocates only when the size changed. Use it for
+     * data that is rebuilt every frame.
+     */
+    void sync() {
+        DEBUG_ASSERT(0 != m_ssboId);
+        if ((m_objects.size() * sizeof(Inner)) != m_allocSize) {
+            realloc();
+        } else if (0 != m_allocSize) {
+            gl::bufferSubData(m_ssboId, 0, m_allocSize, m_objects.data());
+        }
     }
 
     void updateAt(size_t idx) {
@@ -61,29 +56,27 @@ public:
         size_t size = sizeof(Inner);
         size_t offset = size * idx;
         Inner& data = m_objects.at(idx);
-        this->bindGlBuffer();
-        glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, &data);
-        this->unbindGlBuffer();
+        gl::bufferSubData(m_ssboId, offset, size, &data);
     }
 
     SSBO(const SSBO &other) = delete;
 
     SSBO(SSBO &&other) noexcept: m_ssboId(other.m_ssboId),
-                                 m_objects(std::move(other.m_objects)) {
+                                 m_objects(std::move(other.m_objects)),
+                                 m_allocSize(other.m_allocSize) {
         other.m_ssboId = 0;
+        other.m_allocSize = 0;
     }
 
-    explicit SSBO() {
-        glGenBuffers(1, &m_ssboId);
-        DEBUG_ASSERT(0 != m_ssboId);
-    }
+    explicit SSBO() : m_ssboId(gl::createBuffer()) {}
 
     /*
      *  Binds the buffer to the binding used in GLSL shader
      */
     void bind(GLuint bindIndex) {
         DEBUG_ASSERT(0 != m_ssboId);
-        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, bindIndex, m_ssboId);
+        GLStateCache::get().bindBufferBase(GL_SHADER_STORAGE_BUFFER, bindIndex,
+                                           m_ssboId);
         gl::assertNoError();
     }
 
@@ -93,7 +86,7 @@ public:
 
     ~SSBO() {
         if (0 != m_ssboId) {
-            glDeleteBuffers(1, &m_ssboId);
+            GLStateCache::get().deleteBuffer(m_ssboId);
         }
     }
 };
@@ -5,6 +5,7 @@
 #ifndef ZPG_SHADER_H
 #define ZPG_SHADER_H
 
+#include "../GLStateCache.h"
 #include "../assertions.h"
 #include "../drawable/Drawable.h"
 #include "../gl_utils.h"
@@ -14,8 +15,11 @@
 #include <glm/matrix.hpp>
 #include <iostream>
 #include <memory>
+#include <string_view>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 template <typename Derived> class ShaderBase {
   private:
@@ -37,14 +41,23 @@ template <typename Derived> class ShaderBase {
      * logs error to stderr
      */
     static std::optional<Derived> compile(const std::string &code) {
-        const auto code_c = code.c_str();
-        return compile(code_c);
+        return compile(std::string_view(code));
     }
 
     static std::optional<Derived> compile(const char *const code) {
+        return compile(std::string_view(code));
+    }
+
+    /*
+     * `code` doesn't have to be null terminated, so it can point straight
+     * into a mapped file
+     */
+    static std::optional<Derived> compile(std::string_view code) {
         const GLenum shader_type = Derived::getShaderType();
         GLuint shader_id = glCreateShader(shader_type);
-        glShaderSource(shader_id, 1, &code, nullptr);
+        const char *code_c = code.data();
+        auto length = static_cast<GLint>(code.size());
+        glShaderSource(shader_id, 1, &code_c, &length);
         glCompileShader(shader_id);
 
         GLint status;
@@ -84,6 +97,9 @@ class ShaderProgram {
   private:
     GLuint program_id;
     bool bound;
+    // glGetUniformLocation does a string lookup in the driver, so remember
+    // the answer. Keys are the uniform names, which are string literals.
+    std::unordered_map<std::string_view, GLint> uniformLocations;
 
     explicit ShaderProgram(GLuint programId)
         : program_id(programId), bound(false) {
@@ -94,7 +110,8 @@ class ShaderProgram {
     ShaderProgram(ShaderProgram &) = delete;
 
     ShaderProgram(ShaderProgram &&other) noexcept
-        : program_id(other.program_id), bound(other.bound) {
+        : program_id(other.program_id), bound(other.bound),
+          uniformLocations(std::move(other.uniformLocations)) {
         other.program_id = 0;
         other.bound = false;
     }
@@ -134,7 +151,7 @@ class ShaderProgram {
 #endif
 
         DEBUG_ASSERT(0 != this->program_id);
-        glUseProgram(this->program_id);
+        GLStateCache::get().useProgram(this->program_id);
     }
 
     inline void unbind() {
@@ -143,15 +160,14 @@ class ShaderProgram {
         DEBUG_ASSERTF(gl::getCurrentProgram() == this->program_id,
                       "Trying to unbind shader of another instance");
 
-        glUseProgram(0);
+        GLStateCache::get().useProgram(0);
 #endif
     }
 
     [[nodiscard]] inline bool isBound() const {
         if (this->bound) {
 #ifdef DEBUG_ASSERTIONS
-            GLint prog = 0;
-            glGetIntegerv(GL_CURRENT_PROGRAM, &prog);
+            GLuint prog = GLStateCache::get().currentProgram();
             DEBUG_ASSERTF(this->program_id == prog,
                           "This program says is active. Our program id: %d, "
                           "bound program id: %d",
@@ -161,14 +177,40 @@ class ShaderProgram {
         return this->bound;
     }
 
-  private:
-    void bindInner(const char *name,
-                   const std::function<void(GLint)> &function) const {
-        DEBUG_ASSERT(this->isBound());
+    /*
+     * Uniforms not used by the shader code are optimized out by the compiler,
+     * use this for optional parameters
+     */
+    bool hasUniform(const char *name) {
+        auto it = uniformLocations.find(name);
+        if (it != uniformLocations.end()) {
+            return -1 != it->second;
+        }
+        GLint id = glGetUniformLocation(program_id, name);
+        uniformLocations.emplace(name, id);
+        return -1 != id;
+    }
 
+  private:
+    GLint uniformLocation(const char *name) {
+        auto it = uniformLocations.find(name);
+        if (it != uniformLocations.end()) {
+            return it->second;
+        }
         GLint id = glGetUniformLocation(program_id, name);
         DEBUG_ASSERTF(-1 != id, "Parameter %s may not exist in the shader",
                       name);
+        uniformLocations.emplace(name, id);
+        return id;
+    }
+
+    /*
+     * Uniforms are written with glProgramUniform*, so the program doesn't
+     * have to be bound (and then unbound) just to change a parameter
+     */
+    void bindInner(const char *name,
+                   const std::function<void(GLuint, GLint)> &function) {
+        GLint id = uniformLocation(name);
 
 #ifdef DEBUG_ASSERTIONS
         {
@@ -178,7 +220,7 @@ class ShaderProgram {
         };
 #endif
 
-        function(id);
+        function(program_id, id);
 
 #ifdef DEBUG_ASSERTIONS
         {
@@ -191,32 +233,40 @@ class ShaderProgram {
 
   public:
     void bindParam(const char *name, const glm::mat4 &mat) {
-        bindInner(name, [&mat](GLint id) {
-            glUniformMatrix4fv(id, 1, GL_FALSE, &mat[0][0]);
+        bindInner(name, [&mat](GLuint program, GLint id) {
+            glProgramUniformMatrix4fv(program, id, 1, GL_FALSE, &mat[0][0]);
         });
     }
 
     void bindParam(const char *name, const glm::mat3 &mat) {
-        bindInner(name, [&mat](GLint id) {
-            glUniformMatrix3fv(id, 1, GL_FALSE, &mat[0][0]);
+        bindInner(name, [&mat](GLuint program, GLint id) {
+            glProgramUniformMatrix3fv(program, id, 1, GL_FALSE, &mat[0][0]);
         });
     }
 
     void bindParam(const char *name, const glm::vec4 &vec) {
-        bindInner(name, [&vec](GLint id) { glUniform4fv(id, 1, &vec[0]); });
+        bindInner(name, [&vec](GLuint program, GLint id) {
+            glProgramUniform4fv(program, id, 1, &vec[0]);
+        });
     }
 
     void bindParam(const char *name, const glm::vec3 &vec) {
-        bindInner(name, [&vec](GLint id) { glUniform3fv(id, 1, &vec[0]); });
+        bindInner(name, [&vec](GLuint program, GLint id) {
+            glProgramUniform3fv(program, id, 1, &vec[0]);
+        });
     }
 
     void bindParam(const char *name, float val) {
-        bindInner(name, [val](GLint id) { glUniform1f(id, val); });
+        bindInner(name, [val](GLuint program, GLint id) {
+            glProgramUniform1f(program, id, val);
+        });
     }
 
     void bindParam(const char *name, int32_t val) {
         static_assert(sizeof(int32_t) == sizeof(GLint));
-        bindInner(name, [val](GLint id) { glUniform1i(id, val); });
+        bindInner(name, [val](GLuint program, GLint id) {
+            glProgramUniform1i(program, id, val);
+        });
     }
 
     bool operator==(const ShaderProgram &rhs) const {
@@ -227,7 +277,7 @@ class ShaderProgram {
 
     ~ShaderProgram() {
         if (0 != program_id) {
-            glDeleteProgram(program_id);
+            GLStateCache::get().deleteProgram(program_id);
 #ifdef DEBUG_ASSERTIONS
             GLenum err = glGetError();
             DEBUG_ASSERT(err != GL_INVALID_VALUE);
@@ -13,13 +13,14 @@ class ShaderBasicTexture
 
   public:
     void setTextureId(int32_t textureUnitId) {
-        auto bound = program.isBound();
-        if (!bound) {
-            program.bind();
-        }
         program.bindParam("textureUnitId", textureUnitId);
-        if (!bound) {
-            program.unbind();
-        }
+    }
+
+    /*
+     * Binds `texture` for the next draw, with its atlas region
+     */
+    void setTexture(const Texture &texture) {
+        setTextureId(static_cast<int32_t>(texture.bind()));
+        program.bindParam("uvTransform", texture.getUvTransform());
     }
 };
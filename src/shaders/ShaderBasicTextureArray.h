@@ -0,0 +1,22 @@
+#pragma once
+
+#include "ShaderCommon.h"
+
+/*
+ * basicTexture with the texture taken from a layer of a texture array, see
+ * AssetManager::loadTextureLayer
+ */
+class ShaderBasicTextureArray
+    : public ShaderCommon<ShaderBasicTextureArray, "basicTexture.glsl",
+                          "basicTextureArray.glsl"> {
+    using ShaderCommon::ShaderCommon;
+
+  public:
+    void setTextureArrayId(int32_t textureUnitId) {
+        program.bindParam("textureArrayId", textureUnitId);
+    }
+
+    void setTextureLayer(int32_t layer) {
+        program.bindParam("textureLayer", layer);
+    }
+};
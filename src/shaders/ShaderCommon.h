@@ -6,6 +6,7 @@
 
 #include "../AssetManager.h"
 #include "../Camera.h"
+#include "../MathHelpers.h"
 #include "../Projection.h"
 #include "Shader.h"
 
@@ -34,12 +35,16 @@ template <std::size_t N> struct StringLiteral {
 
  You can optionally change the names of uniform variables using additional
 template parameters. Template parameters order and their default values:
- "modelMatrix", "viewMatrix", "projectionMatrix"
+ "modelMatrix", "viewMatrix", "projectionMatrix", "normalMatrix"
+
+ Normal matrix is computed on the CPU together with the model matrix and sent
+ only if the shader uses it.
  */
 template <typename Self, StringLiteral VertexName, StringLiteral FragmentName,
           StringLiteral ModelMatrixUniformName = "modelMatrix",
           StringLiteral ViewMatrixUniformName = "viewMatrix",
-          StringLiteral ProjectionMatrixUniformName = "projectionMatrix">
+          StringLiteral ProjectionMatrixUniformName = "projectionMatrix",
+          StringLiteral NormalMatrixUniformName = "normalMatrix">
 class ShaderCommon : public Observer<CameraProperties>,
                      public Observer<ProjectionMatrix>,
                      public Shader {
@@ -77,20 +82,20 @@ class ShaderCommon : public Observer<CameraProperties>,
     void modelMatrix(glm::mat4 mat) {
         DEBUG_ASSERT(program.isBound());
         program.bindParam(ModelMatrixUniformName.value, mat);
+        if (program.hasUniform(NormalMatrixUniformName.value)) {
+            program.bindParam(NormalMatrixUniformName.value,
+                              math::normalMatrix(mat));
+        }
     }
 
     void update(const CameraProperties &action) override {
-        this->bind();
         program.bindParam(ViewMatrixUniformName.value, action.viewMatrix);
         this->onCameraPositionChange(action.cameraPosition);
-        this->unbind();
     }
 
     void update(const ProjectionMatrix &action) override {
-        this->bind();
         program.bindParam(ProjectionMatrixUniformName.value,
                           action.projectionMatrix);
-        this->unbind();
     }
 
     void bind() override { program.bind(); }
@@ -11,13 +11,6 @@ class ShaderLightCube
     using ShaderCommon::ShaderCommon;
 public:
     void setLightColor(glm::vec4 value) {
-        auto bound = program.isBound();
-        if (!bound) {
-            program.bind();
-        }
         program.bindParam("lightColor", value);
-        if (!bound) {
-            program.unbind();
-        }
     }
 };
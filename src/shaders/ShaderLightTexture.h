@@ -1,5 +1,6 @@
 
 #include "../LightsCollection.h"
+#include "../MaterialRegistry.h"
 #include "ShaderCommon.h"
 #include "ShaderLights.h"
 
@@ -8,10 +9,10 @@ class ShaderLightTexture
                           "textureLight.glsl"> {
   private:
     std::shared_ptr<LightsCollection> lights;
+    std::shared_ptr<MaterialRegistry> materials;
 
   protected:
     void onCameraPositionChange(glm::vec3 cameraPosition) override {
-        DEBUG_ASSERT(program.isBound());
         program.bindParam("cameraPosition", cameraPosition);
     }
 
@@ -26,31 +27,39 @@ class ShaderLightTexture
         return lights;
     }
 
-    ShaderLightTexture(const ShaderLights &other) = delete;
+    ShaderLightTexture(const ShaderLightTexture &other) = delete;
 
     ShaderLightTexture(ShaderLightTexture &&other) noexcept
-        : ShaderCommon(std::move(other)), lights(std::move(other.lights)) {}
-
-    void setMaterial(const Material &material) {
-        auto needsBidning = !program.isBound();
-        if (needsBidning) {
-            program.bind();
-        }
-        program.bindParam("material.ambient", material.getAmbient());
-        program.bindParam("material.diffuse", material.getDiffuse());
-        program.bindParam("material.specular", material.getSpecular());
-        program.bindParam("material.shininess", material.getShininess());
-        if (needsBidning) {
-            program.unbind();
-        }
+        : ShaderCommon(std::move(other)), lights(std::move(other.lights)),
+          materials(std::move(other.materials)) {}
+
+    void setMaterialRegistry(const std::shared_ptr<MaterialRegistry> &val) {
+        materials = val;
+    }
+
+    /*
+     * Selects material from the registry, see MaterialRegistry
+     */
+    void setMaterialIndex(MaterialIndex idx) {
+        program.bindParam("materialIndex", static_cast<int32_t>(idx));
     }
 
     void bind() override {
         ShaderCommon::bind();
         lights->bind(0);
+        DEBUG_ASSERT_NOT_NULL(materials);
+        materials->bind(1);
     }
 
     void setTextureUnitId(int32_t textureUnitId) {
         program.bindParam("textureUnitId", textureUnitId);
     }
+
+    /*
+     * Binds `texture` for the next draw, with its atlas region
+     */
+    void setTexture(const Texture &texture) {
+        setTextureUnitId(static_cast<int32_t>(texture.bind()));
+        program.bindParam("uvTransform", texture.getUvTransform());
+    }
 };
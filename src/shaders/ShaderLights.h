@@ -6,14 +6,24 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "../LightGLSL.h"
 #include "../LightsCollection.h"
-#include "../Material.h"
+#include "../MaterialRegistry.h"
 #include "ShaderCommon.h"
 #include <glm/gtx/string_cast.hpp>
 
-class ShaderLights
-    : public ShaderCommon<ShaderLights, "lights.glsl", "lights.glsl"> {
+/*
+ * Lit shader, fragment/lights.glsl with a vertex shader of choice. Use the
+ * ShaderLights and ShaderPulledLights aliases below.
+ */
+template <StringLiteral VertexName>
+class ShaderLightsWith
+    : public ShaderCommon<ShaderLightsWith<VertexName>, VertexName,
+                          "lights.glsl"> {
+    using Base =
+        ShaderCommon<ShaderLightsWith<VertexName>, VertexName, "lights.glsl">;
+
   private:
     std::shared_ptr<LightsCollection> lightCollection;
+    std::shared_ptr<MaterialRegistry> materials;
     int32_t flags = 0; // Lightning features, see fragment/lights.glsl
 
     const int32_t FLAG_AMBIENT = 1 << 0;
@@ -28,26 +38,23 @@ class ShaderLights
 #endif
     }
 
-    void flagsUpdated() {
-        this->bind();
-        program.bindParam("flags", flags);
-        this->unbind();
-    }
+    void flagsUpdated() { this->program.bindParam("flags", flags); }
 
   protected:
     void onCameraPositionChange(glm::vec3 cameraPosition) override {
-        DEBUG_ASSERT(program.isBound());
-        program.bindParam("cameraPosition", cameraPosition);
+        this->program.bindParam("cameraPosition", cameraPosition);
     }
 
   public:
-    using ShaderCommon::ShaderCommon;
+    explicit ShaderLightsWith(ShaderProgram program)
+        : Base(std::move(program)) {}
 
-    ShaderLights(const ShaderLights &other) = delete;
+    ShaderLightsWith(const ShaderLightsWith &other) = delete;
 
-    ShaderLights(ShaderLights &&other) noexcept
-        : ShaderCommon(std::move(other)),
-          lightCollection(std::move(other.lightCollection)) {}
+    ShaderLightsWith(ShaderLightsWith &&other) noexcept
+        : Base(std::move(other)),
+          lightCollection(std::move(other.lightCollection)),
+          materials(std::move(other.materials)) {}
 
 #define BITFLAG(SET_FUNC_NAME, HAS_FUNC_NAME, FLAG_NAME)                       \
     void SET_FUNC_NAME(bool enabled) {                                         \
@@ -102,23 +109,37 @@ class ShaderLights
         setHalfwayEnabled(true);
     }
 
-    void setMaterial(const Material &material) {
-        auto needsBinding = !program.isBound();
-        if (needsBinding) {
-            program.bind();
-        }
-        program.bindParam("material.ambient", material.getAmbient());
-        program.bindParam("material.diffuse", material.getDiffuse());
-        program.bindParam("material.specular", material.getSpecular());
-        program.bindParam("material.shininess", material.getShininess());
-        if (needsBinding) {
-            program.unbind();
-        }
+    void setMaterialRegistry(const std::shared_ptr<MaterialRegistry> &val) {
+        materials = val;
+    }
+
+    /*
+     * Selects material from the registry, see MaterialRegistry
+     */
+    void setMaterialIndex(MaterialIndex idx) {
+        this->program.bindParam("materialIndex", static_cast<int32_t>(idx));
+    }
+
+    /*
+     * Selects the draw record for vertex pulling when the draw can't tell
+     * (no ARB_shader_draw_parameters), see MeshPool
+     */
+    void setDrawIndex(int32_t idx) {
+        this->program.bindParam("drawIndex", idx);
     }
 
     void bind() override {
-        ShaderCommon::bind();
+        Base::bind();
         DEBUG_ASSERT_NOT_NULL(lightCollection);
         lightCollection->bind(0);
+        DEBUG_ASSERT_NOT_NULL(materials);
+        materials->bind(1);
     }
 };
+
+using ShaderLights = ShaderLightsWith<"lights.glsl">;
+
+/*
+ * Fetches vertices from MeshPool instead of a VAO, see vertex/pulledLights.glsl
+ */
+using ShaderPulledLights = ShaderLightsWith<"pulledLights.glsl">;
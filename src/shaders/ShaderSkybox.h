@@ -13,13 +13,6 @@ class ShaderSkybox
 
   public:
     void setCubemapId(int32_t textureUnitId) {
-        auto bound = program.isBound();
-        if (!bound) {
-            program.bind();
-        }
         program.bindParam("UISky", textureUnitId);
-        if (!bound) {
-            program.unbind();
-        }
     }
 };
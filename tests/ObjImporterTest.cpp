@@ -0,0 +1,102 @@
+/*
+ * ObjImporter splits big files into chunks at line ends, a usemtl must give
+ * the same materials however the chunks fall. Exits with 1 on a failure.
+ */
+
+#include "ObjImporter.h"
+#include "ThreadPool.h"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+/*
+ * Indices drawn with every material of `mesh`
+ */
+static std::vector<uint32_t> indicesPerMaterial(const MeshData &mesh) {
+    std::vector<uint32_t> counts(mesh.materials.size(), 0);
+    for (const auto &submesh : mesh.submeshes) {
+        counts.at(submesh.material) += submesh.indexCount;
+    }
+    return counts;
+}
+
+static std::optional<MeshData> import(const std::string &text,
+                                      ThreadPool *pool) {
+    return ObjImporter::import(std::as_bytes(std::span(text)), pool);
+}
+
+static const char *const TRIANGLE = "v 0 0 0\nv 1 0 0\nv 0 1 0\n";
+
+/*
+ * Faces switch between two materials on every line, so wherever a chunk
+ * ends, some usemtl is the last line of one. The comment in front moves
+ * the chunk ends by a byte each time. Every face has its own vertices, so
+ * the optimiser doesn't see thousands of triangles on one vertex.
+ */
+static void alternatingMaterials(ThreadPool &pool) {
+    constexpr uint32_t pairs = 4000;
+    for (size_t shift = 0; shift < 40; shift++) {
+        std::string text = "#" + std::string(shift, ' ') + "\n";
+        for (uint32_t i = 0; i < pairs * 2; i++) {
+            auto x = std::to_string(i);
+            text += "v " + x + " 0 0\nv " + x + " 1 0\nv " + x + " 0 1\n";
+            text += 0 == i % 2 ? "usemtl red\n" : "usemtl blue\n";
+            text += "f -3 -2 -1\n";
+        }
+        auto name = "alternating, shifted by " + std::to_string(shift);
+        auto serial = import(text, nullptr);
+        auto parallel = import(text, &pool);
+        check(serial.has_value() && parallel.has_value(), name + " imports");
+        if (!serial.has_value() || !parallel.has_value()) {
+            continue;
+        }
+        std::vector<uint32_t> expected = {pairs * 3, pairs * 3};
+        check(indicesPerMaterial(*serial) == expected, name + " serial");
+        check(indicesPerMaterial(*parallel) == expected, name + " parallel");
+    }
+}
+
+/*
+ * The usemtl is alone in a chunk, between comments longer than one
+ */
+static void materialInChunkWithoutFaces(ThreadPool &pool) {
+    std::string padding;
+    while (padding.size() < 256 * 1024) {
+        padding += "# nothing to see here\n";
+    }
+    std::string text = std::string(TRIANGLE) + "usemtl red\nf 1 2 3\n" +
+                       padding + "usemtl blue\n" + padding + "f 1 2 3\n";
+    auto mesh = import(text, &pool);
+    check(mesh.has_value(), "usemtl without faces imports");
+    if (mesh.has_value()) {
+        check(indicesPerMaterial(*mesh) == std::vector<uint32_t>{3, 3},
+              "usemtl without faces");
+    }
+}
+
+int main() {
+    // More threads than the test machine may have, so the files get split
+    // into many chunks
+    ThreadPool pool(4);
+    alternatingMaterials(pool);
+    materialInChunkWithoutFaces(pool);
+    if (0 != failures) {
+        std::cout << failures << " checks failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,322 @@
+/*
+ * zpg-cook - offline asset cooker
+ *
+ * Usage: zpg-cook [--compress] [asset directory, default ./assets]
+ *
+ * Converts every source asset into the form the engine loads without any
+ * parsing:
+ *  - models (.obj) are imported by Assimp, optimised for the vertex cache,
+ *    overdraw and vertex fetch (see MeshOptimizer), quantised when they
+ *    allow it (see VertexQuantizer) and written as .zmesh (see CookedMesh)
+ *  - textures (.png, .jpg) are decoded, get a full mip chain and are written
+ *    as .ztex (see CookedTexture). With --compress the levels are block
+ *    compressed, BC1 for opaque textures and BC3 for the rest.
+ *  - shaders (.glsl) are stripped of comments and trailing whitespace
+ *
+ * Output goes to <asset directory>/cooked together with manifest.txt that
+ * AssetManager uses to find it. Assets whose content hash and cooker version
+ * match the manifest are skipped, so running it again is cheap.
+ *
+ * At the end all cooked files are put into one pack, assets.zpak (see
+ * AssetPack), which the engine maps instead of opening files one by one.
+ */
+#include "AssetManifest.h"
+#include "AssetPack.h"
+#include "BlockCompression.h"
+#include "CookedMesh.h"
+#include "CookedTexture.h"
+#include "DecodedImage.h"
+#include "Hash.h"
+#include "MappedFile.h"
+#include "MipChain.h"
+#include "ModelImporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/*
+ * Bump when the output of any cook function changes, everything gets cooked
+ * again then. That includes every bump of the cooked file versions, the
+ * manifest only compares this one.
+ */
+static constexpr uint32_t COOKER_VERSION = 6;
+static_assert(4 == CookedMeshHeader::VERSION &&
+                  2 == CookedTextureHeader::VERSION,
+              "Bump COOKER_VERSION together with the cooked file versions");
+
+/*
+ * Set in the version of textures cooked with --compress, so switching the
+ * flag cooks them again
+ */
+static constexpr uint32_t COMPRESSED_VERSION_BIT = 1u << 31;
+
+enum class JobKind { MODEL, TEXTURE, SHADER };
+
+struct Job {
+    JobKind kind;
+    // Relative to the asset directory, with '/' separators
+    std::string name;
+    std::string cooked;
+    uint64_t sourceHash;
+};
+
+static MappedFile readFile(const fs::path &path) {
+    // Every source is hashed or cooked as a whole right away
+    auto file = MappedFile::open(path, MapHint::POPULATE);
+    DEBUG_ASSERTF(file.has_value(), "Failed to open %s", path.c_str());
+    return std::move(file.value());
+}
+
+static std::optional<JobKind> kindOf(const fs::path &path) {
+    auto ext = path.extension();
+    if (".obj" == ext) {
+        return JobKind::MODEL;
+    }
+    if (".png" == ext || ".jpg" == ext) {
+        return JobKind::TEXTURE;
+    }
+    if (".glsl" == ext) {
+        return JobKind::SHADER;
+    }
+    return {};
+}
+
+static uint32_t cookerVersion(JobKind kind, bool compress) {
+    if (JobKind::TEXTURE == kind && compress) {
+        return COOKER_VERSION | COMPRESSED_VERSION_BIT;
+    }
+    return COOKER_VERSION;
+}
+
+static std::string cookedName(JobKind kind, const std::string &name) {
+    switch (kind) {
+    case JobKind::MODEL:
+        return "cooked/" + name + ".zmesh";
+    case JobKind::TEXTURE:
+        return "cooked/" + name + ".ztex";
+    case JobKind::SHADER:
+        return "cooked/" + name;
+    }
+    UNREACHABLE("Invalid JobKind: %d", static_cast<int>(kind));
+}
+
+// region Cook functions
+
+static bool cookModel(std::span<const std::byte> buf, const fs::path &out) {
+    auto mesh = ModelImporter::import(buf);
+    return CookedMesh::write(out, mesh);
+}
+
+/*
+ * Textures directly in textures/ are 2D textures, which the engine uses with
+ * flipped rows. Files in subdirectories are cubemap faces, which are not
+ * flipped. The texture is stored in the order it's going to be uploaded in.
+ * Compressed levels are made from the finished RGBA8 mip chain.
+ */
+static bool cookTexture(std::span<const std::byte> buf,
+                        const std::string &name, const fs::path &out,
+                        bool compress) {
+    bool flipY = fs::path(name).parent_path() == "textures";
+    auto image = DecodedImage::decode(buf, flipY);
+    auto levels =
+        buildMipChain(image.data(), image.getWidth(), image.getHeight());
+    if (!compress) {
+        return CookedTexture::write(out, levels, flipY);
+    }
+    auto format =
+        bc::hasAlpha(levels[0]) ? TextureFormat::BC3 : TextureFormat::BC1;
+    for (auto &level : levels) {
+        level = bc::compress(level, format);
+    }
+    return CookedTexture::write(out, levels, flipY, format);
+}
+
+/*
+ * Removes comments and trailing whitespace. Line breaks are kept, so line
+ * numbers in compiler errors still point to the source.
+ */
+static bool cookShader(std::string_view src, const fs::path &out) {
+    std::string result;
+    result.reserve(src.size());
+    size_t lineStart = 0;
+    auto endLine = [&]() {
+        while (result.size() > lineStart &&
+               (' ' == result.back() || '\t' == result.back() ||
+                '\r' == result.back())) {
+            result.pop_back();
+        }
+        result += '\n';
+        lineStart = result.size();
+    };
+    for (size_t i = 0; i < src.size(); i++) {
+        if ('/' == src[i] && i + 1 < src.size() && '/' == src[i + 1]) {
+            while (i < src.size() && '\n' != src[i]) {
+                i++;
+            }
+            endLine();
+        } else if ('/' == src[i] && i + 1 < src.size() && '*' == src[i + 1]) {
+            i += 2;
+            while (i + 1 < src.size() &&
+                   !('*' == src[i] && '/' == src[i + 1])) {
+                if ('\n' == src[i]) {
+                    endLine();
+                }
+                i++;
+            }
+            i++;
+        } else if ('\n' == src[i]) {
+            endLine();
+        } else {
+            result += src[i];
+        }
+    }
+
+    std::error_code ec;
+    fs::create_directories(out.parent_path(), ec);
+    auto tmpPath = out;
+    tmpPath += ".tmp";
+    {
+        auto file = std::ofstream(tmpPath, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(result.data(), static_cast<std::streamsize>(result.size()));
+        if (!file.good()) {
+            return false;
+        }
+    }
+    fs::rename(tmpPath, out, ec);
+    return !ec;
+}
+// endregion
+
+int main(int argc, char **argv) {
+    auto start = std::chrono::steady_clock::now();
+    bool compress = false;
+    fs::path base = "./assets";
+    for (int i = 1; i < argc; i++) {
+        if (std::string_view("--compress") == argv[i]) {
+            compress = true;
+        } else {
+            base = argv[i];
+        }
+    }
+    DEBUG_ASSERTF(fs::is_directory(base), "%s is not a directory",
+                  base.c_str());
+    auto manifestPath = base / "cooked" / "manifest.txt";
+    auto manifest = AssetManifest::load(manifestPath);
+
+    // Collect the work, hashing every source on the way
+    std::vector<Job> jobs;
+    size_t upToDate = 0;
+    for (const auto &file : fs::recursive_directory_iterator(base)) {
+        if (!file.is_regular_file()) {
+            continue;
+        }
+        auto rel = fs::relative(file.path(), base);
+        if ("cooked" == *rel.begin()) {
+            continue;
+        }
+        auto kind = kindOf(rel);
+        if (!kind.has_value()) {
+            continue;
+        }
+        auto buf = readFile(file.path());
+        Job job{
+            .kind = kind.value(),
+            .name = rel.generic_string(),
+            .cooked = cookedName(kind.value(), rel.generic_string()),
+            .sourceHash = hash::fnv1a(buf.bytes()),
+        };
+        auto entry = manifest.find(job.name);
+        if (entry.has_value() && entry->sourceHash == job.sourceHash &&
+            entry->cookerVersion == cookerVersion(job.kind, compress) &&
+            entry->cooked == job.cooked && fs::exists(base / job.cooked)) {
+            upToDate++;
+            continue;
+        }
+        jobs.emplace_back(std::move(job));
+    }
+
+    // Every worker takes the next job until there are none left
+    std::atomic<size_t> nextJob = 0;
+    std::atomic<size_t> failed = 0;
+    std::mutex manifestMutex;
+    auto worker = [&]() {
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+            const auto &job = jobs[i];
+            auto buf = readFile(base / job.name);
+            auto out = base / job.cooked;
+            bool ok = false;
+            switch (job.kind) {
+            case JobKind::MODEL:
+                ok = cookModel(buf.bytes(), out);
+                break;
+            case JobKind::TEXTURE:
+                ok = cookTexture(buf.bytes(), job.name, out, compress);
+                break;
+            case JobKind::SHADER:
+                ok = cookShader(buf.text(), out);
+                break;
+            }
+            std::lock_guard lock(manifestMutex);
+            if (!ok) {
+                std::cerr << "Failed to cook " << job.name << std::endl;
+                failed++;
+                continue;
+            }
+            std::cout << "Cooked " << job.name << " -> " << job.cooked
+                      << std::endl;
+            manifest.set(job.name, {job.cooked, job.sourceHash,
+                                    cookerVersion(job.kind, compress)});
+        }
+    };
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, std::max<size_t>(1, jobs.size()));
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; i++) {
+        threads.emplace_back(worker);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (!manifest.save(manifestPath)) {
+        std::cerr << "Failed to write " << manifestPath << std::endl;
+        return 1;
+    }
+
+    // Manifest is sorted by name, so assets from one directory (like the
+    // faces of a cubemap) end up next to each other in the pack
+    auto packPath = base / "cooked" / "assets.zpak";
+    if (!jobs.empty() || !fs::exists(packPath)) {
+        std::vector<std::pair<std::string, fs::path>> packed;
+        for (const auto &[name, entry] : manifest.getEntries()) {
+            if (fs::exists(base / entry.cooked)) {
+                packed.emplace_back(name, base / entry.cooked);
+            }
+        }
+        if (!AssetPack::write(packPath, packed)) {
+            std::cerr << "Failed to write " << packPath << std::endl;
+            return 1;
+        }
+        std::cout << "Packed " << packed.size() << " assets into " << packPath
+                  << std::endl;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Cooked " << jobs.size() - failed << ", up to date "
+              << upToDate << ", failed " << failed << " in "
+              << elapsed.count() << " ms on " << threadCount << " threads"
+              << std::endl;
+    return 0 == failed ? 0 : 1;
+}